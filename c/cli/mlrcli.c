@@ -14,6 +14,7 @@
 #include "dsl/mlr_dsl_cst.h"
 #include "mapping/mappers.h"
 #include "output/lrec_writers.h"
+#include "output/multi_out.h"
 #include "cli/mlrcli.h"
 #include "cli/quoting.h"
 #include "cli/argparse.h"
@@ -73,6 +74,7 @@ static mapper_setup_t* mapper_lookup_table[] = {
 	&mapper_seqgen_setup,
 	&mapper_shuffle_setup,
 	&mapper_sort_setup,
+	&mapper_split_setup,
 	&mapper_stats1_setup,
 	&mapper_stats2_setup,
 	&mapper_step_setup,
@@ -189,6 +191,19 @@ cli_opts_t* parse_command_line(int argc, char** argv, sllv_t** ppmapper_list) {
 			}
 			argi += 2;
 
+		} else if (streq(argv[argi], "--max-open-files")) {
+			check_arg_count(argv, argi, argc, 2);
+			int max_open_files = 0;
+			if (sscanf(argv[argi+1], "%d", &max_open_files) != 1 || max_open_files <= 0) {
+				fprintf(stderr,
+					"%s: --max-open-files argument must be a positive integer; got \"%s\".\n",
+					MLR_GLOBALS.bargv0, argv[argi+1]);
+				main_usage_short(stderr, MLR_GLOBALS.bargv0);
+				exit(1);
+			}
+			multi_out_set_max_open_files(max_open_files);
+			argi += 2;
+
 		} else if (streq(argv[argi], "--seed")) {
 			check_arg_count(argv, argi, argc, 2);
 			if (sscanf(argv[argi+1], "0x%x", &rand_seed) == 1) {
@@ -211,6 +226,8 @@ cli_opts_t* parse_command_line(int argc, char** argv, sllv_t** ppmapper_list) {
 	}
 
 	cli_apply_defaults(popts);
+	// The DSL's constant folding formats floats while the mappers are being constructed.
+	MLR_GLOBALS.ofmt = popts->ofmt;
 
 	lhmss_t* default_rses = get_default_rses();
 	lhmss_t* default_fses = get_default_fses();
@@ -958,6 +975,11 @@ static void main_usage_other_options(FILE* o, char* argv0) {
 	fprintf(o, "                     urand()/urandint()/urand32().\n");
 	fprintf(o, "  --nr-progress-mod {m}, with m a positive integer: print filename and record\n");
 	fprintf(o, "                     count to stderr every m input records.\n");
+	fprintf(o, "  --max-open-files {n} Maximum number of files kept open at once for redirected\n");
+	fprintf(o, "                     output, e.g. tee > $a.\".csv\", $*. Past this, the least\n");
+	fprintf(o, "                     recently written file is closed, and reopened for append if\n");
+	fprintf(o, "                     it's written to again. Default: the process's open-file\n");
+	fprintf(o, "                     limit (ulimit -n) less %d.\n", MULTI_OUT_RESERVED_OPEN_FILES);
 	fprintf(o, "  --from {filename}  Use this to specify an input file before the verb(s),\n");
 	fprintf(o, "                     rather than after. May be used more than once. Example:\n");
 	fprintf(o, "                     \"%s --from a.dat --from b.dat cat\" is the same as\n", argv0);
@@ -0,0 +1,247 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lib/mlr_globals.h"
+#include "lib/mlrutil.h"
+#include "containers/hash_index.h"
+
+// ----------------------------------------------------------------
+// The positions and control bytes share one allocation, since miller constructs
+// an awful lot of small maps.
+void hash_index_init(hash_index_t* pindex, int capacity) {
+	int rounded = HASH_INDEX_GROUP_SIZE;
+	while (rounded < capacity)
+		rounded *= 2;
+
+	pindex->positions   = mlr_malloc_or_die(rounded * (sizeof(int) + sizeof(unsigned char)));
+	pindex->ctrl        = (unsigned char*)&pindex->positions[rounded];
+	pindex->capacity    = rounded;
+	pindex->num_full    = 0;
+	pindex->num_deleted = 0;
+	memset(pindex->ctrl, HASH_INDEX_EMPTY, rounded);
+}
+
+void hash_index_free(hash_index_t* pindex) {
+	free(pindex->positions);
+	pindex->positions = NULL;
+	pindex->ctrl      = NULL;
+	pindex->capacity  = 0;
+	pindex->num_full  = 0;
+	pindex->num_deleted = 0;
+}
+
+void hash_index_clear(hash_index_t* pindex) {
+	memset(pindex->ctrl, HASH_INDEX_EMPTY, pindex->capacity);
+	pindex->num_full    = 0;
+	pindex->num_deleted = 0;
+}
+
+// ----------------------------------------------------------------
+// Full slots have the high bit clear; EMPTY and DELETED have it set.
+static inline unsigned group_available_bits(unsigned char* pgroup) {
+#ifdef __SSE2__
+	return (unsigned)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)pgroup));
+#else
+	unsigned bits = 0;
+	for (int i = 0; i < HASH_INDEX_GROUP_SIZE; i++)
+		if (pgroup[i] & 0x80)
+			bits |= 1u << i;
+	return bits;
+#endif
+}
+
+void hash_index_insert(hash_index_t* pindex, unsigned hash, int position) {
+	unsigned mask   = pindex->capacity - 1;
+	unsigned group  = hash_index_first_group(pindex, hash);
+	unsigned stride = 0;
+
+	while (TRUE) {
+		unsigned bits = group_available_bits(&pindex->ctrl[group]);
+		if (bits != 0) {
+			int slot = group + __builtin_ctz(bits);
+			if (pindex->ctrl[slot] == HASH_INDEX_DELETED)
+				pindex->num_deleted--;
+			pindex->ctrl[slot] = hash_index_tag(hash);
+			pindex->positions[slot] = position;
+			pindex->num_full++;
+			return;
+		}
+		stride += HASH_INDEX_GROUP_SIZE;
+		if (stride > mask) {
+			fprintf(stderr, "%s: internal coding error: hash index full.\n", MLR_GLOBALS.bargv0);
+			exit(1);
+		}
+		group = (group + stride) & mask;
+	}
+}
+
+// ----------------------------------------------------------------
+// If the slot's group has an empty slot then no probe for any other key has
+// gone past this group, so the slot can be marked empty rather than deleted.
+void hash_index_remove(hash_index_t* pindex, unsigned hash, int position) {
+	unsigned mask   = pindex->capacity - 1;
+	unsigned group  = hash_index_first_group(pindex, hash);
+	unsigned stride = 0;
+	unsigned char tag = hash_index_tag(hash);
+
+	while (TRUE) {
+		unsigned empty_bits = _hash_index_group_match(&pindex->ctrl[group], HASH_INDEX_EMPTY);
+		for (unsigned bits = _hash_index_group_match(&pindex->ctrl[group], tag); bits != 0; bits &= bits - 1) {
+			int slot = group + __builtin_ctz(bits);
+			if (pindex->positions[slot] != position)
+				continue;
+			if (empty_bits != 0) {
+				pindex->ctrl[slot] = HASH_INDEX_EMPTY;
+			} else {
+				pindex->ctrl[slot] = HASH_INDEX_DELETED;
+				pindex->num_deleted++;
+			}
+			pindex->num_full--;
+			return;
+		}
+		stride += HASH_INDEX_GROUP_SIZE;
+		if (empty_bits != 0 || stride > mask)
+			break;
+		group = (group + stride) & mask;
+	}
+	fprintf(stderr, "%s: internal coding error: hash-index entry not found for removal.\n", MLR_GLOBALS.bargv0);
+	exit(1);
+}
+
+// ----------------------------------------------------------------
+int hash_index_count_full(hash_index_t* pindex) {
+	int count = 0;
+	for (int i = 0; i < pindex->capacity; i++)
+		if (!(pindex->ctrl[i] & 0x80))
+			count++;
+	return count;
+}
+
+// ================================================================
+void hash_table_init(hash_table_t* ptable, int entry_size, int capacity) {
+	hash_index_init(&ptable->index, capacity);
+	ptable->num_occupied     = 0;
+	ptable->num_used         = 0;
+	ptable->entry_size       = entry_size;
+	ptable->entries_capacity = hash_index_max_load(ptable->index.capacity);
+	// Entries past num_used are don't-cares, so they aren't cleared here: that
+	// would drastically slow down making empty maps, and miller makes an awful
+	// lot of those.
+	ptable->entries          = mlr_malloc_or_die((size_t)entry_size * ptable->entries_capacity);
+	ptable->phead            = NULL;
+	ptable->ptail            = NULL;
+}
+
+void hash_table_free(hash_table_t* ptable) {
+	free(ptable->entries);
+	hash_index_free(&ptable->index);
+	ptable->entries      = NULL;
+	ptable->num_occupied = 0;
+	ptable->num_used     = 0;
+	ptable->phead        = NULL;
+	ptable->ptail        = NULL;
+}
+
+void hash_table_clear(hash_table_t* ptable) {
+	hash_index_clear(&ptable->index);
+	ptable->num_occupied = 0;
+	ptable->num_used     = 0;
+	ptable->phead        = NULL;
+	ptable->ptail        = NULL;
+}
+
+// ----------------------------------------------------------------
+// Keys aren't rehashed, since the hashes are stored. Entries are copied in link
+// order, which is also array order, leaving out the holes; the capacity is
+// doubled unless that alone frees up enough room.
+static void hash_table_enlarge(hash_table_t* ptable) {
+	int new_capacity = ptable->index.capacity;
+	if (ptable->num_occupied >= hash_index_max_load(new_capacity) / 2)
+		new_capacity *= 2;
+
+	hash_index_free(&ptable->index);
+	hash_index_init(&ptable->index, new_capacity);
+	ptable->entries_capacity = hash_index_max_load(ptable->index.capacity);
+
+	hash_entry_t* pold_head = ptable->phead;
+	void* old_entries = ptable->entries;
+	ptable->entries = mlr_malloc_or_die((size_t)ptable->entry_size * ptable->entries_capacity);
+
+	int n = 0;
+	hash_entry_t* pprev = NULL;
+	for (hash_entry_t* pold = pold_head; pold != NULL; pold = pold->pnext, n++) {
+		hash_entry_t* pe = hash_table_entry_at(ptable, n);
+		memcpy(pe, pold, ptable->entry_size);
+		pe->pprev = pprev;
+		if (pprev != NULL)
+			pprev->pnext = pe;
+		hash_index_insert(&ptable->index, pe->hash, n);
+		pprev = pe;
+	}
+	if (pprev != NULL)
+		pprev->pnext = NULL;
+	ptable->phead    = (n == 0) ? NULL : hash_table_entry_at(ptable, 0);
+	ptable->ptail    = pprev;
+	ptable->num_used = n;
+	free(old_entries);
+}
+
+// ----------------------------------------------------------------
+void* hash_table_append(hash_table_t* ptable, unsigned hash) {
+	if (ptable->num_used >= ptable->entries_capacity || hash_index_is_full(&ptable->index))
+		hash_table_enlarge(ptable);
+
+	hash_entry_t* pe = hash_table_entry_at(ptable, ptable->num_used);
+	pe->hash  = hash;
+	pe->pprev = ptable->ptail;
+	pe->pnext = NULL;
+	if (ptable->ptail == NULL)
+		ptable->phead = pe;
+	else
+		ptable->ptail->pnext = pe;
+	ptable->ptail = pe;
+
+	hash_index_insert(&ptable->index, hash, ptable->num_used);
+	ptable->num_used++;
+	ptable->num_occupied++;
+	return pe;
+}
+
+// ----------------------------------------------------------------
+void hash_table_remove(hash_table_t* ptable, void* pentry) {
+	hash_entry_t* pe = pentry;
+	int position = ((char*)pe - (char*)ptable->entries) / ptable->entry_size;
+	hash_index_remove(&ptable->index, pe->hash, position);
+
+	if (pe->pprev == NULL)
+		ptable->phead = pe->pnext;
+	else
+		pe->pprev->pnext = pe->pnext;
+	if (pe->pnext == NULL)
+		ptable->ptail = pe->pprev;
+	else
+		pe->pnext->pprev = pe->pprev;
+	ptable->num_occupied--;
+}
+
+// ----------------------------------------------------------------
+int hash_table_check_counts(hash_table_t* ptable) {
+	int nidx = hash_index_count_full(&ptable->index);
+	if (nidx != ptable->num_occupied) {
+		fprintf(stderr,
+			"occupancy-count mismatch:  actual %d != cached  %d.\n",
+				nidx, ptable->num_occupied);
+		return FALSE;
+	}
+	int nlist = 0;
+	for (hash_entry_t* pe = ptable->phead; pe != NULL; pe = pe->pnext)
+		nlist++;
+	if (nlist != ptable->num_occupied) {
+		fprintf(stderr,
+			"list-length mismatch:  actual %d != cached  %d.\n",
+				nlist, ptable->num_occupied);
+		return FALSE;
+	}
+	return TRUE;
+}
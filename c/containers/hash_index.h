@@ -0,0 +1,220 @@
+// ================================================================
+// Open-addressing hash index, and entry tables over it, shared by the
+// string-keyed maps and sets in this directory (lhmsv, lhmss, hss, etc.).
+//
+// Those keep their entries in a dense array, in insertion order, with each
+// entry's full hash stored alongside it. This index maps hashes to positions in
+// that array. Since the full hashes are stored, growing the index never
+// rehashes keys.
+//
+// The layout is after Google's Swiss tables. Each slot has a control byte which
+// is EMPTY, DELETED, or the low seven bits of the hash of the entry there.
+// Slots are probed a group of sixteen at a time, comparing all the control
+// bytes in the group at once (using SSE2 where available), so nearly all
+// misses, and nearly all non-matching entries on the way to a hit, are ruled
+// out without touching entries or comparing keys. Groups are probed in
+// triangular order, which visits every group since the number of groups is a
+// power of two.
+// ================================================================
+
+#ifndef HASH_INDEX_H
+#define HASH_INDEX_H
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define HASH_INDEX_GROUP_SIZE 16
+#define HASH_INDEX_EMPTY      0x80
+#define HASH_INDEX_DELETED    0xfe
+
+typedef struct _hash_index_t {
+	int*           positions; // Entry-array position for each full slot
+	unsigned char* ctrl;      // Control byte for each slot
+	int            capacity;  // Power of two, and at least the group size
+	int            num_full;
+	int            num_deleted;
+} hash_index_t;
+
+// Capacity is rounded up to a power of two.
+void hash_index_init(hash_index_t* pindex, int capacity);
+// Frees the arrays but not the struct, which is meant to be embedded in its map.
+void hash_index_free(hash_index_t* pindex);
+void hash_index_clear(hash_index_t* pindex);
+
+// The caller must have checked that the position isn't already indexed, and
+// that hash_index_is_full is false.
+void hash_index_insert(hash_index_t* pindex, unsigned hash, int position);
+void hash_index_remove(hash_index_t* pindex, unsigned hash, int position);
+
+// Unit-test hook: counts full slots by scanning the control bytes.
+int hash_index_count_full(hash_index_t* pindex);
+
+// Seven-eighths load, counting tombstones. The owning map should grow its
+// index, and its entry array, when this is true.
+static inline int hash_index_max_load(int capacity) {
+	return capacity - capacity / 8;
+}
+static inline int hash_index_is_full(hash_index_t* pindex) {
+	return pindex->num_full + pindex->num_deleted >= hash_index_max_load(pindex->capacity);
+}
+
+// ----------------------------------------------------------------
+// Lookup. Example:
+//
+//   hash_index_probe_t probe;
+//   hash_index_probe_start(&pmap->index, hash, &probe);
+//   for (int pos = hash_index_probe_next(&pmap->index, &probe); pos >= 0;
+//     pos = hash_index_probe_next(&pmap->index, &probe))
+//   {
+//     if (pmap->entries[pos].hash == hash && streq(pmap->entries[pos].key, key))
+//       return &pmap->entries[pos];
+//   }
+//   return NULL;
+
+typedef struct _hash_index_probe_t {
+	unsigned group;      // Slot index of the start of the current group
+	unsigned stride;
+	unsigned match_bits; // Slots in the current group with matching tags, not yet returned
+	unsigned empty_bits; // Slots in the current group which are empty
+	unsigned char tag;
+} hash_index_probe_t;
+
+// One bit per slot in the group whose control byte equals c.
+static inline unsigned _hash_index_group_match(unsigned char* pgroup, unsigned char c) {
+#ifdef __SSE2__
+	__m128i group = _mm_loadu_si128((const __m128i*)pgroup);
+	return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)c)));
+#else
+	unsigned bits = 0;
+	for (int i = 0; i < HASH_INDEX_GROUP_SIZE; i++)
+		if (pgroup[i] == c)
+			bits |= 1u << i;
+	return bits;
+#endif
+}
+
+// Tags are the low bits of the hash; group selection uses the rest.
+static inline unsigned char hash_index_tag(unsigned hash) {
+	return hash & 0x7f;
+}
+static inline unsigned hash_index_first_group(hash_index_t* pindex, unsigned hash) {
+	return (hash >> 7) & (pindex->capacity - 1) & ~(HASH_INDEX_GROUP_SIZE - 1);
+}
+
+static inline void hash_index_probe_start(hash_index_t* pindex, unsigned hash, hash_index_probe_t* pprobe) {
+	pprobe->tag        = hash_index_tag(hash);
+	pprobe->group      = hash_index_first_group(pindex, hash);
+	pprobe->stride     = 0;
+	pprobe->match_bits = _hash_index_group_match(&pindex->ctrl[pprobe->group], pprobe->tag);
+	pprobe->empty_bits = _hash_index_group_match(&pindex->ctrl[pprobe->group], HASH_INDEX_EMPTY);
+}
+
+// Returns the entry position of the next candidate, or -1 when there are no more.
+static inline int hash_index_probe_next(hash_index_t* pindex, hash_index_probe_t* pprobe) {
+	while (1) {
+		if (pprobe->match_bits != 0) {
+			int i = __builtin_ctz(pprobe->match_bits);
+			pprobe->match_bits &= pprobe->match_bits - 1;
+			return pindex->positions[pprobe->group + i];
+		}
+		// A key is never placed past a group which had an empty slot at the time.
+		if (pprobe->empty_bits != 0)
+			return -1;
+		pprobe->stride += HASH_INDEX_GROUP_SIZE;
+		pprobe->group = (pprobe->group + pprobe->stride) & (pindex->capacity - 1);
+		pprobe->match_bits = _hash_index_group_match(&pindex->ctrl[pprobe->group], pprobe->tag);
+		pprobe->empty_bits = _hash_index_group_match(&pindex->ctrl[pprobe->group], HASH_INDEX_EMPTY);
+	}
+}
+
+// ================================================================
+// Entry tables: everything about the maps and sets which doesn't depend on
+// their key and value types. That is, the entry array, the insertion-order
+// links, and keeping the index in step with them. Removal leaves a hole in the
+// entry array, which is squeezed out when the table is next enlarged.
+//
+// A typed container's entry struct starts with HASH_ENTRY_FIELDS, and the
+// container itself is a union of a hash_table_t, for the functions below, and
+// HASH_TABLE_FIELDS of its own entry type, for its callers. E.g.
+//
+//   typedef struct _lhmsve_t {
+//     HASH_ENTRY_FIELDS(_lhmsve_t);
+//     char* key;
+//     void* pvvalue;
+//   } lhmsve_t;
+//
+//   typedef struct _lhmsv_t {
+//     union {
+//       hash_table_t table;
+//       struct { HASH_TABLE_FIELDS(lhmsve_t); };
+//     };
+//   } lhmsv_t;
+//
+// and then walks its entries from phead along the pnext links, looks up keys
+// using hash_table_find, and adds them using hash_table_append.
+
+#define HASH_ENTRY_FIELDS(struct_tag) \
+	unsigned hash; \
+	struct struct_tag* pprev; \
+	struct struct_tag* pnext
+
+#define HASH_TABLE_FIELDS(entry_type) \
+	int          num_occupied; \
+	int          num_used;    /* Including holes left by removal */ \
+	int          entries_capacity; \
+	int          entry_size; \
+	entry_type*  entries; \
+	entry_type*  phead; \
+	entry_type*  ptail; \
+	hash_index_t index
+
+typedef struct _hash_entry_t {
+	HASH_ENTRY_FIELDS(_hash_entry_t);
+} hash_entry_t;
+
+typedef struct _hash_table_t {
+	HASH_TABLE_FIELDS(hash_entry_t);
+} hash_table_t;
+
+// Capacity is for the index, as with hash_index_init.
+void  hash_table_init(hash_table_t* ptable, int entry_size, int capacity);
+// Frees the arrays but not the struct, which is meant to be embedded in its container.
+void  hash_table_free(hash_table_t* ptable);
+void  hash_table_clear(hash_table_t* ptable);
+
+// Returns a new entry at the end of the table, with its hash and links set and
+// the rest left to the caller. The caller must have checked that the key isn't
+// already present. Entries may move when the table is enlarged, so pointers to
+// them are good only until the next append.
+void* hash_table_append(hash_table_t* ptable, unsigned hash);
+void  hash_table_remove(hash_table_t* ptable, void* pentry);
+
+// Unit-test hook: checks the index and the links against num_occupied.
+int   hash_table_check_counts(hash_table_t* ptable);
+
+static inline hash_entry_t* hash_table_entry_at(hash_table_t* ptable, int position) {
+	return (hash_entry_t*)((char*)ptable->entries + (size_t)position * ptable->entry_size);
+}
+
+// The stored hashes are compared first, so nearly all the key comparisons are
+// for the key actually sought. Since this is inlined, the key-comparison
+// function is too.
+typedef int hash_table_key_matches_func_t(void* pentry, void* pvkey);
+
+static inline void* hash_table_find(hash_table_t* ptable, unsigned hash, void* pvkey,
+	hash_table_key_matches_func_t* pkey_matches_func)
+{
+	hash_index_probe_t probe;
+	hash_index_probe_start(&ptable->index, hash, &probe);
+	for (int pos = hash_index_probe_next(&ptable->index, &probe); pos >= 0;
+		pos = hash_index_probe_next(&ptable->index, &probe))
+	{
+		hash_entry_t* pe = hash_table_entry_at(ptable, pos);
+		if (pe->hash == hash && pkey_matches_func(pe, pvkey))
+			return pe;
+	}
+	return NULL;
+}
+
+#endif // HASH_INDEX_H
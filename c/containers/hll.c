@@ -0,0 +1,193 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "lib/mlrutil.h"
+#include "lib/mlr_globals.h"
+#include "containers/hll.h"
+
+#define INITIAL_SPARSE_CAPACITY 16
+
+// ----------------------------------------------------------------
+hll_t* hll_alloc(int precision) {
+	if (precision < HLL_MIN_PRECISION || precision > HLL_MAX_PRECISION) {
+		fprintf(stderr, "%s: HyperLogLog precision must be from %d to %d; got %d.\n",
+			MLR_GLOBALS.bargv0, HLL_MIN_PRECISION, HLL_MAX_PRECISION, precision);
+		exit(1);
+	}
+	hll_t* phll = mlr_malloc_or_die(sizeof(hll_t));
+	phll->precision          = precision;
+	phll->num_registers      = 1 << precision;
+	phll->registers          = NULL;
+	phll->sparse_capacity    = INITIAL_SPARSE_CAPACITY;
+	phll->sparse_hashes      = mlr_malloc_or_die(phll->sparse_capacity * sizeof(unsigned long long));
+	phll->num_sparse         = 0;
+	phll->num_sparse_deduped = 0;
+	// The sparse list is given no more memory than the registers would take.
+	phll->sparse_max_capacity = phll->num_registers / sizeof(unsigned long long);
+	if (phll->sparse_max_capacity < INITIAL_SPARSE_CAPACITY)
+		phll->sparse_max_capacity = INITIAL_SPARSE_CAPACITY;
+	return phll;
+}
+
+void hll_free(hll_t* phll) {
+	if (phll == NULL)
+		return;
+	free(phll->registers);
+	free(phll->sparse_hashes);
+	free(phll);
+}
+
+// ----------------------------------------------------------------
+// The top precision bits of the hash select the register. The register keeps
+// the maximum, over all hashes assigned to it, of the position of the first one
+// bit in the rest of the hash. The sentinel bit caps that at 64 - precision + 1.
+static inline void dense_ingest(hll_t* phll, unsigned long long hash) {
+	int index = hash >> (64 - phll->precision);
+	unsigned long long rest = (hash << phll->precision) | (1ULL << (phll->precision - 1));
+	unsigned char rho = __builtin_clzll(rest) + 1;
+	if (rho > phll->registers[index])
+		phll->registers[index] = rho;
+}
+
+static int ull_cmp(const void* pva, const void* pvb) {
+	unsigned long long a = *(const unsigned long long*)pva;
+	unsigned long long b = *(const unsigned long long*)pvb;
+	return (a < b) ? -1 : (a > b) ? 1 : 0;
+}
+
+static void sparse_dedupe(hll_t* phll) {
+	if (phll->num_sparse_deduped == phll->num_sparse)
+		return;
+	unsigned long long* ph = phll->sparse_hashes;
+	qsort(ph, phll->num_sparse, sizeof(unsigned long long), ull_cmp);
+	int n = 0;
+	for (int i = 0; i < phll->num_sparse; i++)
+		if (n == 0 || ph[i] != ph[n-1])
+			ph[n++] = ph[i];
+	phll->num_sparse = n;
+	phll->num_sparse_deduped = n;
+}
+
+static void sparse_to_dense(hll_t* phll) {
+	phll->registers = mlr_malloc_or_die(phll->num_registers);
+	memset(phll->registers, 0, phll->num_registers);
+	for (int i = 0; i < phll->num_sparse; i++)
+		dense_ingest(phll, phll->sparse_hashes[i]);
+	free(phll->sparse_hashes);
+	phll->sparse_hashes = NULL;
+	phll->num_sparse = 0;
+	phll->num_sparse_deduped = 0;
+	phll->sparse_capacity = 0;
+}
+
+// ----------------------------------------------------------------
+void hll_ingest_hash(hll_t* phll, unsigned long long hash) {
+	if (phll->registers != NULL) {
+		dense_ingest(phll, hash);
+		return;
+	}
+
+	if (phll->num_sparse >= phll->sparse_capacity) {
+		if (phll->sparse_capacity < phll->sparse_max_capacity) {
+			phll->sparse_capacity *= 2;
+			if (phll->sparse_capacity > phll->sparse_max_capacity)
+				phll->sparse_capacity = phll->sparse_max_capacity;
+			phll->sparse_hashes = mlr_realloc_or_die(phll->sparse_hashes,
+				phll->sparse_capacity * sizeof(unsigned long long));
+		} else {
+			sparse_dedupe(phll);
+			// Stay sparse only if deduping made a good amount of room.
+			if (phll->num_sparse > phll->sparse_capacity - phll->sparse_capacity / 4) {
+				sparse_to_dense(phll);
+				dense_ingest(phll, hash);
+				return;
+			}
+		}
+	}
+	phll->sparse_hashes[phll->num_sparse++] = hash;
+}
+
+void hll_ingest_string(hll_t* phll, char* value) {
+	hll_ingest_hash(phll, mlr_seeded_string_hash_func(value, 0LL));
+}
+
+// ----------------------------------------------------------------
+void hll_merge(hll_t* pdst, hll_t* psrc) {
+	if (pdst->precision != psrc->precision) {
+		fprintf(stderr, "%s: internal coding error: HyperLogLog precisions %d and %d differ.\n",
+			MLR_GLOBALS.bargv0, pdst->precision, psrc->precision);
+		exit(1);
+	}
+	if (psrc->registers == NULL) {
+		for (int i = 0; i < psrc->num_sparse; i++)
+			hll_ingest_hash(pdst, psrc->sparse_hashes[i]);
+	} else {
+		if (pdst->registers == NULL)
+			sparse_to_dense(pdst);
+		for (int i = 0; i < pdst->num_registers; i++)
+			if (psrc->registers[i] > pdst->registers[i])
+				pdst->registers[i] = psrc->registers[i];
+	}
+}
+
+// ----------------------------------------------------------------
+// Helper functions for Ertl's estimator; see section 4 of the paper.
+static double ertl_sigma(double x) {
+	if (x == 1.0)
+		return INFINITY;
+	double y = 1.0;
+	double z = x;
+	double prev;
+	do {
+		x *= x;
+		prev = z;
+		z += x * y;
+		y += y;
+	} while (z != prev);
+	return z;
+}
+
+static double ertl_tau(double x) {
+	if (x == 0.0 || x == 1.0)
+		return 0.0;
+	double y = 1.0;
+	double z = 1.0 - x;
+	double prev;
+	do {
+		x = sqrt(x);
+		prev = z;
+		y *= 0.5;
+		z -= (1.0 - x) * (1.0 - x) * y;
+	} while (z != prev);
+	return z / 3.0;
+}
+
+unsigned long long hll_count(hll_t* phll) {
+	if (phll->registers == NULL) {
+		sparse_dedupe(phll);
+		return phll->num_sparse;
+	}
+
+	int q = 64 - phll->precision;
+	double m = phll->num_registers;
+	int histogram[64 + 2];
+	memset(histogram, 0, sizeof(histogram));
+	for (int i = 0; i < phll->num_registers; i++)
+		histogram[phll->registers[i]]++;
+	if (histogram[0] == phll->num_registers)
+		return 0LL;
+
+	double z = m * ertl_tau(1.0 - histogram[q+1] / m);
+	for (int k = q; k >= 1; k--)
+		z = 0.5 * (z + histogram[k]);
+	z += m * ertl_sigma(histogram[0] / m);
+	double alpha_infinity = 0.5 / log(2.0);
+	return (unsigned long long)llround(alpha_infinity * m * m / z);
+}
+
+// ----------------------------------------------------------------
+void hll_print(hll_t* phll) {
+	printf("precision=%d sparse=%d num_sparse=%d count=%llu\n",
+		phll->precision, hll_is_sparse(phll), phll->num_sparse, hll_count(phll));
+}
@@ -1,6 +1,6 @@
 // ================================================================
-// Array-only (open addressing) string-valued hash set with linear probing for
-// collisions.
+// Array-only (open addressing) string-valued hash set. Keys are stored densely,
+// with their hashes, over a Swiss-table-style index: see hash_index.h.
 //
 // Notes:
 // * null key is not supported.
@@ -13,19 +13,21 @@
 #ifndef HSS_H
 #define HSS_H
 
+#include "containers/hash_index.h"
+
 // ----------------------------------------------------------------
+// Keys are in insertion order along the pnext links.
 typedef struct _hsse_t {
+	HASH_ENTRY_FIELDS(_hsse_t);
 	char* key;
-	int   state;
-	int   ideal_index;
 } hsse_t;
 
 // ----------------------------------------------------------------
 typedef struct _hss_t {
-	int num_occupied;
-	int num_freed;
-	int array_length;
-	hsse_t* array;
+	union {
+		hash_table_t table;
+		struct { HASH_TABLE_FIELDS(hsse_t); };
+	};
 } hss_t;
 
 // ----------------------------------------------------------------
@@ -36,6 +38,9 @@ int    hss_has(hss_t* pset, char* key);
 void   hss_remove(hss_t* pset, char* key);
 void   hss_clear(hss_t* pset);
 int    hss_size(hss_t* pset);
+// As with hss_add, keys are not copied.
+hss_t* hss_copy(hss_t* pset);
+void   hss_add_all(hss_t* pdst, hss_t* psrc);
 
 // Unit-test hook
 int hss_check_counts(hss_t* pset);
@@ -1,6 +1,7 @@
 // ================================================================
-// Array-only (open addressing) string-pair-to-void-star linked hash map with
-// linear probing for collisions.
+// Array-only (open addressing) string-pair-to-void-star linked hash map.
+// Entries are stored densely in insertion order, with their hashes, over a
+// Swiss-table-style index: see hash_index.h.
 //
 // John Kerl 2014-12-22
 //
@@ -17,29 +18,23 @@
 #define LHMS2V_H
 
 #include "lib/free_flags.h"
+#include "containers/hash_index.h"
 
 // ----------------------------------------------------------------
 typedef struct _lhms2ve_t {
-	int   ideal_index;
+	HASH_ENTRY_FIELDS(_lhms2ve_t);
 	char* key1;
 	char* key2;
 	void* pvvalue;
 	char  free_flags;
-	struct _lhms2ve_t *pprev;
-	struct _lhms2ve_t *pnext;
 } lhms2ve_t;
 
-typedef unsigned char lhms2ve_state_t;
-
 // ----------------------------------------------------------------
 typedef struct _lhms2v_t {
-	int              num_occupied;
-	int              num_freed;
-	int              array_length;
-	lhms2ve_t*       entries;
-	lhms2ve_state_t* states;
-	lhms2ve_t*       phead;
-	lhms2ve_t*       ptail;
+	union {
+		hash_table_t table;
+		struct { HASH_TABLE_FIELDS(lhms2ve_t); };
+	};
 } lhms2v_t;
 
 lhms2v_t* lhms2v_alloc();
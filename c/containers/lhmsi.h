@@ -1,6 +1,7 @@
 // ================================================================
-// Array-only (open addressing) string-to-int linked hash map with linear
-// probing for collisions.
+// Array-only (open addressing) string-to-int linked hash map. Entries are
+// stored densely in insertion order, with their hashes, over a Swiss-table-style
+// index: see hash_index.h.
 //
 // John Kerl 2012-08-13
 //
@@ -16,26 +17,21 @@
 #ifndef LHMSI_H
 #define LHMSI_H
 
+#include "containers/hash_index.h"
+
 // ----------------------------------------------------------------
 typedef struct _lhmsie_t {
-	int   ideal_index;
+	HASH_ENTRY_FIELDS(_lhmsie_t);
 	char* key;
 	int value;
 	char  free_flags;
-	struct _lhmsie_t *pprev;
-	struct _lhmsie_t *pnext;
 } lhmsie_t;
 
-typedef unsigned char lhmsie_state_t;
-
 typedef struct _lhmsi_t {
-	int             num_occupied;
-	int             num_freed;
-	int             array_length;
-	lhmsie_t*       entries;
-	lhmsie_state_t* states;
-	lhmsie_t*       phead;
-	lhmsie_t*       ptail;
+	union {
+		hash_table_t table;
+		struct { HASH_TABLE_FIELDS(lhmsie_t); };
+	};
 } lhmsi_t;
 
 // ----------------------------------------------------------------
@@ -1,6 +1,7 @@
 // ================================================================
-// Array-only (open addressing) string-to-string linked hash map with linear
-// probing for collisions.
+// Array-only (open addressing) string-to-string linked hash map. Entries are
+// stored densely in insertion order, with their hashes, over a Swiss-table-style
+// index: see hash_index.h.
 //
 // Keys are not strduped.
 //
@@ -30,46 +31,10 @@
 #define INITIAL_ARRAY_LENGTH 16
 #endif
 
-#ifndef LOAD_FACTOR
-#define LOAD_FACTOR          0.7
-#endif
-
-#ifndef ENLARGEMENT_FACTOR
-#define ENLARGEMENT_FACTOR   2
-#endif
-
 // ----------------------------------------------------------------
-#define OCCUPIED 0xa4
-#define DELETED  0xb8
-#define EMPTY    0xce
-
-// ----------------------------------------------------------------
-static void lhmsll_put_no_enlarge(lhmsll_t* pmap, char* key, int value, char free_flags);
-static void lhmsll_enlarge(lhmsll_t* pmap);
-
-// ================================================================
-static void lhmsll_init(lhmsll_t *pmap, int length) {
-	pmap->num_occupied = 0;
-	pmap->num_freed    = 0;
-	pmap->array_length = length;
-
-	pmap->entries      = (lhmslle_t*)mlr_malloc_or_die(sizeof(lhmslle_t) * length);
-	// Don't do lhmslle_clear() of all entries at init time, since this has a
-	// drastic effect on the time needed to construct an empty map (and miller
-	// constructs an awful lot of those). The attributes there are don't-cares
-	// if the corresponding entry state is EMPTY. They are set on put, and
-	// mutated on remove.
-
-	pmap->states       = (lhmslle_state_t*)mlr_malloc_or_die(sizeof(lhmslle_state_t) * length);
-	memset(pmap->states, EMPTY, length);
-
-	pmap->phead        = NULL;
-	pmap->ptail        = NULL;
-}
-
 lhmsll_t* lhmsll_alloc() {
 	lhmsll_t* pmap = mlr_malloc_or_die(sizeof(lhmsll_t));
-	lhmsll_init(pmap, INITIAL_ARRAY_LENGTH);
+	hash_table_init(&pmap->table, sizeof(lhmslle_t), INITIAL_ARRAY_LENGTH);
 	return pmap;
 }
 
@@ -87,173 +52,66 @@ void lhmsll_free(lhmsll_t* pmap) {
 		if (pe->free_flags & FREE_ENTRY_KEY)
 			free(pe->key);
 	}
-	free(pmap->entries);
-	free(pmap->states);
-	pmap->entries      = NULL;
-	pmap->num_occupied = 0;
-	pmap->num_freed    = 0;
-	pmap->array_length = 0;
+	hash_table_free(&pmap->table);
 	free(pmap);
 }
 
 // ----------------------------------------------------------------
-// Used by get() and remove().
-// Returns >=0 for where the key is *or* should go (end of chain).
-static int lhmsll_find_index_for_key(lhmsll_t* pmap, char* key, int* pideal_index) {
-	int hash = mlr_string_hash_func(key);
-	int index = mlr_canonical_mod(hash, pmap->array_length);
-	*pideal_index = index;
-	int num_tries = 0;
-
-	while (TRUE) {
-		lhmslle_t* pe = &pmap->entries[index];
-		if (pmap->states[index] == OCCUPIED) {
-			char* ekey = pe->key;
-			// Existing key found in chain.
-			if (streq(key, ekey))
-				return index;
-		}
-		else if (pmap->states[index] == EMPTY) {
-			return index;
-		}
-
-		// If the current entry has been deleted, i.e. previously occupied,
-		// the sought index may be further down the chain.  So we must
-		// continue looking.
-		if (++num_tries >= pmap->array_length) {
-			fprintf(stderr,
-				"%s: internal coding error: table full even after enlargement.\n", MLR_GLOBALS.bargv0);
-			exit(1);
-		}
+static int lhmslle_key_matches(void* pentry, void* pvkey) {
+	return streq(((lhmslle_t*)pentry)->key, pvkey);
+}
 
-		// Linear probing.
-		if (++index >= pmap->array_length)
-			index = 0;
-	}
-	MLR_INTERNAL_CODING_ERROR();
-	return -1; // not reached
+static lhmslle_t* lhmsll_find_entry(lhmsll_t* pmap, char* key, unsigned hash) {
+	return hash_table_find(&pmap->table, hash, key, lhmslle_key_matches);
 }
 
 // ----------------------------------------------------------------
 void lhmsll_put(lhmsll_t* pmap, char* key, int value, char free_flags) {
-	if ((pmap->num_occupied + pmap->num_freed) >= (pmap->array_length*LOAD_FACTOR))
-		lhmsll_enlarge(pmap);
-	lhmsll_put_no_enlarge(pmap, key, value, free_flags);
-}
-
-static void lhmsll_put_no_enlarge(lhmsll_t* pmap, char* key, int value, char free_flags) {
-	int ideal_index = 0;
-	int index = lhmsll_find_index_for_key(pmap, key, &ideal_index);
-	lhmslle_t* pe = &pmap->entries[index];
-
-	if (pmap->states[index] == OCCUPIED) {
-		// Existing key found in chain; put value.
-		pe->value = value;
+	unsigned hash = mlr_string_hash_func(key);
+	lhmslle_t* pe = lhmsll_find_entry(pmap, key, hash);
 
-	} else if (pmap->states[index] == EMPTY) {
-		// End of chain.
-		pe->ideal_index = ideal_index;
-		pe->key = key;
+	if (pe != NULL) {
+		// Existing key found; put value.
 		pe->value = value;
-		pe->free_flags = free_flags;
-		pmap->states[index] = OCCUPIED;
-
-		if (pmap->phead == NULL) {
-			pe->pprev   = NULL;
-			pe->pnext   = NULL;
-			pmap->phead = pe;
-			pmap->ptail = pe;
-		} else {
-			pe->pprev   = pmap->ptail;
-			pe->pnext   = NULL;
-			pmap->ptail->pnext = pe;
-			pmap->ptail = pe;
-		}
-		pmap->num_occupied++;
-
-	} else {
-		fprintf(stderr, "%s: lhmsll_find_index_for_key did not find end of chain.\n", MLR_GLOBALS.bargv0);
-		exit(1);
+		return;
 	}
+
+	pe = hash_table_append(&pmap->table, hash);
+	pe->key = key;
+	pe->value = value;
+	pe->free_flags = free_flags;
 }
 
 // ----------------------------------------------------------------
 long long lhmsll_get(lhmsll_t* pmap, char* key) {
-	int ideal_index = 0;
-	int index = lhmsll_find_index_for_key(pmap, key, &ideal_index);
-	lhmslle_t* pe = &pmap->entries[index];
-
-	if (pmap->states[index] == OCCUPIED)
-		return pe->value;
-	else if (pmap->states[index] == EMPTY)
-		return -999; // caller must do lhmsll_has_key to check validity
-	else {
-		fprintf(stderr, "%s: lhmsll_find_index_for_key did not find end of chain.\n", MLR_GLOBALS.bargv0);
-		exit(1);
-	}
+	lhmslle_t* pe = lhmsll_find_entry(pmap, key, mlr_string_hash_func(key));
+	return (pe == NULL) ? -999 : pe->value; // caller must do lhmsll_has_key to check validity
 }
 
 // ----------------------------------------------------------------
 int lhmsll_test_and_get(lhmsll_t* pmap, char* key, long long* pval) {
-	int ideal_index = 0;
-	int index = lhmsll_find_index_for_key(pmap, key, &ideal_index);
-	lhmslle_t* pe = &pmap->entries[index];
-
-	if (pmap->states[index] == OCCUPIED) {
-		*pval = pe->value;
-		return TRUE;
-	} else if (pmap->states[index] == EMPTY) {
+	lhmslle_t* pe = lhmsll_find_entry(pmap, key, mlr_string_hash_func(key));
+	if (pe == NULL)
 		return FALSE;
-	} else {
-		fprintf(stderr, "%s: lhmsll_find_index_for_key did not find end of chain.\n", MLR_GLOBALS.bargv0);
-		exit(1);
-	}
+	*pval = pe->value;
+	return TRUE;
 }
 
 int lhmsll_test_and_increment(lhmsll_t* pmap, char* key) {
-	int ideal_index = 0;
-	int index = lhmsll_find_index_for_key(pmap, key, &ideal_index);
-	lhmslle_t* pe = &pmap->entries[index];
-
-	if (pmap->states[index] == OCCUPIED) {
-		pe->value++;
-		return TRUE;
-	} else if (pmap->states[index] == EMPTY) {
+	lhmslle_t* pe = lhmsll_find_entry(pmap, key, mlr_string_hash_func(key));
+	if (pe == NULL)
 		return FALSE;
-	} else {
-		fprintf(stderr, "%s: lhmsll_find_index_for_key did not find end of chain.\n", MLR_GLOBALS.bargv0);
-		exit(1);
-	}
+	pe->value++;
+	return TRUE;
 }
 
 lhmslle_t* lhmsll_get_entry(lhmsll_t* pmap, char* key) {
-	int ideal_index = 0;
-	int index = lhmsll_find_index_for_key(pmap, key, &ideal_index);
-	lhmslle_t* pe = &pmap->entries[index];
-
-	if (pmap->states[index] == OCCUPIED)
-		return pe;
-	else if (pmap->states[index] == EMPTY)
-		return NULL;
-	else {
-		fprintf(stderr, "%s: lhmsll_find_index_for_key did not find end of chain.\n", MLR_GLOBALS.bargv0);
-		exit(1);
-	}
+	return lhmsll_find_entry(pmap, key, mlr_string_hash_func(key));
 }
 
 // ----------------------------------------------------------------
 int lhmsll_has_key(lhmsll_t* pmap, char* key) {
-	int ideal_index = 0;
-	int index = lhmsll_find_index_for_key(pmap, key, &ideal_index);
-
-	if (pmap->states[index] == OCCUPIED)
-		return TRUE;
-	else if (pmap->states[index] == EMPTY)
-		return FALSE;
-	else {
-		fprintf(stderr, "%s: lhmsll_find_index_for_key did not find end of chain.\n", MLR_GLOBALS.bargv0);
-		exit(1);
-	}
+	return lhmsll_find_entry(pmap, key, mlr_string_hash_func(key)) != NULL;
 }
 
 // ----------------------------------------------------------------
@@ -262,69 +120,13 @@ void  lhmsll_rename(lhmsll_t* pmap, char* old_key, char* new_key) {
 	exit(1);
 }
 
-// ----------------------------------------------------------------
-static void lhmsll_enlarge(lhmsll_t* pmap) {
-	lhmslle_t*       old_entries = pmap->entries;
-	lhmslle_state_t* old_states  = pmap->states;
-	lhmslle_t*       old_head    = pmap->phead;
-
-	lhmsll_init(pmap, pmap->array_length*ENLARGEMENT_FACTOR);
-
-	for (lhmslle_t* pe = old_head; pe != NULL; pe = pe->pnext) {
-		lhmsll_put_no_enlarge(pmap, pe->key, pe->value, pe->free_flags);
-	}
-	free(old_entries);
-	free(old_states);
-}
-
 // ----------------------------------------------------------------
 int lhmsll_check_counts(lhmsll_t* pmap) {
-	int nocc = 0;
-	int ndel = 0;
-	for (int index = 0; index < pmap->array_length; index++) {
-		if (pmap->states[index] == OCCUPIED)
-			nocc++;
-		else if (pmap->states[index] == DELETED)
-			ndel++;
-	}
-	if (nocc != pmap->num_occupied) {
-		fprintf(stderr,
-			"occupancy-count mismatch:  actual %d != cached  %d.\n",
-				nocc, pmap->num_occupied);
-		return FALSE;
-	}
-	if (ndel != pmap->num_freed) {
-		fprintf(stderr,
-			"deleted-count mismatch:  actual %d != cached  %d.\n",
-				ndel, pmap->num_freed);
-		return FALSE;
-	}
-	return TRUE;
+	return hash_table_check_counts(&pmap->table);
 }
 
 // ----------------------------------------------------------------
-static char* get_state_name(int state) {
-	switch(state) {
-	case OCCUPIED: return "occupied"; break;
-	case DELETED:  return "deleted";  break;
-	case EMPTY:    return "empty";    break;
-	default:       return "?????";    break;
-	}
-}
-
 void lhmsll_print(lhmsll_t* pmap) {
-	for (int index = 0; index < pmap->array_length; index++) {
-		lhmslle_t* pe = &pmap->entries[index];
-
-		const char* key_string = (pe == NULL) ? "none" :
-			pe->key == NULL ? "null" :
-			pe->key;
-
-		printf(
-		"| stt: %-8s  | idx: %6d | nidx: %6d | key: %12s | value: %8lld |\n",
-			get_state_name(pmap->states[index]), index, pe->ideal_index, key_string, pe->value);
-	}
-	printf("+\n");
 	printf("| phead: %p | ptail %p\n", pmap->phead, pmap->ptail);
 	printf("+\n");
 	for (lhmslle_t* pe = pmap->phead; pe != NULL; pe = pe->pnext) {
@@ -332,8 +134,8 @@ void lhmsll_print(lhmsll_t* pmap) {
 			pe->key == NULL ? "null" :
 			pe->key;
 		printf(
-		"| prev: %p curr: %p next: %p | nidx: %6d | key: %12s | value: %8lld |\n",
+		"| prev: %p curr: %p next: %p | hash: %08x | key: %12s | value: %8lld |\n",
 			pe->pprev, pe, pe->pnext,
-			pe->ideal_index, key_string, pe->value);
+			pe->hash, key_string, pe->value);
 	}
 }
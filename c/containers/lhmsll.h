@@ -1,6 +1,7 @@
 // ================================================================
-// Array-only (open addressing) string-to-int linked hash map with linear
-// probing for collisions.
+// Array-only (open addressing) string-to-int linked hash map. Entries are
+// stored densely in insertion order, with their hashes, over a Swiss-table-style
+// index: see hash_index.h.
 //
 // John Kerl 2012-08-13
 //
@@ -16,26 +17,21 @@
 #ifndef LHMSLL_H
 #define LHMSLL_H
 
+#include "containers/hash_index.h"
+
 // ----------------------------------------------------------------
 typedef struct _lhmslle_t {
-	int   ideal_index;
+	HASH_ENTRY_FIELDS(_lhmslle_t);
 	char* key;
 	long long value;
 	char  free_flags;
-	struct _lhmslle_t *pprev;
-	struct _lhmslle_t *pnext;
 } lhmslle_t;
 
-typedef unsigned char lhmslle_state_t;
-
 typedef struct _lhmsll_t {
-	int              num_occupied;
-	int              num_freed;
-	int              array_length;
-	lhmslle_t*       entries;
-	lhmslle_state_t* states;
-	lhmslle_t*       phead;
-	lhmslle_t*       ptail;
+	union {
+		hash_table_t table;
+		struct { HASH_TABLE_FIELDS(lhmslle_t); };
+	};
 } lhmsll_t;
 
 // ----------------------------------------------------------------
@@ -1,6 +1,7 @@
 // ================================================================
-// Array-only (open addressing) string-list-to-void-star linked hash map with
-// linear probing for collisions.
+// Array-only (open addressing) string-list-to-void-star linked hash map.
+// Entries are stored densely in insertion order, with their hashes, over a
+// Swiss-table-style index: see hash_index.h.
 //
 // John Kerl 2014-12-22
 //
@@ -17,28 +18,23 @@
 #define LHMSLV_H
 
 #include "containers/slls.h"
+#include "containers/hash_index.h"
+#include "lib/string_array.h"
 
 // ----------------------------------------------------------------
 typedef struct _lhmslve_t {
-	int     ideal_index;
+	HASH_ENTRY_FIELDS(_lhmslve_t);
 	slls_t* key;
 	void*   pvvalue;
 	char    free_flags;
-	struct _lhmslve_t *pprev;
-	struct _lhmslve_t *pnext;
 } lhmslve_t;
 
-typedef unsigned char lhmslve_state_t;
-
 // ----------------------------------------------------------------
 typedef struct _lhmslv_t {
-	int              num_occupied;
-	int              num_freed;
-	int              array_length;
-	lhmslve_t*       entries;
-	lhmslve_state_t* states;
-	lhmslve_t*       phead;
-	lhmslve_t*       ptail;
+	union {
+		hash_table_t table;
+		struct { HASH_TABLE_FIELDS(lhmslve_t); };
+	};
 } lhmslv_t;
 
 lhmslv_t* lhmslv_alloc();
@@ -48,6 +44,14 @@ void*  lhmslv_get(lhmslv_t* pmap, slls_t* key);
 int    lhmslv_has_key(lhmslv_t* pmap, slls_t* key);
 int    lhmslv_size(lhmslv_t* pmap);
 
+// Lookups keyed by an array of strings, e.g. from
+// mlr_reference_selected_values_from_record_into_array, compared in place
+// against the stored lists: finding an existing group allocates nothing.
+// The put copies the array into a new list, which the map owns, and returns
+// that list.
+void*   lhmslv_get_from_string_array(lhmslv_t* pmap, string_array_t* pvalues);
+slls_t* lhmslv_put_copy_of_string_array(lhmslv_t* pmap, string_array_t* pvalues, void* pvvalue);
+
 // Unit-test hook
 int lhmslv_check_counts(lhmslv_t* pmap);
 
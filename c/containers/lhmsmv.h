@@ -1,6 +1,7 @@
 // ================================================================
-// Array-only (open addressing) string-to-mlrval linked hash map with linear
-// probing for collisions.
+// Array-only (open addressing) string-to-mlrval linked hash map. Entries are
+// stored densely in insertion order, with their hashes, over a Swiss-table-style
+// index: see hash_index.h.
 //
 // John Kerl 2012-08-13
 //
@@ -17,28 +18,22 @@
 #define LHMSMV_H
 
 #include "containers/sllv.h"
+#include "containers/hash_index.h"
 #include "lib/mlrval.h"
 
 // ----------------------------------------------------------------
 typedef struct _lhmsmve_t {
-	int   ideal_index;
+	HASH_ENTRY_FIELDS(_lhmsmve_t);
 	char  free_flags;
 	char* key;
 	mv_t  value;
-	struct _lhmsmve_t *pprev;
-	struct _lhmsmve_t *pnext;
 } lhmsmve_t;
 
-typedef unsigned char lhmsmve_state_t;
-
 typedef struct _lhmsmv_t {
-	int              num_occupied;
-	int              num_freed;
-	int              array_length;
-	lhmsmve_t*       entries;
-	lhmsmve_state_t* states;
-	lhmsmve_t*       phead;
-	lhmsmve_t*       ptail;
+	union {
+		hash_table_t table;
+		struct { HASH_TABLE_FIELDS(lhmsmve_t); };
+	};
 } lhmsmv_t;
 
 // ----------------------------------------------------------------
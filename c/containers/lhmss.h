@@ -1,6 +1,7 @@
 // ================================================================
-// Array-only (open addressing) string-to-string linked hash map with linear
-// probing for collisions.
+// Array-only (open addressing) string-to-string linked hash map. Entries are
+// stored densely in insertion order, with their hashes, over a Swiss-table-style
+// index: see hash_index.h.
 //
 // John Kerl 2012-08-13
 //
@@ -17,27 +18,21 @@
 #define LHMSS_H
 
 #include "containers/sllv.h"
+#include "containers/hash_index.h"
 
 // ----------------------------------------------------------------
 typedef struct _lhmsse_t {
-	int   ideal_index;
+	HASH_ENTRY_FIELDS(_lhmsse_t);
 	char  free_flags;
 	char* key;
 	char* value;
-	struct _lhmsse_t *pprev;
-	struct _lhmsse_t *pnext;
 } lhmsse_t;
 
-typedef unsigned char lhmsse_state_t;
-
 typedef struct _lhmss_t {
-	int             num_occupied;
-	int             num_freed;
-	int             array_length;
-	lhmsse_t*       entries;
-	lhmsse_state_t* states;
-	lhmsse_t*       phead;
-	lhmsse_t*       ptail;
+	union {
+		hash_table_t table;
+		struct { HASH_TABLE_FIELDS(lhmsse_t); };
+	};
 } lhmss_t;
 
 // ----------------------------------------------------------------
@@ -1,6 +1,7 @@
 // ================================================================
-// Array-only (open addressing) string-to-void linked hash map with linear
-// probing for collisions.
+// Array-only (open addressing) string-to-void linked hash map. Entries are
+// stored densely in insertion order, with their hashes, over a Swiss-table-style
+// index: see hash_index.h.
 //
 // John Kerl 2012-08-13
 //
@@ -17,28 +18,22 @@
 #define LHMSV_H
 
 #include "containers/sllv.h"
+#include "containers/hash_index.h"
 #include "lib/free_flags.h"
 
 // ----------------------------------------------------------------
 typedef struct _lhmsve_t {
-	int   ideal_index;
+	HASH_ENTRY_FIELDS(_lhmsve_t);
 	char* key;
 	void* pvvalue;
 	char  free_flags;
-	struct _lhmsve_t *pprev;
-	struct _lhmsve_t *pnext;
 } lhmsve_t;
 
-typedef unsigned char lhmsve_state_t;
-
 typedef struct _lhmsv_t {
-	int             num_occupied;
-	int             num_freed;
-	int             array_length;
-	lhmsve_t*       entries;
-	lhmsve_state_t* states;
-	lhmsve_t*       phead;
-	lhmsve_t*       ptail;
+	union {
+		hash_table_t table;
+		struct { HASH_TABLE_FIELDS(lhmsve_t); };
+	};
 } lhmsv_t;
 
 // ----------------------------------------------------------------
@@ -90,6 +90,22 @@ void mlr_reference_values_from_record_into_string_array(lrec_t* prec, string_arr
 	}
 }
 
+// ----------------------------------------------------------------
+int mlr_reference_selected_values_from_record_into_array(lrec_t* prec, slls_t* pselected_field_names,
+	string_array_t* pvalues)
+{
+	MLR_INTERNAL_CODING_ERROR_IF(pselected_field_names->length != pvalues->length);
+	pvalues->strings_need_freeing = FALSE;
+	int i = 0;
+	for (sllse_t* pe = pselected_field_names->phead; pe != NULL; pe = pe->pnext, i++) {
+		char* value = lrec_get(prec, pe->value);
+		if (value == NULL)
+			return FALSE;
+		pvalues->strings[i] = value;
+	}
+	return TRUE;
+}
+
 int record_has_all_keys(lrec_t* prec, slls_t* pselected_field_names) {
 	for (sllse_t* pe = pselected_field_names->phead; pe != NULL; pe = pe->pnext) {
 		char* selected_field_name = pe->value;
@@ -32,6 +32,13 @@ void mlr_reference_values_from_record_into_string_array(lrec_t* prec, string_arr
 	string_array_t* pvalues);
 int record_has_all_keys(lrec_t* prec, slls_t* pselected_field_names);
 
+// Same as mlr_reference_selected_values_from_record but fills in a caller-owned
+// array, of the same length as the name list, so that group-by verbs can reuse
+// one array for all records. Returns FALSE, with the array contents undefined,
+// if any of the selected fields is absent.
+int mlr_reference_selected_values_from_record_into_array(lrec_t* prec, slls_t* pselected_field_names,
+	string_array_t* pvalues);
+
 lhmss_t* mlr_reference_key_value_pairs_from_regex_names(lrec_t* prec, regex_t* pregexes, int num_regexes,
 	int invert_matches);
 
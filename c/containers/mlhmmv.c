@@ -1,6 +1,6 @@
 // ================================================================
-// Array-only (open addressing) multi-level hash map, with linear probing for collisions.
-// All keys, and terminal-level values, are mlrvals.
+// Multi-level hash map. All keys, and terminal-level values, are mlrvals.
+// See mlhmmv.h for the layout of the levels.
 //
 // Notes:
 // * null key is not supported.
@@ -13,6 +13,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 
 #include "lib/mlr_globals.h"
@@ -21,45 +22,22 @@
 #include "lib/mvfuncs.h"
 
 // ================================================================
-// Allow compile-time override, e.g using gcc -D.
-
-#ifndef LOAD_FACTOR
-#define LOAD_FACTOR          0.7
-#endif
-
-#ifndef ENLARGEMENT_FACTOR
-#define ENLARGEMENT_FACTOR   2
-#endif
-
-#define OCCUPIED             0xa4
-#define DELETED              0xb8
-#define EMPTY                0xce
-
-// ================================================================
-static int  mlhmmv_hash_func(mv_t* plevel_key);
 static void json_decimal_print       (FILE* ostream, char* s);
 static void json_print_string_escaped(FILE* ostream, char* s);
 
 // ----------------------------------------------------------------
-static void mlhmmv_level_init(mlhmmv_level_t  *plevel, int length);
-
-// ----------------------------------------------------------------
-static int mlhmmv_level_find_index_for_key(mlhmmv_level_t* plevel, mv_t* plevel_key, int* pideal_index);
+static int                   mlhmmv_level_find(mlhmmv_level_t* plevel, mv_t* plevel_key);
+static mlhmmv_level_entry_t* mlhmmv_level_append(mlhmmv_level_t* plevel, mv_t* plevel_key);
+static void                  mlhmmv_level_grow(mlhmmv_level_t* plevel);
+static void                  mlhmmv_level_free_entries(mlhmmv_level_t* plevel);
 
 static mlhmmv_level_entry_t* mlhmmv_level_look_up_and_ref_entry(
 	mlhmmv_level_t* plevel, sllmve_t* prestkeys, int* perror);
 
-static mlhmmv_level_entry_t* mlhmmv_level_get_next_level_entry(mlhmmv_level_t* plevel, mv_t* plevel_key, int* pindex);
+static mlhmmv_level_entry_t* mlhmmv_level_get_next_level_entry(mlhmmv_level_t* plevel, mv_t* plevel_key);
 static mlhmmv_xvalue_t*      mlhmmv_level_get_next_level_xvalue(mlhmmv_level_t* plevel, mv_t* plevel_key);
 
 static mlhmmv_level_t* mlhmmv_level_ref_or_create(mlhmmv_level_t* plevel, sllmve_t* prest_keys);
-static mlhmmv_level_t* mlhmmv_level_get_or_create_no_enlarge(mlhmmv_level_t* plevel, sllmve_t* prest_keys);
-
-static void mlhmmv_level_enlarge(mlhmmv_level_t* plevel);
-static void mlhmmv_level_move(mlhmmv_level_t* plevel, mv_t* plevel_key, mlhmmv_xvalue_t* plevel_value);
-
-static void mlhmmv_level_put_xvalue_no_enlarge(mlhmmv_level_t* plevel, sllmve_t* prest_keys, mlhmmv_xvalue_t* pvalue);
-static void mlhmmv_level_put_terminal_no_enlarge(mlhmmv_level_t* plevel, sllmve_t* prest_keys, mv_t* pterminal_value);
 
 static void mlhmmv_level_to_lrecs_across_records(
 	mlhmmv_level_t* plevel,
@@ -102,32 +80,140 @@ static void mlhmmv_level_print_single_line(mlhmmv_level_t* plevel, int depth,
 static void mlhmmv_root_put_xvalue(mlhmmv_root_t* pmap, sllmv_t* pmvkeys, mlhmmv_xvalue_t* pvalue);
 
 // ================================================================
-typedef int mlhmmv_typed_hash_func(mv_t* pa);
-static int mlhmmv_string_hash_func(mv_t* pa) {
-	return mlr_string_hash_func(pa->u.strv);
-}
-static int mlhmmv_int_hash_func(mv_t* pa) {
-	return pa->u.intv;
-}
-static int mlhmmv_other_hash_func(mv_t* pa) {
-	fprintf(stderr, "%s: map keys must be of type %s or %s; got %s.\n",
-		MLR_GLOBALS.bargv0,
-		mt_describe_type(MT_STRING),
-		mt_describe_type(MT_INT),
-		mt_describe_type(pa->type));
-	exit(1);
-}
-static mlhmmv_typed_hash_func* mlhmmv_hash_func_dispositions[MT_DIM] = {
-	/*ERROR*/  mlhmmv_other_hash_func,
-	/*ABSENT*/ mlhmmv_other_hash_func,
-	/*EMPTY*/  mlhmmv_other_hash_func,
-	/*STRING*/ mlhmmv_string_hash_func,
-	/*INT*/    mlhmmv_int_hash_func,
-	/*FLOAT*/  mlhmmv_other_hash_func,
-	/*BOOL*/   mlhmmv_other_hash_func,
-};
-static int mlhmmv_hash_func(mv_t* pa) {
-	return mlhmmv_hash_func_dispositions[pa->type](pa);
+// Interned string keys. Level keys of type MT_STRING point at the str member
+// here, with no free flags; the rest of the header is found from there.
+// Positions in the intern table are stable, so the intern index can be
+// rebuilt without rehashing.
+
+typedef struct _mlhmmv_interned_key_t {
+	int      refcount;
+	unsigned hash;
+	int      position; // In the intern table
+	char     str[];
+} mlhmmv_interned_key_t;
+
+#define INTERN_TABLE_INITIAL_CAPACITY 64
+
+static mlhmmv_interned_key_t** intern_keys           = NULL; // NULL at free positions
+static int*                    intern_free_positions = NULL;
+static int                     intern_num_used       = 0;    // High-water mark
+static int                     intern_num_free       = 0;
+static int                     intern_capacity       = 0;
+static hash_index_t            intern_index          = { .positions = NULL };
+
+static inline mlhmmv_interned_key_t* mlhmmv_interned_key_of(char* str) {
+	return (mlhmmv_interned_key_t*)(str - offsetof(mlhmmv_interned_key_t, str));
+}
+
+static void mlhmmv_intern_reindex() {
+	int num_live = intern_num_used - intern_num_free;
+	int capacity = HASH_INDEX_GROUP_SIZE;
+	while (hash_index_max_load(capacity) <= 2 * num_live)
+		capacity *= 2;
+	if (intern_index.positions != NULL)
+		hash_index_free(&intern_index);
+	hash_index_init(&intern_index, capacity);
+	for (int i = 0; i < intern_num_used; i++)
+		if (intern_keys[i] != NULL)
+			hash_index_insert(&intern_index, intern_keys[i]->hash, i);
+}
+
+static char* mlhmmv_intern(char* str, unsigned hash) {
+	if (intern_index.positions != NULL) {
+		hash_index_probe_t probe;
+		hash_index_probe_start(&intern_index, hash, &probe);
+		for (int pos = hash_index_probe_next(&intern_index, &probe); pos >= 0;
+			pos = hash_index_probe_next(&intern_index, &probe))
+		{
+			mlhmmv_interned_key_t* pkey = intern_keys[pos];
+			if (pkey->hash == hash && streq(pkey->str, str)) {
+				pkey->refcount++;
+				return pkey->str;
+			}
+		}
+	}
+
+	int position;
+	if (intern_num_free > 0) {
+		position = intern_free_positions[--intern_num_free];
+	} else {
+		if (intern_num_used >= intern_capacity) {
+			intern_capacity = (intern_capacity == 0) ? INTERN_TABLE_INITIAL_CAPACITY : 2 * intern_capacity;
+			intern_keys = mlr_realloc_or_die(intern_keys, intern_capacity * sizeof(mlhmmv_interned_key_t*));
+			intern_free_positions = mlr_realloc_or_die(intern_free_positions, intern_capacity * sizeof(int));
+		}
+		position = intern_num_used++;
+	}
+
+	int len = strlen(str);
+	mlhmmv_interned_key_t* pkey = mlr_malloc_or_die(sizeof(mlhmmv_interned_key_t) + len + 1);
+	pkey->refcount = 1;
+	pkey->hash     = hash;
+	pkey->position = position;
+	memcpy(pkey->str, str, len + 1);
+	intern_keys[position] = pkey;
+
+	if (intern_index.positions == NULL || hash_index_is_full(&intern_index))
+		mlhmmv_intern_reindex();
+	else
+		hash_index_insert(&intern_index, hash, position);
+	return pkey->str;
+}
+
+static void mlhmmv_unintern(char* str) {
+	mlhmmv_interned_key_t* pkey = mlhmmv_interned_key_of(str);
+	if (--pkey->refcount > 0)
+		return;
+	hash_index_remove(&intern_index, pkey->hash, pkey->position);
+	intern_keys[pkey->position] = NULL;
+	intern_free_positions[intern_num_free++] = pkey->position;
+	free(pkey);
+}
+
+// ================================================================
+static void mlhmmv_check_key_type(mv_t* pkey) {
+	if (pkey->type != MT_STRING && pkey->type != MT_INT) {
+		fprintf(stderr, "%s: map keys must be of type %s or %s; got %s.\n",
+			MLR_GLOBALS.bargv0,
+			mt_describe_type(MT_STRING),
+			mt_describe_type(MT_INT),
+			mt_describe_type(pkey->type));
+		exit(1);
+	}
+}
+
+// Fibonacci hashing: the identity would put runs of consecutive integer keys
+// all in one hash-index group.
+static inline unsigned mlhmmv_int_hash(long long i) {
+	return (unsigned)(((unsigned long long)i * 0x9e3779b97f4a7c15ULL) >> 32);
+}
+
+static inline unsigned mlhmmv_key_hash(mv_t* pkey) {
+	return (pkey->type == MT_STRING)
+		? (unsigned)mlr_string_hash_func(pkey->u.strv)
+		: mlhmmv_int_hash(pkey->u.intv);
+}
+
+// For keys stored in a level, string hashes are kept in the intern table.
+static inline unsigned mlhmmv_stored_key_hash(mv_t* pkey) {
+	return (pkey->type == MT_STRING)
+		? mlhmmv_interned_key_of(pkey->u.strv)->hash
+		: mlhmmv_int_hash(pkey->u.intv);
+}
+
+// Marks the entry holding the key as removed.
+static void mlhmmv_stored_key_release(mv_t* pkey) {
+	if (pkey->type == MT_STRING)
+		mlhmmv_unintern(pkey->u.strv);
+	*pkey = mv_absent();
+}
+
+static inline int mlhmmv_key_matches(mv_t* pstored_key, mv_t* pkey) {
+	if (pstored_key->type != pkey->type)
+		return FALSE;
+	if (pkey->type == MT_INT)
+		return pstored_key->u.intv == pkey->u.intv;
+	return pstored_key->u.strv == pkey->u.strv || streq(pstored_key->u.strv, pkey->u.strv);
 }
 
 // ================================================================
@@ -234,14 +320,12 @@ mlhmmv_xvalue_t mlhmmv_xvalue_copy(mlhmmv_xvalue_t* pvalue) {
 
 	} else {
 		mlhmmv_level_t* psrc_level = pvalue->pnext_level;
-		mlhmmv_level_t* pdst_level = mlr_malloc_or_die(sizeof(mlhmmv_level_t));
-
-		mlhmmv_level_init(pdst_level, MLHMMV_INITIAL_ARRAY_LENGTH);
+		mlhmmv_level_t* pdst_level = mlhmmv_level_alloc();
 
 		for (
-			mlhmmv_level_entry_t* psubentry = psrc_level->phead;
+			mlhmmv_level_entry_t* psubentry = mlhmmv_level_first(psrc_level);
 			psubentry != NULL;
-			psubentry = psubentry->pnext)
+			psubentry = mlhmmv_level_next(psrc_level, psubentry))
 		{
 			mlhmmv_xvalue_t next_value = mlhmmv_xvalue_copy(&psubentry->level_xvalue);
 			mlhmmv_level_put_xvalue_singly_keyed(pdst_level, &psubentry->level_key, &next_value);
@@ -296,7 +380,7 @@ sllv_t* mlhmmv_xvalue_copy_keys_nonindexed(mlhmmv_xvalue_t* pvalue) {
 
 	if (!pvalue->is_terminal) {
 		mlhmmv_level_t* pnext_level = pvalue->pnext_level;
-		for (mlhmmv_level_entry_t* pe = pnext_level->phead; pe != NULL; pe = pe->pnext) {
+		for (mlhmmv_level_entry_t* pe = mlhmmv_level_first(pnext_level); pe != NULL; pe = mlhmmv_level_next(pnext_level, pe)) {
 			mv_t* p = mv_alloc_copy(&pe->level_key);
 			sllv_append(pkeys, p);
 		}
@@ -360,120 +444,153 @@ void mlhmmv_xvalues_to_lrecs_lashed(mlhmmv_xvalue_t** ptop_values, int num_subma
 
 // ================================================================
 mlhmmv_level_t* mlhmmv_level_alloc() {
+	// The entry array is allocated on first put, since miller constructs an
+	// awful lot of empty maps.
 	mlhmmv_level_t* plevel = mlr_malloc_or_die(sizeof(mlhmmv_level_t));
-	mlhmmv_level_init(plevel, MLHMMV_INITIAL_ARRAY_LENGTH);
-	return plevel;
-}
-
-// ----------------------------------------------------------------
-static void mlhmmv_level_init(mlhmmv_level_t *plevel, int length) {
 	plevel->num_occupied = 0;
-	plevel->num_freed    = 0;
-	plevel->array_length = length;
-
-	plevel->entries      = (mlhmmv_level_entry_t*)mlr_malloc_or_die(sizeof(mlhmmv_level_entry_t) * length);
-	// Don't do mlhmmv_level_entry_clear() of all entries at init time, since this has a
-	// drastic effect on the time needed to construct an empty map (and miller
-	// constructs an awful lot of those). The attributes there are don't-cares
-	// if the corresponding entry state is EMPTY. They are set on put, and
-	// mutated on remove.
-
-	plevel->states       = (mlhmmv_level_entry_state_t*)mlr_malloc_or_die(sizeof(mlhmmv_level_entry_state_t) * length);
-	memset(plevel->states, EMPTY, length);
-
-	plevel->phead        = NULL;
-	plevel->ptail        = NULL;
+	plevel->num_used     = 0;
+	plevel->capacity     = 0;
+	plevel->entries      = NULL;
+	plevel->pindex       = NULL;
+	return plevel;
 }
 
 // ----------------------------------------------------------------
-void mlhmmv_level_free(mlhmmv_level_t* plevel) {
-	for (mlhmmv_level_entry_t* pentry = plevel->phead; pentry != NULL; pentry = pentry->pnext) {
-		mv_free(&pentry->level_key);
+static void mlhmmv_level_free_entries(mlhmmv_level_t* plevel) {
+	for (mlhmmv_level_entry_t* pentry = mlhmmv_level_first(plevel); pentry != NULL;
+		pentry = mlhmmv_level_next(plevel, pentry))
+	{
+		mlhmmv_stored_key_release(&pentry->level_key);
 		if (pentry->level_xvalue.is_terminal) {
 			mv_free(&pentry->level_xvalue.terminal_mlrval);
 		} else {
 			mlhmmv_level_free(pentry->level_xvalue.pnext_level);
 		}
 	}
+}
+
+void mlhmmv_level_free(mlhmmv_level_t* plevel) {
+	mlhmmv_level_free_entries(plevel);
 	free(plevel->entries);
-	free(plevel->states);
-	plevel->entries      = NULL;
-	plevel->num_occupied = 0;
-	plevel->num_freed    = 0;
-	plevel->array_length = 0;
+	if (plevel->pindex != NULL) {
+		hash_index_free(plevel->pindex);
+		free(plevel->pindex);
+	}
 	free(plevel);
 }
 
 // ----------------------------------------------------------------
 void mlhmmv_level_clear(mlhmmv_level_t* plevel) {
-	if (plevel->phead == NULL)
+	if (plevel->num_used == 0)
 		return;
 
-	for (mlhmmv_level_entry_t* pentry = plevel->phead; pentry != NULL; pentry = pentry->pnext) {
-		if (pentry->level_xvalue.is_terminal) {
-			mv_free(&pentry->level_xvalue.terminal_mlrval);
-		} else {
-			mlhmmv_level_free(pentry->level_xvalue.pnext_level);
-		}
-		mv_free(&pentry->level_key);
-	}
+	mlhmmv_level_free_entries(plevel);
 	plevel->num_occupied = 0;
-	plevel->num_freed    = 0;
-	plevel->phead        = NULL;
-	plevel->ptail        = NULL;
-
-	memset(plevel->states, EMPTY, plevel->array_length);
+	plevel->num_used     = 0;
+	if (plevel->pindex != NULL)
+		hash_index_clear(plevel->pindex);
 }
 
 // ----------------------------------------------------------------
 int mlhmmv_level_has_key(mlhmmv_level_t* plevel, mv_t* plevel_key) {
-	int ideal_index = 0;
-	int index = mlhmmv_level_find_index_for_key(plevel, plevel_key, &ideal_index);
-	if (plevel->states[index] == OCCUPIED)
-		return TRUE;
-	else if (plevel->states[index] == EMPTY)
-		return FALSE;
-	else {
-		fprintf(stderr, "%s: mlhmmv_level_find_index_for_key did not find end of chain\n", MLR_GLOBALS.bargv0);
-		exit(1);
-	}
+	return mlhmmv_level_find(plevel, plevel_key) >= 0;
 }
 
 // ----------------------------------------------------------------
-// Returns >=0 for where the key is *or* should go (end of chain).
-
-static int mlhmmv_level_find_index_for_key(mlhmmv_level_t* plevel, mv_t* plevel_key, int* pideal_index) {
-	int hash = mlhmmv_hash_func(plevel_key);
-	int index = mlr_canonical_mod(hash, plevel->array_length);
-	*pideal_index = index;
-	int num_tries = 0;
-
-	while (TRUE) {
-		mlhmmv_level_entry_t* pentry = &plevel->entries[index];
-		if (plevel->states[index] == OCCUPIED) {
-			mv_t* ekey = &pentry->level_key;
-			// Existing key found in chain.
-			if (mv_equals_si(plevel_key, ekey))
-				return index;
-		} else if (plevel->states[index] == EMPTY) {
-			return index;
-		}
+// Returns the position of the key's entry, or -1 if it isn't present.
 
-		// If the current entry has been freed, i.e. previously occupied,
-		// the sought index may be further down the chain.  So we must
-		// continue looking.
-		if (++num_tries >= plevel->array_length) {
-			fprintf(stderr,
-				"%s: Coding error:  table full even after enlargement.\n", MLR_GLOBALS.bargv0);
-			exit(1);
+static int mlhmmv_level_find(mlhmmv_level_t* plevel, mv_t* plevel_key) {
+	mlhmmv_check_key_type(plevel_key);
+
+	if (plevel->pindex == NULL) {
+		// Removed entries have absent keys, which never match.
+		for (int i = 0; i < plevel->num_used; i++)
+			if (mlhmmv_key_matches(&plevel->entries[i].level_key, plevel_key))
+				return i;
+		return -1;
+	}
+
+	unsigned hash = mlhmmv_key_hash(plevel_key);
+	hash_index_probe_t probe;
+	hash_index_probe_start(plevel->pindex, hash, &probe);
+	for (int pos = hash_index_probe_next(plevel->pindex, &probe); pos >= 0;
+		pos = hash_index_probe_next(plevel->pindex, &probe))
+	{
+		mv_t* pstored_key = &plevel->entries[pos].level_key;
+		if (pstored_key->type != plevel_key->type)
+			continue;
+		if (plevel_key->type == MT_INT) {
+			if (pstored_key->u.intv == plevel_key->u.intv)
+				return pos;
+		} else if (mlhmmv_interned_key_of(pstored_key->u.strv)->hash == hash
+			&& streq(pstored_key->u.strv, plevel_key->u.strv))
+		{
+			return pos;
 		}
+	}
+	return -1;
+}
+
+// ----------------------------------------------------------------
+// Adds an entry for a key the caller has found not to be present, copying the
+// key. The entry's value is for the caller to fill in.
+
+static mlhmmv_level_entry_t* mlhmmv_level_append(mlhmmv_level_t* plevel, mv_t* plevel_key) {
+	if (plevel->num_used >= plevel->capacity)
+		mlhmmv_level_grow(plevel);
+
+	unsigned hash = mlhmmv_key_hash(plevel_key);
+	int position = plevel->num_used++;
+	mlhmmv_level_entry_t* pentry = &plevel->entries[position];
+	pentry->level_key = (plevel_key->type == MT_STRING)
+		? mv_from_string_no_free(mlhmmv_intern(plevel_key->u.strv, hash))
+		: mv_from_int(plevel_key->u.intv);
+	if (plevel->pindex != NULL)
+		hash_index_insert(plevel->pindex, hash, position);
+	plevel->num_occupied++;
+	return pentry;
+}
+
+// ----------------------------------------------------------------
+// Squeezes out removed entries, then enlarges the entry array unless that
+// freed up at least half of it. Capacity doubles up to the small-level size and
+// goes up by half after that. Past the small-level size the hash index is
+// rebuilt, since positions have moved; it is sized so that it can hold the
+// whole entry array, tombstones and all, without filling up.
+
+static void mlhmmv_level_grow(mlhmmv_level_t* plevel) {
+	int num_kept = 0;
+	for (int i = 0; i < plevel->num_used; i++)
+		if (plevel->entries[i].level_key.type != MT_ABSENT)
+			plevel->entries[num_kept++] = plevel->entries[i];
+	plevel->num_used = num_kept;
+
+	if (plevel->num_occupied >= plevel->capacity / 2) {
+		if (plevel->capacity == 0)
+			plevel->capacity = 1;
+		else if (plevel->capacity < MLHMMV_SMALL_LEVEL_MAX)
+			plevel->capacity *= 2;
+		else
+			plevel->capacity += plevel->capacity / 2;
+		plevel->entries = mlr_realloc_or_die(plevel->entries, plevel->capacity * sizeof(mlhmmv_level_entry_t));
+	}
 
-		// Linear probing.
-		if (++index >= plevel->array_length)
-			index = 0;
+	if (plevel->capacity > MLHMMV_SMALL_LEVEL_MAX) {
+		int index_capacity = HASH_INDEX_GROUP_SIZE;
+		while (hash_index_max_load(index_capacity) < plevel->capacity)
+			index_capacity *= 2;
+		if (plevel->pindex == NULL) {
+			plevel->pindex = mlr_malloc_or_die(sizeof(hash_index_t));
+			hash_index_init(plevel->pindex, index_capacity);
+		} else if (plevel->pindex->capacity != index_capacity) {
+			hash_index_free(plevel->pindex);
+			hash_index_init(plevel->pindex, index_capacity);
+		} else {
+			hash_index_clear(plevel->pindex);
+		}
+		for (int i = 0; i < plevel->num_used; i++)
+			hash_index_insert(plevel->pindex, mlhmmv_stored_key_hash(&plevel->entries[i].level_key), i);
 	}
-	MLR_INTERNAL_CODING_ERROR();
-	return -1; // not reached
 }
 
 // ----------------------------------------------------------------
@@ -487,7 +604,7 @@ static mlhmmv_level_entry_t* mlhmmv_level_look_up_and_ref_entry(mlhmmv_level_t*
 			*perror = MLHMMV_ERROR_KEYLIST_TOO_SHALLOW;
 		return NULL;
 	}
-	mlhmmv_level_entry_t* plevel_entry = mlhmmv_level_get_next_level_entry(plevel, &prestkeys->value, NULL);
+	mlhmmv_level_entry_t* plevel_entry = mlhmmv_level_get_next_level_entry(plevel, &prestkeys->value);
 	while (prestkeys->pnext != NULL) {
 		if (plevel_entry == NULL) {
 			return NULL;
@@ -500,35 +617,22 @@ static mlhmmv_level_entry_t* mlhmmv_level_look_up_and_ref_entry(mlhmmv_level_t*
 		plevel = plevel_entry->level_xvalue.pnext_level;
 		prestkeys = prestkeys->pnext;
 		plevel_entry = mlhmmv_level_get_next_level_entry(plevel_entry->level_xvalue.pnext_level,
-			&prestkeys->value, NULL);
+			&prestkeys->value);
 	}
 	return plevel_entry;
 }
 
 // ----------------------------------------------------------------
-static mlhmmv_level_entry_t* mlhmmv_level_get_next_level_entry(mlhmmv_level_t* plevel, mv_t* plevel_key, int* pindex) {
-	int ideal_index = 0;
-	int index = mlhmmv_level_find_index_for_key(plevel, plevel_key, &ideal_index);
-	mlhmmv_level_entry_t* pentry = &plevel->entries[index];
-
-	if (pindex != NULL)
-		*pindex = index;
-
-	if (plevel->states[index] == OCCUPIED)
-		return pentry;
-	else if (plevel->states[index] == EMPTY)
-		return NULL;
-	else {
-		fprintf(stderr, "%s: mlhmmv_level_find_index_for_key did not find end of chain\n", MLR_GLOBALS.bargv0);
-		exit(1);
-	}
+static mlhmmv_level_entry_t* mlhmmv_level_get_next_level_entry(mlhmmv_level_t* plevel, mv_t* plevel_key) {
+	int position = mlhmmv_level_find(plevel, plevel_key);
+	return (position < 0) ? NULL : &plevel->entries[position];
 }
 
 // ----------------------------------------------------------------
 static mlhmmv_xvalue_t* mlhmmv_level_get_next_level_xvalue(mlhmmv_level_t* plevel, mv_t* plevel_key) {
 	if (plevel == NULL)
 		return NULL;
-	mlhmmv_level_entry_t* pentry = mlhmmv_level_get_next_level_entry(plevel, plevel_key, NULL);
+	mlhmmv_level_entry_t* pentry = mlhmmv_level_get_next_level_entry(plevel, plevel_key);
 	if (pentry == NULL)
 		return NULL;
 	else
@@ -560,7 +664,7 @@ mlhmmv_xvalue_t* mlhmmv_level_look_up_and_ref_xvalue(mlhmmv_level_t* pstart_leve
 	if (plevel == NULL) {
 		return NULL;
 	}
-	mlhmmv_level_entry_t* plevel_entry = mlhmmv_level_get_next_level_entry(plevel, &prest_keys->value, NULL);
+	mlhmmv_level_entry_t* plevel_entry = mlhmmv_level_get_next_level_entry(plevel, &prest_keys->value);
 	while (prest_keys->pnext != NULL) {
 		if (plevel_entry == NULL) {
 			return NULL;
@@ -569,7 +673,7 @@ mlhmmv_xvalue_t* mlhmmv_level_look_up_and_ref_xvalue(mlhmmv_level_t* pstart_leve
 			prest_keys = prest_keys->pnext;
 			if (plevel == NULL)
 				return NULL;
-			plevel_entry = mlhmmv_level_get_next_level_entry(plevel, &prest_keys->value, NULL);
+			plevel_entry = mlhmmv_level_get_next_level_entry(plevel, &prest_keys->value);
 		}
 	}
 	if (plevel_entry == NULL) {
@@ -581,62 +685,25 @@ mlhmmv_xvalue_t* mlhmmv_level_look_up_and_ref_xvalue(mlhmmv_level_t* pstart_leve
 
 // ----------------------------------------------------------------
 static mlhmmv_level_t* mlhmmv_level_ref_or_create(mlhmmv_level_t* plevel, sllmve_t* prest_keys) {
-	if ((plevel->num_occupied + plevel->num_freed) >= (plevel->array_length * LOAD_FACTOR))
-		mlhmmv_level_enlarge(plevel);
-	return mlhmmv_level_get_or_create_no_enlarge(plevel, prest_keys);
-}
-
-// ----------------------------------------------------------------
-static mlhmmv_level_t* mlhmmv_level_get_or_create_no_enlarge(mlhmmv_level_t* plevel, sllmve_t* prest_keys) {
 	mv_t* plevel_key = &prest_keys->value;
-	int ideal_index = 0;
-	int index = mlhmmv_level_find_index_for_key(plevel, plevel_key, &ideal_index);
-	mlhmmv_level_entry_t* pentry = &plevel->entries[index];
-
-	if (plevel->states[index] == EMPTY) { // End of chain.
-
-		plevel->states[index] = OCCUPIED;
-		plevel->num_occupied++;
-		pentry->ideal_index = ideal_index;
-		pentry->level_key = mv_copy(plevel_key);
-		pentry->level_xvalue.is_terminal = FALSE;
-		pentry->level_xvalue.pnext_level = mlhmmv_level_alloc();
-
-		if (plevel->phead == NULL) { // First entry at this level
-			pentry->pprev = NULL;
-			pentry->pnext = NULL;
-			plevel->phead = pentry;
-			plevel->ptail = pentry;
-		} else {                     // Subsequent entry at this level
-			pentry->pprev = plevel->ptail;
-			pentry->pnext = NULL;
-			plevel->ptail->pnext = pentry;
-			plevel->ptail = pentry;
-		}
-
-		if (prest_keys->pnext != NULL) {
-			// RECURSE
-			return mlhmmv_level_ref_or_create(pentry->level_xvalue.pnext_level, prest_keys->pnext);
-		} else {
-			return pentry->level_xvalue.pnext_level;
-		}
-
-	} else if (plevel->states[index] == OCCUPIED) { // Existing key found in chain
+	int position = mlhmmv_level_find(plevel, plevel_key);
+	mlhmmv_level_entry_t* pentry = NULL;
 
+	if (position < 0) {
+		pentry = mlhmmv_level_append(plevel, plevel_key);
+		pentry->level_xvalue = mlhmmv_xvalue_alloc_empty_map();
+	} else {
+		pentry = &plevel->entries[position];
 		if (pentry->level_xvalue.is_terminal) {
 			mv_free(&pentry->level_xvalue.terminal_mlrval);
-			pentry->level_xvalue.is_terminal = FALSE;
-			pentry->level_xvalue.pnext_level = mlhmmv_level_alloc();
-		}
-		if (prest_keys->pnext == NULL) {
-			return pentry->level_xvalue.pnext_level;
-		} else { // RECURSE
-			return mlhmmv_level_ref_or_create(pentry->level_xvalue.pnext_level, prest_keys->pnext);
+			pentry->level_xvalue = mlhmmv_xvalue_alloc_empty_map();
 		}
+	}
 
-	} else {
-		fprintf(stderr, "%s: mlhmmv_level_find_index_for_key did not find end of chain\n", MLR_GLOBALS.bargv0);
-		exit(1);
+	if (prest_keys->pnext == NULL) {
+		return pentry->level_xvalue.pnext_level;
+	} else { // RECURSE
+		return mlhmmv_level_ref_or_create(pentry->level_xvalue.pnext_level, prest_keys->pnext);
 	}
 }
 
@@ -661,122 +728,24 @@ mlhmmv_level_t* mlhmmv_level_put_empty_map(mlhmmv_level_t* plevel, mv_t* pkey) {
 	return pxval->pnext_level;
 }
 
-// ----------------------------------------------------------------
-static void mlhmmv_level_enlarge(mlhmmv_level_t* plevel) {
-	mlhmmv_level_entry_t*       old_entries = plevel->entries;
-	mlhmmv_level_entry_state_t* old_states  = plevel->states;
-	mlhmmv_level_entry_t*       old_head    = plevel->phead;
-
-	mlhmmv_level_init(plevel, plevel->array_length*ENLARGEMENT_FACTOR);
-
-	for (mlhmmv_level_entry_t* pentry = old_head; pentry != NULL; pentry = pentry->pnext) {
-		mlhmmv_level_move(plevel, &pentry->level_key, &pentry->level_xvalue);
-	}
-	free(old_entries);
-	free(old_states);
-}
-
-// ----------------------------------------------------------------
-// This is done only on map-level enlargement.
-// Example:
-// * level = map["a"], rest_keys = [2, "c"] ,   terminal_value = 4.
-//                     rest_keys = ["e", "f"] , terminal_value = 7.
-//                     rest_keys = [6] ,        terminal_value = "g".
-//
-// which is to say for the purposes of this routine
-//
-// * level = map["a"], level_key = 2,   level_xvalue = non-terminal ["c"] => terminal_value = 4.
-//                     level_key = "e", level_xvalue = non-terminal ["f"] => terminal_value = 7.
-//                     level_key = 6,   level_xvalue = terminal_value = "g".
-
-static void mlhmmv_level_move(mlhmmv_level_t* plevel, mv_t* plevel_key, mlhmmv_xvalue_t* plevel_value) {
-	int ideal_index = 0;
-	int index = mlhmmv_level_find_index_for_key(plevel, plevel_key, &ideal_index);
-	mlhmmv_level_entry_t* pentry = &plevel->entries[index];
-
-	if (plevel->states[index] == OCCUPIED) {
-		// Existing key found in chain; put value.
-		pentry->level_xvalue = *plevel_value;
-
-	} else if (plevel->states[index] == EMPTY) {
-		// End of chain.
-		pentry->ideal_index = ideal_index;
-		pentry->level_key = *plevel_key;
-		// For the put API, we copy data passed in. But for internal enlarges, we just need to move pointers around.
-		pentry->level_xvalue = *plevel_value;
-		plevel->states[index] = OCCUPIED;
-
-		if (plevel->phead == NULL) {
-			pentry->pprev = NULL;
-			pentry->pnext = NULL;
-			plevel->phead = pentry;
-			plevel->ptail = pentry;
-		} else {
-			pentry->pprev = plevel->ptail;
-			pentry->pnext = NULL;
-			plevel->ptail->pnext = pentry;
-			plevel->ptail = pentry;
-		}
-		plevel->num_occupied++;
-	}
-	else {
-		fprintf(stderr, "%s: mlhmmv_level_find_index_for_key did not find end of chain\n", MLR_GLOBALS.bargv0);
-		exit(1);
-	}
-}
-
 // ----------------------------------------------------------------
 void mlhmmv_level_put_xvalue(mlhmmv_level_t* plevel, sllmve_t* prest_keys, mlhmmv_xvalue_t* pvalue) { // xxx 'copy' into name
-	if ((plevel->num_occupied + plevel->num_freed) >= (plevel->array_length * LOAD_FACTOR))
-		mlhmmv_level_enlarge(plevel);
-	mlhmmv_level_put_xvalue_no_enlarge(plevel, prest_keys, pvalue);
-}
-
-void mlhmmv_level_put_xvalue_singly_keyed(mlhmmv_level_t* plevel, mv_t* pkey, mlhmmv_xvalue_t* pvalue) {
-	sllmve_t e = { .value = *pkey, .free_flags = 0, .pnext = NULL };
-	mlhmmv_level_put_xvalue(plevel, &e, pvalue);
-}
-
-// ----------------------------------------------------------------
-static void mlhmmv_level_put_xvalue_no_enlarge(mlhmmv_level_t* plevel, sllmve_t* prest_keys,
-	mlhmmv_xvalue_t* pvalue)
-{
 	mv_t* plevel_key = &prest_keys->value;
-	int ideal_index = 0;
-	int index = mlhmmv_level_find_index_for_key(plevel, plevel_key, &ideal_index);
-	mlhmmv_level_entry_t* pentry = &plevel->entries[index];
+	int position = mlhmmv_level_find(plevel, plevel_key);
 
-	if (plevel->states[index] == EMPTY) { // End of chain.
-		pentry->ideal_index = ideal_index;
-		pentry->level_key = mv_copy(plevel_key); // (xxx weird & needs explaining) key is copied ...
+	if (position < 0) {
+		mlhmmv_level_entry_t* pentry = mlhmmv_level_append(plevel, plevel_key); // (xxx weird & needs explaining) key is copied ...
 
 		if (prest_keys->pnext == NULL) {
 			pentry->level_xvalue = *pvalue; // (xxx weird & needs explaining) ... but the value is not copied
 		} else {
-			pentry->level_xvalue.is_terminal = FALSE;
-			pentry->level_xvalue.pnext_level = mlhmmv_level_alloc();
-		}
-		plevel->states[index] = OCCUPIED;
-
-		if (plevel->phead == NULL) { // First entry at this level
-			pentry->pprev = NULL;
-			pentry->pnext = NULL;
-			plevel->phead = pentry;
-			plevel->ptail = pentry;
-		} else {                     // Subsequent entry at this level
-			pentry->pprev = plevel->ptail;
-			pentry->pnext = NULL;
-			plevel->ptail->pnext = pentry;
-			plevel->ptail = pentry;
-		}
-
-		plevel->num_occupied++;
-		if (prest_keys->pnext != NULL) {
+			pentry->level_xvalue = mlhmmv_xvalue_alloc_empty_map();
 			// RECURSE
 			mlhmmv_level_put_xvalue(pentry->level_xvalue.pnext_level, prest_keys->pnext, pvalue);
 		}
 
-	} else if (plevel->states[index] == OCCUPIED) { // Existing key found in chain
+	} else { // Existing key found
+		mlhmmv_level_entry_t* pentry = &plevel->entries[position];
 		if (prest_keys->pnext == NULL) { // Place the terminal at this level
 			if (pentry->level_xvalue.is_terminal) {
 				mv_free(&pentry->level_xvalue.terminal_mlrval);
@@ -788,19 +757,19 @@ static void mlhmmv_level_put_xvalue_no_enlarge(mlhmmv_level_t* plevel, sllmve_t*
 		} else { // The terminal will be placed at a deeper level
 			if (pentry->level_xvalue.is_terminal) {
 				mv_free(&pentry->level_xvalue.terminal_mlrval);
-				pentry->level_xvalue.is_terminal = FALSE;
-				pentry->level_xvalue.pnext_level = mlhmmv_level_alloc();
+				pentry->level_xvalue = mlhmmv_xvalue_alloc_empty_map();
 			}
 			// RECURSE
 			mlhmmv_level_put_xvalue(pentry->level_xvalue.pnext_level, prest_keys->pnext, pvalue);
 		}
-
-	} else {
-		fprintf(stderr, "%s: mlhmmv_level_find_index_for_key did not find end of chain\n", MLR_GLOBALS.bargv0);
-		exit(1);
 	}
 }
 
+void mlhmmv_level_put_xvalue_singly_keyed(mlhmmv_level_t* plevel, mv_t* pkey, mlhmmv_xvalue_t* pvalue) {
+	sllmve_t e = { .value = *pkey, .free_flags = 0, .pnext = NULL };
+	mlhmmv_level_put_xvalue(plevel, &e, pvalue);
+}
+
 // ----------------------------------------------------------------
 // Example on recursive calls:
 // * level = map, rest_keys = ["a", 2, "c"] , terminal value = 4.
@@ -808,55 +777,24 @@ static void mlhmmv_level_put_xvalue_no_enlarge(mlhmmv_level_t* plevel, sllmve_t*
 // * level = map["a"][2], rest_keys = ["c"] , terminal value = 4.
 
 void mlhmmv_level_put_terminal(mlhmmv_level_t* plevel, sllmve_t* prest_keys, mv_t* pterminal_value) {
-	if ((plevel->num_occupied + plevel->num_freed) >= (plevel->array_length * LOAD_FACTOR))
-		mlhmmv_level_enlarge(plevel);
-	mlhmmv_level_put_terminal_no_enlarge(plevel, prest_keys, pterminal_value);
-}
-
-void mlhmmv_level_put_terminal_singly_keyed(mlhmmv_level_t* plevel, mv_t* pkey, mv_t* pterminal_value) {
-	sllmve_t e = { .value = *pkey, .free_flags = 0, .pnext = NULL };
-	mlhmmv_level_put_terminal(plevel, &e, pterminal_value);
-}
-
-// ----------------------------------------------------------------
-static void mlhmmv_level_put_terminal_no_enlarge(mlhmmv_level_t* plevel, sllmve_t* prest_keys, mv_t* pterminal_value) {
 	mv_t* plevel_key = &prest_keys->value;
-	int ideal_index = 0;
-	int index = mlhmmv_level_find_index_for_key(plevel, plevel_key, &ideal_index);
-	mlhmmv_level_entry_t* pentry = &plevel->entries[index];
+	int position = mlhmmv_level_find(plevel, plevel_key);
 
-	if (plevel->states[index] == EMPTY) { // End of chain.
-		pentry->ideal_index = ideal_index;
-		pentry->level_key = mv_copy(plevel_key); // <------------------------- copy key
+	if (position < 0) {
+		mlhmmv_level_entry_t* pentry = mlhmmv_level_append(plevel, plevel_key); // <------------------------- copy key
 
 		if (prest_keys->pnext == NULL) {
 			pentry->level_xvalue.is_terminal = TRUE;
 			pentry->level_xvalue.terminal_mlrval = mv_copy(pterminal_value); // <--------------- copy value
+			pentry->level_xvalue.pnext_level = NULL;
 		} else {
-			pentry->level_xvalue.is_terminal = FALSE;
-			pentry->level_xvalue.pnext_level = mlhmmv_level_alloc();
-		}
-		plevel->states[index] = OCCUPIED;
-
-		if (plevel->phead == NULL) { // First entry at this level
-			pentry->pprev = NULL;
-			pentry->pnext = NULL;
-			plevel->phead = pentry;
-			plevel->ptail = pentry;
-		} else {                     // Subsequent entry at this level
-			pentry->pprev = plevel->ptail;
-			pentry->pnext = NULL;
-			plevel->ptail->pnext = pentry;
-			plevel->ptail = pentry;
-		}
-
-		plevel->num_occupied++;
-		if (prest_keys->pnext != NULL) {
+			pentry->level_xvalue = mlhmmv_xvalue_alloc_empty_map();
 			// RECURSE
 			mlhmmv_level_put_terminal(pentry->level_xvalue.pnext_level, prest_keys->pnext, pterminal_value);
 		}
 
-	} else if (plevel->states[index] == OCCUPIED) { // Existing key found in chain
+	} else { // Existing key found
+		mlhmmv_level_entry_t* pentry = &plevel->entries[position];
 		if (prest_keys->pnext == NULL) { // Place the terminal at this level
 			if (pentry->level_xvalue.is_terminal) {
 				mv_free(&pentry->level_xvalue.terminal_mlrval);
@@ -865,23 +803,24 @@ static void mlhmmv_level_put_terminal_no_enlarge(mlhmmv_level_t* plevel, sllmve_
 			}
 			pentry->level_xvalue.is_terminal = TRUE;
 			pentry->level_xvalue.terminal_mlrval = mv_copy(pterminal_value); // <--------------- copy value
+			pentry->level_xvalue.pnext_level = NULL;
 
 		} else { // The terminal will be placed at a deeper level
 			if (pentry->level_xvalue.is_terminal) {
 				mv_free(&pentry->level_xvalue.terminal_mlrval);
-				pentry->level_xvalue.is_terminal = FALSE;
-				pentry->level_xvalue.pnext_level = mlhmmv_level_alloc();
+				pentry->level_xvalue = mlhmmv_xvalue_alloc_empty_map();
 			}
 			// RECURSE
 			mlhmmv_level_put_terminal(pentry->level_xvalue.pnext_level, prest_keys->pnext, pterminal_value);
 		}
-
-	} else {
-		fprintf(stderr, "%s: mlhmmv_level_find_index_for_key did not find end of chain\n", MLR_GLOBALS.bargv0);
-		exit(1);
 	}
 }
 
+void mlhmmv_level_put_terminal_singly_keyed(mlhmmv_level_t* plevel, mv_t* pkey, mv_t* pterminal_value) {
+	sllmve_t e = { .value = *pkey, .free_flags = 0, .pnext = NULL };
+	mlhmmv_level_put_terminal(plevel, &e, pterminal_value);
+}
+
 // ----------------------------------------------------------------
 void mlhmmv_level_to_lrecs(mlhmmv_level_t* plevel, sllmv_t* pkeys, sllmv_t* pnames, sllv_t* poutrecs,
 	int do_full_prefixing, char* flatten_separator)
@@ -925,7 +864,7 @@ static void mlhmmv_level_to_lrecs_across_records(
 {
 	if (prestnames != NULL) {
 		// If there is a namelist entry, pull it out to its own field on the output lrecs.
-		for (mlhmmv_level_entry_t* pe = plevel->phead; pe != NULL; pe = pe->pnext) {
+		for (mlhmmv_level_entry_t* pe = mlhmmv_level_first(plevel); pe != NULL; pe = mlhmmv_level_next(plevel, pe)) {
 			mlhmmv_xvalue_t* plevel_value = &pe->level_xvalue;
 			lrec_t* pnextrec = lrec_copy(ptemplate);
 			lrec_put(pnextrec,
@@ -948,7 +887,7 @@ static void mlhmmv_level_to_lrecs_across_records(
 		// (default ":") and use them to create lrec values.
 		lrec_t* pnextrec = lrec_copy(ptemplate);
 		int emit = TRUE;
-		for (mlhmmv_level_entry_t* pe = plevel->phead; pe != NULL; pe = pe->pnext) {
+		for (mlhmmv_level_entry_t* pe = mlhmmv_level_first(plevel); pe != NULL; pe = mlhmmv_level_next(plevel, pe)) {
 			mlhmmv_xvalue_t* plevel_value = &pe->level_xvalue;
 			if (plevel_value->is_terminal) {
 				char* temp = mv_alloc_format_val(&pe->level_key);
@@ -988,7 +927,7 @@ static void mlhmmv_level_to_lrec_within_record(
 	int             do_full_prefixing,
 	char*           flatten_separator)
 {
-	for (mlhmmv_level_entry_t* pe = plevel->phead; pe != NULL; pe = pe->pnext) {
+	for (mlhmmv_level_entry_t* pe = mlhmmv_level_first(plevel); pe != NULL; pe = mlhmmv_level_next(plevel, pe)) {
 		mlhmmv_xvalue_t* plevel_value = &pe->level_xvalue;
 		char* temp = mv_alloc_format_val(&pe->level_key);
 		char* next_prefix = do_full_prefixing
@@ -1023,7 +962,7 @@ static void mlhhmv_levels_to_lrecs_lashed_across_records(
 		// If there is a namelist entry, pull it out to its own field on the output lrecs.
 		// First is iterated over and the rest are lashed (lookups with same keys as primary).
 		if (pplevels[0] != NULL) {
-			for (mlhmmv_level_entry_t* pe = pplevels[0]->phead; pe != NULL; pe = pe->pnext) {
+			for (mlhmmv_level_entry_t* pe = mlhmmv_level_first(pplevels[0]); pe != NULL; pe = mlhmmv_level_next(pplevels[0], pe)) {
 				mlhmmv_xvalue_t* pfirst_level_value = &pe->level_xvalue;
 				lrec_t* pnextrec = lrec_copy(ptemplate);
 				lrec_put(pnextrec,
@@ -1065,7 +1004,7 @@ static void mlhhmv_levels_to_lrecs_lashed_across_records(
 		// (default ":") and use them to create lrec values.
 		lrec_t* pnextrec = lrec_copy(ptemplate);
 		int emit = TRUE;
-		for (mlhmmv_level_entry_t* pe = pplevels[0]->phead; pe != NULL; pe = pe->pnext) {
+		for (mlhmmv_level_entry_t* pe = mlhmmv_level_first(pplevels[0]); pe != NULL; pe = mlhmmv_level_next(pplevels[0], pe)) {
 			if (pe->level_xvalue.is_terminal) {
 				char* temp = mv_alloc_format_val(&pe->level_key);
 				for (int i = 0; i < num_levels; i++) {
@@ -1139,7 +1078,7 @@ static void mlhhmv_levels_to_lrecs_lashed_within_records(
 	int              do_full_prefixing,
 	char*            flatten_separator)
 {
-	for (mlhmmv_level_entry_t* pe = pplevels[0]->phead; pe != NULL; pe = pe->pnext) {
+	for (mlhmmv_level_entry_t* pe = mlhmmv_level_first(pplevels[0]); pe != NULL; pe = mlhmmv_level_next(pplevels[0], pe)) {
 		mlhmmv_xvalue_t* pfirst_level_value = &pe->level_xvalue;
 		char* temp = mv_alloc_format_val(&pe->level_key);
 		if (pfirst_level_value->is_terminal) {
@@ -1196,7 +1135,7 @@ void mlhmmv_level_print_stacked(mlhmmv_level_t* plevel, int depth,
 	// Top-level opening brace goes on a line by itself; subsequents on the same line after the level key.
 	if (depth == 0)
 		fprintf(ostream, "%s{%s", line_indent, line_term);
-	for (mlhmmv_level_entry_t* pentry = plevel->phead; pentry != NULL; pentry = pentry->pnext) {
+	for (mlhmmv_level_entry_t* pentry = mlhmmv_level_first(plevel); pentry != NULL; pentry = mlhmmv_level_next(plevel, pentry)) {
 		fprintf(ostream, "%s", line_indent);
 		for (int i = 0; i <= depth; i++)
 			fprintf(ostream, "%s", leader);
@@ -1213,14 +1152,14 @@ void mlhmmv_level_print_stacked(mlhmmv_level_t* plevel, int depth,
 			mlhmmv_print_terminal(&pentry->level_xvalue.terminal_mlrval, quote_keys_always,
 				quote_values_always, ostream);
 
-			if (pentry->pnext != NULL)
+			if (mlhmmv_level_next(plevel, pentry) != NULL)
 				fprintf(ostream, ",%s", line_term);
 			else
 				fprintf(ostream, "%s", line_term);
 		} else {
 			fprintf(ostream, "%s{%s", line_indent, line_term);
 			mlhmmv_level_print_stacked(pentry->level_xvalue.pnext_level, depth + 1,
-				pentry->pnext != NULL, quote_keys_always, quote_values_always, line_indent, line_term,
+				mlhmmv_level_next(plevel, pentry) != NULL, quote_keys_always, quote_values_always, line_indent, line_term,
 				ostream);
 		}
 	}
@@ -1239,7 +1178,7 @@ static void mlhmmv_level_print_single_line(mlhmmv_level_t* plevel, int depth,
 	// Top-level opening brace goes on a line by itself; subsequents on the same line after the level key.
 	if (depth == 0)
 		fprintf(ostream, "{ ");
-	for (mlhmmv_level_entry_t* pentry = plevel->phead; pentry != NULL; pentry = pentry->pnext) {
+	for (mlhmmv_level_entry_t* pentry = mlhmmv_level_first(plevel); pentry != NULL; pentry = mlhmmv_level_next(plevel, pentry)) {
 		char* level_key_string = mv_alloc_format_val(&pentry->level_key);
 		if (quote_keys_always || mv_is_string_or_empty(&pentry->level_key)) {
 			json_print_string_escaped(ostream, level_key_string);
@@ -1268,12 +1207,12 @@ static void mlhmmv_level_print_single_line(mlhmmv_level_t* plevel, int depth,
 			}
 
 			free(level_value_string);
-			if (pentry->pnext != NULL)
+			if (mlhmmv_level_next(plevel, pentry) != NULL)
 				fprintf(ostream, ", ");
 		} else {
 			fprintf(ostream, "{");
 			mlhmmv_level_print_single_line(pentry->level_xvalue.pnext_level, depth + 1,
-				pentry->pnext != NULL, quote_keys_always, quote_values_always, ostream);
+				mlhmmv_level_next(plevel, pentry) != NULL, quote_keys_always, quote_values_always, ostream);
 		}
 	}
 	if (do_final_comma)
@@ -1289,10 +1228,10 @@ void mlhmmv_level_remove(mlhmmv_level_t* plevel, sllmve_t* prestkeys) {
 	if (prestkeys == NULL) // restkeys too short
 		return;
 
-	int index = -1;
-	mlhmmv_level_entry_t* pentry = mlhmmv_level_get_next_level_entry(plevel, &prestkeys->value, &index);
-	if (pentry == NULL)
+	int position = mlhmmv_level_find(plevel, &prestkeys->value);
+	if (position < 0)
 		return;
+	mlhmmv_level_entry_t* pentry = &plevel->entries[position];
 
 	if (prestkeys->pnext != NULL) {
 		// Keep recursing until end of restkeys.
@@ -1301,34 +1240,17 @@ void mlhmmv_level_remove(mlhmmv_level_t* plevel, sllmve_t* prestkeys) {
 		mlhmmv_level_remove(pentry->level_xvalue.pnext_level, prestkeys->pnext);
 
 	} else {
-		// 1. Excise the node and its descendants from the storage tree
-		if (plevel->states[index] != OCCUPIED) {
-			fprintf(stderr, "%s: mlhmmv_root_remove: did not find end of chain.\n", MLR_GLOBALS.bargv0);
-			exit(1);
-		}
-
-		mv_free(&pentry->level_key);
-		pentry->ideal_index = -1;
-		plevel->states[index] = DELETED;
-
-		if (pentry == plevel->phead) {
-			if (pentry == plevel->ptail) {
-				plevel->phead = NULL;
-				plevel->ptail = NULL;
-			} else {
-				plevel->phead = pentry->pnext;
-				pentry->pnext->pprev = NULL;
-			}
-		} else if (pentry == plevel->ptail) {
-				plevel->ptail = pentry->pprev;
-				pentry->pprev->pnext = NULL;
-		} else {
-			pentry->pprev->pnext = pentry->pnext;
-			pentry->pnext->pprev = pentry->pprev;
-		}
-
-		plevel->num_freed++;
+		// 1. Excise the node and its descendants from the storage tree. The
+		// entry stays in place, marked as removed, until the level next grows.
+		if (plevel->pindex != NULL)
+			hash_index_remove(plevel->pindex, mlhmmv_stored_key_hash(&pentry->level_key), position);
+		mlhmmv_stored_key_release(&pentry->level_key);
 		plevel->num_occupied--;
+		if (plevel->num_occupied == 0) {
+			plevel->num_used = 0;
+			if (plevel->pindex != NULL)
+				hash_index_clear(plevel->pindex);
+		}
 
 		// 2. Free the memory for the node and its descendants
 		if (pentry->level_xvalue.is_terminal) {
@@ -1449,7 +1371,8 @@ void mlhmmv_root_remove(mlhmmv_root_t* pmap, sllmv_t* prestkeys) {
 void mlhmmv_root_all_to_lrecs(mlhmmv_root_t* pmap, sllmv_t* pnames, sllv_t* poutrecs, int do_full_prefixing,
 	char* flatten_separator)
 {
-	for (mlhmmv_level_entry_t* pentry = pmap->root_xvalue.pnext_level->phead; pentry != NULL; pentry = pentry->pnext) {
+	mlhmmv_level_t* plevel = pmap->root_xvalue.pnext_level;
+	for (mlhmmv_level_entry_t* pentry = mlhmmv_level_first(plevel); pentry != NULL; pentry = mlhmmv_level_next(plevel, pentry)) {
 		sllmv_t* pkey = sllmv_single_no_free(&pentry->level_key);
 		mlhmmv_root_partial_to_lrecs(pmap, pkey, pnames, poutrecs, do_full_prefixing, flatten_separator);
 		sllmv_free(pkey);
@@ -1580,10 +1503,9 @@ mlhmmv_root_t* mlhmmv_wrap_name_and_xvalue(mv_t* pname, mlhmmv_xvalue_t* pxval)
 void mlhmmv_unwrap_name_and_xvalue(mlhmmv_root_t* pmap)
 {
 	mlhmmv_level_t* plevel = pmap->root_xvalue.pnext_level;
-	mlhmmv_level_entry_t* pentry = plevel->phead;
-	mv_free(&pentry->level_key);
-	plevel->phead = NULL;
-	plevel->ptail = NULL;
+	mlhmmv_level_entry_t* pentry = mlhmmv_level_first(plevel);
+	mlhmmv_stored_key_release(&pentry->level_key);
 	plevel->num_occupied = 0;
+	plevel->num_used = 0;
 	mlhmmv_root_free(pmap);
 }
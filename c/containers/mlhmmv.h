@@ -1,7 +1,20 @@
 // ================================================================
-// Array-only (open addressing) multi-level hash map, with linear probing for collisions.
-// All keys, and terminal-level values, are mlrvals. All data passed into the put method
-// are copied; no pointers in this data structure reference anything external.
+// Multi-level hash map. All keys, and terminal-level values, are mlrvals. All
+// data passed into the put method are copied; no pointers in this data
+// structure reference anything external.
+//
+// This holds out-of-stream variables, which for DSL aggregations such as
+// '@sum[$a][$b] += $x' can mean millions of small levels, so each level is
+// kept compact:
+// * Entries are a dense array in insertion order, with no per-entry links or
+//   stored hashes. Removed entries are left in place, marked with an absent
+//   key, until the array next grows.
+// * Levels of up to MLHMMV_SMALL_LEVEL_MAX entries are searched linearly and
+//   have no hash index at all. Larger levels get a hash_index_t over the entry
+//   array.
+// * String keys are interned: each distinct key string is stored once,
+//   reference-counted, however many levels use it, along with its hash.
+//   Integer keys are hashed with a multiplicative mix.
 //
 // Notes:
 // * null key is not supported.
@@ -16,6 +29,7 @@
 #define MLHMMV_H
 
 #include "lib/mlrval.h"
+#include "containers/hash_index.h"
 #include "containers/sllmv.h"
 #include "containers/sllv.h"
 #include "containers/lrec.h"
@@ -25,7 +39,7 @@
 #define MLHMMV_ERROR_KEYLIST_TOO_SHALLOW 0x58a1
 
 // This is made visible here in the API so the unit-tester can be sure to exercise the resize logic.
-#define MLHMMV_INITIAL_ARRAY_LENGTH 16
+#define MLHMMV_SMALL_LEVEL_MAX 8
 
 // ----------------------------------------------------------------
 void mlhmmv_print_terminal(mv_t* pmv, int quote_keys_always, int quote_values_always, FILE* ostream);
@@ -70,15 +84,10 @@ void mlhmmv_xvalues_to_lrecs_lashed(
 
 // ----------------------------------------------------------------
 typedef struct _mlhmmv_level_entry_t {
-	int     ideal_index;
-	mv_t    level_key;
+	mv_t    level_key;                // MT_ABSENT for a removed entry
 	mlhmmv_xvalue_t level_xvalue; // terminal mlrval, or another hashmap
-	struct _mlhmmv_level_entry_t *pprev;
-	struct _mlhmmv_level_entry_t *pnext;
 } mlhmmv_level_entry_t;
 
-typedef unsigned char mlhmmv_level_entry_state_t;
-
 // Store a mlrval into the mlhmmv_xvalue without copying, implicitly transferring
 // ownership of the mlrval's free_flags. This means the mlrval will be freed
 // when the mlhmmv_xvalue is freed, so the caller should make a copy first if
@@ -91,15 +100,28 @@ static inline mlhmmv_xvalue_t mlhmmv_xvalue_wrap_terminal(mv_t val) {
 
 // ----------------------------------------------------------------
 typedef struct _mlhmmv_level_t {
-	int                         num_occupied;
-	int                         num_freed;
-	int                         array_length;
-	mlhmmv_level_entry_t*       entries;
-	mlhmmv_level_entry_state_t* states;
-	mlhmmv_level_entry_t*       phead;
-	mlhmmv_level_entry_t*       ptail;
+	int                   num_occupied;
+	int                   num_used;     // Entries in use or removed
+	int                   capacity;
+	mlhmmv_level_entry_t* entries;
+	hash_index_t*         pindex;       // NULL while the level is small
 } mlhmmv_level_t;
 
+// Iteration in insertion order. Example:
+//   for (mlhmmv_level_entry_t* pe = mlhmmv_level_first(plevel); pe != NULL; pe = mlhmmv_level_next(plevel, pe))
+static inline mlhmmv_level_entry_t* _mlhmmv_level_skip_removed(mlhmmv_level_t* plevel, int position) {
+	for ( ; position < plevel->num_used; position++)
+		if (plevel->entries[position].level_key.type != MT_ABSENT)
+			return &plevel->entries[position];
+	return NULL;
+}
+static inline mlhmmv_level_entry_t* mlhmmv_level_first(mlhmmv_level_t* plevel) {
+	return _mlhmmv_level_skip_removed(plevel, 0);
+}
+static inline mlhmmv_level_entry_t* mlhmmv_level_next(mlhmmv_level_t* plevel, mlhmmv_level_entry_t* pentry) {
+	return _mlhmmv_level_skip_removed(plevel, pentry - plevel->entries + 1);
+}
+
 mlhmmv_level_t* mlhmmv_level_alloc();
 void mlhmmv_level_free(mlhmmv_level_t* plevel);
 
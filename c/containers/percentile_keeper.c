@@ -1,20 +1,57 @@
 #include <string.h>
 #include <stdlib.h>
+#include <math.h>
 #include "lib/mlrutil.h"
 #include "containers/percentile_keeper.h"
 #include "lib/mvfuncs.h"
 
 #define INITIAL_CAPACITY 10000
 #define GROWTH_FACTOR    2.0
+#define SIGN_BIT         0x8000000000000000ULL
+#define INSERTION_SORT_THRESHOLD 16
+
+// ----------------------------------------------------------------
+// Order-preserving maps to unsigned keys. For ints, flip the sign bit. For
+// floats, flip the sign bit of non-negatives, and all the bits of negatives so
+// that larger magnitudes sort lower.
+static inline unsigned long long key_from_int(long long intv) {
+	return (unsigned long long)intv ^ SIGN_BIT;
+}
+static inline long long int_from_key(unsigned long long key) {
+	return (long long)(key ^ SIGN_BIT);
+}
+static inline unsigned long long key_from_float(double fltv) {
+	unsigned long long bits;
+	memcpy(&bits, &fltv, sizeof(bits));
+	return (bits & SIGN_BIT) ? ~bits : bits ^ SIGN_BIT;
+}
+static inline double float_from_key(unsigned long long key) {
+	unsigned long long bits = (key & SIGN_BIT) ? key ^ SIGN_BIT : ~key;
+	double fltv;
+	memcpy(&fltv, &bits, sizeof(fltv));
+	return fltv;
+}
+static inline mv_t mv_from_key(percentile_keeper_t* ppercentile_keeper, unsigned long long key) {
+	return (ppercentile_keeper->mode == PK_INTS)
+		? mv_from_int(int_from_key(key))
+		: mv_from_float(float_from_key(key));
+}
+
+static int key_comparator(const void* pva, const void* pvb);
 
 // ----------------------------------------------------------------
 percentile_keeper_t* percentile_keeper_alloc() {
-	unsigned long long capacity = INITIAL_CAPACITY;
 	percentile_keeper_t* ppercentile_keeper = mlr_malloc_or_die(sizeof(percentile_keeper_t));
-	ppercentile_keeper->data     = mlr_malloc_or_die(capacity*sizeof(mv_t));
-	ppercentile_keeper->size     = 0LL;
-	ppercentile_keeper->capacity = capacity;
-	ppercentile_keeper->sorted   = FALSE;
+	ppercentile_keeper->mode         = PK_EMPTY;
+	ppercentile_keeper->keys         = NULL;
+	ppercentile_keeper->data         = NULL;
+	ppercentile_keeper->size         = 0LL;
+	ppercentile_keeper->capacity     = 0LL;
+	ppercentile_keeper->sorted       = FALSE;
+	ppercentile_keeper->size_at_last_get = 0LL;
+	ppercentile_keeper->int_min      = 0LL;
+	ppercentile_keeper->int_max      = 0LL;
+	ppercentile_keeper->num_selected = 0;
 	return ppercentile_keeper;
 }
 
@@ -22,25 +59,104 @@ percentile_keeper_t* percentile_keeper_alloc() {
 void percentile_keeper_free(percentile_keeper_t* ppercentile_keeper) {
 	if (ppercentile_keeper == NULL)
 		return;
-	for (unsigned long long i = 0; i < ppercentile_keeper->size; i++) {
-		mv_free(&ppercentile_keeper->data[i]);
+	if (ppercentile_keeper->data != NULL) {
+		for (unsigned long long i = 0; i < ppercentile_keeper->size; i++) {
+			mv_free(&ppercentile_keeper->data[i]);
+		}
+		free(ppercentile_keeper->data);
 	}
-	free(ppercentile_keeper->data);
+	free(ppercentile_keeper->keys);
 	ppercentile_keeper->data = NULL;
+	ppercentile_keeper->keys = NULL;
 	ppercentile_keeper->size = 0LL;
 	ppercentile_keeper->capacity = 0LL;
 	free(ppercentile_keeper);
 }
 
 // ----------------------------------------------------------------
+// On the first value which can't be kept as a key. The mv_t array is left as it
+// would have been all along: values up to the last lookup sorted, and the rest
+// in arrival order. Those values were all consistently ordered, so sorting their
+// keys puts them in the same order as mv_xx_comparator would.
+static void percentile_keeper_convert_to_mvs(percentile_keeper_t* ppercentile_keeper) {
+	if (!ppercentile_keeper->sorted)
+		qsort(ppercentile_keeper->keys, ppercentile_keeper->size_at_last_get, sizeof(unsigned long long),
+			key_comparator);
+	ppercentile_keeper->data = mlr_malloc_or_die(ppercentile_keeper->capacity*sizeof(mv_t));
+	for (unsigned long long i = 0; i < ppercentile_keeper->size; i++)
+		ppercentile_keeper->data[i] = mv_from_key(ppercentile_keeper, ppercentile_keeper->keys[i]);
+	free(ppercentile_keeper->keys);
+	ppercentile_keeper->keys = NULL;
+	ppercentile_keeper->mode = PK_MVS;
+}
+
+// mv_ff_cmp takes differences, so NaNs compare equal to everything, and -0.0 to 0.0.
+static inline int float_is_keyable(double fltv) {
+	return !isnan(fltv) && !(fltv == 0.0 && signbit(fltv));
+}
+
+// mv_ii_cmp takes differences too, which can overflow.
+static int int_is_keyable(percentile_keeper_t* ppercentile_keeper, long long intv) {
+	long long lo = (intv < ppercentile_keeper->int_min) ? intv : ppercentile_keeper->int_min;
+	long long hi = (intv > ppercentile_keeper->int_max) ? intv : ppercentile_keeper->int_max;
+	long long diff;
+	if (__builtin_sub_overflow(hi, lo, &diff))
+		return FALSE;
+	ppercentile_keeper->int_min = lo;
+	ppercentile_keeper->int_max = hi;
+	return TRUE;
+}
+
 void percentile_keeper_ingest(percentile_keeper_t* ppercentile_keeper, mv_t value) {
+	switch (ppercentile_keeper->mode) {
+	case PK_EMPTY:
+		if (value.type == MT_INT) {
+			ppercentile_keeper->mode = PK_INTS;
+			ppercentile_keeper->int_min = value.u.intv;
+			ppercentile_keeper->int_max = value.u.intv;
+		} else if (value.type == MT_FLOAT && float_is_keyable(value.u.fltv)) {
+			ppercentile_keeper->mode = PK_FLOATS;
+		} else {
+			ppercentile_keeper->mode = PK_MVS;
+		}
+		break;
+	case PK_INTS:
+		if (value.type != MT_INT || !int_is_keyable(ppercentile_keeper, value.u.intv))
+			percentile_keeper_convert_to_mvs(ppercentile_keeper);
+		break;
+	case PK_FLOATS:
+		if (value.type != MT_FLOAT || !float_is_keyable(value.u.fltv))
+			percentile_keeper_convert_to_mvs(ppercentile_keeper);
+		break;
+	case PK_MVS:
+		break;
+	}
+
 	if (ppercentile_keeper->size >= ppercentile_keeper->capacity) {
-		ppercentile_keeper->capacity = (unsigned long long)(ppercentile_keeper->capacity * GROWTH_FACTOR);
-		ppercentile_keeper->data = (mv_t*)mlr_realloc_or_die(ppercentile_keeper->data,
-			ppercentile_keeper->capacity*sizeof(mv_t));
+		ppercentile_keeper->capacity = (ppercentile_keeper->capacity == 0LL)
+			? INITIAL_CAPACITY
+			: (unsigned long long)(ppercentile_keeper->capacity * GROWTH_FACTOR);
+		if (ppercentile_keeper->mode == PK_MVS)
+			ppercentile_keeper->data = (mv_t*)mlr_realloc_or_die(ppercentile_keeper->data,
+				ppercentile_keeper->capacity*sizeof(mv_t));
+		else
+			ppercentile_keeper->keys = mlr_realloc_or_die(ppercentile_keeper->keys,
+				ppercentile_keeper->capacity*sizeof(unsigned long long));
+	}
+
+	switch (ppercentile_keeper->mode) {
+	case PK_INTS:
+		ppercentile_keeper->keys[ppercentile_keeper->size++] = key_from_int(value.u.intv);
+		break;
+	case PK_FLOATS:
+		ppercentile_keeper->keys[ppercentile_keeper->size++] = key_from_float(value.u.fltv);
+		break;
+	default:
+		ppercentile_keeper->data[ppercentile_keeper->size++] = value;
+		break;
 	}
-	ppercentile_keeper->data[ppercentile_keeper->size++] = value;
 	ppercentile_keeper->sorted = FALSE;
+	ppercentile_keeper->num_selected = 0;
 }
 
 // ================================================================
@@ -225,21 +341,126 @@ static unsigned long long compute_index_non_interpolated(unsigned long long n, d
 	return (unsigned long long)index;
 }
 
-static mv_t get_percentile_linearly_interpolated(mv_t* array, unsigned long long n, double p) {
+// ----------------------------------------------------------------
+// Introselect: quickselect with median-of-three pivots, falling back to a full
+// sort of the subarray if partitioning goes badly. On return, a[k] holds the
+// value it would have if a were sorted, with nothing greater before it and
+// nothing less after it.
+static int key_comparator(const void* pva, const void* pvb) {
+	unsigned long long a = *(const unsigned long long*)pva;
+	unsigned long long b = *(const unsigned long long*)pvb;
+	return (a < b) ? -1 : (a > b) ? 1 : 0;
+}
+
+static inline void swap_keys(unsigned long long* a, long long i, long long j) {
+	unsigned long long t = a[i];
+	a[i] = a[j];
+	a[j] = t;
+}
+
+static void introselect(unsigned long long* a, long long lo, long long hi, long long k) {
+	int depth_limit = 2 * (64 - __builtin_clzll((unsigned long long)(hi - lo + 1)));
+	while (hi - lo > INSERTION_SORT_THRESHOLD) {
+		if (depth_limit-- == 0) {
+			qsort(&a[lo], hi - lo + 1, sizeof(unsigned long long), key_comparator);
+			return;
+		}
+		long long mid = lo + (hi - lo) / 2;
+		if (a[mid] < a[lo])
+			swap_keys(a, mid, lo);
+		if (a[hi] < a[lo])
+			swap_keys(a, hi, lo);
+		if (a[hi] < a[mid])
+			swap_keys(a, hi, mid);
+		unsigned long long pivot = a[mid];
+
+		long long i = lo, j = hi;
+		while (i <= j) {
+			while (a[i] < pivot)
+				i++;
+			while (a[j] > pivot)
+				j--;
+			if (i <= j) {
+				swap_keys(a, i, j);
+				i++;
+				j--;
+			}
+		}
+		// Now a[lo..j] <= pivot, a[i..hi] >= pivot, and anything between equals the pivot.
+		if (k <= j)
+			hi = j;
+		else if (k >= i)
+			lo = i;
+		else
+			return;
+	}
+	for (long long i = lo + 1; i <= hi; i++) {
+		unsigned long long key = a[i];
+		long long j = i - 1;
+		while (j >= lo && a[j] > key) {
+			a[j+1] = a[j];
+			j--;
+		}
+		a[j+1] = key;
+	}
+}
+
+// Each selection leaves its position fixed, with the array partitioned around
+// it, so later selections (p25 after p10, etc.) need only search between the
+// nearest fixed positions. After enough of them, a full sort is cheaper.
+static void percentile_keeper_select(percentile_keeper_t* ppercentile_keeper, long long index) {
+	long long lo = 0;
+	long long hi = ppercentile_keeper->size - 1;
+	for (int i = 0; i < ppercentile_keeper->num_selected; i++) {
+		long long selected = ppercentile_keeper->selected[i];
+		if (selected == index)
+			return;
+		if (selected < index && selected + 1 > lo)
+			lo = selected + 1;
+		if (selected > index && selected - 1 < hi)
+			hi = selected - 1;
+	}
+	if (ppercentile_keeper->num_selected >= PERCENTILE_KEEPER_MAX_SELECTED) {
+		qsort(ppercentile_keeper->keys, ppercentile_keeper->size, sizeof(unsigned long long), key_comparator);
+		ppercentile_keeper->sorted = TRUE;
+		return;
+	}
+	introselect(ppercentile_keeper->keys, lo, hi, index);
+	ppercentile_keeper->selected[ppercentile_keeper->num_selected++] = index;
+}
+
+// Returns the value which would be at the index if the values were sorted.
+static mv_t percentile_keeper_get(percentile_keeper_t* ppercentile_keeper, unsigned long long index) {
+	ppercentile_keeper->size_at_last_get = ppercentile_keeper->size;
+	if (ppercentile_keeper->mode == PK_MVS) {
+		if (!ppercentile_keeper->sorted) {
+			qsort(ppercentile_keeper->data, ppercentile_keeper->size, sizeof(mv_t), mv_xx_comparator);
+			ppercentile_keeper->sorted = TRUE;
+		}
+		return ppercentile_keeper->data[index];
+	} else {
+		if (!ppercentile_keeper->sorted)
+			percentile_keeper_select(ppercentile_keeper, index);
+		return mv_from_key(ppercentile_keeper, ppercentile_keeper->keys[index]);
+	}
+}
+
+static mv_t get_percentile_linearly_interpolated(percentile_keeper_t* ppercentile_keeper, double p) {
+	unsigned long long n = ppercentile_keeper->size;
 	double findex = (p/100.0)*(n-1);
 	if (findex < 0)
 		findex = 0;
 	unsigned long long iindex = (unsigned long long)floor(findex);
 	if (iindex >= n-1) {
-		return array[iindex];
+		return percentile_keeper_get(ppercentile_keeper, iindex);
 	} else {
 		// array[iindex] + frac * (array[iindex+1] - array[iindex]);
 		mv_t frac = mv_from_float(findex - iindex);
-		mv_t* pa = &array[iindex];
-		mv_t* pb = &array[iindex+1];
-		mv_t diff = x_xx_minus_func(pb, pa);
+		mv_t a = percentile_keeper_get(ppercentile_keeper, iindex);
+		mv_t b = percentile_keeper_get(ppercentile_keeper, iindex+1);
+		mv_t diff = x_xx_minus_func(&b, &a);
 		mv_t prod = x_xx_times_func(&frac, &diff);
-		mv_t rv = x_xx_plus_func(pa, &prod);
+		mv_t rv = x_xx_plus_func(&a, &prod);
 		return rv;
 	}
 }
@@ -249,32 +470,27 @@ mv_t percentile_keeper_emit_non_interpolated(percentile_keeper_t* ppercentile_ke
 	if (ppercentile_keeper->size == 0) {
 		return mv_absent();
 	}
-	if (!ppercentile_keeper->sorted) {
-		qsort(ppercentile_keeper->data, ppercentile_keeper->size, sizeof(mv_t), mv_xx_comparator);
-		ppercentile_keeper->sorted = TRUE;
-	}
-	return ppercentile_keeper->data[compute_index_non_interpolated(ppercentile_keeper->size, percentile)];
+	return percentile_keeper_get(ppercentile_keeper,
+		compute_index_non_interpolated(ppercentile_keeper->size, percentile));
 }
 
 mv_t percentile_keeper_emit_linearly_interpolated(percentile_keeper_t* ppercentile_keeper, double percentile) {
 	if (ppercentile_keeper->size == 0) {
 		return mv_absent();
 	}
-	if (!ppercentile_keeper->sorted) {
-		qsort(ppercentile_keeper->data, ppercentile_keeper->size, sizeof(mv_t), mv_xx_comparator);
-		ppercentile_keeper->sorted = TRUE;
-	}
-	return get_percentile_linearly_interpolated(ppercentile_keeper->data, ppercentile_keeper->size, percentile);
+	return get_percentile_linearly_interpolated(ppercentile_keeper, percentile);
 }
 
 // ----------------------------------------------------------------
 void percentile_keeper_print(percentile_keeper_t* ppercentile_keeper) {
 	printf("percentile_keeper dump:\n");
 	for (unsigned long long i = 0; i < ppercentile_keeper->size; i++) {
-		mv_t* pa = &ppercentile_keeper->data[i];
-		if (pa->type == MT_FLOAT)
-			printf("[%02llu] %.8lf\n", i, ppercentile_keeper->data[i].u.fltv);
+		mv_t a = (ppercentile_keeper->mode == PK_MVS)
+			? ppercentile_keeper->data[i]
+			: mv_from_key(ppercentile_keeper, ppercentile_keeper->keys[i]);
+		if (a.type == MT_FLOAT)
+			printf("[%02llu] %.8lf\n", i, a.u.fltv);
 		else
-			printf("[%02llu] %8lld\n", i, ppercentile_keeper->data[i].u.intv);
+			printf("[%02llu] %8lld\n", i, a.u.intv);
 	}
 }
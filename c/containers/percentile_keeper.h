@@ -6,11 +6,35 @@
 #define PERCENTILE_KEEPER_H
 #include "lib/mlrval.h"
 
+// All-int and all-float inputs, which are by far the common case, are kept as
+// packed 64-bit keys which sort in the same order as the values, so lookups
+// don't go through mv_xx_comparator and memory per value is halved. Any other
+// mix falls back to an array of mv_t's. So do inputs which mv_xx_comparator
+// doesn't order consistently, so that their output is as it always was: NaNs,
+// negative zeroes (which compare equal to zero), and ints whose differences
+// overflow.
+typedef enum _percentile_keeper_mode_t {
+	PK_EMPTY,
+	PK_INTS,
+	PK_FLOATS,
+	PK_MVS,
+} percentile_keeper_mode_t;
+
+// Positions already in their sorted places, from selections since the last ingest.
+#define PERCENTILE_KEEPER_MAX_SELECTED 16
+
 typedef struct _percentile_keeper_t {
-	mv_t* data;
+	percentile_keeper_mode_t mode;
+	unsigned long long* keys; // For PK_INTS and PK_FLOATS
+	mv_t* data;               // For PK_MVS
 	unsigned long long size;
 	unsigned long long capacity;
 	int   sorted;
+	unsigned long long size_at_last_get; // Values before this were sorted in the mv_t array
+	long long int_min;                   // For PK_INTS
+	long long int_max;
+	unsigned long long selected[PERCENTILE_KEEPER_MAX_SELECTED];
+	int   num_selected;
 } percentile_keeper_t;
 
 percentile_keeper_t* percentile_keeper_alloc();
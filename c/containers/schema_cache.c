@@ -0,0 +1,138 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lib/mlr_globals.h"
+#include "lib/mlrutil.h"
+#include "containers/schema_cache.h"
+
+#define INITIAL_ARRAY_LENGTH 16
+
+// ----------------------------------------------------------------
+static void schema_cache_init(schema_cache_t* pcache) {
+	hash_index_init(&pcache->index, INITIAL_ARRAY_LENGTH);
+	pcache->num_used      = 0;
+	pcache->array_length  = hash_index_max_load(pcache->index.capacity);
+	pcache->array         = mlr_malloc_or_die(sizeof(schema_cache_entry_t) * pcache->array_length);
+	pcache->last_position = -1;
+}
+
+schema_cache_t* schema_cache_alloc(schema_cache_free_func_t* pfree_func) {
+	schema_cache_t* pcache = mlr_malloc_or_die(sizeof(schema_cache_t));
+	schema_cache_init(pcache);
+	pcache->pfree_func       = pfree_func;
+	pcache->miss_hash        = 0;
+	pcache->miss_num_fields  = 0;
+	pcache->miss_field_names = NULL;
+	return pcache;
+}
+
+static void free_field_names(int num_fields, char** field_names) {
+	if (field_names == NULL)
+		return;
+	for (int i = 0; i < num_fields; i++)
+		free(field_names[i]);
+	free(field_names);
+}
+
+static void schema_cache_release_entries(schema_cache_t* pcache) {
+	for (int pos = 0; pos < pcache->num_used; pos++) {
+		schema_cache_entry_t* pe = &pcache->array[pos];
+		free_field_names(pe->num_fields, pe->field_names);
+		if (pcache->pfree_func != NULL)
+			pcache->pfree_func(pe->pvvalue);
+	}
+	free(pcache->array);
+	hash_index_free(&pcache->index);
+}
+
+void schema_cache_free(schema_cache_t* pcache) {
+	if (pcache == NULL)
+		return;
+	schema_cache_release_entries(pcache);
+	free_field_names(pcache->miss_num_fields, pcache->miss_field_names);
+	free(pcache);
+}
+
+// ----------------------------------------------------------------
+static unsigned schema_hash(lrec_t* prec) {
+	unsigned hash = prec->field_count;
+	for (lrece_t* pe = prec->phead; pe != NULL; pe = pe->pnext)
+		hash = hash * 31 + mlr_string_hash_func(pe->key);
+	return hash;
+}
+
+static int schema_matches(schema_cache_entry_t* pe, lrec_t* prec) {
+	if (pe->num_fields != prec->field_count)
+		return FALSE;
+	int i = 0;
+	for (lrece_t* pf = prec->phead; pf != NULL; pf = pf->pnext, i++)
+		if (!streq(pe->field_names[i], pf->key))
+			return FALSE;
+	return TRUE;
+}
+
+void* schema_cache_get(schema_cache_t* pcache, lrec_t* prec) {
+	if (pcache->last_position >= 0 && schema_matches(&pcache->array[pcache->last_position], prec))
+		return pcache->array[pcache->last_position].pvvalue;
+
+	unsigned hash = schema_hash(prec);
+	hash_index_probe_t probe;
+	hash_index_probe_start(&pcache->index, hash, &probe);
+	for (int pos = hash_index_probe_next(&pcache->index, &probe); pos >= 0;
+		pos = hash_index_probe_next(&pcache->index, &probe))
+	{
+		schema_cache_entry_t* pe = &pcache->array[pos];
+		if (pe->hash == hash && schema_matches(pe, prec)) {
+			pcache->last_position = pos;
+			return pe->pvvalue;
+		}
+	}
+
+	free_field_names(pcache->miss_num_fields, pcache->miss_field_names);
+	pcache->miss_hash        = hash;
+	pcache->miss_num_fields  = prec->field_count;
+	pcache->miss_field_names = mlr_malloc_or_die((prec->field_count + 1) * sizeof(char*)); // +1 for empty records
+	int i = 0;
+	for (lrece_t* pe = prec->phead; pe != NULL; pe = pe->pnext, i++)
+		pcache->miss_field_names[i] = mlr_strdup_or_die(pe->key);
+	return NULL;
+}
+
+// ----------------------------------------------------------------
+// Entries are never removed individually, so there are no holes to squeeze out.
+static void schema_cache_enlarge(schema_cache_t* pcache) {
+	int new_capacity = 2 * pcache->index.capacity;
+	hash_index_free(&pcache->index);
+	hash_index_init(&pcache->index, new_capacity);
+	pcache->array_length = hash_index_max_load(pcache->index.capacity);
+	pcache->array = mlr_realloc_or_die(pcache->array, sizeof(schema_cache_entry_t) * pcache->array_length);
+	for (int pos = 0; pos < pcache->num_used; pos++)
+		hash_index_insert(&pcache->index, pcache->array[pos].hash, pos);
+}
+
+void schema_cache_put(schema_cache_t* pcache, void* pvvalue) {
+	MLR_INTERNAL_CODING_ERROR_IF(pcache->miss_field_names == NULL);
+	if (pcache->num_used >= SCHEMA_CACHE_MAX_ENTRIES) {
+		schema_cache_release_entries(pcache);
+		schema_cache_init(pcache);
+	} else if (pcache->num_used >= pcache->array_length || hash_index_is_full(&pcache->index)) {
+		schema_cache_enlarge(pcache);
+	}
+
+	schema_cache_entry_t* pe = &pcache->array[pcache->num_used];
+	pe->hash        = pcache->miss_hash;
+	pe->num_fields  = pcache->miss_num_fields;
+	pe->field_names = pcache->miss_field_names;
+	pe->pvvalue     = pvvalue;
+	hash_index_insert(&pcache->index, pe->hash, pcache->num_used);
+	pcache->last_position = pcache->num_used;
+	pcache->num_used++;
+
+	pcache->miss_num_fields  = 0;
+	pcache->miss_field_names = NULL;
+}
+
+int schema_cache_size(schema_cache_t* pcache) {
+	return pcache->num_used;
+}
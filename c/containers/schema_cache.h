@@ -0,0 +1,59 @@
+// ================================================================
+// Memoizes per-schema results for mappers whose per-record decisions depend
+// only on the record's field names, such as regex matches on them. The schema
+// is the ordered list of field names. In most data the field names repeat
+// record after record, so the decisions are made once per distinct schema and
+// then looked up: a string comparison per field against the previous record's
+// schema, or a hash lookup when the schema has changed.
+//
+// Entries are stored densely, with their hashes, over a Swiss-table-style
+// index: see hash_index.h. Since data with a field name per record (e.g. IDs
+// as keys) would grow the cache without bound, it's cleared when it fills up.
+// ================================================================
+
+#ifndef SCHEMA_CACHE_H
+#define SCHEMA_CACHE_H
+
+#include "containers/lrec.h"
+#include "containers/hash_index.h"
+
+#define SCHEMA_CACHE_MAX_ENTRIES 1024
+
+typedef void schema_cache_free_func_t(void* pvvalue);
+
+typedef struct _schema_cache_entry_t {
+	unsigned hash;
+	int      num_fields;
+	char**   field_names;
+	void*    pvvalue;
+} schema_cache_entry_t;
+
+typedef struct _schema_cache_t {
+	int                       num_used;
+	int                       array_length;
+	schema_cache_entry_t*     array;
+	hash_index_t              index;
+	int                       last_position; // Of the most recent hit or put, or -1
+	schema_cache_free_func_t* pfree_func;
+
+	// Schema of the most recent miss, kept for schema_cache_put.
+	unsigned miss_hash;
+	int      miss_num_fields;
+	char**   miss_field_names;
+} schema_cache_t;
+
+// The free function, if non-null, is applied to values when the cache is
+// cleared or freed.
+schema_cache_t* schema_cache_alloc(schema_cache_free_func_t* pfree_func);
+void            schema_cache_free(schema_cache_t* pcache);
+
+// Returns the value stored for the record's field names, or NULL if there is
+// none. On a miss the field names are copied, so the caller may then modify the
+// record before calling schema_cache_put.
+void* schema_cache_get(schema_cache_t* pcache, lrec_t* prec);
+// Stores the value for the field names of the most recent miss.
+void  schema_cache_put(schema_cache_t* pcache, void* pvvalue);
+
+int   schema_cache_size(schema_cache_t* pcache);
+
+#endif // SCHEMA_CACHE_H
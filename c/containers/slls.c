@@ -175,19 +175,13 @@ void slls_reverse(slls_t* plist) {
 }
 
 // ----------------------------------------------------------------
+// string_array_hash_func must agree with this.
 int slls_hash_func(slls_t *plist) {
-	unsigned long hash = 5381;
-	int c;
-
-	for (sllse_t* pe = plist->phead; pe != NULL; pe = pe->pnext) {
-		char* str = pe->value;
-		while ((c = *str++) != 0)
-			hash = ((hash << 5) + hash) + c; /* hash * 33 + c */
-		// So that ["ab","c"] doesn't hash to the same as ["a","bc"]:
-		hash = ((hash << 5) + hash) + ',';
-	}
-
-	return (int)hash;
+	unsigned long long hash = 0;
+	// Seeding chains in each string's length, so ["ab","c"] doesn't hash to the same as ["a","bc"].
+	for (sllse_t* pe = plist->phead; pe != NULL; pe = pe->pnext)
+		hash = mlr_seeded_string_hash_func(pe->value, hash);
+	return (int)(hash ^ (hash >> 32));
 }
 
 // ----------------------------------------------------------------
@@ -0,0 +1,166 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lib/mlrutil.h"
+#include "lib/mlr_globals.h"
+#include "containers/space_saving.h"
+
+// ----------------------------------------------------------------
+space_saving_t* space_saving_alloc(int capacity) {
+	if (capacity < 1) {
+		fprintf(stderr, "%s: Space-Saving capacity must be positive; got %d.\n",
+			MLR_GLOBALS.bargv0, capacity);
+		exit(1);
+	}
+	space_saving_t* pss = mlr_malloc_or_die(sizeof(space_saving_t));
+	pss->capacity     = capacity;
+	pss->size         = 0;
+	pss->num_ingested = 0LL;
+	pss->entries      = mlr_malloc_or_die(capacity * sizeof(space_saving_entry_t));
+	pss->heap         = mlr_malloc_or_die(capacity * sizeof(int));
+	// Room for the tombstones left by evictions, so the index is rebuilt only occasionally.
+	hash_index_init(&pss->index, 2 * capacity);
+	return pss;
+}
+
+void space_saving_free(space_saving_t* pss) {
+	if (pss == NULL)
+		return;
+	for (int i = 0; i < pss->size; i++)
+		slls_free(pss->entries[i].key);
+	free(pss->entries);
+	free(pss->heap);
+	hash_index_free(&pss->index);
+	free(pss);
+}
+
+// ----------------------------------------------------------------
+static int slls_equals_string_array(slls_t* plist, string_array_t* parray) {
+	if (plist->length != parray->length)
+		return FALSE;
+	int i = 0;
+	for (sllse_t* pe = plist->phead; pe != NULL; pe = pe->pnext, i++) {
+		if (!streq(pe->value, parray->strings[i]))
+			return FALSE;
+	}
+	return TRUE;
+}
+
+static slls_t* slls_copy_of_string_array(string_array_t* pvalues) {
+	slls_t* pkey = slls_alloc();
+	for (int i = 0; i < pvalues->length; i++)
+		slls_append_with_free(pkey, mlr_strdup_or_die(pvalues->strings[i]));
+	return pkey;
+}
+
+static void index_insert(space_saving_t* pss, unsigned hash, int position) {
+	if (hash_index_is_full(&pss->index)) {
+		// Clears tombstones. The entry being inserted isn't there yet.
+		hash_index_clear(&pss->index);
+		for (int i = 0; i < pss->size; i++)
+			if (i != position)
+				hash_index_insert(&pss->index, pss->entries[i].hash, i);
+	}
+	hash_index_insert(&pss->index, hash, position);
+}
+
+// ----------------------------------------------------------------
+static inline void heap_set(space_saving_t* pss, int heap_position, int entry_position) {
+	pss->heap[heap_position] = entry_position;
+	pss->entries[entry_position].heap_position = heap_position;
+}
+
+// Counts only go up, and new entries come in at the bottom of the heap with the
+// least possible count, so only sifting down is needed.
+static void sift_down(space_saving_t* pss, int i) {
+	int n = pss->size;
+	while (TRUE) {
+		int least = i;
+		int left  = 2*i + 1;
+		int right = 2*i + 2;
+		if (left < n && pss->entries[pss->heap[left]].count < pss->entries[pss->heap[least]].count)
+			least = left;
+		if (right < n && pss->entries[pss->heap[right]].count < pss->entries[pss->heap[least]].count)
+			least = right;
+		if (least == i)
+			break;
+		int tmp = pss->heap[i];
+		heap_set(pss, i, pss->heap[least]);
+		heap_set(pss, least, tmp);
+		i = least;
+	}
+}
+
+// ----------------------------------------------------------------
+void space_saving_ingest(space_saving_t* pss, string_array_t* pvalues) {
+	unsigned hash = string_array_hash_func(pvalues);
+	pss->num_ingested++;
+
+	hash_index_probe_t probe;
+	hash_index_probe_start(&pss->index, hash, &probe);
+	for (int pos = hash_index_probe_next(&pss->index, &probe); pos >= 0;
+		pos = hash_index_probe_next(&pss->index, &probe))
+	{
+		space_saving_entry_t* pe = &pss->entries[pos];
+		if (pe->hash == hash && slls_equals_string_array(pe->key, pvalues)) {
+			pe->count++;
+			sift_down(pss, pe->heap_position);
+			return;
+		}
+	}
+
+	if (pss->size < pss->capacity) {
+		// A count of one is the least possible, so the new entry's place at the
+		// bottom of the heap is already a valid one.
+		int pos = pss->size++;
+		space_saving_entry_t* pe = &pss->entries[pos];
+		pe->hash  = hash;
+		pe->key   = slls_copy_of_string_array(pvalues);
+		pe->count = 1LL;
+		pe->error = 0LL;
+		heap_set(pss, pos, pos);
+		index_insert(pss, hash, pos);
+	} else {
+		int pos = pss->heap[0];
+		space_saving_entry_t* pe = &pss->entries[pos];
+		hash_index_remove(&pss->index, pe->hash, pos);
+		slls_free(pe->key);
+		pe->hash  = hash;
+		pe->key   = slls_copy_of_string_array(pvalues);
+		pe->error = pe->count;
+		pe->count++;
+		index_insert(pss, hash, pos);
+		sift_down(pss, 0);
+	}
+}
+
+// ----------------------------------------------------------------
+static int entry_cmp(const void* pva, const void* pvb) {
+	const space_saving_entry_t* pa = *(space_saving_entry_t* const*)pva;
+	const space_saving_entry_t* pb = *(space_saving_entry_t* const*)pvb;
+	if (pa->count != pb->count)
+		return (pa->count > pb->count) ? -1 : 1;
+	if (pa->error != pb->error)
+		return (pa->error < pb->error) ? -1 : 1;
+	return (pa < pb) ? -1 : (pa > pb) ? 1 : 0;
+}
+
+space_saving_entry_t** space_saving_sorted_entries(space_saving_t* pss) {
+	space_saving_entry_t** pentries = mlr_malloc_or_die((pss->size + 1) * sizeof(space_saving_entry_t*));
+	for (int i = 0; i < pss->size; i++)
+		pentries[i] = &pss->entries[i];
+	qsort(pentries, pss->size, sizeof(space_saving_entry_t*), entry_cmp);
+	return pentries;
+}
+
+// ----------------------------------------------------------------
+void space_saving_print(space_saving_t* pss) {
+	printf("capacity=%d size=%d num_ingested=%lld\n", pss->capacity, pss->size, pss->num_ingested);
+	space_saving_entry_t** pentries = space_saving_sorted_entries(pss);
+	for (int i = 0; i < pss->size; i++) {
+		printf("  [%d] count=%lld error=%lld key=", i, pentries[i]->count, pentries[i]->error);
+		slls_print(pentries[i]->key);
+		printf("\n");
+	}
+	free(pentries);
+}
@@ -0,0 +1,55 @@
+// ================================================================
+// Approximate most-frequent values in bounded memory, for mlr most-frequent
+// --approx.
+//
+// This is Metwally et al.'s Space-Saving algorithm. At most capacity values are
+// tracked, each with a count. A value not being tracked, once all the counters
+// are in use, takes over the counter with the least count, and that count
+// plus one becomes its estimate; the count it took over is recorded as its
+// error. So each estimate is an overcount by at most its error, which is at
+// most (number ingested) / capacity, and any value occurring more often than
+// that is sure to be tracked.
+//
+// Counters are kept in a min-heap by count, with a hash index (see
+// hash_index.h) from values to counters, so each ingest is O(log capacity).
+// ================================================================
+
+#ifndef SPACE_SAVING_H
+#define SPACE_SAVING_H
+
+#include "containers/slls.h"
+#include "containers/hash_index.h"
+#include "lib/string_array.h"
+
+typedef struct _space_saving_entry_t {
+	unsigned  hash;
+	slls_t*   key;
+	long long count; // Estimate: never less than the true count
+	long long error; // count - error is never more than the true count
+	int       heap_position;
+} space_saving_entry_t;
+
+typedef struct _space_saving_t {
+	int capacity;
+	int size;
+	long long num_ingested;
+	space_saving_entry_t* entries; // Positions are stable; values are replaced in place
+	int* heap;                     // Entry positions, least count first
+	hash_index_t index;
+} space_saving_t;
+
+space_saving_t* space_saving_alloc(int capacity);
+void space_saving_free(space_saving_t* pss);
+
+// The values are copied if they're newly tracked.
+void space_saving_ingest(space_saving_t* pss, string_array_t* pvalues);
+
+// Returns a newly allocated array of pointers to the size entries, by decreasing
+// count. Ties go to the lesser error, then to the earlier-tracked. The caller
+// should free the array but not the entries.
+space_saving_entry_t** space_saving_sorted_entries(space_saving_t* pss);
+
+// For debug/test
+void space_saving_print(space_saving_t* pss);
+
+#endif // SPACE_SAVING_H
@@ -0,0 +1,106 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "lib/mlrutil.h"
+#include "lib/mlr_globals.h"
+#include "containers/spill_file.h"
+
+// ----------------------------------------------------------------
+spill_file_t* spill_file_alloc() {
+	char* dir = getenv("TMPDIR");
+	if (dir == NULL || *dir == 0)
+		dir = "/tmp";
+	char* path = mlr_paste_2_strings(dir, "/mlr-spill-XXXXXX");
+	int fd = mkstemp(path);
+	if (fd < 0) {
+		fprintf(stderr, "%s: could not create temporary file in %s.\n", MLR_GLOBALS.bargv0, dir);
+		perror("mkstemp");
+		exit(1);
+	}
+	unlink(path);
+	free(path);
+
+	spill_file_t* psf = mlr_malloc_or_die(sizeof(spill_file_t));
+	psf->fp = fdopen(fd, "w+");
+	if (psf->fp == NULL) {
+		perror("fdopen");
+		exit(1);
+	}
+	psf->num_records = 0LL;
+	psf->num_fields  = 0LL;
+	psf->num_bytes   = 0LL;
+	return psf;
+}
+
+void spill_file_free(spill_file_t* psf) {
+	if (psf == NULL)
+		return;
+	fclose(psf->fp);
+	free(psf);
+}
+
+// ----------------------------------------------------------------
+static void write_or_die(spill_file_t* psf, void* pbuf, size_t length) {
+	if (fwrite(pbuf, 1, length, psf->fp) != length) {
+		fprintf(stderr, "%s: write to temporary file failed.\n", MLR_GLOBALS.bargv0);
+		perror("fwrite");
+		exit(1);
+	}
+	psf->num_bytes += length;
+}
+
+static void write_string(spill_file_t* psf, char* s) {
+	unsigned length = strlen(s);
+	write_or_die(psf, &length, sizeof(length));
+	write_or_die(psf, s, length);
+}
+
+void spill_file_write(spill_file_t* psf, lrec_t* prec) {
+	unsigned field_count = prec->field_count;
+	write_or_die(psf, &field_count, sizeof(field_count));
+	for (lrece_t* pe = prec->phead; pe != NULL; pe = pe->pnext) {
+		write_string(psf, pe->key);
+		write_string(psf, pe->value);
+	}
+	psf->num_records++;
+	psf->num_fields += field_count;
+}
+
+void spill_file_rewind(spill_file_t* psf) {
+	if (fflush(psf->fp) != 0 || fseek(psf->fp, 0L, SEEK_SET) != 0) {
+		fprintf(stderr, "%s: could not rewind temporary file.\n", MLR_GLOBALS.bargv0);
+		perror("fseek");
+		exit(1);
+	}
+}
+
+// ----------------------------------------------------------------
+static void read_or_die(spill_file_t* psf, void* pbuf, size_t length) {
+	if (fread(pbuf, 1, length, psf->fp) != length) {
+		fprintf(stderr, "%s: temporary file is truncated.\n", MLR_GLOBALS.bargv0);
+		exit(1);
+	}
+}
+
+static char* read_string(spill_file_t* psf) {
+	unsigned length;
+	read_or_die(psf, &length, sizeof(length));
+	char* s = mlr_malloc_or_die(length + 1);
+	read_or_die(psf, s, length);
+	s[length] = 0;
+	return s;
+}
+
+lrec_t* spill_file_read(spill_file_t* psf) {
+	unsigned field_count;
+	if (fread(&field_count, 1, sizeof(field_count), psf->fp) != sizeof(field_count))
+		return NULL;
+	lrec_t* prec = lrec_unbacked_alloc();
+	for (unsigned i = 0; i < field_count; i++) {
+		char* key   = read_string(psf);
+		char* value = read_string(psf);
+		lrec_put(prec, key, value, FREE_ENTRY_KEY|FREE_ENTRY_VALUE);
+	}
+	return prec;
+}
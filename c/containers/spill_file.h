@@ -0,0 +1,35 @@
+// ================================================================
+// Temporary file of records, for verbs which must hold more records than
+// they should keep in memory. Records are written in a simple binary format
+// (field count, then length-prefixed keys and values), so anything held in an
+// lrec round-trips exactly, whatever the input and output formats. The file is
+// unlinked as soon as it's created, so it goes away when closed or on exit.
+//
+// Usage: spill_file_write any number of records; spill_file_rewind; then
+// spill_file_read until it returns NULL.
+// ================================================================
+
+#ifndef SPILL_FILE_H
+#define SPILL_FILE_H
+
+#include <stdio.h>
+#include "containers/lrec.h"
+
+typedef struct _spill_file_t {
+	FILE*     fp;
+	long long num_records;
+	long long num_fields;
+	long long num_bytes;
+} spill_file_t;
+
+// The file goes in $TMPDIR if set, else /tmp.
+spill_file_t* spill_file_alloc();
+void spill_file_free(spill_file_t* psf);
+
+// The record is not freed.
+void    spill_file_write(spill_file_t* psf, lrec_t* prec);
+void    spill_file_rewind(spill_file_t* psf);
+// Returns an unbacked record, owned by the caller, or NULL at end of file.
+lrec_t* spill_file_read(spill_file_t* psf);
+
+#endif // SPILL_FILE_H
@@ -0,0 +1,287 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "lib/mlrutil.h"
+#include "lib/mlr_globals.h"
+#include "containers/tdigest.h"
+
+#define INITIAL_CAPACITY 16
+// Merged centroids number somewhat over the compression parameter; the rest of
+// the array is buffer.
+#define BUFFER_FACTOR 5
+
+// ----------------------------------------------------------------
+tdigest_t* tdigest_alloc(double compression) {
+	if (compression < 1.0) {
+		fprintf(stderr, "%s: t-digest compression must be >= 1; got %lf.\n",
+			MLR_GLOBALS.bargv0, compression);
+		exit(1);
+	}
+	tdigest_t* pdigest = mlr_malloc_or_die(sizeof(tdigest_t));
+	pdigest->compression   = compression;
+	pdigest->capacity      = INITIAL_CAPACITY;
+	pdigest->max_capacity  = (1 + BUFFER_FACTOR) * (int)ceil(compression) + INITIAL_CAPACITY;
+	pdigest->centroids     = mlr_malloc_or_die(pdigest->capacity * sizeof(tdigest_centroid_t));
+	pdigest->num_centroids = 0;
+	pdigest->num_merged    = 0;
+	pdigest->total_weight  = 0.0;
+	pdigest->min           = 0.0;
+	pdigest->max           = 0.0;
+	pdigest->exact         = TRUE;
+	pdigest->sorted        = TRUE;
+	return pdigest;
+}
+
+void tdigest_free(tdigest_t* pdigest) {
+	if (pdigest == NULL)
+		return;
+	free(pdigest->centroids);
+	free(pdigest);
+}
+
+// ----------------------------------------------------------------
+static int centroid_cmp(const void* pva, const void* pvb) {
+	const tdigest_centroid_t* pa = pva;
+	const tdigest_centroid_t* pb = pvb;
+	return (pa->mean < pb->mean) ? -1 : (pa->mean > pb->mean) ? 1 : 0;
+}
+
+// The k1 scale function from the t-digest paper, mapping quantile to an index
+// space in which each centroid may span at most one unit. Its slope is steep at
+// the tails, so centroids there are small.
+static double k_from_q(double compression, double q) {
+	return compression / (2.0 * M_PI) * asin(2.0 * q - 1.0);
+}
+static double q_from_k(double compression, double k) {
+	return (sin(k * 2.0 * M_PI / compression) + 1.0) / 2.0;
+}
+
+// Sorts everything and merges adjacent centroids, in place, while they fit in
+// the size limit. A single merging pass leaves only about half as many
+// centroids as the scale function allows, so the limit is taken at twice the
+// compression, as in Dunning's reference implementation.
+static void tdigest_compress(tdigest_t* pdigest) {
+	if (pdigest->num_centroids == 0)
+		return;
+	if (!pdigest->exact && pdigest->num_merged == pdigest->num_centroids)
+		return;
+
+	tdigest_centroid_t* pc = pdigest->centroids;
+	int n = pdigest->num_centroids;
+	double compression = 2.0 * pdigest->compression;
+	double total = pdigest->total_weight;
+	qsort(pc, n, sizeof(tdigest_centroid_t), centroid_cmp);
+
+	int num_out = 0;
+	double weight_so_far = 0.0;
+	double weight_limit = total * q_from_k(compression, k_from_q(compression, 0.0) + 1.0);
+	tdigest_centroid_t current = pc[0];
+	for (int i = 1; i < n; i++) {
+		tdigest_centroid_t next = pc[i];
+		if (weight_so_far + current.weight + next.weight <= weight_limit) {
+			current.weight += next.weight;
+			current.mean += (next.mean - current.mean) * next.weight / current.weight;
+		} else {
+			weight_so_far += current.weight;
+			pc[num_out++] = current;
+			weight_limit = total * q_from_k(compression, k_from_q(compression, weight_so_far / total) + 1.0);
+			current = next;
+		}
+	}
+	pc[num_out++] = current;
+
+	pdigest->num_centroids = num_out;
+	pdigest->num_merged    = num_out;
+	pdigest->exact         = FALSE;
+}
+
+static void tdigest_add(tdigest_t* pdigest, double mean, double weight) {
+	if (pdigest->num_centroids >= pdigest->capacity) {
+		if (pdigest->capacity < pdigest->max_capacity) {
+			pdigest->capacity *= 2;
+			if (pdigest->capacity > pdigest->max_capacity)
+				pdigest->capacity = pdigest->max_capacity;
+		} else {
+			tdigest_compress(pdigest);
+		}
+		// Compression can't fail to make room, short of pathological weights from tdigest_merge.
+		if (pdigest->num_centroids >= pdigest->capacity)
+			pdigest->capacity *= 2;
+		pdigest->centroids = mlr_realloc_or_die(pdigest->centroids,
+			pdigest->capacity * sizeof(tdigest_centroid_t));
+	}
+
+	if (pdigest->total_weight == 0.0) {
+		pdigest->min = mean;
+		pdigest->max = mean;
+	} else {
+		if (mean < pdigest->min)
+			pdigest->min = mean;
+		if (mean > pdigest->max)
+			pdigest->max = mean;
+	}
+	pdigest->centroids[pdigest->num_centroids].mean   = mean;
+	pdigest->centroids[pdigest->num_centroids].weight = weight;
+	pdigest->num_centroids++;
+	pdigest->total_weight += weight;
+	pdigest->sorted = FALSE;
+	if (weight != 1.0)
+		pdigest->exact = FALSE;
+}
+
+// ----------------------------------------------------------------
+void tdigest_ingest(tdigest_t* pdigest, double value) {
+	tdigest_add(pdigest, value, 1.0);
+}
+
+void tdigest_merge(tdigest_t* pdst, tdigest_t* psrc) {
+	if (psrc->total_weight == 0.0)
+		return;
+	double src_min = psrc->min;
+	double src_max = psrc->max;
+	if (!psrc->exact)
+		tdigest_compress(psrc);
+	for (int i = 0; i < psrc->num_centroids; i++)
+		tdigest_add(pdst, psrc->centroids[i].mean, psrc->centroids[i].weight);
+	// Centroid means lie within, but needn't reach, the source's extremes.
+	if (src_min < pdst->min)
+		pdst->min = src_min;
+	if (src_max > pdst->max)
+		pdst->max = src_max;
+}
+
+// ----------------------------------------------------------------
+// Once centroids are merged the individual values are gone. Each centroid is
+// taken to sit at the middle of its run of ranks, with the min at rank 0 and
+// the max at the total weight, and ranks between those points are linearly
+// interpolated.
+static double value_at_rank(tdigest_t* pdigest, double rank) {
+	tdigest_centroid_t* pc = pdigest->centroids;
+	int n = pdigest->num_centroids;
+	if (rank <= 0.0)
+		return pdigest->min;
+	if (rank >= pdigest->total_weight)
+		return pdigest->max;
+
+	double prev_value = pdigest->min;
+	double prev_rank  = 0.0;
+	double cumulative = 0.0;
+	for (int i = 0; i < n; i++) {
+		double center_rank = cumulative + pc[i].weight / 2.0;
+		if (rank <= center_rank) {
+			double t = (rank - prev_rank) / (center_rank - prev_rank);
+			return prev_value + t * (pc[i].mean - prev_value);
+		}
+		cumulative += pc[i].weight;
+		prev_value = pc[i].mean;
+		prev_rank  = center_rank;
+	}
+	double t = (rank - prev_rank) / (pdigest->total_weight - prev_rank);
+	return prev_value + t * (pdigest->max - prev_value);
+}
+
+static double rank_at_value(tdigest_t* pdigest, double value) {
+	tdigest_centroid_t* pc = pdigest->centroids;
+	int n = pdigest->num_centroids;
+	if (value <= pdigest->min)
+		return 0.0;
+	if (value > pdigest->max)
+		return pdigest->total_weight;
+
+	double prev_value = pdigest->min;
+	double prev_rank  = 0.0;
+	double cumulative = 0.0;
+	for (int i = 0; i < n; i++) {
+		double center_rank = cumulative + pc[i].weight / 2.0;
+		if (value <= pc[i].mean) {
+			double t = (value - prev_value) / (pc[i].mean - prev_value);
+			return prev_rank + t * (center_rank - prev_rank);
+		}
+		cumulative += pc[i].weight;
+		prev_value = pc[i].mean;
+		prev_rank  = center_rank;
+	}
+	double t = (value - prev_value) / (pdigest->max - prev_value);
+	return prev_rank + t * (pdigest->total_weight - prev_rank);
+}
+
+static void tdigest_sort_exact(tdigest_t* pdigest) {
+	if (!pdigest->sorted) {
+		qsort(pdigest->centroids, pdigest->num_centroids, sizeof(tdigest_centroid_t), centroid_cmp);
+		pdigest->sorted = TRUE;
+	}
+}
+
+// ----------------------------------------------------------------
+// While exact, these index the same way as percentile_keeper.c; see there for discussion.
+double tdigest_emit_non_interpolated(tdigest_t* pdigest, double percentile) {
+	if (pdigest->exact) {
+		tdigest_sort_exact(pdigest);
+		long long n = pdigest->num_centroids;
+		long long index = percentile*n/100.0;
+		if (index >= n)
+			index = n-1;
+		if (index < 0)
+			index = 0;
+		return pdigest->centroids[index].mean;
+	} else {
+		tdigest_compress(pdigest);
+		return value_at_rank(pdigest, (percentile/100.0) * pdigest->total_weight);
+	}
+}
+
+double tdigest_emit_linearly_interpolated(tdigest_t* pdigest, double percentile) {
+	if (pdigest->exact) {
+		tdigest_sort_exact(pdigest);
+		long long n = pdigest->num_centroids;
+		double findex = (percentile/100.0)*(n-1);
+		if (findex < 0)
+			findex = 0;
+		long long iindex = (long long)floor(findex);
+		if (iindex >= n-1)
+			return pdigest->centroids[n-1].mean;
+		double a = pdigest->centroids[iindex].mean;
+		double b = pdigest->centroids[iindex+1].mean;
+		return a + (findex - iindex) * (b - a);
+	} else {
+		tdigest_compress(pdigest);
+		// Value k of n (from zero) sits at rank k + 1/2, so the first and last values are the tracked
+		// min and max.
+		double rank = (percentile/100.0) * (pdigest->total_weight - 1.0) + 0.5;
+		if (rank <= 0.5)
+			return pdigest->min;
+		if (rank >= pdigest->total_weight - 0.5)
+			return pdigest->max;
+		return value_at_rank(pdigest, rank);
+	}
+}
+
+// ----------------------------------------------------------------
+double tdigest_cdf(tdigest_t* pdigest, double x) {
+	if (pdigest->total_weight == 0.0)
+		return 0.0;
+	if (pdigest->exact) {
+		tdigest_sort_exact(pdigest);
+		int lo = 0, hi = pdigest->num_centroids;
+		while (lo < hi) {
+			int mid = lo + (hi - lo) / 2;
+			if (pdigest->centroids[mid].mean < x)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		return lo / pdigest->total_weight;
+	} else {
+		tdigest_compress(pdigest);
+		return rank_at_value(pdigest, x) / pdigest->total_weight;
+	}
+}
+
+// ----------------------------------------------------------------
+void tdigest_print(tdigest_t* pdigest) {
+	printf("compression=%lf count=%lf min=%lf max=%lf exact=%d num_centroids=%d num_merged=%d\n",
+		pdigest->compression, pdigest->total_weight, pdigest->min, pdigest->max,
+		pdigest->exact, pdigest->num_centroids, pdigest->num_merged);
+	for (int i = 0; i < pdigest->num_centroids; i++)
+		printf("  [%d] mean=%lf weight=%lf\n", i, pdigest->centroids[i].mean, pdigest->centroids[i].weight);
+}
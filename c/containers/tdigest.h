@@ -0,0 +1,72 @@
+// ================================================================
+// Approximate percentiles in bounded memory, for mlr stats1 p50~ et al. and
+// mlr histogram --auto --approx.
+//
+// This is Dunning's merging t-digest. Values are buffered; when the buffer is
+// full it is sorted and merged into a list of centroids (mean and weight), with
+// adjacent centroids combined as long as they stay within a size limit which is
+// small near the tails and large near the median. So extreme percentiles stay
+// accurate while the number of centroids is a small multiple of the
+// compression parameter, however many values are ingested. Digests are
+// mergeable: see tdigest_merge.
+//
+// Until the buffer first fills up, nothing has been merged and the digest
+// holds the values themselves, so for small inputs the percentiles are the same
+// as percentile_keeper's.
+// ================================================================
+
+#ifndef TDIGEST_H
+#define TDIGEST_H
+
+#define TDIGEST_DEFAULT_COMPRESSION 100.0
+
+typedef struct _tdigest_centroid_t {
+	double mean;
+	double weight;
+} tdigest_centroid_t;
+
+typedef struct _tdigest_t {
+	double compression;
+	// Entries [0, num_merged) are merged centroids in sorted order; entries
+	// [num_merged, num_centroids) are values (or centroids from tdigest_merge)
+	// not yet merged in.
+	tdigest_centroid_t* centroids;
+	int    num_centroids;
+	int    num_merged;
+	int    capacity;
+	int    max_capacity;
+	double total_weight;
+	double min;
+	double max;
+	int    exact;  // TRUE until the first merge
+	int    sorted; // Only used while exact
+} tdigest_t;
+
+tdigest_t* tdigest_alloc(double compression);
+void tdigest_free(tdigest_t* pdigest);
+void tdigest_ingest(tdigest_t* pdigest, double value);
+// Adds psrc's centroids into pdst. psrc is unmodified except for merging in its own buffer.
+void tdigest_merge(tdigest_t* pdst, tdigest_t* psrc);
+
+static inline double tdigest_count(tdigest_t* pdigest) {
+	return pdigest->total_weight;
+}
+// If TRUE then the centroids are exactly the ingested values, each with weight 1.
+static inline int tdigest_is_exact(tdigest_t* pdigest) {
+	return pdigest->exact;
+}
+
+// Percentile is in [0,100]. Non-interpolated matches percentile_keeper_emit_non_interpolated
+// (R's type=1) while the digest is exact; likewise interpolated for type=7. The
+// digest must be non-empty.
+double tdigest_emit_non_interpolated(tdigest_t* pdigest, double percentile);
+double tdigest_emit_linearly_interpolated(tdigest_t* pdigest, double percentile);
+typedef double tdigest_emitter_t(tdigest_t* pdigest, double percentile);
+
+// Approximate fraction of the ingested values which are less than x.
+double tdigest_cdf(tdigest_t* pdigest, double x);
+
+// For debug/test
+void tdigest_print(tdigest_t* pdigest);
+
+#endif // TDIGEST_H
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
 #include "lib/mlrutil.h"
 #include "containers/top_keeper.h"
 #include "lib/mvfuncs.h"
@@ -9,8 +10,14 @@ top_keeper_t* top_keeper_alloc(int capacity) {
 	top_keeper_t* ptop_keeper = mlr_malloc_or_die(sizeof(top_keeper_t));
 	ptop_keeper->top_values   = mlr_malloc_or_die(capacity*sizeof(mv_t));
 	ptop_keeper->top_precords = mlr_malloc_or_die(capacity*sizeof(lrec_t*));
+	ptop_keeper->nodes        = mlr_malloc_or_die(capacity*sizeof(top_keeper_node_t));
+	ptop_keeper->root         = -1;
+	ptop_keeper->last         = -1;
+	ptop_keeper->seed         = 2463534242U;
+	ptop_keeper->num_nans     = 0;
 	ptop_keeper->size         = 0;
 	ptop_keeper->capacity     = capacity;
+	ptop_keeper->sorted       = TRUE;
 	return ptop_keeper;
 }
 
@@ -20,73 +27,259 @@ void top_keeper_free(top_keeper_t* ptop_keeper) {
 		return;
 	free(ptop_keeper->top_values);
 	free(ptop_keeper->top_precords);
+	free(ptop_keeper->nodes);
 	ptop_keeper->top_values = NULL;
 	ptop_keeper->top_precords = NULL;
+	ptop_keeper->nodes = NULL;
 	ptop_keeper->size = 0;
 	ptop_keeper->capacity = 0;
 	free(ptop_keeper);
 }
 
 // ----------------------------------------------------------------
-// Cases:
-// 1. array size <  capacity
-//    * find destidx
-//    * if destidx == size
-//        put it there
-//      else
-//        shift down & insert
-//      increment size
-//
-// 2. array size == capacity
-//    * find destidx
-//    * if destidx == size
-//        discard
-//      else
-//        shift down & insert
-
-// capacity = 10, size = 6, destidx = 3     capacity = 10, size = 10, destidx = 3
-// [0 #]   [0 #]                            [0 #]   [0 #]
-// [1 #]   [1 #]                            [1 #]   [1 #]
-// [2 #]   [2 #]                            [2 #]   [2 #]
-// [3 #]*  [3 X]                            [3 #]*  [3 X]
-// [4 #]   [4 #]                            [4 #]   [4 #]
-// [5 #]   [5 #]                            [5 #]   [5 #]
-// [6  ]   [6 #]                            [6 #]   [6 #]
-// [7  ]   [7  ]                            [7 #]   [7 #]
-// [8  ]   [8  ]                            [8 #]   [8 #]
-// [9  ]   [9  ]                            [9 #]   [9 #]
+static inline int node_count(top_keeper_t* ptop_keeper, int t) {
+	return (t < 0) ? 0 : ptop_keeper->nodes[t].count;
+}
+
+static inline void update_count(top_keeper_t* ptop_keeper, int t) {
+	top_keeper_node_t* pnode = &ptop_keeper->nodes[t];
+	pnode->count = 1 + node_count(ptop_keeper, pnode->left) + node_count(ptop_keeper, pnode->right);
+}
+
+// The first k positions of subtree t go to *pleft and the rest to *pright.
+static void split(top_keeper_t* ptop_keeper, int t, int k, int* pleft, int* pright) {
+	if (t < 0) {
+		*pleft = *pright = -1;
+		return;
+	}
+	top_keeper_node_t* pnode = &ptop_keeper->nodes[t];
+	int left_count = node_count(ptop_keeper, pnode->left);
+	if (k <= left_count) {
+		split(ptop_keeper, pnode->left, k, pleft, &pnode->left);
+		*pright = t;
+	} else {
+		split(ptop_keeper, pnode->right, k - left_count - 1, &pnode->right, pright);
+		*pleft = t;
+	}
+	update_count(ptop_keeper, t);
+}
+
+// All positions of subtree a come before those of subtree b.
+static int merge(top_keeper_t* ptop_keeper, int a, int b) {
+	if (a < 0)
+		return b;
+	if (b < 0)
+		return a;
+	top_keeper_node_t* pa = &ptop_keeper->nodes[a];
+	top_keeper_node_t* pb = &ptop_keeper->nodes[b];
+	if (pa->priority > pb->priority) {
+		pa->right = merge(ptop_keeper, pa->right, b);
+		update_count(ptop_keeper, a);
+		return a;
+	} else {
+		pb->left = merge(ptop_keeper, a, pb->left);
+		update_count(ptop_keeper, b);
+		return b;
+	}
+}
+
+static mv_t* value_at(top_keeper_t* ptop_keeper, int pos) {
+	int t = ptop_keeper->root;
+	while (TRUE) {
+		top_keeper_node_t* pnode = &ptop_keeper->nodes[t];
+		int left_count = node_count(ptop_keeper, pnode->left);
+		if (pos < left_count) {
+			t = pnode->left;
+		} else if (pos == left_count) {
+			return &pnode->value;
+		} else {
+			pos -= left_count + 1;
+			t = pnode->right;
+		}
+	}
+}
+
+// ----------------------------------------------------------------
+// This is mlr_bsearch_mv_n_for_insert, reading the descending values by
+// position, so that equal values are placed exactly as it places them.
+static int bsearch_for_insert(top_keeper_t* ptop_keeper, mv_t* pvalue) {
+	int size = ptop_keeper->size;
+	int lo = 0;
+	int hi = size-1;
+	int mid = (hi+lo)/2;
+	int newmid;
+
+	if (size == 0)
+		return 0;
+	if (mv_i_nn_gt(pvalue, value_at(ptop_keeper, 0)))
+		return 0;
+	if (mv_i_nn_lt(pvalue, value_at(ptop_keeper, hi)))
+		return size;
+
+	while (lo < hi) {
+		mv_t* pa = value_at(ptop_keeper, mid);
+		if (mv_i_nn_eq(pvalue, pa)) {
+			return mid;
+		}
+		else if (mv_i_nn_gt(pvalue, pa)) {
+			hi = mid;
+			newmid = (hi+lo)/2;
+		}
+		else {
+			lo = mid;
+			newmid = (hi+lo)/2;
+		}
+		if (mid == newmid) {
+			if (mv_i_nn_ge(pvalue, value_at(ptop_keeper, lo)))
+				return lo;
+			else if (mv_i_nn_ge(pvalue, value_at(ptop_keeper, hi)))
+				return hi;
+			else
+				return hi+1;
+		}
+		mid = newmid;
+	}
+
+	return lo;
+}
+
+// The number of values for which pcmp(value, *pvalue) holds, these being a prefix.
+static int count_ranking_above(top_keeper_t* ptop_keeper, mv_t* pvalue, int (*pcmp)(mv_t*, mv_t*)) {
+	int count = 0;
+	int t = ptop_keeper->root;
+	while (t >= 0) {
+		top_keeper_node_t* pnode = &ptop_keeper->nodes[t];
+		if (pcmp(&pnode->value, pvalue)) {
+			count += node_count(ptop_keeper, pnode->left) + 1;
+			t = pnode->right;
+		} else {
+			t = pnode->left;
+		}
+	}
+	return count;
+}
+
+// The same search, without NaNs: the values at positions below num_greater are greater than
+// *pvalue, and those from there below num_greater_or_equal are equal to it. So each
+// comparison above is known from the position alone, and only these two counts need the tree.
+static int bsearch_for_insert_by_counts(top_keeper_t* ptop_keeper, mv_t* pvalue) {
+	int size = ptop_keeper->size;
+	if (size > 0 && mv_i_nn_lt(pvalue, &ptop_keeper->nodes[ptop_keeper->last].value))
+		return size;
+	int num_greater = count_ranking_above(ptop_keeper, pvalue, mv_i_nn_gt);
+	if (num_greater == size)
+		return size;
+	int num_greater_or_equal = count_ranking_above(ptop_keeper, pvalue, mv_i_nn_ge);
+	if (num_greater_or_equal == 0)
+		return 0;
+
+	int lo = 0;
+	int hi = size-1;
+	int mid = (hi+lo)/2;
+	int newmid;
+	while (lo < hi) {
+		if (mid >= num_greater && mid < num_greater_or_equal) {
+			return mid;
+		}
+		else if (mid >= num_greater_or_equal) {
+			hi = mid;
+			newmid = (hi+lo)/2;
+		}
+		else {
+			lo = mid;
+			newmid = (hi+lo)/2;
+		}
+		if (mid == newmid) {
+			if (lo >= num_greater)
+				return lo;
+			else if (hi >= num_greater)
+				return hi;
+			else
+				return hi+1;
+		}
+		mid = newmid;
+	}
+
+	return lo;
+}
+
+// ----------------------------------------------------------------
+static inline int is_nan(mv_t* pvalue) {
+	return pvalue->type == MT_FLOAT && isnan(pvalue->u.fltv);
+}
 
 // Our caller, mapper_top, feeds us records. We keep them or free them.
+// When full, a value going anywhere but last displaces the last one.
 void top_keeper_add(top_keeper_t* ptop_keeper, mv_t value, lrec_t* prec) {
-	int destidx = mlr_bsearch_mv_n_for_insert(ptop_keeper->top_values, ptop_keeper->size, &value);
+	int destidx = (ptop_keeper->num_nans > 0 || is_nan(&value))
+		? bsearch_for_insert(ptop_keeper, &value)
+		: bsearch_for_insert_by_counts(ptop_keeper, &value);
+	int t;
 	if (ptop_keeper->size < ptop_keeper->capacity) {
-		for (int i = ptop_keeper->size-1; i >= destidx; i--) {
-			ptop_keeper->top_values[i+1]   = ptop_keeper->top_values[i];
-			ptop_keeper->top_precords[i+1] = ptop_keeper->top_precords[i];
-		}
-		ptop_keeper->top_values[destidx]   = value;
-		ptop_keeper->top_precords[destidx] = prec;
-		ptop_keeper->size++;
+		t = ptop_keeper->size++;
 	} else {
 		if (destidx >= ptop_keeper->capacity) {
 			lrec_free(prec);
 			return;
 		}
-		lrec_free(ptop_keeper->top_precords[ptop_keeper->size-1]);
-		for (int i = ptop_keeper->size-2; i >= destidx; i--) {
-			ptop_keeper->top_values[i+1]   = ptop_keeper->top_values[i];
-			ptop_keeper->top_precords[i+1] = ptop_keeper->top_precords[i];
-		}
-		ptop_keeper->top_values[destidx]   = value;
-		ptop_keeper->top_precords[destidx] = prec;
+		split(ptop_keeper, ptop_keeper->root, ptop_keeper->size-1, &ptop_keeper->root, &t);
+		lrec_free(ptop_keeper->nodes[t].prec);
+		if (is_nan(&ptop_keeper->nodes[t].value))
+			ptop_keeper->num_nans--;
 	}
+	if (is_nan(&value))
+		ptop_keeper->num_nans++;
+
+	// Xorshift: the priorities only need to keep the tree balanced, and this
+	// keeps the output independent of the process-wide seed.
+	unsigned seed = ptop_keeper->seed;
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	ptop_keeper->seed = seed;
+
+	top_keeper_node_t* pnode = &ptop_keeper->nodes[t];
+	pnode->value    = value;
+	pnode->prec     = prec;
+	pnode->left     = -1;
+	pnode->right    = -1;
+	pnode->count    = 1;
+	pnode->priority = seed;
+
+	int before, after;
+	split(ptop_keeper, ptop_keeper->root, destidx, &before, &after);
+	ptop_keeper->root = merge(ptop_keeper, merge(ptop_keeper, before, t), after);
+	for (t = ptop_keeper->root; ptop_keeper->nodes[t].right >= 0; )
+		t = ptop_keeper->nodes[t].right;
+	ptop_keeper->last = t;
+	ptop_keeper->sorted = FALSE;
+}
+
+// ----------------------------------------------------------------
+static void copy_in_order(top_keeper_t* ptop_keeper, int t, int* pi) {
+	if (t < 0)
+		return;
+	top_keeper_node_t* pnode = &ptop_keeper->nodes[t];
+	copy_in_order(ptop_keeper, pnode->left, pi);
+	ptop_keeper->top_values[*pi]   = pnode->value;
+	ptop_keeper->top_precords[*pi] = pnode->prec;
+	(*pi)++;
+	copy_in_order(ptop_keeper, pnode->right, pi);
+}
+
+void top_keeper_sort(top_keeper_t* ptop_keeper) {
+	if (ptop_keeper->sorted)
+		return;
+	int i = 0;
+	copy_in_order(ptop_keeper, ptop_keeper->root, &i);
+	ptop_keeper->sorted = TRUE;
 }
 
 // ----------------------------------------------------------------
 void top_keeper_print(top_keeper_t* ptop_keeper) {
 	printf("top_keeper dump:\n");
 	for (int i = 0; i < ptop_keeper->size; i++) {
-		mv_t* pvalue = &ptop_keeper->top_values[i];
+		mv_t* pvalue = value_at(ptop_keeper, i);
 		if (pvalue->type == MT_FLOAT)
 			printf("[%02d] %.8lf\n", i, pvalue->u.fltv);
 		else
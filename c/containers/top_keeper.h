@@ -1,5 +1,16 @@
 // ================================================================
-// Data structure for mlr top: just a decorated array.
+// Data structure for mlr top: the kept values in descending order, as a
+// treap indexed by position rather than by value. Each node holds the size of
+// its subtree, so the value at a given position can be found, and a value
+// inserted at a given position, in O(log n) time. top_keeper_sort copies
+// the values into arrays for output.
+//
+// This places each new value just where binary search and insertion into a
+// sorted array would: among equal values, wherever the binary search lands.
+// That keeps the order of tied records the same as a plain sorted array
+// gives, without that array's O(n) shifting per insert. The binary search
+// itself needs only the numbers of kept values greater than, and equal to,
+// the new one, which the tree gives in O(log n) time.
 // ================================================================
 
 #ifndef TOP_KEEPER_H
@@ -7,16 +18,34 @@
 #include "lib/mlrval.h"
 #include "containers/lrec.h"
 
+typedef struct _top_keeper_node_t {
+	mv_t     value;
+	lrec_t*  prec;
+	int      left;     // Node index, or -1
+	int      right;    // Node index, or -1
+	int      count;    // Number of nodes in this subtree
+	unsigned priority; // Random; parents' are greater than children's
+} top_keeper_node_t;
+
 typedef struct _top_keeper_t {
-	mv_t*    top_values;
-	lrec_t** top_precords;
+	mv_t*    top_values;   // Filled by top_keeper_sort
+	lrec_t** top_precords; // Filled by top_keeper_sort
+	top_keeper_node_t* nodes;
+	int      root;
+	int      last;     // Node holding the least value, for quick rejection
+	unsigned seed;
+	int      num_nans; // If any, values aren't totally ordered; see top_keeper.c
 	int      size;
 	int      capacity;
+	int      sorted;
 } top_keeper_t;
 
 top_keeper_t* top_keeper_alloc(int capacity);
 void top_keeper_free(top_keeper_t* ptop_keeper);
 void top_keeper_add(top_keeper_t* ptop_keeper, mv_t value, lrec_t* prec);
+// Must be called before reading top_values and top_precords. Adding more values
+// afterward is allowed.
+void top_keeper_sort(top_keeper_t* ptop_keeper);
 
 // For debug/test
 void top_keeper_print(top_keeper_t* ptop_keeper);
@@ -49,7 +49,7 @@ static int depth_aux(mlhmmv_xvalue_t* pxval) {
 		return 0;
 	} else {
 		int max = 0;
-		for (mlhmmv_level_entry_t* pe = pxval->pnext_level->phead; pe != NULL; pe = pe->pnext) {
+		for (mlhmmv_level_entry_t* pe = mlhmmv_level_first(pxval->pnext_level); pe != NULL; pe = mlhmmv_level_next(pxval->pnext_level, pe)) {
 			int curr = depth_aux(&pe->level_xvalue);
 			max = (curr > max) ? curr : max;
 		}
@@ -76,7 +76,7 @@ static int leafcount_aux(mlhmmv_xvalue_t* pxval) {
 		return 1;
 	} else {
 		int sum = 0;
-		for (mlhmmv_level_entry_t* pe = pxval->pnext_level->phead; pe != NULL; pe = pe->pnext) {
+		for (mlhmmv_level_entry_t* pe = mlhmmv_level_first(pxval->pnext_level); pe != NULL; pe = mlhmmv_level_next(pxval->pnext_level, pe)) {
 			sum += leafcount_aux(&pe->level_xvalue);
 		}
 		return sum;
@@ -104,7 +104,7 @@ boxed_xval_t variadic_mapsum_xfunc(boxed_xval_t* pbxvals, int nxvals) {
 		if (pbxvals[i].xval.is_terminal)
 			continue;
 		mlhmmv_level_t* plevel = pbxvals[i].xval.pnext_level;
-		for (mlhmmv_level_entry_t* pe = plevel->phead; pe != NULL; pe = pe->pnext) {
+		for (mlhmmv_level_entry_t* pe = mlhmmv_level_first(plevel); pe != NULL; pe = mlhmmv_level_next(plevel, pe)) {
 			// xxx do refs/copies correctly
 			mlhmmv_xvalue_t xval_copy = mlhmmv_xvalue_copy(&pe->level_xvalue);
 			sllmve_t e = (sllmve_t) { .value = pe->level_key, .free_flags = 0, .pnext = NULL };
@@ -133,7 +133,7 @@ boxed_xval_t variadic_mapdiff_xfunc(boxed_xval_t* pbxvals, int nxvals) {
 	int i = 0;
 	if (!pbxvals[i].xval.is_terminal) {
 		mlhmmv_level_t* plevel = pbxvals[i].xval.pnext_level;
-		for (mlhmmv_level_entry_t* pe = plevel->phead; pe != NULL; pe = pe->pnext) {
+		for (mlhmmv_level_entry_t* pe = mlhmmv_level_first(plevel); pe != NULL; pe = mlhmmv_level_next(plevel, pe)) {
 			// xxx do refs/copies correctly
 			mlhmmv_xvalue_t xval_copy = mlhmmv_xvalue_copy(&pe->level_xvalue);
 			sllmve_t e = (sllmve_t) { .value = pe->level_key, .free_flags = 0, .pnext = NULL };
@@ -146,7 +146,7 @@ boxed_xval_t variadic_mapdiff_xfunc(boxed_xval_t* pbxvals, int nxvals) {
 	for (i = 1; i < nxvals; i++) {
 		if (!pbxvals[i].xval.is_terminal) {
 			mlhmmv_level_t* plevel = pbxvals[i].xval.pnext_level;
-			for (mlhmmv_level_entry_t* pe = plevel->phead; pe != NULL; pe = pe->pnext) {
+			for (mlhmmv_level_entry_t* pe = mlhmmv_level_first(plevel); pe != NULL; pe = mlhmmv_level_next(plevel, pe)) {
 				sllmve_t e = (sllmve_t) { .value = pe->level_key, .free_flags = 0, .pnext = NULL };
 				mlhmmv_level_remove(diff.pnext_level, &e);
 			}
@@ -381,7 +381,8 @@ boxed_xval_t s_ms_joink_xfunc(boxed_xval_t* pmapval, boxed_xval_t* psepval) {
 	}
 
 	string_builder_t* psb = sb_alloc(SB_JOIN_ALLOC_SIZE);
-	for (mlhmmv_level_entry_t* pentry = pmapval->xval.pnext_level->phead; pentry != NULL; pentry = pentry->pnext) {
+	mlhmmv_level_t* plevel = pmapval->xval.pnext_level;
+	for (mlhmmv_level_entry_t* pentry = mlhmmv_level_first(plevel); pentry != NULL; pentry = mlhmmv_level_next(plevel, pentry)) {
 		// The string_builder object will copy the string so we can point into source string space,
 		// without a copy here, when possible.
 		char free_flags = 0;
@@ -389,7 +390,7 @@ boxed_xval_t s_ms_joink_xfunc(boxed_xval_t* pmapval, boxed_xval_t* psepval) {
 		sb_append_string(psb, sval);
 		if (free_flags)
 			free(sval);
-		if (pentry->pnext != NULL) {
+		if (mlhmmv_level_next(plevel, pentry) != NULL) {
 			sb_append_string(psb, psepval->xval.terminal_mlrval.u.strv);
 		}
 	}
@@ -415,7 +416,8 @@ boxed_xval_t s_ms_joinv_xfunc(boxed_xval_t* pmapval, boxed_xval_t* psepval) {
 	}
 
 	string_builder_t* psb = sb_alloc(SB_JOIN_ALLOC_SIZE);
-	for (mlhmmv_level_entry_t* pentry = pmapval->xval.pnext_level->phead; pentry != NULL; pentry = pentry->pnext) {
+	mlhmmv_level_t* plevel = pmapval->xval.pnext_level;
+	for (mlhmmv_level_entry_t* pentry = mlhmmv_level_first(plevel); pentry != NULL; pentry = mlhmmv_level_next(plevel, pentry)) {
 		if (pentry->level_xvalue.is_terminal) {
 			// The string_builder object will copy the string so we can point into source string space,
 			// without a copy here, when possible.
@@ -424,7 +426,7 @@ boxed_xval_t s_ms_joinv_xfunc(boxed_xval_t* pmapval, boxed_xval_t* psepval) {
 			sb_append_string(psb, sval);
 			if (free_flags)
 				free(sval);
-			if (pentry->pnext != NULL) {
+			if (mlhmmv_level_next(plevel, pentry) != NULL) {
 				sb_append_string(psb, psepval->xval.terminal_mlrval.u.strv);
 			}
 		}
@@ -451,7 +453,8 @@ boxed_xval_t s_mss_joinkv_xfunc(boxed_xval_t* pmapval, boxed_xval_t* ppairsepval
 	}
 
 	string_builder_t* psb = sb_alloc(SB_JOIN_ALLOC_SIZE);
-	for (mlhmmv_level_entry_t* pentry = pmapval->xval.pnext_level->phead; pentry != NULL; pentry = pentry->pnext) {
+	mlhmmv_level_t* plevel = pmapval->xval.pnext_level;
+	for (mlhmmv_level_entry_t* pentry = mlhmmv_level_first(plevel); pentry != NULL; pentry = mlhmmv_level_next(plevel, pentry)) {
 		if (pentry->level_xvalue.is_terminal) {
 			// The string_builder object will copy the string so we can point into source string space,
 			// without a copy here, when possible.
@@ -470,7 +473,7 @@ boxed_xval_t s_mss_joinkv_xfunc(boxed_xval_t* pmapval, boxed_xval_t* ppairsepval
 			if (vfree_flags)
 				free(svval);
 
-			if (pentry->pnext != NULL) {
+			if (mlhmmv_level_next(plevel, pentry) != NULL) {
 				sb_append_string(psb, plistsepval->xval.terminal_mlrval.u.strv);
 			}
 		}
@@ -1,5 +1,7 @@
+#include <string.h>
 #include "lib/mlr_globals.h"
 #include "lib/mlrutil.h"
+#include "lib/mlrregex.h"
 #include "dsl/function_manager.h"
 #include "dsl/context_flags.h"
 #include "dsl/rval_evaluators.h"
@@ -54,6 +56,10 @@ static rval_evaluator_t* fmgr_alloc_evaluator_from_binary_func_name(
 	char* function_name,
 	rval_evaluator_t* parg1, rval_evaluator_t* parg2);
 
+static rval_evaluator_t* fmgr_alloc_typed_evaluator_from_binary_func_name(
+	char* function_name,
+	rval_evaluator_t* parg1, rval_evaluator_t* parg2, int type_mask1, int type_mask2);
+
 static rval_evaluator_t* fmgr_alloc_evaluator_from_binary_regex_arg2_func_name(
 	char* function_name,
 	rval_evaluator_t* parg1, char* regex_string, int ignore_case);
@@ -897,6 +903,49 @@ static rxval_evaluator_t* construct_udf_defsite_xevaluator(
 	}
 }
 
+// ----------------------------------------------------------------
+// String-function chains such as 'toupper($a . "-" . $b)': see rval_evaluator_alloc_from_string_chain.
+// Links are built directly rather than via provisional callsites since built-in function names can't be
+// overridden by UDFs.
+static int is_string_chain_link(mlr_dsl_ast_node_t* pnode) {
+	if (pnode->type != MD_AST_NODE_TYPE_FUNCTION_CALLSITE && pnode->type != MD_AST_NODE_TYPE_OPERATOR)
+		return FALSE;
+	switch (pnode->pchildren->length) {
+	case 1:
+		return streq(pnode->text, "tolower") || streq(pnode->text, "toupper");
+	case 2:
+		return streq(pnode->text, ".");
+	default:
+		return FALSE;
+	}
+}
+
+static int has_string_chain_link_argument(mlr_dsl_ast_node_t* pnode) {
+	for (sllve_t* pe = pnode->pchildren->phead; pe != NULL; pe = pe->pnext)
+		if (is_string_chain_link(pe->pvvalue))
+			return TRUE;
+	return FALSE;
+}
+
+static rval_evaluator_t* fmgr_alloc_string_chain_link(fmgr_t* pfmgr, mlr_dsl_ast_node_t* pnode,
+	int type_inferencing, int context_flags)
+{
+	rval_evaluator_t* pargs[2];
+	int i = 0;
+	for (sllve_t* pe = pnode->pchildren->phead; pe != NULL; pe = pe->pnext, i++) {
+		mlr_dsl_ast_node_t* pchild = pe->pvvalue;
+		if (is_string_chain_link(pchild))
+			pargs[i] = fmgr_alloc_string_chain_link(pfmgr, pchild, type_inferencing, context_flags);
+		else
+			pargs[i] = rval_evaluator_alloc_from_ast(pchild, pfmgr, type_inferencing, context_flags);
+	}
+
+	if        (streq(pnode->text, "tolower")) { return rval_evaluator_alloc_from_s_s_arena_func(s_s_tolower_arena_func, pargs[0]);
+	} else if (streq(pnode->text, "toupper")) { return rval_evaluator_alloc_from_s_s_arena_func(s_s_toupper_arena_func, pargs[0]);
+	} else                                    { return rval_evaluator_alloc_from_x_xx_arena_func(s_xx_dot_arena_func, pargs[0], pargs[1]);
+	}
+}
+
 // ----------------------------------------------------------------
 static rval_evaluator_t* construct_builtin_function_callsite_evaluator(
 	fmgr_t* pfmgr,
@@ -911,6 +960,11 @@ static rval_evaluator_t* construct_builtin_function_callsite_evaluator(
 	int variadic = FALSE;
 	fmgr_check_arity_with_report(pfmgr, function_name, user_provided_arity, &variadic);
 
+	if (is_string_chain_link(pnode) && has_string_chain_link_argument(pnode)) {
+		return rval_evaluator_alloc_from_string_chain(
+			fmgr_alloc_string_chain_link(pfmgr, pnode, type_inferencing, context_flags));
+	}
+
 	rval_evaluator_t* pevaluator = NULL;
 	if (variadic) {
 		int nargs = pnode->pchildren->length;
@@ -947,7 +1001,10 @@ static rval_evaluator_t* construct_builtin_function_callsite_evaluator(
 			// be slower.
 			rval_evaluator_t* parg1 = rval_evaluator_alloc_from_ast(parg1_node, pfmgr, type_inferencing, context_flags);
 			rval_evaluator_t* parg2 = rval_evaluator_alloc_from_ast(parg2_node, pfmgr, type_inferencing, context_flags);
-			pevaluator = fmgr_alloc_evaluator_from_binary_func_name(function_name, parg1, parg2);
+			pevaluator = fmgr_alloc_typed_evaluator_from_binary_func_name(function_name, parg1, parg2,
+				mlr_dsl_ast_node_static_type_mask(parg1_node), mlr_dsl_ast_node_static_type_mask(parg2_node));
+			if (pevaluator == NULL)
+				pevaluator = fmgr_alloc_evaluator_from_binary_func_name(function_name, parg1, parg2);
 		}
 
 	} else if (user_provided_arity == 3) {
@@ -989,6 +1046,97 @@ static rval_evaluator_t* construct_builtin_function_callsite_evaluator(
 	return pevaluator;
 }
 
+// ----------------------------------------------------------------
+// Constant folding, for the CST builder (see dsl/mlr_dsl_optimize.c).
+
+// Functions whose values depend on more than their arguments (random numbers, clock, regex-capture
+// side effects), or which can exit the process on bad input, are not folded ahead of time.
+static char* NON_FOLDABLE_FUNCTION_NAMES[] = {
+	"urand", "urand32", "urandint", "systime",
+	"=~", "!=~", "sub", "gsub",
+	"? :", "typeof",
+	NULL
+};
+
+static int literal_is_foldable(mlr_dsl_ast_node_t* pnode) {
+	switch (pnode->type) {
+	case MD_AST_NODE_TYPE_NUMERIC_LITERAL:
+	case MD_AST_NODE_TYPE_STRING_LITERAL:
+		// String literals such as "\1" are interpolated at runtime from regex captures.
+		return !string_has_regex_captures(pnode->text);
+	case MD_AST_NODE_TYPE_BOOLEAN_LITERAL:
+		return TRUE;
+	default:
+		return FALSE;
+	}
+}
+
+int fmgr_try_evaluate_literal_callsite(fmgr_t* pfmgr, mlr_dsl_ast_node_t* pnode, mv_t* presult) {
+	if (pnode->type != MD_AST_NODE_TYPE_OPERATOR && pnode->type != MD_AST_NODE_TYPE_FUNCTION_CALLSITE)
+		return FALSE;
+	if (pnode->pchildren == NULL)
+		return FALSE;
+
+	char* function_name = pnode->text;
+	for (int i = 0; NON_FOLDABLE_FUNCTION_NAMES[i] != NULL; i++)
+		if (streq(function_name, NON_FOLDABLE_FUNCTION_NAMES[i]))
+			return FALSE;
+
+	int arity = -1;
+	int variadic = FALSE;
+	if (check_arity(pfmgr->function_lookup_table, function_name, pnode->pchildren->length,
+		&arity, &variadic) != ARITY_CHECK_PASS)
+	{
+		return FALSE; // Errors are reported when the callsite is resolved.
+	}
+	for (int i = 0; ; i++) {
+		function_lookup_t* plookup = &pfmgr->function_lookup_table[i];
+		if (plookup->function_name == NULL)
+			break;
+		if (streq(function_name, plookup->function_name)) {
+			func_class_t function_class = plookup->function_class;
+			if (function_class == FUNC_CLASS_TYPING || function_class == FUNC_CLASS_MAPS
+				|| function_class == FUNC_CLASS_TIME)
+			{
+				return FALSE;
+			}
+			break;
+		}
+	}
+
+	for (sllve_t* pe = pnode->pchildren->phead; pe != NULL; pe = pe->pnext)
+		if (!literal_is_foldable(pe->pvvalue))
+			return FALSE;
+
+	unresolved_func_callsite_state_t callsite = {
+		.function_name    = function_name,
+		.arity            = pnode->pchildren->length,
+		.type_inferencing = TYPE_INFER_STRING_FLOAT_INT,
+		.context_flags    = 0,
+		.pnode            = pnode,
+	};
+	rval_evaluator_t* pevaluator = construct_builtin_function_callsite_evaluator(pfmgr, &callsite);
+	if (pevaluator == NULL)
+		return FALSE;
+
+	// Literal and pure-function evaluators need nothing from the stream or the stack.
+	string_array_t* pregex_captures = NULL;
+	variables_t variables;
+	memset(&variables, 0, sizeof(variables));
+	variables.ppregex_captures = &pregex_captures;
+
+	mv_t val = pevaluator->pprocess_func(pevaluator->pvstate, &variables);
+	*presult = mv_copy(&val);
+	mv_free(&val);
+	pevaluator->pfree_func(pevaluator);
+
+	if (presult->type == MT_ERROR || presult->type == MT_ABSENT) {
+		mv_free(presult);
+		return FALSE;
+	}
+	return TRUE;
+}
+
 // ----------------------------------------------------------------
 // At callsites, arguments can be scalars or maps; return values can be scalars
 // or maps.  At the user level, a function take map input and produce scalar
@@ -1210,6 +1358,30 @@ static rval_evaluator_t* fmgr_alloc_evaluator_from_binary_func_name(char* fnnm,
 	} else  { return NULL; }
 }
 
+// Operands known at CST-build time to be numeric (literals, typed locals) get evaluators with inline int/float
+// paths, bypassing the disposition matrices. Returns NULL if there is no specialization.
+static rval_evaluator_t* fmgr_alloc_typed_evaluator_from_binary_func_name(char* fnnm,
+	rval_evaluator_t* parg1, rval_evaluator_t* parg2, int type_mask1, int type_mask2)
+{
+	if ((type_mask1 & ~TYPE_MASK_NUMERIC) || (type_mask2 & ~TYPE_MASK_NUMERIC))
+		return NULL;
+	// Int-int arithmetic keeps its overflow-to-float handling in the disposition matrices.
+	int has_float = (type_mask1 == TYPE_MASK_FLOAT || type_mask2 == TYPE_MASK_FLOAT);
+
+	if        (streq(fnnm, "==")) { return rval_evaluator_alloc_from_b_nn_eq_func(parg1, parg2);
+	} else if (streq(fnnm, "!=")) { return rval_evaluator_alloc_from_b_nn_ne_func(parg1, parg2);
+	} else if (streq(fnnm, ">"))  { return rval_evaluator_alloc_from_b_nn_gt_func(parg1, parg2);
+	} else if (streq(fnnm, ">=")) { return rval_evaluator_alloc_from_b_nn_ge_func(parg1, parg2);
+	} else if (streq(fnnm, "<"))  { return rval_evaluator_alloc_from_b_nn_lt_func(parg1, parg2);
+	} else if (streq(fnnm, "<=")) { return rval_evaluator_alloc_from_b_nn_le_func(parg1, parg2);
+	} else if (!has_float)        { return NULL;
+	} else if (streq(fnnm, "+"))  { return rval_evaluator_alloc_from_f_nn_plus_func(parg1, parg2);
+	} else if (streq(fnnm, "-"))  { return rval_evaluator_alloc_from_f_nn_minus_func(parg1, parg2);
+	} else if (streq(fnnm, "*"))  { return rval_evaluator_alloc_from_f_nn_times_func(parg1, parg2);
+	} else if (streq(fnnm, "/"))  { return rval_evaluator_alloc_from_f_nn_divide_func(parg1, parg2);
+	} else  { return NULL; }
+}
+
 static rval_evaluator_t* fmgr_alloc_evaluator_from_binary_regex_arg2_func_name(char* fnnm,
 	rval_evaluator_t* parg1, char* regex_string, int ignore_case)
 {
@@ -59,6 +59,11 @@ void fmgr_mark_xcallsite_to_resolve(fmgr_t* pfmgr, rxval_evaluator_t* pxev);
 // Update all function callsites to point to UDF bodies, once all the latter have been defined.
 void fmgr_resolve_func_callsites(fmgr_t* pfmgr);
 
+// For constant folding in the CST builder: if the node is a callsite of a deterministic built-in function
+// or operator all of whose arguments are literals, evaluates it and returns TRUE with the result in
+// *presult (to be freed by the caller). Otherwise returns FALSE.
+int fmgr_try_evaluate_literal_callsite(fmgr_t* pfmgr, mlr_dsl_ast_node_t* pnode, mv_t* presult);
+
 //  - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void fmgr_list_functions(fmgr_t* pfmgr, FILE* output_stream, char* leader);
 
@@ -1,5 +1,6 @@
 #include <string.h>
 #include "lib/mlrutil.h"
+#include "containers/slls.h"
 #include "dsl/mlr_dsl_ast.h"
 
 // ----------------------------------------------------------------
@@ -21,6 +22,7 @@ mlr_dsl_ast_node_t* mlr_dsl_ast_node_alloc(char* text, mlr_dsl_ast_node_type_t t
 	pnode->vardef_subframe_relative_index = MD_UNUSED_INDEX;
 	pnode->vardef_subframe_index          = MD_UNUSED_INDEX;
 	pnode->vardef_frame_relative_index    = MD_UNUSED_INDEX;
+	pnode->vardef_type_mask               = TYPE_MASK_ANY;
 	pnode->subframe_var_count             = MD_UNUSED_INDEX;
 	pnode->max_subframe_depth             = MD_UNUSED_INDEX;
 	pnode->max_var_depth                  = MD_UNUSED_INDEX;
@@ -180,6 +182,88 @@ int mlr_dsl_ast_node_cannot_be_bare_boolean(mlr_dsl_ast_node_t* pnode) {
 	}
 }
 
+// ----------------------------------------------------------------
+int mlr_dsl_ast_node_static_type_mask(mlr_dsl_ast_node_t* pnode) {
+	long long intv;
+	double fltv;
+
+	switch (pnode->type) {
+
+	case MD_AST_NODE_TYPE_NUMERIC_LITERAL:
+		if (mlr_try_int_from_string(pnode->text, &intv))
+			return TYPE_MASK_INT;
+		else if (mlr_try_float_from_string(pnode->text, &fltv))
+			return TYPE_MASK_FLOAT;
+		else
+			return TYPE_MASK_ANY;
+
+	case MD_AST_NODE_TYPE_STRING_LITERAL:
+		return TYPE_MASK_STRING;
+
+	case MD_AST_NODE_TYPE_BOOLEAN_LITERAL:
+		return TYPE_MASK_BOOLEAN;
+
+	case MD_AST_NODE_TYPE_NONINDEXED_LOCAL_VARIABLE:
+		return pnode->vardef_type_mask;
+
+	case MD_AST_NODE_TYPE_OPERATOR:
+		// Float arithmetic stays float. Int-only arithmetic can auto-overflow to float so it is
+		// reported as numeric.
+		if (pnode->pchildren->length == 2 && (streq(pnode->text, "+") || streq(pnode->text, "-")
+			|| streq(pnode->text, "*") || streq(pnode->text, "/")))
+		{
+			int mask1 = mlr_dsl_ast_node_static_type_mask(pnode->pchildren->phead->pvvalue);
+			int mask2 = mlr_dsl_ast_node_static_type_mask(pnode->pchildren->phead->pnext->pvvalue);
+			if ((mask1 & ~TYPE_MASK_NUMERIC) || (mask2 & ~TYPE_MASK_NUMERIC))
+				return TYPE_MASK_ANY;
+			if (mask1 == TYPE_MASK_FLOAT || mask2 == TYPE_MASK_FLOAT)
+				return TYPE_MASK_FLOAT;
+			return TYPE_MASK_NUMERIC;
+		}
+		return TYPE_MASK_ANY;
+
+	default:
+		return TYPE_MASK_ANY;
+	}
+}
+
+// ----------------------------------------------------------------
+int mlr_dsl_ast_node_get_field_names(mlr_dsl_ast_node_t* pnode, slls_t* pfield_names) {
+	if (pnode == NULL) // Empty expression
+		return TRUE;
+
+	switch (pnode->type) {
+
+	case MD_AST_NODE_TYPE_FIELD_NAME:
+		slls_append_with_free(pfield_names, mlr_strdup_or_die(pnode->text));
+		return TRUE;
+
+	case MD_AST_NODE_TYPE_INDIRECT_FIELD_NAME:
+	case MD_AST_NODE_TYPE_INDIRECT_SREC_ASSIGNMENT:
+	case MD_AST_NODE_TYPE_FULL_SREC:
+	case MD_AST_NODE_TYPE_FULL_SREC_ASSIGNMENT:
+	case MD_AST_NODE_TYPE_OOSVAR_FROM_FULL_SREC_ASSIGNMENT:
+	case MD_AST_NODE_TYPE_FULL_OOSVAR_FROM_FULL_SREC_ASSIGNMENT:
+	case MD_AST_NODE_TYPE_FOR_SREC:
+	case MD_AST_NODE_TYPE_FOR_SREC_KEY_ONLY:
+		return FALSE;
+
+	case MD_AST_NODE_TYPE_CONTEXT_VARIABLE:
+		return !streq(pnode->text, "NF");
+
+	default:
+		break;
+	}
+
+	if (pnode->pchildren != NULL) {
+		for (sllve_t* pe = pnode->pchildren->phead; pe != NULL; pe = pe->pnext) {
+			if (!mlr_dsl_ast_node_get_field_names(pe->pvvalue, pfield_names))
+				return FALSE;
+		}
+	}
+	return TRUE;
+}
+
 // ----------------------------------------------------------------
 void mlr_dsl_ast_print(mlr_dsl_ast_t* past) {
 	printf("AST ROOT:\n");
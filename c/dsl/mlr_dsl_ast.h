@@ -118,6 +118,7 @@ typedef struct _mlr_dsl_ast_node_t {
 	int vardef_subframe_relative_index; // pass 1 output: which index in subframe
 	int vardef_subframe_index;          // pass 1 output: which subframe the variable is defined in
 	int vardef_frame_relative_index;    // pass 2 output: index relative to full stack frame
+	int vardef_type_mask;               // pass 1 output: declared type, e.g. TYPE_MASK_FLOAT for 'float x'
 
 	// For bind-stack allocation only in statement-block nodes: unused for any other node types.
 	int subframe_var_count;
@@ -165,6 +166,17 @@ int mlr_dsl_ast_node_type_to_type_mask(mlr_dsl_ast_node_type_t type);
 
 int mlr_dsl_ast_node_cannot_be_bare_boolean(mlr_dsl_ast_node_t* pnode);
 
+// What can be known at CST-build time about the type of the node's value: from literals, typed local
+// variables, and arithmetic on those. Returns TYPE_MASK_ANY when nothing is known. This is for selecting
+// type-specialized evaluators; those still check types at runtime.
+int mlr_dsl_ast_node_static_type_mask(mlr_dsl_ast_node_t* pnode);
+
+// For projection pushdown: appends copies of the names of the fields which the
+// expression refers to as $name. Returns FALSE if it can also get at fields not
+// known until runtime, via $*, $[...], for-loops over $*, or NF.
+struct _slls_t;
+int mlr_dsl_ast_node_get_field_names(mlr_dsl_ast_node_t* pnode, struct _slls_t* pfield_names);
+
 void mlr_dsl_ast_print(mlr_dsl_ast_t* past);
 void mlr_dsl_ast_node_print(mlr_dsl_ast_node_t* pnode);
 void mlr_dsl_ast_node_fprint(mlr_dsl_ast_node_t* pnode, FILE* o);
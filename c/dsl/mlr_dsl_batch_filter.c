@@ -0,0 +1,512 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "lib/mlr_globals.h"
+#include "lib/mlrutil.h"
+#include "lib/mvfuncs.h"
+#include "dsl/type_inference.h"
+#include "dsl/mlr_dsl_batch_filter.h"
+
+// ================================================================
+// See mlr_dsl_batch_filter.h for an overview.
+//
+// Each node of the expression tree owns a column of mlrvals, one per record in
+// the block. Nodes are evaluated over a selection vector: the indices of the
+// records whose values are needed. For the root that's all records in the
+// block; the right-hand side of && (||) is evaluated only for records where the
+// left-hand side was true (false) or absent, which is the short-circuiting of
+// the per-record evaluators done a column at a time.
+//
+// When all selected values of an operand are int/float (or boolean), the
+// operators run as plain loops over the column; otherwise they fall back to the
+// mlrval disposition matrices row by row.
+// ================================================================
+
+#define BATCH_TYPE_MIXED MT_DIM
+
+typedef enum _batch_node_type_t {
+	BATCH_NODE_FIELD,
+	BATCH_NODE_LITERAL,
+	BATCH_NODE_ARITHMETIC,
+	BATCH_NODE_COMPARISON,
+	BATCH_NODE_AND,
+	BATCH_NODE_OR,
+	BATCH_NODE_NOT,
+} batch_node_type_t;
+
+typedef enum _batch_op_t {
+	BATCH_OP_NONE,
+	BATCH_OP_PLUS, BATCH_OP_MINUS, BATCH_OP_TIMES, BATCH_OP_DIVIDE,
+	BATCH_OP_EQ, BATCH_OP_NE, BATCH_OP_GT, BATCH_OP_GE, BATCH_OP_LT, BATCH_OP_LE,
+} batch_op_t;
+
+typedef struct _batch_node_t {
+	batch_node_type_t     type;
+	batch_op_t            op;
+	mv_binary_func_t*     pfunc;       // row-by-row fallback for arithmetic and comparison
+	char*                 field_name;  // points into the AST, which outlives us
+	struct _batch_node_t* pleft;
+	struct _batch_node_t* pright;
+
+	// Values are meaningful only at the indices in the most recent selection. They're numbers,
+	// booleans, or references to record/AST strings, so there is nothing to mv_free.
+	mv_t*                 pvals;
+	// MT_INT/MT_FLOAT/MT_BOOLEAN if all selected values have that type, else BATCH_TYPE_MIXED.
+	int                   uniform_type;
+	// For && and ||: the rows for which the right-hand side is needed.
+	int*                  psubselection;
+} batch_node_t;
+
+struct _batch_filter_t {
+	batch_node_t* proot;
+	int           negate_final_filter;
+	int           block_size;
+	int*          pall_rows;
+	mv_t        (*ptype_infer_func)(char* string);
+};
+
+static batch_node_t* batch_node_alloc_from_ast(mlr_dsl_ast_node_t* pnode, int block_size);
+static void batch_node_free(batch_node_t* pnode);
+static void batch_node_evaluate(batch_node_t* pnode, batch_filter_t* pfilter, lrec_t** precs,
+	int* psel, int nsel);
+
+static void evaluate_arithmetic(batch_node_t* pnode, int* psel, int nsel);
+static void evaluate_comparison(batch_node_t* pnode, int* psel, int nsel);
+static void evaluate_and_or(batch_node_t* pnode, batch_filter_t* pfilter, lrec_t** precs, int* psel, int nsel);
+static void evaluate_not(batch_node_t* pnode, int* psel, int nsel);
+static int  uniform_type_of(mv_t* pvals, int* psel, int nsel);
+
+// ----------------------------------------------------------------
+batch_filter_t* batch_filter_alloc(mlr_dsl_cst_t* pcst, int negate_final_filter, int type_inferencing,
+	int block_size)
+{
+	blocked_ast_t* paast = pcst->paast;
+	if (paast->pfunc_defs->length != 0 || paast->psubr_defs->length != 0)
+		return NULL;
+	if (paast->pbegin_blocks->length != 0 || paast->pend_blocks->length != 0)
+		return NULL;
+	if (paast->pmain_block->pchildren->length != 1)
+		return NULL;
+
+	batch_node_t* proot = batch_node_alloc_from_ast(paast->pmain_block->pchildren->phead->pvvalue, block_size);
+	if (proot == NULL)
+		return NULL;
+
+	batch_filter_t* pfilter = mlr_malloc_or_die(sizeof(batch_filter_t));
+	pfilter->proot = proot;
+	pfilter->negate_final_filter = negate_final_filter;
+	pfilter->block_size = block_size;
+	pfilter->pall_rows = mlr_malloc_or_die(block_size * sizeof(int));
+	for (int i = 0; i < block_size; i++)
+		pfilter->pall_rows[i] = i;
+	switch (type_inferencing) {
+	case TYPE_INFER_STRING_ONLY:
+		pfilter->ptype_infer_func = mv_ref_type_infer_string;
+		break;
+	case TYPE_INFER_STRING_FLOAT:
+		pfilter->ptype_infer_func = mv_ref_type_infer_string_or_float;
+		break;
+	case TYPE_INFER_STRING_FLOAT_INT:
+		pfilter->ptype_infer_func = mv_ref_type_infer_string_or_float_or_int;
+		break;
+	default:
+		MLR_INTERNAL_CODING_ERROR();
+		break;
+	}
+	return pfilter;
+}
+
+void batch_filter_free(batch_filter_t* pfilter) {
+	if (pfilter == NULL)
+		return;
+	batch_node_free(pfilter->proot);
+	free(pfilter->pall_rows);
+	free(pfilter);
+}
+
+// ----------------------------------------------------------------
+// The final-filter value is interpreted as in handle_final_filter in mlr_dsl_cst_condish_statements.c.
+void batch_filter_evaluate(batch_filter_t* pfilter, lrec_t** precs, int nrecs, char* pmask) {
+	MLR_INTERNAL_CODING_ERROR_IF(nrecs > pfilter->block_size);
+	batch_node_t* proot = pfilter->proot;
+	batch_node_evaluate(proot, pfilter, precs, pfilter->pall_rows, nrecs);
+
+	char negate = pfilter->negate_final_filter ? 1 : 0;
+	mv_t* pvals = proot->pvals;
+	if (proot->uniform_type == MT_BOOLEAN) {
+		for (int i = 0; i < nrecs; i++)
+			pmask[i] = pvals[i].u.boolv ^ negate;
+	} else {
+		for (int i = 0; i < nrecs; i++) {
+			mv_t val = pvals[i];
+			if (mv_is_non_null(&val)) {
+				mv_set_boolean_strict(&val);
+				pmask[i] = val.u.boolv ^ negate;
+			} else {
+				pmask[i] = FALSE;
+			}
+		}
+	}
+}
+
+// ----------------------------------------------------------------
+static batch_op_t op_from_name(char* name) {
+	if (streq(name, "+"))  return BATCH_OP_PLUS;
+	if (streq(name, "-"))  return BATCH_OP_MINUS;
+	if (streq(name, "*"))  return BATCH_OP_TIMES;
+	if (streq(name, "/"))  return BATCH_OP_DIVIDE;
+	if (streq(name, "==")) return BATCH_OP_EQ;
+	if (streq(name, "!=")) return BATCH_OP_NE;
+	if (streq(name, ">"))  return BATCH_OP_GT;
+	if (streq(name, ">=")) return BATCH_OP_GE;
+	if (streq(name, "<"))  return BATCH_OP_LT;
+	if (streq(name, "<=")) return BATCH_OP_LE;
+	return BATCH_OP_NONE;
+}
+
+static mv_binary_func_t* func_from_op(batch_op_t op) {
+	switch (op) {
+	case BATCH_OP_PLUS:   return x_xx_plus_func;
+	case BATCH_OP_MINUS:  return x_xx_minus_func;
+	case BATCH_OP_TIMES:  return x_xx_times_func;
+	case BATCH_OP_DIVIDE: return x_xx_divide_func;
+	case BATCH_OP_EQ:     return eq_op_func;
+	case BATCH_OP_NE:     return ne_op_func;
+	case BATCH_OP_GT:     return gt_op_func;
+	case BATCH_OP_GE:     return ge_op_func;
+	case BATCH_OP_LT:     return lt_op_func;
+	case BATCH_OP_LE:     return le_op_func;
+	default:              return NULL;
+	}
+}
+
+// Returns NULL if the subtree has anything other than field names, literals, and the operators above.
+static batch_node_t* batch_node_alloc_from_ast(mlr_dsl_ast_node_t* pnode, int block_size) {
+	batch_node_t* pbnode = mlr_malloc_or_die(sizeof(batch_node_t));
+	pbnode->op            = BATCH_OP_NONE;
+	pbnode->pfunc         = NULL;
+	pbnode->field_name    = NULL;
+	pbnode->pleft         = NULL;
+	pbnode->pright        = NULL;
+	pbnode->pvals         = mlr_malloc_or_die(block_size * sizeof(mv_t));
+	pbnode->uniform_type  = BATCH_TYPE_MIXED;
+	pbnode->psubselection = NULL;
+
+	int nchildren = (pnode->pchildren == NULL) ? 0 : pnode->pchildren->length;
+	mv_t literal = mv_absent();
+	long long intv;
+	double fltv;
+	int ok = TRUE;
+
+	switch (pnode->type) {
+
+	case MD_AST_NODE_TYPE_FIELD_NAME:
+		pbnode->type = BATCH_NODE_FIELD;
+		pbnode->field_name = pnode->text;
+		break;
+
+	case MD_AST_NODE_TYPE_NUMERIC_LITERAL:
+		// As in rval_evaluator_alloc_from_numeric_literal.
+		pbnode->type = BATCH_NODE_LITERAL;
+		if (mlr_try_int_from_string(pnode->text, &intv))
+			literal = mv_from_int(intv);
+		else if (mlr_try_float_from_string(pnode->text, &fltv))
+			literal = mv_from_float(fltv);
+		else
+			literal = mv_from_string_no_free(pnode->text);
+		break;
+
+	case MD_AST_NODE_TYPE_STRING_LITERAL:
+		// Regex captures are only set by =~ and !=~, which aren't batchable, so "\1" is taken literally
+		// here just as in the per-record path.
+		pbnode->type = BATCH_NODE_LITERAL;
+		literal = mv_from_string_no_free(pnode->text);
+		break;
+
+	case MD_AST_NODE_TYPE_BOOLEAN_LITERAL:
+		pbnode->type = BATCH_NODE_LITERAL;
+		literal = mv_from_bool(streq(pnode->text, "true"));
+		break;
+
+	case MD_AST_NODE_TYPE_OPERATOR:
+		if (nchildren == 2 && (streq(pnode->text, "&&") || streq(pnode->text, "||"))) {
+			pbnode->type = streq(pnode->text, "&&") ? BATCH_NODE_AND : BATCH_NODE_OR;
+			pbnode->psubselection = mlr_malloc_or_die(block_size * sizeof(int));
+		} else if (nchildren == 1 && streq(pnode->text, "!")) {
+			pbnode->type = BATCH_NODE_NOT;
+		} else if (nchildren == 2 && op_from_name(pnode->text) != BATCH_OP_NONE) {
+			pbnode->op = op_from_name(pnode->text);
+			pbnode->pfunc = func_from_op(pbnode->op);
+			pbnode->type = (pbnode->op >= BATCH_OP_EQ) ? BATCH_NODE_COMPARISON : BATCH_NODE_ARITHMETIC;
+		} else {
+			ok = FALSE;
+			break;
+		}
+		pbnode->pleft = batch_node_alloc_from_ast(pnode->pchildren->phead->pvvalue, block_size);
+		if (nchildren == 2)
+			pbnode->pright = batch_node_alloc_from_ast(pnode->pchildren->phead->pnext->pvvalue, block_size);
+		ok = pbnode->pleft != NULL && (nchildren == 1 || pbnode->pright != NULL);
+		break;
+
+	default:
+		ok = FALSE;
+		break;
+	}
+
+	if (!ok) {
+		batch_node_free(pbnode);
+		return NULL;
+	}
+
+	// Literals are the same for every block so their columns are filled once, here.
+	if (pbnode->type == BATCH_NODE_LITERAL) {
+		for (int i = 0; i < block_size; i++)
+			pbnode->pvals[i] = literal;
+		if (literal.type == MT_INT || literal.type == MT_FLOAT || literal.type == MT_BOOLEAN)
+			pbnode->uniform_type = literal.type;
+	}
+
+	return pbnode;
+}
+
+static void batch_node_free(batch_node_t* pnode) {
+	if (pnode == NULL)
+		return;
+	batch_node_free(pnode->pleft);
+	batch_node_free(pnode->pright);
+	free(pnode->pvals);
+	free(pnode->psubselection);
+	free(pnode);
+}
+
+// ----------------------------------------------------------------
+static void batch_node_evaluate(batch_node_t* pnode, batch_filter_t* pfilter, lrec_t** precs,
+	int* psel, int nsel)
+{
+	switch (pnode->type) {
+
+	case BATCH_NODE_FIELD:
+		for (int k = 0; k < nsel; k++) {
+			int i = psel[k];
+			pnode->pvals[i] = pfilter->ptype_infer_func(lrec_get(precs[i], pnode->field_name));
+		}
+		pnode->uniform_type = uniform_type_of(pnode->pvals, psel, nsel);
+		break;
+
+	case BATCH_NODE_LITERAL:
+		break;
+
+	case BATCH_NODE_ARITHMETIC:
+		batch_node_evaluate(pnode->pleft, pfilter, precs, psel, nsel);
+		batch_node_evaluate(pnode->pright, pfilter, precs, psel, nsel);
+		evaluate_arithmetic(pnode, psel, nsel);
+		break;
+
+	case BATCH_NODE_COMPARISON:
+		batch_node_evaluate(pnode->pleft, pfilter, precs, psel, nsel);
+		batch_node_evaluate(pnode->pright, pfilter, precs, psel, nsel);
+		evaluate_comparison(pnode, psel, nsel);
+		break;
+
+	case BATCH_NODE_AND:
+	case BATCH_NODE_OR:
+		evaluate_and_or(pnode, pfilter, precs, psel, nsel);
+		break;
+
+	case BATCH_NODE_NOT:
+		batch_node_evaluate(pnode->pleft, pfilter, precs, psel, nsel);
+		evaluate_not(pnode, psel, nsel);
+		break;
+	}
+}
+
+// ----------------------------------------------------------------
+static inline int is_numeric_type(int type) {
+	return type == MT_INT || type == MT_FLOAT;
+}
+
+static inline double float_of(mv_t* pval) {
+	return (pval->type == MT_FLOAT) ? pval->u.fltv : (double)pval->u.intv;
+}
+
+// Int-int arithmetic isn't done inline since it has overflow-to-float handling and (for division)
+// int-or-float results; see lib/mvfuncs.c.
+#define FLOAT_ARITHMETIC_LOOP(op) \
+	for (int k = 0; k < nsel; k++) { \
+		int i = psel[k]; \
+		pc[i] = mv_from_float(float_of(&pa[i]) op float_of(&pb[i])); \
+	}
+
+static void evaluate_arithmetic(batch_node_t* pnode, int* psel, int nsel) {
+	mv_t* pa = pnode->pleft->pvals;
+	mv_t* pb = pnode->pright->pvals;
+	mv_t* pc = pnode->pvals;
+	int ta = pnode->pleft->uniform_type;
+	int tb = pnode->pright->uniform_type;
+
+	if (is_numeric_type(ta) && is_numeric_type(tb) && (ta == MT_FLOAT || tb == MT_FLOAT)) {
+		switch (pnode->op) {
+		case BATCH_OP_PLUS:   FLOAT_ARITHMETIC_LOOP(+); break;
+		case BATCH_OP_MINUS:  FLOAT_ARITHMETIC_LOOP(-); break;
+		case BATCH_OP_TIMES:  FLOAT_ARITHMETIC_LOOP(*); break;
+		case BATCH_OP_DIVIDE: FLOAT_ARITHMETIC_LOOP(/); break;
+		default: MLR_INTERNAL_CODING_ERROR(); break;
+		}
+		pnode->uniform_type = MT_FLOAT;
+		return;
+	}
+
+	for (int k = 0; k < nsel; k++) {
+		int i = psel[k];
+		// Copies since the mlrval functions may modify their inputs.
+		mv_t a = pa[i];
+		mv_t b = pb[i];
+		pc[i] = pnode->pfunc(&a, &b);
+	}
+	pnode->uniform_type = uniform_type_of(pc, psel, nsel);
+}
+
+// ----------------------------------------------------------------
+// Mixed int/float comparisons are done in floating point as in lib/mvfuncs.c.
+#define INT_COMPARISON_LOOP(op) \
+	for (int k = 0; k < nsel; k++) { \
+		int i = psel[k]; \
+		pc[i] = mv_from_bool(pa[i].u.intv op pb[i].u.intv); \
+	}
+#define FLOAT_COMPARISON_LOOP(op) \
+	for (int k = 0; k < nsel; k++) { \
+		int i = psel[k]; \
+		pc[i] = mv_from_bool(float_of(&pa[i]) op float_of(&pb[i])); \
+	}
+
+static void evaluate_comparison(batch_node_t* pnode, int* psel, int nsel) {
+	mv_t* pa = pnode->pleft->pvals;
+	mv_t* pb = pnode->pright->pvals;
+	mv_t* pc = pnode->pvals;
+	int ta = pnode->pleft->uniform_type;
+	int tb = pnode->pright->uniform_type;
+
+	if (ta == MT_INT && tb == MT_INT) {
+		switch (pnode->op) {
+		case BATCH_OP_EQ: INT_COMPARISON_LOOP(==); break;
+		case BATCH_OP_NE: INT_COMPARISON_LOOP(!=); break;
+		case BATCH_OP_GT: INT_COMPARISON_LOOP(>);  break;
+		case BATCH_OP_GE: INT_COMPARISON_LOOP(>=); break;
+		case BATCH_OP_LT: INT_COMPARISON_LOOP(<);  break;
+		case BATCH_OP_LE: INT_COMPARISON_LOOP(<=); break;
+		default: MLR_INTERNAL_CODING_ERROR(); break;
+		}
+		pnode->uniform_type = MT_BOOLEAN;
+	} else if (is_numeric_type(ta) && is_numeric_type(tb)) {
+		switch (pnode->op) {
+		case BATCH_OP_EQ: FLOAT_COMPARISON_LOOP(==); break;
+		case BATCH_OP_NE: FLOAT_COMPARISON_LOOP(!=); break;
+		case BATCH_OP_GT: FLOAT_COMPARISON_LOOP(>);  break;
+		case BATCH_OP_GE: FLOAT_COMPARISON_LOOP(>=); break;
+		case BATCH_OP_LT: FLOAT_COMPARISON_LOOP(<);  break;
+		case BATCH_OP_LE: FLOAT_COMPARISON_LOOP(<=); break;
+		default: MLR_INTERNAL_CODING_ERROR(); break;
+		}
+		pnode->uniform_type = MT_BOOLEAN;
+	} else {
+		for (int k = 0; k < nsel; k++) {
+			int i = psel[k];
+			mv_t a = pa[i];
+			mv_t b = pb[i];
+			pc[i] = pnode->pfunc(&a, &b);
+		}
+		pnode->uniform_type = uniform_type_of(pc, psel, nsel);
+	}
+}
+
+// ----------------------------------------------------------------
+// Row-by-row semantics are those of rval_evaluator_b_bb_and_func and rval_evaluator_b_bb_or_func.
+// The right-hand value is looked at only for rows where the left-hand value is the non-deciding
+// boolean (true for &&, false for ||) or absent.
+static mv_t and_or_row(mv_t* pval1, mv_t* pval2, int is_and) {
+	mv_t val1 = *pval1;
+	EMPTY_OR_ERROR_OUT_FOR_NUMBERS(val1);
+	if (val1.type == MT_BOOLEAN) {
+		if (val1.u.boolv != is_and)
+			return val1;
+	} else if (val1.type != MT_ABSENT) {
+		return mv_error();
+	}
+
+	mv_t val2 = *pval2;
+	EMPTY_OR_ERROR_OUT_FOR_NUMBERS(val2);
+	if (val2.type == MT_BOOLEAN) {
+		return val2;
+	} else if (val2.type == MT_ABSENT) {
+		return val1;
+	} else {
+		return mv_error();
+	}
+}
+
+static void evaluate_and_or(batch_node_t* pnode, batch_filter_t* pfilter, lrec_t** precs, int* psel, int nsel) {
+	int is_and = pnode->type == BATCH_NODE_AND;
+	mv_t* pa = pnode->pleft->pvals;
+	mv_t* pc = pnode->pvals;
+
+	batch_node_evaluate(pnode->pleft, pfilter, precs, psel, nsel);
+
+	int* psubsel = pnode->psubselection;
+	int nsubsel = 0;
+	for (int k = 0; k < nsel; k++) {
+		int i = psel[k];
+		if ((pa[i].type == MT_BOOLEAN && pa[i].u.boolv == is_and) || pa[i].type == MT_ABSENT)
+			psubsel[nsubsel++] = i;
+	}
+
+	if (nsubsel > 0)
+		batch_node_evaluate(pnode->pright, pfilter, precs, psubsel, nsubsel);
+	mv_t* pb = pnode->pright->pvals;
+
+	if (pnode->pleft->uniform_type == MT_BOOLEAN && (nsubsel == 0 || pnode->pright->uniform_type == MT_BOOLEAN)) {
+		for (int k = 0; k < nsel; k++) {
+			int i = psel[k];
+			pc[i] = (pa[i].u.boolv == is_and) ? pb[i] : pa[i];
+		}
+		pnode->uniform_type = MT_BOOLEAN;
+		return;
+	}
+
+	for (int k = 0; k < nsel; k++) {
+		int i = psel[k];
+		pc[i] = and_or_row(&pa[i], &pb[i], is_and);
+	}
+	pnode->uniform_type = uniform_type_of(pc, psel, nsel);
+}
+
+// ----------------------------------------------------------------
+// Row-by-row semantics are those of rval_evaluator_b_b_func with b_b_not_func.
+static void evaluate_not(batch_node_t* pnode, int* psel, int nsel) {
+	mv_t* pa = pnode->pleft->pvals;
+	mv_t* pc = pnode->pvals;
+
+	for (int k = 0; k < nsel; k++) {
+		int i = psel[k];
+		if (pa[i].type == MT_BOOLEAN)
+			pc[i] = mv_from_bool(!pa[i].u.boolv);
+		else if (pa[i].type <= MT_EMPTY)
+			pc[i] = pa[i];
+		else
+			pc[i] = mv_error();
+	}
+	pnode->uniform_type = (pnode->pleft->uniform_type == MT_BOOLEAN)
+		? MT_BOOLEAN
+		: uniform_type_of(pc, psel, nsel);
+}
+
+// ----------------------------------------------------------------
+static int uniform_type_of(mv_t* pvals, int* psel, int nsel) {
+	if (nsel == 0)
+		return BATCH_TYPE_MIXED;
+	int type = pvals[psel[0]].type;
+	if (type != MT_INT && type != MT_FLOAT && type != MT_BOOLEAN)
+		return BATCH_TYPE_MIXED;
+	for (int k = 1; k < nsel; k++)
+		if (pvals[psel[k]].type != type)
+			return BATCH_TYPE_MIXED;
+	return type;
+}
@@ -0,0 +1,35 @@
+#ifndef MLR_DSL_BATCH_FILTER_H
+#define MLR_DSL_BATCH_FILTER_H
+
+#include "containers/lrec.h"
+#include "dsl/mlr_dsl_cst.h"
+
+// ================================================================
+// Column-at-a-time evaluation of mlr filter expressions over blocks of records.
+//
+// The per-record path walks the full evaluator tree once per record. For a
+// filter whose expression is side-effect-free -- field values, literals,
+// arithmetic, comparisons, and boolean operators, with no begin/end blocks,
+// locals, functions, or output statements -- the block's field values are
+// instead gathered into typed columns and each operator is evaluated as a loop
+// over its operand columns. The result is a selection mask for the block.
+//
+// Results, including absent/empty/error semantics, are the same as for the
+// per-record path: columns which aren't uniformly int/float/boolean go through
+// the same disposition matrices row by row.
+// ================================================================
+
+typedef struct _batch_filter_t batch_filter_t;
+
+// Returns NULL if the filter expression isn't eligible for batch evaluation,
+// in which case the caller should use the per-record path.
+batch_filter_t* batch_filter_alloc(mlr_dsl_cst_t* pcst, int negate_final_filter, int type_inferencing,
+	int block_size);
+
+void batch_filter_free(batch_filter_t* pfilter);
+
+// Sets pmask[i] to TRUE for records which pass the filter, else FALSE. The
+// number of records must be at most the block size.
+void batch_filter_evaluate(batch_filter_t* pfilter, lrec_t** precs, int nrecs, char* pmask);
+
+#endif // MLR_DSL_BATCH_FILTER_H
@@ -19,6 +19,9 @@ static mlr_dsl_ast_node_t* get_list_for_block(mlr_dsl_ast_node_t* pnode);
 mlr_dsl_cst_statement_t* mlr_dsl_cst_alloc_final_filter_statement(mlr_dsl_cst_t* pcst,
 	mlr_dsl_ast_node_t* pnode, int negate_final_filter, int type_inferencing, int context_flags);
 static void mlr_dsl_cst_resolve_subr_callsites(mlr_dsl_cst_t* pcst);
+static mlr_dsl_cst_t* mlr_dsl_cst_alloc_aux(mlr_dsl_ast_t* past, int print_ast, int trace_stack_allocation,
+	int type_inferencing, int flush_every_record, int do_final_filter, int negate_final_filter,
+	int do_optimize, int* ppruned);
 
 // ----------------------------------------------------------------
 // Main entry point for AST-to-CST for mlr put and mlr filter.
@@ -58,6 +61,34 @@ static void mlr_dsl_cst_resolve_subr_callsites(mlr_dsl_cst_t* pcst);
 mlr_dsl_cst_t* mlr_dsl_cst_alloc(mlr_dsl_ast_t* past, int print_ast, int trace_stack_allocation,
 	int type_inferencing, int flush_every_record,
 	int do_final_filter, int negate_final_filter) // for mlr filter
+{
+	// The CST build is where semantic checks are done, so code which the optimizer prunes would go
+	// unchecked. In that case build a throwaway CST from an unoptimized copy of the AST as well.
+	mlr_dsl_ast_t* punoptimized = NULL;
+	if (past->proot != NULL) {
+		punoptimized = mlr_dsl_ast_alloc();
+		punoptimized->proot = mlr_dsl_ast_tree_copy(past->proot);
+	}
+
+	int pruned = FALSE;
+	mlr_dsl_cst_t* pcst = mlr_dsl_cst_alloc_aux(past, print_ast, trace_stack_allocation, type_inferencing,
+		flush_every_record, do_final_filter, negate_final_filter, TRUE, &pruned);
+
+	if (punoptimized != NULL) {
+		if (pruned) {
+			mlr_dsl_cst_t* pcheck = mlr_dsl_cst_alloc_aux(punoptimized, FALSE, FALSE, type_inferencing,
+				flush_every_record, do_final_filter, negate_final_filter, FALSE, &pruned);
+			mlr_dsl_cst_free(pcheck, NULL);
+		}
+		mlr_dsl_ast_free(punoptimized);
+	}
+
+	return pcst;
+}
+
+static mlr_dsl_cst_t* mlr_dsl_cst_alloc_aux(mlr_dsl_ast_t* past, int print_ast, int trace_stack_allocation,
+	int type_inferencing, int flush_every_record, int do_final_filter, int negate_final_filter,
+	int do_optimize, int* ppruned)
 {
 	int context_flags = do_final_filter ? IN_MLR_FILTER : 0;
 	// The root node is not populated on empty-string input to the parser.
@@ -82,6 +113,10 @@ mlr_dsl_cst_t* mlr_dsl_cst_alloc(mlr_dsl_ast_t* past, int print_ast, int trace_s
 	pcst->psubr_callsite_statements_to_resolve = sllv_alloc();
 	pcst->flush_every_record = flush_every_record;
 
+	// Fold constant expressions and prune branches which can never run.
+	if (do_optimize)
+		*ppruned = blocked_ast_optimize(pcst->paast, pcst->pfmgr);
+
 	if (print_ast) {
 		printf("\n");
 		printf("BLOCKED AST:\n");
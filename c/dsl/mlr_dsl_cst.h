@@ -60,6 +60,12 @@
 // before the CST is build (mlr_dsl_stack_allocate.c).
 void blocked_ast_allocate_locals(blocked_ast_t* paast, int trace);
 
+// ----------------------------------------------------------------
+// dsl/mlr_dsl_optimize.c
+// Constant folding and dead-branch pruning on the block-structured AST, after
+// stack allocation and before the CST is built. Returns TRUE if any code was pruned.
+int blocked_ast_optimize(blocked_ast_t* paast, fmgr_t* pfmgr);
+
 // ----------------------------------------------------------------
 // Forward references for virtual-function prototypes
 struct _mlr_dsl_cst_t;
@@ -212,7 +212,7 @@ static void handle_for_map_aux(
 			// The submap was too shallow for the user-specified k-names; there are no terminals here.
 		} else {
 			// Loop over keys at this submap level:
-			for (mlhmmv_level_entry_t* pe = psubmap->pnext_level->phead; pe != NULL; pe = pe->pnext) {
+			for (mlhmmv_level_entry_t* pe = mlhmmv_level_first(psubmap->pnext_level); pe != NULL; pe = mlhmmv_level_next(psubmap->pnext_level, pe)) {
 				// Bind the k-name to the entry-key mlrval:
 				local_stack_frame_t* pframe = local_stack_get_top_frame(pvars->plocal_stack);
 				// xxx note copy/ref semantics
@@ -78,7 +78,7 @@ static void handle_full_srec_assignment(
 	boxed_xval_t boxed_xval = prhs_xevaluator->pprocess_func(prhs_xevaluator->pvstate, pvars);
 
 	if (!boxed_xval.xval.is_terminal) {
-		for (mlhmmv_level_entry_t* pe = boxed_xval.xval.pnext_level->phead; pe != NULL; pe = pe->pnext) {
+		for (mlhmmv_level_entry_t* pe = mlhmmv_level_first(boxed_xval.xval.pnext_level); pe != NULL; pe = mlhmmv_level_next(boxed_xval.xval.pnext_level, pe)) {
 			mv_t* pkey = &pe->level_key;
 			mlhmmv_xvalue_t* pval = &pe->level_xvalue;
 
@@ -522,7 +522,7 @@ static void handle_full_oosvar_assignment_from_xval(
 		} else {
 			mlhmmv_xvalue_t copy = mlhmmv_xvalue_copy(&boxed_xval.xval);
 			mlhmmv_root_clear(pvars->poosvars);
-			for (mlhmmv_level_entry_t* pe = copy.pnext_level->phead; pe != NULL; pe = pe->pnext) {
+			for (mlhmmv_level_entry_t* pe = mlhmmv_level_first(copy.pnext_level); pe != NULL; pe = mlhmmv_level_next(copy.pnext_level, pe)) {
 				// xxx comment: value transfer not copy.
 				mlhmmv_level_put_xvalue_singly_keyed(pvars->poosvars->root_xvalue.pnext_level, &pe->level_key, &pe->level_xvalue);
 				pe->level_xvalue.terminal_mlrval = mv_absent();
@@ -0,0 +1,270 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "lib/mlr_globals.h"
+#include "lib/mlrutil.h"
+#include "lib/mlrregex.h"
+#include "dsl/mlr_dsl_cst.h"
+
+// ================================================================
+// Ahead-of-time simplification of the block-structured AST. This runs after
+// the stack allocator and before the CST is built, so 'mlr put -v' shows the
+// simplified tree in its BLOCKED AST section.
+//
+// * Constant folding: operators and built-in functions all of whose arguments
+//   are literals are evaluated once here, rather than once per record. E.g.
+//   '$y = $x * (2 ** 10)' becomes '$y = $x * 1024'. The folded value is stored
+//   as a literal node, so it must print as a literal which reads back with the
+//   same type and value; otherwise the node is left alone.
+//
+// * Dead-branch pruning: 'true ? a : b', 'false && ...', 'true || ...', and
+//   if/elif chains with literal conditions are reduced to the part which would
+//   be executed. If-chains and while-loops which would never execute their
+//   bodies are removed.
+//
+// Since local-variable slots were already assigned, this pass never hoists
+// statements out of their curly-braced blocks: surviving blocks keep their
+// frame layouts.
+//
+// Pruned code is never turned into CST, which is where semantic checks such as
+// '$-variables are not valid within begin or end blocks' are done. So the
+// return value says whether anything was pruned, for the caller to check the
+// unoptimized AST as well.
+// ================================================================
+
+static void optimize_statement_block(mlr_dsl_ast_node_t* pnode, fmgr_t* pfmgr, int keep_last, int* ppruned);
+static void optimize_node(mlr_dsl_ast_node_t* pnode, fmgr_t* pfmgr, int* ppruned);
+static void prune_if_chain(mlr_dsl_ast_node_t* pnode, int* ppruned);
+static int  statement_is_dead(mlr_dsl_ast_node_t* pnode);
+static void replace_node_with_child(mlr_dsl_ast_node_t* pnode, mlr_dsl_ast_node_t* pchild);
+static int  replace_node_with_literal(mlr_dsl_ast_node_t* pnode, mv_t* pval);
+static int  is_boolean_literal(mlr_dsl_ast_node_t* pnode, int value);
+
+// ----------------------------------------------------------------
+int blocked_ast_optimize(blocked_ast_t* paast, fmgr_t* pfmgr) {
+	int pruned = FALSE;
+	for (sllve_t* pe = paast->pfunc_defs->phead; pe != NULL; pe = pe->pnext)
+		optimize_node(pe->pvvalue, pfmgr, &pruned);
+	for (sllve_t* pe = paast->psubr_defs->phead; pe != NULL; pe = pe->pnext)
+		optimize_node(pe->pvvalue, pfmgr, &pruned);
+	for (sllve_t* pe = paast->pbegin_blocks->phead; pe != NULL; pe = pe->pnext)
+		optimize_node(pe->pvvalue, pfmgr, &pruned);
+	// For mlr filter the last statement in the main block is the filter condition,
+	// so it isn't removed even if it's dead.
+	optimize_statement_block(paast->pmain_block, pfmgr, TRUE, &pruned);
+	for (sllve_t* pe = paast->pend_blocks->phead; pe != NULL; pe = pe->pnext)
+		optimize_node(pe->pvvalue, pfmgr, &pruned);
+	return pruned;
+}
+
+// ----------------------------------------------------------------
+static void optimize_statement_block(mlr_dsl_ast_node_t* pnode, fmgr_t* pfmgr, int keep_last, int* ppruned) {
+	sllv_t* pold_statements = pnode->pchildren;
+	sllv_t* pnew_statements = sllv_alloc();
+
+	while (pold_statements->phead != NULL) {
+		mlr_dsl_ast_node_t* pstatement = sllv_pop(pold_statements);
+		optimize_node(pstatement, pfmgr, ppruned);
+		if (statement_is_dead(pstatement) && !(keep_last && pold_statements->phead == NULL)) {
+			mlr_dsl_ast_node_free(pstatement);
+			*ppruned = TRUE;
+		} else
+			sllv_append(pnew_statements, pstatement);
+	}
+
+	sllv_free(pold_statements);
+	pnode->pchildren = pnew_statements;
+}
+
+// ----------------------------------------------------------------
+// Children are done first so that nested constant expressions fold from the bottom up,
+// e.g. '1 + 2 * 3' becomes '1 + 6' and then '7'.
+static void optimize_node(mlr_dsl_ast_node_t* pnode, fmgr_t* pfmgr, int* ppruned) {
+	if (pnode->pchildren == NULL)
+		return;
+
+	for (sllve_t* pe = pnode->pchildren->phead; pe != NULL; pe = pe->pnext) {
+		mlr_dsl_ast_node_t* pchild = pe->pvvalue;
+		if (pchild->type == MD_AST_NODE_TYPE_STATEMENT_BLOCK)
+			optimize_statement_block(pchild, pfmgr, FALSE, ppruned);
+		else
+			optimize_node(pchild, pfmgr, ppruned);
+	}
+
+	if (pnode->type == MD_AST_NODE_TYPE_IF_HEAD) {
+		prune_if_chain(pnode, ppruned);
+		return;
+	}
+
+	if (pnode->type != MD_AST_NODE_TYPE_OPERATOR && pnode->type != MD_AST_NODE_TYPE_FUNCTION_CALLSITE)
+		return;
+
+	int nchildren = pnode->pchildren->length;
+	mlr_dsl_ast_node_t* pfirst = (nchildren > 0) ? pnode->pchildren->phead->pvvalue : NULL;
+
+	// The ternary operator requires a boolean condition; anything else is a runtime error which is
+	// left to happen at runtime.
+	if (streq(pnode->text, "? :") && nchildren == 3) {
+		if (is_boolean_literal(pfirst, TRUE)) {
+			replace_node_with_child(pnode, pnode->pchildren->phead->pnext->pvvalue);
+			*ppruned = TRUE;
+		} else if (is_boolean_literal(pfirst, FALSE)) {
+			replace_node_with_child(pnode, pnode->pchildren->ptail->pvvalue);
+			*ppruned = TRUE;
+		}
+		return;
+	}
+
+	// Short-circuiting: the right-hand side isn't evaluated.
+	if (nchildren == 2) {
+		if (streq(pnode->text, "&&") && is_boolean_literal(pfirst, FALSE)) {
+			replace_node_with_child(pnode, pfirst);
+			*ppruned = TRUE;
+			return;
+		}
+		if (streq(pnode->text, "||") && is_boolean_literal(pfirst, TRUE)) {
+			replace_node_with_child(pnode, pfirst);
+			*ppruned = TRUE;
+			return;
+		}
+	}
+
+	mv_t val;
+	if (fmgr_try_evaluate_literal_callsite(pfmgr, pnode, &val)) {
+		replace_node_with_literal(pnode, &val);
+		mv_free(&val);
+	}
+}
+
+// ----------------------------------------------------------------
+// Drops if/elif items with false-literal conditions. An item with a true-literal condition
+// becomes an else, and anything after it is dropped. See mlr_dsl_cst_condish_statements.c for
+// the if-chain AST layout.
+static void prune_if_chain(mlr_dsl_ast_node_t* pnode, int* ppruned) {
+	sllv_t* pold_items = pnode->pchildren;
+	sllv_t* pnew_items = sllv_alloc();
+	int taken = FALSE;
+
+	while (pold_items->phead != NULL) {
+		mlr_dsl_ast_node_t* pitem = sllv_pop(pold_items);
+		if (taken) {
+			mlr_dsl_ast_node_free(pitem);
+			*ppruned = TRUE;
+			continue;
+		}
+		if (pitem->pchildren->length == 2) {
+			mlr_dsl_ast_node_t* pcond = pitem->pchildren->phead->pvvalue;
+			if (is_boolean_literal(pcond, FALSE)) {
+				mlr_dsl_ast_node_free(pitem);
+				*ppruned = TRUE;
+				continue;
+			} else if (is_boolean_literal(pcond, TRUE)) {
+				mlr_dsl_ast_node_free(sllv_pop(pitem->pchildren));
+				mlr_dsl_ast_node_replace_text(pitem, "else");
+				taken = TRUE;
+			}
+		}
+		sllv_append(pnew_items, pitem);
+	}
+
+	sllv_free(pold_items);
+	pnode->pchildren = pnew_items;
+}
+
+// ----------------------------------------------------------------
+static int statement_is_dead(mlr_dsl_ast_node_t* pnode) {
+	switch (pnode->type) {
+	case MD_AST_NODE_TYPE_IF_HEAD:
+		return pnode->pchildren->length == 0;
+	case MD_AST_NODE_TYPE_WHILE:
+	case MD_AST_NODE_TYPE_CONDITIONAL_BLOCK:
+		return is_boolean_literal(pnode->pchildren->phead->pvvalue, FALSE);
+	default:
+		return FALSE;
+	}
+}
+
+// ----------------------------------------------------------------
+// The child takes the parent's place in the tree; the parent's other children are freed.
+static void replace_node_with_child(mlr_dsl_ast_node_t* pnode, mlr_dsl_ast_node_t* pchild) {
+	for (sllve_t* pe = pnode->pchildren->phead; pe != NULL; pe = pe->pnext) {
+		if (pe->pvvalue != pchild)
+			mlr_dsl_ast_node_free(pe->pvvalue);
+	}
+	sllv_free(pnode->pchildren);
+	free(pnode->text);
+	*pnode = *pchild;
+	free(pchild);
+}
+
+// ----------------------------------------------------------------
+// Returns FALSE, leaving the node as-is, if the value can't be written as a literal which
+// evaluates back to the same thing.
+static int replace_node_with_literal(mlr_dsl_ast_node_t* pnode, mv_t* pval) {
+	char* text = NULL;
+	mlr_dsl_ast_node_type_t type;
+	long long intv;
+	double fltv;
+
+	switch (pval->type) {
+
+	case MT_BOOLEAN:
+		text = mlr_strdup_or_die(pval->u.boolv ? "true" : "false");
+		type = MD_AST_NODE_TYPE_BOOLEAN_LITERAL;
+		break;
+
+	case MT_INT:
+		text = mlr_alloc_string_from_ll(pval->u.intv);
+		type = MD_AST_NODE_TYPE_NUMERIC_LITERAL;
+		break;
+
+	case MT_FLOAT:
+		if (!isfinite(pval->u.fltv))
+			return FALSE;
+		// Shortest representation which reads back exactly, and which doesn't read back as an int.
+		for (int precision = 15; precision <= 17 && text == NULL; precision++) {
+			char buf[64];
+			snprintf(buf, sizeof(buf), "%.*g", precision, pval->u.fltv);
+			if (mlr_try_int_from_string(buf, &intv))
+				strcat(buf, ".0");
+			if (mlr_try_float_from_string(buf, &fltv) && fltv == pval->u.fltv
+				&& !mlr_try_int_from_string(buf, &intv))
+			{
+				text = mlr_strdup_or_die(buf);
+			}
+		}
+		if (text == NULL)
+			return FALSE;
+		type = MD_AST_NODE_TYPE_NUMERIC_LITERAL;
+		break;
+
+	case MT_STRING:
+		// A string literal containing "\1" etc. would be interpolated from regex captures at runtime.
+		if (string_has_regex_captures(pval->u.strv))
+			return FALSE;
+		text = mlr_strdup_or_die(pval->u.strv);
+		type = MD_AST_NODE_TYPE_STRING_LITERAL;
+		break;
+
+	default:
+		// E.g. empty: string literals are never empty-typed.
+		return FALSE;
+	}
+
+	for (sllve_t* pe = pnode->pchildren->phead; pe != NULL; pe = pe->pnext)
+		mlr_dsl_ast_node_free(pe->pvvalue);
+	sllv_free(pnode->pchildren);
+	pnode->pchildren = NULL;
+	free(pnode->text);
+	pnode->text = text;
+	pnode->type = type;
+	return TRUE;
+}
+
+// ----------------------------------------------------------------
+static int is_boolean_literal(mlr_dsl_ast_node_t* pnode, int value) {
+	if (pnode->type != MD_AST_NODE_TYPE_BOOLEAN_LITERAL)
+		return FALSE;
+	return streq(pnode->text, value ? "true" : "false");
+}
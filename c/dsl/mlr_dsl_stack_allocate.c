@@ -107,11 +107,14 @@
 // ================================================================
 // Pass-1 stack-frame container: simply a hashmap from name to position on the
 // frame relative to the curly-braced statement block (top-level, for-loop,
-// if-statement, else-statement, etc.).
+// if-statement, else-statement, etc.). The declared types ride along so that
+// reads of e.g. 'float x' can be marked as such, for the CST builder's
+// type-specialized evaluators.
 
 typedef struct _stkalc_subframe_t {
 	int var_count;
 	lhmsi_t* pnames_to_indices;
+	lhmsi_t* pnames_to_type_masks;
 } stkalc_subframe_t;
 
 // ----------------------------------------------------------------
@@ -125,7 +128,9 @@ static int  stkalc_subframe_test_and_get(stkalc_subframe_t* pframe, char* name,
 
 static int  stkalc_subframe_get(stkalc_subframe_t* pframe, char* name);
 
-static int  stkalc_subframe_add(stkalc_subframe_t* pframe, char* name);
+static int  stkalc_subframe_get_type_mask(stkalc_subframe_t* pframe, char* name);
+
+static int  stkalc_subframe_add(stkalc_subframe_t* pframe, char* name, int type_mask);
 
 // ================================================================
 // Pass-1 frame-group container: a linked list with current frame at the head
@@ -280,6 +285,7 @@ static void pass_1_for_func_subr_block(mlr_dsl_ast_node_t* pnode, int trace) {
 	mlr_dsl_ast_node_t* plist_node = pnode->pchildren->phead->pnext->pvvalue;
 	for (sllve_t* pe = pdef_name_node->pchildren->phead; pe != NULL; pe = pe->pnext) {
 		mlr_dsl_ast_node_t* pparameter_node = pe->pvvalue;
+		pparameter_node->vardef_type_mask = mlr_dsl_ast_node_type_to_type_mask(pparameter_node->type);
 		stkalc_subframe_group_mutate_node_for_define(pframe_group, pparameter_node, "PARAMETER", trace);
 	}
 	pass_1_for_statement_block(plist_node, pframe_group, &max_subframe_depth, trace);
@@ -463,6 +469,9 @@ static void pass_1_for_local_definition(mlr_dsl_ast_node_t* pnode, stkalc_subfra
 		pass_1_for_node(pvaluenode, pframe_group, pmax_subframe_depth, trace);
 	}
 	// Do the LHS after the RHS, in case 'var nonesuch = nonesuch'
+	pnamenode->vardef_type_mask = (pnode->type == MD_AST_NODE_TYPE_MAP_LOCAL_DEFINITION)
+		? TYPE_MASK_MAP
+		: mlr_dsl_ast_node_type_to_type_mask(pnode->type);
 	stkalc_subframe_group_mutate_node_for_define(pframe_group, pnamenode, "DEFINE", trace);
 }
 
@@ -737,6 +746,7 @@ static stkalc_subframe_t* stkalc_subframe_alloc() {
 	stkalc_subframe_t* pframe = mlr_malloc_or_die(sizeof(stkalc_subframe_t));
 	pframe->var_count = 0;
 	pframe->pnames_to_indices = lhmsi_alloc();
+	pframe->pnames_to_type_masks = lhmsi_alloc();
 	return pframe;
 }
 
@@ -744,6 +754,7 @@ static void stkalc_subframe_free(stkalc_subframe_t* pframe) {
 	if (pframe == NULL)
 		return;
 	lhmsi_free(pframe->pnames_to_indices);
+	lhmsi_free(pframe->pnames_to_type_masks);
 	free(pframe);
 }
 
@@ -755,9 +766,14 @@ static int stkalc_subframe_get(stkalc_subframe_t* pframe, char* name) {
 	return lhmsi_get(pframe->pnames_to_indices, name);
 }
 
-static int stkalc_subframe_add(stkalc_subframe_t* pframe, char* name) {
+static int stkalc_subframe_get_type_mask(stkalc_subframe_t* pframe, char* name) {
+	return lhmsi_get(pframe->pnames_to_type_masks, name);
+}
+
+static int stkalc_subframe_add(stkalc_subframe_t* pframe, char* name, int type_mask) {
 	int rv = pframe->var_count;
 	lhmsi_put(pframe->pnames_to_indices, name, pframe->var_count, NO_FREE);
+	lhmsi_put(pframe->pnames_to_type_masks, name, type_mask, NO_FREE);
 	pframe->var_count++;
 	return rv;
 }
@@ -767,7 +783,7 @@ static stkalc_subframe_group_t* stkalc_subframe_group_alloc(stkalc_subframe_t* p
 	stkalc_subframe_group_t* pframe_group = mlr_malloc_or_die(sizeof(stkalc_subframe_group_t));
 	pframe_group->plist = sllv_alloc();
 	sllv_push(pframe_group->plist, pframe);
-	stkalc_subframe_add(pframe, "");
+	stkalc_subframe_add(pframe, "", TYPE_MASK_ANY);
 	if (trace) {
 		leader_print(pframe_group->plist->length);
 		printf("ADD FOR ABSENT s @ %du%d\n", 0, 0);
@@ -804,7 +820,7 @@ static void stkalc_subframe_group_mutate_node_for_define(stkalc_subframe_group_t
 			MLR_GLOBALS.bargv0, pnode->text);
 		exit(1);
 	} else {
-		pnode->vardef_subframe_relative_index = stkalc_subframe_add(pframe, pnode->text);
+		pnode->vardef_subframe_relative_index = stkalc_subframe_add(pframe, pnode->text, pnode->vardef_type_mask);
 	}
 	if (trace) {
 		leader_print(pframe_group->plist->length);
@@ -827,6 +843,7 @@ static void stkalc_subframe_group_mutate_node_for_write(stkalc_subframe_group_t*
 	for (sllve_t* pe = pframe_group->plist->phead; pe != NULL; pe = pe->pnext, pnode->vardef_subframe_index--) {
 		stkalc_subframe_t* pframe = pe->pvvalue;
 		if (stkalc_subframe_test_and_get(pframe, pnode->text, &pnode->vardef_subframe_relative_index)) {
+			pnode->vardef_type_mask = stkalc_subframe_get_type_mask(pframe, pnode->text);
 			found = TRUE;
 			break;
 		}
@@ -836,7 +853,7 @@ static void stkalc_subframe_group_mutate_node_for_write(stkalc_subframe_group_t*
 	if (!found) {
 		pnode->vardef_subframe_index = pframe_group->plist->length - 1;
 		stkalc_subframe_t* pframe = pframe_group->plist->phead->pvvalue;
-		pnode->vardef_subframe_relative_index = stkalc_subframe_add(pframe, pnode->text);
+		pnode->vardef_subframe_relative_index = stkalc_subframe_add(pframe, pnode->text, TYPE_MASK_ANY);
 		op = "ADD";
 	}
 
@@ -864,6 +881,7 @@ static void stkalc_subframe_group_mutate_node_for_read(stkalc_subframe_group_t*
 	for (sllve_t* pe = pframe_group->plist->phead; pe != NULL; pe = pe->pnext, pnode->vardef_subframe_index--) {
 		stkalc_subframe_t* pframe = pe->pvvalue;
 		if (stkalc_subframe_test_and_get(pframe, pnode->text, &pnode->vardef_subframe_relative_index)) {
+			pnode->vardef_type_mask = stkalc_subframe_get_type_mask(pframe, pnode->text);
 			found = TRUE;
 			break;
 		}
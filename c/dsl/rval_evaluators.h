@@ -116,6 +116,18 @@ rval_evaluator_t* rval_evaluator_alloc_from_x_xx_func(mv_binary_func_t* pfunc,
 	rval_evaluator_t* parg1, rval_evaluator_t* parg2);
 rval_evaluator_t* rval_evaluator_alloc_from_x_xx_nullable_func(mv_binary_func_t* pfunc,
 	rval_evaluator_t* parg1, rval_evaluator_t* parg2);
+
+// Type-specialized versions of the above for operands statically known to be numeric.
+rval_evaluator_t* rval_evaluator_alloc_from_f_nn_plus_func  (rval_evaluator_t* parg1, rval_evaluator_t* parg2);
+rval_evaluator_t* rval_evaluator_alloc_from_f_nn_minus_func (rval_evaluator_t* parg1, rval_evaluator_t* parg2);
+rval_evaluator_t* rval_evaluator_alloc_from_f_nn_times_func (rval_evaluator_t* parg1, rval_evaluator_t* parg2);
+rval_evaluator_t* rval_evaluator_alloc_from_f_nn_divide_func(rval_evaluator_t* parg1, rval_evaluator_t* parg2);
+rval_evaluator_t* rval_evaluator_alloc_from_b_nn_eq_func(rval_evaluator_t* parg1, rval_evaluator_t* parg2);
+rval_evaluator_t* rval_evaluator_alloc_from_b_nn_ne_func(rval_evaluator_t* parg1, rval_evaluator_t* parg2);
+rval_evaluator_t* rval_evaluator_alloc_from_b_nn_gt_func(rval_evaluator_t* parg1, rval_evaluator_t* parg2);
+rval_evaluator_t* rval_evaluator_alloc_from_b_nn_ge_func(rval_evaluator_t* parg1, rval_evaluator_t* parg2);
+rval_evaluator_t* rval_evaluator_alloc_from_b_nn_lt_func(rval_evaluator_t* parg1, rval_evaluator_t* parg2);
+rval_evaluator_t* rval_evaluator_alloc_from_b_nn_le_func(rval_evaluator_t* parg1, rval_evaluator_t* parg2);
 rval_evaluator_t* rval_evaluator_alloc_from_f_fff_func(mv_ternary_func_t* pfunc,
 	rval_evaluator_t* parg1, rval_evaluator_t* parg2, rval_evaluator_t* parg3);
 rval_evaluator_t* rval_evaluator_alloc_from_i_ii_func(mv_binary_func_t* pfunc,
@@ -171,6 +183,14 @@ rval_evaluator_t* rval_evaluator_alloc_from_s_sss_func(mv_ternary_func_t* pfunc,
 rval_evaluator_t* rval_evaluator_alloc_from_x_srs_func(mv_ternary_arg2_regex_func_t* pfunc,
 	rval_evaluator_t* parg1, char* regex_string, int ignore_case, rval_evaluator_t* parg3);
 
+// String-function chains: the arena-func evaluators write their string outputs to the string arena in
+// variables_t, so they must only be used for arguments of other arena-func evaluators. The topmost one
+// is wrapped by rval_evaluator_alloc_from_string_chain which copies its result out of the arena.
+rval_evaluator_t* rval_evaluator_alloc_from_s_s_arena_func(mv_unary_arena_func_t* pfunc, rval_evaluator_t* parg1);
+rval_evaluator_t* rval_evaluator_alloc_from_x_xx_arena_func(mv_binary_arena_func_t* pfunc,
+	rval_evaluator_t* parg1, rval_evaluator_t* parg2);
+rval_evaluator_t* rval_evaluator_alloc_from_string_chain(rval_evaluator_t* ptop);
+
 // ================================================================
 // rval_list_evaluators.c
 // ================================================================
@@ -436,6 +436,71 @@ rval_evaluator_t* rval_evaluator_alloc_from_x_xx_func(mv_binary_func_t* pfunc,
 	return pevaluator;
 }
 
+// ----------------------------------------------------------------
+// Type-specialized arithmetic and comparison operators. The CST builder selects these when both operands are
+// known ahead of time to be numeric, e.g. literals or typed locals as in 'float x = ...; $y = x * 2.5'. The int
+// and float cases are computed inline; anything else seen at runtime (e.g. absent) falls back to the
+// disposition matrices in pfunc so results are the same as for rval_evaluator_x_xx_func.
+//
+// Int-int arithmetic is not inlined since it has overflow-to-float handling: see lib/mvfuncs.c.
+
+#define DEFINE_F_NN_EVALUATOR(name, op, generic_func) \
+static mv_t rval_evaluator_f_nn_##name##_func(void* pvstate, variables_t* pvars) { \
+	rval_evaluator_x_xx_state_t* pstate = pvstate; \
+	mv_t val1 = pstate->parg1->pprocess_func(pstate->parg1->pvstate, pvars); \
+	mv_t val2 = pstate->parg2->pprocess_func(pstate->parg2->pvstate, pvars); \
+	if (val1.type == MT_FLOAT) { \
+		if (val2.type == MT_FLOAT) \
+			return mv_from_float(val1.u.fltv op val2.u.fltv); \
+		else if (val2.type == MT_INT) \
+			return mv_from_float(val1.u.fltv op (double)val2.u.intv); \
+	} else if (val1.type == MT_INT && val2.type == MT_FLOAT) { \
+		return mv_from_float((double)val1.u.intv op val2.u.fltv); \
+	} \
+	return pstate->pfunc(&val1, &val2); \
+} \
+rval_evaluator_t* rval_evaluator_alloc_from_f_nn_##name##_func(rval_evaluator_t* parg1, rval_evaluator_t* parg2) { \
+	rval_evaluator_t* pevaluator = rval_evaluator_alloc_from_x_xx_func(generic_func, parg1, parg2); \
+	pevaluator->pprocess_func = rval_evaluator_f_nn_##name##_func; \
+	return pevaluator; \
+}
+
+#define DEFINE_B_NN_EVALUATOR(name, op, generic_func) \
+static mv_t rval_evaluator_b_nn_##name##_func(void* pvstate, variables_t* pvars) { \
+	rval_evaluator_x_xx_state_t* pstate = pvstate; \
+	mv_t val1 = pstate->parg1->pprocess_func(pstate->parg1->pvstate, pvars); \
+	mv_t val2 = pstate->parg2->pprocess_func(pstate->parg2->pvstate, pvars); \
+	if (val1.type == MT_INT) { \
+		if (val2.type == MT_INT) \
+			return mv_from_bool(val1.u.intv op val2.u.intv); \
+		else if (val2.type == MT_FLOAT) \
+			return mv_from_bool(val1.u.intv op val2.u.fltv); \
+	} else if (val1.type == MT_FLOAT) { \
+		if (val2.type == MT_FLOAT) \
+			return mv_from_bool(val1.u.fltv op val2.u.fltv); \
+		else if (val2.type == MT_INT) \
+			return mv_from_bool(val1.u.fltv op val2.u.intv); \
+	} \
+	return pstate->pfunc(&val1, &val2); \
+} \
+rval_evaluator_t* rval_evaluator_alloc_from_b_nn_##name##_func(rval_evaluator_t* parg1, rval_evaluator_t* parg2) { \
+	rval_evaluator_t* pevaluator = rval_evaluator_alloc_from_x_xx_func(generic_func, parg1, parg2); \
+	pevaluator->pprocess_func = rval_evaluator_b_nn_##name##_func; \
+	return pevaluator; \
+}
+
+DEFINE_F_NN_EVALUATOR(plus,   +, x_xx_plus_func)
+DEFINE_F_NN_EVALUATOR(minus,  -, x_xx_minus_func)
+DEFINE_F_NN_EVALUATOR(times,  *, x_xx_times_func)
+DEFINE_F_NN_EVALUATOR(divide, /, x_xx_divide_func)
+
+DEFINE_B_NN_EVALUATOR(eq, ==, eq_op_func)
+DEFINE_B_NN_EVALUATOR(ne, !=, ne_op_func)
+DEFINE_B_NN_EVALUATOR(gt, >,  gt_op_func)
+DEFINE_B_NN_EVALUATOR(ge, >=, ge_op_func)
+DEFINE_B_NN_EVALUATOR(lt, <,  lt_op_func)
+DEFINE_B_NN_EVALUATOR(le, <=, le_op_func)
+
 // ----------------------------------------------------------------
 // This is for min/max which can return non-null when one argument is null --
 // in comparison to other functions which return null if *any* argument is
@@ -1117,7 +1182,7 @@ rval_evaluator_t* rval_evaluator_alloc_from_x_ssc_func(mv_binary_arg3_capture_fu
 typedef struct _rval_evaluator_x_sr_state_t {
 	mv_binary_arg2_regex_func_t* pfunc;
 	rval_evaluator_t*             parg1;
-	regex_t                       regex;
+	mlr_regex_t                   regex;
 	string_builder_t*             psb;
 } rval_evaluator_x_sr_state_t;
 
@@ -1134,7 +1199,7 @@ static mv_t rval_evaluator_x_sr_func(void* pvstate, variables_t* pvars) {
 static void rval_evaluator_x_sr_free(rval_evaluator_t* pevaluator) {
 	rval_evaluator_x_sr_state_t* pstate = pevaluator->pvstate;
 	pstate->parg1->pfree_func(pstate->parg1);
-	regfree(&pstate->regex);
+	mlr_regfree(&pstate->regex);
 	sb_free(pstate->psb);
 	free(pstate);
 	free(pevaluator);
@@ -1148,7 +1213,7 @@ rval_evaluator_t* rval_evaluator_alloc_from_x_sr_func(mv_binary_arg2_regex_func_
 	pstate->parg1 = parg1;
 
 	int cflags = ignore_case ? REG_ICASE : 0;
-	regcomp_or_die(&pstate->regex, regex_string, cflags);
+	mlr_regcomp_or_die(&pstate->regex, regex_string, cflags);
 	pstate->psb = sb_alloc(MV_SB_ALLOC_LENGTH);
 
 	rval_evaluator_t* pevaluator = mlr_malloc_or_die(sizeof(rval_evaluator_t));
@@ -1262,7 +1327,7 @@ rval_evaluator_t* rval_evaluator_alloc_from_s_sss_func(mv_ternary_func_t* pfunc,
 typedef struct _rval_evaluator_x_srs_state_t {
 	mv_ternary_arg2_regex_func_t* pfunc;
 	rval_evaluator_t*             parg1;
-	regex_t                       regex;
+	mlr_regex_t                   regex;
 	rval_evaluator_t*             parg3;
 	string_builder_t*             psb;
 } rval_evaluator_x_srs_state_t;
@@ -1287,7 +1352,7 @@ static mv_t rval_evaluator_x_srs_func(void* pvstate, variables_t* pvars) {
 static void rval_evaluator_x_srs_free(rval_evaluator_t* pevaluator) {
 	rval_evaluator_x_srs_state_t* pstate = pevaluator->pvstate;
 	pstate->parg1->pfree_func(pstate->parg1);
-	regfree(&pstate->regex);
+	mlr_regfree(&pstate->regex);
 	pstate->parg3->pfree_func(pstate->parg3);
 	sb_free(pstate->psb);
 	free(pstate);
@@ -1303,7 +1368,7 @@ rval_evaluator_t* rval_evaluator_alloc_from_x_srs_func(mv_ternary_arg2_regex_fun
 	pstate->parg1 = parg1;
 
 	int cflags = ignore_case ? REG_ICASE : 0;
-	regcomp_or_die(&pstate->regex, regex_string, cflags);
+	mlr_regcomp_or_die(&pstate->regex, regex_string, cflags);
 	pstate->psb = sb_alloc(MV_SB_ALLOC_LENGTH);
 
 	pstate->parg3 = parg3;
@@ -1315,3 +1380,126 @@ rval_evaluator_t* rval_evaluator_alloc_from_x_srs_func(mv_ternary_arg2_regex_fun
 
 	return pevaluator;
 }
+
+// ================================================================
+// String-function chains such as 'toupper($a . "-" . $b)'. Functions in the
+// chain whose outputs are only ever inputs to other functions in the chain
+// write their outputs to the string arena in variables_t, rather than mallocing
+// and freeing one string per function per record. The chain's topmost function
+// is wrapped in a string-chain evaluator, which copies the result to the heap if
+// it's arena-backed, then releases the arena back to where it was when the
+// chain started. So nothing in the arena outlives the chain, even in loops, and
+// nothing written to fields, oosvars, or locals points into it.
+// ================================================================
+
+typedef struct _rval_evaluator_s_s_arena_state_t {
+	mv_unary_arena_func_t* pfunc;
+	rval_evaluator_t*      parg1;
+} rval_evaluator_s_s_arena_state_t;
+
+static mv_t rval_evaluator_s_s_arena_func(void* pvstate, variables_t* pvars) {
+	rval_evaluator_s_s_arena_state_t* pstate = pvstate;
+	mv_t val1 = pstate->parg1->pprocess_func(pstate->parg1->pvstate, pvars);
+	NULL_OR_ERROR_OUT_FOR_STRINGS(val1);
+	if (!mv_is_string_or_empty(&val1))
+		return mv_error();
+
+	return pstate->pfunc(&val1, pvars->pstring_arena);
+}
+static void rval_evaluator_s_s_arena_free(rval_evaluator_t* pevaluator) {
+	rval_evaluator_s_s_arena_state_t* pstate = pevaluator->pvstate;
+	pstate->parg1->pfree_func(pstate->parg1);
+	free(pstate);
+	free(pevaluator);
+}
+
+rval_evaluator_t* rval_evaluator_alloc_from_s_s_arena_func(mv_unary_arena_func_t* pfunc, rval_evaluator_t* parg1) {
+	rval_evaluator_s_s_arena_state_t* pstate = mlr_malloc_or_die(sizeof(rval_evaluator_s_s_arena_state_t));
+	pstate->pfunc = pfunc;
+	pstate->parg1 = parg1;
+
+	rval_evaluator_t* pevaluator = mlr_malloc_or_die(sizeof(rval_evaluator_t));
+	pevaluator->pvstate = pstate;
+	pevaluator->pprocess_func = rval_evaluator_s_s_arena_func;
+	pevaluator->pfree_func = rval_evaluator_s_s_arena_free;
+
+	return pevaluator;
+}
+
+// ----------------------------------------------------------------
+typedef struct _rval_evaluator_x_xx_arena_state_t {
+	mv_binary_arena_func_t* pfunc;
+	rval_evaluator_t*       parg1;
+	rval_evaluator_t*       parg2;
+} rval_evaluator_x_xx_arena_state_t;
+
+static mv_t rval_evaluator_x_xx_arena_func(void* pvstate, variables_t* pvars) {
+	rval_evaluator_x_xx_arena_state_t* pstate = pvstate;
+	mv_t val1 = pstate->parg1->pprocess_func(pstate->parg1->pvstate, pvars);
+	mv_t val2 = pstate->parg2->pprocess_func(pstate->parg2->pvstate, pvars);
+
+	// nullities handled by full disposition matrices
+	return pstate->pfunc(&val1, &val2, pvars->pstring_arena);
+}
+static void rval_evaluator_x_xx_arena_free(rval_evaluator_t* pevaluator) {
+	rval_evaluator_x_xx_arena_state_t* pstate = pevaluator->pvstate;
+	pstate->parg1->pfree_func(pstate->parg1);
+	pstate->parg2->pfree_func(pstate->parg2);
+	free(pstate);
+	free(pevaluator);
+}
+
+rval_evaluator_t* rval_evaluator_alloc_from_x_xx_arena_func(mv_binary_arena_func_t* pfunc,
+	rval_evaluator_t* parg1, rval_evaluator_t* parg2)
+{
+	rval_evaluator_x_xx_arena_state_t* pstate = mlr_malloc_or_die(sizeof(rval_evaluator_x_xx_arena_state_t));
+	pstate->pfunc = pfunc;
+	pstate->parg1 = parg1;
+	pstate->parg2 = parg2;
+
+	rval_evaluator_t* pevaluator = mlr_malloc_or_die(sizeof(rval_evaluator_t));
+	pevaluator->pvstate = pstate;
+	pevaluator->pprocess_func = rval_evaluator_x_xx_arena_func;
+	pevaluator->pfree_func = rval_evaluator_x_xx_arena_free;
+
+	return pevaluator;
+}
+
+// ----------------------------------------------------------------
+typedef struct _rval_evaluator_string_chain_state_t {
+	rval_evaluator_t* ptop;
+} rval_evaluator_string_chain_state_t;
+
+static mv_t rval_evaluator_string_chain_func(void* pvstate, variables_t* pvars) {
+	rval_evaluator_string_chain_state_t* pstate = pvstate;
+	string_arena_t* parena = pvars->pstring_arena;
+	if (parena == NULL)
+		return pstate->ptop->pprocess_func(pstate->ptop->pvstate, pvars);
+
+	string_arena_mark_t mark = string_arena_mark(parena);
+	mv_t val = pstate->ptop->pprocess_func(pstate->ptop->pvstate, pvars);
+	// Arena-backed results are NO_FREE strings. So are string literals passed through, e.g. by
+	// '"abc" . ""', which are copied needlessly but harmlessly.
+	if (val.type == MT_STRING && !(val.free_flags & FREE_ENTRY_VALUE))
+		val = mv_copy(&val);
+	string_arena_release(parena, mark);
+	return val;
+}
+static void rval_evaluator_string_chain_free(rval_evaluator_t* pevaluator) {
+	rval_evaluator_string_chain_state_t* pstate = pevaluator->pvstate;
+	pstate->ptop->pfree_func(pstate->ptop);
+	free(pstate);
+	free(pevaluator);
+}
+
+rval_evaluator_t* rval_evaluator_alloc_from_string_chain(rval_evaluator_t* ptop) {
+	rval_evaluator_string_chain_state_t* pstate = mlr_malloc_or_die(sizeof(rval_evaluator_string_chain_state_t));
+	pstate->ptop = ptop;
+
+	rval_evaluator_t* pevaluator = mlr_malloc_or_die(sizeof(rval_evaluator_t));
+	pevaluator->pvstate = pstate;
+	pevaluator->pprocess_func = rval_evaluator_string_chain_func;
+	pevaluator->pfree_func = rval_evaluator_string_chain_free;
+
+	return pevaluator;
+}
@@ -20,6 +20,9 @@
 //
 //   o It is up to mapper_put to write "left"=>"abc" and "right"=>"def" into the lrec.
 //
+// * String-function chains such as 'toupper($a . "-" . $b)' put their intermediate values in the string arena,
+//   which is owned by the caller and may be NULL. See rval_evaluator_alloc_from_string_chain.
+//
 // See also the comments above mapper_put.c for more information about left-hand sides (lvals).
 // ================================================================
 
@@ -32,6 +35,7 @@
 #include "containers/mlhmmv.h"
 #include "lib/context.h"
 #include "containers/local_stack.h"
+#include "lib/string_arena.h"
 #include "dsl/return_state.h"
 
 // Context for DSL evaluation
@@ -47,6 +51,7 @@ typedef struct _variables_t {
 	int              trace_execution;
 	int              json_quote_int_keys;
 	int              json_quote_non_string_values;
+	string_arena_t*  pstring_arena;
 } variables_t;
 
 #endif // VARIABLES_H
@@ -73,6 +73,47 @@ void file_reader_mmap_close(file_reader_mmap_state_t* pstate, char* prepipe) {
 	free(pstate);
 }
 
+// ----------------------------------------------------------------
+char* file_reader_mmap_get_last_line(file_reader_mmap_state_t* pstate, char* irs, int irslen,
+	char** peol, int* pterminated)
+{
+	if (pstate->eof <= pstate->sol)
+		return NULL;
+
+	// Only the final line may be unterminated.
+	char* eol = pstate->eof;
+	*pterminated = FALSE;
+	if (eol - pstate->sol >= irslen && memcmp(eol - irslen, irs, irslen) == 0) {
+		eol -= irslen;
+		*pterminated = TRUE;
+	}
+
+	char* line = eol;
+	if (irslen == 1) {
+		char irs0 = irs[0];
+		while (line > pstate->sol && line[-1] != irs0)
+			line--;
+	} else {
+		while (line - pstate->sol >= irslen && memcmp(line - irslen, irs, irslen) != 0)
+			line--;
+		if (line - pstate->sol < irslen)
+			line = pstate->sol;
+	}
+
+	pstate->eof = line;
+	*peol = eol;
+	return line;
+}
+
+char* file_reader_mmap_get_first_line_end(file_reader_mmap_state_t* pstate, char* irs, int irslen) {
+	if (irslen == 1)
+		return memchr(pstate->sol, irs[0], pstate->eof - pstate->sol);
+	for (char* p = pstate->sol; pstate->eof - p >= irslen; p++)
+		if (memcmp(p, irs, irslen) == 0)
+			return p;
+	return NULL;
+}
+
 // ----------------------------------------------------------------
 void* file_reader_mmap_vopen(void* pvstate, char* prepipe, char* file_name) {
 	return file_reader_mmap_open(prepipe, file_name);
@@ -14,6 +14,16 @@ typedef struct _file_reader_mmap_state_t {
 file_reader_mmap_state_t* file_reader_mmap_open(char* prepipe, char* file_name);
 void file_reader_mmap_close(file_reader_mmap_state_t* pstate, char* prepipe);
 
+// For reading backward: returns the last line before eof, moving eof back to the start of it, or null if
+// there are no lines left. The line ends at *peol, not including its line terminator if it has one, which
+// *pterminated says. Nothing is zero-poked.
+char* file_reader_mmap_get_last_line(file_reader_mmap_state_t* pstate, char* irs, int irslen,
+	char** peol, int* pterminated);
+
+// For line-terminator autodetection when reading backward, which should go by the first line as when reading
+// forward: returns where the first line's terminator starts, or null if there is none before eof.
+char* file_reader_mmap_get_first_line_end(file_reader_mmap_state_t* pstate, char* irs, int irslen);
+
 void* file_reader_mmap_vopen(void* pvstate, char* prepipe, char* file_name);
 void file_reader_mmap_vclose(void* pvstate, void* pvhandle, char* prepipe);
 
@@ -4,6 +4,7 @@
 #include <stdio.h>
 #include "lib/context.h"
 #include "containers/lrec.h"
+#include "containers/hss.h"
 #include "input/file_reader_mmap.h"
 
 struct _lrec_reader_t; // forward reference for method declarations
@@ -14,6 +15,21 @@ typedef void    lrec_reader_close_func_t(void* pvstate, void* pvhandle, char* pr
 typedef lrec_t* lrec_reader_process_func_t(void* pvstate, void* pvhandle, context_t* pctx);
 typedef void    lrec_reader_sof_func_t(void* pvstate, void* pvhandle);
 typedef void    lrec_reader_free_func_t(struct _lrec_reader_t* preader);
+// Projection pushdown: the reader may skip fields whose names aren't in the set, which it doesn't
+// copy. A null set means all fields are wanted, which is the default.
+typedef void    lrec_reader_set_projection_func_t(void* pvstate, hss_t* pprojection);
+// Predicate pushdown: the reader may drop lines which can't pass the prefilter (see lrec_readers.h),
+// counting them in NR and FNR without building records for them. Null, the default, means none.
+struct _lrec_prefilter_t;
+typedef void    lrec_reader_set_prefilter_func_t(void* pvstate, struct _lrec_prefilter_t* pprefilter);
+// Offset-based retention: switches the reader to leaving its input intact, so that records can be
+// re-parsed later from where they are in it (see lrec_readers.h). The reader owns the retainer.
+struct _lrec_retainer_t;
+typedef struct _lrec_retainer_t* lrec_reader_alloc_retainer_func_t(struct _lrec_reader_t* preader);
+// Reverse reading, for mmapped regular files: after the start-of-file hook, the backward process function
+// returns the file's records last one first. The count function says how many records the file has, which
+// may take a pass over the file.
+typedef long long lrec_reader_count_func_t(void* pvstate, void* pvhandle, context_t* pctx);
 
 typedef struct _lrec_reader_t {
 	void*                       pvstate;
@@ -22,6 +38,11 @@ typedef struct _lrec_reader_t {
 	lrec_reader_process_func_t* pprocess_func;
 	lrec_reader_sof_func_t*     psof_func;
 	lrec_reader_free_func_t*    pfree_func; // virtual destructor
+	lrec_reader_set_projection_func_t* pset_projection_func; // Null if the reader doesn't support projection
+	lrec_reader_set_prefilter_func_t*  pset_prefilter_func;  // Null if the reader doesn't support prefilters
+	lrec_reader_alloc_retainer_func_t* palloc_retainer_func; // Null if the reader can't re-parse records
+	lrec_reader_process_func_t*        pprocess_backward_func; // Null if the reader can't read backward
+	lrec_reader_count_func_t*          pcount_func;            // Likewise
 } lrec_reader_t;
 
 #endif // LREC_READER_H
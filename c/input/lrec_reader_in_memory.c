@@ -30,6 +30,11 @@ lrec_reader_t* lrec_reader_in_memory_alloc(sllv_t* precords) {
 	plrec_reader->pprocess_func = lrec_reader_in_memory_process;
 	plrec_reader->psof_func     = lrec_reader_in_memory_sof;
 	plrec_reader->pfree_func    = lrec_reader_in_memory_free;
+	plrec_reader->pset_projection_func = NULL;
+	plrec_reader->pset_prefilter_func  = NULL;
+	plrec_reader->palloc_retainer_func = NULL;
+	plrec_reader->pprocess_backward_func = NULL;
+	plrec_reader->pcount_func          = NULL;
 
 	return plrec_reader;
 }
@@ -77,10 +77,14 @@ typedef struct _lrec_reader_mmap_csv_state_t {
 	header_keeper_t*    pheader_keeper;
 	lhmslv_t*           pheader_keepers;
 
+	hss_t*              pprojection;
+	char*               pheader_projection_flags; // One per header field; null if no projection
+
 } lrec_reader_mmap_csv_state_t;
 
 static void    lrec_reader_mmap_csv_free(lrec_reader_t* preader);
 static void    lrec_reader_mmap_csv_sof(void* pvstate, void* pvhandle);
+static void    lrec_reader_mmap_csv_set_projection(void* pvstate, hss_t* pprojection);
 static lrec_t* lrec_reader_mmap_csv_process(void* pvstate, void* pvhandle, context_t* pctx);
 static int     lrec_reader_mmap_csv_get_fields(lrec_reader_mmap_csv_state_t* pstate,
 	rslls_t* pfields, file_reader_mmap_state_t* phandle, context_t* pctx);
@@ -144,6 +148,8 @@ lrec_reader_t* lrec_reader_mmap_csv_alloc(char* irs, char* ifs, int use_implicit
 	pstate->use_implicit_header       = use_implicit_header;
 	pstate->pheader_keeper            = NULL;
 	pstate->pheader_keepers           = lhmslv_alloc();
+	pstate->pprojection               = NULL;
+	pstate->pheader_projection_flags  = NULL;
 
 	plrec_reader->pvstate       = (void*)pstate;
 	plrec_reader->popen_func    = file_reader_mmap_vopen;
@@ -151,6 +157,11 @@ lrec_reader_t* lrec_reader_mmap_csv_alloc(char* irs, char* ifs, int use_implicit
 	plrec_reader->pprocess_func = lrec_reader_mmap_csv_process;
 	plrec_reader->psof_func     = lrec_reader_mmap_csv_sof;
 	plrec_reader->pfree_func    = lrec_reader_mmap_csv_free;
+	plrec_reader->pset_projection_func = lrec_reader_mmap_csv_set_projection;
+	plrec_reader->pset_prefilter_func  = NULL;
+	plrec_reader->palloc_retainer_func = NULL;
+	plrec_reader->pprocess_backward_func = NULL;
+	plrec_reader->pcount_func          = NULL;
 
 	return plrec_reader;
 }
@@ -163,6 +174,7 @@ static void lrec_reader_mmap_csv_free(lrec_reader_t* preader) {
 		header_keeper_free(pheader_keeper);
 	}
 	lhmslv_free(pstate->pheader_keepers);
+	free(pstate->pheader_projection_flags);
 	parse_trie_free(pstate->pno_dquote_parse_trie);
 	parse_trie_free(pstate->pdquote_parse_trie);
 	rslls_free(pstate->pfields);
@@ -190,6 +202,11 @@ static void lrec_reader_mmap_csv_sof(void* pvstate, void* pvhandle) {
 	}
 }
 
+static void lrec_reader_mmap_csv_set_projection(void* pvstate, hss_t* pprojection) {
+	lrec_reader_mmap_csv_state_t* pstate = pvstate;
+	pstate->pprojection = pprojection;
+}
+
 // ----------------------------------------------------------------
 static lrec_t* lrec_reader_mmap_csv_process(void* pvstate, void* pvhandle, context_t* pctx) {
 	lrec_reader_mmap_csv_state_t* pstate = pvstate;
@@ -251,6 +268,8 @@ static lrec_t* lrec_reader_mmap_csv_process(void* pvstate, void* pvhandle, conte
 			} else { // Re-use the header-keeper in the header cache
 				slls_free(pheader_fields);
 			}
+			pstate->pheader_projection_flags = lrec_reader_get_projection_flags(pstate->pheader_projection_flags,
+				pstate->pheader_keeper->pkeys, pstate->pprojection);
 
 			pstate->expect_header_line_next = FALSE;
 			break;
@@ -464,6 +483,11 @@ static lrec_t* paste_indices_and_data(lrec_reader_mmap_csv_state_t* pstate, rsll
 		idx++;
 		char free_flags = pd->free_flag;
 		char* key = low_int_to_string(idx, &free_flags);
+		if (pstate->pprojection != NULL && !hss_has(pstate->pprojection, key)) {
+			if (free_flags & FREE_ENTRY_KEY)
+				free(key);
+			continue; // The rslls frees the value
+		}
 		// Transfer pointer-free responsibility from the rslls to the lrec object
 		lrec_put_ext(prec, key, pd->value, free_flags, pd->quote_flag);
 		pd->free_flag = 0;
@@ -482,7 +506,10 @@ static lrec_t* paste_header_and_data(lrec_reader_mmap_csv_state_t* pstate, rslls
 	lrec_t* prec = lrec_unbacked_alloc();
 	sllse_t* ph  = pstate->pheader_keeper->pkeys->phead;
 	rsllse_t* pd = pdata_fields->phead;
-	for ( ; ph != NULL && pd != NULL; ph = ph->pnext, pd = pd->pnext) {
+	char* pkeep = pstate->pheader_projection_flags;
+	for (int i = 0; ph != NULL && pd != NULL; ph = ph->pnext, pd = pd->pnext, i++) {
+		if (pkeep != NULL && !pkeep[i])
+			continue; // The rslls frees the value
 		// Transfer pointer-free responsibility from the rslls to the lrec object
 		lrec_put_ext(prec, ph->value, pd->value, pd->free_flag, pd->quote_flag);
 		pd->free_flag = 0;
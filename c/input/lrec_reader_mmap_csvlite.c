@@ -9,10 +9,12 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "cli/comment_handling.h"
 #include "lib/mlr_globals.h"
 #include "lib/mlrutil.h"
 #include "containers/slls.h"
+#include "containers/sllv.h"
 #include "containers/lhmslv.h"
 #include "input/file_reader_mmap.h"
 #include "input/lrec_readers.h"
@@ -54,12 +56,22 @@ typedef struct _lrec_reader_mmap_csvlite_state_t {
 	int  expect_header_line_next;
 	header_keeper_t* pheader_keeper;
 	lhmslv_t*     pheader_keepers;
+
+	int       backward_started;
+	long long backward_num_lines;
+	sllv_t*   pbackward_records; // Non-null if the file has more than one header
 } lrec_reader_mmap_csvlite_state_t;
 
 static void    lrec_reader_mmap_csvlite_free(lrec_reader_t* preader);
 static void    lrec_reader_mmap_csvlite_sof(void* pvstate, void* pvhandle);
 static lrec_t* lrec_reader_mmap_csvlite_process_single_seps(void* pvstate, void* pvhandle, context_t* pctx);
 static lrec_t* lrec_reader_mmap_csvlite_process_multi_seps(void* pvstate, void* pvhandle, context_t* pctx);
+static lrec_t* lrec_reader_mmap_csvlite_process_backward(void* pvstate, void* pvhandle, context_t* pctx);
+static long long lrec_reader_mmap_csvlite_count(void* pvstate, void* pvhandle, context_t* pctx);
+static void    lrec_reader_mmap_csvlite_start_backward(file_reader_mmap_state_t* phandle,
+	lrec_reader_mmap_csvlite_state_t* pstate, context_t* pctx);
+static void    lrec_reader_mmap_csvlite_keep_header(lrec_reader_mmap_csvlite_state_t* pstate,
+	slls_t* pheader_fields, context_t* pctx);
 
 static slls_t* lrec_reader_mmap_csvlite_get_header_single_seps(file_reader_mmap_state_t* phandle,
 	lrec_reader_mmap_csvlite_state_t* pstate, context_t* pctx);
@@ -111,6 +123,10 @@ lrec_reader_t* lrec_reader_mmap_csvlite_alloc(char* irs, char* ifs, int allow_re
 	pstate->pheader_keeper           = NULL;
 	pstate->pheader_keepers          = lhmslv_alloc();
 
+	pstate->backward_started         = FALSE;
+	pstate->backward_num_lines       = 0LL;
+	pstate->pbackward_records        = NULL;
+
 	plrec_reader->pvstate       = (void*)pstate;
 	plrec_reader->popen_func    = file_reader_mmap_vopen;
 	plrec_reader->pclose_func   = file_reader_mmap_vclose;
@@ -134,6 +150,17 @@ lrec_reader_t* lrec_reader_mmap_csvlite_alloc(char* irs, char* ifs, int allow_re
 
 	plrec_reader->psof_func     = lrec_reader_mmap_csvlite_sof;
 	plrec_reader->pfree_func    = lrec_reader_mmap_csvlite_free;
+	plrec_reader->pset_projection_func = NULL;
+	plrec_reader->pset_prefilter_func  = NULL;
+	plrec_reader->palloc_retainer_func = NULL;
+	// Comment lines would be passed through in the wrong order when reading backward.
+	if (comment_string == NULL) {
+		plrec_reader->pprocess_backward_func = lrec_reader_mmap_csvlite_process_backward;
+		plrec_reader->pcount_func            = lrec_reader_mmap_csvlite_count;
+	} else {
+		plrec_reader->pprocess_backward_func = NULL;
+		plrec_reader->pcount_func            = NULL;
+	}
 
 	return plrec_reader;
 }
@@ -146,6 +173,11 @@ static void lrec_reader_mmap_csvlite_free(lrec_reader_t* preader) {
 		header_keeper_free(pheader_keeper);
 	}
 	lhmslv_free(pstate->pheader_keepers);
+	if (pstate->pbackward_records != NULL) {
+		for (lrec_t* prec = sllv_pop(pstate->pbackward_records); prec != NULL; prec = sllv_pop(pstate->pbackward_records))
+			lrec_free(prec);
+		sllv_free(pstate->pbackward_records);
+	}
 	free(pstate);
 	free(preader);
 }
@@ -155,6 +187,35 @@ static void lrec_reader_mmap_csvlite_sof(void* pvstate, void* pvhandle) {
 	pstate->ifnr = 0LL;
 	pstate->ilno = 0LL;
 	pstate->expect_header_line_next = pstate->use_implicit_header ? FALSE : TRUE;
+	pstate->backward_started = FALSE;
+	if (pstate->pbackward_records != NULL) {
+		for (lrec_t* prec = sllv_pop(pstate->pbackward_records); prec != NULL; prec = sllv_pop(pstate->pbackward_records))
+			lrec_free(prec);
+		sllv_free(pstate->pbackward_records);
+		pstate->pbackward_records = NULL;
+	}
+}
+
+static void lrec_reader_mmap_csvlite_keep_header(lrec_reader_mmap_csvlite_state_t* pstate,
+	slls_t* pheader_fields, context_t* pctx)
+{
+	for (sllse_t* pe = pheader_fields->phead; pe != NULL; pe = pe->pnext) {
+		if (*pe->value == 0) {
+			fprintf(stderr, "%s: unacceptable empty CSV key at file \"%s\" line %lld.\n",
+				MLR_GLOBALS.bargv0, pctx->filename, pstate->ilno);
+			exit(1);
+		}
+	}
+
+	pstate->pheader_keeper = lhmslv_get(pstate->pheader_keepers, pheader_fields);
+	if (pstate->pheader_keeper == NULL) {
+		pstate->pheader_keeper = header_keeper_alloc(NULL, pheader_fields);
+		lhmslv_put(pstate->pheader_keepers, pheader_fields, pstate->pheader_keeper,
+			NO_FREE); // freed by header-keeper
+	} else { // Re-use the header-keeper in the header cache
+		slls_free(pheader_fields);
+	}
+	pstate->expect_header_line_next = FALSE;
 }
 
 // ----------------------------------------------------------------
@@ -170,23 +231,7 @@ static lrec_t* lrec_reader_mmap_csvlite_process_single_seps(void* pvstate, void*
 				return NULL;
 			}
 
-			for (sllse_t* pe = pheader_fields->phead; pe != NULL; pe = pe->pnext) {
-				if (*pe->value == 0) {
-					fprintf(stderr, "%s: unacceptable empty CSV key at file \"%s\" line %lld.\n",
-						MLR_GLOBALS.bargv0, pctx->filename, pstate->ilno);
-					exit(1);
-				}
-			}
-
-			pstate->pheader_keeper = lhmslv_get(pstate->pheader_keepers, pheader_fields);
-			if (pstate->pheader_keeper == NULL) {
-				pstate->pheader_keeper = header_keeper_alloc(NULL, pheader_fields);
-				lhmslv_put(pstate->pheader_keepers, pheader_fields, pstate->pheader_keeper,
-					NO_FREE); // freed by header-keeper
-			} else { // Re-use the header-keeper in the header cache
-				slls_free(pheader_fields);
-			}
-			pstate->expect_header_line_next = FALSE;
+			lrec_reader_mmap_csvlite_keep_header(pstate, pheader_fields, pctx);
 		}
 
 		int end_of_stanza = FALSE;
@@ -216,23 +261,7 @@ static lrec_t* lrec_reader_mmap_csvlite_process_multi_seps(void* pvstate, void*
 			if (pheader_fields == NULL) // EOF
 				return NULL;
 
-			for (sllse_t* pe = pheader_fields->phead; pe != NULL; pe = pe->pnext) {
-				if (*pe->value == 0) {
-					fprintf(stderr, "%s: unacceptable empty CSV key at file \"%s\" line %lld.\n",
-						MLR_GLOBALS.bargv0, pctx->filename, pstate->ilno);
-					exit(1);
-				}
-			}
-
-			pstate->pheader_keeper = lhmslv_get(pstate->pheader_keepers, pheader_fields);
-			if (pstate->pheader_keeper == NULL) {
-				pstate->pheader_keeper = header_keeper_alloc(NULL, pheader_fields);
-				lhmslv_put(pstate->pheader_keepers, pheader_fields, pstate->pheader_keeper,
-					NO_FREE); // freed by header-keeper
-			} else { // Re-use the header-keeper in the header cache
-				slls_free(pheader_fields);
-			}
-			pstate->expect_header_line_next = FALSE;
+			lrec_reader_mmap_csvlite_keep_header(pstate, pheader_fields, pctx);
 		}
 
 		int end_of_stanza = FALSE;
@@ -251,6 +280,149 @@ static lrec_t* lrec_reader_mmap_csvlite_process_multi_seps(void* pvstate, void*
 	}
 }
 
+// ----------------------------------------------------------------
+// Reading backward needs the header from the front of the file, and only works if there is just the one: a blank
+// line followed by more data starts a new header block. Files with more than one are read forward into a list,
+// which is then served last record first. So are files with a data line which doesn't fit the header, so that
+// reading them fails as it would forward, at that line and before any records go out.
+
+// Whether the data line from p to end has as many fields as the header, as the forward readers above count them.
+static int lrec_reader_mmap_csvlite_line_fits_header(lrec_reader_mmap_csvlite_state_t* pstate, char* p, char* end) {
+	if (pstate->use_implicit_header)
+		return TRUE;
+	char* ifs = pstate->ifs;
+	int ifslen = pstate->ifslen;
+	int allow_repeat_ifs = pstate->allow_repeat_ifs;
+	if (pstate->do_auto_line_term && ifslen == 1 && end > p && end[-1] == '\r')
+		end--;
+
+	long long num_fields_left = pstate->pheader_keeper->pkeys->length;
+	if (allow_repeat_ifs) {
+		while (end - p >= ifslen && memcmp(p, ifs, ifslen) == 0)
+			p += ifslen;
+	}
+	char* value = p;
+	while (p < end && *p) {
+		if (end - p >= ifslen && memcmp(p, ifs, ifslen) == 0) {
+			if (num_fields_left == 0)
+				return FALSE;
+			num_fields_left--;
+			p += ifslen;
+			if (allow_repeat_ifs) {
+				while (end - p >= ifslen && memcmp(p, ifs, ifslen) == 0)
+					p += ifslen;
+			}
+			value = p;
+		} else {
+			p++;
+		}
+	}
+	if (allow_repeat_ifs && (value >= end || *value == 0))
+		return TRUE;
+	return num_fields_left == 1;
+}
+
+static void lrec_reader_mmap_csvlite_start_backward(file_reader_mmap_state_t* phandle,
+	lrec_reader_mmap_csvlite_state_t* pstate, context_t* pctx)
+{
+	int single_seps = pstate->irslen == 1 && pstate->ifslen == 1;
+	pstate->backward_started = TRUE;
+	if (pstate->expect_header_line_next) {
+		slls_t* pheader_fields = single_seps
+			? lrec_reader_mmap_csvlite_get_header_single_seps(phandle, pstate, pctx)
+			: lrec_reader_mmap_csvlite_get_header_multi_seps(phandle, pstate);
+		lrec_reader_mmap_csvlite_keep_header(pstate, pheader_fields, pctx);
+	}
+
+	char* irs = pstate->irs;
+	int irslen = pstate->irslen;
+	char* end_of_data = phandle->sol;
+	long long num_lines = 0LL;
+	long long num_data_lines = 0LL;
+	int saw_blank_line = FALSE;
+	for (char* p = phandle->sol; p < phandle->eof; ) {
+		char* q = (irslen == 1) ? memchr(p, irs[0], phandle->eof - p) : mlr_memmem(p, phandle->eof - p, irs, irslen);
+		char* next = (q == NULL) ? phandle->eof : q + irslen;
+		num_lines++;
+		if (q == p) {
+			saw_blank_line = TRUE;
+		} else if (saw_blank_line || !lrec_reader_mmap_csvlite_line_fits_header(pstate, p, (q == NULL) ? next : q)) {
+			pstate->pbackward_records = sllv_alloc();
+			while (TRUE) {
+				lrec_t* prec = single_seps
+					? lrec_reader_mmap_csvlite_process_single_seps(pstate, phandle, pctx)
+					: lrec_reader_mmap_csvlite_process_multi_seps(pstate, phandle, pctx);
+				if (prec == NULL)
+					break;
+				sllv_push(pstate->pbackward_records, prec);
+			}
+			return;
+		} else {
+			end_of_data = next;
+			num_data_lines = num_lines;
+		}
+		p = next;
+	}
+
+	// Trailing blank lines are skipped.
+	phandle->eof = end_of_data;
+	pstate->backward_num_lines = num_data_lines;
+	pstate->ilno += num_data_lines;
+}
+
+static lrec_t* lrec_reader_mmap_csvlite_process_backward(void* pvstate, void* pvhandle, context_t* pctx) {
+	file_reader_mmap_state_t* phandle = pvhandle;
+	lrec_reader_mmap_csvlite_state_t* pstate = pvstate;
+	if (!pstate->backward_started)
+		lrec_reader_mmap_csvlite_start_backward(phandle, pstate, pctx);
+	if (pstate->pbackward_records != NULL)
+		return sllv_pop(pstate->pbackward_records);
+
+	// As when reading forward, only the single-separator case autodetects CRLF, and by the first line: usually
+	// the header, which has been read by now, but not with implicit header.
+	int auto_crlf = pstate->do_auto_line_term && pstate->ifslen == 1;
+	if (auto_crlf && !pctx->auto_line_term_detected) {
+		char* p = file_reader_mmap_get_first_line_end(phandle, pstate->irs, pstate->irslen);
+		if (p != NULL) {
+			if (p > phandle->sol && p[-1] == '\r')
+				context_set_autodetected_crlf(pctx);
+			else
+				context_set_autodetected_lf(pctx);
+		}
+	}
+	char* eol = NULL;
+	int terminated = FALSE;
+	char* line = file_reader_mmap_get_last_line(phandle, pstate->irs, pstate->irslen, &eol, &terminated);
+	if (line == NULL)
+		return NULL;
+	if (terminated && auto_crlf && eol > line && eol[-1] == '\r')
+		eol--;
+	char* copy = mlr_alloc_string_from_char_range(line, eol - line);
+	long long ilno = pstate->ilno--;
+
+	if (pstate->ifslen == 1) {
+		return pstate->use_implicit_header
+			? lrec_parse_stdio_csvlite_data_line_single_ifs_implicit_header(pstate->pheader_keeper, pctx->filename,
+				ilno, copy, pstate->ifs[0], pstate->allow_repeat_ifs)
+			: lrec_parse_stdio_csvlite_data_line_single_ifs(pstate->pheader_keeper, pctx->filename,
+				ilno, copy, pstate->ifs[0], pstate->allow_repeat_ifs);
+	} else {
+		return pstate->use_implicit_header
+			? lrec_parse_stdio_csvlite_data_line_multi_ifs_implicit_header(pstate->pheader_keeper, pctx->filename,
+				ilno, copy, pstate->ifs, pstate->ifslen, pstate->allow_repeat_ifs)
+			: lrec_parse_stdio_csvlite_data_line_multi_ifs(pstate->pheader_keeper, pctx->filename,
+				ilno, copy, pstate->ifs, pstate->ifslen, pstate->allow_repeat_ifs);
+	}
+}
+
+static long long lrec_reader_mmap_csvlite_count(void* pvstate, void* pvhandle, context_t* pctx) {
+	lrec_reader_mmap_csvlite_state_t* pstate = pvstate;
+	lrec_reader_mmap_csvlite_start_backward(pvhandle, pstate, pctx);
+	return (pstate->pbackward_records != NULL)
+		? pstate->pbackward_records->length
+		: pstate->backward_num_lines;
+}
+
 // ----------------------------------------------------------------
 static slls_t* lrec_reader_mmap_csvlite_get_header_single_seps(file_reader_mmap_state_t* phandle,
 	lrec_reader_mmap_csvlite_state_t* pstate, context_t* pctx)
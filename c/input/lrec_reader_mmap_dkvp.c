@@ -9,6 +9,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "cli/comment_handling.h"
 #include "lib/mlr_globals.h"
 #include "lib/mlrutil.h"
@@ -27,10 +28,20 @@ typedef struct _lrec_reader_mmap_dkvp_state_t {
 	comment_handling_t comment_handling;
 	char* comment_string;
 	int   comment_string_length;
+	hss_t* pprojection;
+	lrec_prefilter_t* pprefilter;
+	lrec_retainer_t* pretainer;
 } lrec_reader_mmap_dkvp_state_t;
 
 static void    lrec_reader_mmap_dkvp_free(lrec_reader_t* preader);
 static void    lrec_reader_mmap_dkvp_sof(void* pvstate, void* pvhandle);
+static void    lrec_reader_mmap_dkvp_set_projection(void* pvstate, hss_t* pprojection);
+static void    lrec_reader_mmap_dkvp_set_prefilter(void* pvstate, lrec_prefilter_t* pprefilter);
+static lrec_retainer_t* lrec_reader_mmap_dkvp_alloc_retainer(lrec_reader_t* preader);
+static lrec_t* lrec_reader_mmap_dkvp_reparse(void* pvstate, char* line);
+static lrec_t* lrec_reader_mmap_dkvp_process_retained(void* pvstate, void* pvhandle, context_t* pctx);
+static lrec_t* lrec_reader_mmap_dkvp_process_backward(void* pvstate, void* pvhandle, context_t* pctx);
+static long long lrec_reader_mmap_dkvp_count(void* pvstate, void* pvhandle, context_t* pctx);
 static lrec_t* lrec_reader_mmap_dkvp_process_single_irs_single_others(void* pvstate, void* pvhandle, context_t* pctx);
 static lrec_t* lrec_reader_mmap_dkvp_process_single_irs_multi_others(void* pvstate, void* pvhandle, context_t* pctx);
 static lrec_t* lrec_reader_mmap_dkvp_process_multi_irs_single_others(void* pvstate, void* pvhandle, context_t* pctx);
@@ -48,6 +59,17 @@ static lrec_t* lrec_parse_mmap_dkvp_multi_irs_single_others(file_reader_mmap_sta
 static lrec_t* lrec_parse_mmap_dkvp_multi_irs_multi_others(file_reader_mmap_state_t *phandle,
 	lrec_reader_mmap_dkvp_state_t* pstate, context_t* pctx);
 
+static char* find_end_of_line(
+	file_reader_mmap_state_t *phandle,
+	lrec_reader_mmap_dkvp_state_t* pstate,
+	context_t* pctx,
+	char** peol);
+
+static void skip_over_prefiltered_lines(
+	file_reader_mmap_state_t *phandle,
+	lrec_reader_mmap_dkvp_state_t* pstate,
+	context_t* pctx);
+
 static void skip_over_comment_lines_single_irs(
 	file_reader_mmap_state_t *phandle,
 	lrec_reader_mmap_dkvp_state_t* pstate,
@@ -77,6 +99,9 @@ lrec_reader_t* lrec_reader_mmap_dkvp_alloc(char* irs, char* ifs, char* ips, int
 	pstate->comment_handling      = comment_handling;
 	pstate->comment_string        = comment_string;
 	pstate->comment_string_length = comment_string == NULL ? 0 : strlen(comment_string);
+	pstate->pprojection           = NULL;
+	pstate->pprefilter            = NULL;
+	pstate->pretainer             = NULL;
 
 	plrec_reader->pvstate     = (void*)pstate;
 	plrec_reader->popen_func  = file_reader_mmap_vopen;
@@ -103,12 +128,25 @@ lrec_reader_t* lrec_reader_mmap_dkvp_alloc(char* irs, char* ifs, char* ips, int
 	}
 	plrec_reader->psof_func   = lrec_reader_mmap_dkvp_sof;
 	plrec_reader->pfree_func  = lrec_reader_mmap_dkvp_free;
+	plrec_reader->pset_projection_func = lrec_reader_mmap_dkvp_set_projection;
+	plrec_reader->pset_prefilter_func  = lrec_reader_mmap_dkvp_set_prefilter;
+	plrec_reader->palloc_retainer_func = lrec_reader_mmap_dkvp_alloc_retainer;
+	// Comment lines would be passed through in the wrong order when reading backward.
+	if (comment_string == NULL) {
+		plrec_reader->pprocess_backward_func = lrec_reader_mmap_dkvp_process_backward;
+		plrec_reader->pcount_func            = lrec_reader_mmap_dkvp_count;
+	} else {
+		plrec_reader->pprocess_backward_func = NULL;
+		plrec_reader->pcount_func            = NULL;
+	}
 
 	return plrec_reader;
 }
 
 static void lrec_reader_mmap_dkvp_free(lrec_reader_t* preader) {
-	free(preader->pvstate);
+	lrec_reader_mmap_dkvp_state_t* pstate = preader->pvstate;
+	lrec_retainer_free(pstate->pretainer);
+	free(pstate);
 	free(preader);
 }
 
@@ -116,10 +154,44 @@ static void lrec_reader_mmap_dkvp_free(lrec_reader_t* preader) {
 static void lrec_reader_mmap_dkvp_sof(void* pvstate, void* pvhandle) {
 }
 
+static void lrec_reader_mmap_dkvp_set_projection(void* pvstate, hss_t* pprojection) {
+	lrec_reader_mmap_dkvp_state_t* pstate = pvstate;
+	pstate->pprojection = pprojection;
+}
+
+// Only the single-character IFS/IPS process methods use the prefilter.
+static void lrec_reader_mmap_dkvp_set_prefilter(void* pvstate, lrec_prefilter_t* pprefilter) {
+	lrec_reader_mmap_dkvp_state_t* pstate = pvstate;
+	if (pstate->ifslen == 1 && pstate->ipslen == 1)
+		pstate->pprefilter = pprefilter;
+}
+
+// From here on, lines are parsed as copies, leaving the mapped file as it was: the retainer's
+// extents point into it.
+static lrec_retainer_t* lrec_reader_mmap_dkvp_alloc_retainer(lrec_reader_t* preader) {
+	lrec_reader_mmap_dkvp_state_t* pstate = preader->pvstate;
+	if (pstate->pretainer == NULL)
+		pstate->pretainer = lrec_retainer_alloc(lrec_reader_mmap_dkvp_reparse, pstate);
+	preader->pprocess_func = lrec_reader_mmap_dkvp_process_retained;
+	return pstate->pretainer;
+}
+
+static lrec_t* lrec_reader_mmap_dkvp_reparse(void* pvstate, char* line) {
+	lrec_reader_mmap_dkvp_state_t* pstate = pvstate;
+	if (pstate->ifslen == 1 && pstate->ipslen == 1)
+		return lrec_parse_stdio_dkvp_single_sep(line, pstate->ifs[0], pstate->ips[0], pstate->allow_repeat_ifs,
+			pstate->pprojection);
+	else
+		return lrec_parse_stdio_dkvp_multi_sep(line, pstate->ifs, pstate->ips, pstate->ifslen, pstate->ipslen,
+			pstate->allow_repeat_ifs, pstate->pprojection);
+}
+
 // ----------------------------------------------------------------
 static lrec_t* lrec_reader_mmap_dkvp_process_single_irs_single_others(void* pvstate, void* pvhandle, context_t* pctx) {
 	file_reader_mmap_state_t* phandle = pvhandle;
 	lrec_reader_mmap_dkvp_state_t* pstate = pvstate;
+	if (pstate->pprefilter != NULL)
+		skip_over_prefiltered_lines(phandle, pstate, pctx);
 	if (phandle->sol >= phandle->eof)
 		return NULL;
 	else
@@ -139,6 +211,8 @@ static lrec_t* lrec_reader_mmap_dkvp_process_single_irs_multi_others(void* pvsta
 static lrec_t* lrec_reader_mmap_dkvp_process_multi_irs_single_others(void* pvstate, void* pvhandle, context_t* pctx) {
 	file_reader_mmap_state_t* phandle = pvhandle;
 	lrec_reader_mmap_dkvp_state_t* pstate = pvstate;
+	if (pstate->pprefilter != NULL)
+		skip_over_prefiltered_lines(phandle, pstate, pctx);
 	if (phandle->sol >= phandle->eof)
 		return NULL;
 	else
@@ -155,6 +229,57 @@ static lrec_t* lrec_reader_mmap_dkvp_process_multi_irs_multi_others(void* pvstat
 		return lrec_parse_mmap_dkvp_multi_irs_multi_others(phandle, pstate, pctx);
 }
 
+static lrec_t* lrec_reader_mmap_dkvp_process_retained(void* pvstate, void* pvhandle, context_t* pctx) {
+	file_reader_mmap_state_t* phandle = pvhandle;
+	lrec_reader_mmap_dkvp_state_t* pstate = pvstate;
+	if (pstate->comment_string != NULL) {
+		if (pstate->irslen == 1)
+			skip_over_comment_lines_single_irs(phandle, pstate, pstate->irs[0]);
+		else
+			skip_over_comment_lines_multi_irs(phandle, pstate, pstate->irs, pstate->irslen);
+	}
+	if (phandle->sol >= phandle->eof)
+		return NULL;
+
+	lrec_retainer_t* pretainer = pstate->pretainer;
+	char* eol = NULL;
+	pretainer->current.line = phandle->sol;
+	phandle->sol = find_end_of_line(phandle, pstate, pctx, &eol);
+	pretainer->current.length = eol - pretainer->current.line;
+	return lrec_retainer_reparse(pretainer, &pretainer->current);
+}
+
+// Lines read backward are parsed as copies, as for retention. Every line is a record.
+static lrec_t* lrec_reader_mmap_dkvp_process_backward(void* pvstate, void* pvhandle, context_t* pctx) {
+	file_reader_mmap_state_t* phandle = pvhandle;
+	lrec_reader_mmap_dkvp_state_t* pstate = pvstate;
+	if (pstate->do_auto_line_term && !pctx->auto_line_term_detected) {
+		// Before any record is emitted, and by the first line as when reading forward: the last one may
+		// well be unterminated.
+		char* p = file_reader_mmap_get_first_line_end(phandle, pstate->irs, pstate->irslen);
+		if (p != NULL) {
+			if (p > phandle->sol && p[-1] == '\r')
+				context_set_autodetected_crlf(pctx);
+			else
+				context_set_autodetected_lf(pctx);
+		}
+	}
+	char* eol = NULL;
+	int terminated = FALSE;
+	char* line = file_reader_mmap_get_last_line(phandle, pstate->irs, pstate->irslen, &eol, &terminated);
+	if (line == NULL)
+		return NULL;
+	if (terminated && pstate->do_auto_line_term && eol > line && eol[-1] == '\r')
+		eol--;
+	return lrec_reader_mmap_dkvp_reparse(pstate, mlr_alloc_string_from_char_range(line, eol - line));
+}
+
+static long long lrec_reader_mmap_dkvp_count(void* pvstate, void* pvhandle, context_t* pctx) {
+	file_reader_mmap_state_t* phandle = pvhandle;
+	lrec_reader_mmap_dkvp_state_t* pstate = pvstate;
+	return mlr_count_lines(phandle->sol, phandle->eof - phandle->sol, pstate->irs, pstate->irslen);
+}
+
 // ----------------------------------------------------------------
 static lrec_t* lrec_parse_mmap_dkvp_single_irs_single_others(file_reader_mmap_state_t *phandle,
 	char irs, char ifs, char ips, lrec_reader_mmap_dkvp_state_t* pstate, context_t* pctx)
@@ -206,10 +331,10 @@ static lrec_t* lrec_parse_mmap_dkvp_single_irs_single_others(file_reader_mmap_st
 				// "a=".  Here we use the positional index as the key. This way
 				// DKVP is a generalization of NIDX.
 				char free_flags = NO_FREE;
-				lrec_put(prec, low_int_to_string(idx, &free_flags), value, free_flags);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), value, free_flags, pstate->pprojection);
 			}
 			else {
-				lrec_put(prec, key, value, NO_FREE);
+				lrec_put_projected(prec, key, value, NO_FREE, pstate->pprojection);
 			}
 
 			p++;
@@ -242,15 +367,15 @@ static lrec_t* lrec_parse_mmap_dkvp_single_irs_single_others(file_reader_mmap_st
 		if (*key == 0 || value <= key) {
 			char free_flags = NO_FREE;
 			if (value >= phandle->eof)
-				lrec_put(prec, low_int_to_string(idx, &free_flags), "", free_flags);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), "", free_flags, pstate->pprojection);
 			else
-				lrec_put(prec, low_int_to_string(idx, &free_flags), value, free_flags);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), value, free_flags, pstate->pprojection);
 		}
 		else {
 			if (value >= phandle->eof)
-				lrec_put(prec, key, "", NO_FREE);
+				lrec_put_projected(prec, key, "", NO_FREE, pstate->pprojection);
 			else
-				lrec_put(prec, key, value, NO_FREE);
+				lrec_put_projected(prec, key, value, NO_FREE, pstate->pprojection);
 		}
 	} else {
 		// Messier case: we read to end of file without seeing end of line.  We can't always zero-poke a null character
@@ -260,18 +385,19 @@ static lrec_t* lrec_parse_mmap_dkvp_single_irs_single_others(file_reader_mmap_st
 		if (*key == 0 || value <= key) {
 			char free_flags = NO_FREE;
 			if (value >= phandle->eof) {
-				lrec_put(prec, low_int_to_string(idx, &free_flags), "", free_flags);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), "", free_flags, pstate->pprojection);
 			} else {
 				char* copy = mlr_alloc_string_from_char_range(value, phandle->eof - value);
-				lrec_put(prec, low_int_to_string(idx, &free_flags), copy, free_flags | FREE_ENTRY_VALUE);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), copy, free_flags | FREE_ENTRY_VALUE,
+					pstate->pprojection);
 			}
 		}
 		else {
 			if (value >= phandle->eof) {
-				lrec_put(prec, key, "", NO_FREE);
+				lrec_put_projected(prec, key, "", NO_FREE, pstate->pprojection);
 			} else {
 				char* copy = mlr_alloc_string_from_char_range(value, phandle->eof - value);
-				lrec_put(prec, key, copy, FREE_ENTRY_VALUE);
+				lrec_put_projected(prec, key, copy, FREE_ENTRY_VALUE, pstate->pprojection);
 			}
 		}
 	}
@@ -319,10 +445,10 @@ static lrec_t* lrec_parse_mmap_dkvp_multi_irs_single_others(file_reader_mmap_sta
 				// "a=".  Here we use the positional index as the key. This way
 				// DKVP is a generalization of NIDX.
 				char free_flags = NO_FREE;
-				lrec_put(prec, low_int_to_string(idx, &free_flags), value, free_flags);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), value, free_flags, pstate->pprojection);
 			}
 			else {
-				lrec_put(prec, key, value, NO_FREE);
+				lrec_put_projected(prec, key, value, NO_FREE, pstate->pprojection);
 			}
 
 			p++;
@@ -355,15 +481,15 @@ static lrec_t* lrec_parse_mmap_dkvp_multi_irs_single_others(file_reader_mmap_sta
 		if (*key == 0 || value <= key) {
 			char free_flags = NO_FREE;
 			if (value >= phandle->eof)
-				lrec_put(prec, low_int_to_string(idx, &free_flags), "", free_flags);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), "", free_flags, pstate->pprojection);
 			else
-				lrec_put(prec, low_int_to_string(idx, &free_flags), value, free_flags);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), value, free_flags, pstate->pprojection);
 		}
 		else {
 			if (value >= phandle->eof)
-				lrec_put(prec, key, "", NO_FREE);
+				lrec_put_projected(prec, key, "", NO_FREE, pstate->pprojection);
 			else
-				lrec_put(prec, key, value, NO_FREE);
+				lrec_put_projected(prec, key, value, NO_FREE, pstate->pprojection);
 		}
 	} else {
 		// Messier case: we read to end of file without seeing end of line.  We can't always zero-poke a null character
@@ -373,18 +499,19 @@ static lrec_t* lrec_parse_mmap_dkvp_multi_irs_single_others(file_reader_mmap_sta
 		if (*key == 0 || value <= key) {
 			char free_flags = NO_FREE;
 			if (value >= phandle->eof) {
-				lrec_put(prec, low_int_to_string(idx, &free_flags), "", free_flags);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), "", free_flags, pstate->pprojection);
 			} else {
 				char* copy = mlr_alloc_string_from_char_range(value, phandle->eof - value);
-				lrec_put(prec, low_int_to_string(idx, &free_flags), copy, free_flags | FREE_ENTRY_VALUE);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), copy, free_flags | FREE_ENTRY_VALUE,
+					pstate->pprojection);
 			}
 		}
 		else {
 			if (value >= phandle->eof) {
-				lrec_put(prec, key, "", NO_FREE);
+				lrec_put_projected(prec, key, "", NO_FREE, pstate->pprojection);
 			} else {
 				char* copy = mlr_alloc_string_from_char_range(value, phandle->eof - value);
-				lrec_put(prec, key, copy, FREE_ENTRY_VALUE);
+				lrec_put_projected(prec, key, copy, FREE_ENTRY_VALUE, pstate->pprojection);
 			}
 		}
 	}
@@ -442,10 +569,10 @@ static lrec_t* lrec_parse_mmap_dkvp_single_irs_multi_others(file_reader_mmap_sta
 				// "a=".  Here we use the positional index as the key. This way
 				// DKVP is a generalization of NIDX.
 				char free_flags = NO_FREE;
-				lrec_put(prec, low_int_to_string(idx, &free_flags), value, free_flags);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), value, free_flags, pstate->pprojection);
 			}
 			else {
-				lrec_put(prec, key, value, NO_FREE);
+				lrec_put_projected(prec, key, value, NO_FREE, pstate->pprojection);
 			}
 
 			p += pstate->ifslen;
@@ -479,15 +606,15 @@ static lrec_t* lrec_parse_mmap_dkvp_single_irs_multi_others(file_reader_mmap_sta
 		if (*key == 0 || value <= key) {
 			char free_flags = NO_FREE;
 			if (value >= phandle->eof)
-				lrec_put(prec, low_int_to_string(idx, &free_flags), "", free_flags);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), "", free_flags, pstate->pprojection);
 			else
-				lrec_put(prec, low_int_to_string(idx, &free_flags), value, free_flags);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), value, free_flags, pstate->pprojection);
 		}
 		else {
 			if (value >= phandle->eof)
-				lrec_put(prec, key, "", NO_FREE);
+				lrec_put_projected(prec, key, "", NO_FREE, pstate->pprojection);
 			else
-				lrec_put(prec, key, value, NO_FREE);
+				lrec_put_projected(prec, key, value, NO_FREE, pstate->pprojection);
 		}
 	} else {
 		// Messier case: we read to end of file without seeing end of line.  We can't always zero-poke a null character
@@ -497,18 +624,19 @@ static lrec_t* lrec_parse_mmap_dkvp_single_irs_multi_others(file_reader_mmap_sta
 		if (*key == 0 || value <= key) {
 			char free_flags = NO_FREE;
 			if (value >= phandle->eof) {
-				lrec_put(prec, low_int_to_string(idx, &free_flags), "", free_flags);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), "", free_flags, pstate->pprojection);
 			} else {
 				char* copy = mlr_alloc_string_from_char_range(value, phandle->eof - value);
-				lrec_put(prec, low_int_to_string(idx, &free_flags), copy, free_flags | FREE_ENTRY_VALUE);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), copy, free_flags | FREE_ENTRY_VALUE,
+					pstate->pprojection);
 			}
 		}
 		else {
 			if (value >= phandle->eof) {
-				lrec_put(prec, key, "", NO_FREE);
+				lrec_put_projected(prec, key, "", NO_FREE, pstate->pprojection);
 			} else {
 				char* copy = mlr_alloc_string_from_char_range(value, phandle->eof - value);
-				lrec_put(prec, key, copy, FREE_ENTRY_VALUE);
+				lrec_put_projected(prec, key, copy, FREE_ENTRY_VALUE, pstate->pprojection);
 			}
 		}
 	}
@@ -556,10 +684,10 @@ static lrec_t* lrec_parse_mmap_dkvp_multi_irs_multi_others(file_reader_mmap_stat
 				// "a=".  Here we use the positional index as the key. This way
 				// DKVP is a generalization of NIDX.
 				char free_flags = NO_FREE;
-				lrec_put(prec, low_int_to_string(idx, &free_flags), value, free_flags);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), value, free_flags, pstate->pprojection);
 			}
 			else {
-				lrec_put(prec, key, value, NO_FREE);
+				lrec_put_projected(prec, key, value, NO_FREE, pstate->pprojection);
 			}
 
 			p += pstate->ifslen;
@@ -592,15 +720,15 @@ static lrec_t* lrec_parse_mmap_dkvp_multi_irs_multi_others(file_reader_mmap_stat
 		if (*key == 0 || value <= key) {
 			char free_flags = NO_FREE;
 			if (value >= phandle->eof)
-				lrec_put(prec, low_int_to_string(idx, &free_flags), "", free_flags);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), "", free_flags, pstate->pprojection);
 			else
-				lrec_put(prec, low_int_to_string(idx, &free_flags), value, free_flags);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), value, free_flags, pstate->pprojection);
 		}
 		else {
 			if (value >= phandle->eof)
-				lrec_put(prec, key, "", NO_FREE);
+				lrec_put_projected(prec, key, "", NO_FREE, pstate->pprojection);
 			else
-				lrec_put(prec, key, value, NO_FREE);
+				lrec_put_projected(prec, key, value, NO_FREE, pstate->pprojection);
 		}
 	} else {
 		// Messier case: we read to end of file without seeing end of line.  We can't always zero-poke a null character
@@ -610,18 +738,19 @@ static lrec_t* lrec_parse_mmap_dkvp_multi_irs_multi_others(file_reader_mmap_stat
 		if (*key == 0 || value <= key) {
 			char free_flags = NO_FREE;
 			if (value >= phandle->eof) {
-				lrec_put(prec, low_int_to_string(idx, &free_flags), "", free_flags);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), "", free_flags, pstate->pprojection);
 			} else {
 				char* copy = mlr_alloc_string_from_char_range(value, phandle->eof - value);
-				lrec_put(prec, low_int_to_string(idx, &free_flags), copy, free_flags | FREE_ENTRY_VALUE);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), copy, free_flags | FREE_ENTRY_VALUE,
+					pstate->pprojection);
 			}
 		}
 		else {
 			if (value >= phandle->eof) {
-				lrec_put(prec, key, "", NO_FREE);
+				lrec_put_projected(prec, key, "", NO_FREE, pstate->pprojection);
 			} else {
 				char* copy = mlr_alloc_string_from_char_range(value, phandle->eof - value);
-				lrec_put(prec, key, copy, FREE_ENTRY_VALUE);
+				lrec_put_projected(prec, key, copy, FREE_ENTRY_VALUE, pstate->pprojection);
 			}
 		}
 	}
@@ -629,6 +758,143 @@ static lrec_t* lrec_parse_mmap_dkvp_multi_irs_multi_others(file_reader_mmap_stat
 	return prec;
 }
 
+// ----------------------------------------------------------------
+// Predicate pushdown: see lrec_readers.h. The field lookup follows the same
+// rules as the parsers above: the last occurrence of a key wins, and pairs
+// without a key are named by their position. Nothing is written to the line, so
+// the parser still sees it as it was if it survives.
+
+static int find_dkvp_value(lrec_reader_mmap_dkvp_state_t* pstate, char* line, char* eol,
+	lrec_prefilter_term_t* pterm, char** pvalue, int* pvalue_length)
+{
+	char ifs = pstate->ifs[0];
+	char ips = pstate->ips[0];
+	int found = FALSE;
+	int idx = 0;
+	char* p = line;
+	if (pstate->allow_repeat_ifs) {
+		while (p < eol && *p == ifs)
+			p++;
+	}
+	while (TRUE) {
+		char* field_end = memchr(p, ifs, eol - p);
+		if (field_end == NULL)
+			field_end = eol;
+		idx++;
+
+		char* sep = memchr(p, ips, field_end - p);
+		// As in the parsers, with repeated IFS allowed an empty pair at end of line isn't a field.
+		if (field_end >= eol && pstate->allow_repeat_ifs
+			&& ((sep == NULL && p == eol) || (sep == p && sep + 1 == eol)))
+			break;
+		if (sep == NULL || sep == p) {
+			char idx_buffer[32];
+			int idx_length = snprintf(idx_buffer, sizeof(idx_buffer), "%d", idx);
+			if (idx_length == pterm->field_name_length && memcmp(idx_buffer, pterm->field_name, idx_length) == 0) {
+				*pvalue = (sep == NULL) ? p : sep + 1;
+				*pvalue_length = field_end - *pvalue;
+				found = TRUE;
+			}
+		} else if (sep - p == pterm->field_name_length && memcmp(p, pterm->field_name, sep - p) == 0) {
+			*pvalue = sep + 1;
+			*pvalue_length = field_end - *pvalue;
+			found = TRUE;
+		}
+
+		if (field_end >= eol)
+			break;
+		p = field_end + 1;
+		if (pstate->allow_repeat_ifs) {
+			while (p < eol && *p == ifs)
+				p++;
+		}
+	}
+	return found;
+}
+
+static int prefilter_accepts_line(lrec_reader_mmap_dkvp_state_t* pstate, char* line, char* eol) {
+	lrec_prefilter_t* pprefilter = pstate->pprefilter;
+	int num_absent = 0;
+	for (int i = 0; i < pprefilter->num_terms; i++) {
+		lrec_prefilter_term_t* pterm = &pprefilter->pterms[i];
+		int has_needle = pterm->needle == NULL
+			|| mlr_memmem(line, eol - line, pterm->needle, pterm->needle_length) != NULL;
+		// Without the needle the term is false or absent, which is all we need to know for a single term.
+		if (!has_needle && pprefilter->num_terms == 1)
+			return FALSE;
+
+		char* value = NULL;
+		int value_length = 0;
+		int result;
+		if (!find_dkvp_value(pstate, line, eol, pterm, &value, &value_length))
+			result = PREFILTER_TERM_ABSENT;
+		else if (!has_needle)
+			result = PREFILTER_TERM_FALSE;
+		else
+			result = lrec_prefilter_evaluate_term(pprefilter, pterm, value, value_length);
+
+		if (result == PREFILTER_TERM_FALSE)
+			return FALSE;
+		if (result == PREFILTER_TERM_ABSENT)
+			num_absent++;
+	}
+	return num_absent < pprefilter->num_terms;
+}
+
+// Finds the end of the line at phandle->sol, not including the line terminator, and returns the
+// start of the next line. Nothing is zero-poked.
+static char* find_end_of_line(
+	file_reader_mmap_state_t *phandle,
+	lrec_reader_mmap_dkvp_state_t* pstate,
+	context_t* pctx,
+	char** peol)
+{
+	char* line = phandle->sol;
+	char* eol = (pstate->irslen == 1)
+		? memchr(line, pstate->irs[0], phandle->eof - line)
+		: mlr_memmem(line, phandle->eof - line, pstate->irs, pstate->irslen);
+	char* next = (eol == NULL) ? phandle->eof : eol + pstate->irslen;
+	if (eol == NULL) {
+		eol = phandle->eof;
+	} else if (pstate->do_auto_line_term) {
+		if (eol > line && eol[-1] == '\r') {
+			eol--;
+			context_set_autodetected_crlf(pctx);
+		} else {
+			context_set_autodetected_lf(pctx);
+		}
+	}
+	*peol = eol;
+	return next;
+}
+
+// Lines dropped here are still records as far as NR and FNR are concerned.
+static void skip_over_prefiltered_lines(
+	file_reader_mmap_state_t *phandle,
+	lrec_reader_mmap_dkvp_state_t* pstate,
+	context_t* pctx)
+{
+	while (TRUE) {
+		if (pstate->comment_string != NULL) {
+			if (pstate->irslen == 1)
+				skip_over_comment_lines_single_irs(phandle, pstate, pstate->irs[0]);
+			else
+				skip_over_comment_lines_multi_irs(phandle, pstate, pstate->irs, pstate->irslen);
+		}
+		if (phandle->sol >= phandle->eof)
+			return;
+
+		char* line = phandle->sol;
+		char* eol = NULL;
+		char* next = find_end_of_line(phandle, pstate, pctx, &eol);
+		if (prefilter_accepts_line(pstate, line, eol))
+			return;
+		phandle->sol = next;
+		pctx->nr++;
+		pctx->fnr++;
+	}
+}
+
 // ----------------------------------------------------------------
 static void skip_over_comment_lines_single_irs(
 	file_reader_mmap_state_t *phandle,
@@ -8,6 +8,7 @@
 // ================================================================
 
 #include <stdlib.h>
+#include <string.h>
 #include "cli/comment_handling.h"
 #include "lib/mlrutil.h"
 #include "input/file_reader_mmap.h"
@@ -23,10 +24,18 @@ typedef struct _lrec_reader_mmap_nidx_state_t {
 	comment_handling_t comment_handling;
 	char* comment_string;
 	int   comment_string_length;
+	hss_t* pprojection;
+	lrec_retainer_t* pretainer;
 } lrec_reader_mmap_nidx_state_t;
 
 static void    lrec_reader_mmap_nidx_free(lrec_reader_t* preader);
 static void    lrec_reader_mmap_nidx_sof(void* pvstate, void* pvhandle);
+static void    lrec_reader_mmap_nidx_set_projection(void* pvstate, hss_t* pprojection);
+static lrec_retainer_t* lrec_reader_mmap_nidx_alloc_retainer(lrec_reader_t* preader);
+static lrec_t* lrec_reader_mmap_nidx_reparse(void* pvstate, char* line);
+static lrec_t* lrec_reader_mmap_nidx_process_retained(void* pvstate, void* pvhandle, context_t* pctx);
+static lrec_t* lrec_reader_mmap_nidx_process_backward(void* pvstate, void* pvhandle, context_t* pctx);
+static long long lrec_reader_mmap_nidx_count(void* pvstate, void* pvhandle, context_t* pctx);
 static lrec_t* lrec_reader_mmap_nidx_process_single_irs_single_ifs(void* pvstate, void* pvhandle, context_t* pctx);
 static lrec_t* lrec_reader_mmap_nidx_process_single_irs_multi_ifs(void* pvstate, void* pvhandle, context_t* pctx);
 static lrec_t* lrec_reader_mmap_nidx_process_multi_irs_single_ifs(void* pvstate, void* pvhandle, context_t* pctx);
@@ -44,6 +53,12 @@ static lrec_t* lrec_parse_mmap_nidx_multi_irs_single_ifs(file_reader_mmap_state_
 static lrec_t* lrec_parse_mmap_nidx_multi_irs_multi_ifs(file_reader_mmap_state_t *phandle,
 	lrec_reader_mmap_nidx_state_t* pstate);
 
+static char* find_end_of_line(
+	file_reader_mmap_state_t *phandle,
+	lrec_reader_mmap_nidx_state_t* pstate,
+	context_t* pctx,
+	char** peol);
+
 static void skip_over_comment_lines_single_irs(
 	file_reader_mmap_state_t *phandle,
 	lrec_reader_mmap_nidx_state_t* pstate,
@@ -71,6 +86,8 @@ lrec_reader_t* lrec_reader_mmap_nidx_alloc(char* irs, char* ifs, int allow_repea
 	pstate->comment_handling         = comment_handling;
 	pstate->comment_string           = comment_string;
 	pstate->comment_string_length    = comment_string == NULL ? 0 : strlen(comment_string);
+	pstate->pprojection              = NULL;
+	pstate->pretainer                = NULL;
 
 	plrec_reader->pvstate     = (void*)pstate;
 	plrec_reader->popen_func  = file_reader_mmap_vopen;
@@ -99,12 +116,25 @@ lrec_reader_t* lrec_reader_mmap_nidx_alloc(char* irs, char* ifs, int allow_repea
 
 	plrec_reader->psof_func     = lrec_reader_mmap_nidx_sof;
 	plrec_reader->pfree_func    = lrec_reader_mmap_nidx_free;
+	plrec_reader->pset_projection_func = lrec_reader_mmap_nidx_set_projection;
+	plrec_reader->pset_prefilter_func  = NULL;
+	plrec_reader->palloc_retainer_func = lrec_reader_mmap_nidx_alloc_retainer;
+	// Comment lines would be passed through in the wrong order when reading backward.
+	if (comment_string == NULL) {
+		plrec_reader->pprocess_backward_func = lrec_reader_mmap_nidx_process_backward;
+		plrec_reader->pcount_func            = lrec_reader_mmap_nidx_count;
+	} else {
+		plrec_reader->pprocess_backward_func = NULL;
+		plrec_reader->pcount_func            = NULL;
+	}
 
 	return plrec_reader;
 }
 
 static void lrec_reader_mmap_nidx_free(lrec_reader_t* preader) {
-	free(preader->pvstate);
+	lrec_reader_mmap_nidx_state_t* pstate = preader->pvstate;
+	lrec_retainer_free(pstate->pretainer);
+	free(pstate);
 	free(preader);
 }
 
@@ -112,6 +142,30 @@ static void lrec_reader_mmap_nidx_free(lrec_reader_t* preader) {
 static void lrec_reader_mmap_nidx_sof(void* pvstate, void* pvhandle) {
 }
 
+static void lrec_reader_mmap_nidx_set_projection(void* pvstate, hss_t* pprojection) {
+	lrec_reader_mmap_nidx_state_t* pstate = pvstate;
+	pstate->pprojection = pprojection;
+}
+
+// From here on, lines are parsed as copies, leaving the mapped file as it was: the retainer's
+// extents point into it.
+static lrec_retainer_t* lrec_reader_mmap_nidx_alloc_retainer(lrec_reader_t* preader) {
+	lrec_reader_mmap_nidx_state_t* pstate = preader->pvstate;
+	if (pstate->pretainer == NULL)
+		pstate->pretainer = lrec_retainer_alloc(lrec_reader_mmap_nidx_reparse, pstate);
+	preader->pprocess_func = lrec_reader_mmap_nidx_process_retained;
+	return pstate->pretainer;
+}
+
+static lrec_t* lrec_reader_mmap_nidx_reparse(void* pvstate, char* line) {
+	lrec_reader_mmap_nidx_state_t* pstate = pvstate;
+	if (pstate->ifslen == 1)
+		return lrec_parse_stdio_nidx_single_sep(line, pstate->ifs[0], pstate->allow_repeat_ifs, pstate->pprojection);
+	else
+		return lrec_parse_stdio_nidx_multi_sep(line, pstate->ifs, pstate->ifslen, pstate->allow_repeat_ifs,
+			pstate->pprojection);
+}
+
 // ----------------------------------------------------------------
 static lrec_t* lrec_reader_mmap_nidx_process_single_irs_single_ifs(void* pvstate, void* pvhandle, context_t* pctx) {
 	file_reader_mmap_state_t* phandle = pvhandle;
@@ -149,6 +203,57 @@ static lrec_t* lrec_reader_mmap_nidx_process_multi_irs_multi_ifs(void* pvstate,
 		return lrec_parse_mmap_nidx_multi_irs_multi_ifs(phandle, pstate);
 }
 
+static lrec_t* lrec_reader_mmap_nidx_process_retained(void* pvstate, void* pvhandle, context_t* pctx) {
+	file_reader_mmap_state_t* phandle = pvhandle;
+	lrec_reader_mmap_nidx_state_t* pstate = pvstate;
+	if (pstate->comment_string != NULL) {
+		if (pstate->irslen == 1)
+			skip_over_comment_lines_single_irs(phandle, pstate, pstate->irs[0]);
+		else
+			skip_over_comment_lines_multi_irs(phandle, pstate, pstate->irs, pstate->irslen);
+	}
+	if (phandle->sol >= phandle->eof)
+		return NULL;
+
+	lrec_retainer_t* pretainer = pstate->pretainer;
+	char* eol = NULL;
+	pretainer->current.line = phandle->sol;
+	phandle->sol = find_end_of_line(phandle, pstate, pctx, &eol);
+	pretainer->current.length = eol - pretainer->current.line;
+	return lrec_retainer_reparse(pretainer, &pretainer->current);
+}
+
+// Lines read backward are parsed as copies, as for retention. Every line is a record.
+static lrec_t* lrec_reader_mmap_nidx_process_backward(void* pvstate, void* pvhandle, context_t* pctx) {
+	file_reader_mmap_state_t* phandle = pvhandle;
+	lrec_reader_mmap_nidx_state_t* pstate = pvstate;
+	if (pstate->do_auto_line_term && !pctx->auto_line_term_detected) {
+		// Before any record is emitted, and by the first line as when reading forward: the last one may
+		// well be unterminated.
+		char* p = file_reader_mmap_get_first_line_end(phandle, pstate->irs, pstate->irslen);
+		if (p != NULL) {
+			if (p > phandle->sol && p[-1] == '\r')
+				context_set_autodetected_crlf(pctx);
+			else
+				context_set_autodetected_lf(pctx);
+		}
+	}
+	char* eol = NULL;
+	int terminated = FALSE;
+	char* line = file_reader_mmap_get_last_line(phandle, pstate->irs, pstate->irslen, &eol, &terminated);
+	if (line == NULL)
+		return NULL;
+	if (terminated && pstate->do_auto_line_term && eol > line && eol[-1] == '\r')
+		eol--;
+	return lrec_reader_mmap_nidx_reparse(pstate, mlr_alloc_string_from_char_range(line, eol - line));
+}
+
+static long long lrec_reader_mmap_nidx_count(void* pvstate, void* pvhandle, context_t* pctx) {
+	file_reader_mmap_state_t* phandle = pvhandle;
+	lrec_reader_mmap_nidx_state_t* pstate = pvstate;
+	return mlr_count_lines(phandle->sol, phandle->eof - phandle->sol, pstate->irs, pstate->irslen);
+}
+
 // ----------------------------------------------------------------
 static lrec_t* lrec_parse_mmap_nidx_single_irs_single_ifs(file_reader_mmap_state_t *phandle,
 	char irs, char ifs, lrec_reader_mmap_nidx_state_t* pstate, context_t* pctx)
@@ -194,7 +299,7 @@ static lrec_t* lrec_parse_mmap_nidx_single_irs_single_ifs(file_reader_mmap_state
 
 			idx++;
 			key = low_int_to_string(idx, &free_flags);
-			lrec_put(prec, key, value, free_flags);
+			lrec_put_projected(prec, key, value, free_flags, pstate->pprojection);
 
 			p++;
 			if (pstate->allow_repeat_ifs) {
@@ -218,14 +323,14 @@ static lrec_t* lrec_parse_mmap_nidx_single_irs_single_ifs(file_reader_mmap_state
 	if (saw_rs) {
 		// Easy and simple case: we read until end of line.  We zero-poked the irs to a null character to terminate the
 		// C string so it's OK to retain a pointer to that.
-		lrec_put(prec, key, value, free_flags);
+		lrec_put_projected(prec, key, value, free_flags, pstate->pprojection);
 	} else {
 		// Messier case: we read to end of file without seeing end of line.  We can't always zero-poke a null character
 		// to terminate the C string: if the file size is not a multiple of the OS page size it'll work (it's our
 		// copy-on-write memory). But if the file size is a multiple of the page size, then zero-poking at EOF is one
 		// byte past the page and that will segv us.
 		char* copy = mlr_alloc_string_from_char_range(value, phandle->eof - value);
-		lrec_put(prec, key, copy, free_flags|FREE_ENTRY_VALUE);
+		lrec_put_projected(prec, key, copy, free_flags|FREE_ENTRY_VALUE, pstate->pprojection);
 	}
 
 	return prec;
@@ -276,7 +381,7 @@ static lrec_t* lrec_parse_mmap_nidx_single_irs_multi_ifs(file_reader_mmap_state_
 
 			idx++;
 			key = low_int_to_string(idx, &free_flags);
-			lrec_put(prec, key, value, free_flags);
+			lrec_put_projected(prec, key, value, free_flags, pstate->pprojection);
 
 			p += ifslen;
 			if (pstate->allow_repeat_ifs) {
@@ -300,14 +405,14 @@ static lrec_t* lrec_parse_mmap_nidx_single_irs_multi_ifs(file_reader_mmap_state_
 	if (saw_rs) {
 		// Easy and simple case: we read until end of line.  We zero-poked the irs to a null character to terminate the
 		// C string so it's OK to retain a pointer to that.
-		lrec_put(prec, key, value, free_flags);
+		lrec_put_projected(prec, key, value, free_flags, pstate->pprojection);
 	} else {
 		// Messier case: we read to end of file without seeing end of line.  We can't always zero-poke a null character
 		// to terminate the C string: if the file size is not a multiple of the OS page size it'll work (it's our
 		// copy-on-write memory). But if the file size is a multiple of the page size, then zero-poking at EOF is one
 		// byte past the page and that will segv us.
 		char* copy = mlr_alloc_string_from_char_range(value, phandle->eof - value);
-		lrec_put(prec, key, copy, free_flags|FREE_ENTRY_VALUE);
+		lrec_put_projected(prec, key, copy, free_flags|FREE_ENTRY_VALUE, pstate->pprojection);
 	}
 
 	return prec;
@@ -348,7 +453,7 @@ static lrec_t* lrec_parse_mmap_nidx_multi_irs_single_ifs(file_reader_mmap_state_
 
 			idx++;
 			key = low_int_to_string(idx, &free_flags);
-			lrec_put(prec, key, value, free_flags);
+			lrec_put_projected(prec, key, value, free_flags, pstate->pprojection);
 
 			p++;
 			if (pstate->allow_repeat_ifs) {
@@ -372,14 +477,14 @@ static lrec_t* lrec_parse_mmap_nidx_multi_irs_single_ifs(file_reader_mmap_state_
 	if (saw_rs) {
 		// Easy and simple case: we read until end of line.  We zero-poked the irs to a null character to terminate the
 		// C string so it's OK to retain a pointer to that.
-		lrec_put(prec, key, value, free_flags);
+		lrec_put_projected(prec, key, value, free_flags, pstate->pprojection);
 	} else {
 		// Messier case: we read to end of file without seeing end of line.  We can't always zero-poke a null character
 		// to terminate the C string: if the file size is not a multiple of the OS page size it'll work (it's our
 		// copy-on-write memory). But if the file size is a multiple of the page size, then zero-poking at EOF is one
 		// byte past the page and that will segv us.
 		char* copy = mlr_alloc_string_from_char_range(value, phandle->eof - value);
-		lrec_put(prec, key, copy, free_flags|FREE_ENTRY_VALUE);
+		lrec_put_projected(prec, key, copy, free_flags|FREE_ENTRY_VALUE, pstate->pprojection);
 	}
 
 	return prec;
@@ -421,7 +526,7 @@ static lrec_t* lrec_parse_mmap_nidx_multi_irs_multi_ifs(file_reader_mmap_state_t
 
 			idx++;
 			key = low_int_to_string(idx, &free_flags);
-			lrec_put(prec, key, value, free_flags);
+			lrec_put_projected(prec, key, value, free_flags, pstate->pprojection);
 
 			p += ifslen;
 			if (pstate->allow_repeat_ifs) {
@@ -445,19 +550,47 @@ static lrec_t* lrec_parse_mmap_nidx_multi_irs_multi_ifs(file_reader_mmap_state_t
 	if (saw_rs) {
 		// Easy and simple case: we read until end of line.  We zero-poked the irs to a null character to terminate the
 		// C string so it's OK to retain a pointer to that.
-		lrec_put(prec, key, value, free_flags);
+		lrec_put_projected(prec, key, value, free_flags, pstate->pprojection);
 	} else {
 		// Messier case: we read to end of file without seeing end of line.  We can't always zero-poke a null character
 		// to terminate the C string: if the file size is not a multiple of the OS page size it'll work (it's our
 		// copy-on-write memory). But if the file size is a multiple of the page size, then zero-poking at EOF is one
 		// byte past the page and that will segv us.
 		char* copy = mlr_alloc_string_from_char_range(value, phandle->eof - value);
-		lrec_put(prec, key, copy, free_flags|FREE_ENTRY_VALUE);
+		lrec_put_projected(prec, key, copy, free_flags|FREE_ENTRY_VALUE, pstate->pprojection);
 	}
 
 	return prec;
 }
 
+// ----------------------------------------------------------------
+// Finds the end of the line at phandle->sol, not including the line terminator, and returns the
+// start of the next line. Nothing is zero-poked.
+static char* find_end_of_line(
+	file_reader_mmap_state_t *phandle,
+	lrec_reader_mmap_nidx_state_t* pstate,
+	context_t* pctx,
+	char** peol)
+{
+	char* line = phandle->sol;
+	char* eol = (pstate->irslen == 1)
+		? memchr(line, pstate->irs[0], phandle->eof - line)
+		: mlr_memmem(line, phandle->eof - line, pstate->irs, pstate->irslen);
+	char* next = (eol == NULL) ? phandle->eof : eol + pstate->irslen;
+	if (eol == NULL) {
+		eol = phandle->eof;
+	} else if (pstate->do_auto_line_term) {
+		if (eol > line && eol[-1] == '\r') {
+			eol--;
+			context_set_autodetected_crlf(pctx);
+		} else {
+			context_set_autodetected_lf(pctx);
+		}
+	}
+	*peol = eol;
+	return next;
+}
+
 // ----------------------------------------------------------------
 static void skip_over_comment_lines_single_irs(
 	file_reader_mmap_state_t *phandle,
@@ -94,6 +94,11 @@ lrec_reader_t* lrec_reader_mmap_xtab_alloc(char* ifs, char* ips, int allow_repea
 
 	plrec_reader->psof_func     = lrec_reader_mmap_xtab_sof;
 	plrec_reader->pfree_func    = lrec_reader_mmap_xtab_free;
+	plrec_reader->pset_projection_func = NULL;
+	plrec_reader->pset_prefilter_func  = NULL;
+	plrec_reader->palloc_retainer_func = NULL;
+	plrec_reader->pprocess_backward_func = NULL;
+	plrec_reader->pcount_func          = NULL;
 
 	return plrec_reader;
 }
@@ -108,6 +108,11 @@ lrec_reader_t* lrec_reader_stdio_csvlite_alloc(char* irs, char* ifs, int allow_r
 	plrec_reader->pprocess_func = lrec_reader_stdio_csvlite_process;
 	plrec_reader->psof_func     = lrec_reader_stdio_sof;
 	plrec_reader->pfree_func    = lrec_reader_stdio_csvlite_free;
+	plrec_reader->pset_projection_func = NULL;
+	plrec_reader->pset_prefilter_func  = NULL;
+	plrec_reader->palloc_retainer_func = NULL;
+	plrec_reader->pprocess_backward_func = NULL;
+	plrec_reader->pcount_func          = NULL;
 
 	return plrec_reader;
 }
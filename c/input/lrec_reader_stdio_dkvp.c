@@ -27,10 +27,12 @@ typedef struct _lrec_reader_stdio_dkvp_state_t {
 	comment_handling_t comment_handling;
 	char*  comment_string;
 	size_t line_length;
+	hss_t* pprojection;
 } lrec_reader_stdio_dkvp_state_t;
 
 static void    lrec_reader_stdio_dkvp_free(lrec_reader_t* preader);
 static void    lrec_reader_stdio_dkvp_sof(void* pvstate, void* pvhandle);
+static void    lrec_reader_stdio_dkvp_set_projection(void* pvstate, hss_t* pprojection);
 static lrec_t* lrec_reader_stdio_dkvp_process_single_irs_single_others_auto_line_term(void* pvstate, void* pvhandle,
 	context_t* pctx);
 static lrec_t* lrec_reader_stdio_dkvp_process_single_irs_multi_others_auto_line_term(void* pvstate, void* pvhandle,
@@ -62,6 +64,7 @@ lrec_reader_t* lrec_reader_stdio_dkvp_alloc(char* irs, char* ifs, char* ips, int
 	pstate->comment_string   = comment_string;
 	// This is used to track nominal line length over the file read. Bootstrap with a default length.
 	pstate->line_length      = MLR_ALLOC_READ_LINE_INITIAL_SIZE;
+	pstate->pprojection      = NULL;
 
 	plrec_reader->pvstate       = (void*)pstate;
 	plrec_reader->popen_func    = file_reader_stdio_vopen;
@@ -87,6 +90,11 @@ lrec_reader_t* lrec_reader_stdio_dkvp_alloc(char* irs, char* ifs, char* ips, int
 	}
 	plrec_reader->psof_func     = lrec_reader_stdio_dkvp_sof;
 	plrec_reader->pfree_func    = lrec_reader_stdio_dkvp_free;
+	plrec_reader->pset_projection_func = lrec_reader_stdio_dkvp_set_projection;
+	plrec_reader->pset_prefilter_func  = NULL;
+	plrec_reader->palloc_retainer_func = NULL;
+	plrec_reader->pprocess_backward_func = NULL;
+	plrec_reader->pcount_func          = NULL;
 
 	return plrec_reader;
 }
@@ -100,6 +108,11 @@ static void lrec_reader_stdio_dkvp_free(lrec_reader_t* preader) {
 static void lrec_reader_stdio_dkvp_sof(void* pvstate, void* pvhandle) {
 }
 
+static void lrec_reader_stdio_dkvp_set_projection(void* pvstate, hss_t* pprojection) {
+	lrec_reader_stdio_dkvp_state_t* pstate = pvstate;
+	pstate->pprojection = pprojection;
+}
+
 // ----------------------------------------------------------------
 static lrec_t* lrec_reader_stdio_dkvp_process_single_irs_single_others_auto_line_term(
 	void* pvstate, void* pvhandle, context_t* pctx)
@@ -116,7 +129,8 @@ static lrec_t* lrec_reader_stdio_dkvp_process_single_irs_single_others_auto_line
 	if (line == NULL) {
 		return NULL;
 	} else {
-		return lrec_parse_stdio_dkvp_single_sep(line, pstate->ifs[0], pstate->ips[0], pstate->allow_repeat_ifs);
+		return lrec_parse_stdio_dkvp_single_sep(line, pstate->ifs[0], pstate->ips[0], pstate->allow_repeat_ifs,
+			pstate->pprojection);
 	}
 }
 
@@ -134,7 +148,7 @@ static lrec_t* lrec_reader_stdio_dkvp_process_single_irs_multi_others_auto_line_
 		return NULL;
 	} else {
 		return lrec_parse_stdio_dkvp_multi_sep(line, pstate->ifs, pstate->ips, pstate->ifslen, pstate->ipslen,
-			pstate->allow_repeat_ifs);
+			pstate->allow_repeat_ifs, pstate->pprojection);
 	}
 }
 
@@ -148,7 +162,8 @@ static lrec_t* lrec_reader_stdio_dkvp_process_single_irs_single_others(void* pvs
 	if (line == NULL)
 		return NULL;
 	else
-		return lrec_parse_stdio_dkvp_single_sep(line, pstate->ifs[0], pstate->ips[0], pstate->allow_repeat_ifs);
+		return lrec_parse_stdio_dkvp_single_sep(line, pstate->ifs[0], pstate->ips[0], pstate->allow_repeat_ifs,
+			pstate->pprojection);
 }
 
 static lrec_t* lrec_reader_stdio_dkvp_process_single_irs_multi_others(void* pvstate, void* pvhandle, context_t* pctx) {
@@ -163,7 +178,7 @@ static lrec_t* lrec_reader_stdio_dkvp_process_single_irs_multi_others(void* pvst
 		return NULL;
 	else
 		return lrec_parse_stdio_dkvp_multi_sep(line, pstate->ifs, pstate->ips, pstate->ifslen, pstate->ipslen,
-			pstate->allow_repeat_ifs);
+			pstate->allow_repeat_ifs, pstate->pprojection);
 }
 
 static lrec_t* lrec_reader_stdio_dkvp_process_multi_irs_single_others(void* pvstate, void* pvhandle, context_t* pctx) {
@@ -177,7 +192,8 @@ static lrec_t* lrec_reader_stdio_dkvp_process_multi_irs_single_others(void* pvst
 	if (line == NULL)
 		return NULL;
 	else
-		return lrec_parse_stdio_dkvp_single_sep(line, pstate->ifs[0], pstate->ips[0], pstate->allow_repeat_ifs);
+		return lrec_parse_stdio_dkvp_single_sep(line, pstate->ifs[0], pstate->ips[0], pstate->allow_repeat_ifs,
+			pstate->pprojection);
 }
 
 static lrec_t* lrec_reader_stdio_dkvp_process_multi_irs_multi_others(void* pvstate, void* pvhandle, context_t* pctx) {
@@ -192,7 +208,7 @@ static lrec_t* lrec_reader_stdio_dkvp_process_multi_irs_multi_others(void* pvsta
 		return NULL;
 	else
 		return lrec_parse_stdio_dkvp_multi_sep(line, pstate->ifs, pstate->ips, pstate->ifslen, pstate->ipslen,
-			pstate->allow_repeat_ifs);
+			pstate->allow_repeat_ifs, pstate->pprojection);
 }
 
 // ----------------------------------------------------------------
@@ -204,7 +220,9 @@ static lrec_t* lrec_reader_stdio_dkvp_process_multi_irs_multi_others(void* pvsta
 // I couldn't find a performance gain using stdlib index(3) ... *maybe* even a
 // fraction of a percent *slower*.
 
-lrec_t* lrec_parse_stdio_dkvp_single_sep(char* line, char ifs, char ips, int allow_repeat_ifs) {
+lrec_t* lrec_parse_stdio_dkvp_single_sep(char* line, char ifs, char ips, int allow_repeat_ifs,
+	hss_t* pprojection)
+{
 	lrec_t* prec = lrec_dkvp_alloc(line);
 
 	// It would be easier to split the line on field separator (e.g. ","), then
@@ -234,10 +252,10 @@ lrec_t* lrec_parse_stdio_dkvp_single_sep(char* line, char ifs, char ips, int all
 				// "a=".  Here we use the positional index as the key. This way
 				// DKVP is a generalization of NIDX.
 				char  free_flags = 0;
-				lrec_put(prec, low_int_to_string(idx, &free_flags), value, free_flags);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), value, free_flags, pprojection);
 			}
 			else {
-				lrec_put(prec, key, value, NO_FREE);
+				lrec_put_projected(prec, key, value, NO_FREE, pprojection);
 			}
 
 			p++;
@@ -263,10 +281,10 @@ lrec_t* lrec_parse_stdio_dkvp_single_sep(char* line, char ifs, char ips, int all
 	} else {
 		if (*key == 0 || value <= key) {
 			char  free_flags = 0;
-			lrec_put(prec, low_int_to_string(idx, &free_flags), value, free_flags);
+			lrec_put_projected(prec, low_int_to_string(idx, &free_flags), value, free_flags, pprojection);
 		}
 		else {
-			lrec_put(prec, key, value, NO_FREE);
+			lrec_put_projected(prec, key, value, NO_FREE, pprojection);
 		}
 	}
 
@@ -274,7 +292,7 @@ lrec_t* lrec_parse_stdio_dkvp_single_sep(char* line, char ifs, char ips, int all
 }
 
 lrec_t* lrec_parse_stdio_dkvp_multi_sep(char* line, char* ifs, char* ips, int ifslen, int ipslen,
-	int allow_repeat_ifs)
+	int allow_repeat_ifs, hss_t* pprojection)
 {
 	lrec_t* prec = lrec_dkvp_alloc(line);
 
@@ -305,10 +323,10 @@ lrec_t* lrec_parse_stdio_dkvp_multi_sep(char* line, char* ifs, char* ips, int if
 				// "a=".  Here we use the positional index as the key. This way
 				// DKVP is a generalization of NIDX.
 				char  free_flags = 0;
-				lrec_put(prec, low_int_to_string(idx, &free_flags), value, free_flags);
+				lrec_put_projected(prec, low_int_to_string(idx, &free_flags), value, free_flags, pprojection);
 			}
 			else {
-				lrec_put(prec, key, value, NO_FREE);
+				lrec_put_projected(prec, key, value, NO_FREE, pprojection);
 			}
 
 			p += ifslen;
@@ -334,10 +352,10 @@ lrec_t* lrec_parse_stdio_dkvp_multi_sep(char* line, char* ifs, char* ips, int if
 	} else {
 		if (*key == 0 || value <= key) {
 			char  free_flags = 0;
-			lrec_put(prec, low_int_to_string(idx, &free_flags), value, free_flags);
+			lrec_put_projected(prec, low_int_to_string(idx, &free_flags), value, free_flags, pprojection);
 		}
 		else {
-			lrec_put(prec, key, value, NO_FREE);
+			lrec_put_projected(prec, key, value, NO_FREE, pprojection);
 		}
 	}
 
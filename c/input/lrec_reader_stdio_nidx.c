@@ -23,10 +23,12 @@ typedef struct _lrec_reader_stdio_nidx_state_t {
 	comment_handling_t comment_handling;
 	char*  comment_string;
 	size_t line_length;
+	hss_t* pprojection;
 } lrec_reader_stdio_nidx_state_t;
 
 static void    lrec_reader_stdio_nidx_free(lrec_reader_t* preader);
 static void    lrec_reader_stdio_nidx_sof(void* pvstate, void* pvhandle);
+static void    lrec_reader_stdio_nidx_set_projection(void* pvstate, hss_t* pprojection);
 static lrec_t* lrec_reader_stdio_nidx_process_single_irs_single_ifs_auto_line_term(void* pvstate, void* pvhandle,
 	context_t* pctx);
 static lrec_t* lrec_reader_stdio_nidx_process_single_irs_multi_ifs_auto_line_term(void* pvstate, void* pvhandle,
@@ -52,6 +54,7 @@ lrec_reader_t* lrec_reader_stdio_nidx_alloc(char* irs, char* ifs, int allow_repe
 	pstate->comment_string   = comment_string;
 	// This is used to track nominal line length over the file read. Bootstrap with a default length.
 	pstate->line_length      = MLR_ALLOC_READ_LINE_INITIAL_SIZE;
+	pstate->pprojection      = NULL;
 
 	plrec_reader->pvstate       = (void*)pstate;
 	plrec_reader->popen_func    = file_reader_stdio_vopen;
@@ -77,6 +80,11 @@ lrec_reader_t* lrec_reader_stdio_nidx_alloc(char* irs, char* ifs, int allow_repe
 	}
 	plrec_reader->psof_func     = lrec_reader_stdio_nidx_sof;
 	plrec_reader->pfree_func    = lrec_reader_stdio_nidx_free;
+	plrec_reader->pset_projection_func = lrec_reader_stdio_nidx_set_projection;
+	plrec_reader->pset_prefilter_func  = NULL;
+	plrec_reader->palloc_retainer_func = NULL;
+	plrec_reader->pprocess_backward_func = NULL;
+	plrec_reader->pcount_func          = NULL;
 
 	return plrec_reader;
 }
@@ -90,6 +98,11 @@ static void lrec_reader_stdio_nidx_free(lrec_reader_t* preader) {
 static void lrec_reader_stdio_nidx_sof(void* pvstate, void* pvhandle) {
 }
 
+static void lrec_reader_stdio_nidx_set_projection(void* pvstate, hss_t* pprojection) {
+	lrec_reader_stdio_nidx_state_t* pstate = pvstate;
+	pstate->pprojection = pprojection;
+}
+
 // ----------------------------------------------------------------
 static lrec_t* lrec_reader_stdio_nidx_process_single_irs_single_ifs_auto_line_term(void* pvstate, void* pvhandle, context_t* pctx) {
 	FILE* input_stream = pvhandle;
@@ -104,7 +117,8 @@ static lrec_t* lrec_reader_stdio_nidx_process_single_irs_single_ifs_auto_line_te
 	if (line == NULL) {
 		return NULL;
 	} else {
-		return lrec_parse_stdio_nidx_single_sep(line, pstate->ifs[0], pstate->allow_repeat_ifs);
+		return lrec_parse_stdio_nidx_single_sep(line, pstate->ifs[0], pstate->allow_repeat_ifs,
+			pstate->pprojection);
 	}
 }
 
@@ -121,7 +135,8 @@ static lrec_t* lrec_reader_stdio_nidx_process_single_irs_multi_ifs_auto_line_ter
 	if (line == NULL) {
 		return NULL;
 	} else {
-		return lrec_parse_stdio_nidx_multi_sep(line, pstate->ifs, pstate->ifslen, pstate->allow_repeat_ifs);
+		return lrec_parse_stdio_nidx_multi_sep(line, pstate->ifs, pstate->ifslen, pstate->allow_repeat_ifs,
+			pstate->pprojection);
 	}
 }
 
@@ -138,7 +153,8 @@ static lrec_t* lrec_reader_stdio_nidx_process_single_irs_single_ifs(void* pvstat
 	if (line == NULL)
 		return NULL;
 	else
-		return lrec_parse_stdio_nidx_single_sep(line, pstate->ifs[0], pstate->allow_repeat_ifs);
+		return lrec_parse_stdio_nidx_single_sep(line, pstate->ifs[0], pstate->allow_repeat_ifs,
+			pstate->pprojection);
 }
 
 static lrec_t* lrec_reader_stdio_nidx_process_single_irs_multi_ifs(void* pvstate, void* pvhandle, context_t* pctx) {
@@ -154,7 +170,8 @@ static lrec_t* lrec_reader_stdio_nidx_process_single_irs_multi_ifs(void* pvstate
 	if (line == NULL)
 		return NULL;
 	else
-		return lrec_parse_stdio_nidx_multi_sep(line, pstate->ifs, pstate->ifslen, pstate->allow_repeat_ifs);
+		return lrec_parse_stdio_nidx_multi_sep(line, pstate->ifs, pstate->ifslen, pstate->allow_repeat_ifs,
+			pstate->pprojection);
 }
 
 static lrec_t* lrec_reader_stdio_nidx_process_multi_irs_single_ifs(void* pvstate, void* pvhandle, context_t* pctx) {
@@ -168,7 +185,8 @@ static lrec_t* lrec_reader_stdio_nidx_process_multi_irs_single_ifs(void* pvstate
 	if (line == NULL)
 		return NULL;
 	else
-		return lrec_parse_stdio_nidx_single_sep(line, pstate->ifs[0], pstate->allow_repeat_ifs);
+		return lrec_parse_stdio_nidx_single_sep(line, pstate->ifs[0], pstate->allow_repeat_ifs,
+			pstate->pprojection);
 }
 
 static lrec_t* lrec_reader_stdio_nidx_process_multi_irs_multi_ifs(void* pvstate, void* pvhandle, context_t* pctx) {
@@ -182,11 +200,12 @@ static lrec_t* lrec_reader_stdio_nidx_process_multi_irs_multi_ifs(void* pvstate,
 	if (line == NULL)
 		return NULL;
 	else
-		return lrec_parse_stdio_nidx_multi_sep(line, pstate->ifs, pstate->ifslen, pstate->allow_repeat_ifs);
+		return lrec_parse_stdio_nidx_multi_sep(line, pstate->ifs, pstate->ifslen, pstate->allow_repeat_ifs,
+			pstate->pprojection);
 }
 
 // ----------------------------------------------------------------
-lrec_t* lrec_parse_stdio_nidx_single_sep(char* line, char ifs, int allow_repeat_ifs) {
+lrec_t* lrec_parse_stdio_nidx_single_sep(char* line, char ifs, int allow_repeat_ifs, hss_t* pprojection) {
 	lrec_t* prec = lrec_nidx_alloc(line);
 
 	int idx = 0;
@@ -205,7 +224,7 @@ lrec_t* lrec_parse_stdio_nidx_single_sep(char* line, char ifs, int allow_repeat_
 
 			idx++;
 			key = low_int_to_string(idx, &free_flags);
-			lrec_put(prec, key, value, free_flags);
+			lrec_put_projected(prec, key, value, free_flags, pprojection);
 
 			p++;
 			if (allow_repeat_ifs) {
@@ -223,14 +242,16 @@ lrec_t* lrec_parse_stdio_nidx_single_sep(char* line, char ifs, int allow_repeat_
 		; // OK
 	} else {
 		key = low_int_to_string(idx, &free_flags);
-		lrec_put(prec, key, value, free_flags);
+		lrec_put_projected(prec, key, value, free_flags, pprojection);
 	}
 
 	return prec;
 }
 
 // ----------------------------------------------------------------
-lrec_t* lrec_parse_stdio_nidx_multi_sep(char* line, char* ifs, int ifslen, int allow_repeat_ifs) {
+lrec_t* lrec_parse_stdio_nidx_multi_sep(char* line, char* ifs, int ifslen, int allow_repeat_ifs,
+	hss_t* pprojection)
+{
 	lrec_t* prec = lrec_nidx_alloc(line);
 
 	int  idx = 0;
@@ -249,7 +270,7 @@ lrec_t* lrec_parse_stdio_nidx_multi_sep(char* line, char* ifs, int ifslen, int a
 
 			idx++;
 			key = low_int_to_string(idx, &free_flags);
-			lrec_put(prec, key, value, free_flags);
+			lrec_put_projected(prec, key, value, free_flags, pprojection);
 
 			p += ifslen;
 			if (allow_repeat_ifs) {
@@ -267,7 +288,7 @@ lrec_t* lrec_parse_stdio_nidx_multi_sep(char* line, char* ifs, int ifslen, int a
 		; // OK
 	} else {
 		key = low_int_to_string(idx, &free_flags);
-		lrec_put(prec, key, value, free_flags);
+		lrec_put_projected(prec, key, value, free_flags, pprojection);
 	}
 
 	return prec;
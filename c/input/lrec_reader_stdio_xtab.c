@@ -63,6 +63,11 @@ lrec_reader_t* lrec_reader_stdio_xtab_alloc(char* ifs, char* ips, int allow_repe
 	plrec_reader->pprocess_func = lrec_reader_stdio_xtab_process;
 	plrec_reader->psof_func     = lrec_reader_stdio_xtab_sof;
 	plrec_reader->pfree_func    = lrec_reader_stdio_xtab_free;
+	plrec_reader->pset_projection_func = NULL;
+	plrec_reader->pset_prefilter_func  = NULL;
+	plrec_reader->palloc_retainer_func = NULL;
+	plrec_reader->pprocess_backward_func = NULL;
+	plrec_reader->pcount_func          = NULL;
 
 	return plrec_reader;
 }
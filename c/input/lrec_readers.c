@@ -1,6 +1,10 @@
+#include <ctype.h>
+#include <string.h>
+#include <strings.h>
 #include "cli/comment_handling.h"
 #include "lib/mlrutil.h"
 #include "lib/mlr_globals.h"
+#include "lib/mvfuncs.h"
 #include "input/lrec_readers.h"
 #include "input/byte_readers.h"
 
@@ -65,3 +69,141 @@ lrec_reader_t* lrec_reader_alloc_or_die(cli_reader_opts_t* popts) {
 	}
 	return plrec_reader;
 }
+
+// ----------------------------------------------------------------
+char* lrec_reader_get_projection_flags(char* pold_flags, slls_t* pheader_keys, hss_t* pprojection) {
+	if (pprojection == NULL) {
+		free(pold_flags);
+		return NULL;
+	}
+	char* pflags = mlr_realloc_or_die(pold_flags, pheader_keys->length + 1);
+	int i = 0;
+	for (sllse_t* pe = pheader_keys->phead; pe != NULL; pe = pe->pnext, i++)
+		pflags[i] = hss_has(pprojection, pe->value);
+	return pflags;
+}
+
+// ----------------------------------------------------------------
+lrec_prefilter_t* lrec_prefilter_alloc(mv_t (*ptype_infer_func)(char* string)) {
+	lrec_prefilter_t* pprefilter = mlr_malloc_or_die(sizeof(lrec_prefilter_t));
+	pprefilter->num_terms           = 0;
+	pprefilter->num_terms_allocated = 2;
+	pprefilter->pterms              = mlr_malloc_or_die(2 * sizeof(lrec_prefilter_term_t));
+	pprefilter->ptype_infer_func    = ptype_infer_func;
+	pprefilter->value_buffer_length = 64;
+	pprefilter->value_buffer        = mlr_malloc_or_die(64);
+	return pprefilter;
+}
+
+void lrec_prefilter_free(lrec_prefilter_t* pprefilter) {
+	if (pprefilter == NULL)
+		return;
+	free(pprefilter->pterms);
+	free(pprefilter->value_buffer);
+	free(pprefilter);
+}
+
+// A number compares equal to a string when its formatted value does, so with
+// numbers inferred from the data the literal can only be a needle if no number
+// formats to it: no digits, and not inf or nan.
+static int string_can_be_formatted_number(char* string) {
+	for (char* p = string; *p; p++) {
+		if (isdigit((unsigned char)*p))
+			return TRUE;
+		if (strncasecmp(p, "inf", 3) == 0 || strncasecmp(p, "nan", 3) == 0)
+			return TRUE;
+	}
+	return FALSE;
+}
+
+void lrec_prefilter_add_term(lrec_prefilter_t* pprefilter, char* field_name, mv_t literal, int literal_is_left) {
+	if (pprefilter->num_terms >= pprefilter->num_terms_allocated) {
+		pprefilter->num_terms_allocated *= 2;
+		pprefilter->pterms = mlr_realloc_or_die(pprefilter->pterms,
+			pprefilter->num_terms_allocated * sizeof(lrec_prefilter_term_t));
+	}
+	lrec_prefilter_term_t* pterm = &pprefilter->pterms[pprefilter->num_terms++];
+	pterm->field_name        = field_name;
+	pterm->field_name_length = strlen(field_name);
+	pterm->literal           = literal;
+	pterm->literal_is_left   = literal_is_left;
+	pterm->needle            = NULL;
+	pterm->needle_length     = 0;
+	if (literal.type == MT_STRING && *literal.u.strv != 0) {
+		if (pprefilter->ptype_infer_func == mv_ref_type_infer_string
+		|| !string_can_be_formatted_number(literal.u.strv))
+		{
+			pterm->needle        = literal.u.strv;
+			pterm->needle_length = strlen(literal.u.strv);
+		}
+	}
+}
+
+int lrec_prefilter_evaluate_term(lrec_prefilter_t* pprefilter, lrec_prefilter_term_t* pterm,
+	char* value, int value_length)
+{
+	if (value == NULL)
+		return PREFILTER_TERM_ABSENT;
+	if (value_length >= pprefilter->value_buffer_length) {
+		pprefilter->value_buffer_length = value_length + 1;
+		pprefilter->value_buffer = mlr_realloc_or_die(pprefilter->value_buffer, value_length + 1);
+	}
+	memcpy(pprefilter->value_buffer, value, value_length);
+	pprefilter->value_buffer[value_length] = 0;
+
+	// The comparators may mv_free their arguments, so the literal is passed by copy.
+	mv_t field_value = pprefilter->ptype_infer_func(pprefilter->value_buffer);
+	mv_t literal = pterm->literal;
+	mv_t result = pterm->literal_is_left
+		? eq_op_func(&literal, &field_value)
+		: eq_op_func(&field_value, &literal);
+	if (result.type == MT_ABSENT)
+		return PREFILTER_TERM_ABSENT;
+	if (result.type != MT_BOOLEAN)
+		return PREFILTER_TERM_TRUE;
+	return result.u.boolv ? PREFILTER_TERM_TRUE : PREFILTER_TERM_FALSE;
+}
+
+// ----------------------------------------------------------------
+lrec_retainer_t* lrec_retainer_alloc(lrec_retainer_reparse_func_t* preparse_func, void* pvstate) {
+	lrec_retainer_t* pretainer = mlr_malloc_or_die(sizeof(lrec_retainer_t));
+	pretainer->current.line   = NULL;
+	pretainer->current.length = 0;
+	pretainer->preparse_func  = preparse_func;
+	pretainer->pvstate        = pvstate;
+	return pretainer;
+}
+
+void lrec_retainer_free(lrec_retainer_t* pretainer) {
+	free(pretainer);
+}
+
+lrec_t* lrec_retainer_reparse(lrec_retainer_t* pretainer, lrec_extent_t* pextent) {
+	char* line = mlr_alloc_string_from_char_range(pextent->line, pextent->length);
+	return pretainer->preparse_func(pretainer->pvstate, line);
+}
+
+// ----------------------------------------------------------------
+lrec_extents_t* lrec_extents_alloc() {
+	lrec_extents_t* pextents = mlr_malloc_or_die(sizeof(lrec_extents_t));
+	pextents->length        = 0;
+	pextents->num_allocated = 1024;
+	pextents->pextents      = mlr_malloc_or_die(pextents->num_allocated * sizeof(lrec_extent_t));
+	return pextents;
+}
+
+void lrec_extents_free(lrec_extents_t* pextents) {
+	if (pextents == NULL)
+		return;
+	free(pextents->pextents);
+	free(pextents);
+}
+
+void lrec_extents_append(lrec_extents_t* pextents, lrec_extent_t extent) {
+	if (pextents->length >= pextents->num_allocated) {
+		pextents->num_allocated *= 2;
+		pextents->pextents = mlr_realloc_or_die(pextents->pextents,
+			pextents->num_allocated * sizeof(lrec_extent_t));
+	}
+	pextents->pextents[pextents->length++] = extent;
+}
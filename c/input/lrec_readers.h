@@ -2,6 +2,7 @@
 #define LREC_READERS_H
 #include "cli/mlrcli.h"
 #include "cli/comment_handling.h"
+#include "lib/mlrval.h"
 #include "input/lrec_reader.h"
 
 // ----------------------------------------------------------------
@@ -39,14 +40,123 @@ lrec_reader_t* lrec_reader_mmap_json_alloc(char* input_json_flatten_separator, j
 
 lrec_reader_t* lrec_reader_in_memory_alloc(sllv_t* precords);
 
+// ----------------------------------------------------------------
+// Projection pushdown, for the readers which support it. Skipped fields are
+// still parsed, so record boundaries are found as before; they just never get
+// into the record.
+
+// Like lrec_put, but if there is a projection and the key isn't in it, the
+// field is dropped, freeing key and value as the flags say.
+static inline void lrec_put_projected(lrec_t* prec, char* key, char* value, char free_flags, hss_t* pprojection) {
+	if (pprojection == NULL || hss_has(pprojection, key)) {
+		lrec_put(prec, key, value, free_flags);
+	} else {
+		if (free_flags & FREE_ENTRY_KEY)
+			free(key);
+		if (free_flags & FREE_ENTRY_VALUE)
+			free(value);
+	}
+}
+
+// For readers with header lines: one flag per header field, true for the fields
+// the projection keeps. The previous flags, if any, are reused or freed. Returns
+// null if there is no projection.
+char* lrec_reader_get_projection_flags(char* pold_flags, slls_t* pheader_keys, hss_t* pprojection);
+
+// ----------------------------------------------------------------
+// Predicate pushdown for mlr filter. A prefilter is a conjunction of terms of
+// the form $name == literal. A reader which can find a field's value in a line
+// without building a record checks the terms against the line and drops it if
+// some term is false, or if all are absent: either way the filter expression
+// can't be true. Lines which survive are parsed as usual and the filter
+// evaluates them in full, so the prefilter only needs to be conservative.
+//
+// A term's needle is a string which the line must contain for the term to be
+// true, so that most lines can be dropped with a substring search alone. Not
+// every literal has one: e.g. "500" equals the field value 0x1F4, which is
+// compared as the number 500.
+
+typedef struct _lrec_prefilter_term_t {
+	char* field_name;
+	int   field_name_length;
+	mv_t  literal;
+	int   literal_is_left;
+	char* needle; // Null if none
+	int   needle_length;
+} lrec_prefilter_term_t;
+
+typedef struct _lrec_prefilter_t {
+	lrec_prefilter_term_t* pterms;
+	int    num_terms;
+	int    num_terms_allocated;
+	mv_t (*ptype_infer_func)(char* string);
+	char*  value_buffer;
+	int    value_buffer_length;
+} lrec_prefilter_t;
+
+#define PREFILTER_TERM_FALSE  0
+#define PREFILTER_TERM_TRUE   1
+#define PREFILTER_TERM_ABSENT 2
+
+lrec_prefilter_t* lrec_prefilter_alloc(mv_t (*ptype_infer_func)(char* string));
+void lrec_prefilter_free(lrec_prefilter_t* pprefilter);
+// The field name, and the literal if it's a string, aren't copied.
+void lrec_prefilter_add_term(lrec_prefilter_t* pprefilter, char* field_name, mv_t literal, int literal_is_left);
+// The value needn't be null-terminated, and is null if the field is absent.
+// Returns PREFILTER_TERM_TRUE if the comparison isn't boolean, since then the
+// term can't be used to drop the line.
+int lrec_prefilter_evaluate_term(lrec_prefilter_t* pprefilter, lrec_prefilter_term_t* pterm,
+	char* value, int value_length);
+
+// ----------------------------------------------------------------
+// Offset-based retention for verbs such as tac and shuffle which hold on to
+// their input records until end of stream. With a retainer, the mmap readers
+// parse a copy of each line rather than the line in place, and the retainer's
+// current extent says where that line is in the still-mapped file. The verb
+// keeps just the extent, two words per record, and gets a fresh record from it
+// when it's time to emit one.
+
+typedef struct _lrec_extent_t {
+	char*  line;
+	size_t length; // Not including the line terminator
+} lrec_extent_t;
+
+// The line is a null-terminated copy which the new record is to own.
+typedef lrec_t* lrec_retainer_reparse_func_t(void* pvstate, char* line);
+
+typedef struct _lrec_retainer_t {
+	lrec_extent_t current; // Of the record the reader most recently returned
+	lrec_retainer_reparse_func_t* preparse_func;
+	void* pvstate;
+} lrec_retainer_t;
+
+lrec_retainer_t* lrec_retainer_alloc(lrec_retainer_reparse_func_t* preparse_func, void* pvstate);
+void lrec_retainer_free(lrec_retainer_t* pretainer);
+// Returns a new record, which the caller owns.
+lrec_t* lrec_retainer_reparse(lrec_retainer_t* pretainer, lrec_extent_t* pextent);
+
+// A growable array of extents.
+typedef struct _lrec_extents_t {
+	lrec_extent_t*     pextents;
+	unsigned long long length;
+	unsigned long long num_allocated;
+} lrec_extents_t;
+
+lrec_extents_t* lrec_extents_alloc();
+void lrec_extents_free(lrec_extents_t* pextents);
+void lrec_extents_append(lrec_extents_t* pextents, lrec_extent_t extent);
+
 // ----------------------------------------------------------------
 // These entry points are made public for unit test
 
-lrec_t* lrec_parse_stdio_nidx_single_sep(char* line, char ifs, int allow_repeat_ifs);
-lrec_t* lrec_parse_stdio_nidx_multi_sep(char* line, char* ifs, int ifslen, int allow_repeat_ifs);
+lrec_t* lrec_parse_stdio_nidx_single_sep(char* line, char ifs, int allow_repeat_ifs, hss_t* pprojection);
+lrec_t* lrec_parse_stdio_nidx_multi_sep(char* line, char* ifs, int ifslen, int allow_repeat_ifs,
+	hss_t* pprojection);
 
-lrec_t* lrec_parse_stdio_dkvp_single_sep(char* line, char ifs, char ips, int allow_repeat_ifs);
-lrec_t* lrec_parse_stdio_dkvp_multi_sep(char* line, char* ifs, char* ips, int ifslen, int ipslen, int allow_repeat_ifs);
+lrec_t* lrec_parse_stdio_dkvp_single_sep(char* line, char ifs, char ips, int allow_repeat_ifs,
+	hss_t* pprojection);
+lrec_t* lrec_parse_stdio_dkvp_multi_sep(char* line, char* ifs, char* ips, int ifslen, int ipslen, int allow_repeat_ifs,
+	hss_t* pprojection);
 
 slls_t* split_csv_header_line(char* line, char ifs, int allow_repeat_ifs);
 
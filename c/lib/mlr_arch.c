@@ -4,6 +4,9 @@
 #include "mlr_globals.h"
 #include "mlr_arch.h"
 #include "mlrutil.h"
+#ifndef MLR_ON_MSYS2
+#include <sys/resource.h>
+#endif
 #include "netbsd_strptime.h"
 #include "nlnet_timegm.h"
 
@@ -59,3 +62,15 @@ time_t mlr_arch_timegm(struct tm* ptm) {
 	return ret;
 #endif
 }
+
+// ----------------------------------------------------------------
+long mlr_arch_get_max_open_files() {
+#ifdef MLR_ON_MSYS2
+	return -1L;
+#else
+	struct rlimit rl;
+	if (getrlimit(RLIMIT_NOFILE, &rl) != 0 || rl.rlim_cur == RLIM_INFINITY || rl.rlim_cur > 0x7fffffff)
+		return -1L;
+	return (long)rl.rlim_cur;
+#endif
+}
@@ -37,4 +37,7 @@ int mlr_arch_unsetenv(const char *name);
 char *mlr_arch_strptime(const char *s, const char *format, struct tm *ptm);
 time_t mlr_arch_timegm(struct tm* ptm);
 
+// The process's soft limit on open file descriptors, or -1 if unknown or unlimited.
+long mlr_arch_get_max_open_files();
+
 #endif // MLR_ARCH_H
@@ -22,132 +22,381 @@ double get_systime() {
 }
 
 // ----------------------------------------------------------------
-// The essential idea is that we use the library function gmtime to get a struct tm, then strftime
-// to produce a formatted string. The only complication is that we support "%1S" through "%9S" for
-// formatting the seconds with a desired number of decimal places.
+// Format strings are compiled once into a list of items. Literal text and the numeric
+// conversions used by the ISO-8601 layouts (%Y %m %d %H %M %S %j) are formatted here;
+// anything else is handed to strftime one conversion at a time. Miller also supports
+// "%1S" through "%9S" for formatting the seconds with a desired number of decimal
+// places.
+//
+// Each compiled format remembers the last integer second it formatted, since log data
+// tends to have many records per second: gmtime is then skipped, and for formats without
+// fractional seconds the previous output is reused as-is.
 
-char* mlr_alloc_time_string_from_seconds(double seconds_since_the_epoch, char* format_string) {
+typedef enum _time_format_item_type_t {
+	TF_LITERAL,
+	TF_YEAR,
+	TF_MONTH,
+	TF_MDAY,
+	TF_HOUR,
+	TF_MINUTE,
+	TF_SECOND,
+	TF_FRACTIONAL_SECONDS,
+	TF_YDAY,
+	TF_STRFTIME,
+} time_format_item_type_t;
+
+typedef struct _time_format_item_t {
+	time_format_item_type_t type;
+	char* text;               // For literals, and the single conversion for strftime items
+	int   length;             // Of the text
+	int   num_decimal_places; // For fractional seconds
+} time_format_item_t;
+
+struct _time_format_t {
+	char*               format_string;
+	time_format_item_t* items;
+	int                 num_items;
+	int                 max_output_length;
+	int                 has_fractional_seconds;
+	int                 is_parseable;
+
+	int                 have_cache;
+	time_t              cached_seconds;
+	struct tm           cached_tm;
+	char*               cached_output;
+	int                 cached_output_length;
+};
+
+static void append_item(time_format_t* pformat, time_format_item_type_t type, char* text, int length,
+	int num_decimal_places);
+static char* put_decimal(char* p, int value, int width);
+static int time_format_parse_fast(time_format_t* pformat, char* time_string, double* pseconds);
+static double seconds_from_time_string_with_strptime(char* time_string, char* format_string);
+static time_format_t* time_format_cache_get(char* format_string);
+
+// ----------------------------------------------------------------
+time_format_t* time_format_alloc(char* format_string) {
+	time_format_t* pformat = mlr_malloc_or_die(sizeof(time_format_t));
+	pformat->format_string          = mlr_strdup_or_die(format_string);
+	pformat->items                  = mlr_malloc_or_die((strlen(format_string) + 1) * sizeof(time_format_item_t));
+	pformat->num_items              = 0;
+	pformat->max_output_length      = 0;
+	pformat->has_fractional_seconds = FALSE;
+	pformat->have_cache             = FALSE;
+	pformat->cached_seconds         = 0;
+	pformat->cached_output          = NULL;
+	pformat->cached_output_length   = 0;
+
+	int num_S = 0;
+	char* p = format_string;
+	while (*p) {
+		if (*p != '%') {
+			char* q = p;
+			while (*q && *q != '%')
+				q++;
+			append_item(pformat, TF_LITERAL, p, q - p, 0);
+			p = q;
+			continue;
+		}
+
+		switch (p[1]) {
+		case '%': append_item(pformat, TF_LITERAL, &p[1], 1, 0); p += 2; continue;
+		case 'Y': append_item(pformat, TF_YEAR,    p, 2, 0); p += 2; continue;
+		case 'm': append_item(pformat, TF_MONTH,   p, 2, 0); p += 2; continue;
+		case 'd': append_item(pformat, TF_MDAY,    p, 2, 0); p += 2; continue;
+		case 'H': append_item(pformat, TF_HOUR,    p, 2, 0); p += 2; continue;
+		case 'M': append_item(pformat, TF_MINUTE,  p, 2, 0); p += 2; continue;
+		case 'S': append_item(pformat, TF_SECOND,  p, 2, 0); p += 2; num_S++; continue;
+		case 'j': append_item(pformat, TF_YDAY,    p, 2, 0); p += 2; continue;
+		}
+
+		// Only the first "%nS" gets fractional seconds; any others are left to strftime as before.
+		if (p[1] >= '1' && p[1] <= '9' && p[2] == 'S' && !pformat->has_fractional_seconds) {
+			append_item(pformat, TF_FRACTIONAL_SECONDS, p, 3, p[1] - '0');
+			pformat->has_fractional_seconds = TRUE;
+			num_S++;
+			p += 3;
+			continue;
+		}
+
+		// Anything else, including flags, widths, and E/O modifiers, goes to strftime.
+		char* q = &p[1];
+		while (*q && strchr("_-0^#", *q))
+			q++;
+		while (isdigit((unsigned char)*q))
+			q++;
+		if (*q == 'E' || *q == 'O')
+			q++;
+		if (*q)
+			q++;
+		append_item(pformat, TF_STRFTIME, p, q - p, 0);
+		p = q;
+	}
+
+	// Input strings can be parsed without strptime when the format has only the fixed-width
+	// numeric conversions and literals other than whitespace, for which strptime's matching is
+	// looser.
+	pformat->is_parseable = num_S <= 1 && !pformat->has_fractional_seconds;
+	for (int i = 0; i < pformat->num_items; i++) {
+		time_format_item_t* pitem = &pformat->items[i];
+		if (pitem->type == TF_YDAY || pitem->type == TF_STRFTIME)
+			pformat->is_parseable = FALSE;
+		if (pitem->type == TF_LITERAL) {
+			for (int j = 0; j < pitem->length; j++) {
+				if (isspace((unsigned char)pitem->text[j]))
+					pformat->is_parseable = FALSE;
+			}
+		}
+	}
+
+	return pformat;
+}
 
+void time_format_free(time_format_t* pformat) {
+	if (pformat == NULL)
+		return;
+	for (int i = 0; i < pformat->num_items; i++)
+		free(pformat->items[i].text);
+	free(pformat->items);
+	free(pformat->cached_output);
+	free(pformat->format_string);
+	free(pformat);
+}
+
+static void append_item(time_format_t* pformat, time_format_item_type_t type, char* text, int length,
+	int num_decimal_places)
+{
+	time_format_item_t* pitem = &pformat->items[pformat->num_items++];
+	pitem->type = type;
+	pitem->text = mlr_alloc_string_from_char_range(text, length);
+	pitem->length = length;
+	pitem->num_decimal_places = num_decimal_places;
+
+	switch (type) {
+	case TF_LITERAL:            pformat->max_output_length += length;                 break;
+	case TF_FRACTIONAL_SECONDS: pformat->max_output_length += 2 + 1 + num_decimal_places; break;
+	case TF_STRFTIME:           pformat->max_output_length += NZBUFLEN;               break;
+	default:                    pformat->max_output_length += 16;                     break;
+	}
+}
+
+// ----------------------------------------------------------------
+// Zero-padded to the given width. Precondition: value is non-negative.
+static char* put_decimal(char* p, int value, int width) {
+	for (int i = width - 1; i >= 0; i--) {
+		p[i] = '0' + value % 10;
+		value /= 10;
+	}
+	return p + width;
+}
+
+char* time_format_alloc_string_from_seconds(time_format_t* pformat, double seconds_since_the_epoch) {
 	// 1. Split out the integer seconds since the epoch, which the stdlib can handle, and
 	//    the fractional part, which it cannot.
 	time_t iseconds = (time_t) seconds_since_the_epoch;
 	double fracsec = seconds_since_the_epoch - iseconds;
 
-	struct tm tm = *gmtime(&iseconds); // No gmtime_r on Windows so just use gmtime.
-
-	// 2. See if "%nS" (for n in 1..9) is a substring of the format string.
-	char* middle_nS_format = NULL;
-	char* right_subformat = NULL;
-	int n = 0; // Save off n for round-up handling below.
-	for (char* p = format_string; *p; p++) {
-		// We can't use strstr since we're searching for a pattern, and regexes are overkill.
-		// Here we rely on left-to-right evaluation of the boolean expressions, with non-evaluation
-		// of a subexpression if a subexpression to its left is false (this keeps us from reading
-		// past end of input string).
-		if (p[0] == '%' && p[1] >= '1' && p[1] <= '9' && p[2] == 'S') {
-			middle_nS_format = p;
-			right_subformat = &p[3];
-			n = p[1] - '0';
-			break;
+	// 2. Reuse the previous result if it was for the same second.
+	if (pformat->have_cache && pformat->cached_seconds == iseconds) {
+		if (pformat->cached_output != NULL) {
+			char* output_string = mlr_malloc_or_die(pformat->cached_output_length + 1);
+			memcpy(output_string, pformat->cached_output, pformat->cached_output_length + 1);
+			return output_string;
 		}
+	} else {
+		pformat->cached_tm = *gmtime(&iseconds); // No gmtime_r on Windows so just use gmtime.
+		pformat->cached_seconds = iseconds;
+		pformat->have_cache = TRUE;
+		free(pformat->cached_output);
+		pformat->cached_output = NULL;
 	}
+	struct tm* ptm = &pformat->cached_tm;
 
-	// 3. If "%nS" (for n in 1..9) is not a substring of the format string, just use strftime.
-	if (middle_nS_format == NULL) {
-		char* output_string = mlr_malloc_or_die(NZBUFLEN+1);
-		int written_length = strftime(output_string, NZBUFLEN, format_string, &tm);
-		if (written_length > NZBUFLEN || written_length == 0) {
-			fprintf(stderr, "%s: could not strftime(%lf, \"%s\"). See \"%s --help-function strftime\".\n",
-				MLR_GLOBALS.bargv0, seconds_since_the_epoch, format_string, MLR_GLOBALS.bargv0);
-			exit(1);
-		}
+	// 3. Format each item.
+	char* output_string = mlr_malloc_or_die(pformat->max_output_length + 1);
+	char* p = output_string;
+	for (int i = 0; i < pformat->num_items; i++) {
+		time_format_item_t* pitem = &pformat->items[i];
+		switch (pitem->type) {
 
-		return output_string;
-	}
+		case TF_LITERAL:
+			memcpy(p, pitem->text, pitem->length);
+			p += pitem->length;
+			break;
 
-	// Now we know "%nS" (for n in 1..9) is a substring of the format string.  Idea is to
-	// copy the subformats to the left and right of the %nS part and format them both using
-	// strftime, and format the middle part ourselves using sprintf.  Then concatenate all
-	// those pieces.
-
-	// 5. Find the left-of-%nS subformat, and format the input using that.
-	int left_subformat_length = middle_nS_format - format_string;
-	char* left_subformat = mlr_malloc_or_die(left_subformat_length + 1);
-	memcpy(left_subformat, format_string, left_subformat_length);
-	left_subformat[left_subformat_length] = 0;
-
-	char left_formatted[NZBUFLEN+1];
-	if (*left_subformat == 0) {
-		// There's nothing to the left of %nS. strftime will error on empty format string, so we can
-		// just map empty format to empty result ourselves.
-		*left_formatted = 0;
-	} else {
-		int written_length = strftime(left_formatted, NZBUFLEN, left_subformat, &tm);
-		if (written_length > NZBUFLEN || written_length == 0) {
-			fprintf(stderr, "%s: could not strftime(%lf, \"%s\"). See \"%s --help-function strftime\".\n",
-				MLR_GLOBALS.bargv0, seconds_since_the_epoch, format_string, MLR_GLOBALS.bargv0);
-			exit(1);
+		case TF_YEAR:
+			// strftime doesn't zero-pad years; this matches it for four-digit years.
+			if (ptm->tm_year + 1900 >= 1000 && ptm->tm_year + 1900 <= 9999)
+				p = put_decimal(p, ptm->tm_year + 1900, 4);
+			else
+				p += strftime(p, NZBUFLEN, pitem->text, ptm);
+			break;
+
+		case TF_MONTH:  p = put_decimal(p, ptm->tm_mon + 1,  2); break;
+		case TF_MDAY:   p = put_decimal(p, ptm->tm_mday,     2); break;
+		case TF_HOUR:   p = put_decimal(p, ptm->tm_hour,     2); break;
+		case TF_MINUTE: p = put_decimal(p, ptm->tm_min,      2); break;
+		case TF_SECOND: p = put_decimal(p, ptm->tm_sec,      2); break;
+		case TF_YDAY:   p = put_decimal(p, ptm->tm_yday + 1, 3); break;
+
+		case TF_FRACTIONAL_SECONDS: {
+			// The integer part is as for %S. For the fractional part, sprintf always writes a
+			// leading zero, e.g. .123456 becomes "0.123456", which is then taken off.
+			p = put_decimal(p, ptm->tm_sec, 2);
+			int n = pitem->num_decimal_places;
+			char fractional_formatted[16];
+			sprintf(fractional_formatted, "%.*lf", n, fracsec);
+			// When the input has fractional seconds like 0.999999 and the format is shorter than that,
+			// e.g. "%3S", there can be round-up to 1.0 on the sprintf.
+			if (fractional_formatted[0] == '1') {
+				*(p++) = '.';
+				for (int j = 0; j < n; j++)
+					*(p++) = '9';
+			} else if (fractional_formatted[0] == '0') {
+				memcpy(p, &fractional_formatted[1], n + 1);
+				p += n + 1;
+			} else {
+				MLR_INTERNAL_CODING_ERROR();
+			}
+			break;
+		}
+
+		case TF_STRFTIME:
+			p += strftime(p, NZBUFLEN, pitem->text, ptm);
+			break;
 		}
 	}
-	free(left_subformat);
-
-	// 6. There are two parts in the middle: the integer part which strftime can populate
-	//    from the struct tm, using %S format, and the fractional-seconds part which we sprintf.
-	//    First do the int part.
-	char middle_int_formatted[NZBUFLEN+1];
-	char* middle_int_format = "%S";
-	int written_length = strftime(middle_int_formatted, NZBUFLEN, middle_int_format, &tm);
-	if (written_length > NZBUFLEN || written_length == 0) {
+	*p = 0;
+
+	if (p == output_string) {
 		fprintf(stderr, "%s: could not strftime(%lf, \"%s\"). See \"%s --help-function strftime\".\n",
-			MLR_GLOBALS.bargv0, seconds_since_the_epoch, format_string, MLR_GLOBALS.bargv0);
+			MLR_GLOBALS.bargv0, seconds_since_the_epoch, pformat->format_string, MLR_GLOBALS.bargv0);
 		exit(1);
 	}
 
-	// 7. Do the fractional-seconds part. One key point is that sprintf always writes a leading zero,
-	//    e.g. .123456 becomes "0.123456". We'll take off the leading zero later.
-	char middle_sprintf_format[] = "%.xlf";
-	char middle_fractional_formatted[16];
-	// "%6S" maps to "%.6lf" and so on. We found the middle_nS_format by searching for "%nS" for
-	// n in 1..9 so sprintf-format subscript 2 is the same as strftime format subscript 1.
-	middle_sprintf_format[2] = middle_nS_format[1];
-	sprintf(middle_fractional_formatted, middle_sprintf_format, fracsec);
-
-	// 8. Format the right-of-%nS part, also using strftime.
-	char right_formatted[NZBUFLEN];
-	if (*right_subformat == 0) {
-		// There's nothing to the right of %nS. strftime will error on empty format string, so we can
-		// just map empty format to empty result ourselves.
-		*right_formatted = 0;
-	} else {
-		int written_length = strftime(right_formatted, NZBUFLEN, right_subformat, &tm);
-		if (written_length > NZBUFLEN || written_length == 0) {
-			fprintf(stderr, "%s: could not strftime(%lf, \"%s\"). See \"%s --help-function strftime\".\n",
-				MLR_GLOBALS.bargv0, seconds_since_the_epoch, format_string, MLR_GLOBALS.bargv0);
-			exit(1);
-		}
+	if (!pformat->has_fractional_seconds) {
+		pformat->cached_output_length = p - output_string;
+		pformat->cached_output = mlr_malloc_or_die(pformat->cached_output_length + 1);
+		memcpy(pformat->cached_output, output_string, pformat->cached_output_length + 1);
 	}
 
-	// 9. Concatenate the output. For string_builder, the size argument is just an initial size;
-	//    it can realloc beyond that initial estimate if necessary.
-	string_builder_t* psb = sb_alloc(NZBUFLEN+1);
-	sb_append_string(psb, left_formatted);
-	sb_append_string(psb, middle_int_formatted);
-	// When the input has fractional seconds like 0.999999 and the format is shorter than that,
-	// e.g. "%3S", there can be round-up to 1.0 on the sprintf.
-	if (middle_fractional_formatted[0] == '1') {
-		sb_append_char(psb, '.');
-		for (int i = 0; i < n; i++)
-			sb_append_char(psb, '9');
-	} else if (middle_fractional_formatted[0] == '0') {
-		sb_append_string(psb, &middle_fractional_formatted[1]);
-	} else {
-		MLR_INTERNAL_CODING_ERROR();
+	return output_string;
+}
+
+char* mlr_alloc_time_string_from_seconds(double seconds_since_the_epoch, char* format_string) {
+	return time_format_alloc_string_from_seconds(time_format_cache_get(format_string), seconds_since_the_epoch);
+}
+
+// ----------------------------------------------------------------
+// For the string-format entry points: formats are usually string literals in the DSL, or
+// come from a field with only a few distinct values, so a small cache suffices.
+
+#define TIME_FORMAT_CACHE_SIZE 8
+
+static time_format_t* time_format_cache[TIME_FORMAT_CACHE_SIZE];
+static int time_format_cache_next = 0;
+
+static time_format_t* time_format_cache_get(char* format_string) {
+	for (int i = 0; i < TIME_FORMAT_CACHE_SIZE; i++) {
+		time_format_t* pformat = time_format_cache[i];
+		if (pformat != NULL && streq(pformat->format_string, format_string))
+			return pformat;
 	}
-	sb_append_string(psb, right_formatted);
-	char* output_string = sb_finish(psb);
-	sb_free(psb);
+	// Round-robin replacement.
+	time_format_free(time_format_cache[time_format_cache_next]);
+	time_format_t* pformat = time_format_alloc(format_string);
+	time_format_cache[time_format_cache_next] = pformat;
+	time_format_cache_next = (time_format_cache_next + 1) % TIME_FORMAT_CACHE_SIZE;
+	return pformat;
+}
 
-	return output_string;
+// ----------------------------------------------------------------
+// Days since 1970-01-01 in the proleptic Gregorian calendar, as timegm computes.
+// See http://howardhinnant.github.io/date_algorithms.html.
+static long long days_from_civil(long long y, int m, int d) {
+	y -= m <= 2;
+	long long era = (y >= 0 ? y : y - 399) / 400;
+	long long yoe = y - era * 400;
+	long long doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+	long long doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+	return era * 146097 + doe - 719468;
+}
+
+// Returns FALSE if the input isn't in exactly the layout of the format, with all digits present
+// and fields in range; then the caller uses strptime, which may be more lenient or may error out.
+// When this returns TRUE the result is the same as strptime/timegm would give.
+static int time_format_parse_fast(time_format_t* pformat, char* time_string, double* pseconds) {
+	int year = 1900, month = 1, mday = 0, hour = 0, minute = 0, second = 0;
+	double fractional_seconds = 0.0;
+	char* p = time_string;
+
+	for (int i = 0; i < pformat->num_items; i++) {
+		time_format_item_t* pitem = &pformat->items[i];
+		int width = 0, lo = 0, hi = 0, value = 0;
+		int* pvalue = NULL;
+		switch (pitem->type) {
+		case TF_LITERAL:
+			if (strncmp(p, pitem->text, pitem->length) != 0)
+				return FALSE;
+			p += pitem->length;
+			continue;
+		case TF_YEAR:   pvalue = &year;   width = 4; lo = 0; hi = 9999; break;
+		case TF_MONTH:  pvalue = &month;  width = 2; lo = 1; hi = 12;   break;
+		case TF_MDAY:   pvalue = &mday;   width = 2; lo = 1; hi = 31;   break;
+		case TF_HOUR:   pvalue = &hour;   width = 2; lo = 0; hi = 23;   break;
+		case TF_MINUTE: pvalue = &minute; width = 2; lo = 0; hi = 59;   break;
+		case TF_SECOND: pvalue = &second; width = 2; lo = 0; hi = 61;   break;
+		default: return FALSE;
+		}
+		for (int j = 0; j < width; j++) {
+			if (!isdigit((unsigned char)p[j]))
+				return FALSE;
+			value = 10 * value + (p[j] - '0');
+		}
+		if (value < lo || value > hi)
+			return FALSE;
+		*pvalue = value;
+		p += width;
+
+		// Fractional seconds are accepted where the strptime path would find them: after
+		// the %S, when there's a non-numeric literal following it in the format.
+		if (pitem->type == TF_SECOND && *p == '.') {
+			if (i + 1 >= pformat->num_items || pformat->items[i+1].type != TF_LITERAL)
+				return FALSE;
+			char next = pformat->items[i+1].text[0];
+			if (next == '.' || isdigit((unsigned char)next))
+				return FALSE;
+			char* q = p + 1;
+			while (isdigit((unsigned char)*q))
+				q++;
+			if (q > p + 1) {
+				char* end = NULL;
+				fractional_seconds = strtod(p, &end);
+				if (end != q)
+					return FALSE;
+			}
+			p = q;
+		}
+	}
+	if (*p != 0)
+		return FALSE;
+
+	// With no %d, strptime leaves tm_mday as zero, which timegm treats as the last day of
+	// the previous month.
+	long long days = days_from_civil(year, month, 1) + mday - 1;
+	*pseconds = (double)(days * 86400LL + hour * 3600LL + minute * 60LL + second) + fractional_seconds;
+	return TRUE;
+}
+
+double time_format_seconds_from_string(time_format_t* pformat, char* time_string) {
+	double seconds = 0.0;
+	if (pformat->is_parseable && time_format_parse_fast(pformat, time_string, &seconds))
+		return seconds;
+	return seconds_from_time_string_with_strptime(time_string, pformat->format_string);
+}
+
+double mlr_seconds_from_time_string(char* time_string, char* format_string) {
+	return time_format_seconds_from_string(time_format_cache_get(format_string), time_string);
 }
 
 // ----------------------------------------------------------------
@@ -155,7 +404,7 @@ char* mlr_alloc_time_string_from_seconds(double seconds_since_the_epoch, char* f
 // to play some tricks, inspired in part by some ideas on StackOverflow. Special shout-out
 // to @tinkerware on Github for the push in the right direction! :)
 
-double mlr_seconds_from_time_string(char* time_string, char* format_string) {
+static double seconds_from_time_string_with_strptime(char* time_string, char* format_string) {
 
 	struct tm tm;
 
@@ -14,4 +14,12 @@ double get_systime();
 char* mlr_alloc_time_string_from_seconds(double seconds_since_the_epoch, char* format);
 double mlr_seconds_from_time_string(char* string, char* format);
 
+// The above, with the format string compiled ahead of time. The compiled format keeps a
+// cache of the most recently formatted second, so it shouldn't be shared across threads.
+typedef struct _time_format_t time_format_t;
+time_format_t* time_format_alloc(char* format_string);
+void time_format_free(time_format_t* pformat);
+char* time_format_alloc_string_from_seconds(time_format_t* pformat, double seconds_since_the_epoch);
+double time_format_seconds_from_string(time_format_t* pformat, char* time_string);
+
 #endif // MLRDATETIME_H
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <string.h>
+#include <strings.h>
 #include <unistd.h>
 #include <ctype.h>
 #include <sys/time.h>
@@ -8,6 +9,10 @@
 #include "lib/mlr_globals.h"
 #include "lib/free_flags.h"
 
+static char* regex_string_unquote(char* orig_regex_string, int* pcflags);
+static void mlr_regex_find_literal(mlr_regex_t* pregex, char* regex_string, int cflags);
+static int  mlr_literal_match(const mlr_regex_t* pregex, const char* match_string, regoff_t* pstart);
+
 // ----------------------------------------------------------------
 // Succeeds or aborts the process. cflag REG_EXTENDED is already included.
 //
@@ -61,26 +66,31 @@ regex_t* regcomp_or_die(regex_t* pregex, char* regex_string, int cflags) {
 // If the regex_string is of the form "a.*b", compiles a.*b using cflags without REG_ICASE.
 // If the regex_string is of the form "a.*b"i, compiles a.*b using cflags with REG_ICASE.
 regex_t* regcomp_or_die_quoted(regex_t* pregex, char* orig_regex_string, int cflags) {
-	cflags |= REG_EXTENDED;
-	if (string_starts_with(orig_regex_string, "\"")) {
-		char* regex_string = mlr_strdup_or_die(orig_regex_string);
+	char* regex_string = regex_string_unquote(orig_regex_string, &cflags);
+	regcomp_or_die(pregex, regex_string, cflags);
+	free(regex_string);
+	return pregex;
+}
+
+// Returns a newly allocated copy of the regex string, with the "..." or "..."i
+// removed if present. REG_ICASE is added to the cflags for the latter.
+static char* regex_string_unquote(char* orig_regex_string, int* pcflags) {
+	char* regex_string = mlr_strdup_or_die(orig_regex_string);
+	if (string_starts_with(regex_string, "\"")) {
 		int len = 0;
 		if (string_ends_with(regex_string, "\"", &len)) {
 			regex_string[len-1] = 0;
 		} else if (string_ends_with(regex_string, "\"i", &len)) {
 			regex_string[len-2] = 0;
-			cflags |= REG_ICASE;
+			*pcflags |= REG_ICASE;
 		} else {
 			fprintf(stderr, "%s: imbalanced double-quote in regex [%s].\n",
 				MLR_GLOBALS.bargv0, regex_string);
 			exit(1);
 		}
-		regcomp_or_die(pregex, regex_string+1, cflags);
-		free(regex_string);
-	} else {
-		regcomp_or_die(pregex, orig_regex_string, cflags);
+		memmove(regex_string, regex_string+1, strlen(regex_string+1) + 1);
 	}
-	return pregex;
+	return regex_string;
 }
 
 // Returns TRUE for match, FALSE for no match, and aborts the process if
@@ -102,11 +112,206 @@ int regmatch_or_die(const regex_t* pregex, const char* restrict match_string,
 	}
 }
 
+// ----------------------------------------------------------------
+mlr_regex_t* mlr_regcomp_or_die(mlr_regex_t* pregex, char* regex_string, int cflags) {
+	regcomp_or_die(&pregex->regex, regex_string, cflags);
+	mlr_regex_find_literal(pregex, regex_string, cflags);
+	return pregex;
+}
+
+mlr_regex_t* mlr_regcomp_or_die_quoted(mlr_regex_t* pregex, char* orig_regex_string, int cflags) {
+	char* regex_string = regex_string_unquote(orig_regex_string, &cflags);
+	mlr_regcomp_or_die(pregex, regex_string, cflags);
+	free(regex_string);
+	return pregex;
+}
+
+void mlr_regfree(mlr_regex_t* pregex) {
+	regfree(&pregex->regex);
+	free(pregex->literal);
+	pregex->literal = NULL;
+}
+
+// ----------------------------------------------------------------
+// Decides whether the pattern is a plain string. This must agree with what regcomp_or_die
+// hands to the regex library after double-backslashing: "\." is a literal dot, and any other
+// backslash is a literal backslash with the character after it keeping its usual meaning.
+// Anything else which is special in an extended regex disqualifies the fast path, except for
+// a leading ^ and a trailing $. With REG_ICASE the fast path is only taken for ASCII
+// patterns, since the comparison is strncasecmp.
+
+static void mlr_regex_find_literal(mlr_regex_t* pregex, char* regex_string, int cflags) {
+	pregex->literal        = NULL;
+	pregex->literal_length = 0;
+	pregex->anchored_start = FALSE;
+	pregex->anchored_end   = FALSE;
+	pregex->icase          = (cflags & REG_ICASE) ? TRUE : FALSE;
+
+	if (cflags & REG_NEWLINE)
+		return;
+
+	char* p = regex_string;
+	int anchored_start = FALSE;
+	int anchored_end = FALSE;
+	if (*p == '^') {
+		anchored_start = TRUE;
+		p++;
+	}
+
+	char* literal = mlr_malloc_or_die(strlen(p) + 1);
+	char* q = literal;
+	while (*p) {
+		char c = *p;
+		if (c == '\\') {
+			if (p[1] == '.') {
+				*(q++) = '.';
+				p += 2;
+			} else {
+				*(q++) = '\\';
+				p++;
+			}
+		} else if (c == '$' && p[1] == 0) {
+			anchored_end = TRUE;
+			p++;
+		} else if (strchr(".[]()*+?{}|^$", c) != NULL || (pregex->icase && (unsigned char)c >= 0x80)) {
+			free(literal);
+			return;
+		} else {
+			*(q++) = c;
+			p++;
+		}
+	}
+	*q = 0;
+
+	if (q == literal) { // The empty pattern matches everywhere; leave it to the regex library.
+		free(literal);
+		return;
+	}
+	pregex->literal        = literal;
+	pregex->literal_length = q - literal;
+	pregex->anchored_start = anchored_start;
+	pregex->anchored_end   = anchored_end;
+}
+
+// Since the literal has fixed length, the leftmost match is also the leftmost-longest one.
+static int mlr_literal_match(const mlr_regex_t* pregex, const char* match_string, regoff_t* pstart) {
+	const char* literal = pregex->literal;
+	int literal_length = pregex->literal_length;
+
+	if (pregex->anchored_start && !pregex->anchored_end) {
+		*pstart = 0;
+		return pregex->icase
+			? strncasecmp(match_string, literal, literal_length) == 0
+			: strncmp(match_string, literal, literal_length) == 0;
+	}
+
+	if (!pregex->icase && !pregex->anchored_end) {
+		const char* hit = strstr(match_string, literal);
+		if (hit == NULL)
+			return FALSE;
+		*pstart = hit - match_string;
+		return TRUE;
+	}
+
+	int length = strlen(match_string);
+	if (length < literal_length)
+		return FALSE;
+	if (pregex->anchored_end) {
+		if (pregex->anchored_start && length != literal_length)
+			return FALSE;
+		*pstart = length - literal_length;
+		return pregex->icase
+			? strncasecmp(&match_string[*pstart], literal, literal_length) == 0
+			: memcmp(&match_string[*pstart], literal, literal_length) == 0;
+	}
+
+	for (int i = 0; i <= length - literal_length; i++) {
+		if (strncasecmp(&match_string[i], literal, literal_length) == 0) {
+			*pstart = i;
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+int mlr_regmatch_or_die(const mlr_regex_t* pregex, const char* restrict match_string,
+	size_t nmatchmax, regmatch_t pmatch[restrict])
+{
+	if (pregex->literal == NULL)
+		return regmatch_or_die(&pregex->regex, match_string, nmatchmax, pmatch);
+
+	regoff_t start = 0;
+	if (!mlr_literal_match(pregex, match_string, &start))
+		return FALSE;
+	if (nmatchmax > 0 && pmatch != NULL) {
+		pmatch[0].rm_so = start;
+		pmatch[0].rm_eo = start + pregex->literal_length;
+		for (size_t i = 1; i < nmatchmax; i++) {
+			pmatch[i].rm_so = -1;
+			pmatch[i].rm_eo = -1;
+		}
+	}
+	return TRUE;
+}
+
+// ----------------------------------------------------------------
+// Regexes computed per record are usually one of only a few distinct values, e.g. from a field
+// with low cardinality, so recompiling on every call is wasted work. The cache is small and
+// searched linearly by hash; the least recently used entry is evicted when it's full.
+
+#define MLR_REGEX_CACHE_SIZE 64
+
+typedef struct _mlr_regex_cache_entry_t {
+	char*              regex_string;
+	int                hash;
+	int                cflags;
+	unsigned long long last_used;
+	mlr_regex_t        regex;
+} mlr_regex_cache_entry_t;
+
+static mlr_regex_cache_entry_t mlr_regex_cache[MLR_REGEX_CACHE_SIZE];
+static int mlr_regex_cache_count = 0;
+static unsigned long long mlr_regex_cache_clock = 0;
+
+mlr_regex_t* mlr_regex_cache_get(char* regex_string, int cflags) {
+	int hash = mlr_string_hash_func(regex_string);
+	mlr_regex_cache_clock++;
+
+	for (int i = 0; i < mlr_regex_cache_count; i++) {
+		mlr_regex_cache_entry_t* pentry = &mlr_regex_cache[i];
+		if (pentry->hash == hash && pentry->cflags == cflags && streq(pentry->regex_string, regex_string)) {
+			pentry->last_used = mlr_regex_cache_clock;
+			return &pentry->regex;
+		}
+	}
+
+	mlr_regex_cache_entry_t* pentry = NULL;
+	if (mlr_regex_cache_count < MLR_REGEX_CACHE_SIZE) {
+		pentry = &mlr_regex_cache[mlr_regex_cache_count++];
+	} else {
+		pentry = &mlr_regex_cache[0];
+		for (int i = 1; i < MLR_REGEX_CACHE_SIZE; i++) {
+			if (mlr_regex_cache[i].last_used < pentry->last_used)
+				pentry = &mlr_regex_cache[i];
+		}
+		free(pentry->regex_string);
+		mlr_regfree(&pentry->regex);
+	}
+
+	mlr_regcomp_or_die(&pentry->regex, regex_string, cflags);
+	pentry->regex_string = mlr_strdup_or_die(regex_string);
+	pentry->hash         = hash;
+	pentry->cflags       = cflags;
+	pentry->last_used    = mlr_regex_cache_clock;
+	return &pentry->regex;
+}
+
+// ----------------------------------------------------------------
 // Capture-group example:
 // sed: $ echo '<<abcdefg>>'|sed 's/ab\(.\)d\(..\)g/AYEBEE\1DEE\2GEE/' gives <<AYEBEEcDEEefGEE>>
 // mlr: echo 'x=<<abcdefg>>' | mlr put '$x = sub($x, "ab(.)d(..)g", "AYEBEE\1DEE\2GEE")' x=<<AYEBEEcDEEefGEE>>
 
-char* regex_sub(char* input, regex_t* pregex, string_builder_t* psb, char* replacement,
+char* regex_sub(char* input, mlr_regex_t* pregex, string_builder_t* psb, char* replacement,
 	int* pmatched, int *pall_captured)
 {
 	const size_t nmatchmax = 10; // Capture-groups \1 through \9 supported, along with entire-string match \0
@@ -114,7 +319,7 @@ char* regex_sub(char* input, regex_t* pregex, string_builder_t* psb, char* repla
 	if (pall_captured)
 		*pall_captured = TRUE;
 
-	*pmatched = regmatch_or_die(pregex, input, nmatchmax, matches);
+	*pmatched = mlr_regmatch_or_die(pregex, input, nmatchmax, matches);
 	if (!*pmatched) {
 		return mlr_strdup_or_die(input);
 	} else {
@@ -143,7 +348,7 @@ char* regex_sub(char* input, regex_t* pregex, string_builder_t* psb, char* repla
 	}
 }
 
-char* regex_gsub(char* input, regex_t* pregex, string_builder_t* psb, char* replacement,
+char* regex_gsub(char* input, mlr_regex_t* pregex, string_builder_t* psb, char* replacement,
 	int *pmatched, int* pall_captured, char* pfree_flags)
 {
 	const size_t nmatchmax = 10;
@@ -156,7 +361,7 @@ char* regex_gsub(char* input, regex_t* pregex, string_builder_t* psb, char* repl
 	char* current_input = input;
 
 	while (TRUE) {
-		int matched = regmatch_or_die(pregex, &current_input[match_start], nmatchmax, matches);
+		int matched = mlr_regmatch_or_die(pregex, &current_input[match_start], nmatchmax, matches);
 		if (!matched) {
 			if (input == current_input) {
 				*pfree_flags = FREE_ENTRY_VALUE;
@@ -284,3 +489,12 @@ char* interpolate_regex_captures(char* input, string_array_t* pregex_captures, i
 		return input;
 	}
 }
+
+// ----------------------------------------------------------------
+int string_has_regex_captures(char* input) {
+	for (char* p = input; *p; p++) {
+		if (p[0] == '\\' && isdigit(p[1]))
+			return TRUE;
+	}
+	return FALSE;
+}
@@ -24,13 +24,43 @@ regex_t* regcomp_or_die_quoted(regex_t* pregex, char* regex_string, int cflags);
 int regmatch_or_die(const regex_t* pregex, const char* restrict match_string,
 	size_t nmatchmax, regmatch_t pmatch[restrict]);
 
+// ----------------------------------------------------------------
+// A compiled regex along with what's needed for the string-search fast path. Patterns with no
+// regex metacharacters (after the escaping rules of regcomp_or_die), optionally anchored with
+// leading ^ and/or trailing $, are matched with substring/prefix/suffix/equality comparisons
+// rather than regexec. Such patterns have no capture groups, so only match slot 0 is filled in.
+// The regex_t is compiled in either case.
+typedef struct _mlr_regex_t {
+	regex_t regex;
+	char*   literal; // NULL if the pattern needs the regex library
+	int     literal_length;
+	int     anchored_start;
+	int     anchored_end;
+	int     icase;
+} mlr_regex_t;
+
+// Same flag handling as regcomp_or_die and regcomp_or_die_quoted.
+mlr_regex_t* mlr_regcomp_or_die(mlr_regex_t* pregex, char* regex_string, int cflags);
+mlr_regex_t* mlr_regcomp_or_die_quoted(mlr_regex_t* pregex, char* regex_string, int cflags);
+void mlr_regfree(mlr_regex_t* pregex);
+
+// Same return values as regmatch_or_die.
+int mlr_regmatch_or_die(const mlr_regex_t* pregex, const char* restrict match_string,
+	size_t nmatchmax, regmatch_t pmatch[restrict]);
+
+// For regexes which aren't known until runtime, e.g. sub($x, $y, "z"): returns a compiled regex
+// from a small least-recently-used cache, compiling it on a miss. The cache owns the returned
+// pointer, which is valid until the next call.
+mlr_regex_t* mlr_regex_cache_get(char* regex_string, int cflags);
+
+// ----------------------------------------------------------------
 // The return value is dynamically allocated even if there is no match, i.e. when output
 // equals input.  The by-reference all-captured flag is true on return if all \1, etc.
 // were satisfiable by parenthesized capture groups.
-char* regex_sub(char* input, regex_t* pregex, string_builder_t* psb, char* replacement,
+char* regex_sub(char* input, mlr_regex_t* pregex, string_builder_t* psb, char* replacement,
 	int* pmatched, int* pall_captured);
 
-char* regex_gsub(char* input, regex_t* pregex, string_builder_t* psb, char* replacement, int* pmatched, int* pall_captured,
+char* regex_gsub(char* input, mlr_regex_t* pregex, string_builder_t* psb, char* replacement, int* pmatched, int* pall_captured,
 	char *pfree_flags);
 
 // The regex library gives us an array of match pointers into the input string. This function strdups them
@@ -49,4 +79,7 @@ void save_regex_captures(string_array_t** ppregex_captures, char* input, regmatc
 // NULL. See comments in mapper_put.c for more information.
 char* interpolate_regex_captures(char* input, string_array_t* pregex_captures, int* pwas_allocated);
 
+// True if the input has "\0" through "\9" for interpolate_regex_captures to replace.
+int string_has_regex_captures(char* input);
+
 #endif // MLRREGEX_H
@@ -43,6 +43,41 @@ char* mlr_strmsep(char **pstring, const char *sep, int seplen) {
 	}
 }
 
+// ----------------------------------------------------------------
+// The library memchr is much faster than a byte-at-a-time loop, so candidates are
+// found by their first byte and then checked in full.
+char* mlr_memmem(char* haystack, size_t haystack_length, char* needle, int needle_length) {
+	if (needle_length == 0)
+		return haystack;
+	if (haystack_length < needle_length)
+		return NULL;
+	char* p = haystack;
+	char* last = haystack + haystack_length - needle_length;
+	while (p <= last) {
+		p = memchr(p, needle[0], last - p + 1);
+		if (p == NULL)
+			return NULL;
+		if (memcmp(p, needle, needle_length) == 0)
+			return p;
+		p++;
+	}
+	return NULL;
+}
+
+long long mlr_count_lines(char* buf, size_t length, char* irs, int irslen) {
+	long long count = 0LL;
+	char* p = buf;
+	char* end = buf + length;
+	while (p < end) {
+		char* q = (irslen == 1) ? memchr(p, irs[0], end - p) : mlr_memmem(p, end - p, irs, irslen);
+		count++;
+		if (q == NULL)
+			break;
+		p = q + irslen;
+	}
+	return count;
+}
+
 // ----------------------------------------------------------------
 int mlr_bsearch_double_for_insert(double* array, int size, double value) {
 	int lo = 0;
@@ -297,27 +332,53 @@ char* mlr_paste_5_strings(char* s1, char* s2, char* s3, char* s4, char* s5) {
 }
 
 // ----------------------------------------------------------------
-// This is djb2.
-int mlr_string_hash_func(char *str) {
-	unsigned long hash = 5381;
-	int c;
-
-	while ((c = *str++) != 0)
-		hash = ((hash << 5) + hash) + c; /* hash * 33 + c */
+// Multiply-and-fold hashing after wyhash: eight bytes per step rather than
+// djb2's one, and with well-mixed low bits, which the hash tables in
+// containers/ use for their control-byte tags.
+
+#define MLR_HASH_K0 0xa0761d6478bd642fULL
+#define MLR_HASH_K1 0xe7037ed1a0b428dbULL
+
+static inline unsigned long long mlr_hash_mum(unsigned long long a, unsigned long long b) {
+#ifdef __SIZEOF_INT128__
+	__uint128_t r = (__uint128_t)a * b;
+	return (unsigned long long)r ^ (unsigned long long)(r >> 64);
+#else
+	unsigned long long r = a * b;
+	return r ^ (r >> 32) ^ ((a >> 32) * (b >> 32));
+#endif
+}
 
-	return (int)hash;
+static unsigned long long mlr_hash_bytes(char* str, size_t len, unsigned long long seed) {
+	unsigned long long h = seed ^ MLR_HASH_K0;
+	unsigned long long word;
+	size_t n = len;
+	while (n >= 8) {
+		memcpy(&word, str, 8);
+		h = mlr_hash_mum(h ^ word, MLR_HASH_K1);
+		str += 8;
+		n -= 8;
+	}
+	word = 0;
+	memcpy(&word, str, n);
+	h = mlr_hash_mum(h ^ word, MLR_HASH_K1);
+	return mlr_hash_mum(h ^ len, MLR_HASH_K0);
 }
 
-int mlr_string_pair_hash_func(char* str1, char* str2) {
-	unsigned long hash = 5381;
-	int c;
+unsigned long long mlr_seeded_string_hash_func(char* str, unsigned long long seed) {
+	return mlr_hash_bytes(str, strlen(str), seed);
+}
 
-	while ((c = *str1++) != 0)
-		hash = ((hash << 5) + hash) + c; /* hash * 33 + c */
-	while ((c = *str2++) != 0)
-		hash = ((hash << 5) + hash) + c; /* hash * 33 + c */
+int mlr_string_hash_func(char *str) {
+	unsigned long long h = mlr_hash_bytes(str, strlen(str), 0);
+	return (int)(h ^ (h >> 32));
+}
 
-	return (int)hash;
+// The first string's hash seeds the second's, so that ("ab","c") and ("a","bc") differ.
+int mlr_string_pair_hash_func(char* str1, char* str2) {
+	unsigned long long h = mlr_hash_bytes(str1, strlen(str1), 0);
+	h = mlr_hash_bytes(str2, strlen(str2), h);
+	return (int)(h ^ (h >> 32));
 }
 
 // ----------------------------------------------------------------
@@ -78,6 +78,16 @@ static inline int streqn(char* a, char* b, int n) {
 // not a set of single-character delimiters.
 char* mlr_strmsep(char **pstring, const char *sep, int seplen);
 
+// ----------------------------------------------------------------
+// Like memmem, which isn't in C99: returns a pointer to the first occurrence of
+// the needle in the haystack, or NULL if there is none. Neither need be
+// null-terminated.
+char* mlr_memmem(char* haystack, size_t haystack_length, char* needle, int needle_length);
+
+// Counts the lines in the buffer, which needn't be null-terminated. The last
+// line needn't have a line terminator.
+long long mlr_count_lines(char* buf, size_t length, char* irs, int irslen);
+
 // ----------------------------------------------------------------
 int mlr_bsearch_double_for_insert(double* array, int size, double value);
 
@@ -124,6 +134,8 @@ char* mlr_paste_5_strings(char* s1, char* s2, char* s3, char* s4, char* s5);
 
 int mlr_string_hash_func(char *str);
 int mlr_string_pair_hash_func(char* str1, char* str2);
+// For hashing sequences of strings: each string's hash seeds the next one's.
+unsigned long long mlr_seeded_string_hash_func(char* str, unsigned long long seed);
 
 int strlen_for_utf8_display(char* str);
 int string_starts_with(char* string, char* prefix);
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <ctype.h>
 #include "lib/mlr_globals.h"
 #include "lib/mlrutil.h"
 #include "lib/mlrdatetime.h"
@@ -124,13 +125,26 @@ static mv_binary_func_t* dot_dispositions[MT_DIM][MT_DIM] = {
 
 mv_t s_xx_dot_func(mv_t* pval1, mv_t* pval2) { return (dot_dispositions[pval1->type][pval2->type])(pval1,pval2); }
 
+// Only the string-string case is done in the arena; the rest are rare enough in chains to not be worth
+// another disposition matrix.
+mv_t s_xx_dot_arena_func(mv_t* pval1, mv_t* pval2, string_arena_t* parena) {
+	if (parena == NULL || pval1->type != MT_STRING || pval2->type != MT_STRING)
+		return s_xx_dot_func(pval1, pval2);
+	size_t len1 = strlen(pval1->u.strv);
+	size_t len2 = strlen(pval2->u.strv);
+	char* string3 = string_arena_alloc_bytes(parena, len1 + len2 + 1);
+	memcpy(&string3[0], pval1->u.strv, len1);
+	memcpy(&string3[len1], pval2->u.strv, len2 + 1);
+	mv_free(pval1);
+	mv_free(pval2);
+	return mv_from_string_no_free(string3);
+}
+
 // ----------------------------------------------------------------
 mv_t sub_no_precomp_func(mv_t* pval1, mv_t* pval2, mv_t* pval3) {
-	regex_t regex;
 	string_builder_t *psb = sb_alloc(MV_SB_ALLOC_LENGTH);
-	mv_t rv = sub_precomp_func(pval1, regcomp_or_die(&regex, pval2->u.strv, 0), psb, pval3);
+	mv_t rv = sub_precomp_func(pval1, mlr_regex_cache_get(pval2->u.strv, 0), psb, pval3);
 	sb_free(psb);
-	regfree(&regex);
 	mv_free(pval2);
 	return rv;
 }
@@ -147,7 +161,7 @@ mv_t sub_no_precomp_func(mv_t* pval1, mv_t* pval2, mv_t* pval3) {
 // *  len3 = 1 = length of "o"
 // *  len4 = 6 = 2+3+1
 
-mv_t sub_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, mv_t* pval3) {
+mv_t sub_precomp_func(mv_t* pval1, mlr_regex_t* pregex, string_builder_t* psb, mv_t* pval3) {
 	int matched      = FALSE;
 	int all_captured = FALSE;
 	char* input      = pval1->u.strv;
@@ -171,16 +185,14 @@ mv_t sub_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, mv_t*
 // *  len4 = 6 = 2+3+1
 
 mv_t gsub_no_precomp_func(mv_t* pval1, mv_t* pval2, mv_t* pval3) {
-	regex_t regex;
 	string_builder_t *psb = sb_alloc(MV_SB_ALLOC_LENGTH);
-	mv_t rv = gsub_precomp_func(pval1, regcomp_or_die(&regex, pval2->u.strv, 0), psb, pval3);
+	mv_t rv = gsub_precomp_func(pval1, mlr_regex_cache_get(pval2->u.strv, 0), psb, pval3);
 	sb_free(psb);
-	regfree(&regex);
 	mv_free(pval2);
 	return rv;
 }
 
-mv_t gsub_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, mv_t* pval3) {
+mv_t gsub_precomp_func(mv_t* pval1, mlr_regex_t* pregex, string_builder_t* psb, mv_t* pval3) {
 	int matched      = FALSE;
 	int all_captured = FALSE;
 	char* input      = pval1->u.strv;
@@ -294,24 +306,37 @@ mv_t i_iii_modexp_func(mv_t* pval1, mv_t* pval2, mv_t* pval3) {
 }
 
 // ----------------------------------------------------------------
-mv_t s_s_tolower_func(mv_t* pval1) {
-	char* string = mlr_strdup_or_die(pval1->u.strv);
-	for (char* c = string; *c; c++)
-		*c = tolower((unsigned char)*c);
-	mv_free(pval1);
+// If the input is ours to free then it's case-folded in place rather than copied.
+static mv_t s_s_case_fold(mv_t* pval1, string_arena_t* parena, int (*pfold)(int)) {
+	mv_t rv;
+	if (pval1->free_flags & FREE_ENTRY_VALUE)
+		rv = mv_from_string_with_free(pval1->u.strv);
+	else if (parena != NULL)
+		rv = mv_from_string_no_free(string_arena_strdup(parena, pval1->u.strv));
+	else
+		rv = mv_from_string_with_free(mlr_strdup_or_die(pval1->u.strv));
+	for (char* c = rv.u.strv; *c; c++)
+		*c = pfold((unsigned char)*c);
 	pval1->u.strv = NULL;
+	pval1->free_flags = NO_FREE;
 
-	return mv_from_string_with_free(string);
+	return rv;
+}
+
+mv_t s_s_tolower_func(mv_t* pval1) {
+	return s_s_case_fold(pval1, NULL, tolower);
 }
 
 mv_t s_s_toupper_func(mv_t* pval1) {
-	char* string = mlr_strdup_or_die(pval1->u.strv);
-	for (char* c = string; *c; c++)
-		*c = toupper((unsigned char)*c);
-	mv_free(pval1);
-	pval1->u.strv = NULL;
+	return s_s_case_fold(pval1, NULL, toupper);
+}
 
-	return mv_from_string_with_free(string);
+mv_t s_s_tolower_arena_func(mv_t* pval1, string_arena_t* parena) {
+	return s_s_case_fold(pval1, parena, tolower);
+}
+
+mv_t s_s_toupper_arena_func(mv_t* pval1, string_arena_t* parena) {
+	return s_s_case_fold(pval1, parena, toupper);
 }
 
 mv_t i_s_strlen_func(mv_t* pval1) {
@@ -344,6 +369,23 @@ mv_t time_string_from_seconds(mv_t* psec, char* format) {
 	return mv_from_string_with_free(string);
 }
 
+// Same, with a precompiled format.
+mv_t time_string_from_seconds_with_format(mv_t* psec, time_format_t* pformat) {
+	double seconds_since_the_epoch = 0.0;
+	if (psec->type == MT_FLOAT) {
+		if (isinf(psec->u.fltv) || isnan(psec->u.fltv)) {
+			return mv_error();
+		}
+		seconds_since_the_epoch = psec->u.fltv;
+	} else {
+		seconds_since_the_epoch = psec->u.intv;
+	}
+
+	char* string = time_format_alloc_string_from_seconds(pformat, seconds_since_the_epoch);
+
+	return mv_from_string_with_free(string);
+}
+
 // ----------------------------------------------------------------
 static mv_t sec2gmt_s_n(mv_t* pa) { return time_string_from_seconds(pa, ISO8601_TIME_FORMAT); }
 
@@ -2179,28 +2221,26 @@ int mvnecopy(mv_t* pval1, mv_t* pval2) {
 }
 
 // ----------------------------------------------------------------
-// arg2 evaluates to string via compound expression; regexes compiled on each call.
+// arg2 evaluates to string via compound expression; regexes are compiled on first use
+// and kept in a small cache.
 mv_t matches_no_precomp_func(mv_t* pval1, mv_t* pval2, string_array_t** ppregex_captures) {
 	char* s1 = pval1->u.strv;
 	char* s2 = pval2->u.strv;
 
-	regex_t regex;
 	char* sstr   = s1;
 	char* sregex = s2;
 
-	regcomp_or_die(&regex, sregex, REG_NOSUB);
+	mlr_regex_t* pregex = mlr_regex_cache_get(sregex, 0);
 
 	const size_t nmatchmax = 10; // Capture-groups \1 through \9 supported, along with entire-string match
 	regmatch_t matches[nmatchmax];
-	if (regmatch_or_die(&regex, sstr, nmatchmax, matches)) {
+	if (mlr_regmatch_or_die(pregex, sstr, nmatchmax, matches)) {
 		if (ppregex_captures != NULL && *ppregex_captures != NULL)
 			save_regex_captures(ppregex_captures, pval1->u.strv, matches, nmatchmax);
-		regfree(&regex);
 		mv_free(pval1);
 		mv_free(pval2);
 		return mv_from_true();
 	} else {
-		regfree(&regex);
 		mv_free(pval1);
 		mv_free(pval2);
 		return mv_from_false();
@@ -2215,10 +2255,10 @@ mv_t does_not_match_no_precomp_func(mv_t* pval1, mv_t* pval2, string_array_t** p
 
 // ----------------------------------------------------------------
 // arg2 is a string, compiled to regex only once at alloc time
-mv_t matches_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, string_array_t** ppregex_captures) {
+mv_t matches_precomp_func(mv_t* pval1, mlr_regex_t* pregex, string_builder_t* psb, string_array_t** ppregex_captures) {
 	const size_t nmatchmax = 10; // Capture-groups \1 through \9 supported, along with entire-string match
 	regmatch_t matches[nmatchmax];
-	if (regmatch_or_die(pregex, pval1->u.strv, nmatchmax, matches)) {
+	if (mlr_regmatch_or_die(pregex, pval1->u.strv, nmatchmax, matches)) {
 		if (ppregex_captures != NULL)
 			save_regex_captures(ppregex_captures, pval1->u.strv, matches, nmatchmax);
 		mv_free(pval1);
@@ -2238,7 +2278,7 @@ mv_t matches_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, s
 	}
 }
 
-mv_t does_not_match_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, string_array_t** ppregex_captures) {
+mv_t does_not_match_precomp_func(mv_t* pval1, mlr_regex_t* pregex, string_builder_t* psb, string_array_t** ppregex_captures) {
 	mv_t rv = matches_precomp_func(pval1, pregex, psb, ppregex_captures);
 	rv.u.boolv = !rv.u.boolv;
 	return rv;
@@ -12,6 +12,8 @@
 #include "../lib/mtrand.h"
 #include "../lib/string_builder.h"
 #include "../lib/string_array.h"
+#include "../lib/string_arena.h"
+#include "../lib/mlrregex.h"
 #include "../lib/mlrval.h"
 
 #define MV_SB_ALLOC_LENGTH 32
@@ -34,9 +36,11 @@ typedef mv_t mv_zary_func_t();
 typedef mv_t mv_unary_func_t(mv_t* pval1);
 typedef mv_t mv_binary_func_t(mv_t* pval1, mv_t* pval2);
 typedef mv_t mv_binary_arg3_capture_func_t(mv_t* pval1, mv_t* pval2, string_array_t** ppregex_captures);
-typedef mv_t mv_binary_arg2_regex_func_t(mv_t* pval1, regex_t* pregex, string_builder_t* psb, string_array_t** ppregex_captures);
+typedef mv_t mv_binary_arg2_regex_func_t(mv_t* pval1, mlr_regex_t* pregex, string_builder_t* psb, string_array_t** ppregex_captures);
 typedef mv_t mv_ternary_func_t(mv_t* pval1, mv_t* pval2, mv_t* pval3);
-typedef mv_t mv_ternary_arg2_regex_func_t(mv_t* pval1, regex_t* pregex, string_builder_t* psb, mv_t* pval3);
+typedef mv_t mv_ternary_arg2_regex_func_t(mv_t* pval1, mlr_regex_t* pregex, string_builder_t* psb, mv_t* pval3);
+typedef mv_t mv_unary_arena_func_t(mv_t* pval1, string_arena_t* parena);
+typedef mv_t mv_binary_arena_func_t(mv_t* pval1, mv_t* pval2, string_arena_t* parena);
 
 // ----------------------------------------------------------------
 static inline mv_t b_b_not_func(mv_t* pval1) {
@@ -189,10 +193,17 @@ mv_t s_x_typeof_func(mv_t* pval1);
 
 mv_t s_xx_dot_func(mv_t* pval1, mv_t* pval2);
 
+// Same as the above, except that string outputs are written to the arena, with NO_FREE, rather than to
+// the heap. Pass-through results (e.g. "abc" . "") are returned as-is. With NULL arena these are the
+// same as the above.
+mv_t s_s_tolower_arena_func(mv_t* pval1, string_arena_t* parena);
+mv_t s_s_toupper_arena_func(mv_t* pval1, string_arena_t* parena);
+mv_t s_xx_dot_arena_func(mv_t* pval1, mv_t* pval2, string_arena_t* parena);
+
 mv_t sub_no_precomp_func(mv_t* pval1, mv_t* pval2, mv_t* pval3);
-mv_t sub_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, mv_t* pval3);
+mv_t sub_precomp_func(mv_t* pval1, mlr_regex_t* pregex, string_builder_t* psb, mv_t* pval3);
 mv_t gsub_no_precomp_func(mv_t* pval1, mv_t* pval2, mv_t* pval3);
-mv_t gsub_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, mv_t* pval3);
+mv_t gsub_precomp_func(mv_t* pval1, mlr_regex_t* pregex, string_builder_t* psb, mv_t* pval3);
 
 // ----------------------------------------------------------------
 mv_t s_x_sec2gmt_func(mv_t* pval1);
@@ -212,14 +223,15 @@ mv_t i_s_dhms2sec_func(mv_t* pval1);
 mv_t f_s_dhms2fsec_func(mv_t* pval1);
 
 mv_t time_string_from_seconds(mv_t* psec, char* format);
+mv_t time_string_from_seconds_with_format(mv_t* psec, time_format_t* pformat);
 
 // ----------------------------------------------------------------
 // arg2 evaluates to string via compound expression; regexes compiled on each call
 mv_t matches_no_precomp_func(mv_t* pval1, mv_t* pval2, string_array_t** ppregex_captures);
 mv_t does_not_match_no_precomp_func(mv_t* pval1, mv_t* pval2, string_array_t** ppregex_captures);
 // arg2 is a string, compiled to regex only once at alloc time
-mv_t matches_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, string_array_t** ppregex_captures);
-mv_t does_not_match_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, string_array_t** ppregex_captures);
+mv_t matches_precomp_func(mv_t* pval1, mlr_regex_t* pregex, string_builder_t* psb, string_array_t** ppregex_captures);
+mv_t does_not_match_precomp_func(mv_t* pval1, mlr_regex_t* pregex, string_builder_t* psb, string_array_t** ppregex_captures);
 
 // For filter/put DSL:
 mv_t eq_op_func(mv_t* pval1, mv_t* pval2);
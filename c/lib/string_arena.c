@@ -0,0 +1,63 @@
+#include <stdlib.h>
+#include <string.h>
+#include "lib/mlrutil.h"
+#include "lib/mlr_globals.h"
+#include "lib/string_arena.h"
+
+static string_arena_chunk_t* string_arena_chunk_alloc(size_t size) {
+	string_arena_chunk_t* pchunk = mlr_malloc_or_die(sizeof(string_arena_chunk_t) + size);
+	pchunk->pnext = NULL;
+	pchunk->size  = size;
+	pchunk->used  = 0;
+	return pchunk;
+}
+
+// ----------------------------------------------------------------
+string_arena_t* string_arena_alloc(size_t chunk_size) {
+	if (chunk_size < 1) {
+		fprintf(stderr, "%s: string_arena chunk_size must be >= 1; got %llu.\n",
+			MLR_GLOBALS.bargv0, (unsigned long long)chunk_size);
+		exit(1);
+	}
+	string_arena_t* parena = mlr_malloc_or_die(sizeof(string_arena_t));
+	parena->chunk_size = chunk_size;
+	parena->phead      = string_arena_chunk_alloc(chunk_size);
+	parena->pcurrent   = parena->phead;
+	return parena;
+}
+
+// ----------------------------------------------------------------
+void string_arena_free(string_arena_t* parena) {
+	if (parena == NULL)
+		return;
+	string_arena_chunk_t* pnext = NULL;
+	for (string_arena_chunk_t* pchunk = parena->phead; pchunk != NULL; pchunk = pnext) {
+		pnext = pchunk->pnext;
+		free(pchunk);
+	}
+	free(parena);
+}
+
+// ----------------------------------------------------------------
+// The current chunk is full. Move on to the next one, which is left over from
+// before the last release or reset, if it's big enough; else splice in a new one.
+char* _string_arena_alloc_slow(string_arena_t* parena, size_t size) {
+	string_arena_chunk_t* pcurrent = parena->pcurrent;
+	string_arena_chunk_t* pnext = pcurrent->pnext;
+	if (pnext == NULL || pnext->size < size) {
+		pnext = string_arena_chunk_alloc((size > parena->chunk_size) ? size : parena->chunk_size);
+		pnext->pnext = pcurrent->pnext;
+		pcurrent->pnext = pnext;
+	}
+	pnext->used = size;
+	parena->pcurrent = pnext;
+	return &pnext->data[0];
+}
+
+// ----------------------------------------------------------------
+char* string_arena_strdup(string_arena_t* parena, char* string) {
+	size_t size = strlen(string) + 1;
+	char* rv = string_arena_alloc_bytes(parena, size);
+	memcpy(rv, string, size);
+	return rv;
+}
@@ -0,0 +1,66 @@
+#ifndef STRING_ARENA_H
+#define STRING_ARENA_H
+
+#include <stddef.h>
+
+// ================================================================
+// Bump allocator for short-lived strings. Allocations are carved out of a list
+// of chunks and are never individually freed; instead the caller takes a mark
+// and later releases back to it, or resets the whole arena. Chunks are kept for
+// reuse, so once the arena has grown to its working size there are no further
+// mallocs.
+//
+// Marks must be released in last-in-first-out order.
+// ================================================================
+
+typedef struct _string_arena_chunk_t {
+	struct _string_arena_chunk_t* pnext;
+	size_t size;
+	size_t used;
+	char   data[];
+} string_arena_chunk_t;
+
+typedef struct _string_arena_t {
+	string_arena_chunk_t* phead;
+	string_arena_chunk_t* pcurrent;
+	size_t chunk_size;
+} string_arena_t;
+
+typedef struct _string_arena_mark_t {
+	string_arena_chunk_t* pchunk;
+	size_t used;
+} string_arena_mark_t;
+
+string_arena_t* string_arena_alloc(size_t chunk_size);
+void string_arena_free(string_arena_t* parena);
+
+char* _string_arena_alloc_slow(string_arena_t* parena, size_t size); // private method
+
+static inline char* string_arena_alloc_bytes(string_arena_t* parena, size_t size) {
+	string_arena_chunk_t* pchunk = parena->pcurrent;
+	if (pchunk->used + size <= pchunk->size) {
+		char* rv = &pchunk->data[pchunk->used];
+		pchunk->used += size;
+		return rv;
+	}
+	return _string_arena_alloc_slow(parena, size);
+}
+
+static inline string_arena_mark_t string_arena_mark(string_arena_t* parena) {
+	return (string_arena_mark_t) { .pchunk = parena->pcurrent, .used = parena->pcurrent->used };
+}
+
+static inline void string_arena_release(string_arena_t* parena, string_arena_mark_t mark) {
+	parena->pcurrent = mark.pchunk;
+	parena->pcurrent->used = mark.used;
+}
+
+static inline void string_arena_reset(string_arena_t* parena) {
+	parena->pcurrent = parena->phead;
+	parena->pcurrent->used = 0;
+}
+
+// Copies the string, with null terminator, into the arena.
+char* string_arena_strdup(string_arena_t* parena, char* string);
+
+#endif // STRING_ARENA_H
@@ -61,3 +61,11 @@ string_array_t* string_array_from_line(char* line, char ifs) {
 
 	return parray;
 }
+
+// ----------------------------------------------------------------
+int string_array_hash_func(string_array_t* parray) {
+	unsigned long long hash = 0;
+	for (int i = 0; i < parray->length; i++)
+		hash = mlr_seeded_string_hash_func(parray->strings[i], hash);
+	return (int)(hash ^ (hash >> 32));
+}
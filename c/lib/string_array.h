@@ -13,4 +13,8 @@ void string_array_free(string_array_t* parray);
 void string_array_realloc(string_array_t* parray, int new_length);
 string_array_t* string_array_from_line(char* line, char ifs);
 
+// Agrees with slls_hash_func for the same strings, so lists and arrays can be
+// used interchangeably as hash-map keys. The strings must be non-null.
+int string_array_hash_func(string_array_t* parray);
+
 #endif // STRING_ARRAY_H
@@ -2,10 +2,13 @@
 #define MAPPER_H
 
 #include <stdio.h>
+#include <string.h>
+#include "lib/mlrutil.h"
 #include "lib/context.h"
 #include "cli/mlrcli.h"
 #include "containers/lrec.h"
 #include "containers/sllv.h"
+#include "containers/hss.h"
 
 // See ../README.md for memory-management conventions.
 
@@ -17,14 +20,97 @@ struct _mapper_t; // forward reference for method declarations
 // Returns linked list of records (lrec_t*).
 typedef sllv_t* mapper_process_func_t(lrec_t* pinrec, context_t* pctx, void* pvstate);
 
+// Push-style alternative: rather than returning a list, the mapper hands each
+// output record to the emitter as it goes, with the same conventions as for the
+// list -- in particular, at end of stream it emits a null record last. The
+// emitter belongs to the stream driver and passes each record straight on down
+// the chain, so a mapper passing a record along allocates nothing. A mapper has
+// either a process function or, with pprocess_func null, a push function;
+// see stream.c for how the two are chained.
+//
+// Records go through the chain depth-first: each one emitted, by either kind
+// of mapper, is taken through all the rest of the chain before the mapper
+// which emitted it goes on. So when a mapper emits several records for one
+// input record, anything a downstream mapper does per record -- print, tee,
+// dump and so on -- comes between them, where with lists it came before all
+// of them. E.g. for head -n 1 then put -q 'emit {"a":1}; emit {"a":2}' then
+// put 'print "Q"' the output is Q, a=1, Q, a=2 rather than Q, Q, a=1, a=2.
+struct _mapper_emitter_t;
+typedef void mapper_emit_func_t(lrec_t* poutrec, context_t* pctx, struct _mapper_emitter_t* pemitter);
+typedef struct _mapper_emitter_t {
+	mapper_emit_func_t* pemit_func;
+	void*               pvstate;
+} mapper_emitter_t;
+
+static inline void mapper_emit(mapper_emitter_t* pemitter, lrec_t* poutrec, context_t* pctx) {
+	pemitter->pemit_func(poutrec, pctx, pemitter);
+}
+
+typedef void mapper_push_func_t(lrec_t* pinrec, context_t* pctx, void* pvstate, mapper_emitter_t* pemitter);
+
 typedef void mapper_free_func_t(struct _mapper_t* pmapper, context_t* pctx);
 
+// For projection pushdown: given the names of the fields which the rest of the
+// chain can read from this mapper's output, or null for any of them, returns a
+// new set of the fields this mapper can read from its input, or null for any
+// of them. The keys aren't copied, so they must live as long as the mapper. A
+// null function means the mapper can read any field.
+typedef hss_t* mapper_input_fields_func_t(void* pvstate, hss_t* pdownstream_fields);
+
+// For predicate pushdown: returns a prefilter (see input/lrec_readers.h) which
+// the reader may use to drop records this mapper would drop anyway, or null if
+// there is none. It's asked of the first mapper in the chain only, and belongs
+// to the mapper. A null function means there is none.
+struct _lrec_prefilter_t;
+typedef struct _lrec_prefilter_t* mapper_prefilter_func_t(void* pvstate);
+
+// For offset-based retention: hands the mapper a retainer (see
+// input/lrec_readers.h) with which it may keep where its input records are in
+// the input file, rather than the records themselves, re-parsing them when it
+// emits them. Like the prefilter it's offered to the first mapper in the chain
+// only, but it belongs to the reader. A null function means the mapper keeps
+// records as they are.
+struct _lrec_retainer_t;
+typedef void mapper_set_retainer_func_t(void* pvstate, struct _lrec_retainer_t* pretainer);
+
+// For reverse reading: switches the mapper to taking its input last record
+// first, and returns how many records it needs from the end of the input, or
+// -1 for all of them. It's offered to the first mapper in the chain only, when
+// the input is one file and the reader can read it backward. Once it's called,
+// the mapper gets only those records, in that order, with the context as it
+// would be at end of stream. A null function means the mapper takes its input
+// in order.
+typedef long long mapper_set_reverse_input_func_t(void* pvstate);
+
+// For two-pass reading: a mapper which needs all its input before it can
+// produce any output, e.g. for totals, can instead be given the input twice
+// when it's in regular files. The first pass goes to this function record by
+// record, then a null record ends the pass; the mapper frees the records. The
+// second pass goes to the process function as usual. As with reverse reading,
+// it's offered to the first mapper only and the rest of the chain sees the
+// context as at end of stream. A null function means the mapper reads once.
+typedef void mapper_first_pass_func_t(lrec_t* pinrec, context_t* pctx, void* pvstate);
+
 typedef struct _mapper_t {
 	void* pvstate;
-	mapper_process_func_t* pprocess_func;
+	mapper_process_func_t* pprocess_func; // Null for push-style mappers
+	mapper_push_func_t*    ppush_func;    // Only used when pprocess_func is null
 	mapper_free_func_t*    pfree_func; // virtual destructor
+	mapper_input_fields_func_t* pinput_fields_func;
+	mapper_prefilter_func_t*    pprefilter_func;
+	mapper_set_retainer_func_t* pset_retainer_func;
+	mapper_set_reverse_input_func_t* pset_reverse_input_func;
+	mapper_first_pass_func_t*        pfirst_pass_func;
 } mapper_t;
 
+// All the function pointers start out null, so that a mapper's constructor
+// need set only those it has.
+static inline mapper_t* mapper_alloc() {
+	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	memset(pmapper, 0, sizeof(mapper_t));
+	return pmapper;
+}
+
 // ----------------------------------------------------------------
 // Control plane:
 
@@ -135,7 +135,7 @@ static mapper_t* mapper_bar_alloc(ap_state_t* pargp, string_array_t* pfield_name
 	char fill_char, char oob_char, char blank_char, double lo, double hi,
 	int width, int do_auto)
 {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_bar_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_bar_state_t));
 	pstate->pargp        = pargp;
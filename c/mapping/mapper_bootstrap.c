@@ -3,6 +3,7 @@
 #include "lib/mlrutil.h"
 #include "lib/mtrand.h"
 #include "containers/sllv.h"
+#include "input/lrec_readers.h"
 #include "mapping/mappers.h"
 
 #define NOUT_EQUALS_NIN -1
@@ -10,6 +11,9 @@ typedef struct _mapper_bootstrap_state_t {
 	ap_state_t* pargp;
 	int nout;
 	sllv_t* records;
+	// With a retainer, where the records are in the input rather than the records themselves.
+	lrec_retainer_t* pretainer;
+	lrec_extents_t*  pextents;
 } mapper_bootstrap_state_t;
 
 static void      mapper_bootstrap_usage(FILE* o, char* argv0, char* verb);
@@ -17,7 +21,8 @@ static mapper_t* mapper_bootstrap_parse_cli(int* pargi, int argc, char** argv,
 	cli_reader_opts_t* _, cli_writer_opts_t* __);
 static mapper_t* mapper_bootstrap_alloc(int nout, ap_state_t* pargp);
 static void      mapper_bootstrap_free(mapper_t* pmapper, context_t* _);
-static sllv_t*   mapper_bootstrap_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static void      mapper_bootstrap_set_retainer(void* pvstate, lrec_retainer_t* pretainer);
+static void      mapper_bootstrap_push(lrec_t* pinrec, context_t* pctx, void* pvstate, mapper_emitter_t* pemitter);
 
 // ----------------------------------------------------------------
 mapper_setup_t mapper_bootstrap_setup = {
@@ -68,16 +73,19 @@ static mapper_t* mapper_bootstrap_parse_cli(int* pargi, int argc, char** argv,
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_bootstrap_alloc(int nout, ap_state_t* pargp) {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_bootstrap_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_bootstrap_state_t));
 	pstate->nout    = nout;
 	pstate->pargp   = pargp;
-	pstate->records = sllv_alloc();
+	pstate->records   = sllv_alloc();
+	pstate->pretainer = NULL;
+	pstate->pextents  = NULL;
 
 	pmapper->pvstate       = pstate;
-	pmapper->pprocess_func = mapper_bootstrap_process;
+	pmapper->ppush_func    = mapper_bootstrap_push;
 	pmapper->pfree_func    = mapper_bootstrap_free;
+	pmapper->pset_retainer_func = mapper_bootstrap_set_retainer;
 
 	return pmapper;
 }
@@ -86,18 +94,55 @@ static void mapper_bootstrap_free(mapper_t* pmapper, context_t* _) {
 	mapper_bootstrap_state_t* pstate = pmapper->pvstate;
 	// Free the container
 	sllv_free(pstate->records);
+	lrec_extents_free(pstate->pextents);
 	ap_free(pstate->pargp);
 	free(pstate);
 	free(pmapper);
 }
 
+static void mapper_bootstrap_set_retainer(void* pvstate, lrec_retainer_t* pretainer) {
+	mapper_bootstrap_state_t* pstate = pvstate;
+	pstate->pretainer = pretainer;
+	pstate->pextents  = lrec_extents_alloc();
+}
+
 // ----------------------------------------------------------------
-static sllv_t* mapper_bootstrap_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+static void mapper_bootstrap_push(lrec_t* pinrec, context_t* pctx, void* pvstate, mapper_emitter_t* pemitter) {
 	mapper_bootstrap_state_t* pstate = pvstate;
 	if (pinrec != NULL) { // Not end of input stream: consume an input record.
-		// The caller will free the outrecs
-		sllv_append(pstate->records, pinrec);
-		return NULL;
+		if (pstate->pretainer != NULL) {
+			lrec_extents_append(pstate->pextents, pstate->pretainer->current);
+			lrec_free(pinrec);
+		} else {
+			// The caller will free the outrecs
+			sllv_append(pstate->records, pinrec);
+		}
+		return;
+	}
+
+	// With a retainer, each output record is a fresh parse, so none of the
+	// memory management below is needed.
+	if (pstate->pretainer != NULL) {
+		int nin = pstate->pextents->length;
+		int nout = (pstate->nout == NOUT_EQUALS_NIN) ? nin : pstate->nout;
+		if (nin > 0) {
+			// Draw all the indices before emitting anything, as below, in case
+			// the rest of the chain uses the random-number generator too.
+			int* indices = mlr_malloc_or_die(nout * sizeof(int));
+			for (int i = 0; i < nout; i++) {
+				int index = nin * get_mtrand_double();
+				if (index >= nin)
+					index = nin - 1;
+				indices[i] = index;
+			}
+			for (int i = 0; i < nout; i++)
+				mapper_emit(pemitter, lrec_retainer_reparse(pstate->pretainer, &pstate->pextents->pextents[indices[i]]),
+					pctx);
+			free(indices);
+		}
+		pstate->pextents->length = 0;
+		mapper_emit(pemitter, NULL, pctx);
+		return;
 	}
 
 	// This is entirely straightforward except for memory management. The
@@ -113,12 +158,11 @@ static sllv_t* mapper_bootstrap_process(lrec_t* pinrec, context_t* pctx, void* p
 	//   so for all repetitions past the first we must make a copy.
 	// A used_flags[] array allows us to handle all of this.
 
-	sllv_t* poutrecs = sllv_alloc();
 	int nin = pstate->records->length;
 	int nout = (pstate->nout == NOUT_EQUALS_NIN) ? nin : pstate->nout;
 	if (nin == 0) {
-		sllv_append(poutrecs, NULL);
-		return poutrecs;
+		mapper_emit(pemitter, NULL, pctx);
+		return;
 	}
 
 	// Make an array of pointers into the input list. Mark each lrec as not yet output.
@@ -131,7 +175,9 @@ static sllv_t* mapper_bootstrap_process(lrec_t* pinrec, context_t* pctx, void* p
 	}
 
 	// Do the sample-with-replacment, reading from random indices in the input
-	// array and appending to the output list.
+	// array and appending to the output list. Nothing is emitted until all the
+	// copies are made, since records emitted may be modified or freed downstream.
+	sllv_t* poutrecs = sllv_alloc();
 	for (int i = 0; i < nout; i++) {
 		int index = nin * get_mtrand_double();
 		if (index >= nin)
@@ -153,8 +199,14 @@ static sllv_t* mapper_bootstrap_process(lrec_t* pinrec, context_t* pctx, void* p
 	free(used_flags);
 	// Free the temp array
 	free(record_array);
+	// The records are now to be output or freed; empty the list without freeing them.
+	sllv_free(pstate->records);
+	pstate->records = sllv_alloc();
+
+	while (poutrecs->length > 0)
+		mapper_emit(pemitter, sllv_pop(poutrecs), pctx);
+	sllv_free(poutrecs);
 
-	// Null-terminate the output list to signify end of stream.
-	sllv_append(poutrecs, NULL);
-	return poutrecs;
+	// A null record signifies end of stream.
+	mapper_emit(pemitter, NULL, pctx);
 }
@@ -21,9 +21,10 @@ static mapper_t* mapper_cat_parse_cli(int* pargi, int argc, char** argv,
 static mapper_t* mapper_cat_alloc(ap_state_t* pargp, int do_counters, char* counter_field_name,
 	slls_t* pgroup_by_field_names);
 static void      mapper_cat_free(mapper_t* pmapper, context_t* _);
-static sllv_t*   mapper_cat_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
-static sllv_t*   mapper_catn_process_ungrouped(lrec_t* pinrec, context_t* pctx, void* pvstate);
-static sllv_t*   mapper_catn_process_grouped(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static hss_t*    mapper_cat_input_fields(void* pvstate, hss_t* pdownstream_fields);
+static void      mapper_cat_push(lrec_t* pinrec, context_t* pctx, void* pvstate, mapper_emitter_t* pemitter);
+static void      mapper_catn_push_ungrouped(lrec_t* pinrec, context_t* pctx, void* pvstate, mapper_emitter_t* pemitter);
+static void      mapper_catn_push_grouped(lrec_t* pinrec, context_t* pctx, void* pvstate, mapper_emitter_t* pemitter);
 
 // ----------------------------------------------------------------
 mapper_setup_t mapper_cat_setup = {
@@ -84,7 +85,7 @@ static void mapper_cat_usage(FILE* o, char* argv0, char* verb) {
 static mapper_t* mapper_cat_alloc(ap_state_t* pargp, int do_counters, char* counter_field_name,
 	slls_t* pgroup_by_field_names)
 {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 	mapper_cat_state_t* pstate    = mlr_malloc_or_die(sizeof(mapper_cat_state_t));
 	pstate->pargp                 = pargp;
 	pstate->pgroup_by_field_names = pgroup_by_field_names;
@@ -93,18 +94,18 @@ static mapper_t* mapper_cat_alloc(ap_state_t* pargp, int do_counters, char* coun
 	pstate->pcounters_by_group    = lhmslv_alloc();
 	pmapper->pvstate              = pstate;
 
-	pmapper->pprocess_func = NULL;
 	if (do_counters) {
 		if (pgroup_by_field_names->length == 0) {
-			pmapper->pprocess_func = mapper_catn_process_ungrouped;
+			pmapper->ppush_func = mapper_catn_push_ungrouped;
 		} else {
-			pmapper->pprocess_func = mapper_catn_process_grouped;
+			pmapper->ppush_func = mapper_catn_push_grouped;
 		}
 	} else {
-		pmapper->pprocess_func = mapper_cat_process;
+		pmapper->ppush_func = mapper_cat_push;
 	}
 
 	pmapper->pfree_func           = mapper_cat_free;
+	pmapper->pinput_fields_func   = mapper_cat_input_fields;
 	return pmapper;
 }
 static void mapper_cat_free(mapper_t* pmapper, context_t* _) {
@@ -119,28 +120,28 @@ static void mapper_cat_free(mapper_t* pmapper, context_t* _) {
 	free(pmapper);
 }
 
+static hss_t* mapper_cat_input_fields(void* pvstate, hss_t* pdownstream_fields) {
+	mapper_cat_state_t* pstate = pvstate;
+	return mapper_pass_through_input_fields(pdownstream_fields, pstate->pgroup_by_field_names);
+}
+
 // ----------------------------------------------------------------
-static sllv_t* mapper_cat_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
-	if (pinrec != NULL)
-		return sllv_single(pinrec);
-	else
-		return sllv_single(NULL);
+static void mapper_cat_push(lrec_t* pinrec, context_t* pctx, void* pvstate, mapper_emitter_t* pemitter) {
+	mapper_emit(pemitter, pinrec, pctx);
 }
 
 // ----------------------------------------------------------------
-static sllv_t* mapper_catn_process_ungrouped(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+static void mapper_catn_push_ungrouped(lrec_t* pinrec, context_t* pctx, void* pvstate, mapper_emitter_t* pemitter) {
 	mapper_cat_state_t* pstate = (mapper_cat_state_t*)pvstate;
 	if (pinrec != NULL) {
 		char* counter_field_value = mlr_alloc_string_from_ull(++pstate->counter);
 		lrec_prepend(pinrec, pstate->counter_field_name, counter_field_value, FREE_ENTRY_VALUE);
-		return sllv_single(pinrec);
-	} else {
-		return sllv_single(NULL);
 	}
+	mapper_emit(pemitter, pinrec, pctx);
 }
 
 // ----------------------------------------------------------------
-static sllv_t* mapper_catn_process_grouped(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+static void mapper_catn_push_grouped(lrec_t* pinrec, context_t* pctx, void* pvstate, mapper_emitter_t* pemitter) {
 	mapper_cat_state_t* pstate = (mapper_cat_state_t*)pvstate;
 	if (pinrec != NULL) {
 
@@ -165,8 +166,6 @@ static sllv_t* mapper_catn_process_grouped(lrec_t* pinrec, context_t* pctx, void
 		}
 		char* counter_field_value = mlr_alloc_string_from_ull(counter);
 		lrec_prepend(pinrec, pstate->counter_field_name, counter_field_value, FREE_ENTRY_VALUE);
-		return sllv_single(pinrec);
-	} else {
-		return sllv_single(NULL);
 	}
+	mapper_emit(pemitter, pinrec, pctx);
 }
@@ -38,7 +38,7 @@ static mapper_t* mapper_check_parse_cli(int* pargi, int argc, char** argv,
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_check_alloc() {
-	mapper_t* pmapper      = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper      = mapper_alloc();
 	pmapper->pvstate       = NULL;
 	pmapper->pprocess_func = mapper_check_process;
 	pmapper->pfree_func    = mapper_check_free;
@@ -17,6 +17,7 @@
 typedef struct _mapper_count_similar_state_t {
 	ap_state_t* pargp;
 	slls_t* pgroup_by_field_names;
+	string_array_t* pgroup_by_field_values; // scratch space used per-record
 	lhmslv_t* pcounts_by_group;
 	lhmslv_t* precord_lists_by_group;
 	char* output_field_name;
@@ -97,12 +98,13 @@ static mapper_t* mapper_count_similar_parse_cli(int* pargi, int argc, char** arg
 static mapper_t* mapper_count_similar_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_names,
 	char* output_field_name)
 {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_count_similar_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_count_similar_state_t));
 
 	pstate->pargp                  = pargp;
 	pstate->pgroup_by_field_names  = pgroup_by_field_names;
+	pstate->pgroup_by_field_values = string_array_alloc(pgroup_by_field_names->length);
 	pstate->pcounts_by_group       = lhmslv_alloc();
 	pstate->precord_lists_by_group = lhmslv_alloc();
 	pstate->output_field_name      = output_field_name;
@@ -117,6 +119,7 @@ static mapper_t* mapper_count_similar_alloc(ap_state_t* pargp, slls_t* pgroup_by
 static void mapper_count_similar_free(mapper_t* pmapper, context_t* _) {
 	mapper_count_similar_state_t* pstate = pmapper->pvstate;
 	slls_free(pstate->pgroup_by_field_names);
+	string_array_free(pstate->pgroup_by_field_values);
 
 	// lhmslv_free will free the keys: we only need to free the void-star values.
 	for (lhmslve_t* pa = pstate->pcounts_by_group->phead; pa != NULL; pa = pa->pnext) {
@@ -145,32 +148,33 @@ static void mapper_count_similar_free(mapper_t* pmapper, context_t* _) {
 static sllv_t* mapper_count_similar_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	mapper_count_similar_state_t* pstate = pvstate;
 	if (pinrec != NULL) {
-		slls_t* pgroup_by_field_values = mlr_reference_selected_values_from_record(pinrec,
-			pstate->pgroup_by_field_names);
-		if (pgroup_by_field_values == NULL) {
+		string_array_t* pgroup_by_field_values = pstate->pgroup_by_field_values;
+		if (!mlr_reference_selected_values_from_record_into_array(pinrec,
+			pstate->pgroup_by_field_names, pgroup_by_field_values))
+		{
 			lrec_free(pinrec);
 			return NULL;
 		}
 
-		unsigned long long* pcount = lhmslv_get(pstate->pcounts_by_group, pgroup_by_field_values);
+		unsigned long long* pcount = lhmslv_get_from_string_array(pstate->pcounts_by_group, pgroup_by_field_values);
 		if (pcount == NULL) {
 			pcount = mlr_malloc_or_die(sizeof(unsigned long long));
 			*pcount = 1LL;
-			lhmslv_put(pstate->pcounts_by_group, slls_copy(pgroup_by_field_values), pcount, FREE_ENTRY_KEY);
+			lhmslv_put_copy_of_string_array(pstate->pcounts_by_group, pgroup_by_field_values, pcount);
 		} else {
 			(*pcount)++;
 		}
 
-		sllv_t* precord_list_for_group = lhmslv_get(pstate->precord_lists_by_group, pgroup_by_field_values);
+		sllv_t* precord_list_for_group = lhmslv_get_from_string_array(pstate->precord_lists_by_group,
+			pgroup_by_field_values);
 		if (precord_list_for_group == NULL) {
 			precord_list_for_group = sllv_alloc();
-			lhmslv_put(pstate->precord_lists_by_group, slls_copy(pgroup_by_field_values), precord_list_for_group,
-				FREE_ENTRY_KEY);
+			lhmslv_put_copy_of_string_array(pstate->precord_lists_by_group, pgroup_by_field_values,
+				precord_list_for_group);
 
 		}
 		sllv_append(precord_list_for_group, pinrec);
 
-		slls_free(pgroup_by_field_values);
 		return NULL;
 
 	} else {
@@ -4,6 +4,7 @@
 #include "containers/sllv.h"
 #include "containers/hss.h"
 #include "containers/mixutil.h"
+#include "containers/schema_cache.h"
 #include "mapping/mappers.h"
 #include "cli/argparse.h"
 
@@ -13,6 +14,7 @@ typedef struct _mapper_cut_state_t {
 	hss_t*   pfield_name_set;
 	regex_t* regexes;
 	int      nregex;
+	schema_cache_t* pschema_cache; // field-retention flags by field names, for regexes
 	int      do_arg_order;
 	int      do_complement;
 } mapper_cut_state_t;
@@ -23,8 +25,11 @@ static mapper_t* mapper_cut_parse_cli(int* pargi, int argc, char** argv,
 static mapper_t* mapper_cut_alloc(ap_state_t* pargp, slls_t* pfield_name_list,
 	int do_arg_order, int do_complement, int do_regexes);
 static void      mapper_cut_free(mapper_t* pmapper, context_t* _);
-static sllv_t*   mapper_cut_process_no_regexes(lrec_t* pinrec, context_t* pctx, void* pvstate);
-static sllv_t*   mapper_cut_process_with_regexes(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static hss_t*    mapper_cut_input_fields(void* pvstate, hss_t* pdownstream_fields);
+static void      mapper_cut_push_no_regexes(lrec_t* pinrec, context_t* pctx, void* pvstate,
+	mapper_emitter_t* pemitter);
+static void      mapper_cut_push_with_regexes(lrec_t* pinrec, context_t* pctx, void* pvstate,
+	mapper_emitter_t* pemitter);
 
 // ----------------------------------------------------------------
 mapper_setup_t mapper_cut_setup = {
@@ -89,7 +94,7 @@ static mapper_t* mapper_cut_parse_cli(int* pargi, int argc, char** argv,
 static mapper_t* mapper_cut_alloc(ap_state_t* pargp, slls_t* pfield_name_list,
 	int do_arg_order, int do_complement, int do_regexes)
 {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_cut_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_cut_state_t));
 	pstate->pargp = pargp;
@@ -99,7 +104,8 @@ static mapper_t* mapper_cut_alloc(ap_state_t* pargp, slls_t* pfield_name_list,
 		pstate->pfield_name_set    = hss_from_slls(pfield_name_list);
 		pstate->nregex             = 0;
 		pstate->regexes            = NULL;
-		pmapper->pprocess_func     = mapper_cut_process_no_regexes;
+		pstate->pschema_cache      = NULL;
+		pmapper->ppush_func        = mapper_cut_push_no_regexes;
 	} else {
 		pstate->pfield_name_list   = NULL;
 		pstate->pfield_name_set    = NULL;
@@ -112,13 +118,15 @@ static mapper_t* mapper_cut_alloc(ap_state_t* pargp, slls_t* pfield_name_list,
 			regcomp_or_die_quoted(&pstate->regexes[i], pe->value, REG_NOSUB);
 		}
 		slls_free(pfield_name_list);
-		pmapper->pprocess_func = mapper_cut_process_with_regexes;
+		pstate->pschema_cache = schema_cache_alloc(free);
+		pmapper->ppush_func = mapper_cut_push_with_regexes;
 	}
 	pstate->do_arg_order  = do_arg_order;
 	pstate->do_complement = do_complement;
 
 	pmapper->pvstate      = (void*)pstate;
 	pmapper->pfree_func   = mapper_cut_free;
+	pmapper->pinput_fields_func = mapper_cut_input_fields;
 
 	return pmapper;
 }
@@ -130,13 +138,37 @@ static void mapper_cut_free(mapper_t* pmapper, context_t* _) {
 	for (int i = 0; i < pstate->nregex; i++)
 		regfree(&pstate->regexes[i]);
 	free(pstate->regexes);
+	schema_cache_free(pstate->pschema_cache);
 	ap_free(pstate->pargp);
 	free(pstate);
 	free(pmapper);
 }
 
+// Cut looks only at field names, and outputs only fields it was given, so it
+// needs no input field which the rest of the chain doesn't.
+static hss_t* mapper_cut_input_fields(void* pvstate, hss_t* pdownstream_fields) {
+	mapper_cut_state_t* pstate = pvstate;
+	if (pstate->pfield_name_list != NULL && !pstate->do_complement) {
+		hss_t* pinput_fields = hss_alloc();
+		for (sllse_t* pe = pstate->pfield_name_list->phead; pe != NULL; pe = pe->pnext)
+			if (pdownstream_fields == NULL || hss_has(pdownstream_fields, pe->value))
+				hss_add(pinput_fields, pe->value);
+		return pinput_fields;
+	} else if (pdownstream_fields == NULL) {
+		return NULL;
+	} else {
+		hss_t* pinput_fields = hss_copy(pdownstream_fields);
+		if (pstate->pfield_name_list != NULL)
+			for (sllse_t* pe = pstate->pfield_name_list->phead; pe != NULL; pe = pe->pnext)
+				hss_remove(pinput_fields, pe->value);
+		return pinput_fields;
+	}
+}
+
 // ----------------------------------------------------------------
-static sllv_t* mapper_cut_process_no_regexes(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+static void mapper_cut_push_no_regexes(lrec_t* pinrec, context_t* pctx, void* pvstate,
+	mapper_emitter_t* pemitter)
+{
 	if (pinrec != NULL) {
 		mapper_cut_state_t* pstate = (mapper_cut_state_t*)pvstate;
 		if (!pstate->do_complement) {
@@ -159,35 +191,44 @@ static sllv_t* mapper_cut_process_no_regexes(lrec_t* pinrec, context_t* pctx, vo
 					lrec_move_to_head(pinrec, field_name);
 				}
 			}
-			return sllv_single(pinrec);
 		} else {
 			for (sllse_t* pe = pstate->pfield_name_list->phead; pe != NULL; pe = pe->pnext) {
 				char* field_name = pe->value;
 				lrec_remove(pinrec, field_name);
 			}
-			return sllv_single(pinrec);
 		}
 	}
-	else {
-		return sllv_single(NULL);
-	}
+	mapper_emit(pemitter, pinrec, pctx);
 }
 
 // ----------------------------------------------------------------
-static sllv_t* mapper_cut_process_with_regexes(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+static void mapper_cut_push_with_regexes(lrec_t* pinrec, context_t* pctx, void* pvstate,
+	mapper_emitter_t* pemitter)
+{
 	if (pinrec != NULL) {
 		mapper_cut_state_t* pstate = (mapper_cut_state_t*)pvstate;
-		// Loop over the record and free the fields to be discarded, being
-		// careful about the fact that we're modifying what we're looping over.
-		for (lrece_t* pe = pinrec->phead; pe != NULL; /* next in loop */) {
-			int matches_any = FALSE;
-			for (int i = 0; i < pstate->nregex; i++) {
-				if (regmatch_or_die(&pstate->regexes[i], pe->key, 0, NULL)) {
-					matches_any = TRUE;
-					break;
+		char* pretain_flags = schema_cache_get(pstate->pschema_cache, pinrec);
+		if (pretain_flags == NULL) {
+			pretain_flags = mlr_malloc_or_die(pinrec->field_count + 1);
+			int j = 0;
+			for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext, j++) {
+				int matches_any = FALSE;
+				for (int i = 0; i < pstate->nregex; i++) {
+					if (regmatch_or_die(&pstate->regexes[i], pe->key, 0, NULL)) {
+						matches_any = TRUE;
+						break;
+					}
 				}
+				pretain_flags[j] = matches_any ^ pstate->do_complement;
 			}
-			if (matches_any ^ pstate->do_complement) {
+			schema_cache_put(pstate->pschema_cache, pretain_flags);
+		}
+
+		// Loop over the record and free the fields to be discarded, being
+		// careful about the fact that we're modifying what we're looping over.
+		int j = 0;
+		for (lrece_t* pe = pinrec->phead; pe != NULL; j++) {
+			if (pretain_flags[j]) {
 				pe = pe->pnext;
 			} else {
 				lrece_t* pf = pe->pnext;
@@ -195,9 +236,6 @@ static sllv_t* mapper_cut_process_with_regexes(lrec_t* pinrec, context_t* pctx,
 				pe = pf;
 			}
 		}
-		return sllv_single(pinrec);
-	}
-	else {
-		return sllv_single(NULL);
 	}
+	mapper_emit(pemitter, pinrec, pctx);
 }
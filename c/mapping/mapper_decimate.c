@@ -71,7 +71,7 @@ static mapper_t* mapper_decimate_parse_cli(int* pargi, int argc, char** argv,
 static mapper_t* mapper_decimate_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_names,
 	unsigned long long decimate_count, int keep_last)
 {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_decimate_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_decimate_state_t));
 
@@ -25,6 +25,7 @@ typedef struct _mapper_fraction_state_t {
 	char* output_field_name_suffix; // "_fraction" or "_percent"
 	mv_t multiplier; // 1.0 for fraction or 100.0 for percent
 	mv_t zero;
+	int is_two_pass;
 } mapper_fraction_state_t;
 
 static void      mapper_fraction_usage(FILE* o, char* argv0, char* verb);
@@ -34,6 +35,9 @@ static mapper_t* mapper_fraction_alloc(ap_state_t* pargp, slls_t* pfraction_fiel
 	int do_percents, int do_cumu);
 static void      mapper_fraction_free(mapper_t* pmapper, context_t* _);
 static sllv_t*   mapper_fraction_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static void      mapper_fraction_first_pass(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static void      mapper_fraction_accumulate(lrec_t* pinrec, mapper_fraction_state_t* pstate);
+static void      mapper_fraction_decorate(lrec_t* poutrec, mapper_fraction_state_t* pstate);
 
 // ----------------------------------------------------------------
 mapper_setup_t mapper_fraction_setup = {
@@ -54,6 +58,8 @@ static void mapper_fraction_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "Note: this is internally a two-pass algorithm: on the first pass it retains\n");
 	fprintf(o, "input records and accumulates sums; on the second pass it computes quotients\n");
 	fprintf(o, "and emits output records. This means it produces no output until all input is read.\n");
+	fprintf(o, "When it's the first verb and the input is regular files, the files are instead\n");
+	fprintf(o, "read twice, and input records aren't retained.\n");
 	fprintf(o, "\n");
 	fprintf(o, "Options:\n");
 	fprintf(o, "-f {a,b,c}    Field name(s) for fraction calculation\n");
@@ -100,7 +106,7 @@ static mapper_t* mapper_fraction_parse_cli(int* pargi, int argc, char** argv,
 static mapper_t* mapper_fraction_alloc(ap_state_t* pargp, slls_t* pfraction_field_names, slls_t* pgroup_by_field_names,
 	int do_percents, int do_cumu)
 {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_fraction_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_fraction_state_t));
 
@@ -119,10 +125,12 @@ static mapper_t* mapper_fraction_alloc(ap_state_t* pargp, slls_t* pfraction_fiel
 	}
 	pstate->do_cumu = do_cumu;
 	pstate->zero    = mv_from_int(0);
+	pstate->is_two_pass = FALSE;
 
 	pmapper->pvstate       = pstate;
 	pmapper->pprocess_func = mapper_fraction_process;
 	pmapper->pfree_func    = mapper_fraction_free;
+	pmapper->pfirst_pass_func        = mapper_fraction_first_pass;
 
 	return pmapper;
 }
@@ -158,100 +166,119 @@ static void mapper_fraction_free(mapper_t* pmapper, context_t* _) {
 // ----------------------------------------------------------------
 static sllv_t* mapper_fraction_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	mapper_fraction_state_t* pstate = pvstate;
-	if (pinrec != NULL) { // Not end of stream; pass 1
+	if (pstate->is_two_pass) {
+		// Second of two passes over the input: sums are already known.
+		if (pinrec != NULL)
+			mapper_fraction_decorate(pinrec, pstate);
+		return sllv_single(pinrec);
+	}
 
+	if (pinrec != NULL) { // Not end of stream; pass 1
 		// Append records into a single output list (so that this verb is order-preserving).
 		sllv_append(pstate->precords, pinrec);
-
-		// Accumulate sums of fraction-field values grouped by group-by field names
-		slls_t* pgroup_by_field_values = mlr_reference_selected_values_from_record(pinrec,
-			pstate->pgroup_by_field_names);
-
-		if (pgroup_by_field_values != NULL) {
-			lhmsmv_t* psums_for_group = lhmslv_get(pstate->psums, pgroup_by_field_values);
-			lhmsmv_t* pcumus_for_group = NULL;
-			if (psums_for_group == NULL) {
-				psums_for_group = lhmsmv_alloc();
-				lhmslv_put(pstate->psums, slls_copy(pgroup_by_field_values),
-					psums_for_group, FREE_ENTRY_KEY);
-				pcumus_for_group = lhmsmv_alloc();
-				lhmslv_put(pstate->pcumus, slls_copy(pgroup_by_field_values),
-					pcumus_for_group, FREE_ENTRY_KEY);
-			}
-
-			for (sllse_t* pf = pstate->pfraction_field_names->phead; pf != NULL; pf = pf->pnext) {
-				char* fraction_field_name = pf->value;
-				char* lrec_string_value = lrec_get(pinrec, fraction_field_name);
-				if (lrec_string_value != NULL) {
-					mv_t lrec_num_value = mv_scan_number_or_die(lrec_string_value);
-					mv_t* psum = lhmsmv_get(psums_for_group, fraction_field_name);
-					if (psum == NULL) { // First value for group
-						lhmsmv_put(psums_for_group, fraction_field_name, &lrec_num_value, FREE_ENTRY_VALUE);
-						lhmsmv_put(pcumus_for_group, fraction_field_name, &pstate->zero, FREE_ENTRY_VALUE);
-					} else {
-						*psum = x_xx_plus_func(psum, &lrec_num_value);
-					}
-				}
-			}
-
-			slls_free(pgroup_by_field_values);
-		}
-
+		mapper_fraction_accumulate(pinrec, pstate);
 		return NULL;
 
 	} else { // End of stream; pass 2
 		sllv_t* poutrecs = sllv_alloc();
-
 		// Iterate over the retained records, decorating them with fraction fields.
 		while (pstate->precords->phead != NULL) {
 			lrec_t* poutrec = sllv_pop(pstate->precords);
+			mapper_fraction_decorate(poutrec, pstate);
+			sllv_append(poutrecs, poutrec);
+		}
+		sllv_append(poutrecs, NULL);
+		return poutrecs;
+	}
+}
+
+static void mapper_fraction_first_pass(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+	mapper_fraction_state_t* pstate = pvstate;
+	pstate->is_two_pass = TRUE;
+	if (pinrec != NULL) {
+		mapper_fraction_accumulate(pinrec, pstate);
+		lrec_free(pinrec);
+	}
+}
 
-			slls_t* pgroup_by_field_values = mlr_reference_selected_values_from_record(poutrec,
-				pstate->pgroup_by_field_names);
-			if (pgroup_by_field_values != NULL) {
-				lhmsmv_t* psums_for_group = lhmslv_get(pstate->psums, pgroup_by_field_values);
-				lhmsmv_t* pcumus_for_group = lhmslv_get(pstate->pcumus, pgroup_by_field_values);
-				MLR_INTERNAL_CODING_ERROR_IF(psums_for_group == NULL); // should have populated on pass 1
-				for (sllse_t* pf = pstate->pfraction_field_names->phead; pf != NULL; pf = pf->pnext) {
-					char* fraction_field_name = pf->value;
-					char* lrec_string_value = lrec_get(poutrec, fraction_field_name);
-					if (lrec_string_value != NULL) {
-						mv_t lrec_num_value = mv_scan_number_or_die(lrec_string_value);
-
-						mv_t numerator;
-						mv_t* pcumu = NULL;
-						if (pstate->do_cumu) {
-							pcumu = lhmsmv_get(pcumus_for_group, fraction_field_name);
-							numerator = x_xx_plus_func(&lrec_num_value, pcumu);
-						} else {
-							numerator = lrec_num_value;
-						}
-
-						mv_t* pdenominator = lhmsmv_get(psums_for_group, fraction_field_name);
-
-						mv_t output_value = mv_i_nn_ne(&lrec_num_value, &pstate->zero)
-							? x_xx_divide_func(&numerator, pdenominator)
-							: mv_error();
-						output_value = x_xx_times_func(&output_value, &pstate->multiplier);
-
-
-						lrec_put(poutrec,
-							mlr_paste_2_strings(fraction_field_name, pstate->output_field_name_suffix),
-							mv_alloc_format_val(&output_value),
-							FREE_ENTRY_KEY|FREE_ENTRY_VALUE);
-
-						if (pstate->do_cumu) {
-							*pcumu = x_xx_plus_func(pcumu, &lrec_num_value);
-						}
-					}
+// Accumulate sums of fraction-field values grouped by group-by field names
+static void mapper_fraction_accumulate(lrec_t* pinrec, mapper_fraction_state_t* pstate) {
+	slls_t* pgroup_by_field_values = mlr_reference_selected_values_from_record(pinrec,
+		pstate->pgroup_by_field_names);
+
+	if (pgroup_by_field_values != NULL) {
+		lhmsmv_t* psums_for_group = lhmslv_get(pstate->psums, pgroup_by_field_values);
+		lhmsmv_t* pcumus_for_group = NULL;
+		if (psums_for_group == NULL) {
+			psums_for_group = lhmsmv_alloc();
+			lhmslv_put(pstate->psums, slls_copy(pgroup_by_field_values),
+				psums_for_group, FREE_ENTRY_KEY);
+			pcumus_for_group = lhmsmv_alloc();
+			lhmslv_put(pstate->pcumus, slls_copy(pgroup_by_field_values),
+				pcumus_for_group, FREE_ENTRY_KEY);
+		} else {
+			pcumus_for_group = lhmslv_get(pstate->pcumus, pgroup_by_field_values);
+		}
+
+		for (sllse_t* pf = pstate->pfraction_field_names->phead; pf != NULL; pf = pf->pnext) {
+			char* fraction_field_name = pf->value;
+			char* lrec_string_value = lrec_get(pinrec, fraction_field_name);
+			if (lrec_string_value != NULL) {
+				mv_t lrec_num_value = mv_scan_number_or_die(lrec_string_value);
+				mv_t* psum = lhmsmv_get(psums_for_group, fraction_field_name);
+				if (psum == NULL) { // First value for group
+					lhmsmv_put(psums_for_group, fraction_field_name, &lrec_num_value, FREE_ENTRY_VALUE);
+					lhmsmv_put(pcumus_for_group, fraction_field_name, &pstate->zero, FREE_ENTRY_VALUE);
+				} else {
+					*psum = x_xx_plus_func(psum, &lrec_num_value);
 				}
-				slls_free(pgroup_by_field_values);
 			}
-
-			sllv_append(poutrecs, poutrec);
 		}
 
-		sllv_append(poutrecs, NULL);
-		return poutrecs;
+		slls_free(pgroup_by_field_values);
+	}
+}
+
+static void mapper_fraction_decorate(lrec_t* poutrec, mapper_fraction_state_t* pstate) {
+	slls_t* pgroup_by_field_values = mlr_reference_selected_values_from_record(poutrec,
+		pstate->pgroup_by_field_names);
+	if (pgroup_by_field_values != NULL) {
+		lhmsmv_t* psums_for_group = lhmslv_get(pstate->psums, pgroup_by_field_values);
+		lhmsmv_t* pcumus_for_group = lhmslv_get(pstate->pcumus, pgroup_by_field_values);
+		MLR_INTERNAL_CODING_ERROR_IF(psums_for_group == NULL); // should have populated on pass 1
+		for (sllse_t* pf = pstate->pfraction_field_names->phead; pf != NULL; pf = pf->pnext) {
+			char* fraction_field_name = pf->value;
+			char* lrec_string_value = lrec_get(poutrec, fraction_field_name);
+			if (lrec_string_value != NULL) {
+				mv_t lrec_num_value = mv_scan_number_or_die(lrec_string_value);
+
+				mv_t numerator;
+				mv_t* pcumu = NULL;
+				if (pstate->do_cumu) {
+					pcumu = lhmsmv_get(pcumus_for_group, fraction_field_name);
+					numerator = x_xx_plus_func(&lrec_num_value, pcumu);
+				} else {
+					numerator = lrec_num_value;
+				}
+
+				mv_t* pdenominator = lhmsmv_get(psums_for_group, fraction_field_name);
+
+				mv_t output_value = mv_i_nn_ne(&lrec_num_value, &pstate->zero)
+					? x_xx_divide_func(&numerator, pdenominator)
+					: mv_error();
+				output_value = x_xx_times_func(&output_value, &pstate->multiplier);
+
+
+				lrec_put(poutrec,
+					mlr_paste_2_strings(fraction_field_name, pstate->output_field_name_suffix),
+					mv_alloc_format_val(&output_value),
+					FREE_ENTRY_KEY|FREE_ENTRY_VALUE);
+
+				if (pstate->do_cumu) {
+					*pcumu = x_xx_plus_func(pcumu, &lrec_num_value);
+				}
+			}
+		}
+		slls_free(pgroup_by_field_values);
 	}
 }
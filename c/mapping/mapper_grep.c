@@ -9,7 +9,7 @@
 typedef struct _mapper_grep_state_t {
 	ap_state_t* pargp;
 	int exclude;
-	regex_t regex;
+	mlr_regex_t regex;
 	cli_writer_opts_t* pwriter_opts;
 } mapper_grep_state_t;
 
@@ -86,14 +86,14 @@ static void mapper_grep_usage(FILE* o, char* argv0, char* verb) {
 static mapper_t* mapper_grep_alloc(ap_state_t* pargp, char* regex_string, int exclude, int ignore_case,
 	cli_writer_opts_t* pwriter_opts)
 {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_grep_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_grep_state_t));
 	pstate->pargp = pargp;
 	int cflags = REG_NOSUB;
 	if (ignore_case)
 		cflags |= REG_ICASE;
-	regcomp_or_die_quoted(&pstate->regex, regex_string, cflags);
+	mlr_regcomp_or_die_quoted(&pstate->regex, regex_string, cflags);
 	pstate->exclude = exclude;
 	pstate->pwriter_opts = pwriter_opts;
 
@@ -104,7 +104,7 @@ static mapper_t* mapper_grep_alloc(ap_state_t* pargp, char* regex_string, int ex
 }
 static void mapper_grep_free(mapper_t* pmapper, context_t* _) {
 	mapper_grep_state_t* pstate = pmapper->pvstate;
-	regfree(&pstate->regex);
+	mlr_regfree(&pstate->regex);
 	ap_free(pstate->pargp);
 	free(pstate);
 	free(pmapper);
@@ -122,7 +122,7 @@ static sllv_t* mapper_grep_process(lrec_t* pinrec, context_t* pctx, void* pvstat
 		pstate->pwriter_opts->ofs,
 		pstate->pwriter_opts->ops);
 
-	int matches = regmatch_or_die(&pstate->regex, line, 0, NULL);
+	int matches = mlr_regmatch_or_die(&pstate->regex, line, 0, NULL);
 	sllv_t* poutrecs = NULL;
 	if (matches ^ pstate->exclude) {
 		poutrecs = sllv_single(pinrec);
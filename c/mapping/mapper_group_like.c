@@ -48,7 +48,7 @@ static mapper_t* mapper_group_like_parse_cli(int* pargi, int argc, char** argv,
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_group_like_alloc() {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_group_like_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_group_like_state_t));
 	pstate->precords_by_key_field_names = lhmslv_alloc();
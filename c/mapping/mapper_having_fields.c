@@ -4,6 +4,7 @@
 #include "containers/lrec.h"
 #include "containers/sllv.h"
 #include "containers/hss.h"
+#include "containers/schema_cache.h"
 #include "mapping/mappers.h"
 #include "cli/argparse.h"
 
@@ -20,7 +21,8 @@ typedef enum _criterion_t {
 typedef struct _mapper_having_fields_state_t {
 	slls_t* pfield_names;
 	hss_t*  pfield_name_set;
-	regex_t regex;
+	mlr_regex_t regex;
+	schema_cache_t* pschema_cache; // pass/fail by field names, for regexes
 } mapper_having_fields_state_t;
 
 static void      mapper_having_fields_usage(FILE* o, char* argv0, char* verb);
@@ -37,6 +39,9 @@ static sllv_t*   mapper_having_fields_at_most_process(lrec_t* pinrec, context_t*
 static sllv_t*   mapper_having_all_fields_matching_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
 static sllv_t*   mapper_having_any_fields_matching_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
 static sllv_t*   mapper_having_no_fields_matching_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
+typedef int      having_fields_matching_func_t(lrec_t* pinrec, mlr_regex_t* pregex);
+static sllv_t*   mapper_having_fields_matching_process(lrec_t* pinrec, mapper_having_fields_state_t* pstate,
+	having_fields_matching_func_t* pmatching_func);
 
 // ----------------------------------------------------------------
 mapper_setup_t mapper_having_fields_setup = {
@@ -144,7 +149,7 @@ static mapper_t* mapper_having_fields_parse_cli(int* pargi, int argc, char** arg
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_having_fields_alloc(slls_t* pfield_names, char* regex_string, criterion_t criterion) {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_having_fields_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_having_fields_state_t));
 
@@ -156,7 +161,8 @@ static mapper_t* mapper_having_fields_alloc(slls_t* pfield_names, char* regex_st
 
 		// Let them type in a.*b if they want, or "a.*b", or "a.*b"i.
 		// Strip off the leading " and trailing " or "i.
-		regcomp_or_die_quoted(&pstate->regex, regex_string, REG_NOSUB);
+		mlr_regcomp_or_die_quoted(&pstate->regex, regex_string, REG_NOSUB);
+		pstate->pschema_cache = schema_cache_alloc(free);
 
 		if (criterion == HAVING_ALL_FIELDS_MATCHING)
 			pmapper->pprocess_func = mapper_having_all_fields_matching_process;
@@ -169,7 +175,8 @@ static mapper_t* mapper_having_fields_alloc(slls_t* pfield_names, char* regex_st
 	} else {
 		pstate->pfield_names    = pfield_names;
 		pstate->pfield_name_set = hss_alloc();
-		regcomp_or_die(&pstate->regex, ".", 0);
+		mlr_regcomp_or_die(&pstate->regex, ".", 0);
+		pstate->pschema_cache   = NULL;
 		for (sllse_t* pe = pfield_names->phead; pe != NULL; pe = pe->pnext)
 			hss_add(pstate->pfield_name_set, pe->value);
 
@@ -191,7 +198,8 @@ static void mapper_having_fields_free(mapper_t* pmapper, context_t* _) {
 		slls_free(pstate->pfield_names);
 	if (pstate->pfield_name_set != NULL)
 		hss_free(pstate->pfield_name_set);
-	regfree(&pstate->regex);
+	mlr_regfree(&pstate->regex);
+	schema_cache_free(pstate->pschema_cache);
 	free(pstate);
 	free(pmapper);
 }
@@ -244,44 +252,52 @@ static sllv_t* mapper_having_fields_at_most_process(lrec_t* pinrec, context_t* p
 }
 
 // ----------------------------------------------------------------
+// Whether a record passes depends only on its field names, so the decision is made once per distinct schema.
+static sllv_t* mapper_having_fields_matching_process(lrec_t* pinrec, mapper_having_fields_state_t* pstate,
+	having_fields_matching_func_t* pmatching_func)
+{
+	char* ppasses = schema_cache_get(pstate->pschema_cache, pinrec);
+	if (ppasses == NULL) {
+		ppasses = mlr_malloc_or_die(sizeof(char));
+		*ppasses = pmatching_func(pinrec, &pstate->regex);
+		schema_cache_put(pstate->pschema_cache, ppasses);
+	}
+	if (*ppasses)
+		return sllv_single(pinrec);
+	lrec_free(pinrec);
+	return NULL;
+}
+
+// ----------------------------------------------------------------
+static int all_fields_match(lrec_t* pinrec, mlr_regex_t* pregex) {
+	for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext)
+		if (!mlr_regmatch_or_die(pregex, pe->key, 0, NULL))
+			return FALSE;
+	return TRUE;
+}
 static sllv_t* mapper_having_all_fields_matching_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	if (pinrec == NULL)
 		return sllv_single(NULL);
-	mapper_having_fields_state_t* pstate = (mapper_having_fields_state_t*)pvstate;
-
-	for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext) {
-		if (!regmatch_or_die(&pstate->regex, pe->key, 0, NULL)) {
-			lrec_free(pinrec);
-			return NULL;
-		}
-	}
-	return sllv_single(pinrec);
+	return mapper_having_fields_matching_process(pinrec, pvstate, all_fields_match);
 }
 
+static int any_fields_match(lrec_t* pinrec, mlr_regex_t* pregex) {
+	for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext)
+		if (mlr_regmatch_or_die(pregex, pe->key, 0, NULL))
+			return TRUE;
+	return FALSE;
+}
 static sllv_t* mapper_having_any_fields_matching_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	if (pinrec == NULL)
 		return sllv_single(NULL);
-	mapper_having_fields_state_t* pstate = (mapper_having_fields_state_t*)pvstate;
-
-	for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext) {
-		if (regmatch_or_die(&pstate->regex, pe->key, 0, NULL)) {
-			return sllv_single(pinrec);
-		}
-	}
-	lrec_free(pinrec);
-	return NULL;
+	return mapper_having_fields_matching_process(pinrec, pvstate, any_fields_match);
 }
 
+static int no_fields_match(lrec_t* pinrec, mlr_regex_t* pregex) {
+	return !any_fields_match(pinrec, pregex);
+}
 static sllv_t* mapper_having_no_fields_matching_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	if (pinrec == NULL)
 		return sllv_single(NULL);
-	mapper_having_fields_state_t* pstate = (mapper_having_fields_state_t*)pvstate;
-
-	for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext) {
-		if (regmatch_or_die(&pstate->regex, pe->key, 0, NULL)) {
-			lrec_free(pinrec);
-			return NULL;
-		}
-	}
-	return sllv_single(pinrec);
+	return mapper_having_fields_matching_process(pinrec, pvstate, no_fields_match);
 }
@@ -13,6 +13,7 @@
 typedef struct _mapper_head_state_t {
 	ap_state_t* pargp;
 	slls_t* pgroup_by_field_names;
+	string_array_t* pgroup_by_field_values; // scratch space used per-record
 	unsigned long long head_count;
 	unsigned long long unkeyed_record_count;
 	lhmslv_t* pcounts_by_group;
@@ -66,12 +67,13 @@ static mapper_t* mapper_head_parse_cli(int* pargi, int argc, char** argv,
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_head_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_names, unsigned long long head_count) {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_head_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_head_state_t));
 
 	pstate->pargp                  = pargp;
 	pstate->pgroup_by_field_names  = pgroup_by_field_names;
+	pstate->pgroup_by_field_values = string_array_alloc(pgroup_by_field_names->length);
 	pstate->head_count             = head_count;
 	pstate->unkeyed_record_count   = 0LL;
 	pstate->pcounts_by_group       = lhmslv_alloc();
@@ -89,6 +91,7 @@ static void mapper_head_free(mapper_t* pmapper, context_t* _) {
 	mapper_head_state_t* pstate = pmapper->pvstate;
 	if (pstate->pgroup_by_field_names != NULL)
 		slls_free(pstate->pgroup_by_field_names);
+	string_array_free(pstate->pgroup_by_field_values);
 	// lhmslv_free will free the hashmap keys; we need to free the void-star hashmap values.
 	for (lhmslve_t* pa = pstate->pcounts_by_group->phead; pa != NULL; pa = pa->pnext) {
 		unsigned long long* pcount_for_group = pa->pvvalue;
@@ -121,21 +124,20 @@ static sllv_t* mapper_head_process_unkeyed(lrec_t* pinrec, context_t* pctx, void
 static sllv_t* mapper_head_process_keyed(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	mapper_head_state_t* pstate = pvstate;
 	if (pinrec != NULL) {
-		slls_t* pgroup_by_field_values = mlr_reference_selected_values_from_record(pinrec,
-			pstate->pgroup_by_field_names);
-		if (pgroup_by_field_values == NULL) {
+		if (!mlr_reference_selected_values_from_record_into_array(pinrec,
+			pstate->pgroup_by_field_names, pstate->pgroup_by_field_values))
+		{
 			lrec_free(pinrec);
 			return NULL;
 		} else {
-			unsigned long long* pcount_for_group = lhmslv_get(pstate->pcounts_by_group,
-				pgroup_by_field_values);
+			unsigned long long* pcount_for_group = lhmslv_get_from_string_array(pstate->pcounts_by_group,
+				pstate->pgroup_by_field_values);
 			if (pcount_for_group == NULL) {
 				pcount_for_group = mlr_malloc_or_die(sizeof(unsigned long long));
 				*pcount_for_group = 0LL;
-				lhmslv_put(pstate->pcounts_by_group, slls_copy(pgroup_by_field_values),
-					pcount_for_group, FREE_ENTRY_KEY);
+				lhmslv_put_copy_of_string_array(pstate->pcounts_by_group, pstate->pgroup_by_field_values,
+					pcount_for_group);
 			}
-			slls_free(pgroup_by_field_values);
 			(*pcount_for_group)++;
 			if (*pcount_for_group <= pstate->head_count) {
 				return sllv_single(pinrec);
@@ -9,6 +9,7 @@
 #include "containers/lhmslv.h"
 #include "containers/lhmsv.h"
 #include "containers/dvector.h"
+#include "containers/tdigest.h"
 #include "mapping/mappers.h"
 #include "cli/argparse.h"
 
@@ -23,14 +24,18 @@ typedef struct _mapper_histogram_state_t {
 	double mul;
 	lhmsv_t* pcounts_by_field;
 	lhmsv_t* pvectors_by_field; // For auto-mode
+	lhmsv_t* pdigests_by_field; // For auto-mode with --approx
 	char*  output_prefix;
+	// For auto-mode reading the input twice: limits from the first pass
+	int    is_two_pass;
+	int    have_lo_hi;
 } mapper_histogram_state_t;
 
 static void      mapper_histogram_usage(FILE* o, char* argv0, char* verb);
 static mapper_t* mapper_histogram_parse_cli(int* pargi, int argc, char** argv,
 	cli_reader_opts_t* _, cli_writer_opts_t* __);
 static mapper_t* mapper_histogram_alloc(ap_state_t* pargp, slls_t* value_field_names, double lo, int nbins, double hi,
-	int do_auto, char* output_prefix);
+	int do_auto, int do_approx, double approx_compression, char* output_prefix);
 static void      mapper_histogram_free(mapper_t* pmapper, context_t* _);
 
 static void      mapper_histogram_ingest(lrec_t* pinrec, mapper_histogram_state_t* pstate);
@@ -40,6 +45,8 @@ static sllv_t*   mapper_histogram_process(lrec_t* pinrec, context_t* pctx, void*
 static void      mapper_histogram_ingest_auto(lrec_t* pinrec, mapper_histogram_state_t* pstate);
 static sllv_t*   mapper_histogram_emit_auto(mapper_histogram_state_t* pstate);
 static sllv_t*   mapper_histogram_process_auto(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static sllv_t*   mapper_histogram_emit_auto_bins(mapper_histogram_state_t* pstate, double lo, double mul);
+static void      mapper_histogram_first_pass_auto(lrec_t* pinrec, context_t* pctx, void* pvstate);
 
 // ----------------------------------------------------------------
 mapper_setup_t mapper_histogram_setup = {
@@ -57,7 +64,14 @@ static void mapper_histogram_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "--hi {hi}     Histogram high value\n");
 	fprintf(o, "--nbins {n}   Number of histogram bins\n");
 	fprintf(o, "--auto        Automatically computes limits, ignoring --lo and --hi.\n");
-	fprintf(o, "              Holds all values in memory before producing any output.\n");
+	fprintf(o, "              Holds all values in memory before producing any output, unless\n");
+	fprintf(o, "              it's the first verb and the input is regular files: then the\n");
+	fprintf(o, "              files are read twice.\n");
+	fprintf(o, "--approx      With --auto, keeps a t-digest per field rather than all values.\n");
+	fprintf(o, "              Memory use is bounded; bin counts are approximate, except for\n");
+	fprintf(o, "              small inputs where they are exact.\n");
+	fprintf(o, "--compression {n} Accuracy for --approx: higher is more accurate, and uses\n");
+	fprintf(o, "              more memory. Default %d.\n", (int)TDIGEST_DEFAULT_COMPRESSION);
 	fprintf(o, "-o {prefix}   Prefix for output field name. Default: no prefix.\n");
 	fprintf(o, "Just a histogram. Input values < lo or > hi are not counted.\n");
 }
@@ -70,6 +84,8 @@ static mapper_t* mapper_histogram_parse_cli(int* pargi, int argc, char** argv,
 	double hi = 0.0;
 	int nbins = 0;
 	int do_auto = FALSE;
+	int do_approx = FALSE;
+	double approx_compression = TDIGEST_DEFAULT_COMPRESSION;
 	char* output_prefix = NULL;
 
 	char* verb = argv[(*pargi)++];
@@ -80,6 +96,8 @@ static mapper_t* mapper_histogram_parse_cli(int* pargi, int argc, char** argv,
 	ap_define_float_flag(pstate, "--hi",     &hi);
 	ap_define_int_flag(pstate,   "--nbins",  &nbins);
 	ap_define_true_flag(pstate,  "--auto",   &do_auto);
+	ap_define_true_flag(pstate,  "--approx", &do_approx);
+	ap_define_float_flag(pstate, "--compression", &approx_compression);
 	ap_define_string_flag(pstate,  "-o",     &output_prefix);
 
 	if (!ap_parse(pstate, verb, pargi, argc, argv)) {
@@ -102,14 +120,20 @@ static mapper_t* mapper_histogram_parse_cli(int* pargi, int argc, char** argv,
 		return NULL;
 	}
 
-	return mapper_histogram_alloc(pstate, value_field_names, lo, nbins, hi, do_auto, output_prefix);
+	if (do_approx && !do_auto) {
+		mapper_histogram_usage(stderr, argv[0], verb);
+		return NULL;
+	}
+
+	return mapper_histogram_alloc(pstate, value_field_names, lo, nbins, hi, do_auto, do_approx, approx_compression,
+		output_prefix);
 }
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_histogram_alloc(ap_state_t* pargp, slls_t* value_field_names,
-	double lo, int nbins, double hi, int do_auto, char* output_prefix)
+	double lo, int nbins, double hi, int do_auto, int do_approx, double approx_compression, char* output_prefix)
 {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_histogram_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_histogram_state_t));
 
@@ -124,7 +148,16 @@ static mapper_t* mapper_histogram_alloc(ap_state_t* pargp, slls_t* value_field_n
 			pcounts[i] = 0LL;
 		lhmsv_put(pstate->pcounts_by_field, value_field_name, pcounts, NO_FREE);
 	}
-	if (do_auto) {
+	pstate->pvectors_by_field = NULL;
+	pstate->pdigests_by_field = NULL;
+	if (do_auto && do_approx) {
+		pstate->pdigests_by_field = lhmsv_alloc();
+		for (sllse_t* pe = pstate->value_field_names->phead; pe != NULL; pe = pe->pnext) {
+			char* value_field_name = pe->value;
+			tdigest_t* pdigest = tdigest_alloc(approx_compression);
+			lhmsv_put(pstate->pdigests_by_field, value_field_name, pdigest, NO_FREE);
+		}
+	} else if (do_auto) {
 		pstate->pvectors_by_field = lhmsv_alloc();
 		for (sllse_t* pe = pstate->value_field_names->phead; pe != NULL; pe = pe->pnext) {
 			char* value_field_name = pe->value;
@@ -132,16 +165,19 @@ static mapper_t* mapper_histogram_alloc(ap_state_t* pargp, slls_t* value_field_n
 			lhmsv_put(pstate->pvectors_by_field, value_field_name, pvector, NO_FREE);
 		}
 	} else {
-		pstate->pvectors_by_field = NULL;
 		pstate->lo  = lo;
 		pstate->hi  = hi;
 		pstate->mul = nbins / (hi - lo);
 	}
 	pstate->output_prefix = output_prefix;
+	pstate->is_two_pass = FALSE;
+	pstate->have_lo_hi = FALSE;
 
 	pmapper->pvstate       = pstate;
 	pmapper->pprocess_func = do_auto ? mapper_histogram_process_auto : mapper_histogram_process;
 	pmapper->pfree_func    = mapper_histogram_free;
+	// The approximate mode's memory use is already bounded.
+	pmapper->pfirst_pass_func        = (do_auto && !do_approx) ? mapper_histogram_first_pass_auto : NULL;
 
 	return pmapper;
 }
@@ -163,6 +199,13 @@ static void mapper_histogram_free(mapper_t* pmapper, context_t* _) {
 		}
 		lhmsv_free(pstate->pvectors_by_field);
 	}
+	if (pstate->pdigests_by_field != NULL) {
+		for (lhmsve_t* pe = pstate->pdigests_by_field->phead; pe != NULL; pe = pe->pnext) {
+			tdigest_t* pdigest = pe->pvvalue;
+			tdigest_free(pdigest);
+		}
+		lhmsv_free(pstate->pdigests_by_field);
+	}
 	ap_free(pstate->pargp);
 	free(pstate);
 	free(pmapper);
@@ -254,6 +297,15 @@ static sllv_t* mapper_histogram_emit(mapper_histogram_state_t* pstate) {
 // ----------------------------------------------------------------
 static sllv_t* mapper_histogram_process_auto(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	mapper_histogram_state_t* pstate = pvstate;
+	if (pstate->is_two_pass) {
+		// Second of two passes over the input: the limits are already known.
+		if (pinrec != NULL) {
+			mapper_histogram_ingest(pinrec, pstate);
+			lrec_free(pinrec);
+			return NULL;
+		}
+		return mapper_histogram_emit_auto_bins(pstate, pstate->lo, pstate->mul);
+	}
 	if (pinrec != NULL) {
 		mapper_histogram_ingest_auto(pinrec, pstate);
 		lrec_free(pinrec);
@@ -264,13 +316,80 @@ static sllv_t* mapper_histogram_process_auto(lrec_t* pinrec, context_t* pctx, vo
 	}
 }
 
+static void mapper_histogram_first_pass_auto(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+	mapper_histogram_state_t* pstate = pvstate;
+	pstate->is_two_pass = TRUE;
+	if (pinrec == NULL) {
+		if (!pstate->have_lo_hi) {
+			pstate->lo = 0.0;
+			pstate->hi = 1.0;
+		}
+		pstate->mul = pstate->nbins / (pstate->hi - pstate->lo);
+		return;
+	}
+	for (sllse_t* pe = pstate->value_field_names->phead; pe != NULL; pe = pe->pnext) {
+		char* strv = lrec_get(pinrec, pe->value);
+		if (strv != NULL) {
+			double val = mlr_double_from_string_or_die(strv);
+			if (pstate->have_lo_hi) {
+				if (pstate->lo > val)
+					pstate->lo = val;
+				if (pstate->hi < val)
+					pstate->hi = val;
+			} else {
+				pstate->lo = val;
+				pstate->hi = val;
+				pstate->have_lo_hi = TRUE;
+			}
+		}
+	}
+	lrec_free(pinrec);
+}
+
 static void mapper_histogram_ingest_auto(lrec_t* pinrec, mapper_histogram_state_t* pstate) {
 	for (sllse_t* pe = pstate->value_field_names->phead; pe != NULL; pe = pe->pnext) {
 		char* value_field_name = pe->value;
 		char* strv = lrec_get(pinrec, value_field_name);
-		dvector_t* pvector = lhmsv_get(pstate->pvectors_by_field, value_field_name);
 		if (strv != NULL) {
-			dvector_append(pvector, mlr_double_from_string_or_die(strv));
+			if (pstate->pdigests_by_field != NULL) {
+				tdigest_t* pdigest = lhmsv_get(pstate->pdigests_by_field, value_field_name);
+				tdigest_ingest(pdigest, mlr_double_from_string_or_die(strv));
+			} else {
+				dvector_t* pvector = lhmsv_get(pstate->pvectors_by_field, value_field_name);
+				dvector_append(pvector, mlr_double_from_string_or_die(strv));
+			}
+		}
+	}
+}
+
+// While the digest is exact its centroids are the values, which are binned as
+// in the non-approximate case. Otherwise bin counts come from differences of
+// the digest's CDF at the bin boundaries, rounded so that they sum to the total.
+static void mapper_histogram_bin_digest(tdigest_t* pdigest, double lo, double hi, int nbins, double mul,
+	unsigned long long* pcounts)
+{
+	if (tdigest_is_exact(pdigest)) {
+		for (int i = 0; i < pdigest->num_centroids; i++) {
+			double val = pdigest->centroids[i].mean;
+			if ((val >= lo) && (val < hi)) {
+				int idx = (int)((val-lo) * mul);
+				pcounts[idx]++;
+			} else if (val == hi) {
+				int idx = nbins - 1;
+				pcounts[idx]++;
+			}
+		}
+	} else {
+		double total = tdigest_count(pdigest);
+		unsigned long long prev = 0LL;
+		for (int i = 0; i < nbins; i++) {
+			unsigned long long next = (i == nbins - 1)
+				? (unsigned long long)total
+				: (unsigned long long)llround(total * tdigest_cdf(pdigest, lo + (i+1) / mul));
+			if (next < prev)
+				next = prev;
+			pcounts[i] = next - prev;
+			prev = next;
 		}
 	}
 }
@@ -283,6 +402,22 @@ static sllv_t* mapper_histogram_emit_auto(mapper_histogram_state_t* pstate) {
 	// Limits pass
 	for (sllse_t* pe = pstate->value_field_names->phead; pe != NULL; pe = pe->pnext) {
 		char* value_field_name = pe->value;
+		if (pstate->pdigests_by_field != NULL) {
+			tdigest_t* pdigest = lhmsv_get(pstate->pdigests_by_field, value_field_name);
+			if (tdigest_count(pdigest) == 0.0)
+				continue;
+			if (have_lo_hi) {
+				if (lo > pdigest->min)
+					lo = pdigest->min;
+				if (hi < pdigest->max)
+					hi = pdigest->max;
+			} else {
+				lo = pdigest->min;
+				hi = pdigest->max;
+				have_lo_hi = TRUE;
+			}
+			continue;
+		}
 		dvector_t* pvector = lhmsv_get(pstate->pvectors_by_field, value_field_name);
 		int n = pvector->size;
 		for (int i = 0; i < n; i++) {
@@ -304,8 +439,13 @@ static sllv_t* mapper_histogram_emit_auto(mapper_histogram_state_t* pstate) {
 	double mul = nbins / (hi - lo);
 	for (sllse_t* pe = pstate->value_field_names->phead; pe != NULL; pe = pe->pnext) {
 		char* value_field_name = pe->value;
-		dvector_t* pvector = lhmsv_get(pstate->pvectors_by_field, value_field_name);
 		unsigned long long* pcounts = lhmsv_get(pstate->pcounts_by_field, value_field_name);
+		if (pstate->pdigests_by_field != NULL) {
+			tdigest_t* pdigest = lhmsv_get(pstate->pdigests_by_field, value_field_name);
+			mapper_histogram_bin_digest(pdigest, lo, hi, nbins, mul, pcounts);
+			continue;
+		}
+		dvector_t* pvector = lhmsv_get(pstate->pvectors_by_field, value_field_name);
 		int n = pvector->size;
 		for (int i = 0; i < n; i++) {
 			double val = pvector->data[i];
@@ -319,7 +459,11 @@ static sllv_t* mapper_histogram_emit_auto(mapper_histogram_state_t* pstate) {
 		}
 	}
 
-	// Emission pass
+	return mapper_histogram_emit_auto_bins(pstate, lo, mul);
+}
+
+static sllv_t* mapper_histogram_emit_auto_bins(mapper_histogram_state_t* pstate, double lo, double mul) {
+	int nbins = pstate->nbins;
 	sllv_t* poutrecs = sllv_alloc();
 	lhmss_t* pcount_field_names = lhmss_alloc();
 	for (sllse_t* pe = pstate->value_field_names->phead; pe != NULL; pe = pe->pnext) {
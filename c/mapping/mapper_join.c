@@ -1,3 +1,4 @@
+#include <pthread.h>
 #include "lib/mlr_globals.h"
 #include "lib/mlrutil.h"
 #include "containers/lrec.h"
@@ -5,9 +6,21 @@
 #include "containers/lhmslv.h"
 #include "containers/mixutil.h"
 #include "containers/join_bucket_keeper.h"
+#include "containers/spill_file.h"
 #include "mapping/mappers.h"
 #include "input/lrec_readers.h"
 
+// For unsorted input past --max-mem: the number of on-disk partitions for each
+// input, and how many times a partition which is still too big may itself be
+// partitioned. (Records with the same join-field values always land in the same
+// partition, so for skewed keys repartitioning can't help indefinitely.)
+#define NUM_SPILL_PARTITIONS 64
+#define MAX_SPILL_DEPTH      2
+
+// For unsorted input with --threads: right records are probed in batches of
+// this many per thread.
+#define PROBE_BATCH_SIZE_PER_THREAD 1024
+
 // ----------------------------------------------------------------
 typedef struct _mapper_join_opts_t {
 	char*    left_prefix;
@@ -22,6 +35,8 @@ typedef struct _mapper_join_opts_t {
 	int      emit_pairables;
 	int      emit_left_unpairables;
 	int      emit_right_unpairables;
+	double   max_left_bytes; // For unsorted input; zero for no limit
+	int      num_threads;    // For unsorted input
 
 	char*    prepipe;
 	char*    left_file_name;
@@ -43,10 +58,37 @@ typedef struct _mapper_join_state_t {
 
 	// For unsorted input
 	lhmslv_t* pleft_buckets_by_join_field_values;
+	string_array_t* pright_field_values; // Scratch space used per-record
 	sllv_t*   pleft_unpaired_records;
 
+	// For unsorted input once the left file has gone past --max-mem. Both inputs
+	// are partitioned to disk by hash of join-field values, and the partitions
+	// are joined pairwise at end of stream. This is a Grace hash join.
+	spill_file_t** pleft_partitions;  // NULL unless spilled
+	spill_file_t** pright_partitions;
+	spill_file_t*  pleft_unpaired_spill;
+
+	// For unsorted input with --threads. Right records are held until there's a
+	// batch of them, which is split into contiguous runs, one per thread, to be
+	// probed against the left buckets. The left buckets aren't modified while
+	// probing, except for was_paired flags. Each thread's output goes to its own
+	// list, and the lists are concatenated in order, so output order is the
+	// same as for a single thread.
+	lrec_t**            pright_batch; // NULL unless multithreaded
+	int                 right_batch_size;
+	int                 right_batch_capacity;
+	struct _join_probe_task_t* probe_tasks;
+	pthread_t*          probe_threads;
+
 } mapper_join_state_t;
 
+typedef struct _join_probe_task_t {
+	mapper_join_state_t* pstate;
+	lrec_t**             pright_recs;
+	int                  num_right_recs;
+	sllv_t*              pout_recs;
+} join_probe_task_t;
+
 // ----------------------------------------------------------------
 static void mapper_join_usage(FILE* o, char* argv0, char* verb);
 static mapper_t* mapper_join_parse_cli(int* pargi, int argc, char** argv,
@@ -57,7 +99,25 @@ static void ingest_left_file(mapper_join_state_t* pstate);
 static void mapper_join_form_pairs(sllv_t* pleft_records, lrec_t* pright_rec, mapper_join_state_t* pstate,
 	sllv_t* pout_recs);
 static sllv_t* mapper_join_process_sorted(lrec_t* pright_rec, context_t* pctx, void* pvstate);
-static sllv_t* mapper_join_process_unsorted(lrec_t* pright_rec, context_t* pctx, void* pvstate);
+static void mapper_join_push_unsorted(lrec_t* pright_rec, context_t* pctx, void* pvstate,
+	mapper_emitter_t* pemitter);
+static sllv_t* mapper_join_process_unsorted(lrec_t* pright_rec, mapper_join_state_t* pstate);
+static void mapper_join_push_spilled(lrec_t* pright_rec, context_t* pctx, mapper_join_state_t* pstate,
+	mapper_emitter_t* pemitter);
+static void mapper_join_partition_pair(mapper_join_state_t* pstate, spill_file_t* pleft_partition,
+	spill_file_t* pright_partition, int depth, context_t* pctx, mapper_emitter_t* pemitter);
+static void mapper_join_emit_outrecs(sllv_t* poutrecs, context_t* pctx, mapper_emitter_t* pemitter);
+static void free_left_buckets(lhmslv_t* pleft_buckets_by_join_field_values);
+static void mapper_join_probe(mapper_join_state_t* pstate, string_array_t* pright_field_values,
+	lrec_t* pright_rec, sllv_t* pout_recs);
+static sllv_t* mapper_join_probe_batch(mapper_join_state_t* pstate);
+static int bucket_left_record(lhmslv_t* pleft_buckets_by_join_field_values, slls_t* pleft_join_field_names,
+	string_array_t* pleft_field_values, lrec_t* pleft_rec);
+static long long estimated_lrec_bytes(lrec_t* prec);
+static long long estimated_bucket_bytes(string_array_t* pfield_values);
+static int partition_of(int hash, int depth);
+static void write_to_partition(spill_file_t** partitions, int hash, int depth, lrec_t* prec);
+static void spill_left_records(mapper_join_state_t* pstate);
 
 mapper_setup_t mapper_join_setup = {
 	.verb = "join",
@@ -93,6 +153,16 @@ static void mapper_join_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "               file which is too big to fit into system memory otherwise.\n");
 	fprintf(o, "  -u           Enable unsorted input. (This is the default even without -u.)\n");
 	fprintf(o, "               In this case, the entire left file will be loaded into memory.\n");
+	fprintf(o, "  --max-mem {megabytes} For unsorted input: if the left file takes more than\n");
+	fprintf(o, "               about this much memory, partition both inputs by join-field\n");
+	fprintf(o, "               values into temporary files (in $TMPDIR, else /tmp), and\n");
+	fprintf(o, "               join them partition by partition at end of stream. Output\n");
+	fprintf(o, "               order then differs from that without --max-mem. Default: no\n");
+	fprintf(o, "               limit.\n");
+	fprintf(o, "  --threads {n} For unsorted input: look up right records in the left file,\n");
+	fprintf(o, "               and form paired records, using this many threads. Output\n");
+	fprintf(o, "               order is unaffected. Not used once --max-mem has spilled to\n");
+	fprintf(o, "               disk. Default 1.\n");
 
 	fprintf(o, "  --prepipe {command} As in main input options; see %s --help for details.\n",
 		MLR_GLOBALS.bargv0);
@@ -137,6 +207,8 @@ static mapper_t* mapper_join_parse_cli(int* pargi, int argc, char** argv,
 	popts->emit_left_unpairables               = FALSE;
 	popts->emit_right_unpairables              = FALSE;
 	popts->allow_unsorted_input                = TRUE;
+	popts->max_left_bytes                      = 0.0;
+	popts->num_threads                         = 1;
 
 	int argi = *pargi;
 	char* verb = argv[argi++];
@@ -224,6 +296,26 @@ static mapper_t* mapper_join_parse_cli(int* pargi, int argc, char** argv,
 			popts->allow_unsorted_input = TRUE;
 			argi += 1;
 
+		} else if (streq(argv[argi], "--max-mem")) {
+			if ((argc - argi) < 2) {
+				mapper_join_usage(stderr, argv[0], verb);
+				return NULL;
+			}
+			popts->max_left_bytes = mlr_double_from_string_or_die(argv[argi+1]) * 1024.0 * 1024.0;
+			argi += 2;
+
+		} else if (streq(argv[argi], "--threads")) {
+			if ((argc - argi) < 2) {
+				mapper_join_usage(stderr, argv[0], verb);
+				return NULL;
+			}
+			popts->num_threads = mlr_int_from_string_or_die(argv[argi+1]);
+			if (popts->num_threads < 1) {
+				mapper_join_usage(stderr, argv[0], verb);
+				return NULL;
+			}
+			argi += 2;
+
 		} else if (streq(argv[argi], "--sorted-input") || streq(argv[argi], "-s")) {
 			popts->allow_unsorted_input = FALSE;
 			argi += 1;
@@ -284,7 +376,7 @@ static mapper_t* mapper_join_parse_cli(int* pargi, int argc, char** argv,
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_join_alloc(mapper_join_opts_t* popts) {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_join_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_join_state_t));
 	pstate->popts                              = popts;
@@ -299,10 +391,25 @@ static mapper_t* mapper_join_alloc(mapper_join_opts_t* popts) {
 
 	pstate->pleft_buckets_by_join_field_values = NULL;
 	pstate->pleft_unpaired_records             = NULL;
+	pstate->pright_field_values                = string_array_alloc(popts->pright_join_field_names->length);
+	pstate->pleft_partitions                   = NULL;
+	pstate->pright_partitions                  = NULL;
+	pstate->pleft_unpaired_spill               = NULL;
+	pstate->pright_batch                       = NULL;
+	pstate->right_batch_size                   = 0;
+	pstate->right_batch_capacity               = 0;
+	pstate->probe_tasks                        = NULL;
+	pstate->probe_threads                      = NULL;
+	if (popts->allow_unsorted_input && popts->num_threads > 1) {
+		pstate->right_batch_capacity = popts->num_threads * PROBE_BATCH_SIZE_PER_THREAD;
+		pstate->pright_batch  = mlr_malloc_or_die(pstate->right_batch_capacity * sizeof(lrec_t*));
+		pstate->probe_tasks   = mlr_malloc_or_die(popts->num_threads * sizeof(join_probe_task_t));
+		pstate->probe_threads = mlr_malloc_or_die(popts->num_threads * sizeof(pthread_t));
+	}
 
 	pmapper->pvstate = (void*)pstate;
 	if (popts->allow_unsorted_input) {
-		pmapper->pprocess_func = mapper_join_process_unsorted;
+		pmapper->ppush_func = mapper_join_push_unsorted;
 	} else {
 		pmapper->pprocess_func = mapper_join_process_sorted;
 	}
@@ -315,18 +422,15 @@ static mapper_t* mapper_join_alloc(mapper_join_opts_t* popts) {
 static void mapper_join_free(mapper_t* pmapper, context_t* _) {
 	mapper_join_state_t* pstate = pmapper->pvstate;
 
-	if (pstate->pleft_buckets_by_join_field_values != NULL) {
-		for (lhmslve_t* pe = pstate->pleft_buckets_by_join_field_values->phead; pe != NULL; pe = pe->pnext) {
-			join_bucket_t* pbucket = pe->pvvalue;
-			slls_free(pbucket->pleft_field_values);
-			if (pbucket->precords)
-				while (pbucket->precords->phead)
-					lrec_free(sllv_pop(pbucket->precords));
-			sllv_free(pbucket->precords);
-			free(pbucket);
-		}
-		lhmslv_free(pstate->pleft_buckets_by_join_field_values);
-	}
+	if (pstate->pleft_buckets_by_join_field_values != NULL)
+		free_left_buckets(pstate->pleft_buckets_by_join_field_values);
+	string_array_free(pstate->pright_field_values);
+	// The partitions themselves are freed as they're joined.
+	free(pstate->pleft_partitions);
+	free(pstate->pright_partitions);
+	free(pstate->pright_batch);
+	free(pstate->probe_tasks);
+	free(pstate->probe_threads);
 
 	// The void-star payload, which is lrec_t*'s, should have been sllv_transferred out.
 	// Misses should be detected by valgrind --leak-check=full, e.g. reg_test/run --valgrind.
@@ -412,7 +516,11 @@ static sllv_t* mapper_join_process_sorted(lrec_t* pright_rec, context_t* pctx, v
 }
 
 // ----------------------------------------------------------------
-static sllv_t* mapper_join_process_unsorted(lrec_t* pright_rec, context_t* pctx, void* pvstate) {
+// Unsorted input is push-style so that once the left file has spilled to disk, each partition's output can go
+// downstream as soon as that partition is joined, rather than all of it being held until end of stream.
+static void mapper_join_push_unsorted(lrec_t* pright_rec, context_t* pctx, void* pvstate,
+	mapper_emitter_t* pemitter)
+{
 	mapper_join_state_t* pstate = (mapper_join_state_t*)pvstate;
 
 	if (pstate->pleft_unpaired_records == NULL) // First call
@@ -423,9 +531,28 @@ static sllv_t* mapper_join_process_unsorted(lrec_t* pright_rec, context_t* pctx,
 	if (pstate->pleft_buckets_by_join_field_values == NULL) // First call
 		ingest_left_file(pstate);
 
+	if (pstate->pleft_partitions != NULL)
+		mapper_join_push_spilled(pright_rec, pctx, pstate, pemitter);
+	else
+		mapper_join_emit_outrecs(mapper_join_process_unsorted(pright_rec, pstate), pctx, pemitter);
+}
+
+// Takes ownership of the list, which may be NULL.
+static void mapper_join_emit_outrecs(sllv_t* poutrecs, context_t* pctx, mapper_emitter_t* pemitter) {
+	if (poutrecs == NULL)
+		return;
+	while (poutrecs->phead != NULL)
+		mapper_emit(pemitter, sllv_pop(poutrecs), pctx);
+	sllv_free(poutrecs);
+}
+
+// While the left file is all in memory.
+static sllv_t* mapper_join_process_unsorted(lrec_t* pright_rec, mapper_join_state_t* pstate) {
 	if (pright_rec == NULL) { // End of input record stream
+		sllv_t* poutrecs = (pstate->pright_batch != NULL) ? mapper_join_probe_batch(pstate) : NULL;
+		if (poutrecs == NULL)
+			poutrecs = sllv_alloc();
 		if (pstate->popts->emit_left_unpairables) {
-			sllv_t* poutrecs = sllv_alloc();
 			if (pstate->pleft_buckets_by_join_field_values != NULL) { // E.g. empty right input
 				for (lhmslve_t* pe = pstate->pleft_buckets_by_join_field_values->phead; pe != NULL; pe = pe->pnext) {
 					join_bucket_t* pbucket = pe->pvvalue;
@@ -435,48 +562,117 @@ static sllv_t* mapper_join_process_unsorted(lrec_t* pright_rec, context_t* pctx,
 				}
 			}
 			sllv_transfer(poutrecs, pstate->pleft_unpaired_records);
-			sllv_append(poutrecs, NULL);
-			return poutrecs;
 		} else {
 			while (pstate->pleft_unpaired_records->phead) {
 				lrec_t* prec = sllv_pop(pstate->pleft_unpaired_records);
 				lrec_free(prec);
 			}
-			return sllv_single(NULL);
 		}
+		sllv_append(poutrecs, NULL);
+		return poutrecs;
 	}
 
-	slls_t* pright_field_values = mlr_reference_selected_values_from_record(pright_rec,
-		pstate->popts->pright_join_field_names);
-	if (pright_field_values != NULL) {
-		join_bucket_t* pleft_bucket = lhmslv_get(pstate->pleft_buckets_by_join_field_values, pright_field_values);
-		slls_free(pright_field_values);
-		if (pleft_bucket == NULL) {
-			if (pstate->popts->emit_right_unpairables) {
-				return sllv_single(pright_rec);
-			} else {
-				lrec_free(pright_rec);
-				return NULL;
-			}
-		} else if (pstate->popts->emit_pairables) {
-			sllv_t* pout_recs = sllv_alloc();
-			pleft_bucket->was_paired = TRUE;
-			mapper_join_form_pairs(pleft_bucket->precords, pright_rec, pstate, pout_recs);
-			lrec_free(pright_rec);
-			return pout_recs;
-		} else {
-			pleft_bucket->was_paired = TRUE;
-			lrec_free(pright_rec);
+	if (pstate->pright_batch != NULL) {
+		pstate->pright_batch[pstate->right_batch_size++] = pright_rec;
+		if (pstate->right_batch_size < pstate->right_batch_capacity)
 			return NULL;
-		}
-	} else {
-		if (pstate->popts->emit_right_unpairables) {
-			return sllv_single(pright_rec);
-		} else {
+		return mapper_join_probe_batch(pstate);
+	}
+
+	sllv_t* pout_recs = sllv_alloc();
+	mapper_join_probe(pstate, pstate->pright_field_values, pright_rec, pout_recs);
+	if (pout_recs->length == 0) {
+		sllv_free(pout_recs);
+		return NULL;
+	}
+	return pout_recs;
+}
+
+// ----------------------------------------------------------------
+// Appends the output for one right record, and frees it unless it's emitted
+// as unpaired. This is called from the probe threads, so it mustn't touch
+// the state except to read it, and to set was_paired.
+static void mapper_join_probe(mapper_join_state_t* pstate, string_array_t* pright_field_values,
+	lrec_t* pright_rec, sllv_t* pout_recs)
+{
+	if (mlr_reference_selected_values_from_record_into_array(pright_rec,
+		pstate->popts->pright_join_field_names, pright_field_values))
+	{
+		join_bucket_t* pleft_bucket = lhmslv_get_from_string_array(pstate->pleft_buckets_by_join_field_values,
+			pright_field_values);
+		if (pleft_bucket != NULL) {
+			// Threads may race to set this, but only ever to TRUE.
+			__atomic_store_n(&pleft_bucket->was_paired, TRUE, __ATOMIC_RELAXED);
+			if (pstate->popts->emit_pairables)
+				mapper_join_form_pairs(pleft_bucket->precords, pright_rec, pstate, pout_recs);
 			lrec_free(pright_rec);
-			return NULL;
+			return;
+		}
+	}
+
+	if (pstate->popts->emit_right_unpairables)
+		sllv_append(pout_recs, pright_rec);
+	else
+		lrec_free(pright_rec);
+}
+
+static void* join_probe_thread(void* pvtask) {
+	join_probe_task_t* ptask = pvtask;
+	string_array_t* pright_field_values = string_array_alloc(
+		ptask->pstate->popts->pright_join_field_names->length);
+	for (int i = 0; i < ptask->num_right_recs; i++)
+		mapper_join_probe(ptask->pstate, pright_field_values, ptask->pright_recs[i], ptask->pout_recs);
+	string_array_free(pright_field_values);
+	return NULL;
+}
+
+// Probes all the held right records, the first run on this thread and the
+// rest on new ones. Returns NULL if there's no output.
+static sllv_t* mapper_join_probe_batch(mapper_join_state_t* pstate) {
+	int num_threads = pstate->popts->num_threads;
+	int num_per_thread = (pstate->right_batch_size + num_threads - 1) / num_threads;
+	join_probe_task_t* ptasks = pstate->probe_tasks;
+
+	for (int i = 0; i < num_threads; i++) {
+		int start = i * num_per_thread;
+		int end = start + num_per_thread;
+		if (start > pstate->right_batch_size)
+			start = pstate->right_batch_size;
+		if (end > pstate->right_batch_size)
+			end = pstate->right_batch_size;
+		ptasks[i].pstate         = pstate;
+		ptasks[i].pright_recs    = &pstate->pright_batch[start];
+		ptasks[i].num_right_recs = end - start;
+		ptasks[i].pout_recs      = sllv_alloc();
+	}
+
+	for (int i = 1; i < num_threads; i++) {
+		if (ptasks[i].num_right_recs == 0)
+			continue;
+		if (pthread_create(&pstate->probe_threads[i], NULL, join_probe_thread, &ptasks[i]) != 0) {
+			fprintf(stderr, "%s join: could not create thread.\n", MLR_GLOBALS.bargv0);
+			exit(1);
 		}
 	}
+	join_probe_thread(&ptasks[0]);
+	for (int i = 1; i < num_threads; i++) {
+		if (ptasks[i].num_right_recs == 0)
+			continue;
+		pthread_join(pstate->probe_threads[i], NULL);
+	}
+
+	sllv_t* pout_recs = ptasks[0].pout_recs;
+	for (int i = 1; i < num_threads; i++) {
+		sllv_transfer(pout_recs, ptasks[i].pout_recs);
+		sllv_free(ptasks[i].pout_recs);
+	}
+	pstate->right_batch_size = 0;
+
+	if (pout_recs->length == 0) {
+		sllv_free(pout_recs);
+		return NULL;
+	}
+	return pout_recs;
 }
 
 // ----------------------------------------------------------------
@@ -557,40 +753,316 @@ static void ingest_left_file(mapper_join_state_t* pstate) {
 	context_t* pctx = &ctx;
 
 	pstate->pleft_buckets_by_join_field_values = lhmslv_alloc();
+	string_array_t* pleft_field_values = string_array_alloc(pstate->popts->pleft_join_field_names->length);
+	long long left_bytes = 0LL;
 
 	while (TRUE) {
 		lrec_t* pleft_rec = plrec_reader->pprocess_func(plrec_reader->pvstate, pvhandle, pctx);
 		if (pleft_rec == NULL)
 			break;
+
+		if (pstate->pleft_partitions != NULL) {
+			if (mlr_reference_selected_values_from_record_into_array(pleft_rec,
+				pstate->popts->pleft_join_field_names, pleft_field_values))
+			{
+				write_to_partition(pstate->pleft_partitions, string_array_hash_func(pleft_field_values), 0, pleft_rec);
+			} else {
+				spill_file_write(pstate->pleft_unpaired_spill, pleft_rec);
+			}
+			lrec_free(pleft_rec);
+			continue;
+		}
+
 		// Mmapped input records are backed by their storage, i.e. they contain pointers into
 		// mmaped file data. After the lrec reader is freed they will be invalid. So in this
 		// ingestor we need to copy.
 		lrec_t* pleft_copy = lrec_copy(pleft_rec);
 
-		slls_t* pleft_field_values = mlr_reference_selected_values_from_record(pleft_copy,
-			pstate->popts->pleft_join_field_names);
-		if (pleft_field_values != NULL) {
-			join_bucket_t* pbucket = lhmslv_get(pstate->pleft_buckets_by_join_field_values, pleft_field_values);
-			if (pbucket == NULL) { // New key-field-value: new bucket and hash-map entry
-				slls_t* pkey_field_values_copy = slls_copy(pleft_field_values);
-				join_bucket_t* pbucket = mlr_malloc_or_die(sizeof(join_bucket_t));
-				pbucket->precords = sllv_alloc();
-				pbucket->was_paired = FALSE;
-				pbucket->pleft_field_values = slls_copy(pleft_field_values);
-				lhmslv_put(pstate->pleft_buckets_by_join_field_values, pkey_field_values_copy, pbucket,
-					FREE_ENTRY_KEY);
-				sllv_append(pbucket->precords, pleft_copy);
-			} else { // Previously seen key-field-value: append record to bucket
-				sllv_append(pbucket->precords, pleft_copy);
-			}
-			slls_free(pleft_field_values);
-		} else {
+		int num_buckets = lhmslv_size(pstate->pleft_buckets_by_join_field_values);
+		if (!bucket_left_record(pstate->pleft_buckets_by_join_field_values,
+			pstate->popts->pleft_join_field_names, pleft_field_values, pleft_copy))
+		{
 			sllv_append(pstate->pleft_unpaired_records, pleft_copy);
 		}
 		lrec_free(pleft_rec);
+
+		if (popts->max_left_bytes > 0.0) {
+			left_bytes += estimated_lrec_bytes(pleft_copy);
+			if (lhmslv_size(pstate->pleft_buckets_by_join_field_values) > num_buckets)
+				left_bytes += estimated_bucket_bytes(pleft_field_values);
+			if (left_bytes > popts->max_left_bytes)
+				spill_left_records(pstate);
+		}
 	}
+	string_array_free(pleft_field_values);
 
 	plrec_reader->pclose_func(plrec_reader->pvstate, pvhandle, pstate->popts->prepipe);
 
 	plrec_reader->pfree_func(plrec_reader);
 }
+
+// ----------------------------------------------------------------
+// Returns FALSE, without taking ownership of the record, if it lacks any of the join fields.
+static int bucket_left_record(lhmslv_t* pleft_buckets_by_join_field_values, slls_t* pleft_join_field_names,
+	string_array_t* pleft_field_values, lrec_t* pleft_rec)
+{
+	if (!mlr_reference_selected_values_from_record_into_array(pleft_rec,
+		pleft_join_field_names, pleft_field_values))
+	{
+		return FALSE;
+	}
+
+	join_bucket_t* pbucket = lhmslv_get_from_string_array(pleft_buckets_by_join_field_values,
+		pleft_field_values);
+	if (pbucket == NULL) { // New key-field-value: new bucket and hash-map entry
+		pbucket = mlr_malloc_or_die(sizeof(join_bucket_t));
+		slls_t* pkey_field_values_copy = lhmslv_put_copy_of_string_array(
+			pleft_buckets_by_join_field_values, pleft_field_values, pbucket);
+		pbucket->precords = sllv_alloc();
+		pbucket->was_paired = FALSE;
+		pbucket->pleft_field_values = slls_copy(pkey_field_values_copy);
+	}
+	sllv_append(pbucket->precords, pleft_rec);
+	return TRUE;
+}
+
+static void free_left_buckets(lhmslv_t* pleft_buckets_by_join_field_values) {
+	for (lhmslve_t* pe = pleft_buckets_by_join_field_values->phead; pe != NULL; pe = pe->pnext) {
+		join_bucket_t* pbucket = pe->pvvalue;
+		slls_free(pbucket->pleft_field_values);
+		if (pbucket->precords)
+			while (pbucket->precords->phead)
+				lrec_free(sllv_pop(pbucket->precords));
+		sllv_free(pbucket->precords);
+		free(pbucket);
+	}
+	lhmslv_free(pleft_buckets_by_join_field_values);
+}
+
+// ================================================================
+// Grace hash join for unsorted input past --max-mem.
+//
+// Once the left records held in memory go over the limit, they're written out
+// to NUM_SPILL_PARTITIONS temporary files by hash of their join-field values,
+// as is the rest of the left file. Right records are then written out the same
+// way, so a left record and a right record with the same join-field values are
+// always in the same-numbered partition. At end of stream each pair of
+// partitions is joined as in the non-spilling case: the left partition is held
+// in memory while the right one is read through, and output records are sent
+// downstream as they're formed. So memory use stays near the limit however
+// large the output. A left partition which is itself over the limit is split
+// again, with a differently mixed hash, up to MAX_SPILL_DEPTH times.
+//
+// Left records lacking the join fields are spilled separately, for --ul. Right
+// records lacking them are emitted (for --ur) or discarded as they arrive.
+// ================================================================
+
+// These only need to be roughly right, but they count what malloc takes for
+// each allocation and not just what's asked for, since for records of short
+// fields that's most of it. This is as for glibc: an 8-byte header, rounded
+// up to 16 bytes, with at least 32.
+static inline long long malloced_bytes(long long n) {
+	long long nbytes = (n + 8 + 15) & ~15LL;
+	return (nbytes < 32) ? 32 : nbytes;
+}
+
+// The record struct plus fields and strings as allocated by lrec_copy, and
+// its list node in a bucket.
+static long long estimated_lrec_bytes(lrec_t* prec) {
+	long long nbytes = malloced_bytes(sizeof(lrec_t)) + malloced_bytes(sizeof(sllve_t));
+	for (lrece_t* pe = prec->phead; pe != NULL; pe = pe->pnext)
+		nbytes += malloced_bytes(sizeof(lrece_t))
+			+ malloced_bytes(strlen(pe->key) + 1) + malloced_bytes(strlen(pe->value) + 1);
+	return nbytes;
+}
+
+// A new bucket: the bucket, its record list, two copies of the join-field
+// values (its own, and the hash map's key), and the hash-map entry.
+static long long estimated_bucket_bytes(string_array_t* pfield_values) {
+	long long nbytes = malloced_bytes(sizeof(join_bucket_t)) + malloced_bytes(sizeof(sllv_t))
+		+ 2 * malloced_bytes(sizeof(slls_t)) + sizeof(lhmslve_t) + sizeof(void*);
+	for (int i = 0; i < pfield_values->length; i++)
+		nbytes += 2 * (malloced_bytes(sizeof(sllse_t)) + malloced_bytes(strlen(pfield_values->strings[i]) + 1));
+	return nbytes;
+}
+
+// Likewise for the records in a spill file, if read back in, without their
+// buckets. (The file's length prefixes stand in for the strings' null
+// terminators, and each string's header and rounding are taken as 16 bytes.)
+static long long estimated_spill_file_bytes(spill_file_t* psf) {
+	return psf->num_bytes
+		+ psf->num_records * (malloced_bytes(sizeof(lrec_t)) + malloced_bytes(sizeof(sllve_t)))
+		+ psf->num_fields * (malloced_bytes(sizeof(lrece_t)) + 2 * 16);
+}
+
+// The hash is remixed per depth, else a partition being split again would all
+// land in one sub-partition.
+static int partition_of(int hash, int depth) {
+	unsigned long long h = (unsigned)hash + depth * 0x9e3779b97f4a7c15ULL;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	return h % NUM_SPILL_PARTITIONS;
+}
+
+// Partition files are created on first write, since with small inputs or
+// few distinct keys most of them would otherwise be empty.
+static spill_file_t** alloc_partitions() {
+	spill_file_t** partitions = mlr_malloc_or_die(NUM_SPILL_PARTITIONS * sizeof(spill_file_t*));
+	for (int i = 0; i < NUM_SPILL_PARTITIONS; i++)
+		partitions[i] = NULL;
+	return partitions;
+}
+
+static void write_to_partition(spill_file_t** partitions, int hash, int depth, lrec_t* prec) {
+	int i = partition_of(hash, depth);
+	if (partitions[i] == NULL)
+		partitions[i] = spill_file_alloc();
+	spill_file_write(partitions[i], prec);
+}
+
+// Moves the in-memory left records to disk. Records within a bucket keep
+// their order, so pairs come out in the same order as without spilling, per
+// right record.
+static void spill_left_records(mapper_join_state_t* pstate) {
+	pstate->pleft_partitions     = alloc_partitions();
+	pstate->pright_partitions    = alloc_partitions();
+	pstate->pleft_unpaired_spill = spill_file_alloc();
+
+	for (lhmslve_t* pe = pstate->pleft_buckets_by_join_field_values->phead; pe != NULL; pe = pe->pnext) {
+		join_bucket_t* pbucket = pe->pvvalue;
+		int hash = slls_hash_func(pbucket->pleft_field_values);
+		for (sllve_t* pf = pbucket->precords->phead; pf != NULL; pf = pf->pnext)
+			write_to_partition(pstate->pleft_partitions, hash, 0, pf->pvvalue);
+	}
+	free_left_buckets(pstate->pleft_buckets_by_join_field_values);
+	pstate->pleft_buckets_by_join_field_values = lhmslv_alloc();
+
+	while (pstate->pleft_unpaired_records->phead) {
+		lrec_t* prec = sllv_pop(pstate->pleft_unpaired_records);
+		spill_file_write(pstate->pleft_unpaired_spill, prec);
+		lrec_free(prec);
+	}
+}
+
+// ----------------------------------------------------------------
+static void mapper_join_push_spilled(lrec_t* pright_rec, context_t* pctx, mapper_join_state_t* pstate,
+	mapper_emitter_t* pemitter)
+{
+	if (pright_rec == NULL) { // End of input record stream
+		for (int i = 0; i < NUM_SPILL_PARTITIONS; i++) {
+			mapper_join_partition_pair(pstate, pstate->pleft_partitions[i], pstate->pright_partitions[i],
+				0, pctx, pemitter);
+			pstate->pleft_partitions[i]  = NULL;
+			pstate->pright_partitions[i] = NULL;
+		}
+		if (pstate->popts->emit_left_unpairables) {
+			spill_file_rewind(pstate->pleft_unpaired_spill);
+			lrec_t* prec;
+			while ((prec = spill_file_read(pstate->pleft_unpaired_spill)) != NULL)
+				mapper_emit(pemitter, prec, pctx);
+		}
+		spill_file_free(pstate->pleft_unpaired_spill);
+		pstate->pleft_unpaired_spill = NULL;
+		mapper_emit(pemitter, NULL, pctx);
+		return;
+	}
+
+	if (mlr_reference_selected_values_from_record_into_array(pright_rec,
+		pstate->popts->pright_join_field_names, pstate->pright_field_values))
+	{
+		write_to_partition(pstate->pright_partitions, string_array_hash_func(pstate->pright_field_values), 0,
+			pright_rec);
+		lrec_free(pright_rec);
+	} else if (pstate->popts->emit_right_unpairables) {
+		mapper_emit(pemitter, pright_rec, pctx);
+	} else {
+		lrec_free(pright_rec);
+	}
+}
+
+// ----------------------------------------------------------------
+// Reads all records from the source file, which is then freed, into new
+// partitions. All of them have the join fields.
+static spill_file_t** repartition(spill_file_t* psrc, slls_t* pjoin_field_names, int depth) {
+	spill_file_t** partitions = alloc_partitions();
+	string_array_t* pfield_values = string_array_alloc(pjoin_field_names->length);
+	spill_file_rewind(psrc);
+	lrec_t* prec;
+	while ((prec = spill_file_read(psrc)) != NULL) {
+		mlr_reference_selected_values_from_record_into_array(prec, pjoin_field_names, pfield_values);
+		write_to_partition(partitions, string_array_hash_func(pfield_values), depth, prec);
+		lrec_free(prec);
+	}
+	string_array_free(pfield_values);
+	spill_file_free(psrc);
+	return partitions;
+}
+
+// Joins one left partition with the corresponding right partition, emitting
+// output records as it goes, and frees both. Either may be NULL, i.e. empty.
+// Only the left partition is held in memory.
+static void mapper_join_partition_pair(mapper_join_state_t* pstate, spill_file_t* pleft_partition,
+	spill_file_t* pright_partition, int depth, context_t* pctx, mapper_emitter_t* pemitter)
+{
+	mapper_join_opts_t* popts = pstate->popts;
+
+	if (depth < MAX_SPILL_DEPTH && pleft_partition != NULL && pright_partition != NULL
+		&& pleft_partition->num_records > 1
+		&& estimated_spill_file_bytes(pleft_partition) > popts->max_left_bytes)
+	{
+		spill_file_t** pleft_subpartitions  = repartition(pleft_partition, popts->pleft_join_field_names, depth+1);
+		spill_file_t** pright_subpartitions = repartition(pright_partition, popts->pright_join_field_names, depth+1);
+		for (int i = 0; i < NUM_SPILL_PARTITIONS; i++)
+			mapper_join_partition_pair(pstate, pleft_subpartitions[i], pright_subpartitions[i], depth+1,
+				pctx, pemitter);
+		free(pleft_subpartitions);
+		free(pright_subpartitions);
+		return;
+	}
+
+	lhmslv_t* pleft_buckets = lhmslv_alloc();
+	string_array_t* pfield_values = string_array_alloc(popts->pleft_join_field_names->length);
+	sllv_t* ppairs = sllv_alloc();
+	lrec_t* prec;
+
+	if (pleft_partition != NULL) {
+		spill_file_rewind(pleft_partition);
+		while ((prec = spill_file_read(pleft_partition)) != NULL)
+			bucket_left_record(pleft_buckets, popts->pleft_join_field_names, pfield_values, prec);
+		spill_file_free(pleft_partition);
+	}
+
+	if (pright_partition != NULL)
+		spill_file_rewind(pright_partition);
+	while (pright_partition != NULL && (prec = spill_file_read(pright_partition)) != NULL) {
+		mlr_reference_selected_values_from_record_into_array(prec, popts->pright_join_field_names, pfield_values);
+		join_bucket_t* pleft_bucket = lhmslv_get_from_string_array(pleft_buckets, pfield_values);
+		if (pleft_bucket == NULL) {
+			if (popts->emit_right_unpairables) {
+				mapper_emit(pemitter, prec, pctx);
+				continue;
+			}
+		} else {
+			pleft_bucket->was_paired = TRUE;
+			if (popts->emit_pairables) {
+				mapper_join_form_pairs(pleft_bucket->precords, prec, pstate, ppairs);
+				while (ppairs->phead != NULL)
+					mapper_emit(pemitter, sllv_pop(ppairs), pctx);
+			}
+		}
+		lrec_free(prec);
+	}
+	spill_file_free(pright_partition);
+
+	if (popts->emit_left_unpairables) {
+		for (lhmslve_t* pe = pleft_buckets->phead; pe != NULL; pe = pe->pnext) {
+			join_bucket_t* pbucket = pe->pvvalue;
+			if (!pbucket->was_paired)
+				while (pbucket->precords->phead != NULL)
+					mapper_emit(pemitter, sllv_pop(pbucket->precords), pctx);
+		}
+	}
+	sllv_free(ppairs);
+	free_left_buckets(pleft_buckets);
+	string_array_free(pfield_values);
+}
@@ -51,7 +51,7 @@ static mapper_t* mapper_label_parse_cli(int* pargi, int argc, char** argv,
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_label_alloc(slls_t* pnames) {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_label_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_label_state_t));
 	pstate->pnames = pnames;
@@ -12,6 +12,9 @@
 #include "containers/lhmslv.h"
 #include "containers/lhmsv.h"
 #include "containers/mixutil.h"
+#include "containers/tdigest.h"
+#include "containers/hll.h"
+#include "containers/schema_cache.h"
 #include "lib/mlrval.h"
 #include "mapping/mappers.h"
 #include "mapping/stats1_accumulators.h"
@@ -49,18 +52,27 @@ typedef struct _mapper_merge_fields_state_t {
 	char*    output_field_basename;
 	int      allow_int_float;
 	int      do_interpolated_percentiles;
+	double   approx_compression;
 	int      keep_input_fields;
 	string_builder_t* psb;
+	// By field names: for -k, which fields match; for -c, the short name for each field, or null.
+	schema_cache_t* pschema_cache;
 } mapper_merge_fields_state_t;
 
+typedef struct _merge_fields_short_names_t {
+	int    num_fields;
+	char** short_names;
+} merge_fields_short_names_t;
+
 // ----------------------------------------------------------------
 static void      mapper_merge_fields_usage(FILE* o, char* argv0, char* verb);
 static mapper_t* mapper_merge_fields_parse_cli(int* pargi, int argc, char** argv,
 	cli_reader_opts_t* _, cli_writer_opts_t* __);
 static mapper_t* mapper_merge_fields_alloc(slls_t* paccumulator_names, merge_by_t do_which,
 	slls_t* pvalue_field_names, char* output_field_basename, int allow_int_float, int do_interpolated_percentiles,
-	int keep_input_fields);
+	double approx_compression, int keep_input_fields);
 static void      mapper_merge_fields_free(mapper_t* pmapper, context_t* _);
+static void      merge_fields_short_names_free(void* pvvalue);
 static sllv_t*   mapper_merge_fields_process_by_name_list(lrec_t* pinrec, context_t* pctx, void* pvstate);
 static sllv_t*   mapper_merge_fields_process_by_name_regex(lrec_t* pinrec, context_t* pctx, void* pvstate);
 static sllv_t*   mapper_merge_fields_process_by_collapsing(lrec_t* pinrec, context_t* pctx, void* pvstate);
@@ -79,7 +91,10 @@ static void mapper_merge_fields_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "Computes univariate statistics for each input record, accumulated across\n");
 	fprintf(o, "specified fields.\n");
 	fprintf(o, "Options:\n");
-	fprintf(o, "-a {sum,count,...}  Names of accumulators. One or more of:\n");
+	fprintf(o, "-a {sum,count,...}  Names of accumulators: p10 p25.2 p50 p98 p100 etc.,\n");
+	fprintf(o, "                    approximate percentiles p10~ p50~ median~ etc.,\n");
+	fprintf(o, "                    approximate distinct-value count distinct_count~, and/or\n");
+	fprintf(o, "                    one or more of:\n");
 	for (int i = 0; i < stats1_acc_lookup_table_length; i++) {
 		fprintf(o, "  %-9s %s\n", stats1_acc_lookup_table[i].name, stats1_acc_lookup_table[i].desc);
 	}
@@ -91,6 +106,8 @@ static void mapper_merge_fields_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "            examples below.\n");
 	fprintf(o, "-i          Use interpolated percentiles, like R's type=7; default like type=1.\n");
 	fprintf(o, "            Not sensical for string-valued fields.\n");
+	fprintf(o, "--compression {n} Accuracy of approximate percentiles p10~ etc.: higher is more\n");
+	fprintf(o, "            accurate, and uses more memory. Default %d.\n", (int)TDIGEST_DEFAULT_COMPRESSION);
 	fprintf(o, "-o {name}   Output field basename for -f/-r.\n");
 	fprintf(o, "-k          Keep the input fields which contributed to the output statistics;\n");
 	fprintf(o, "            the default is to omit them.\n");
@@ -120,6 +137,7 @@ static mapper_t* mapper_merge_fields_parse_cli(int* pargi, int argc, char** argv
 	char*      output_field_basename       = NULL;
 	int        allow_int_float             = TRUE;
 	int        do_interpolated_percentiles = FALSE;
+	double     approx_compression          = TDIGEST_DEFAULT_COMPRESSION;
 	int        keep_input_fields           = FALSE;
 	merge_by_t do_which                    = MERGE_UNSPECIFIED;
 
@@ -189,6 +207,13 @@ static mapper_t* mapper_merge_fields_parse_cli(int* pargi, int argc, char** argv
 		} else if (streq(argv[argi], "-i")) {
 			do_interpolated_percentiles = TRUE;
 			argi += 1;
+		} else if (streq(argv[argi], "--compression")) {
+			if (argc - argi < 2) {
+				mapper_merge_fields_usage(stderr, argv[0], verb);
+				return NULL;
+			}
+			approx_compression = mlr_double_from_string_or_die(argv[argi+1]);
+			argi += 2;
 		} else {
 			mapper_merge_fields_usage(stderr, argv[0], verb);
 			return NULL;
@@ -214,15 +239,15 @@ static mapper_t* mapper_merge_fields_parse_cli(int* pargi, int argc, char** argv
 	*pargi = argi;
 	return mapper_merge_fields_alloc(paccumulator_names, do_which,
 		pvalue_field_names, output_field_basename, allow_int_float, do_interpolated_percentiles,
-		keep_input_fields);
+		approx_compression, keep_input_fields);
 }
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_merge_fields_alloc(slls_t* paccumulator_names, merge_by_t do_which,
 	slls_t* pvalue_field_names, char* output_field_basename, int allow_int_float, int do_interpolated_percentiles,
-	int keep_input_fields)
+	double approx_compression, int keep_input_fields)
 {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_merge_fields_state_t* pstate  = mlr_malloc_or_die(sizeof(mapper_merge_fields_state_t));
 
@@ -231,15 +256,19 @@ static mapper_t* mapper_merge_fields_alloc(slls_t* paccumulator_names, merge_by_
 	pstate->pvalue_field_regexes = sllv_alloc();
 	for (sllse_t* pa = pvalue_field_names->phead; pa != NULL; pa = pa->pnext) {
 		char* value_field_name = pa->value;
-		regex_t* pvalue_field_regex = mlr_malloc_or_die(sizeof(regex_t));
-		regcomp_or_die(pvalue_field_regex, value_field_name, 0);
+		mlr_regex_t* pvalue_field_regex = mlr_malloc_or_die(sizeof(mlr_regex_t));
+		mlr_regcomp_or_die(pvalue_field_regex, value_field_name, 0);
 		sllv_append(pstate->pvalue_field_regexes, pvalue_field_regex);
 	}
 	pstate->output_field_basename       = output_field_basename;
 	pstate->allow_int_float             = allow_int_float;
 	pstate->do_interpolated_percentiles = do_interpolated_percentiles;
+	pstate->approx_compression          = approx_compression;
 	pstate->keep_input_fields           = keep_input_fields;
 	pstate->psb                         = sb_alloc(SB_ALLOC_LENGTH);
+	pstate->pschema_cache               = (do_which == MERGE_BY_NAME_REGEX) ? schema_cache_alloc(free)
+		: (do_which == MERGE_BY_COLLAPSING) ? schema_cache_alloc(merge_fields_short_names_free)
+		: NULL;
 
 	pmapper->pvstate = pstate;
 	pmapper->pprocess_func = (do_which == MERGE_BY_NAME_LIST) ? mapper_merge_fields_process_by_name_list :
@@ -255,16 +284,25 @@ static void mapper_merge_fields_free(mapper_t* pmapper, context_t* _) {
 	slls_free(pstate->paccumulator_names);
 	slls_free(pstate->pvalue_field_names);
 	for (sllve_t* pa = pstate->pvalue_field_regexes->phead; pa != NULL; pa = pa->pnext) {
-		regex_t* pvalue_field_regex = pa->pvvalue;
-		regfree(pvalue_field_regex);
+		mlr_regex_t* pvalue_field_regex = pa->pvvalue;
+		mlr_regfree(pvalue_field_regex);
 		free(pvalue_field_regex);
 	}
 	sllv_free(pstate->pvalue_field_regexes);
 	sb_free(pstate->psb);
+	schema_cache_free(pstate->pschema_cache);
 	free(pstate);
 	free(pmapper);
 }
 
+static void merge_fields_short_names_free(void* pvvalue) {
+	merge_fields_short_names_t* pshort_names = pvvalue;
+	for (int i = 0; i < pshort_names->num_fields; i++)
+		free(pshort_names->short_names[i]);
+	free(pshort_names->short_names);
+	free(pshort_names);
+}
+
 // ================================================================
 static sllv_t* mapper_merge_fields_process_by_name_list(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	if (pinrec == NULL) // end of input stream
@@ -279,7 +317,8 @@ static sllv_t* mapper_merge_fields_process_by_name_list(lrec_t* pinrec, context_
 	lhmsv_t* poutaccs = lhmsv_alloc();
 
 	make_stats1_accs(pstate->output_field_basename, pstate->paccumulator_names,
-	    pstate->allow_int_float, pstate->do_interpolated_percentiles, pinaccs, poutaccs);
+	    pstate->allow_int_float, pstate->do_interpolated_percentiles, pstate->approx_compression, HLL_DEFAULT_PRECISION,
+	    pinaccs, poutaccs);
 
 	for (sllse_t* pb = pstate->pvalue_field_names->phead; pb != NULL; pb = pb->pnext) {
 		char* field_name = pb->value;
@@ -354,63 +393,77 @@ static sllv_t* mapper_merge_fields_process_by_name_regex(lrec_t* pinrec, context
 	lhmsv_t* poutaccs = lhmsv_alloc();
 
 	make_stats1_accs(pstate->output_field_basename, pstate->paccumulator_names,
-	    pstate->allow_int_float, pstate->do_interpolated_percentiles, pinaccs, poutaccs);
+	    pstate->allow_int_float, pstate->do_interpolated_percentiles, pstate->approx_compression, HLL_DEFAULT_PRECISION,
+	    pinaccs, poutaccs);
+
+	// Which fields match depends only on the field names.
+	char* pmatched_flags = schema_cache_get(pstate->pschema_cache, pinrec);
+	if (pmatched_flags == NULL) {
+		pmatched_flags = mlr_malloc_or_die(pinrec->field_count + 1);
+		int j = 0;
+		for (lrece_t* pb = pinrec->phead; pb != NULL; pb = pb->pnext, j++) {
+			int matched = FALSE;
+			for (sllve_t* pc = pstate->pvalue_field_regexes->phead; pc != NULL && !matched; pc = pc->pnext) {
+				mlr_regex_t* pvalue_field_regex = pc->pvvalue;
+				matched = mlr_regmatch_or_die(pvalue_field_regex, pb->key, 0, NULL);
+			}
+			pmatched_flags[j] = matched;
+		}
+		schema_cache_put(pstate->pschema_cache, pmatched_flags);
+	}
 
-	for (lrece_t* pb = pinrec->phead; pb != NULL; /* increment inside loop */ ) {
+	int j = 0;
+	for (lrece_t* pb = pinrec->phead; pb != NULL; j++) {
+		if (!pmatched_flags[j]) {
+			pb = pb->pnext;
+			continue;
+		}
 		char* field_name = pb->key;
-		int matched = FALSE;
-		for (sllve_t* pc = pstate->pvalue_field_regexes->phead; pc != NULL && !matched; pc = pc->pnext) {
-			regex_t* pvalue_field_regex = pc->pvvalue;
-			matched = regmatch_or_die(pvalue_field_regex, field_name, 0, NULL);
-			if (matched) {
-				char* value_field_sval = lrec_get(pinrec, field_name);
-				if (value_field_sval != NULL) { // Key not present
-					int have_dval = FALSE;
-					int have_nval = FALSE;
-					double value_field_dval = -999.0;
-					mv_t   value_field_nval = mv_absent();
-
-					if (*value_field_sval != 0) { // Key present with null value
-						for (lhmsve_t* pd = pinaccs->phead; pd != NULL; pd = pd->pnext) {
-							stats1_acc_t* pacc = pd->pvvalue;
-
-							if (pacc->pdingest_func != NULL) {
-								if (!have_dval) {
-									value_field_dval = mlr_double_from_string_or_die(value_field_sval);
-									have_dval = TRUE;
-								}
-								pacc->pdingest_func(pacc->pvstate, value_field_dval);
-							}
-							if (pacc->pningest_func != NULL) {
-								if (!have_nval) {
-									value_field_nval = pstate->allow_int_float
-										? mv_scan_number_or_die(value_field_sval)
-										: mv_from_float(mlr_double_from_string_or_die(value_field_sval));
-									have_nval = TRUE;
-								}
-								pacc->pningest_func(pacc->pvstate, &value_field_nval);
-							}
-							if (pacc->psingest_func != NULL) {
-								pacc->psingest_func(pacc->pvstate, value_field_sval);
-							}
-						}
-					}
+		char* value_field_sval = lrec_get(pinrec, field_name);
+		if (value_field_sval == NULL) { // Key not present
+			pb = pb->pnext;
+			continue;
+		}
+
+		int have_dval = FALSE;
+		int have_nval = FALSE;
+		double value_field_dval = -999.0;
+		mv_t   value_field_nval = mv_absent();
 
-					if (!pstate->keep_input_fields) {
-						// We are modifying the lrec while iterating over it.
-						lrece_t* pnext = pb->pnext;
-						lrec_unlink_and_free(pinrec, pb);
-						pb = pnext;
-					} else {
-						pb = pb->pnext;
+		if (*value_field_sval != 0) { // Key present with null value
+			for (lhmsve_t* pd = pinaccs->phead; pd != NULL; pd = pd->pnext) {
+				stats1_acc_t* pacc = pd->pvvalue;
+
+				if (pacc->pdingest_func != NULL) {
+					if (!have_dval) {
+						value_field_dval = mlr_double_from_string_or_die(value_field_sval);
+						have_dval = TRUE;
 					}
-				} else {
-					pb = pb->pnext;
+					pacc->pdingest_func(pacc->pvstate, value_field_dval);
+				}
+				if (pacc->pningest_func != NULL) {
+					if (!have_nval) {
+						value_field_nval = pstate->allow_int_float
+							? mv_scan_number_or_die(value_field_sval)
+							: mv_from_float(mlr_double_from_string_or_die(value_field_sval));
+						have_nval = TRUE;
+					}
+					pacc->pningest_func(pacc->pvstate, &value_field_nval);
+				}
+				if (pacc->psingest_func != NULL) {
+					pacc->psingest_func(pacc->pvstate, value_field_sval);
 				}
 			}
 		}
-		if (!matched)
+
+		if (!pstate->keep_input_fields) {
+			// We are modifying the lrec while iterating over it.
+			lrece_t* pnext = pb->pnext;
+			lrec_unlink_and_free(pinrec, pb);
+			pb = pnext;
+		} else {
 			pb = pb->pnext;
+		}
 	}
 
 	for (lhmsve_t* pz = poutaccs->phead; pz != NULL; pz = pz->pnext) {
@@ -446,83 +499,100 @@ static sllv_t* mapper_merge_fields_process_by_collapsing(lrec_t* pinrec, context
 	lhmsv_t* short_names_to_in_acc_maps = lhmsv_alloc();
 	lhmsv_t* short_names_to_out_acc_maps = lhmsv_alloc();
 
-	for (lrece_t* pa = pinrec->phead; pa != NULL; /* increment inside loop */ ) {
+	// The short name for each field, if any, depends only on the field names.
+	merge_fields_short_names_t* pshort_names = schema_cache_get(pstate->pschema_cache, pinrec);
+	if (pshort_names == NULL) {
+		pshort_names = mlr_malloc_or_die(sizeof(merge_fields_short_names_t));
+		pshort_names->num_fields = pinrec->field_count;
+		pshort_names->short_names = mlr_malloc_or_die((pinrec->field_count + 1) * sizeof(char*));
+		int j = 0;
+		for (lrece_t* pa = pinrec->phead; pa != NULL; pa = pa->pnext, j++) {
+			int matched = FALSE;
+			pshort_names->short_names[j] = NULL;
+			for (sllve_t* pb = pstate->pvalue_field_regexes->phead; pb != NULL && !matched; pb = pb->pnext) {
+				mlr_regex_t* pvalue_field_regex = pb->pvvalue;
+				char* short_name = regex_sub(pa->key, pvalue_field_regex, pstate->psb, "", &matched, NULL);
+				if (matched)
+					pshort_names->short_names[j] = short_name;
+				else
+					free(short_name);
+			}
+		}
+		schema_cache_put(pstate->pschema_cache, pshort_names);
+	}
+
+	int j = 0;
+	for (lrece_t* pa = pinrec->phead; pa != NULL; j++) {
+		char* short_name = pshort_names->short_names[j];
+		if (short_name == NULL) {
+			pa = pa->pnext;
+			continue;
+		}
 		char* field_name = pa->key;
-		int matched = FALSE;
-		for (sllve_t* pb = pstate->pvalue_field_regexes->phead; pb != NULL && !matched; pb = pb->pnext) {
-			regex_t* pvalue_field_regex = pb->pvvalue;
-			char* short_name = regex_sub(field_name, pvalue_field_regex, pstate->psb, "", &matched, NULL);
-			if (matched) {
-				lhmsv_t* in_acc_map_for_short_name = lhmsv_get(short_names_to_in_acc_maps, short_name);
-				lhmsv_t* out_acc_map_for_short_name = lhmsv_get(short_names_to_out_acc_maps, short_name);
-				if (out_acc_map_for_short_name == NULL) { // First such
-
-					in_acc_map_for_short_name = lhmsv_alloc();
-					out_acc_map_for_short_name = lhmsv_alloc();
-
-					make_stats1_accs(short_name, pstate->paccumulator_names,
-						pstate->allow_int_float, pstate->do_interpolated_percentiles,
-						in_acc_map_for_short_name, out_acc_map_for_short_name);
-
-					lhmsv_put(short_names_to_in_acc_maps, mlr_strdup_or_die(short_name), in_acc_map_for_short_name,
-						FREE_ENTRY_KEY);
-					lhmsv_put(short_names_to_out_acc_maps, mlr_strdup_or_die(short_name), out_acc_map_for_short_name,
-						FREE_ENTRY_KEY);
 
-				}
+		lhmsv_t* in_acc_map_for_short_name = lhmsv_get(short_names_to_in_acc_maps, short_name);
+		lhmsv_t* out_acc_map_for_short_name = lhmsv_get(short_names_to_out_acc_maps, short_name);
+		if (out_acc_map_for_short_name == NULL) { // First such
 
-				char* value_field_sval = lrec_get(pinrec, field_name);
-				if (value_field_sval != NULL) { // Key present
-
-					if (*value_field_sval != 0) { // Key present with non-null value
-						for (lhmsve_t* pd = in_acc_map_for_short_name->phead; pd != NULL; pd = pd->pnext) {
-							stats1_acc_t* pacc = pd->pvvalue;
-
-							int have_dval = FALSE;
-							int have_nval = FALSE;
-							double value_field_dval = -999.0;
-							mv_t   value_field_nval = mv_absent();
-
-							if (pacc->pdingest_func != NULL) {
-								if (!have_dval) {
-									value_field_dval = mlr_double_from_string_or_die(value_field_sval);
-									have_dval = TRUE;
-								}
-								pacc->pdingest_func(pacc->pvstate, value_field_dval);
-							}
-							if (pacc->pningest_func != NULL) {
-								if (!have_nval) {
-									value_field_nval = pstate->allow_int_float
-										? mv_scan_number_or_die(value_field_sval)
-										: mv_from_float(mlr_double_from_string_or_die(value_field_sval));
-									have_nval = TRUE;
-								}
-								pacc->pningest_func(pacc->pvstate, &value_field_nval);
-							}
-							if (pacc->psingest_func != NULL) {
-								pacc->psingest_func(pacc->pvstate, value_field_sval);
-							}
-						}
-					}
+			in_acc_map_for_short_name = lhmsv_alloc();
+			out_acc_map_for_short_name = lhmsv_alloc();
+
+			make_stats1_accs(short_name, pstate->paccumulator_names,
+				pstate->allow_int_float, pstate->do_interpolated_percentiles, pstate->approx_compression, HLL_DEFAULT_PRECISION,
+				in_acc_map_for_short_name, out_acc_map_for_short_name);
+
+			lhmsv_put(short_names_to_in_acc_maps, mlr_strdup_or_die(short_name), in_acc_map_for_short_name,
+				FREE_ENTRY_KEY);
+			lhmsv_put(short_names_to_out_acc_maps, mlr_strdup_or_die(short_name), out_acc_map_for_short_name,
+				FREE_ENTRY_KEY);
+
+		}
+
+		char* value_field_sval = lrec_get(pinrec, field_name);
+		if (value_field_sval == NULL) { // Key not present
+			pa = pa->pnext;
+			continue;
+		}
+
+		if (*value_field_sval != 0) { // Key present with non-null value
+			for (lhmsve_t* pd = in_acc_map_for_short_name->phead; pd != NULL; pd = pd->pnext) {
+				stats1_acc_t* pacc = pd->pvvalue;
 
-					if (!pstate->keep_input_fields) {
-						// We are modifying the lrec while iterating over it.
-						lrece_t* pnext = pa->pnext;
-						lrec_unlink_and_free(pinrec, pa);
-						pa = pnext;
-					} else {
-						pa = pa->pnext;
+				int have_dval = FALSE;
+				int have_nval = FALSE;
+				double value_field_dval = -999.0;
+				mv_t   value_field_nval = mv_absent();
+
+				if (pacc->pdingest_func != NULL) {
+					if (!have_dval) {
+						value_field_dval = mlr_double_from_string_or_die(value_field_sval);
+						have_dval = TRUE;
+					}
+					pacc->pdingest_func(pacc->pvstate, value_field_dval);
+				}
+				if (pacc->pningest_func != NULL) {
+					if (!have_nval) {
+						value_field_nval = pstate->allow_int_float
+							? mv_scan_number_or_die(value_field_sval)
+							: mv_from_float(mlr_double_from_string_or_die(value_field_sval));
+						have_nval = TRUE;
 					}
-				} else {
-					pa = pa->pnext;
+					pacc->pningest_func(pacc->pvstate, &value_field_nval);
+				}
+				if (pacc->psingest_func != NULL) {
+					pacc->psingest_func(pacc->pvstate, value_field_sval);
 				}
-				free(short_name);
-			} else {
-				free(short_name);
 			}
 		}
-		if (!matched)
+
+		if (!pstate->keep_input_fields) {
+			// We are modifying the lrec while iterating over it.
+			lrece_t* pnext = pa->pnext;
+			lrec_unlink_and_free(pinrec, pa);
+			pa = pnext;
+		} else {
 			pa = pa->pnext;
+		}
 	}
 
 	for (lhmsve_t* pe = short_names_to_out_acc_maps->phead; pe != NULL; pe = pe->pnext) {
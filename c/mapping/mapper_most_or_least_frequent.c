@@ -2,16 +2,21 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <limits.h>
 #include "lib/mlrutil.h"
+#include "lib/mlr_globals.h"
 #include "containers/sllv.h"
 #include "containers/lhmslv.h"
 #include "containers/lhmsv.h"
 #include "containers/mixutil.h"
+#include "containers/space_saving.h"
 #include "mapping/mappers.h"
 #include "cli/argparse.h"
 
 #define DEFAULT_MAX_OUTPUT_LENGTH 10LL
 #define DEFAULT_OUTPUT_FIELD_NAME "count"
+#define MIN_DEFAULT_APPROX_CAPACITY 1000LL
+#define UNSPECIFIED_APPROX_CAPACITY LLONG_MIN
 
 typedef struct _mapper_most_or_least_frequent_state_t {
 	ap_state_t* pargp;
@@ -21,6 +26,8 @@ typedef struct _mapper_most_or_least_frequent_state_t {
 	int         descending;
 	int         show_counts;
 	char*       output_field_name;
+	string_array_t* pgroup_by_field_values; // scratch space used per-record
+	space_saving_t* pspace_saving;          // for --approx
 } mapper_most_or_least_frequent_state_t;
 
 static void mapper_most_frequent_usage(FILE*  o, char* argv0, char* verb);
@@ -31,10 +38,12 @@ static mapper_t* mapper_least_frequent_parse_cli(int* pargi, int argc, char** ar
 static mapper_t* mapper_most_or_least_frequent_parse_cli(int* pargi, int argc, char** argv, int descending);
 
 static mapper_t* mapper_most_or_least_frequent_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_names,
-	long long max_output_length, int descending, int show_counts, char* output_field_name);
+	long long max_output_length, int descending, int show_counts, char* output_field_name,
+	long long approx_capacity);
 static void      mapper_most_or_least_frequent_free(mapper_t* pmapper, context_t* _);
 
 static sllv_t*   mapper_most_or_least_frequent_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static sllv_t*   mapper_most_frequent_process_approx(lrec_t* pinrec, context_t* pctx, void* pvstate);
 
 // qsort callbacks
 static int descending_vcmp(const void* pva, const void* pvb);
@@ -70,6 +79,15 @@ static void mapper_most_frequent_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "-n {count}. Optional flag defaulting to %lld.\n", DEFAULT_MAX_OUTPUT_LENGTH);
 	fprintf(o, "-b          Suppress counts; show only field values.\n");
 	fprintf(o, "-o {name}   Field name for output count. Default \"%s\".\n", DEFAULT_OUTPUT_FIELD_NAME);
+	fprintf(o, "--approx    Track only a bounded number of candidate values, using the\n");
+	fprintf(o, "            Space-Saving algorithm, rather than counting all distinct values.\n");
+	fprintf(o, "            Counts are then estimates, never less than the true counts, and\n");
+	fprintf(o, "            each is followed by an upper bound on its overcount, in a field\n");
+	fprintf(o, "            named like \"%s_error\". Suitable for unbounded streams.\n", DEFAULT_OUTPUT_FIELD_NAME);
+	fprintf(o, "-k {count}  For --approx: number of candidates to track. Any value occurring in\n");
+	fprintf(o, "            more than 1/k of the records is sure to be found, and no count is\n");
+	fprintf(o, "            off by more than 1/k of the number of records. Default ten times\n");
+	fprintf(o, "            the -n count, or %lld, whichever is greater.\n", MIN_DEFAULT_APPROX_CAPACITY);
 	fprintf(o, "See also \"%s %s\".\n", argv0, "least-frequent");
 }
 
@@ -102,6 +120,10 @@ static mapper_t* mapper_most_or_least_frequent_parse_cli(int* pargi, int argc, c
 	long long max_output_length     = DEFAULT_MAX_OUTPUT_LENGTH;
 	int       show_counts           = TRUE;
 	char*     output_field_name     = DEFAULT_OUTPUT_FIELD_NAME;
+	int       do_approx             = FALSE;
+	long long approx_capacity       = UNSPECIFIED_APPROX_CAPACITY;
+	mapper_usage_func_t* pusage_func = descending
+		? mapper_most_frequent_usage : mapper_least_frequent_usage;
 
 	char* verb = argv[(*pargi)++];
 
@@ -110,26 +132,50 @@ static mapper_t* mapper_most_or_least_frequent_parse_cli(int* pargi, int argc, c
 	ap_define_long_long_flag(pstate,   "-n", &max_output_length);
 	ap_define_false_flag(pstate,       "-b", &show_counts);
 	ap_define_string_flag(pstate,      "-o", &output_field_name);
+	if (descending) {
+		ap_define_true_flag(pstate,      "--approx", &do_approx);
+		ap_define_long_long_flag(pstate, "-k", &approx_capacity);
+	}
 
 	if (!ap_parse(pstate, verb, pargi, argc, argv)) {
-		mapper_most_frequent_usage(stderr, argv[0], verb);
+		pusage_func(stderr, argv[0], verb);
 		return NULL;
 	}
 
 	if (pgroup_by_field_names == NULL) {
-		mapper_most_frequent_usage(stderr, argv[0], verb);
+		pusage_func(stderr, argv[0], verb);
+		return NULL;
+	}
+
+	if (do_approx) {
+		if (approx_capacity == UNSPECIFIED_APPROX_CAPACITY) {
+			approx_capacity = 10 * max_output_length;
+			if (approx_capacity < MIN_DEFAULT_APPROX_CAPACITY)
+				approx_capacity = MIN_DEFAULT_APPROX_CAPACITY;
+		}
+		if (approx_capacity <= 0LL) {
+			fprintf(stderr, "%s %s: -k must be positive.\n", MLR_GLOBALS.bargv0, verb);
+			return NULL;
+		}
+		if (approx_capacity < max_output_length) {
+			fprintf(stderr, "%s %s: -k must be at least -n.\n", MLR_GLOBALS.bargv0, verb);
+			return NULL;
+		}
+	} else if (approx_capacity != UNSPECIFIED_APPROX_CAPACITY) {
+		pusage_func(stderr, argv[0], verb);
 		return NULL;
 	}
 
 	return mapper_most_or_least_frequent_alloc(pstate, pgroup_by_field_names, max_output_length, descending,
-		show_counts, output_field_name);
+		show_counts, output_field_name, do_approx ? approx_capacity : 0LL);
 }
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_most_or_least_frequent_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_names,
-	long long max_output_length, int descending, int show_counts, char* output_field_name)
+	long long max_output_length, int descending, int show_counts, char* output_field_name,
+	long long approx_capacity)
 {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_most_or_least_frequent_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_most_or_least_frequent_state_t));
 
@@ -140,9 +186,13 @@ static mapper_t* mapper_most_or_least_frequent_alloc(ap_state_t* pargp, slls_t*
 	pstate->descending            = descending;
 	pstate->show_counts           = show_counts;
 	pstate->output_field_name     = output_field_name;
+	pstate->pgroup_by_field_values = string_array_alloc(pgroup_by_field_names->length);
+	pstate->pspace_saving         = (approx_capacity > 0LL) ? space_saving_alloc(approx_capacity) : NULL;
 
 	pmapper->pvstate       = pstate;
-	pmapper->pprocess_func = mapper_most_or_least_frequent_process;
+	pmapper->pprocess_func = (approx_capacity > 0LL)
+		? mapper_most_frequent_process_approx
+		: mapper_most_or_least_frequent_process;
 	pmapper->pfree_func    = mapper_most_or_least_frequent_free;
 
 	return pmapper;
@@ -157,6 +207,8 @@ static void mapper_most_or_least_frequent_free(mapper_t* pmapper, context_t* _)
 		free(pcount);
 	}
 	lhmslv_free(pstate->pcounts_by_group);
+	string_array_free(pstate->pgroup_by_field_values);
+	space_saving_free(pstate->pspace_saving);
 	pstate->pgroup_by_field_names = NULL;
 	pstate->pcounts_by_group = NULL;
 	ap_free(pstate->pargp);
@@ -225,6 +277,48 @@ static sllv_t* mapper_most_or_least_frequent_process(lrec_t* pinrec, context_t*
 	}
 }
 
+// ----------------------------------------------------------------
+static sllv_t* mapper_most_frequent_process_approx(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+	mapper_most_or_least_frequent_state_t* pstate = pvstate;
+
+	if (pinrec != NULL) { // Not end of input record stream
+		if (mlr_reference_selected_values_from_record_into_array(pinrec,
+			pstate->pgroup_by_field_names, pstate->pgroup_by_field_values))
+		{
+			space_saving_ingest(pstate->pspace_saving, pstate->pgroup_by_field_values);
+		}
+		lrec_free(pinrec);
+		return NULL;
+
+	} else { // End of input record stream
+		space_saving_t* pss = pstate->pspace_saving;
+		space_saving_entry_t** pentries = space_saving_sorted_entries(pss);
+
+		sllv_t* poutrecs = sllv_alloc();
+		int output_length = (pss->size < pstate->max_output_length) ? pss->size : pstate->max_output_length;
+		for (int i = 0; i < output_length; i++) {
+			lrec_t* poutrec = lrec_unbacked_alloc();
+			sllse_t* pb = pstate->pgroup_by_field_names->phead;
+			sllse_t* pc =         pentries[i]->key->phead;
+			for ( ; pb != NULL && pc != NULL; pb = pb->pnext, pc = pc->pnext) {
+				lrec_put(poutrec, pb->value, pc->value, NO_FREE);
+			}
+			if (pstate->show_counts) {
+				lrec_put(poutrec, pstate->output_field_name,
+					mlr_alloc_string_from_ll(pentries[i]->count), FREE_ENTRY_VALUE);
+				lrec_put(poutrec, mlr_paste_2_strings(pstate->output_field_name, "_error"),
+					mlr_alloc_string_from_ll(pentries[i]->error), FREE_ENTRY_KEY|FREE_ENTRY_VALUE);
+			}
+			sllv_append(poutrecs, poutrec);
+		}
+		sllv_append(poutrecs, NULL);
+
+		free(pentries);
+		return poutrecs;
+	}
+}
+
+// ----------------------------------------------------------------
 static int descending_vcmp(const void* pva, const void* pvb) {
 	const sort_pair_t* pa = pva;
 	const sort_pair_t* pb = pvb;
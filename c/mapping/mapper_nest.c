@@ -179,7 +179,7 @@ static mapper_t* mapper_nest_alloc(ap_state_t* pargp, char* argv0,
 	char* field_name, char* nested_fs, char* nested_ps,
 	int do_explode, int do_pairs, int do_across_fields)
 {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_nest_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_nest_state_t));
 
@@ -39,7 +39,7 @@ static void mapper_nothing_usage(FILE* o, char* argv0, char* verb) {
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_nothing_alloc(ap_state_t* pargp, int do_counters, char* counter_field_name) {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 	pmapper->pvstate       = NULL;
 	pmapper->pprocess_func = mapper_nothing_process;
 	pmapper->pfree_func    = mapper_nothing_free;
@@ -1,17 +1,23 @@
 #include "lib/mlr_globals.h"
 #include "lib/mlrutil.h"
 #include "lib/string_builder.h"
+#include "lib/string_arena.h"
 #include "cli/mlrcli.h"
 #include "containers/lrec.h"
 #include "containers/sllv.h"
 #include "containers/lhmsv.h"
 #include "containers/mlhmmv.h"
+#include "containers/mixutil.h"
 #include "parsing/mlr_dsl_wrapper.h"
 #include "dsl/rval_evaluators.h"
 #include "dsl/mlr_dsl_cst.h"
+#include "dsl/mlr_dsl_batch_filter.h"
+#include "dsl/type_inference.h"
+#include "input/lrec_readers.h"
 #include "mapping/mappers.h"
 
 #define DEFAULT_OOSVAR_FLATTEN_SEPARATOR ":"
+#define STRING_ARENA_CHUNK_SIZE 4096
 
 // ----------------------------------------------------------------
 typedef struct _mapper_put_or_filter_state_t {
@@ -30,10 +36,22 @@ typedef struct _mapper_put_or_filter_state_t {
 
 	local_stack_t* plocal_stack;
 	loop_stack_t*  ploop_stack;
+	string_arena_t* pstring_arena; // For intermediates in DSL string-function chains
+	sllv_t*        poutrecs;      // Records from emit, tee, etc.; emptied after each record
+	slls_t*        pfield_names_read; // For projection pushdown; null if not known statically
 
 	int            put_output_disabled; // mlr put -q
 	int            do_final_filter;     // mlr filter
 	int            negate_final_filter; // mlr filter -x
+
+	// mlr filter -b: records are held until a block is full, then filtered all at once.
+	batch_filter_t* pbatch_filter; // NULL if not batching
+	lrec_t**       pbatch_recs;
+	char*          pbatch_mask;
+	int            batch_size;
+	int            batch_length;
+
+	lrec_prefilter_t* pprefilter; // For predicate pushdown; NULL if not eligible
 } mapper_put_or_filter_state_t;
 
 typedef struct _expression_info_t {
@@ -65,6 +83,7 @@ static mapper_t* mapper_put_or_filter_alloc(
 	int                put_output_disabled, // mlr put -q
 	int                do_final_filter,     // mlr filter
 	int                negate_final_filter, // mlr filter -x
+	int                batch_size,          // mlr filter -b
 	int                type_inferencing,
 	char*              oosvar_flatten_separator,
 	int                flush_every_record,
@@ -72,8 +91,17 @@ static mapper_t* mapper_put_or_filter_alloc(
 	cli_writer_opts_t* pmain_writer_opts);
 
 static void      mapper_put_or_filter_free(mapper_t* pmapper, context_t* pctx);
-
-static sllv_t*   mapper_put_or_filter_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static hss_t*    mapper_put_or_filter_input_fields(void* pvstate, hss_t* pdownstream_fields);
+static lrec_prefilter_t* mapper_put_or_filter_prefilter(void* pvstate);
+static lrec_prefilter_t* prefilter_alloc_from_cst(mlr_dsl_cst_t* pcst, int type_inferencing);
+
+static void      mapper_put_or_filter_push(lrec_t* pinrec, context_t* pctx, void* pvstate,
+	mapper_emitter_t* pemitter);
+static void      mapper_put_or_filter_emit_outrecs(sllv_t* poutrecs, context_t* pctx, mapper_emitter_t* pemitter);
+static void      mapper_filter_batch_push(lrec_t* pinrec, context_t* pctx, void* pvstate,
+	mapper_emitter_t* pemitter);
+static void      mapper_filter_batch_flush(mapper_put_or_filter_state_t* pstate, context_t* pctx,
+	mapper_emitter_t* pemitter);
 
 // ----------------------------------------------------------------
 mapper_setup_t mapper_put_setup = {
@@ -228,6 +256,12 @@ static void shared_usage(FILE* o, char* argv0, char* verb) {
 	}
 	if (streq(verb, "filter")) {
 		fprintf(o, "-x: Prints records for which {expression} evaluates to false.\n");
+		fprintf(o, "-b {n}: Evaluates the filter expression over blocks of n records at a time,\n");
+		fprintf(o, "    column by column, which is faster for large inputs. This applies only\n");
+		fprintf(o, "    when the expression consists solely of field names, literals, + - * /,\n");
+		fprintf(o, "    comparisons, and && || !; otherwise -b is ignored. Output is delayed by\n");
+		fprintf(o, "    up to n records, and NR/FNR/FILENAME seen by verbs after this one in a\n");
+		fprintf(o, "    then-chain are those of the last record read.\n");
 	}
 	fprintf(o, "\n");
 
@@ -262,6 +296,7 @@ static mapper_t* shared_parse_cli(int* pargi, int argc, char** argv,
 	int     put_output_disabled      = FALSE;
 	int     do_final_filter          = FALSE;
 	int     negate_final_filter      = FALSE;
+	int     batch_size               = 0;
 	int     type_inferencing         = TYPE_INFER_STRING_FLOAT_INT;
 	int     print_ast                = FALSE;
 	int     trace_stack_allocation   = FALSE;
@@ -333,6 +368,18 @@ static mapper_t* shared_parse_cli(int* pargi, int argc, char** argv,
 		} else if (streq(argv[argi], "-x") && streq(verb, "filter")) {
 			negate_final_filter = TRUE;
 			argi += 1;
+		} else if (streq(argv[argi], "-b") && streq(verb, "filter")) {
+			if ((argc - argi) < 2) {
+				mapper_put_or_filter_usage(stderr, argv[0], verb);
+				return NULL;
+			}
+			long long n = 0LL;
+			if (!mlr_try_int_from_string(argv[argi+1], &n) || n < 1LL || n > 1000000LL) {
+				mapper_put_or_filter_usage(stderr, argv[0], verb);
+				return NULL;
+			}
+			batch_size = n;
+			argi += 2;
 
 		} else if (streq(argv[argi], "-S")) {
 			type_inferencing = TYPE_INFER_STRING_ONLY;
@@ -412,8 +459,8 @@ static mapper_t* shared_parse_cli(int* pargi, int argc, char** argv,
 
 	*pargi = argi;
 	return mapper_put_or_filter_alloc(mlr_dsl_expression, print_ast, trace_stack_allocation, trace_execution,
-		past, put_output_disabled, do_final_filter, negate_final_filter, type_inferencing, oosvar_flatten_separator,
-			flush_every_record, pwriter_opts, pmain_writer_opts);
+		past, put_output_disabled, do_final_filter, negate_final_filter, batch_size, type_inferencing,
+			oosvar_flatten_separator, flush_every_record, pwriter_opts, pmain_writer_opts);
 }
 
 // ----------------------------------------------------------------
@@ -426,6 +473,7 @@ static mapper_t* mapper_put_or_filter_alloc(
 	int                put_output_disabled, // mlr put -q
 	int                do_final_filter,     // mlr filter
 	int                negate_final_filter, // mlr filter -x
+	int                batch_size,          // mlr filter -b
 	int                type_inferencing,
 	char*              oosvar_flatten_separator,
 	int                flush_every_record,
@@ -436,6 +484,12 @@ static mapper_t* mapper_put_or_filter_alloc(
 	// Retain the string contents along with any in-pointers from the AST/CST
 	pstate->mlr_dsl_expression = mlr_dsl_expression;
 	pstate->past                     = past;
+	// This needs to be done before the CST build reorganizes the AST.
+	pstate->pfield_names_read        = slls_alloc();
+	if (!mlr_dsl_ast_node_get_field_names(past->proot, pstate->pfield_names_read)) {
+		slls_free(pstate->pfield_names_read);
+		pstate->pfield_names_read = NULL;
+	}
 	pstate->pcst                     = mlr_dsl_cst_alloc(past, print_ast, trace_stack_allocation,
 		type_inferencing, flush_every_record, do_final_filter, negate_final_filter);
 	pstate->at_begin                     = TRUE;
@@ -446,14 +500,37 @@ static mapper_t* mapper_put_or_filter_alloc(
 	pstate->flush_every_record           = flush_every_record;
 	pstate->plocal_stack                 = local_stack_alloc();
 	pstate->ploop_stack                  = loop_stack_alloc();
+	pstate->pstring_arena                = string_arena_alloc(STRING_ARENA_CHUNK_SIZE);
+	pstate->poutrecs                     = sllv_alloc();
 	pstate->pwriter_opts                 = pwriter_opts;
 
 	cli_merge_writer_opts(pstate->pwriter_opts, pmain_writer_opts);
 
-	mapper_t* pmapper      = mlr_malloc_or_die(sizeof(mapper_t));
+	// Tracing is per statement, so it needs the per-record path.
+	pstate->pbatch_filter = NULL;
+	pstate->pbatch_recs   = NULL;
+	pstate->pbatch_mask   = NULL;
+	pstate->batch_size    = batch_size;
+	pstate->batch_length  = 0;
+	if (do_final_filter && batch_size > 0 && !trace_execution) {
+		pstate->pbatch_filter = batch_filter_alloc(pstate->pcst, negate_final_filter, type_inferencing, batch_size);
+		if (pstate->pbatch_filter != NULL) {
+			pstate->pbatch_recs = mlr_malloc_or_die(batch_size * sizeof(lrec_t*));
+			pstate->pbatch_mask = mlr_malloc_or_die(batch_size * sizeof(char));
+		}
+	}
+	pstate->pprefilter = (do_final_filter && !negate_final_filter && !trace_execution)
+		? prefilter_alloc_from_cst(pstate->pcst, type_inferencing)
+		: NULL;
+
+	mapper_t* pmapper      = mapper_alloc();
 	pmapper->pvstate       = (void*)pstate;
-	pmapper->pprocess_func = mapper_put_or_filter_process;
+	pmapper->ppush_func    = (pstate->pbatch_filter != NULL)
+		? mapper_filter_batch_push
+		: mapper_put_or_filter_push;
 	pmapper->pfree_func    = mapper_put_or_filter_free;
+	pmapper->pinput_fields_func = mapper_put_or_filter_input_fields;
+	pmapper->pprefilter_func    = mapper_put_or_filter_prefilter;
 
 	return pmapper;
 }
@@ -462,9 +539,18 @@ static void mapper_put_or_filter_free(mapper_t* pmapper, context_t* pctx) {
 	mapper_put_or_filter_state_t* pstate = pmapper->pvstate;
 
 	free(pstate->mlr_dsl_expression);
+	batch_filter_free(pstate->pbatch_filter);
+	for (int i = 0; i < pstate->batch_length; i++)
+		lrec_free(pstate->pbatch_recs[i]);
+	free(pstate->pbatch_recs);
+	free(pstate->pbatch_mask);
+	lrec_prefilter_free(pstate->pprefilter);
 	mlhmmv_root_free(pstate->poosvars);
 	local_stack_free(pstate->plocal_stack);
 	loop_stack_free(pstate->ploop_stack);
+	string_arena_free(pstate->pstring_arena);
+	sllv_free(pstate->poutrecs);
+	slls_free(pstate->pfield_names_read);
 	mlr_dsl_cst_free(pstate->pcst, pctx);
 	// Free what's left of the stripped AST after the CST reorganized it.
 	mlr_dsl_ast_free(pstate->past);
@@ -474,6 +560,101 @@ static void mapper_put_or_filter_free(mapper_t* pmapper, context_t* pctx) {
 	free(pmapper);
 }
 
+// ----------------------------------------------------------------
+// With put -q the input records go no further, so only the fields the
+// expression names are needed. Otherwise the input records are passed along
+// and the fields needed downstream are needed here as well.
+static hss_t* mapper_put_or_filter_input_fields(void* pvstate, hss_t* pdownstream_fields) {
+	mapper_put_or_filter_state_t* pstate = pvstate;
+	if (pstate->pfield_names_read == NULL)
+		return NULL;
+	if (pstate->put_output_disabled)
+		return hss_from_slls(pstate->pfield_names_read);
+	return mapper_pass_through_input_fields(pdownstream_fields, pstate->pfield_names_read);
+}
+
+// ----------------------------------------------------------------
+// Predicate pushdown: when the filter expression is a conjunction of
+// comparisons of the form $name == literal, the reader can drop most of the
+// records it would reject without parsing them. See input/lrec_readers.h.
+// Anything else in the main block could have side effects, or see the dropped
+// records some other way, so it makes the expression ineligible.
+
+static lrec_prefilter_t* mapper_put_or_filter_prefilter(void* pvstate) {
+	mapper_put_or_filter_state_t* pstate = pvstate;
+	return pstate->pprefilter;
+}
+
+static int prefilter_add_terms(lrec_prefilter_t* pprefilter, mlr_dsl_ast_node_t* pnode) {
+	if (pnode->type != MD_AST_NODE_TYPE_OPERATOR || pnode->pchildren->length != 2)
+		return FALSE;
+	mlr_dsl_ast_node_t* pleft  = pnode->pchildren->phead->pvvalue;
+	mlr_dsl_ast_node_t* pright = pnode->pchildren->phead->pnext->pvvalue;
+
+	if (streq(pnode->text, "&&"))
+		return prefilter_add_terms(pprefilter, pleft) && prefilter_add_terms(pprefilter, pright);
+	if (!streq(pnode->text, "=="))
+		return FALSE;
+
+	int literal_is_left = pright->type == MD_AST_NODE_TYPE_FIELD_NAME;
+	mlr_dsl_ast_node_t* pfield   = literal_is_left ? pright : pleft;
+	mlr_dsl_ast_node_t* pliteral = literal_is_left ? pleft : pright;
+	if (pfield->type != MD_AST_NODE_TYPE_FIELD_NAME)
+		return FALSE;
+
+	// As in rval_evaluator_alloc_from_string_literal and rval_evaluator_alloc_from_numeric_literal.
+	// Backslashes are left out since string literals can interpolate regex captures.
+	mv_t literal;
+	long long intv;
+	double fltv;
+	if (pliteral->type == MD_AST_NODE_TYPE_STRING_LITERAL) {
+		if (strchr(pliteral->text, '\\') != NULL)
+			return FALSE;
+		literal = mv_from_string_no_free(pliteral->text);
+	} else if (pliteral->type == MD_AST_NODE_TYPE_NUMERIC_LITERAL) {
+		if (mlr_try_int_from_string(pliteral->text, &intv))
+			literal = mv_from_int(intv);
+		else if (mlr_try_float_from_string(pliteral->text, &fltv))
+			literal = mv_from_float(fltv);
+		else
+			return FALSE;
+	} else {
+		return FALSE;
+	}
+
+	lrec_prefilter_add_term(pprefilter, pfield->text, literal, literal_is_left);
+	return TRUE;
+}
+
+static lrec_prefilter_t* prefilter_alloc_from_cst(mlr_dsl_cst_t* pcst, int type_inferencing) {
+	mlr_dsl_ast_node_t* pmain_block = pcst->paast->pmain_block;
+	if (pmain_block->pchildren->length != 1)
+		return NULL;
+
+	mv_t (*ptype_infer_func)(char* string) = NULL;
+	switch (type_inferencing) {
+	case TYPE_INFER_STRING_ONLY:
+		ptype_infer_func = mv_ref_type_infer_string;
+		break;
+	case TYPE_INFER_STRING_FLOAT:
+		ptype_infer_func = mv_ref_type_infer_string_or_float;
+		break;
+	case TYPE_INFER_STRING_FLOAT_INT:
+		ptype_infer_func = mv_ref_type_infer_string_or_float_or_int;
+		break;
+	default:
+		MLR_INTERNAL_CODING_ERROR();
+		break;
+	}
+
+	lrec_prefilter_t* pprefilter = lrec_prefilter_alloc(ptype_infer_func);
+	if (!prefilter_add_terms(pprefilter, pmain_block->pchildren->phead->pvvalue)) {
+		lrec_prefilter_free(pprefilter);
+		return NULL;
+	}
+	return pprefilter;
+}
+
 // ----------------------------------------------------------------
 // The typed-overlay holds intermediate values such as in
 //
@@ -524,10 +705,12 @@ static void mapper_put_or_filter_free(mapper_t* pmapper, context_t* pctx) {
 // which the current stream-record was obtained.
 // ----------------------------------------------------------------
 
-static sllv_t* mapper_put_or_filter_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+static void mapper_put_or_filter_push(lrec_t* pinrec, context_t* pctx, void* pvstate,
+	mapper_emitter_t* pemitter)
+{
 	mapper_put_or_filter_state_t* pstate = (mapper_put_or_filter_state_t*)pvstate;
 
-	sllv_t* poutrecs = sllv_alloc();
+	sllv_t* poutrecs = pstate->poutrecs;
 	int should_emit_rec = TRUE;
 
 	if (pstate->at_begin) {
@@ -548,6 +731,7 @@ static sllv_t* mapper_put_or_filter_process(lrec_t* pinrec, context_t* pctx, voi
 			.trace_execution              = pstate->trace_execution,
 			.json_quote_int_keys          = pstate->pwriter_opts->json_quote_int_keys,
 			.json_quote_non_string_values = pstate->pwriter_opts->json_quote_non_string_values,
+			.pstring_arena                = pstate->pstring_arena,
 		};
 		cst_outputs_t cst_outputs = (cst_outputs_t) {
 			.pshould_emit_rec             = &should_emit_rec,
@@ -579,6 +763,7 @@ static sllv_t* mapper_put_or_filter_process(lrec_t* pinrec, context_t* pctx, voi
 			.trace_execution              = pstate->trace_execution,
 			.json_quote_int_keys          = pstate->pwriter_opts->json_quote_int_keys,
 			.json_quote_non_string_values = pstate->pwriter_opts->json_quote_non_string_values,
+			.pstring_arena                = pstate->pstring_arena,
 		};
 		cst_outputs_t cst_outputs = (cst_outputs_t) {
 			.pshould_emit_rec             = &should_emit_rec,
@@ -590,8 +775,9 @@ static sllv_t* mapper_put_or_filter_process(lrec_t* pinrec, context_t* pctx, voi
 		mlr_dsl_cst_handle_top_level_statement_blocks(pstate->pcst->pend_blocks, &variables, &cst_outputs);
 
 		string_array_free(pregex_captures);
-		sllv_append(poutrecs, NULL);
-		return poutrecs;
+		mapper_put_or_filter_emit_outrecs(poutrecs, pctx, pemitter);
+		mapper_emit(pemitter, NULL, pctx);
+		return;
 	}
 
 	lhmsmv_t* ptyped_overlay = lhmsmv_alloc();
@@ -614,6 +800,7 @@ static sllv_t* mapper_put_or_filter_process(lrec_t* pinrec, context_t* pctx, voi
 		.trace_execution              = pstate->trace_execution,
 		.json_quote_int_keys          = pstate->pwriter_opts->json_quote_int_keys,
 		.json_quote_non_string_values = pstate->pwriter_opts->json_quote_non_string_values,
+		.pstring_arena                = pstate->pstring_arena,
 	};
 	cst_outputs_t cst_outputs = (cst_outputs_t) {
 		.pshould_emit_rec             = &should_emit_rec,
@@ -643,12 +830,56 @@ static sllv_t* mapper_put_or_filter_process(lrec_t* pinrec, context_t* pctx, voi
 	}
 	lhmsmv_free(variables.ptyped_overlay);
 	string_array_free(pregex_captures);
+	// String chains release what they use, so this is only a backstop.
+	string_arena_reset(pstate->pstring_arena);
+
+	// Records emitted by the DSL go before the current record.
+	mapper_put_or_filter_emit_outrecs(poutrecs, pctx, pemitter);
 
 	// Note variables.pinrec pointer can update on '$* = ...'
 	if (should_emit_rec && !pstate->put_output_disabled) {
-		sllv_append(poutrecs, variables.pinrec);
+		mapper_emit(pemitter, variables.pinrec, pctx);
 	} else {
 		lrec_free(variables.pinrec);
 	}
-	return poutrecs;
+}
+
+// The list is kept for the next record, so when the DSL emits nothing there is
+// nothing to allocate.
+static void mapper_put_or_filter_emit_outrecs(sllv_t* poutrecs, context_t* pctx, mapper_emitter_t* pemitter) {
+	while (poutrecs->phead != NULL)
+		mapper_emit(pemitter, sllv_pop(poutrecs), pctx);
+}
+
+// ----------------------------------------------------------------
+// Batched mlr filter: see dsl/mlr_dsl_batch_filter.h. Eligible expressions have no begin/end blocks, so
+// there is nothing to do here but collect records and filter a block at a time.
+static void mapper_filter_batch_push(lrec_t* pinrec, context_t* pctx, void* pvstate,
+	mapper_emitter_t* pemitter)
+{
+	mapper_put_or_filter_state_t* pstate = (mapper_put_or_filter_state_t*)pvstate;
+
+	if (pinrec == NULL) { // End of input stream
+		mapper_filter_batch_flush(pstate, pctx, pemitter);
+		mapper_emit(pemitter, NULL, pctx);
+		return;
+	}
+
+	pstate->pbatch_recs[pstate->batch_length++] = pinrec;
+	if (pstate->batch_length == pstate->batch_size)
+		mapper_filter_batch_flush(pstate, pctx, pemitter);
+}
+
+static void mapper_filter_batch_flush(mapper_put_or_filter_state_t* pstate, context_t* pctx,
+	mapper_emitter_t* pemitter)
+{
+	int n = pstate->batch_length;
+	batch_filter_evaluate(pstate->pbatch_filter, pstate->pbatch_recs, n, pstate->pbatch_mask);
+	for (int i = 0; i < n; i++) {
+		if (pstate->pbatch_mask[i])
+			mapper_emit(pemitter, pstate->pbatch_recs[i], pctx);
+		else
+			lrec_free(pstate->pbatch_recs[i]);
+	}
+	pstate->batch_length = 0;
 }
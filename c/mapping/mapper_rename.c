@@ -3,13 +3,14 @@
 #include "lib/string_builder.h"
 #include "containers/lhmss.h"
 #include "containers/sllv.h"
+#include "containers/schema_cache.h"
 #include "mapping/mappers.h"
 #include "cli/argparse.h"
 
 #define RENAME_SB_ALLOC_LENGTH 16
 
 typedef struct _regex_pair_t {
-	regex_t regex;
+	mlr_regex_t regex;
 	char*   replacement;
 } regex_pair_t;
 
@@ -19,6 +20,7 @@ typedef struct _mapper_rename_state_t {
 	sllv_t*  pregex_pairs;
 	string_builder_t* psb;
 	int      do_gsub;
+	schema_cache_t* pschema_cache; // renames done, as old/new name pairs, by field names
 } mapper_rename_state_t;
 
 static void      mapper_rename_usage(FILE* o, char* argv0, char* verb);
@@ -26,8 +28,10 @@ static mapper_t* mapper_rename_parse_cli(int* pargi, int argc, char** argv,
 	cli_reader_opts_t* _, cli_writer_opts_t* __);
 static mapper_t* mapper_rename_alloc(ap_state_t* pargp, lhmss_t* pold_to_new, int do_regexes, int do_gsub);
 static void      mapper_rename_free(mapper_t* pmapper, context_t* _);
-static sllv_t*   mapper_rename_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
-static sllv_t*   mapper_rename_regex_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static void      mapper_rename_push(lrec_t* pinrec, context_t* pctx, void* pvstate, mapper_emitter_t* pemitter);
+static void      mapper_rename_free_renames(void* pvvalue);
+static void      mapper_rename_regex_push(lrec_t* pinrec, context_t* pctx, void* pvstate,
+	mapper_emitter_t* pemitter);
 
 // ----------------------------------------------------------------
 mapper_setup_t mapper_rename_setup = {
@@ -104,13 +108,13 @@ static mapper_t* mapper_rename_parse_cli(int* pargi, int argc, char** argv,
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_rename_alloc(ap_state_t* pargp, lhmss_t* pold_to_new, int do_regexes, int do_gsub) {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_rename_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_rename_state_t));
 
 	pstate->pargp = pargp;
 	if (do_regexes) {
-		pmapper->pprocess_func = mapper_rename_regex_process;
+		pmapper->ppush_func    = mapper_rename_regex_push;
 		pstate->pold_to_new    = pold_to_new;
 		pstate->pregex_pairs   = sllv_alloc();
 
@@ -119,19 +123,21 @@ static mapper_t* mapper_rename_alloc(ap_state_t* pargp, lhmss_t* pold_to_new, in
 			char* replacement  = pe->value;
 
 			regex_pair_t* ppair = mlr_malloc_or_die(sizeof(regex_pair_t));
-			regcomp_or_die_quoted(&ppair->regex, regex_string, 0);
+			mlr_regcomp_or_die_quoted(&ppair->regex, regex_string, 0);
 			ppair->replacement = replacement;
 			sllv_append(pstate->pregex_pairs, ppair);
 		}
 
 		pstate->psb     = sb_alloc(RENAME_SB_ALLOC_LENGTH);
 		pstate->do_gsub = do_gsub;
+		pstate->pschema_cache = schema_cache_alloc(mapper_rename_free_renames);
 	} else {
-		pmapper->pprocess_func = mapper_rename_process;
+		pmapper->ppush_func    = mapper_rename_push;
 		pstate->pold_to_new    = pold_to_new;
 		pstate->pregex_pairs   = NULL;
 		pstate->psb            = NULL;
 		pstate->do_gsub        = FALSE;
+		pstate->pschema_cache  = NULL;
 	}
 	pmapper->pfree_func = mapper_rename_free;
 
@@ -145,20 +151,21 @@ static void mapper_rename_free(mapper_t* pmapper, context_t* _) {
 	if (pstate->pregex_pairs != NULL) {
 		for (sllve_t* pe = pstate->pregex_pairs->phead; pe != NULL; pe = pe->pnext) {
 			regex_pair_t* ppair = pe->pvvalue;
-			regfree(&ppair->regex);
+			mlr_regfree(&ppair->regex);
 			// replacement is in pthe old_to_new list, already freed
 			free(ppair);
 		}
 		sllv_free(pstate->pregex_pairs);
 	}
 	sb_free(pstate->psb);
+	schema_cache_free(pstate->pschema_cache);
 	ap_free(pstate->pargp);
 	free(pstate);
 	free(pmapper);
 }
 
 // ----------------------------------------------------------------
-static sllv_t* mapper_rename_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+static void mapper_rename_push(lrec_t* pinrec, context_t* pctx, void* pvstate, mapper_emitter_t* pemitter) {
 	if (pinrec != NULL) {
 		mapper_rename_state_t* pstate = (mapper_rename_state_t*)pvstate;
 		for (lhmsse_t* pe = pstate->pold_to_new->phead; pe != NULL; pe = pe->pnext) {
@@ -168,20 +175,34 @@ static sllv_t* mapper_rename_process(lrec_t* pinrec, context_t* pctx, void* pvst
 				lrec_rename(pinrec, old_name, new_name, FALSE);
 			}
 		}
-		return sllv_single(pinrec);
-	}
-	else {
-		return sllv_single(NULL);
 	}
+	mapper_emit(pemitter, pinrec, pctx);
+}
+
+static void mapper_rename_free_renames(void* pvvalue) {
+	slls_free(pvvalue);
 }
 
-static sllv_t* mapper_rename_regex_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+// The renames depend only on the field names, so the regexes are applied once per distinct schema, with the
+// renames done recorded as old/new name pairs, in order, for replay on later records with the same schema.
+static void mapper_rename_regex_push(lrec_t* pinrec, context_t* pctx, void* pvstate,
+	mapper_emitter_t* pemitter)
+{
 	if (pinrec != NULL) {
 		mapper_rename_state_t* pstate = (mapper_rename_state_t*)pvstate;
 
+		slls_t* prenames = schema_cache_get(pstate->pschema_cache, pinrec);
+		if (prenames != NULL) {
+			for (sllse_t* pe = prenames->phead; pe != NULL; pe = pe->pnext->pnext)
+				lrec_rename(pinrec, pe->value, mlr_strdup_or_die(pe->pnext->value), TRUE);
+			mapper_emit(pemitter, pinrec, pctx);
+			return;
+		}
+		prenames = slls_alloc();
+
 		for (sllve_t* pe = pstate->pregex_pairs->phead; pe != NULL; pe = pe->pnext) {
 			regex_pair_t* ppair = pe->pvvalue;
-			regex_t* pregex = &ppair->regex;
+			mlr_regex_t* pregex = &ppair->regex;
 			char* replacement = ppair->replacement;
 			for (lrece_t* pf = pinrec->phead; pf != NULL; pf = pf->pnext) {
 				int matched = FALSE;
@@ -194,12 +215,17 @@ static sllv_t* mapper_rename_regex_process(lrec_t* pinrec, context_t* pctx, void
 					int new_needs_freeing = FALSE;
 					if (free_flags & FREE_ENTRY_VALUE)
 						new_needs_freeing = TRUE;
-					if (matched)
+					if (matched) {
+						slls_append_with_free(prenames, mlr_strdup_or_die(old_name));
+						slls_append_with_free(prenames, mlr_strdup_or_die(new_name));
 						lrec_rename(pinrec, old_name, new_name, new_needs_freeing);
+					}
 				} else {
 					char* new_name = regex_sub(old_name, pregex, pstate->psb, replacement, &matched,
 						&all_captured);
 					if (matched) {
+						slls_append_with_free(prenames, mlr_strdup_or_die(old_name));
+						slls_append_with_free(prenames, mlr_strdup_or_die(new_name));
 						lrec_rename(pinrec, old_name, new_name, TRUE);
 					} else {
 						free(new_name);
@@ -207,10 +233,7 @@ static sllv_t* mapper_rename_regex_process(lrec_t* pinrec, context_t* pctx, void
 				}
 			}
 		}
-
-		return sllv_single(pinrec);
-	}
-	else {
-		return sllv_single(NULL);
+		schema_cache_put(pstate->pschema_cache, prenames);
 	}
+	mapper_emit(pemitter, pinrec, pctx);
 }
@@ -213,7 +213,7 @@ static mapper_t* mapper_reshape_alloc(
 	char*   split_out_key_field_name,
 	char*   split_out_value_field_name)
 {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_reshape_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_reshape_state_t));
 
@@ -9,19 +9,23 @@
 #include "containers/lhmslv.h"
 #include "containers/lhmsv.h"
 #include "containers/mixutil.h"
+#include "input/lrec_readers.h"
 #include "mapping/mappers.h"
 #include "cli/argparse.h"
 
 // ----------------------------------------------------------------
+// Holds either records or, with a retainer, where the records are in the input.
 typedef struct _sample_bucket_t {
 	int nalloc;
 	int nused;
 	lrec_t** plrecs;
+	lrec_extent_t* pextents;
 } sample_bucket_t;
 
-sample_bucket_t* sample_bucket_alloc(int nalloc);
+sample_bucket_t* sample_bucket_alloc(int nalloc, int use_extents);
 void             sample_bucket_free(sample_bucket_t* pbucket);
 void             sample_bucket_handle(sample_bucket_t* pbucket, lrec_t* prec, int record_number);
+void             sample_bucket_handle_extent(sample_bucket_t* pbucket, lrec_extent_t extent, int record_number);
 
 // ----------------------------------------------------------------
 typedef struct _mapper_sample_state_t {
@@ -29,6 +33,7 @@ typedef struct _mapper_sample_state_t {
 	slls_t* pgroup_by_field_names;
 	unsigned long long sample_count;
 	lhmslv_t* pbuckets_by_group;
+	lrec_retainer_t* pretainer;
 } mapper_sample_state_t;
 
 static void      mapper_sample_usage(FILE* o, char* argv0, char* verb);
@@ -37,7 +42,8 @@ static mapper_t* mapper_sample_parse_cli(int* pargi, int argc, char** argv,
 static mapper_t* mapper_sample_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_names,
 	unsigned long long sample_count);
 static void      mapper_sample_free(mapper_t* pmapper, context_t* _);
-static sllv_t*   mapper_sample_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static void      mapper_sample_set_retainer(void* pvstate, lrec_retainer_t* pretainer);
+static void      mapper_sample_push(lrec_t* pinrec, context_t* pctx, void* pvstate, mapper_emitter_t* pemitter);
 
 // ----------------------------------------------------------------
 mapper_setup_t mapper_sample_setup = {
@@ -84,7 +90,7 @@ static mapper_t* mapper_sample_parse_cli(int* pargi, int argc, char** argv,
 static mapper_t* mapper_sample_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_names,
 	unsigned long long sample_count)
 {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_sample_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_sample_state_t));
 
@@ -92,10 +98,12 @@ static mapper_t* mapper_sample_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_
 	pstate->pgroup_by_field_names = pgroup_by_field_names;
 	pstate->sample_count          = sample_count;
 	pstate->pbuckets_by_group     = lhmslv_alloc();
+	pstate->pretainer             = NULL;
 
 	pmapper->pvstate              = pstate;
-	pmapper->pprocess_func        = mapper_sample_process;
+	pmapper->ppush_func           = mapper_sample_push;
 	pmapper->pfree_func           = mapper_sample_free;
+	pmapper->pset_retainer_func = mapper_sample_set_retainer;
 
 	return pmapper;
 }
@@ -115,8 +123,13 @@ static void mapper_sample_free(mapper_t* pmapper, context_t* _) {
 	free(pmapper);
 }
 
+static void mapper_sample_set_retainer(void* pvstate, lrec_retainer_t* pretainer) {
+	mapper_sample_state_t* pstate = pvstate;
+	pstate->pretainer = pretainer;
+}
+
 // ----------------------------------------------------------------
-static sllv_t* mapper_sample_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+static void mapper_sample_push(lrec_t* pinrec, context_t* pctx, void* pvstate, mapper_emitter_t* pemitter) {
 	mapper_sample_state_t* pstate = pvstate;
 	if (pinrec != NULL) {
 		slls_t* pgroup_by_field_values = mlr_reference_selected_values_from_record(pinrec,
@@ -124,46 +137,60 @@ static sllv_t* mapper_sample_process(lrec_t* pinrec, context_t* pctx, void* pvst
 		if (pgroup_by_field_values != NULL) {
 			sample_bucket_t* pbucket = lhmslv_get(pstate->pbuckets_by_group, pgroup_by_field_values);
 			if (pbucket == NULL) {
-				pbucket = sample_bucket_alloc(pstate->sample_count);
+				pbucket = sample_bucket_alloc(pstate->sample_count, pstate->pretainer != NULL);
 				lhmslv_put(pstate->pbuckets_by_group, slls_copy(pgroup_by_field_values), pbucket,
 					FREE_ENTRY_KEY);
 			}
-			sample_bucket_handle(pbucket, pinrec, pctx->nr);
-			slls_free(pgroup_by_field_values);
+			if (pstate->pretainer != NULL) {
+				sample_bucket_handle_extent(pbucket, pstate->pretainer->current, pctx->nr);
+				slls_free(pgroup_by_field_values);
+				lrec_free(pinrec);
+			} else {
+				sample_bucket_handle(pbucket, pinrec, pctx->nr);
+				slls_free(pgroup_by_field_values);
+			}
 		} else {
 			lrec_free(pinrec);
 		}
-		return NULL;
 	}
 	else {
-		sllv_t* poutrecs = sllv_alloc();
-
 		for (lhmslve_t* pa = pstate->pbuckets_by_group->phead; pa != NULL; pa = pa->pnext) {
 			sample_bucket_t* pbucket = pa->pvvalue;
 			for (int i = 0; i < pbucket->nused; i++) {
-				sllv_append(poutrecs, pbucket->plrecs[i]);
-				pbucket->plrecs[i] = NULL;
+				if (pstate->pretainer != NULL) {
+					mapper_emit(pemitter, lrec_retainer_reparse(pstate->pretainer, &pbucket->pextents[i]), pctx);
+				} else {
+					mapper_emit(pemitter, pbucket->plrecs[i], pctx);
+					pbucket->plrecs[i] = NULL;
+				}
 			}
 			pbucket->nused = 0;
 		}
-		sllv_append(poutrecs, NULL);
-		return poutrecs;
+		mapper_emit(pemitter, NULL, pctx);
 	}
 }
 
 // ----------------------------------------------------------------
-sample_bucket_t* sample_bucket_alloc(int nalloc) {
+sample_bucket_t* sample_bucket_alloc(int nalloc, int use_extents) {
 	sample_bucket_t* pbucket = mlr_malloc_or_die(sizeof(sample_bucket_t));
 	pbucket->nalloc = nalloc;
 	pbucket->nused  = 0;
-	pbucket->plrecs = mlr_malloc_or_die(nalloc * sizeof(lrec_t*));
+	if (use_extents) {
+		pbucket->plrecs   = NULL;
+		pbucket->pextents = mlr_malloc_or_die(nalloc * sizeof(lrec_extent_t));
+	} else {
+		pbucket->plrecs   = mlr_malloc_or_die(nalloc * sizeof(lrec_t*));
+		pbucket->pextents = NULL;
+	}
 	return pbucket;
 }
 
 void sample_bucket_free(sample_bucket_t* pbucket) {
-	for (int i = 0; i < pbucket->nused; i++)
-		lrec_free(pbucket->plrecs[i]);
+	if (pbucket->plrecs != NULL)
+		for (int i = 0; i < pbucket->nused; i++)
+			lrec_free(pbucket->plrecs[i]);
 	free(pbucket->plrecs);
+	free(pbucket->pextents);
 	free(pbucket);
 }
 
@@ -184,3 +211,14 @@ void sample_bucket_handle(sample_bucket_t* pbucket, lrec_t* prec, int record_num
 		}
 	}
 }
+
+// The same, keeping where the record is in the input.
+void sample_bucket_handle_extent(sample_bucket_t* pbucket, lrec_extent_t extent, int record_number) {
+	if (pbucket->nused < pbucket->nalloc) {
+		pbucket->pextents[pbucket->nused++] = extent;
+	} else {
+		int r = get_mtrand_int31() % record_number;
+		if (r < pbucket->nalloc)
+			pbucket->pextents[r] = extent;
+	}
+}
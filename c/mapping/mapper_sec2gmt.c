@@ -8,7 +8,7 @@
 
 typedef struct _mapper_sec2gmt_state_t {
 	slls_t*  pfield_names;
-	char* format_string;
+	time_format_t* pformat;
 } mapper_sec2gmt_state_t;
 
 static void      mapper_sec2gmt_usage(FILE* o, char* argv0, char* verb);
@@ -82,22 +82,22 @@ static mapper_t* mapper_sec2gmt_parse_cli(int* pargi, int argc, char** argv,
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_sec2gmt_alloc(slls_t* pfield_names, int num_decimal_places) {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_sec2gmt_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_sec2gmt_state_t));
 	pstate->pfield_names   = pfield_names;
 
 	switch(num_decimal_places) {
-	case 0: pstate->format_string  = ISO8601_TIME_FORMAT;   break;
-	case 1: pstate->format_string  = ISO8601_TIME_FORMAT_1; break;
-	case 2: pstate->format_string  = ISO8601_TIME_FORMAT_2; break;
-	case 3: pstate->format_string  = ISO8601_TIME_FORMAT_3; break;
-	case 4: pstate->format_string  = ISO8601_TIME_FORMAT_4; break;
-	case 5: pstate->format_string  = ISO8601_TIME_FORMAT_5; break;
-	case 6: pstate->format_string  = ISO8601_TIME_FORMAT_6; break;
-	case 7: pstate->format_string  = ISO8601_TIME_FORMAT_7; break;
-	case 8: pstate->format_string  = ISO8601_TIME_FORMAT_8; break;
-	case 9: pstate->format_string  = ISO8601_TIME_FORMAT_9; break;
+	case 0: pstate->pformat = time_format_alloc(ISO8601_TIME_FORMAT);   break;
+	case 1: pstate->pformat = time_format_alloc(ISO8601_TIME_FORMAT_1); break;
+	case 2: pstate->pformat = time_format_alloc(ISO8601_TIME_FORMAT_2); break;
+	case 3: pstate->pformat = time_format_alloc(ISO8601_TIME_FORMAT_3); break;
+	case 4: pstate->pformat = time_format_alloc(ISO8601_TIME_FORMAT_4); break;
+	case 5: pstate->pformat = time_format_alloc(ISO8601_TIME_FORMAT_5); break;
+	case 6: pstate->pformat = time_format_alloc(ISO8601_TIME_FORMAT_6); break;
+	case 7: pstate->pformat = time_format_alloc(ISO8601_TIME_FORMAT_7); break;
+	case 8: pstate->pformat = time_format_alloc(ISO8601_TIME_FORMAT_8); break;
+	case 9: pstate->pformat = time_format_alloc(ISO8601_TIME_FORMAT_9); break;
 	default: MLR_INTERNAL_CODING_ERROR(); break;
 	}
 
@@ -111,6 +111,7 @@ static mapper_t* mapper_sec2gmt_alloc(slls_t* pfield_names, int num_decimal_plac
 static void mapper_sec2gmt_free(mapper_t* pmapper, context_t* _) {
 	mapper_sec2gmt_state_t* pstate = pmapper->pvstate;
 	slls_free(pstate->pfield_names);
+	time_format_free(pstate->pformat);
 	free(pstate);
 	free(pmapper);
 }
@@ -133,7 +134,7 @@ static sllv_t* mapper_sec2gmt_process(lrec_t* pinrec, context_t* pctx, void* pvs
 		} else {
 			mv_t mval = mv_scan_number_nullable(sval);
 			if (!mv_is_error(&mval)) {
-				mv_t stamp = time_string_from_seconds(&mval, pstate->format_string);
+				mv_t stamp = time_string_from_seconds_with_format(&mval, pstate->pformat);
 				lrec_put(pinrec, name, stamp.u.strv, FREE_ENTRY_VALUE);
 			}
 		}
@@ -7,6 +7,7 @@
 
 typedef struct _mapper_sec2gmtdate_state_t {
 	slls_t*  pfield_names;
+	time_format_t* pformat;
 } mapper_sec2gmtdate_state_t;
 
 static void      mapper_sec2gmtdate_usage(FILE* o, char* argv0, char* verb);
@@ -55,10 +56,11 @@ static mapper_t* mapper_sec2gmtdate_parse_cli(int* pargi, int argc, char** argv,
 // ----------------------------------------------------------------
 static mapper_t* mapper_sec2gmtdate_alloc(slls_t* pfield_names)
 {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_sec2gmtdate_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_sec2gmtdate_state_t));
 	pstate->pfield_names = pfield_names;
+	pstate->pformat = time_format_alloc(ISO8601_DATE_FORMAT);
 	pmapper->pprocess_func = mapper_sec2gmtdate_process;
 	pmapper->pvstate       = (void*)pstate;
 	pmapper->pfree_func    = mapper_sec2gmtdate_free;
@@ -69,6 +71,7 @@ static mapper_t* mapper_sec2gmtdate_alloc(slls_t* pfield_names)
 static void mapper_sec2gmtdate_free(mapper_t* pmapper, context_t* _) {
 	mapper_sec2gmtdate_state_t* pstate = pmapper->pvstate;
 	slls_free(pstate->pfield_names);
+	time_format_free(pstate->pformat);
 	free(pstate);
 	free(pmapper);
 }
@@ -91,7 +94,7 @@ static sllv_t* mapper_sec2gmtdate_process(lrec_t* pinrec, context_t* pctx, void*
 		} else {
 			mv_t mval = mv_scan_number_nullable(sval);
 			if (!mv_is_error(&mval)) {
-				mv_t stamp = time_string_from_seconds(&mval, ISO8601_DATE_FORMAT);
+				mv_t stamp = time_string_from_seconds_with_format(&mval, pstate->pformat);
 				lrec_put(pinrec, name, stamp.u.strv, FREE_ENTRY_VALUE);
 			}
 		}
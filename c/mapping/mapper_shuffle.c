@@ -9,6 +9,7 @@
 #include "containers/lhmslv.h"
 #include "containers/lhmsv.h"
 #include "containers/mixutil.h"
+#include "input/lrec_readers.h"
 #include "mapping/mappers.h"
 #include "cli/argparse.h"
 
@@ -16,6 +17,9 @@
 typedef struct _mapper_shuffle_state_t {
 	ap_state_t* pargp;
 	sllv_t*     precs;
+	// With a retainer, where the records are in the input rather than the records themselves.
+	lrec_retainer_t* pretainer;
+	lrec_extents_t*  pextents;
 } mapper_shuffle_state_t;
 
 static void      mapper_shuffle_usage(FILE* o, char* argv0, char* verb);
@@ -23,7 +27,8 @@ static mapper_t* mapper_shuffle_parse_cli(int* pargi, int argc, char** argv,
 	cli_reader_opts_t* _, cli_writer_opts_t* __);
 static mapper_t* mapper_shuffle_alloc(ap_state_t* pargp);
 static void      mapper_shuffle_free(mapper_t* pmapper, context_t* _);
-static sllv_t*   mapper_shuffle_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static void      mapper_shuffle_set_retainer(void* pvstate, lrec_retainer_t* pretainer);
+static void      mapper_shuffle_push(lrec_t* pinrec, context_t* pctx, void* pvstate, mapper_emitter_t* pemitter);
 
 // ----------------------------------------------------------------
 mapper_setup_t mapper_shuffle_setup = {
@@ -58,16 +63,19 @@ static mapper_t* mapper_shuffle_parse_cli(int* pargi, int argc, char** argv,
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_shuffle_alloc(ap_state_t* pargp) {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_shuffle_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_shuffle_state_t));
 
 	pstate->pargp = pargp;
-	pstate->precs = sllv_alloc();
+	pstate->precs     = sllv_alloc();
+	pstate->pretainer = NULL;
+	pstate->pextents  = NULL;
 
 	pmapper->pvstate       = pstate;
-	pmapper->pprocess_func = mapper_shuffle_process;
+	pmapper->ppush_func    = mapper_shuffle_push;
 	pmapper->pfree_func    = mapper_shuffle_free;
+	pmapper->pset_retainer_func = mapper_shuffle_set_retainer;
 
 	return pmapper;
 }
@@ -76,27 +84,37 @@ static void mapper_shuffle_free(mapper_t* pmapper, context_t* _) {
 	mapper_shuffle_state_t* pstate = pmapper->pvstate;
 	// Records will have been freed by the emitter; here, free the list structure.
 	sllv_free(pstate->precs);
+	lrec_extents_free(pstate->pextents);
 	ap_free(pstate->pargp);
 	free(pstate);
 	free(pmapper);
 }
 
+static void mapper_shuffle_set_retainer(void* pvstate, lrec_retainer_t* pretainer) {
+	mapper_shuffle_state_t* pstate = pvstate;
+	pstate->pretainer = pretainer;
+	pstate->pextents  = lrec_extents_alloc();
+}
+
 // ----------------------------------------------------------------
-static sllv_t* mapper_shuffle_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+static void mapper_shuffle_push(lrec_t* pinrec, context_t* pctx, void* pvstate, mapper_emitter_t* pemitter) {
 	mapper_shuffle_state_t* pstate = pvstate;
 
 	// Not end of input stream: retain the record, and emit nothing until end of stream.
 	if (pinrec != NULL) {
-		sllv_append(pstate->precs, pinrec);
-		return NULL;
+		if (pstate->pretainer != NULL) {
+			lrec_extents_append(pstate->pextents, pstate->pretainer->current);
+			lrec_free(pinrec);
+		} else {
+			sllv_append(pstate->precs, pinrec);
+		}
+		return;
 	}
 
-	sllv_t* poutrecs = sllv_alloc();
-
 	// Knuth shuffle:
 	// * Initial permutation is identity.
 	// * Make a pseudorandom permutation using pseudorandom swaps in the image map.
-	int n = pstate->precs->length;
+	int n = (pstate->pretainer != NULL) ? pstate->pextents->length : pstate->precs->length;
 	int* images = mlr_malloc_or_die(n * sizeof(int));
 	for (int i = 0; i < n; i++)
 		images[i] = i;
@@ -116,25 +134,35 @@ static sllv_t* mapper_shuffle_process(lrec_t* pinrec, context_t* pctx, void* pvs
 		num_unused--;
 	}
 
-	// Make an array of pointers into the input list.
-	lrec_t** record_array = mlr_malloc_or_die(n * sizeof(lrec_t**));
-	sllve_t* pe = pstate->precs->phead;
-	for (int i = 0; i < n; i++, pe = pe->pnext) {
-		record_array[i] = pe->pvvalue;
-	}
-
-	// Transfer from input array to output list. Because permutations are one-to-one maps,
-	// all input records have ownership transferred exactly once. So, there are no
-	// records to copy here, or free here.
-	for (int i = 0; i < n; i++) {
-		sllv_append(poutrecs, record_array[images[i]]);
+	if (pstate->pretainer != NULL) {
+		for (int i = 0; i < n; i++)
+			mapper_emit(pemitter, lrec_retainer_reparse(pstate->pretainer, &pstate->pextents->pextents[images[i]]),
+				pctx);
+		pstate->pextents->length = 0;
+	} else {
+		// Make an array of pointers into the input list.
+		lrec_t** record_array = mlr_malloc_or_die(n * sizeof(lrec_t**));
+		sllve_t* pe = pstate->precs->phead;
+		for (int i = 0; i < n; i++, pe = pe->pnext) {
+			record_array[i] = pe->pvvalue;
+		}
+
+		// Transfer from input array to output. Because permutations are one-to-one maps,
+		// all input records have ownership transferred exactly once. So, there are no
+		// records to copy here, or free here.
+		for (int i = 0; i < n; i++) {
+			mapper_emit(pemitter, record_array[images[i]], pctx);
+		}
+
+		free(record_array);
+		// The records now belong downstream; empty the list without freeing them.
+		sllv_free(pstate->precs);
+		pstate->precs = sllv_alloc();
 	}
 
-	free(record_array);
 	free(images);
 
-	// Null-terminate the output list to signify end of stream.
-	sllv_append(poutrecs, NULL);
-	return poutrecs;
+	// A null record signifies end of stream.
+	mapper_emit(pemitter, NULL, pctx);
 }
 
@@ -59,6 +59,7 @@ typedef struct _mapper_sort_state_t {
 	slls_t* pkey_field_names; // Fields to sort on
 	int*    sort_params;      // Lexical/numeric; ascending/descending
 	int do_sort;              // If false, just do group-by
+	string_array_t* pkey_field_values; // Scratch space used per-record
 	// Sort state: buckets of like records.
 	lhmslv_t* pbuckets_by_key_field_values;
 	sllv_t*   precords_missing_sort_keys;
@@ -86,6 +87,7 @@ static mapper_t* mapper_group_by_parse_cli(int* pargi, int argc, char** argv,
 	cli_reader_opts_t* _, cli_writer_opts_t* __);
 static mapper_t* mapper_sort_alloc(slls_t* pkey_field_names, int* sort_params, int do_sort);
 static void      mapper_sort_free(mapper_t* pmapper, context_t* _);
+static hss_t*    mapper_sort_input_fields(void* pvstate, hss_t* pdownstream_fields);
 static sllv_t*   mapper_sort_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
 
 static typed_sort_key_t* parse_sort_keys(slls_t* pkey_field_values, int* sort_params, context_t* pctx);
@@ -218,11 +220,12 @@ static mapper_t* mapper_group_by_parse_cli(int* pargi, int argc, char** argv,
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_sort_alloc(slls_t* pkey_field_names, int* sort_params, int do_sort) {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_sort_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_sort_state_t));
 
 	pstate->pkey_field_names             = pkey_field_names;
+	pstate->pkey_field_values            = string_array_alloc(pkey_field_names->length);
 	pstate->sort_params                  = sort_params;
 	pstate->pbuckets_by_key_field_values = lhmslv_alloc();
 	pstate->precords_missing_sort_keys   = sllv_alloc();
@@ -231,6 +234,7 @@ static mapper_t* mapper_sort_alloc(slls_t* pkey_field_names, int* sort_params, i
 	pmapper->pvstate       = pstate;
 	pmapper->pprocess_func = mapper_sort_process;
 	pmapper->pfree_func    = mapper_sort_free;
+	pmapper->pinput_fields_func = mapper_sort_input_fields;
 
 	return pmapper;
 }
@@ -240,6 +244,7 @@ static void mapper_sort_free(mapper_t* pmapper, context_t* _) {
 	mapper_sort_state_t* pstate = pmapper->pvstate;
 	if (pstate->pkey_field_names != NULL)
 		slls_free(pstate->pkey_field_names);
+	string_array_free(pstate->pkey_field_values);
 	// lhmslv_free will free the hashmap keys; we need to free the void-star hashmap values.
 	for (lhmslve_t* pa = pstate->pbuckets_by_key_field_values->phead; pa != NULL; pa = pa->pnext) {
 		sort_bucket_t* pbucket = pa->pvvalue;
@@ -254,28 +259,33 @@ static void mapper_sort_free(mapper_t* pmapper, context_t* _) {
 	free(pmapper);
 }
 
+static hss_t* mapper_sort_input_fields(void* pvstate, hss_t* pdownstream_fields) {
+	mapper_sort_state_t* pstate = pvstate;
+	return mapper_pass_through_input_fields(pdownstream_fields, pstate->pkey_field_names);
+}
+
 // ----------------------------------------------------------------
 static sllv_t* mapper_sort_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	mapper_sort_state_t* pstate = pvstate;
 	if (pinrec != NULL) {
 		// Consume another input record.
-		slls_t* pkey_field_values = mlr_reference_selected_values_from_record(pinrec, pstate->pkey_field_names);
-		if (pkey_field_values == NULL) {
+		if (!mlr_reference_selected_values_from_record_into_array(pinrec, pstate->pkey_field_names,
+			pstate->pkey_field_values))
+		{
 			sllv_append(pstate->precords_missing_sort_keys, pinrec);
 		} else {
-			sort_bucket_t* pbucket = lhmslv_get(pstate->pbuckets_by_key_field_values, pkey_field_values);
+			sort_bucket_t* pbucket = lhmslv_get_from_string_array(pstate->pbuckets_by_key_field_values,
+				pstate->pkey_field_values);
 			if (pbucket == NULL) { // New key-field-value: new bucket and hash-map entry
-				slls_t* pkey_field_values_copy = slls_copy(pkey_field_values);
 				sort_bucket_t* pbucket = mlr_malloc_or_die(sizeof(sort_bucket_t));
+				slls_t* pkey_field_values_copy = lhmslv_put_copy_of_string_array(pstate->pbuckets_by_key_field_values,
+					pstate->pkey_field_values, pbucket);
 				pbucket->typed_sort_keys = parse_sort_keys(pkey_field_values_copy, pstate->sort_params, pctx);
 				pbucket->precords = sllv_alloc();
 				sllv_append(pbucket->precords, pinrec);
-				lhmslv_put(pstate->pbuckets_by_key_field_values, pkey_field_values_copy, pbucket,
-					FREE_ENTRY_KEY);
 			} else { // Previously seen key-field-value: append record to bucket
 				sllv_append(pbucket->precords, pinrec);
 			}
-			slls_free(pkey_field_values);
 		}
 		return NULL;
 	} else if (!pstate->do_sort) {
@@ -0,0 +1,345 @@
+#include <ctype.h>
+#include "cli/mlrcli.h"
+#include "containers/sllv.h"
+#include "containers/mixutil.h"
+#include "lib/mlr_globals.h"
+#include "lib/mlrutil.h"
+#include "lib/string_array.h"
+#include "lib/string_builder.h"
+#include "mapping/mappers.h"
+#include "output/multi_lrec_writer.h"
+
+#define DEFAULT_PREFIX "split"
+
+typedef struct _mapper_split_state_t {
+	slls_t*             pgroup_by_field_names;
+	string_array_t*     pgroup_by_field_values;
+	long long           records_per_file;
+	long long           record_count;
+	char*               prefix;
+	char*               suffix;
+	int                 do_escape;
+	int                 do_gzip;
+	int                 do_append;
+	int                 do_pass_through;
+	file_output_mode_t  file_output_mode;
+	string_builder_t*   pfilename_builder;
+	char*               current_filename; // With -n
+	multi_lrec_writer_t* pmulti_lrec_writer;
+	cli_writer_opts_t*  pwriter_opts;
+} mapper_split_state_t;
+
+static void      mapper_split_usage(FILE* o, char* argv0, char* verb);
+static mapper_t* mapper_split_parse_cli(int* pargi, int argc, char** argv,
+	cli_reader_opts_t* _, cli_writer_opts_t* pmain_writer_opts);
+static mapper_t* mapper_split_alloc(slls_t* pgroup_by_field_names, long long records_per_file,
+	char* prefix, char* suffix, int do_escape, int do_gzip, int do_append, int do_pass_through,
+	cli_writer_opts_t* pwriter_opts, cli_writer_opts_t* pmain_writer_opts);
+static void      mapper_split_free(mapper_t* pmapper, context_t* pctx);
+static void      mapper_split_push(lrec_t* pinrec, context_t* pctx, void* pvstate, mapper_emitter_t* pemitter);
+static char*     mapper_split_make_filename(mapper_split_state_t* pstate);
+static char*     mapper_split_gzip_reopen_command(char* command);
+
+// ----------------------------------------------------------------
+mapper_setup_t mapper_split_setup = {
+	.verb = "split",
+	.pusage_func = mapper_split_usage,
+	.pparse_func = mapper_split_parse_cli,
+	.ignores_input = FALSE,
+};
+
+// ----------------------------------------------------------------
+static mapper_t* mapper_split_parse_cli(int* pargi, int argc, char** argv,
+	cli_reader_opts_t* _, cli_writer_opts_t* pmain_writer_opts)
+{
+	slls_t*   pgroup_by_field_names = NULL;
+	long long records_per_file = 0LL;
+	char*     prefix = DEFAULT_PREFIX;
+	char*     suffix = NULL;
+	int       do_escape = TRUE;
+	int       do_gzip = FALSE;
+	int       do_append = FALSE;
+	int       do_pass_through = FALSE;
+	cli_writer_opts_t* pwriter_opts = mlr_malloc_or_die(sizeof(cli_writer_opts_t));
+	cli_writer_opts_init(pwriter_opts);
+
+	int argi = *pargi;
+	if ((argc - argi) < 1) {
+		mapper_split_usage(stderr, argv[0], argv[argi]);
+		return NULL;
+	}
+	char* verb = argv[argi++];
+
+	for (; argi < argc; /* variable increment: 1 or 2 depending on flag */) {
+
+		if (argv[argi][0] != '-') {
+			break; // No more flag options to process
+
+		} else if (cli_handle_writer_options(argv, argc, &argi, pwriter_opts)) {
+			// handled
+
+		} else if (streq(argv[argi], "-g")) {
+			if ((argc - argi) < 2) {
+				mapper_split_usage(stderr, argv[0], verb);
+				return NULL;
+			}
+			if (pgroup_by_field_names != NULL)
+				slls_free(pgroup_by_field_names);
+			pgroup_by_field_names = slls_from_line(argv[argi+1], ',', FALSE);
+			argi += 2;
+
+		} else if (streq(argv[argi], "-n")) {
+			if ((argc - argi) < 2) {
+				mapper_split_usage(stderr, argv[0], verb);
+				return NULL;
+			}
+			if (sscanf(argv[argi+1], "%lld", &records_per_file) != 1 || records_per_file <= 0) {
+				mapper_split_usage(stderr, argv[0], verb);
+				return NULL;
+			}
+			argi += 2;
+
+		} else if (streq(argv[argi], "--prefix")) {
+			if ((argc - argi) < 2) {
+				mapper_split_usage(stderr, argv[0], verb);
+				return NULL;
+			}
+			prefix = argv[argi+1];
+			argi += 2;
+
+		} else if (streq(argv[argi], "--suffix")) {
+			if ((argc - argi) < 2) {
+				mapper_split_usage(stderr, argv[0], verb);
+				return NULL;
+			}
+			suffix = argv[argi+1];
+			argi += 2;
+
+		} else if (streq(argv[argi], "-e")) {
+			do_escape = FALSE;
+			argi++;
+
+		} else if (streq(argv[argi], "-z") || streq(argv[argi], "--gzip")) {
+			do_gzip = TRUE;
+			argi++;
+
+		} else if (streq(argv[argi], "-a")) {
+			do_append = TRUE;
+			argi++;
+
+		} else if (streq(argv[argi], "-v")) {
+			do_pass_through = TRUE;
+			argi++;
+
+		} else {
+			mapper_split_usage(stderr, argv[0], verb);
+			return NULL;
+		}
+	}
+
+	if ((pgroup_by_field_names == NULL) == (records_per_file == 0LL)) {
+		mapper_split_usage(stderr, argv[0], verb);
+		return NULL;
+	}
+
+	*pargi = argi;
+
+	return mapper_split_alloc(pgroup_by_field_names, records_per_file, prefix, suffix, do_escape, do_gzip,
+		do_append, do_pass_through, pwriter_opts, pmain_writer_opts);
+}
+
+static void mapper_split_usage(FILE* o, char* argv0, char* verb) {
+	fprintf(o, "Usage: %s %s [options]\n", argv0, verb);
+	fprintf(o, "Writes records to files partitioned by the values of the given fields, or in\n");
+	fprintf(o, "chunks of the given number of records, using output-format flags from the\n");
+	fprintf(o, "command line (e.g. --ocsv). Records are written directly to their files,\n");
+	fprintf(o, "which are buffered, and closed and reopened as needed to stay within\n");
+	fprintf(o, "%s --max-open-files.\n", argv0);
+	fprintf(o, "Options:\n");
+	fprintf(o, "-g {a,b,c}     Write each record to the file for its values of fields a, b,\n");
+	fprintf(o, "               and c, e.g. split_pan_wye.csv. Records lacking any of these\n");
+	fprintf(o, "               fields aren't written.\n");
+	fprintf(o, "-n {n}         Write the first n records to split_1.csv, the next n to\n");
+	fprintf(o, "               split_2.csv, and so on.\n");
+	fprintf(o, "               Exactly one of -g and -n must be given.\n");
+	fprintf(o, "--prefix {p}   Filename prefix, which may include directories; default\n");
+	fprintf(o, "               \"%s\". It's joined to the rest with \"_\" unless it ends in \"/\".\n",
+		DEFAULT_PREFIX);
+	fprintf(o, "--suffix {s}   Filename suffix; default from the output format, e.g. \"csv\".\n");
+	fprintf(o, "-e             Don't escape field values in filenames. By default, characters\n");
+	fprintf(o, "               other than letters, digits, \"-\" and \".\" are written as %%XX,\n");
+	fprintf(o, "               so that e.g. \"/\" doesn't make a directory, and \"_\", which\n");
+	fprintf(o, "               joins the values, is unambiguous.\n");
+	fprintf(o, "-z, --gzip     Compress each file by piping it through gzip, adding \".gz\"\n");
+	fprintf(o, "               to the suffix. This runs a gzip process per open file. Files\n");
+	fprintf(o, "               closed to stay within the limit are appended to as further\n");
+	fprintf(o, "               gzip members, which gunzip reads as one stream.\n");
+	fprintf(o, "-a             Append to existing files, if any, rather than overwriting.\n");
+	fprintf(o, "-v             Also pass the records along to the rest of the chain.\n");
+	fprintf(o, "Any of the output-format command-line flags (see %s -h). Example: using\n", argv0);
+	fprintf(o, "  %s --icsv --from log.csv split -g date,host --prefix out/ --ojson\n", argv0);
+	fprintf(o, "the input is CSV and the files, e.g. out/2017-01-01_host1.json, are JSON.\n");
+}
+
+// ----------------------------------------------------------------
+static char* suffix_for_format(char* ofile_fmt) {
+	if (streq(ofile_fmt, "csvlite"))
+		return "csv";
+	else if (streq(ofile_fmt, "markdown"))
+		return "md";
+	else
+		return ofile_fmt;
+}
+
+static mapper_t* mapper_split_alloc(slls_t* pgroup_by_field_names, long long records_per_file,
+	char* prefix, char* suffix, int do_escape, int do_gzip, int do_append, int do_pass_through,
+	cli_writer_opts_t* pwriter_opts, cli_writer_opts_t* pmain_writer_opts)
+{
+	mapper_t* pmapper = mapper_alloc();
+	mapper_split_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_split_state_t));
+
+	cli_merge_writer_opts(pwriter_opts, pmain_writer_opts);
+
+	pstate->pgroup_by_field_names  = pgroup_by_field_names;
+	pstate->pgroup_by_field_values = pgroup_by_field_names == NULL
+		? NULL : string_array_alloc(pgroup_by_field_names->length);
+	pstate->records_per_file       = records_per_file;
+	pstate->record_count           = 0LL;
+	pstate->prefix                 = prefix;
+	pstate->suffix                 = suffix != NULL ? suffix : suffix_for_format(pwriter_opts->ofile_fmt);
+	pstate->do_escape              = do_escape;
+	pstate->do_gzip                = do_gzip;
+	pstate->do_append              = do_append;
+	pstate->do_pass_through        = do_pass_through;
+	pstate->file_output_mode       = do_gzip ? MODE_PIPE : do_append ? MODE_APPEND : MODE_WRITE;
+	pstate->pfilename_builder      = sb_alloc(256);
+	pstate->current_filename       = NULL;
+	pstate->pwriter_opts           = pwriter_opts;
+	pstate->pmulti_lrec_writer     = multi_lrec_writer_alloc(pwriter_opts);
+	if (do_gzip)
+		multi_out_set_reopener(pstate->pmulti_lrec_writer->pmulti_out, mapper_split_gzip_reopen_command);
+
+	pmapper->pvstate                 = pstate;
+	pmapper->ppush_func              = mapper_split_push;
+	pmapper->pfree_func              = mapper_split_free;
+	return pmapper;
+}
+
+static void mapper_split_free(mapper_t* pmapper, context_t* pctx) {
+	mapper_split_state_t* pstate = pmapper->pvstate;
+	slls_free(pstate->pgroup_by_field_names);
+	string_array_free(pstate->pgroup_by_field_values);
+	sb_free(pstate->pfilename_builder);
+	free(pstate->current_filename);
+	multi_lrec_writer_free(pstate->pmulti_lrec_writer, pctx);
+	free(pstate->pwriter_opts);
+	free(pstate);
+	free(pmapper);
+}
+
+// ----------------------------------------------------------------
+static void mapper_split_push(lrec_t* pinrec, context_t* pctx, void* pvstate, mapper_emitter_t* pemitter) {
+	mapper_split_state_t* pstate = pvstate;
+
+	if (pinrec == NULL) { // End of record stream
+		multi_lrec_writer_drain(pstate->pmulti_lrec_writer, pctx);
+		mapper_emit(pemitter, NULL, pctx);
+		return;
+	}
+
+	char* filename = NULL;
+	if (pstate->pgroup_by_field_names != NULL) {
+		if (!mlr_reference_selected_values_from_record_into_array(pinrec, pstate->pgroup_by_field_names,
+			pstate->pgroup_by_field_values))
+		{
+			if (pstate->do_pass_through)
+				mapper_emit(pemitter, pinrec, pctx);
+			else
+				lrec_free(pinrec);
+			return;
+		}
+		filename = mapper_split_make_filename(pstate);
+	} else {
+		// Each file is finished as soon as it has its records, rather than at end of stream.
+		if (pstate->record_count % pstate->records_per_file == 0LL) {
+			if (pstate->current_filename != NULL) {
+				multi_lrec_writer_output_srec(pstate->pmulti_lrec_writer, NULL, pstate->current_filename,
+					pstate->file_output_mode, FALSE, pctx);
+				free(pstate->current_filename);
+			}
+			pstate->current_filename = mapper_split_make_filename(pstate);
+		}
+		pstate->record_count++;
+	}
+
+	// The writer frees the record, so it needs a copy if the record goes on down the chain.
+	lrec_t* poutrec = pstate->do_pass_through ? lrec_copy(pinrec) : pinrec;
+	multi_lrec_writer_output_srec(pstate->pmulti_lrec_writer, poutrec,
+		filename != NULL ? filename : pstate->current_filename,
+		pstate->file_output_mode, FALSE, pctx);
+	if (pstate->do_pass_through)
+		mapper_emit(pemitter, pinrec, pctx);
+
+	free(filename);
+}
+
+// ----------------------------------------------------------------
+// For gzip the filename is single-quoted into the shell command, so single
+// quotes in it need quoting too.
+static void append_for_filename(string_builder_t* psb, char* s, int do_escape, int do_shell_quote) {
+	static char* hex_digits = "0123456789ABCDEF";
+	for (char* p = s; *p; p++) {
+		unsigned char c = *p;
+		if (do_escape && !(isalnum(c) || c == '-' || c == '.')) {
+			sb_append_char(psb, '%');
+			sb_append_char(psb, hex_digits[c >> 4]);
+			sb_append_char(psb, hex_digits[c & 0xf]);
+		} else if (do_shell_quote && c == '\'') {
+			sb_append_string(psb, "'\\''");
+		} else {
+			sb_append_char(psb, c);
+		}
+	}
+}
+
+// For gzip, a pipe closed to make room for others is reopened appending.
+static char* mapper_split_gzip_reopen_command(char* command) {
+	char* overwrite = "gzip > ";
+	int overwrite_length = strlen(overwrite);
+	if (strncmp(command, overwrite, overwrite_length) == 0)
+		return mlr_paste_2_strings("gzip >> ", &command[overwrite_length]);
+	else
+		return mlr_strdup_or_die(command);
+}
+
+// E.g. split_pan_wye.csv, out/pan_wye.csv, or gzip > 'split_pan_wye.csv.gz'.
+// For gzip, appending is done by the shell: concatenated gzip files are a gzip file.
+static char* mapper_split_make_filename(mapper_split_state_t* pstate) {
+	string_builder_t* psb = pstate->pfilename_builder;
+
+	if (pstate->do_gzip)
+		sb_append_string(psb, pstate->do_append ? "gzip >> '" : "gzip > '");
+	append_for_filename(psb, pstate->prefix, FALSE, pstate->do_gzip);
+	int prefix_length = strlen(pstate->prefix);
+	if (prefix_length > 0 && pstate->prefix[prefix_length - 1] != '/')
+		sb_append_char(psb, '_');
+
+	if (pstate->pgroup_by_field_values != NULL) {
+		string_array_t* pvalues = pstate->pgroup_by_field_values;
+		for (int i = 0; i < pvalues->length; i++) {
+			if (i > 0)
+				sb_append_char(psb, '_');
+			append_for_filename(psb, pvalues->strings[i], pstate->do_escape, pstate->do_gzip);
+		}
+	} else {
+		char buf[32];
+		snprintf(buf, sizeof(buf), "%lld", pstate->record_count / pstate->records_per_file + 1);
+		sb_append_string(psb, buf);
+	}
+
+	sb_append_char(psb, '.');
+	append_for_filename(psb, pstate->suffix, FALSE, pstate->do_gzip);
+	if (pstate->do_gzip)
+		sb_append_string(psb, ".gz'");
+	return sb_finish(psb);
+}
@@ -11,6 +11,8 @@
 #include "containers/lhmslv.h"
 #include "containers/lhmsv.h"
 #include "containers/mixutil.h"
+#include "containers/tdigest.h"
+#include "containers/hll.h"
 #include "lib/mlrval.h"
 #include "mapping/mappers.h"
 #include "mapping/stats1_accumulators.h"
@@ -31,6 +33,7 @@ typedef struct _mapper_stats1_state_t {
 	string_array_t*  pvalue_field_names;     // parameter
 	string_array_t*  pvalue_field_values;    // scratch space used per-record
 	slls_t*          pgroup_by_field_names;  // parameter
+	string_array_t*  pgroup_by_field_values; // scratch space used per-record
 
 	group_by_ingestor_func_t* pgroup_by_ingestor;
 	value_ingestor_func_t*    pvalue_ingestor;
@@ -49,6 +52,8 @@ typedef struct _mapper_stats1_state_t {
 	int              do_iterative_stats;
 	int              allow_int_float;
 	int              do_interpolated_percentiles;
+	double           approx_compression;
+	int              approx_precision;
 } mapper_stats1_state_t;
 
 
@@ -58,8 +63,10 @@ static mapper_t* mapper_stats1_parse_cli(int* pargi, int argc, char** argv,
 static mapper_t* mapper_stats1_alloc(ap_state_t* pargp, slls_t* paccumulator_names,
 	string_array_t* pvalue_field_names, int do_regex_value_field_names, int invert_regex_value_field_names,
 	slls_t* pgroup_by_field_names, int do_regex_group_by_field_names, int invert_regex_group_by_field_names,
-	int do_iterative_stats, int allow_int_float, int do_interpolated_percentiles);
+	int do_iterative_stats, int allow_int_float, int do_interpolated_percentiles, double approx_compression,
+	int approx_precision);
 static void      mapper_stats1_free(mapper_t* pmapper, context_t* _);
+static hss_t*    mapper_stats1_input_fields(void* pvstate, hss_t* pdownstream_fields);
 static sllv_t*   mapper_stats1_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
 
 static void mapper_stats1_group_by_ingest_without_regexes(
@@ -103,7 +110,9 @@ static void mapper_stats1_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "Computes univariate statistics for one or more given fields, accumulated across\n");
 	fprintf(o, "the input record stream.\n");
 	fprintf(o, "Options:\n");
-	fprintf(o, "-a {sum,count,...}  Names of accumulators: p10 p25.2 p50 p98 p100 etc. and/or\n");
+	fprintf(o, "-a {sum,count,...}  Names of accumulators: p10 p25.2 p50 p98 p100 etc.,\n");
+	fprintf(o, "                    approximate percentiles p10~ p50~ median~ etc.,\n");
+	fprintf(o, "                    approximate distinct-value count distinct_count~, and/or\n");
 	fprintf(o, "                    one or more of:\n");
 	for (int i = 0; i < stats1_acc_lookup_table_length; i++) {
 		fprintf(o, "   %-9s %s\n", stats1_acc_lookup_table[i].name, stats1_acc_lookup_table[i].desc);
@@ -121,6 +130,11 @@ static void mapper_stats1_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "--grfx {regex} Shorthand for --gr {regex} --fx {that same regex}\n");
 	fprintf(o, "-i           Use interpolated percentiles, like R's type=7; default like type=1.\n");
 	fprintf(o, "             Not sensical for string-valued fields.\n");
+	fprintf(o, "--compression {n} Accuracy of approximate percentiles p10~ etc.: higher is more\n");
+	fprintf(o, "             accurate, and uses more memory. Default %d.\n", (int)TDIGEST_DEFAULT_COMPRESSION);
+	fprintf(o, "--precision {p} Accuracy of distinct_count~, from %d to %d: higher is more accurate,\n",
+		HLL_MIN_PRECISION, HLL_MAX_PRECISION);
+	fprintf(o, "             and uses 2^p bytes per group. Default %d.\n", HLL_DEFAULT_PRECISION);
 	fprintf(o, "-s           Print iterative stats. Useful in tail -f contexts (in which\n");
 	fprintf(o, "             case please avoid pprint-format output since end of input\n");
 	fprintf(o, "             stream will never be seen).\n");
@@ -133,13 +147,20 @@ static void mapper_stats1_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "         with a through h, grouped by all field names starting with k.\n");
 	fprintf(o, "Notes:\n");
 	fprintf(o, "* p50 and median are synonymous.\n");
+	fprintf(o, "* p50~, median~, etc. are approximate percentiles using a t-digest: memory\n");
+	fprintf(o, "  use per group is bounded, rather than growing with the number of records.\n");
+	fprintf(o, "  Output is floating-point; for small inputs it matches p50, median, etc.\n");
+	fprintf(o, "  They require numeric input.\n");
+	fprintf(o, "* distinct_count~ estimates the number of distinct values using a HyperLogLog\n");
+	fprintf(o, "  sketch, in bounded memory per group. Counts are exact until they reach\n");
+	fprintf(o, "  several hundred; beyond that, accuracy is to within a few percent.\n");
 	fprintf(o, "* min and max output the same results as p0 and p100, respectively, but use\n");
 	fprintf(o, "  less memory.\n");
 	fprintf(o, "* String-valued data make sense unless arithmetic on them is required,\n");
 	fprintf(o, "  e.g. for sum, mean, interpolated percentiles, etc. In case of mixed data,\n");
 	fprintf(o, "  numbers are less than strings.\n");
-	fprintf(o, "* count and mode allow text input; the rest require numeric input.\n");
-	fprintf(o, "  In particular, 1 and 1.0 are distinct text for count and mode.\n");
+	fprintf(o, "* count, mode, and distinct_count~ allow text input; the rest require numeric\n");
+	fprintf(o, "  input. In particular, 1 and 1.0 are distinct text for these.\n");
 	fprintf(o, "* When there are mode ties, the first-encountered datum wins.\n");
 }
 
@@ -152,6 +173,8 @@ static mapper_t* mapper_stats1_parse_cli(int* pargi, int argc, char** argv,
 	int             do_iterative_stats                = FALSE;
 	int             allow_int_float                   = TRUE;
 	int             do_interpolated_percentiles       = FALSE;
+	double          approx_compression                = TDIGEST_DEFAULT_COMPRESSION;
+	int             approx_precision                  = HLL_DEFAULT_PRECISION;
 	int             do_regex_value_field_names        = FALSE;
 	int             invert_regex_value_field_names    = FALSE;
 	int             do_regex_group_by_field_names     = FALSE;
@@ -173,6 +196,8 @@ static mapper_t* mapper_stats1_parse_cli(int* pargi, int argc, char** argv,
 	ap_define_true_flag(pstate,         "-s",   &do_iterative_stats);
 	ap_define_false_flag(pstate,        "-F",   &allow_int_float);
 	ap_define_true_flag(pstate,         "-i",   &do_interpolated_percentiles);
+	ap_define_float_flag(pstate,        "--compression", &approx_compression);
+	ap_define_int_flag(pstate,          "--precision", &approx_precision);
 
 	if (!ap_parse(pstate, verb, pargi, argc, argv)) {
 		mapper_stats1_usage(stderr, argv[0], verb);
@@ -212,16 +237,18 @@ static mapper_t* mapper_stats1_parse_cli(int* pargi, int argc, char** argv,
 	return mapper_stats1_alloc(pstate, paccumulator_names,
 		pvalue_field_names, do_regex_value_field_names, invert_regex_value_field_names,
 		pgroup_by_field_names, do_regex_group_by_field_names, invert_regex_group_by_field_names,
-		do_iterative_stats, allow_int_float, do_interpolated_percentiles);
+		do_iterative_stats, allow_int_float, do_interpolated_percentiles, approx_compression,
+		approx_precision);
 }
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_stats1_alloc(ap_state_t* pargp, slls_t* paccumulator_names,
 	string_array_t* pvalue_field_names, int do_regex_value_field_names, int invert_regex_value_field_names,
 	slls_t* pgroup_by_field_names, int do_regex_group_by_field_names, int invert_regex_group_by_field_names,
-	int do_iterative_stats, int allow_int_float, int do_interpolated_percentiles)
+	int do_iterative_stats, int allow_int_float, int do_interpolated_percentiles, double approx_compression,
+	int approx_precision)
 {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_stats1_state_t* pstate  = mlr_malloc_or_die(sizeof(mapper_stats1_state_t));
 
@@ -252,6 +279,7 @@ static mapper_t* mapper_stats1_alloc(ap_state_t* pargp, slls_t* paccumulator_nam
 
 	if (do_regex_group_by_field_names) {
 		pstate->pgroup_by_field_names   = NULL;
+		pstate->pgroup_by_field_values  = NULL;
 		pstate->num_group_by_field_regexes = pgroup_by_field_names->length;
 		pstate->group_by_field_regexes     = mlr_malloc_or_die(sizeof(regex_t) * pstate->num_group_by_field_regexes);
 		int i = 0;
@@ -270,6 +298,7 @@ static mapper_t* mapper_stats1_alloc(ap_state_t* pargp, slls_t* paccumulator_nam
 		pstate->pgroup_by_ingestor                = mapper_stats1_group_by_ingest_without_regexes;
 		pstate->pemitter                          = mapper_stats1_emit_all_without_group_by_regexes;
 		pstate->pgroup_by_field_names             = pgroup_by_field_names;
+		pstate->pgroup_by_field_values            = string_array_alloc(pgroup_by_field_names->length);
 		pstate->group_by_field_regexes            = NULL;
 		pstate->num_group_by_field_regexes        = 0;
 		pstate->invert_regex_group_by_field_names = FALSE;
@@ -280,10 +309,13 @@ static mapper_t* mapper_stats1_alloc(ap_state_t* pargp, slls_t* paccumulator_nam
 	pstate->do_iterative_stats            = do_iterative_stats;
 	pstate->allow_int_float               = allow_int_float;
 	pstate->do_interpolated_percentiles   = do_interpolated_percentiles;
+	pstate->approx_compression            = approx_compression;
+	pstate->approx_precision              = approx_precision;
 
 	pmapper->pvstate       = pstate;
 	pmapper->pprocess_func = mapper_stats1_process;
 	pmapper->pfree_func    = mapper_stats1_free;
+	pmapper->pinput_fields_func = mapper_stats1_input_fields;
 
 	return pmapper;
 }
@@ -294,6 +326,7 @@ static void mapper_stats1_free(mapper_t* pmapper, context_t* _) {
 	string_array_free(pstate->pvalue_field_names);
 	string_array_free(pstate->pvalue_field_values);
 	slls_free(pstate->pgroup_by_field_names);
+	string_array_free(pstate->pgroup_by_field_values);
 
 	if (pstate->value_field_regexes != NULL) {
 		for (int i = 0; i < pstate->num_value_field_regexes; i++)
@@ -362,6 +395,24 @@ static void mapper_stats1_free(mapper_t* pmapper, context_t* _) {
 	free(pmapper);
 }
 
+// ----------------------------------------------------------------
+// Without -s, the output records are made from scratch, so only the value and
+// group-by fields are needed whatever is downstream.
+static hss_t* mapper_stats1_input_fields(void* pvstate, hss_t* pdownstream_fields) {
+	mapper_stats1_state_t* pstate = pvstate;
+	if (pstate->pvalue_field_names == NULL || pstate->pgroup_by_field_names == NULL) // Regexed
+		return NULL;
+	if (pstate->do_iterative_stats && pdownstream_fields == NULL)
+		return NULL;
+
+	hss_t* pinput_fields = pstate->do_iterative_stats ? hss_copy(pdownstream_fields) : hss_alloc();
+	for (int i = 0; i < pstate->pvalue_field_names->length; i++)
+		hss_add(pinput_fields, pstate->pvalue_field_names->strings[i]);
+	for (sllse_t* pe = pstate->pgroup_by_field_names->phead; pe != NULL; pe = pe->pnext)
+		hss_add(pinput_fields, pe->value);
+	return pinput_fields;
+}
+
 // ================================================================
 // Given: accumulate count,sum on values x,y group by a,b.
 // Example input:       Example output:
@@ -433,27 +484,24 @@ static void mapper_stats1_group_by_ingest_without_regexes(lrec_t* pinrec, mapper
 	// population on that, but retain full-population requirement on group-by.
 	// E.g. if accumulating stats of x,y on a,b then skip record with x,y,a but
 	// process record with x,a,b.
-	slls_t* pgroup_by_field_values = mlr_reference_selected_values_from_record(pinrec, pstate->pgroup_by_field_names);
-	if (pgroup_by_field_values == NULL) {
-		slls_free(pgroup_by_field_values);
+	if (!mlr_reference_selected_values_from_record_into_array(pinrec, pstate->pgroup_by_field_names,
+		pstate->pgroup_by_field_values))
+	{
 		return;
 	}
 
 	//  - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-	lhmsv_t* pgroup_by_field_values_to_acc_fields = lhmslv_get(pstate->groups_without_group_by_regex,
-		pgroup_by_field_values);
+	lhmsv_t* pgroup_by_field_values_to_acc_fields = lhmslv_get_from_string_array(pstate->groups_without_group_by_regex,
+		pstate->pgroup_by_field_values);
 	if (pgroup_by_field_values_to_acc_fields == NULL) {
 		pgroup_by_field_values_to_acc_fields = lhmsv_alloc();
-		lhmslv_put(pstate->groups_without_group_by_regex, slls_copy(pgroup_by_field_values),
-			pgroup_by_field_values_to_acc_fields, FREE_ENTRY_KEY);
+		lhmslv_put_copy_of_string_array(pstate->groups_without_group_by_regex, pstate->pgroup_by_field_values,
+			pgroup_by_field_values_to_acc_fields);
 	}
 
 	//  - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 	// for x=1 and y=2
 	pstate->pvalue_ingestor(pinrec, pstate, pgroup_by_field_values_to_acc_fields);
-
-	//  - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-	slls_free(pgroup_by_field_values);
 }
 
 // ----------------------------------------------------------------
@@ -553,7 +601,8 @@ static void mapper_stats1_ingest_name_value(lrec_t* pinrec, mapper_stats1_state_
 	char* presence = lhmsv_get(acc_field_to_acc_state_in, fake_acc_name_for_setups);
 	if (presence == NULL) {
 		make_stats1_accs(value_field_name, pstate->paccumulator_names, pstate->allow_int_float,
-			pstate->do_interpolated_percentiles, acc_field_to_acc_state_in, acc_field_to_acc_state_out);
+			pstate->do_interpolated_percentiles, pstate->approx_compression, pstate->approx_precision,
+			acc_field_to_acc_state_in, acc_field_to_acc_state_out);
 		lhmsv_put(acc_field_to_acc_state_in, fake_acc_name_for_setups, fake_acc_name_for_setups, NO_FREE);
 	}
 
@@ -181,7 +181,7 @@ static mapper_t* mapper_stats2_alloc(ap_state_t* pargp, slls_t* paccumulator_nam
 	string_array_t* pvalue_field_name_pairs, slls_t* pgroup_by_field_names,
 	int do_verbose, int do_iterative_stats, int do_hold_and_fit)
 {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_stats2_state_t* pstate    = mlr_malloc_or_die(sizeof(mapper_stats2_state_t));
 	pstate->pargp                    = pargp;
@@ -4,6 +4,7 @@
 #include <math.h>
 #include "lib/mlrutil.h"
 #include "lib/mlr_globals.h"
+#include "lib/mlrstat.h"
 #include "containers/sllv.h"
 #include "containers/slls.h"
 #include "lib/string_array.h"
@@ -15,6 +16,7 @@
 #include "cli/argparse.h"
 
 #define DEFAULT_STRING_ALPHA "0.5"
+#define DEFAULT_WINDOW_LENGTH 5
 
 // ----------------------------------------------------------------
 struct _step_t; // forward reference for method declarations
@@ -25,17 +27,28 @@ typedef void step_sprocess_func_t(void* pvstate, char*  strv, lrec_t* prec);
 typedef void step_zprocess_func_t(void* pvstate,              lrec_t* prec);
 typedef void step_free_func_t(struct _step_t* pstep);
 
+// With lookahead, the moving-window steppers fill in a record's outputs only after later records have been
+// seen. Records are held, in arrival order, until no stepper has outputs pending for them.
+typedef struct _step_held_rec_t {
+	lrec_t* prec;
+	int     num_pending;
+} step_held_rec_t;
+typedef void step_wprocess_func_t(void* pvstate, mv_t* pval, step_held_rec_t* pheld_rec);
+typedef void step_drain_func_t(void* pvstate);
+
 typedef struct _step_t {
 	void* pvstate;
 	step_dprocess_func_t* pdprocess_func;
 	step_nprocess_func_t* pnprocess_func;
 	step_sprocess_func_t* psprocess_func;
 	step_zprocess_func_t* pzprocess_func;
+	step_wprocess_func_t* pwprocess_func;
+	step_drain_func_t*    pdrain_func;
 	step_free_func_t*     pfree_func;
 } step_t;
 
 typedef step_t* step_alloc_func_t(char* input_field_name, int allow_int_float,
-	slls_t* pstring_alphas, slls_t* pewma_suffixes);
+	slls_t* pstring_alphas, slls_t* pewma_suffixes, int window_length, int window_lookahead);
 
 typedef struct _mapper_step_state_t {
 	ap_state_t*     pargp;
@@ -43,10 +56,14 @@ typedef struct _mapper_step_state_t {
 	string_array_t* pvalue_field_names;    // parameter
 	string_array_t* pvalue_field_values;   // scratch space used per-record
 	slls_t*         pgroup_by_field_names; // parameter
+	string_array_t* pgroup_by_field_values; // scratch space used per-record
 	lhmslv_t*       groups;
 	int             allow_int_float;
 	slls_t*         pstring_alphas;
 	slls_t*         pewma_suffixes;
+	int             window_length;
+	int             window_lookahead;
+	sllv_t*         pheld_recs; // non-null only when there is lookahead
 } mapper_step_state_t;
 
 // Multilevel hashmap structure:
@@ -76,21 +93,41 @@ static void      mapper_step_usage(FILE* o, char* argv0, char* verb);
 static mapper_t* mapper_step_parse_cli(int* pargi, int argc, char** argv,
 	cli_reader_opts_t* _, cli_writer_opts_t* __);
 static mapper_t* mapper_step_alloc(ap_state_t* pargp, slls_t* pstepper_names, string_array_t* pvalue_field_names,
-	slls_t* pgroup_by_field_names, int allow_int_float, slls_t* pstring_alphas, slls_t* pewma_suffixes);
+	slls_t* pgroup_by_field_names, int allow_int_float, slls_t* pstring_alphas, slls_t* pewma_suffixes,
+	int window_length, int window_lookahead);
 static void      mapper_step_free(mapper_t* pmapper, context_t* _);
 static sllv_t*   mapper_step_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static void      mapper_step_process_fields(lrec_t* pinrec, step_held_rec_t* pheld_rec, mapper_step_state_t* pstate);
+static void      mapper_step_drain(mapper_step_state_t* pstate);
+static sllv_t*   mapper_step_release_held_recs(mapper_step_state_t* pstate);
 
-static step_t* step_delta_alloc      (char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2);
-static step_t* step_shift_alloc      (char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2);
-static step_t* step_from_first_alloc (char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2);
-static step_t* step_ratio_alloc      (char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2);
-static step_t* step_rsum_alloc       (char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2);
-static step_t* step_counter_alloc    (char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2);
+static step_t* step_delta_alloc      (char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2,
+	int unused3, int unused4);
+static step_t* step_shift_alloc      (char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2,
+	int unused3, int unused4);
+static step_t* step_from_first_alloc (char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2,
+	int unused3, int unused4);
+static step_t* step_ratio_alloc      (char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2,
+	int unused3, int unused4);
+static step_t* step_rsum_alloc       (char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2,
+	int unused3, int unused4);
+static step_t* step_counter_alloc    (char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2,
+	int unused3, int unused4);
 static step_t* step_ewma_alloc       (char* input_field_name, int unused,
-	slls_t* pstring_alphas, slls_t* pewma_suffixes);
+	slls_t* pstring_alphas, slls_t* pewma_suffixes, int unused3, int unused4);
+static step_t* step_mavg_alloc       (char* input_field_name, int unused, slls_t* unused1, slls_t* unused2,
+	int window_length, int window_lookahead);
+static step_t* step_mmin_alloc       (char* input_field_name, int unused, slls_t* unused1, slls_t* unused2,
+	int window_length, int window_lookahead);
+static step_t* step_mmax_alloc       (char* input_field_name, int unused, slls_t* unused1, slls_t* unused2,
+	int window_length, int window_lookahead);
+static step_t* step_mmedian_alloc    (char* input_field_name, int unused, slls_t* unused1, slls_t* unused2,
+	int window_length, int window_lookahead);
+static step_t* step_mstddev_alloc    (char* input_field_name, int unused, slls_t* unused1, slls_t* unused2,
+	int window_length, int window_lookahead);
 
 static step_t* make_step(char* step_name, char* input_field_name, int allow_int_float,
-	slls_t* pstring_alphas, slls_t* pewma_suffixes);
+	slls_t* pstring_alphas, slls_t* pewma_suffixes, int window_length, int window_lookahead);
 
 typedef struct _step_lookup_t {
 	char* name;
@@ -105,6 +142,11 @@ static step_lookup_t step_lookup_table[] = {
 	{"rsum",       step_rsum_alloc,       "Compute running sums of field(s) between successive records"},
 	{"counter",    step_counter_alloc,    "Count instances of field(s) between successive records"},
 	{"ewma",       step_ewma_alloc,       "Exponentially weighted moving average over successive records"},
+	{"mavg",       step_mavg_alloc,       "Mean of field(s) over a sliding window of records"},
+	{"mmin",       step_mmin_alloc,       "Minimum of field(s) over a sliding window of records"},
+	{"mmax",       step_mmax_alloc,       "Maximum of field(s) over a sliding window of records"},
+	{"mmedian",    step_mmedian_alloc,    "Median of field(s) over a sliding window of records"},
+	{"mstddev",    step_mstddev_alloc,    "Standard deviation of field(s) over a sliding window of records"},
 };
 static int step_lookup_table_length = sizeof(step_lookup_table) / sizeof(step_lookup_table[0]);
 
@@ -138,6 +180,14 @@ static void mapper_step_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "-o {a,b,c} Custom suffixes for EWMA output fields. If omitted, these default to\n");
 	fprintf(o, "           the -d values. If supplied, the number of -o values must be the same\n");
 	fprintf(o, "           as the number of -d values.\n");
+	fprintf(o, "-w {n}     Window length, in records, for the moving steppers mavg, mmin, mmax,\n");
+	fprintf(o, "           mmedian, and mstddev. Default %d. Near the ends of the input, and of each\n",
+		DEFAULT_WINDOW_LENGTH);
+	fprintf(o, "           group, the windows hold only the records there are.\n");
+	fprintf(o, "-l {k}     Lookahead for the moving steppers: the window for each record holds it,\n");
+	fprintf(o, "           k records after it, and n-1-k before it. Default 0. Records are then\n");
+	fprintf(o, "           output only once their windows are complete.\n");
+	fprintf(o, "-c         Center the windows, i.e. -l (n-1)/2.\n");
 	fprintf(o, "\n");
 	fprintf(o, "Examples:\n");
 	fprintf(o, "  %s %s -a rsum -f request_size\n", argv0, verb);
@@ -145,6 +195,8 @@ static void mapper_step_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "  %s %s -a ewma -d 0.1,0.9 -f x,y\n", argv0, verb);
 	fprintf(o, "  %s %s -a ewma -d 0.1,0.9 -o smooth,rough -f x,y\n", argv0, verb);
 	fprintf(o, "  %s %s -a ewma -d 0.1,0.9 -o smooth,rough -f x,y -g group_name\n", argv0, verb);
+	fprintf(o, "  %s %s -a mavg,mmedian -w 10 -f x,y -g group_name\n", argv0, verb);
+	fprintf(o, "  %s %s -a mmin,mmax -w 7 -c -f x\n", argv0, verb);
 	fprintf(o, "\n");
 	fprintf(o, "Please see http://johnkerl.org/miller/doc/reference.html#filter or\n");
 	fprintf(o, "https://en.wikipedia.org/wiki/Moving_average#Exponential_moving_average\n");
@@ -160,6 +212,9 @@ static mapper_t* mapper_step_parse_cli(int* pargi, int argc, char** argv,
 	slls_t*         pstring_alphas        = slls_single_no_free(DEFAULT_STRING_ALPHA);
 	slls_t*         pewma_suffixes        = NULL;
 	int             allow_int_float       = TRUE;
+	int             window_length         = DEFAULT_WINDOW_LENGTH;
+	int             window_lookahead      = 0;
+	int             do_center             = FALSE;
 
 	char* verb = argv[(*pargi)++];
 
@@ -170,6 +225,9 @@ static mapper_t* mapper_step_parse_cli(int* pargi, int argc, char** argv,
 	ap_define_string_list_flag(pstate,  "-d", &pstring_alphas);
 	ap_define_string_list_flag(pstate,  "-o", &pewma_suffixes);
 	ap_define_false_flag(pstate,        "-F", &allow_int_float);
+	ap_define_int_flag(pstate,          "-w", &window_length);
+	ap_define_int_flag(pstate,          "-l", &window_lookahead);
+	ap_define_true_flag(pstate,         "-c", &do_center);
 
 	if (!ap_parse(pstate, verb, pargi, argc, argv)) {
 		mapper_step_usage(stderr, argv[0], verb);
@@ -187,15 +245,23 @@ static mapper_t* mapper_step_parse_cli(int* pargi, int argc, char** argv,
 		}
 	}
 
+	if (do_center)
+		window_lookahead = (window_length - 1) / 2;
+	if (window_length < 1 || window_lookahead < 0 || window_lookahead >= window_length) {
+		mapper_step_usage(stderr, argv[0], verb);
+		return NULL;
+	}
+
 	return mapper_step_alloc(pstate, pstepper_names, pvalue_field_names, pgroup_by_field_names,
-		allow_int_float, pstring_alphas, pewma_suffixes);
+		allow_int_float, pstring_alphas, pewma_suffixes, window_length, window_lookahead);
 }
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_step_alloc(ap_state_t* pargp, slls_t* pstepper_names, string_array_t* pvalue_field_names,
-	slls_t* pgroup_by_field_names, int allow_int_float, slls_t* pstring_alphas, slls_t* pewma_suffixes)
+	slls_t* pgroup_by_field_names, int allow_int_float, slls_t* pstring_alphas, slls_t* pewma_suffixes,
+	int window_length, int window_lookahead)
 {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_step_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_step_state_t));
 
@@ -204,10 +270,14 @@ static mapper_t* mapper_step_alloc(ap_state_t* pargp, slls_t* pstepper_names, st
 	pstate->pvalue_field_names    = pvalue_field_names;
 	pstate->pvalue_field_values   = string_array_alloc(pvalue_field_names->length);
 	pstate->pgroup_by_field_names = pgroup_by_field_names;
+	pstate->pgroup_by_field_values = string_array_alloc(pgroup_by_field_names->length);
 	pstate->groups                = lhmslv_alloc();
 	pstate->allow_int_float       = allow_int_float;
 	pstate->pstring_alphas        = pstring_alphas;
 	pstate->pewma_suffixes        = pewma_suffixes;
+	pstate->window_length         = window_length;
+	pstate->window_lookahead      = window_lookahead;
+	pstate->pheld_recs            = (window_lookahead > 0) ? sllv_alloc() : NULL;
 
 	pmapper->pvstate       = pstate;
 	pmapper->pprocess_func = mapper_step_process;
@@ -222,6 +292,7 @@ static void mapper_step_free(mapper_t* pmapper, context_t* _) {
 	string_array_free(pstate->pvalue_field_names);
 	string_array_free(pstate->pvalue_field_values);
 	slls_free(pstate->pgroup_by_field_names);
+	string_array_free(pstate->pgroup_by_field_values);
 	slls_free(pstate->pstring_alphas);
 	slls_free(pstate->pewma_suffixes);
 
@@ -240,6 +311,14 @@ static void mapper_step_free(mapper_t* pmapper, context_t* _) {
 		lhmsv_free(pgroup_to_acc_field);
 	}
 	lhmslv_free(pstate->groups);
+	if (pstate->pheld_recs != NULL) {
+		while (pstate->pheld_recs->phead != NULL) {
+			step_held_rec_t* pheld_rec = sllv_pop(pstate->pheld_recs);
+			lrec_free(pheld_rec->prec);
+			free(pheld_rec);
+		}
+		sllv_free(pstate->pheld_recs);
+	}
 	ap_free(pstate->pargp);
 	free(pstate);
 	free(pmapper);
@@ -248,24 +327,45 @@ static void mapper_step_free(mapper_t* pmapper, context_t* _) {
 // ----------------------------------------------------------------
 static sllv_t* mapper_step_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	mapper_step_state_t* pstate = pvstate;
-	if (pinrec == NULL)
-		return sllv_single(NULL);
+	if (pinrec == NULL) {
+		if (pstate->pheld_recs == NULL)
+			return sllv_single(NULL);
+		mapper_step_drain(pstate);
+		sllv_t* poutrecs = mapper_step_release_held_recs(pstate);
+		if (poutrecs == NULL)
+			poutrecs = sllv_alloc();
+		sllv_append(poutrecs, NULL);
+		return poutrecs;
+	}
+
+	if (pstate->pheld_recs == NULL) {
+		step_held_rec_t held_rec = { .prec = pinrec, .num_pending = 0 };
+		mapper_step_process_fields(pinrec, &held_rec, pstate);
+		return sllv_single(pinrec);
+	}
 
+	step_held_rec_t* pheld_rec = mlr_malloc_or_die(sizeof(step_held_rec_t));
+	pheld_rec->prec = pinrec;
+	pheld_rec->num_pending = 0;
+	mapper_step_process_fields(pinrec, pheld_rec, pstate);
+	sllv_append(pstate->pheld_recs, pheld_rec);
+	return mapper_step_release_held_recs(pstate);
+}
+
+static void mapper_step_process_fields(lrec_t* pinrec, step_held_rec_t* pheld_rec, mapper_step_state_t* pstate) {
 	// ["s", "t"]
 	mlr_reference_values_from_record_into_string_array(pinrec, pstate->pvalue_field_names, pstate->pvalue_field_values);
-	slls_t* pgroup_by_field_values = mlr_reference_selected_values_from_record(pinrec, pstate->pgroup_by_field_names);
-
-	if (pgroup_by_field_values == NULL) {
-		slls_free(pgroup_by_field_values);
-		return sllv_single(pinrec);
+	if (!mlr_reference_selected_values_from_record_into_array(pinrec, pstate->pgroup_by_field_names,
+		pstate->pgroup_by_field_values))
+	{
+		return;
 	}
 
-	lhmsv_t* pgroup_to_acc_field = lhmslv_get(pstate->groups, pgroup_by_field_values);
+	lhmsv_t* pgroup_to_acc_field = lhmslv_get_from_string_array(pstate->groups, pstate->pgroup_by_field_values);
 	if (pgroup_to_acc_field == NULL) {
 		pgroup_to_acc_field = lhmsv_alloc();
-		lhmslv_put(pstate->groups, slls_copy(pgroup_by_field_values), pgroup_to_acc_field, FREE_ENTRY_KEY);
+		lhmslv_put_copy_of_string_array(pstate->groups, pstate->pgroup_by_field_values, pgroup_to_acc_field);
 	}
-	slls_free(pgroup_by_field_values);
 
 	// for x=1 and y=2
 	int n = pstate->pvalue_field_names->length;
@@ -293,7 +393,7 @@ static sllv_t* mapper_step_process(lrec_t* pinrec, context_t* pctx, void* pvstat
 			step_t* pstep = lhmsv_get(pacc_field_to_acc_state, step_name);
 			if (pstep == NULL) {
 				pstep = make_step(step_name, value_field_name, pstate->allow_int_float,
-					pstate->pstring_alphas, pstate->pewma_suffixes);
+					pstate->pstring_alphas, pstate->pewma_suffixes, pstate->window_length, pstate->window_lookahead);
 				if (pstep == NULL) {
 					fprintf(stderr, "mlr step: stepper \"%s\" not found.\n",
 						step_name);
@@ -316,14 +416,17 @@ static sllv_t* mapper_step_process(lrec_t* pinrec, context_t* pctx, void* pvstat
 					pstep->pdprocess_func(pstep->pvstate, value_field_dval, pinrec);
 				}
 
-				if (pstep->pnprocess_func != NULL) {
+				if (pstep->pnprocess_func != NULL || pstep->pwprocess_func != NULL) {
 					if (!have_nval) {
 						value_field_nval = pstate->allow_int_float
 							? mv_scan_number_or_die(value_field_sval)
 							: mv_from_float(mlr_double_from_string_or_die(value_field_sval));
 						have_nval = TRUE;
 					}
-					pstep->pnprocess_func(pstep->pvstate, &value_field_nval, pinrec);
+					if (pstep->pnprocess_func != NULL)
+						pstep->pnprocess_func(pstep->pvstate, &value_field_nval, pinrec);
+					else
+						pstep->pwprocess_func(pstep->pvstate, &value_field_nval, pheld_rec);
 				}
 
 				if (pstep->psprocess_func != NULL) {
@@ -332,16 +435,45 @@ static sllv_t* mapper_step_process(lrec_t* pinrec, context_t* pctx, void* pvstat
 			}
 		}
 	}
-	return sllv_single(pinrec);
+}
+
+// At end of stream, the windows of the last records in each group are as complete as they will get.
+static void mapper_step_drain(mapper_step_state_t* pstate) {
+	for (lhmslve_t* pa = pstate->groups->phead; pa != NULL; pa = pa->pnext) {
+		lhmsv_t* pgroup_to_acc_field = pa->pvvalue;
+		for (lhmsve_t* pb = pgroup_to_acc_field->phead; pb != NULL; pb = pb->pnext) {
+			lhmsv_t* pacc_field_to_acc_state = pb->pvvalue;
+			for (lhmsve_t* pc = pacc_field_to_acc_state->phead; pc != NULL; pc = pc->pnext) {
+				step_t* pstep = pc->pvvalue;
+				if (pstep->pdrain_func != NULL)
+					pstep->pdrain_func(pstep->pvstate);
+			}
+		}
+	}
+}
+
+static sllv_t* mapper_step_release_held_recs(mapper_step_state_t* pstate) {
+	sllv_t* poutrecs = NULL;
+	while (pstate->pheld_recs->phead != NULL) {
+		step_held_rec_t* pheld_rec = pstate->pheld_recs->phead->pvvalue;
+		if (pheld_rec->num_pending > 0)
+			break;
+		sllv_pop(pstate->pheld_recs);
+		if (poutrecs == NULL)
+			poutrecs = sllv_alloc();
+		sllv_append(poutrecs, pheld_rec->prec);
+		free(pheld_rec);
+	}
+	return poutrecs;
 }
 
 static step_t* make_step(char* step_name, char* input_field_name, int allow_int_float,
-	slls_t* pstring_alphas, slls_t* pewma_suffixes)
+	slls_t* pstring_alphas, slls_t* pewma_suffixes, int window_length, int window_lookahead)
 {
 	for (int i = 0; i < step_lookup_table_length; i++)
 		if (streq(step_name, step_lookup_table[i].name))
 			return step_lookup_table[i].palloc_func(input_field_name, allow_int_float,
-				pstring_alphas, pewma_suffixes);
+				pstring_alphas, pewma_suffixes, window_length, window_lookahead);
 	return NULL;
 }
 
@@ -372,7 +504,9 @@ static void step_delta_free(step_t* pstep) {
 	free(pstate);
 	free(pstep);
 }
-static step_t* step_delta_alloc(char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2) {
+static step_t* step_delta_alloc(char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2,
+	int unused3, int unused4)
+{
 	step_t* pstep = mlr_malloc_or_die(sizeof(step_t));
 	step_delta_state_t* pstate = mlr_malloc_or_die(sizeof(step_delta_state_t));
 	pstate->prev = mv_absent();
@@ -383,6 +517,8 @@ static step_t* step_delta_alloc(char* input_field_name, int allow_int_float, sll
 	pstep->pnprocess_func = step_delta_nprocess;
 	pstep->psprocess_func = NULL;
 	pstep->pzprocess_func = step_delta_zprocess;
+	pstep->pwprocess_func = NULL;
+	pstep->pdrain_func    = NULL;
 	pstep->pfree_func     = step_delta_free;
 	return pstep;
 }
@@ -409,7 +545,9 @@ static void step_shift_free(step_t* pstep) {
 	free(pstate);
 	free(pstep);
 }
-static step_t* step_shift_alloc(char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2) {
+static step_t* step_shift_alloc(char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2,
+	int unused3, int unused4)
+{
 	step_t* pstep = mlr_malloc_or_die(sizeof(step_t));
 	step_shift_state_t* pstate = mlr_malloc_or_die(sizeof(step_shift_state_t));
 	pstate->prev = mlr_strdup_or_die("");
@@ -420,6 +558,8 @@ static step_t* step_shift_alloc(char* input_field_name, int allow_int_float, sll
 	pstep->pnprocess_func = NULL;
 	pstep->psprocess_func = step_shift_sprocess;
 	pstep->pzprocess_func = step_shift_zprocess;
+	pstep->pwprocess_func = NULL;
+	pstep->pdrain_func    = NULL;
 	pstep->pfree_func     = step_shift_free;
 	return pstep;
 }
@@ -451,7 +591,9 @@ static void step_from_first_free(step_t* pstep) {
 	free(pstate);
 	free(pstep);
 }
-static step_t* step_from_first_alloc(char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2) {
+static step_t* step_from_first_alloc(char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2,
+	int unused3, int unused4)
+{
 	step_t* pstep = mlr_malloc_or_die(sizeof(step_t));
 	step_from_first_state_t* pstate = mlr_malloc_or_die(sizeof(step_from_first_state_t));
 	pstate->first = mv_absent();
@@ -462,6 +604,8 @@ static step_t* step_from_first_alloc(char* input_field_name, int allow_int_float
 	pstep->pnprocess_func = step_from_first_nprocess;
 	pstep->psprocess_func = NULL;
 	pstep->pzprocess_func = step_from_first_zprocess;
+	pstep->pwprocess_func = NULL;
+	pstep->pdrain_func    = NULL;
 	pstep->pfree_func     = step_from_first_free;
 	return pstep;
 }
@@ -494,7 +638,9 @@ static void step_ratio_free(step_t* pstep) {
 	free(pstate);
 	free(pstep);
 }
-static step_t* step_ratio_alloc(char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2) {
+static step_t* step_ratio_alloc(char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2,
+	int unused3, int unused4)
+{
 	step_t* pstep = mlr_malloc_or_die(sizeof(step_t));
 	step_ratio_state_t* pstate = mlr_malloc_or_die(sizeof(step_ratio_state_t));
 	pstate->prev          = -999.0;
@@ -506,6 +652,8 @@ static step_t* step_ratio_alloc(char* input_field_name, int allow_int_float, sll
 	pstep->pnprocess_func = NULL;
 	pstep->psprocess_func = NULL;
 	pstep->pzprocess_func = step_ratio_zprocess;
+	pstep->pwprocess_func = NULL;
+	pstep->pdrain_func    = NULL;
 	pstep->pfree_func     = step_ratio_free;
 	return pstep;
 }
@@ -532,7 +680,9 @@ static void step_rsum_free(step_t* pstep) {
 	free(pstate);
 	free(pstep);
 }
-static step_t* step_rsum_alloc(char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2) {
+static step_t* step_rsum_alloc(char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2,
+	int unused3, int unused4)
+{
 	step_t* pstep = mlr_malloc_or_die(sizeof(step_t));
 	step_rsum_state_t* pstate = mlr_malloc_or_die(sizeof(step_rsum_state_t));
 	pstate->allow_int_float = allow_int_float;
@@ -543,6 +693,8 @@ static step_t* step_rsum_alloc(char* input_field_name, int allow_int_float, slls
 	pstep->pnprocess_func = step_rsum_nprocess;
 	pstep->psprocess_func = NULL;
 	pstep->pzprocess_func = step_rsum_zprocess;
+	pstep->pwprocess_func = NULL;
+	pstep->pdrain_func    = NULL;
 	pstep->pfree_func     = step_rsum_free;
 	return pstep;
 }
@@ -569,7 +721,9 @@ static void step_counter_free(step_t* pstep) {
 	free(pstate);
 	free(pstep);
 }
-static step_t* step_counter_alloc(char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2) {
+static step_t* step_counter_alloc(char* input_field_name, int allow_int_float, slls_t* unused1, slls_t* unused2,
+	int unused3, int unused4)
+{
 	step_t* pstep = mlr_malloc_or_die(sizeof(step_t));
 	step_counter_state_t* pstate = mlr_malloc_or_die(sizeof(step_counter_state_t));
 	pstate->counter = allow_int_float ? mv_from_int(0LL) : mv_from_float(0.0);
@@ -581,6 +735,8 @@ static step_t* step_counter_alloc(char* input_field_name, int allow_int_float, s
 	pstep->pnprocess_func = NULL;
 	pstep->psprocess_func = step_counter_sprocess;
 	pstep->pzprocess_func = step_counter_zprocess;
+	pstep->pwprocess_func = NULL;
+	pstep->pdrain_func    = NULL;
 	pstep->pfree_func     = step_counter_free;
 	return pstep;
 }
@@ -632,7 +788,9 @@ static void step_ewma_free(step_t* pstep) {
 	free(pstep);
 }
 
-static step_t* step_ewma_alloc(char* input_field_name, int unused, slls_t* pstring_alphas, slls_t* pewma_suffixes) {
+static step_t* step_ewma_alloc(char* input_field_name, int unused, slls_t* pstring_alphas, slls_t* pewma_suffixes,
+	int unused3, int unused4)
+{
 	step_t* pstep              = mlr_malloc_or_die(sizeof(step_t));
 
 	step_ewma_state_t* pstate  = mlr_malloc_or_die(sizeof(step_ewma_state_t));
@@ -661,6 +819,392 @@ static step_t* step_ewma_alloc(char* input_field_name, int unused, slls_t* pstri
 	pstep->pnprocess_func = NULL;
 	pstep->psprocess_func = NULL;
 	pstep->pzprocess_func = step_ewma_zprocess;
+	pstep->pwprocess_func = NULL;
+	pstep->pdrain_func    = NULL;
 	pstep->pfree_func     = step_ewma_free;
 	return pstep;
 }
+
+// ----------------------------------------------------------------
+// Moving-window steppers. Each keeps the values of the last window_length records of its group in a ring,
+// indexed by arrival count modulo the window length, with aggregates which are updated as values enter and
+// leave the window: running sums for mean and standard deviation, monotonic deques for min and max, and a
+// pair of heaps for the median. So each record costs O(1) amortized, or O(log n) for the median, regardless
+// of window length.
+//
+// The window for the record with index i holds indices i-lookbehind through i+lookahead, so the output for
+// record i is known once record i+lookahead has arrived, or at end of stream.
+
+struct _step_window_state_t;
+typedef void  step_window_add_func_t(struct _step_window_state_t* pstate, int slot);
+typedef void  step_window_remove_func_t(struct _step_window_state_t* pstate, int slot);
+typedef char* step_window_alloc_output_func_t(struct _step_window_state_t* pstate);
+
+typedef struct _step_window_heap_t {
+	int* slots;
+	int  size;
+	int  is_max;
+} step_window_heap_t;
+
+typedef struct _step_window_state_t {
+	int               length;
+	int               lookahead;
+	mv_t*             values;    // ring of window values
+	step_held_rec_t** pheld_recs; // ring of the records they came from
+	long long         num_ingested;
+	long long         window_start; // index of the oldest value still in the window
+	char*             output_field_name;
+
+	step_window_add_func_t*          padd_func;
+	step_window_remove_func_t*       premove_func;
+	step_window_alloc_output_func_t* palloc_output_func;
+
+	// mavg, mstddev: compensated sums, so that a large value doesn't take the small ones with it when it leaves,
+	// and recomputed from the ring every window length of removals, so that rounding errors don't build up.
+	double sumx;
+	double sumx_comp;
+	double sumx2;
+	double sumx2_comp;
+	int    num_removed;
+	// mmin, mmax: ring of slots with values in increasing (mmin) or decreasing (mmax) order
+	int*   deque;
+	int    deque_head;
+	int    deque_size;
+	// mmedian: max-heap of the lower half and min-heap of the upper half, with each slot's heap position
+	step_window_heap_t lo_heap;
+	step_window_heap_t hi_heap;
+	int*   heap_positions;
+	char*  heap_sides;
+} step_window_state_t;
+
+static double step_window_double(mv_t* pval) {
+	return (pval->type == MT_INT) ? (double)pval->u.intv : pval->u.fltv;
+}
+
+static void step_window_put_output(step_window_state_t* pstate, step_held_rec_t* pheld_rec) {
+	lrec_put(pheld_rec->prec, pstate->output_field_name, pstate->palloc_output_func(pstate), FREE_ENTRY_VALUE);
+}
+
+static void step_window_wprocess(void* pvstate, mv_t* pval, step_held_rec_t* pheld_rec) {
+	step_window_state_t* pstate = pvstate;
+	long long index = pstate->num_ingested;
+	while (pstate->window_start <= index - pstate->length) {
+		pstate->premove_func(pstate, pstate->window_start % pstate->length);
+		pstate->window_start++;
+	}
+	int slot = index % pstate->length;
+	pstate->values[slot] = *pval;
+	pstate->pheld_recs[slot] = pheld_rec;
+	pstate->padd_func(pstate, slot);
+	pstate->num_ingested++;
+
+	if (pstate->lookahead == 0) {
+		step_window_put_output(pstate, pheld_rec);
+	} else {
+		// Placeholder, to keep the field where it would be without lookahead
+		lrec_put(pheld_rec->prec, pstate->output_field_name, "", NO_FREE);
+		pheld_rec->num_pending++;
+		long long ready_index = index - pstate->lookahead;
+		if (ready_index >= 0) {
+			step_held_rec_t* pready_rec = pstate->pheld_recs[ready_index % pstate->length];
+			step_window_put_output(pstate, pready_rec);
+			pready_rec->num_pending--;
+		}
+	}
+}
+
+static void step_window_drain(void* pvstate) {
+	step_window_state_t* pstate = pvstate;
+	long long lookbehind = pstate->length - 1 - pstate->lookahead;
+	long long ready_index = pstate->num_ingested - pstate->lookahead;
+	if (ready_index < 0)
+		ready_index = 0;
+	for ( ; ready_index < pstate->num_ingested; ready_index++) {
+		while (pstate->window_start < ready_index - lookbehind) {
+			pstate->premove_func(pstate, pstate->window_start % pstate->length);
+			pstate->window_start++;
+		}
+		step_held_rec_t* pready_rec = pstate->pheld_recs[ready_index % pstate->length];
+		step_window_put_output(pstate, pready_rec);
+		pready_rec->num_pending--;
+	}
+	pstate->window_start = pstate->num_ingested;
+}
+
+static void step_window_zprocess(void* pvstate, lrec_t* prec) {
+	step_window_state_t* pstate = pvstate;
+	lrec_put(prec, pstate->output_field_name, "", NO_FREE);
+}
+
+static void step_window_free(step_t* pstep) {
+	step_window_state_t* pstate = pstep->pvstate;
+	free(pstate->values);
+	free(pstate->pheld_recs);
+	free(pstate->deque);
+	free(pstate->lo_heap.slots);
+	free(pstate->hi_heap.slots);
+	free(pstate->heap_positions);
+	free(pstate->heap_sides);
+	free(pstate->output_field_name);
+	free(pstate);
+	free(pstep);
+}
+
+static step_t* step_window_alloc(char* input_field_name, char* step_name, int window_length, int window_lookahead,
+	step_window_add_func_t* padd_func, step_window_remove_func_t* premove_func,
+	step_window_alloc_output_func_t* palloc_output_func)
+{
+	step_t* pstep = mlr_malloc_or_die(sizeof(step_t));
+	step_window_state_t* pstate = mlr_malloc_or_die(sizeof(step_window_state_t));
+	pstate->length             = window_length;
+	pstate->lookahead          = window_lookahead;
+	pstate->values             = mlr_malloc_or_die(window_length * sizeof(mv_t));
+	pstate->pheld_recs         = mlr_malloc_or_die(window_length * sizeof(step_held_rec_t*));
+	pstate->num_ingested       = 0LL;
+	pstate->window_start       = 0LL;
+	pstate->output_field_name  = mlr_paste_3_strings(input_field_name, "_", step_name);
+	pstate->padd_func          = padd_func;
+	pstate->premove_func       = premove_func;
+	pstate->palloc_output_func = palloc_output_func;
+	pstate->sumx               = 0.0;
+	pstate->sumx_comp          = 0.0;
+	pstate->sumx2              = 0.0;
+	pstate->sumx2_comp         = 0.0;
+	pstate->num_removed        = 0;
+	pstate->deque              = NULL;
+	pstate->deque_head         = 0;
+	pstate->deque_size         = 0;
+	pstate->lo_heap            = (step_window_heap_t) { .slots = NULL, .size = 0, .is_max = TRUE };
+	pstate->hi_heap            = (step_window_heap_t) { .slots = NULL, .size = 0, .is_max = FALSE };
+	pstate->heap_positions     = NULL;
+	pstate->heap_sides         = NULL;
+
+	pstep->pvstate        = (void*)pstate;
+	pstep->pdprocess_func = NULL;
+	pstep->pnprocess_func = NULL;
+	pstep->psprocess_func = NULL;
+	pstep->pzprocess_func = step_window_zprocess;
+	pstep->pwprocess_func = step_window_wprocess;
+	pstep->pdrain_func    = (window_lookahead > 0) ? step_window_drain : NULL;
+	pstep->pfree_func     = step_window_free;
+	return pstep;
+}
+
+// ----------------------------------------------------------------
+// Neumaier's variant of Kahan summation: *pcomp accumulates what rounding drops from *psum.
+static void step_window_compensated_add(double* psum, double* pcomp, double x) {
+	double t = *psum + x;
+	if (fabs(*psum) >= fabs(x))
+		*pcomp += (*psum - t) + x;
+	else
+		*pcomp += (x - t) + *psum;
+	*psum = t;
+}
+static void step_window_sums_add(step_window_state_t* pstate, int slot) {
+	double x = step_window_double(&pstate->values[slot]);
+	step_window_compensated_add(&pstate->sumx,  &pstate->sumx_comp,  x);
+	step_window_compensated_add(&pstate->sumx2, &pstate->sumx2_comp, x*x);
+}
+static void step_window_sums_remove(step_window_state_t* pstate, int slot) {
+	if (++pstate->num_removed < pstate->length) {
+		double x = step_window_double(&pstate->values[slot]);
+		step_window_compensated_add(&pstate->sumx,  &pstate->sumx_comp,  -x);
+		step_window_compensated_add(&pstate->sumx2, &pstate->sumx2_comp, -x*x);
+		return;
+	}
+	// The value in the slot is leaving: the window is then the ones after it.
+	pstate->num_removed = 0;
+	pstate->sumx  = pstate->sumx_comp  = 0.0;
+	pstate->sumx2 = pstate->sumx2_comp = 0.0;
+	for (long long i = pstate->window_start + 1; i < pstate->num_ingested; i++)
+		step_window_sums_add(pstate, i % pstate->length);
+}
+static long long step_window_count(step_window_state_t* pstate) {
+	return pstate->num_ingested - pstate->window_start;
+}
+
+static char* step_mavg_alloc_output(step_window_state_t* pstate) {
+	return mlr_alloc_string_from_double((pstate->sumx + pstate->sumx_comp) / step_window_count(pstate),
+		MLR_GLOBALS.ofmt);
+}
+static step_t* step_mavg_alloc(char* input_field_name, int unused, slls_t* unused1, slls_t* unused2,
+	int window_length, int window_lookahead)
+{
+	return step_window_alloc(input_field_name, "mavg", window_length, window_lookahead,
+		step_window_sums_add, step_window_sums_remove, step_mavg_alloc_output);
+}
+
+static char* step_mstddev_alloc_output(step_window_state_t* pstate) {
+	long long n = step_window_count(pstate);
+	if (n < 2LL)
+		return mlr_strdup_or_die("");
+	return mlr_alloc_string_from_double(
+		sqrt(mlr_get_var(n, pstate->sumx + pstate->sumx_comp, pstate->sumx2 + pstate->sumx2_comp)),
+		MLR_GLOBALS.ofmt);
+}
+static step_t* step_mstddev_alloc(char* input_field_name, int unused, slls_t* unused1, slls_t* unused2,
+	int window_length, int window_lookahead)
+{
+	return step_window_alloc(input_field_name, "mstddev", window_length, window_lookahead,
+		step_window_sums_add, step_window_sums_remove, step_mstddev_alloc_output);
+}
+
+// ----------------------------------------------------------------
+// Values which can never be the window min (max) again, being older than and not less (greater) than a
+// newer one, are dropped from the back of the deque; the front is the window's min (max).
+static int step_window_deque_back(step_window_state_t* pstate) {
+	return pstate->deque[(pstate->deque_head + pstate->deque_size - 1) % pstate->length];
+}
+static void step_window_deque_push(step_window_state_t* pstate, int slot) {
+	pstate->deque[(pstate->deque_head + pstate->deque_size) % pstate->length] = slot;
+	pstate->deque_size++;
+}
+static void step_window_deque_remove(step_window_state_t* pstate, int slot) {
+	if (pstate->deque_size > 0 && pstate->deque[pstate->deque_head] == slot) {
+		pstate->deque_head = (pstate->deque_head + 1) % pstate->length;
+		pstate->deque_size--;
+	}
+}
+static char* step_window_deque_alloc_output(step_window_state_t* pstate) {
+	return mv_alloc_format_val(&pstate->values[pstate->deque[pstate->deque_head]]);
+}
+
+static void step_mmin_add(step_window_state_t* pstate, int slot) {
+	while (pstate->deque_size > 0
+		&& !mv_i_nn_lt(&pstate->values[step_window_deque_back(pstate)], &pstate->values[slot]))
+	{
+		pstate->deque_size--;
+	}
+	step_window_deque_push(pstate, slot);
+}
+static step_t* step_mmin_alloc(char* input_field_name, int unused, slls_t* unused1, slls_t* unused2,
+	int window_length, int window_lookahead)
+{
+	step_t* pstep = step_window_alloc(input_field_name, "mmin", window_length, window_lookahead,
+		step_mmin_add, step_window_deque_remove, step_window_deque_alloc_output);
+	step_window_state_t* pstate = pstep->pvstate;
+	pstate->deque = mlr_malloc_or_die(window_length * sizeof(int));
+	return pstep;
+}
+
+static void step_mmax_add(step_window_state_t* pstate, int slot) {
+	while (pstate->deque_size > 0
+		&& !mv_i_nn_gt(&pstate->values[step_window_deque_back(pstate)], &pstate->values[slot]))
+	{
+		pstate->deque_size--;
+	}
+	step_window_deque_push(pstate, slot);
+}
+static step_t* step_mmax_alloc(char* input_field_name, int unused, slls_t* unused1, slls_t* unused2,
+	int window_length, int window_lookahead)
+{
+	step_t* pstep = step_window_alloc(input_field_name, "mmax", window_length, window_lookahead,
+		step_mmax_add, step_window_deque_remove, step_window_deque_alloc_output);
+	step_window_state_t* pstate = pstep->pvstate;
+	pstate->deque = mlr_malloc_or_die(window_length * sizeof(int));
+	return pstep;
+}
+
+// ----------------------------------------------------------------
+// The lower half of the window is in a max-heap and the upper half in a min-heap, with the lower half
+// having the extra value when the count is odd. Since each slot knows its heap position, a value leaving the
+// window is removed directly rather than lazily. The median is as for stats1: the value at index n/2 in
+// sorted order, non-interpolated.
+
+static int step_window_heap_above(step_window_state_t* pstate, step_window_heap_t* pheap, int slot_a, int slot_b) {
+	return pheap->is_max
+		? mv_i_nn_gt(&pstate->values[slot_a], &pstate->values[slot_b])
+		: mv_i_nn_lt(&pstate->values[slot_a], &pstate->values[slot_b]);
+}
+
+static void step_window_heap_set(step_window_state_t* pstate, step_window_heap_t* pheap, int pos, int slot) {
+	pheap->slots[pos] = slot;
+	pstate->heap_positions[slot] = pos;
+	pstate->heap_sides[slot] = pheap->is_max;
+}
+
+static void step_window_heap_sift(step_window_state_t* pstate, step_window_heap_t* pheap, int pos) {
+	int slot = pheap->slots[pos];
+	while (pos > 0) {
+		int parent = (pos - 1) / 2;
+		if (!step_window_heap_above(pstate, pheap, slot, pheap->slots[parent]))
+			break;
+		step_window_heap_set(pstate, pheap, pos, pheap->slots[parent]);
+		pos = parent;
+	}
+	while (TRUE) {
+		int child = 2 * pos + 1;
+		if (child >= pheap->size)
+			break;
+		if (child + 1 < pheap->size && step_window_heap_above(pstate, pheap, pheap->slots[child+1], pheap->slots[child]))
+			child++;
+		if (!step_window_heap_above(pstate, pheap, pheap->slots[child], slot))
+			break;
+		step_window_heap_set(pstate, pheap, pos, pheap->slots[child]);
+		pos = child;
+	}
+	step_window_heap_set(pstate, pheap, pos, slot);
+}
+
+static void step_window_heap_push(step_window_state_t* pstate, step_window_heap_t* pheap, int slot) {
+	step_window_heap_set(pstate, pheap, pheap->size, slot);
+	pheap->size++;
+	step_window_heap_sift(pstate, pheap, pheap->size - 1);
+}
+
+static int step_window_heap_remove_at(step_window_state_t* pstate, step_window_heap_t* pheap, int pos) {
+	int slot = pheap->slots[pos];
+	pheap->size--;
+	if (pos < pheap->size) {
+		step_window_heap_set(pstate, pheap, pos, pheap->slots[pheap->size]);
+		step_window_heap_sift(pstate, pheap, pos);
+	}
+	return slot;
+}
+
+static void step_mmedian_rebalance(step_window_state_t* pstate) {
+	if (pstate->lo_heap.size > pstate->hi_heap.size + 1) {
+		int slot = step_window_heap_remove_at(pstate, &pstate->lo_heap, 0);
+		step_window_heap_push(pstate, &pstate->hi_heap, slot);
+	} else if (pstate->hi_heap.size > pstate->lo_heap.size) {
+		int slot = step_window_heap_remove_at(pstate, &pstate->hi_heap, 0);
+		step_window_heap_push(pstate, &pstate->lo_heap, slot);
+	}
+}
+
+static void step_mmedian_add(step_window_state_t* pstate, int slot) {
+	if (pstate->lo_heap.size == 0
+		|| !mv_i_nn_gt(&pstate->values[slot], &pstate->values[pstate->lo_heap.slots[0]]))
+	{
+		step_window_heap_push(pstate, &pstate->lo_heap, slot);
+	} else {
+		step_window_heap_push(pstate, &pstate->hi_heap, slot);
+	}
+	step_mmedian_rebalance(pstate);
+}
+
+static void step_mmedian_remove(step_window_state_t* pstate, int slot) {
+	step_window_heap_t* pheap = pstate->heap_sides[slot] ? &pstate->lo_heap : &pstate->hi_heap;
+	step_window_heap_remove_at(pstate, pheap, pstate->heap_positions[slot]);
+	step_mmedian_rebalance(pstate);
+}
+
+static char* step_mmedian_alloc_output(step_window_state_t* pstate) {
+	int slot = (pstate->lo_heap.size > pstate->hi_heap.size)
+		? pstate->lo_heap.slots[0]
+		: pstate->hi_heap.slots[0];
+	return mv_alloc_format_val(&pstate->values[slot]);
+}
+
+static step_t* step_mmedian_alloc(char* input_field_name, int unused, slls_t* unused1, slls_t* unused2,
+	int window_length, int window_lookahead)
+{
+	step_t* pstep = step_window_alloc(input_field_name, "mmedian", window_length, window_lookahead,
+		step_mmedian_add, step_mmedian_remove, step_mmedian_alloc_output);
+	step_window_state_t* pstate = pstep->pvstate;
+	pstate->lo_heap.slots  = mlr_malloc_or_die(window_length * sizeof(int));
+	pstate->hi_heap.slots  = mlr_malloc_or_die(window_length * sizeof(int));
+	pstate->heap_positions = mlr_malloc_or_die(window_length * sizeof(int));
+	pstate->heap_sides     = mlr_malloc_or_die(window_length * sizeof(char));
+	return pstep;
+}
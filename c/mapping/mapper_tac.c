@@ -1,10 +1,16 @@
 #include <stdio.h>
 #include "lib/mlrutil.h"
 #include "containers/sllv.h"
+#include "input/lrec_readers.h"
 #include "mapping/mappers.h"
 
 typedef struct _mapper_tac_state_t {
 	sllv_t* records;
+	// With a retainer, where the records are in the input rather than the records themselves.
+	lrec_retainer_t* pretainer;
+	lrec_extents_t*  pextents;
+	// With reverse input, the records already arrive last-first.
+	int is_input_reversed;
 } mapper_tac_state_t;
 
 static void      mapper_tac_usage(FILE* o, char* argv0, char* verb);
@@ -12,7 +18,9 @@ static mapper_t* mapper_tac_parse_cli(int* pargi, int argc, char** argv,
 	cli_reader_opts_t* _, cli_writer_opts_t* __);
 static mapper_t* mapper_tac_alloc();
 static void      mapper_tac_free(mapper_t* pmapper, context_t* _);
-static sllv_t*   mapper_tac_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static void      mapper_tac_set_retainer(void* pvstate, lrec_retainer_t* pretainer);
+static long long mapper_tac_set_reverse_input(void* pvstate);
+static void      mapper_tac_push(lrec_t* pinrec, context_t* pctx, void* pvstate, mapper_emitter_t* pemitter);
 
 // ----------------------------------------------------------------
 mapper_setup_t mapper_tac_setup = {
@@ -42,14 +50,19 @@ static mapper_t* mapper_tac_parse_cli(int* pargi, int argc, char** argv,
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_tac_alloc() {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_tac_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_tac_state_t));
-	pstate->records = sllv_alloc();
+	pstate->records   = sllv_alloc();
+	pstate->pretainer = NULL;
+	pstate->pextents  = NULL;
+	pstate->is_input_reversed = FALSE;
 
 	pmapper->pvstate       = pstate;
-	pmapper->pprocess_func = mapper_tac_process;
+	pmapper->ppush_func    = mapper_tac_push;
 	pmapper->pfree_func    = mapper_tac_free;
+	pmapper->pset_retainer_func = mapper_tac_set_retainer;
+	pmapper->pset_reverse_input_func = mapper_tac_set_reverse_input;
 
 	return pmapper;
 }
@@ -58,23 +71,48 @@ static void mapper_tac_free(mapper_t* pmapper, context_t* _) {
 	mapper_tac_state_t* pstate = pmapper->pvstate;
 	// Free the container
 	sllv_free(pstate->records);
+	lrec_extents_free(pstate->pextents);
 	free(pstate);
 	free(pmapper);
 }
 
+static void mapper_tac_set_retainer(void* pvstate, lrec_retainer_t* pretainer) {
+	mapper_tac_state_t* pstate = pvstate;
+	pstate->pretainer = pretainer;
+	pstate->pextents  = lrec_extents_alloc();
+}
+
+static long long mapper_tac_set_reverse_input(void* pvstate) {
+	mapper_tac_state_t* pstate = pvstate;
+	pstate->is_input_reversed = TRUE;
+	return -1LL;
+}
+
 // ----------------------------------------------------------------
-static sllv_t* mapper_tac_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+static void mapper_tac_push(lrec_t* pinrec, context_t* pctx, void* pvstate, mapper_emitter_t* pemitter) {
 	mapper_tac_state_t* pstate = pvstate;
+	if (pstate->is_input_reversed) {
+		mapper_emit(pemitter, pinrec, pctx);
+		return;
+	}
 	if (pinrec != NULL) {
-		// The caller will free the outrecs
-		sllv_append(pstate->records, pinrec);
-		return NULL;
+		if (pstate->pretainer != NULL) {
+			lrec_extents_append(pstate->pextents, pstate->pretainer->current);
+			lrec_free(pinrec);
+		} else {
+			// Add at head, so the list is in reverse order
+			sllv_push(pstate->records, pinrec);
+		}
+		return;
 	}
-	else {
-		sllv_reverse(pstate->records);
-		sllv_append(pstate->records, NULL);
-		sllv_t* retval = pstate->records;
-		pstate->records = sllv_alloc();
-		return retval;
+
+	if (pstate->pretainer != NULL) {
+		for (unsigned long long i = pstate->pextents->length; i > 0; i--)
+			mapper_emit(pemitter, lrec_retainer_reparse(pstate->pretainer, &pstate->pextents->pextents[i-1]), pctx);
+		pstate->pextents->length = 0;
+	} else {
+		while (pstate->records->length > 0)
+			mapper_emit(pemitter, sllv_pop(pstate->records), pctx);
 	}
+	mapper_emit(pemitter, NULL, pctx);
 }
@@ -16,6 +16,8 @@ typedef struct _mapper_tail_state_t {
 	slls_t* pgroup_by_field_names;
 	unsigned long long tail_count;
 	lhmslv_t* precord_lists_by_group;
+	// With reverse input, the last records arrive first and are kept in order by adding at head.
+	sllv_t* preversed_records;
 } mapper_tail_state_t;
 
 static void      mapper_tail_usage(FILE* o, char* argv0, char* verb);
@@ -23,7 +25,9 @@ static mapper_t* mapper_tail_parse_cli(int* pargi, int argc, char** argv,
 	cli_reader_opts_t* _, cli_writer_opts_t* __);
 static mapper_t* mapper_tail_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_names, unsigned long long tail_count);
 static void      mapper_tail_free(mapper_t* pmapper, context_t* _);
+static long long mapper_tail_set_reverse_input(void* pvstate);
 static sllv_t*   mapper_tail_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static sllv_t*   mapper_tail_process_reversed(lrec_t* pinrec, context_t* pctx, void* pvstate);
 
 // ----------------------------------------------------------------
 mapper_setup_t mapper_tail_setup = {
@@ -63,7 +67,7 @@ static mapper_t* mapper_tail_parse_cli(int* pargi, int argc, char** argv,
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_tail_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_names, unsigned long long tail_count) {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_tail_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_tail_state_t));
 
@@ -71,10 +75,13 @@ static mapper_t* mapper_tail_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_na
 	pstate->pgroup_by_field_names  = pgroup_by_field_names;
 	pstate->tail_count             = tail_count;
 	pstate->precord_lists_by_group = lhmslv_alloc();
+	pstate->preversed_records      = NULL;
 
 	pmapper->pvstate       = pstate;
 	pmapper->pprocess_func = mapper_tail_process;
 	pmapper->pfree_func    = mapper_tail_free;
+	// With grouping, which records are the last n for their group isn't known until all are read.
+	pmapper->pset_reverse_input_func = (pgroup_by_field_names->length == 0) ? mapper_tail_set_reverse_input : NULL;
 
 	return pmapper;
 }
@@ -91,14 +98,41 @@ static void mapper_tail_free(mapper_t* pmapper, context_t* _) {
 		sllv_free(precord_list_for_group);
 	}
 	lhmslv_free(pstate->precord_lists_by_group);
+	if (pstate->preversed_records != NULL)
+		sllv_free(pstate->preversed_records);
 	ap_free(pstate->pargp);
 	free(pstate);
 	free(pmapper);
 }
 
+static long long mapper_tail_set_reverse_input(void* pvstate) {
+	mapper_tail_state_t* pstate = pvstate;
+	pstate->preversed_records = sllv_alloc();
+	return pstate->tail_count;
+}
+
+// ----------------------------------------------------------------
+static sllv_t* mapper_tail_process_reversed(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+	mapper_tail_state_t* pstate = pvstate;
+	if (pinrec != NULL) {
+		if (pstate->preversed_records->length < pstate->tail_count)
+			sllv_push(pstate->preversed_records, pinrec);
+		else
+			lrec_free(pinrec);
+		return NULL;
+	} else {
+		sllv_t* poutrecs = sllv_alloc();
+		sllv_transfer(poutrecs, pstate->preversed_records);
+		sllv_append(poutrecs, NULL);
+		return poutrecs;
+	}
+}
+
 // ----------------------------------------------------------------
 static sllv_t* mapper_tail_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	mapper_tail_state_t* pstate = pvstate;
+	if (pstate->preversed_records != NULL)
+		return mapper_tail_process_reversed(pinrec, pctx, pvstate);
 	if (pinrec != NULL) {
 		slls_t* pgroup_by_field_values = mlr_reference_selected_values_from_record(pinrec,
 			pstate->pgroup_by_field_names);
@@ -110,11 +144,11 @@ static sllv_t* mapper_tail_process(lrec_t* pinrec, context_t* pctx, void* pvstat
 					precord_list_for_group, FREE_ENTRY_KEY);
 			}
 			slls_free(pgroup_by_field_values);
-			if (precord_list_for_group->length >= pstate->tail_count) {
+			sllv_append(precord_list_for_group, pinrec);
+			if (precord_list_for_group->length > pstate->tail_count) {
 				lrec_t* porec = sllv_pop(precord_list_for_group);
 				lrec_free(porec);
 			}
-			sllv_append(precord_list_for_group, pinrec);
 		} else {
 			lrec_free(pinrec);
 		}
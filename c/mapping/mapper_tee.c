@@ -112,7 +112,7 @@ static mapper_t* mapper_tee_alloc(int do_append, int flush_every_record,
 		exit(1);
 	}
 
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 	mapper_tee_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_tee_state_t));
 	pstate->output_file_name   = output_file_name;
 	pstate->output_stream      = fp;
@@ -23,6 +23,8 @@ typedef struct _mapper_top_state_t {
 	ap_state_t* pargp;
 	slls_t* pvalue_field_names;
 	slls_t* pgroup_by_field_names;
+	string_array_t* pvalue_field_values;    // scratch space used per-record
+	string_array_t* pgroup_by_field_values; // scratch space used per-record
 	int top_count;
 	int show_full_records;
 	int allow_int_float;
@@ -110,13 +112,15 @@ static mapper_t* mapper_top_parse_cli(int* pargi, int argc, char** argv,
 static mapper_t* mapper_top_alloc(ap_state_t* pargp, slls_t* pvalue_field_names, slls_t* pgroup_by_field_names,
 	int top_count, int do_max, int show_full_records, int allow_int_float, char* output_field_name)
 {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_top_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_top_state_t));
 
 	pstate->pargp                 = pargp;
 	pstate->pvalue_field_names    = pvalue_field_names;
 	pstate->pgroup_by_field_names = pgroup_by_field_names;
+	pstate->pvalue_field_values    = string_array_alloc(pvalue_field_names->length);
+	pstate->pgroup_by_field_values = string_array_alloc(pgroup_by_field_names->length);
 	pstate->show_full_records     = show_full_records;
 	pstate->allow_int_float       = allow_int_float;
 	pstate->top_count             = top_count;
@@ -135,6 +139,8 @@ static void mapper_top_free(mapper_t* pmapper, context_t* _) {
 	mapper_top_state_t* pstate = pmapper->pvstate;
 	slls_free(pstate->pvalue_field_names);
 	slls_free(pstate->pgroup_by_field_names);
+	string_array_free(pstate->pvalue_field_values);
+	string_array_free(pstate->pgroup_by_field_values);
 
 	// Free the hashmap pvvalues; the lhm free methods will free the hashmap keys.
 	for (lhmslve_t* pa = pstate->groups->phead; pa != NULL; pa = pa->pnext) {
@@ -167,36 +173,29 @@ static sllv_t* mapper_top_process(lrec_t* pinrec, context_t* pctx, void* pvstate
 // ----------------------------------------------------------------
 static void mapper_top_ingest(lrec_t* pinrec, mapper_top_state_t* pstate) {
 	// ["s", "t"]
-	slls_t* pvalue_field_values    = mlr_reference_selected_values_from_record(pinrec, pstate->pvalue_field_names);
-	slls_t* pgroup_by_field_values = mlr_reference_selected_values_from_record(pinrec, pstate->pgroup_by_field_names);
+	string_array_t* pvalue_field_values = pstate->pvalue_field_values;
 
 	// Heterogeneous-data case -- not all sought fields were present in record
-	if (pvalue_field_values == NULL || pgroup_by_field_values == NULL) {
-		slls_free(pvalue_field_values);
-		slls_free(pgroup_by_field_values);
-		lrec_free(pinrec);
-		return;
-	}
-	if (pgroup_by_field_values->length != pstate->pgroup_by_field_names->length) {
-		slls_free(pvalue_field_values);
-		slls_free(pgroup_by_field_values);
+	if (!mlr_reference_selected_values_from_record_into_array(pinrec, pstate->pvalue_field_names,
+			pvalue_field_values)
+		|| !mlr_reference_selected_values_from_record_into_array(pinrec, pstate->pgroup_by_field_names,
+			pstate->pgroup_by_field_values))
+	{
 		lrec_free(pinrec);
 		return;
 	}
 
-	lhmsv_t* group_to_acc_field = lhmslv_get(pstate->groups, pgroup_by_field_values);
+	lhmsv_t* group_to_acc_field = lhmslv_get_from_string_array(pstate->groups, pstate->pgroup_by_field_values);
 	if (group_to_acc_field == NULL) {
 		group_to_acc_field = lhmsv_alloc();
-		lhmslv_put(pstate->groups, slls_copy(pgroup_by_field_values), group_to_acc_field, FREE_ENTRY_KEY);
+		lhmslv_put_copy_of_string_array(pstate->groups, pstate->pgroup_by_field_values, group_to_acc_field);
 	}
-	slls_free(pgroup_by_field_values);
 
 	sllse_t* pa = pstate->pvalue_field_names->phead;
-	sllse_t* pb =         pvalue_field_values->phead;
 	// for "x", "y" and "1", "2"
-	for ( ; pa != NULL && pb != NULL; pa = pa->pnext, pb = pb->pnext) {
+	for (int i = 0; pa != NULL; pa = pa->pnext, i++) {
 		char*  value_field_name = pa->value;
-		char*  value_field_sval = pb->value;
+		char*  value_field_sval = pvalue_field_values->strings[i];
 		if (value_field_sval == NULL) { // Key not present
 			if (pstate->show_full_records)
 				lrec_free(pinrec);
@@ -226,7 +225,6 @@ static void mapper_top_ingest(lrec_t* pinrec, mapper_top_state_t* pstate) {
 	}
 	if (!pstate->show_full_records)
 		lrec_free(pinrec);
-	slls_free(pvalue_field_values);
 }
 
 // ----------------------------------------------------------------
@@ -240,6 +238,10 @@ static sllv_t* mapper_top_emit(mapper_top_state_t* pstate, context_t* pctx) {
 		// each record at most once, which would need a change in the format
 		// presented as output; (2) there would be double-frees in our
 		// ingester.
+		lhmsv_t* group_to_acc_field_for_sort = pa->pvvalue;
+		for (lhmsve_t* pd = group_to_acc_field_for_sort->phead; pd != NULL; pd = pd->pnext)
+			top_keeper_sort(pd->pvvalue);
+
 		if (pstate->show_full_records) {
 			lhmsv_t* group_to_acc_field = pa->pvvalue;
 			for (lhmsve_t* pd = group_to_acc_field->phead; pd != NULL; pd = pd->pnext) {
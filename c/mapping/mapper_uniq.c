@@ -9,6 +9,7 @@
 #include "containers/lhmsv.h"
 #include "containers/lhmsll.h"
 #include "containers/mixutil.h"
+#include "containers/hll.h"
 #include "mapping/mappers.h"
 #include "cli/argparse.h"
 
@@ -17,6 +18,7 @@
 typedef struct _mapper_uniq_state_t {
 	ap_state_t* pargp;
 	slls_t*   pgroup_by_field_names;
+	string_array_t* pgroup_by_field_values; // scratch space used per-record
 	int       show_counts;
 	int       show_num_distinct_only;
 	lhmsll_t* puniqified_record_counts; // lrec_sprintf -> counts
@@ -24,6 +26,9 @@ typedef struct _mapper_uniq_state_t {
 	lhmslv_t* pcounts_by_group;
 	lhmsv_t*  pcounts_unlashed; // string field name -> string field value -> long long count
 	char* output_field_name;
+	int       approx_precision;
+	hll_t*    phll;             // for --approx
+	lhmsv_t*  phlls_unlashed;   // for --approx with -u: string field name -> hll_t*
 } mapper_uniq_state_t;
 
 // ----------------------------------------------------------------
@@ -58,7 +63,9 @@ static mapper_t* mapper_uniq_alloc(
 	int show_counts,
 	int show_num_distinct_only,
 	char* output_field_name,
-	int uniqify_entire_records);
+	int uniqify_entire_records,
+	int do_approx,
+	int approx_precision);
 
 static void mapper_uniq_free(
 	mapper_t* pmapper,
@@ -99,6 +106,21 @@ static sllv_t* mapper_uniq_process_no_counts(
 	context_t* pctx,
 	void* pvstate);
 
+static sllv_t* mapper_uniq_process_uniqify_entire_records_show_num_distinct_only_approx(
+	lrec_t* pinrec,
+	context_t* pctx,
+	void* pvstate);
+
+static sllv_t* mapper_uniq_process_unlashed_approx(
+	lrec_t* pinrec,
+	context_t* pctx,
+	void* pvstate);
+
+static sllv_t* mapper_uniq_process_num_distinct_only_approx(
+	lrec_t* pinrec,
+	context_t* pctx,
+	void* pvstate);
+
 // ----------------------------------------------------------------
 mapper_setup_t mapper_count_distinct_setup = {
 	.verb = "count-distinct",
@@ -134,6 +156,14 @@ static void mapper_count_distinct_usage(
 	fprintf(o, "              and b field values. With -f a,b and with -u, computes counts\n");
 	fprintf(o, "              for distinct a field values and counts for distinct b field\n");
 	fprintf(o, "              values separately.\n");
+	fprintf(o, "--approx      Estimate the number of distinct values using a HyperLogLog\n");
+	fprintf(o, "              sketch, in bounded memory rather than memory proportional to\n");
+	fprintf(o, "              the number of distinct values. Implies -n. With -u, gives an\n");
+	fprintf(o, "              estimate for each field. Counts are exact until they reach\n");
+	fprintf(o, "              several hundred; beyond that, accuracy is to within a few percent.\n");
+	fprintf(o, "--precision {p} For --approx: from %d to %d; higher is more accurate, and takes\n",
+		HLL_MIN_PRECISION, HLL_MAX_PRECISION);
+	fprintf(o, "              2^p bytes. Default %d.\n", HLL_DEFAULT_PRECISION);
 }
 
 // ----------------------------------------------------------------
@@ -148,6 +178,8 @@ static mapper_t* mapper_count_distinct_parse_cli(
 	int     show_num_distinct_only = FALSE;
 	char*   output_field_name = DEFAULT_OUTPUT_FIELD_NAME;
 	int     do_lashed = TRUE;
+	int     do_approx = FALSE;
+	int     approx_precision = HLL_DEFAULT_PRECISION;
 
 	char* verb = argv[(*pargi)++];
 
@@ -156,6 +188,8 @@ static mapper_t* mapper_count_distinct_parse_cli(
 	ap_define_true_flag(pstate,        "-n", &show_num_distinct_only);
 	ap_define_string_flag(pstate,      "-o", &output_field_name);
 	ap_define_false_flag(pstate,       "-u", &do_lashed);
+	ap_define_true_flag(pstate,        "--approx", &do_approx);
+	ap_define_int_flag(pstate,         "--precision", &approx_precision);
 
 	if (!ap_parse(pstate, verb, pargi, argc, argv)) {
 		mapper_count_distinct_usage(stderr, argv[0], verb);
@@ -166,13 +200,13 @@ static mapper_t* mapper_count_distinct_parse_cli(
 		mapper_count_distinct_usage(stderr, argv[0], verb);
 		return NULL;
 	}
-	if (!do_lashed && show_num_distinct_only) {
+	if (!do_lashed && show_num_distinct_only && !do_approx) {
 		mapper_count_distinct_usage(stderr, argv[0], verb);
 		return NULL;
 	}
 
 	return mapper_uniq_alloc(pstate, pfield_names, do_lashed, TRUE, show_num_distinct_only,
-		output_field_name, FALSE);
+		output_field_name, FALSE, do_approx, approx_precision);
 }
 
 // ----------------------------------------------------------------
@@ -194,6 +228,10 @@ static void mapper_uniq_usage(
 	fprintf(o, "              With -c, produces unique records, with repeat counts for each.\n");
 	fprintf(o, "              With -n, produces only one record which is the unique-record count.\n");
 	fprintf(o, "              With neither -c nor -n, produces unique records.\n");
+	fprintf(o, "--approx      With -n: estimate the number of distinct values using a\n");
+	fprintf(o, "              HyperLogLog sketch, in bounded memory. See %s count-distinct --help.\n", argv0);
+	fprintf(o, "--precision {p} For --approx: from %d to %d. Default %d.\n",
+		HLL_MIN_PRECISION, HLL_MAX_PRECISION, HLL_DEFAULT_PRECISION);
 }
 
 static mapper_t* mapper_uniq_parse_cli(
@@ -209,6 +247,8 @@ static mapper_t* mapper_uniq_parse_cli(
 	char*   output_field_name = DEFAULT_OUTPUT_FIELD_NAME;
 	int     do_lashed = TRUE;
 	int     uniqify_entire_records = FALSE;
+	int     do_approx = FALSE;
+	int     approx_precision = HLL_DEFAULT_PRECISION;
 
 	char* verb = argv[(*pargi)++];
 
@@ -219,6 +259,8 @@ static mapper_t* mapper_uniq_parse_cli(
 	ap_define_true_flag(pstate,        "-n", &show_num_distinct_only);
 	ap_define_string_flag(pstate,      "-o", &output_field_name);
 	ap_define_true_flag(pstate,        "-a", &uniqify_entire_records);
+	ap_define_true_flag(pstate,        "--approx", &do_approx);
+	ap_define_int_flag(pstate,         "--precision", &approx_precision);
 
 	if (!ap_parse(pstate, verb, pargi, argc, argv)) {
 		mapper_uniq_usage(stderr, argv[0], verb);
@@ -240,9 +282,13 @@ static mapper_t* mapper_uniq_parse_cli(
 			return NULL;
 		}
 	}
+	if (do_approx && (!show_num_distinct_only || show_counts)) {
+		mapper_uniq_usage(stderr, argv[0], verb);
+		return NULL;
+	}
 
 	return mapper_uniq_alloc(pstate, pgroup_by_field_names, do_lashed, show_counts, show_num_distinct_only,
-		output_field_name, uniqify_entire_records);
+		output_field_name, uniqify_entire_records, do_approx, approx_precision);
 }
 
 // ----------------------------------------------------------------
@@ -253,14 +299,18 @@ static mapper_t* mapper_uniq_alloc(
 	int show_counts,
 	int show_num_distinct_only,
 	char* output_field_name,
-	int uniqify_entire_records)
+	int uniqify_entire_records,
+	int do_approx,
+	int approx_precision)
 {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_uniq_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_uniq_state_t));
 
 	pstate->pargp                    = pargp;
 	pstate->pgroup_by_field_names    = pgroup_by_field_names;
+	pstate->pgroup_by_field_values   = (pgroup_by_field_names == NULL)
+		? NULL : string_array_alloc(pgroup_by_field_names->length);
 	pstate->show_counts              = show_counts;
 	pstate->show_num_distinct_only   = show_num_distinct_only;
 	pstate->puniqified_record_counts = lhmsll_alloc();
@@ -268,9 +318,19 @@ static mapper_t* mapper_uniq_alloc(
 	pstate->pcounts_by_group         = lhmslv_alloc();
 	pstate->pcounts_unlashed         = lhmsv_alloc();
 	pstate->output_field_name        = output_field_name;
+	pstate->approx_precision         = approx_precision;
+	pstate->phll                     = do_approx ? hll_alloc(approx_precision) : NULL;
+	pstate->phlls_unlashed           = lhmsv_alloc();
 
 	pmapper->pvstate = pstate;
-	if (uniqify_entire_records) {
+	if (do_approx) {
+		if (uniqify_entire_records)
+			pmapper->pprocess_func = mapper_uniq_process_uniqify_entire_records_show_num_distinct_only_approx;
+		else if (!do_lashed)
+			pmapper->pprocess_func = mapper_uniq_process_unlashed_approx;
+		else
+			pmapper->pprocess_func = mapper_uniq_process_num_distinct_only_approx;
+	} else if (uniqify_entire_records) {
 		if (show_counts)
 			pmapper->pprocess_func = mapper_uniq_process_uniqify_entire_records_show_counts;
 		else if (show_num_distinct_only)
@@ -297,6 +357,7 @@ static void mapper_uniq_free(
 	mapper_uniq_state_t* pstate = pmapper->pvstate;
 
 	slls_free(pstate->pgroup_by_field_names);
+	string_array_free(pstate->pgroup_by_field_values);
 
 	lhmsll_free(pstate->puniqified_record_counts);
 	pstate->puniqified_record_counts = NULL;
@@ -324,6 +385,11 @@ static void mapper_uniq_free(
 	lhmsv_free(pstate->pcounts_unlashed);
 	pstate->pcounts_unlashed = NULL;
 
+	hll_free(pstate->phll);
+	for (lhmsve_t* pb = pstate->phlls_unlashed->phead; pb != NULL; pb = pb->pnext)
+		hll_free(pb->pvvalue);
+	lhmsv_free(pstate->phlls_unlashed);
+
 	pstate->pgroup_by_field_names = NULL;
 	pstate->pcounts_by_group = NULL;
 
@@ -471,18 +537,18 @@ static sllv_t* mapper_uniq_process_num_distinct_only(
 {
 	mapper_uniq_state_t* pstate = pvstate;
 	if (pinrec != NULL) {
-		slls_t* pgroup_by_field_values = mlr_reference_selected_values_from_record(pinrec,
-			pstate->pgroup_by_field_names);
-		if (pgroup_by_field_values != NULL) {
-			unsigned long long* pcount = lhmslv_get(pstate->pcounts_by_group, pgroup_by_field_values);
+		if (mlr_reference_selected_values_from_record_into_array(pinrec,
+			pstate->pgroup_by_field_names, pstate->pgroup_by_field_values))
+		{
+			unsigned long long* pcount = lhmslv_get_from_string_array(pstate->pcounts_by_group,
+				pstate->pgroup_by_field_values);
 			if (pcount == NULL) {
 				pcount = mlr_malloc_or_die(sizeof(unsigned long long));
 				*pcount = 1LL;
-				lhmslv_put(pstate->pcounts_by_group, slls_copy(pgroup_by_field_values), pcount, FREE_ENTRY_KEY);
+				lhmslv_put_copy_of_string_array(pstate->pcounts_by_group, pstate->pgroup_by_field_values, pcount);
 			} else {
 				(*pcount)++;
 			}
-			slls_free(pgroup_by_field_values);
 		}
 		lrec_free(pinrec);
 		return NULL;
@@ -507,18 +573,18 @@ static sllv_t* mapper_uniq_process_with_counts(
 {
 	mapper_uniq_state_t* pstate = pvstate;
 	if (pinrec != NULL) {
-		slls_t* pgroup_by_field_values = mlr_reference_selected_values_from_record(pinrec,
-			pstate->pgroup_by_field_names);
-		if (pgroup_by_field_values != NULL) {
-			unsigned long long* pcount = lhmslv_get(pstate->pcounts_by_group, pgroup_by_field_values);
+		if (mlr_reference_selected_values_from_record_into_array(pinrec,
+			pstate->pgroup_by_field_names, pstate->pgroup_by_field_values))
+		{
+			unsigned long long* pcount = lhmslv_get_from_string_array(pstate->pcounts_by_group,
+				pstate->pgroup_by_field_values);
 			if (pcount == NULL) {
 				pcount = mlr_malloc_or_die(sizeof(unsigned long long));
 				*pcount = 1LL;
-				lhmslv_put(pstate->pcounts_by_group, slls_copy(pgroup_by_field_values), pcount, FREE_ENTRY_KEY);
+				lhmslv_put_copy_of_string_array(pstate->pcounts_by_group, pstate->pgroup_by_field_values, pcount);
 			} else {
 				(*pcount)++;
 			}
-			slls_free(pgroup_by_field_values);
 		}
 		lrec_free(pinrec);
 		return NULL;
@@ -558,19 +624,20 @@ static sllv_t* mapper_uniq_process_no_counts(
 		return sllv_single(NULL);
 	}
 
-	slls_t* pgroup_by_field_values = mlr_reference_selected_values_from_record(pinrec,
-		pstate->pgroup_by_field_names);
-	if (pgroup_by_field_values == NULL) {
+	if (!mlr_reference_selected_values_from_record_into_array(pinrec,
+		pstate->pgroup_by_field_names, pstate->pgroup_by_field_values))
+	{
 		lrec_free(pinrec);
 		return NULL;
 	}
 
-	unsigned long long* pcount = lhmslv_get(pstate->pcounts_by_group, pgroup_by_field_values);
+	unsigned long long* pcount = lhmslv_get_from_string_array(pstate->pcounts_by_group,
+		pstate->pgroup_by_field_values);
 	if (pcount == NULL) {
 		pcount = mlr_malloc_or_die(sizeof(unsigned long long));
 		*pcount = 1LL;
-		slls_t* pcopy = slls_copy(pgroup_by_field_values);
-		lhmslv_put(pstate->pcounts_by_group, pcopy, pcount, FREE_ENTRY_KEY);
+		slls_t* pcopy = lhmslv_put_copy_of_string_array(pstate->pcounts_by_group,
+			pstate->pgroup_by_field_values, pcount);
 
 		lrec_t* poutrec = lrec_unbacked_alloc();
 
@@ -581,12 +648,99 @@ static sllv_t* mapper_uniq_process_no_counts(
 		}
 
 		lrec_free(pinrec);
-		slls_free(pgroup_by_field_values);
 		return sllv_single(poutrec);
 	} else {
 		(*pcount)++;
 		lrec_free(pinrec);
-		slls_free(pgroup_by_field_values);
 		return NULL;
 	}
 }
+
+// ----------------------------------------------------------------
+// The --approx variants hash the values they would otherwise keep, and keep
+// only HyperLogLog sketches of the hashes. Multiple values are hashed as a
+// chain, each value's hash seeding the next, so ("ab","c") and ("a","bc") differ.
+
+static sllv_t* mapper_uniq_process_uniqify_entire_records_show_num_distinct_only_approx(
+	lrec_t* pinrec,
+	context_t* pctx,
+	void* pvstate)
+{
+	mapper_uniq_state_t* pstate = pvstate;
+	if (pinrec != NULL) {
+		unsigned long long hash = 0LL;
+		for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext) {
+			hash = mlr_seeded_string_hash_func(pe->key, hash);
+			hash = mlr_seeded_string_hash_func(pe->value, hash);
+		}
+		hll_ingest_hash(pstate->phll, hash);
+		lrec_free(pinrec);
+		return NULL;
+	} else {
+		lrec_t* poutrec = lrec_unbacked_alloc();
+		lrec_put(poutrec, pstate->output_field_name, mlr_alloc_string_from_ull(hll_count(pstate->phll)),
+			FREE_ENTRY_VALUE);
+		sllv_t* poutrecs = sllv_single(poutrec);
+		sllv_append(poutrecs, NULL);
+		return poutrecs;
+	}
+}
+
+static sllv_t* mapper_uniq_process_unlashed_approx(
+	lrec_t* pinrec,
+	context_t* pctx,
+	void* pvstate)
+{
+	mapper_uniq_state_t* pstate = pvstate;
+	if (pinrec != NULL) {
+		for (sllse_t* pe = pstate->pgroup_by_field_names->phead; pe != NULL; pe = pe->pnext) {
+			char* field_name = pe->value;
+			hll_t* phll_for_field_name = lhmsv_get(pstate->phlls_unlashed, field_name);
+			if (phll_for_field_name == NULL) {
+				phll_for_field_name = hll_alloc(pstate->approx_precision);
+				lhmsv_put(pstate->phlls_unlashed, field_name, phll_for_field_name, NO_FREE);
+			}
+			char* field_value = lrec_get(pinrec, field_name);
+			if (field_value != NULL)
+				hll_ingest_string(phll_for_field_name, field_value);
+		}
+		lrec_free(pinrec);
+		return NULL;
+	} else {
+		sllv_t* poutrecs = sllv_alloc();
+		for (lhmsve_t* pe = pstate->phlls_unlashed->phead; pe != NULL; pe = pe->pnext) {
+			lrec_t* poutrec = lrec_unbacked_alloc();
+			lrec_put(poutrec, "field", pe->key, NO_FREE);
+			lrec_put(poutrec, "count", mlr_alloc_string_from_ull(hll_count(pe->pvvalue)), FREE_ENTRY_VALUE);
+			sllv_append(poutrecs, poutrec);
+		}
+		sllv_append(poutrecs, NULL);
+		return poutrecs;
+	}
+}
+
+static sllv_t* mapper_uniq_process_num_distinct_only_approx(
+	lrec_t* pinrec,
+	context_t* pctx,
+	void* pvstate)
+{
+	mapper_uniq_state_t* pstate = pvstate;
+	if (pinrec != NULL) {
+		if (mlr_reference_selected_values_from_record_into_array(pinrec,
+			pstate->pgroup_by_field_names, pstate->pgroup_by_field_values))
+		{
+			unsigned long long hash = 0LL;
+			for (int i = 0; i < pstate->pgroup_by_field_values->length; i++)
+				hash = mlr_seeded_string_hash_func(pstate->pgroup_by_field_values->strings[i], hash);
+			hll_ingest_hash(pstate->phll, hash);
+		}
+		lrec_free(pinrec);
+		return NULL;
+	} else {
+		lrec_t* poutrec = lrec_unbacked_alloc();
+		lrec_put(poutrec, "count", mlr_alloc_string_from_ull(hll_count(pstate->phll)), FREE_ENTRY_VALUE);
+		sllv_t* poutrecs = sllv_single(poutrec);
+		sllv_append(poutrecs, NULL);
+		return poutrecs;
+	}
+}
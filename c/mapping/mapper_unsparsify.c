@@ -10,6 +10,7 @@ typedef struct _mapper_unsparsify_state_t {
 	sllv_t* records;
 	char*   filler;
 	ap_state_t* pargp;
+	int     is_two_pass;
 } mapper_unsparsify_state_t;
 
 static void      mapper_unsparsify_usage(FILE* o, char* argv0, char* verb);
@@ -18,6 +19,9 @@ static mapper_t* mapper_unsparsify_parse_cli(int* pargi, int argc, char** argv,
 static mapper_t* mapper_unsparsify_alloc(ap_state_t* pargp, char* filler);
 static void      mapper_unsparsify_free(mapper_t* pmapper, context_t* _);
 static sllv_t*   mapper_unsparsify_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static void      mapper_unsparsify_first_pass(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static void      mapper_unsparsify_add_key_names(lrec_t* pinrec, mapper_unsparsify_state_t* pstate);
+static lrec_t*   mapper_unsparsify_fill(lrec_t* pinrec, mapper_unsparsify_state_t* pstate);
 
 // ----------------------------------------------------------------
 mapper_setup_t mapper_unsparsify_setup = {
@@ -32,7 +36,8 @@ static void mapper_unsparsify_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "Usage: %s %s [options]\n", argv0, verb);
 	fprintf(o, "Prints records with the union of field names over all input records.\n");
 	fprintf(o, "For field names absent in a given record but present in others, fills in\n");
-	fprintf(o, "a value. This verb retains all input before producing any output.\n");
+	fprintf(o, "a value. This verb retains all input before producing any output, unless it's\n");
+	fprintf(o, "the first verb and the input is regular files: then the files are read twice.\n");
 	fprintf(o, "\n");
 	fprintf(o, "Options:\n");
 	fprintf(o, "--fill-with {filler string}  What to fill absent fields with. Defaults to\n");
@@ -68,17 +73,19 @@ static mapper_t* mapper_unsparsify_parse_cli(int* pargi, int argc, char** argv,
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_unsparsify_alloc(ap_state_t* pargp, char* filler) {
-	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_t* pmapper = mapper_alloc();
 
 	mapper_unsparsify_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_unsparsify_state_t));
 	pstate->records = sllv_alloc();
 	pstate->key_names = lhmsi_alloc();
 	pstate->filler = filler;
 	pstate->pargp = pargp;
+	pstate->is_two_pass = FALSE;
 
 	pmapper->pvstate       = pstate;
 	pmapper->pprocess_func = mapper_unsparsify_process;
 	pmapper->pfree_func    = mapper_unsparsify_free;
+	pmapper->pfirst_pass_func        = mapper_unsparsify_first_pass;
 
 	return pmapper;
 }
@@ -96,13 +103,18 @@ static void mapper_unsparsify_free(mapper_t* pmapper, context_t* _) {
 // ----------------------------------------------------------------
 static sllv_t* mapper_unsparsify_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	mapper_unsparsify_state_t* pstate = pvstate;
+	if (pstate->is_two_pass) {
+		// Second of two passes over the input: the key names are already known.
+		if (pinrec == NULL)
+			return sllv_single(NULL);
+		lrec_t* poutrec = mapper_unsparsify_fill(pinrec, pstate);
+		lrec_free(pinrec);
+		return sllv_single(poutrec);
+	}
+
 	if (pinrec != NULL) {
 		// Not end of stream.
-		for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext) {
-			if (!lhmsi_has_key(pstate->key_names, pe->key)) {
-				lhmsi_put(pstate->key_names, mlr_strdup_or_die(pe->key), 1, FREE_ENTRY_KEY);
-			}
-		}
+		mapper_unsparsify_add_key_names(pinrec, pstate);
 		// The caller will free the outrecs
 		sllv_append(pstate->records, pinrec);
 		return NULL;
@@ -112,18 +124,7 @@ static sllv_t* mapper_unsparsify_process(lrec_t* pinrec, context_t* pctx, void*
 		sllv_t* poutrecs = sllv_alloc();
 		for (sllve_t* pe = pstate->records->phead; pe != NULL; pe = pe->pnext) {
 			lrec_t* pinrec = pe->pvvalue;
-			lrec_t* poutrec = lrec_unbacked_alloc();
-			for (lhmsie_t* pf = pstate->key_names->phead; pf != NULL; pf = pf->pnext) {
-				char* key = pf->key;
-				char* value = lrec_get(pinrec, key);
-				if (value == NULL) {
-					lrec_put(poutrec, mlr_strdup_or_die(key), pstate->filler, FREE_ENTRY_KEY);
-				} else {
-					lrec_put(poutrec, mlr_strdup_or_die(key), mlr_strdup_or_die(value),
-						FREE_ENTRY_KEY|FREE_ENTRY_VALUE);
-				}
-			}
-			sllv_append(poutrecs, poutrec);
+			sllv_append(poutrecs, mapper_unsparsify_fill(pinrec, pstate));
 			// Free the void-star payload
 			lrec_free(pinrec);
 		}
@@ -132,3 +133,35 @@ static sllv_t* mapper_unsparsify_process(lrec_t* pinrec, context_t* pctx, void*
 		return poutrecs;
 	}
 }
+
+static void mapper_unsparsify_first_pass(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+	mapper_unsparsify_state_t* pstate = pvstate;
+	pstate->is_two_pass = TRUE;
+	if (pinrec != NULL) {
+		mapper_unsparsify_add_key_names(pinrec, pstate);
+		lrec_free(pinrec);
+	}
+}
+
+static void mapper_unsparsify_add_key_names(lrec_t* pinrec, mapper_unsparsify_state_t* pstate) {
+	for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext) {
+		if (!lhmsi_has_key(pstate->key_names, pe->key)) {
+			lhmsi_put(pstate->key_names, mlr_strdup_or_die(pe->key), 1, FREE_ENTRY_KEY);
+		}
+	}
+}
+
+static lrec_t* mapper_unsparsify_fill(lrec_t* pinrec, mapper_unsparsify_state_t* pstate) {
+	lrec_t* poutrec = lrec_unbacked_alloc();
+	for (lhmsie_t* pf = pstate->key_names->phead; pf != NULL; pf = pf->pnext) {
+		char* key = pf->key;
+		char* value = lrec_get(pinrec, key);
+		if (value == NULL) {
+			lrec_put(poutrec, mlr_strdup_or_die(key), pstate->filler, FREE_ENTRY_KEY);
+		} else {
+			lrec_put(poutrec, mlr_strdup_or_die(key), mlr_strdup_or_die(value),
+				FREE_ENTRY_KEY|FREE_ENTRY_VALUE);
+		}
+	}
+	return poutrec;
+}
@@ -11,3 +11,30 @@ void mapper_chain_free(sllv_t* pmapper_chain, context_t* pctx) {
 	}
 	sllv_free(pmapper_chain);
 }
+
+// ----------------------------------------------------------------
+// This works back from the record-writer, which can write any field.
+static hss_t* mapper_chain_get_input_fields_aux(sllve_t* pe) {
+	if (pe == NULL)
+		return NULL;
+	hss_t* pdownstream_fields = mapper_chain_get_input_fields_aux(pe->pnext);
+	mapper_t* pmapper = pe->pvvalue;
+	hss_t* pinput_fields = (pmapper->pinput_fields_func == NULL)
+		? NULL
+		: pmapper->pinput_fields_func(pmapper->pvstate, pdownstream_fields);
+	hss_free(pdownstream_fields);
+	return pinput_fields;
+}
+
+hss_t* mapper_chain_get_input_fields(sllv_t* pmapper_chain) {
+	return mapper_chain_get_input_fields_aux(pmapper_chain->phead);
+}
+
+hss_t* mapper_pass_through_input_fields(hss_t* pdownstream_fields, slls_t* pfield_names) {
+	if (pdownstream_fields == NULL)
+		return NULL;
+	hss_t* pinput_fields = hss_copy(pdownstream_fields);
+	for (sllse_t* pe = pfield_names->phead; pe != NULL; pe = pe->pnext)
+		hss_add(pinput_fields, pe->value);
+	return pinput_fields;
+}
@@ -39,6 +39,7 @@ extern mapper_setup_t mapper_sec2gmtdate_setup;
 extern mapper_setup_t mapper_seqgen_setup;
 extern mapper_setup_t mapper_shuffle_setup;
 extern mapper_setup_t mapper_sort_setup;
+extern mapper_setup_t mapper_split_setup;
 extern mapper_setup_t mapper_stats1_setup;
 extern mapper_setup_t mapper_stats2_setup;
 extern mapper_setup_t mapper_step_setup;
@@ -52,4 +53,13 @@ extern mapper_setup_t mapper_unsparsify_setup;
 // Construction is in mlrcli.c.
 void mapper_chain_free(sllv_t* pmapper_chain, context_t* pctx);
 
+// Projection pushdown: the fields the chain can read from its input, or null if
+// it can read any of them. See mapper_input_fields_func_t. The caller frees the
+// set, before freeing the chain.
+hss_t* mapper_chain_get_input_fields(sllv_t* pmapper_chain);
+
+// For mappers which pass records along, reading the given fields as they go:
+// the downstream fields plus those, or null if the downstream fields are null.
+hss_t* mapper_pass_through_input_fields(hss_t* pdownstream_fields, slls_t* pfield_names);
+
 #endif // MAPPERS_H
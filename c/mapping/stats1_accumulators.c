@@ -10,6 +10,8 @@
 #include "containers/lhmss.h"
 #include "containers/lhmsll.h"
 #include "containers/percentile_keeper.h"
+#include "containers/tdigest.h"
+#include "containers/hll.h"
 #include "lib/mvfuncs.h"
 #include "mapping/stats1_accumulators.h"
 
@@ -19,10 +21,13 @@ void make_stats1_accs(
 	slls_t*  paccumulator_names,          // input
 	int      allow_int_float,             // input
 	int      do_interpolated_percentiles, // input
+	double   approx_compression,          // input
+	int      approx_precision,            // input
 	lhmsv_t* acc_field_to_acc_state_in,   // output
 	lhmsv_t* acc_field_to_acc_state_out)  // output
 {
 	stats1_acc_t* ppercentile_acc = NULL;
+	stats1_acc_t* papprox_percentile_acc = NULL;
 	for (sllse_t* pc = paccumulator_names->phead; pc != NULL; pc = pc->pnext) {
 		// for "sum", "count"
 		char* stats1_acc_name = pc->value;
@@ -45,6 +50,21 @@ void make_stats1_accs(
 				stats1_percentile_reuse(ppercentile_acc);
 			}
 			lhmsv_put(acc_field_to_acc_state_out, stats1_acc_name, ppercentile_acc, NO_FREE);
+		} else if (is_approx_percentile_acc_name(stats1_acc_name)) {
+			// Likewise p10~,p50~,p90~ share one t-digest.
+			if (papprox_percentile_acc == NULL) {
+				papprox_percentile_acc = stats1_approx_percentile_alloc(value_field_name, stats1_acc_name,
+					do_interpolated_percentiles, approx_compression);
+				lhmsv_put(acc_field_to_acc_state_in, stats1_acc_name, papprox_percentile_acc, NO_FREE);
+			} else {
+				stats1_approx_percentile_reuse(papprox_percentile_acc);
+			}
+			lhmsv_put(acc_field_to_acc_state_out, stats1_acc_name, papprox_percentile_acc, NO_FREE);
+		} else if (streq(stats1_acc_name, "distinct_count~")) {
+			stats1_acc_t* pstats1_acc = stats1_approx_distinct_count_alloc(value_field_name, stats1_acc_name,
+				approx_precision);
+			lhmsv_put(acc_field_to_acc_state_in, stats1_acc_name, pstats1_acc, NO_FREE);
+			lhmsv_put(acc_field_to_acc_state_out, stats1_acc_name, pstats1_acc, NO_FREE);
 		} else {
 			stats1_acc_t* pstats1_acc = make_stats1_acc(value_field_name, stats1_acc_name, allow_int_float,
 				do_interpolated_percentiles);
@@ -86,6 +106,18 @@ int is_percentile_acc_name(char* stats1_acc_name) {
 	return TRUE;
 }
 
+// Same as is_percentile_acc_name but with a trailing tilde, e.g. p99~ or median~.
+int is_approx_percentile_acc_name(char* stats1_acc_name) {
+	int len = strlen(stats1_acc_name);
+	if (len < 2 || stats1_acc_name[len-1] != '~')
+		return FALSE;
+	char* exact_name = mlr_strdup_or_die(stats1_acc_name);
+	exact_name[len-1] = 0;
+	int rv = is_percentile_acc_name(exact_name);
+	free(exact_name);
+	return rv;
+}
+
 // ----------------------------------------------------------------
 typedef struct _stats1_count_state_t {
 	mv_t counter;
@@ -704,3 +736,115 @@ void stats1_percentile_reuse(stats1_acc_t* pstats1_acc) {
 	stats1_percentile_state_t* pstate = pstats1_acc->pvstate;
 	pstate->reference_count++;
 }
+
+// ----------------------------------------------------------------
+// As above but with a t-digest, so memory is bounded regardless of input size.
+// Numeric input only.
+typedef struct _stats1_approx_percentile_state_t {
+	tdigest_t* pdigest;
+	lhmss_t* poutput_field_names;
+	int reference_count;
+	tdigest_emitter_t* pdigest_emitter;
+} stats1_approx_percentile_state_t;
+static void stats1_approx_percentile_dingest(void* pvstate, double val) {
+	stats1_approx_percentile_state_t* pstate = pvstate;
+	tdigest_ingest(pstate->pdigest, val);
+}
+
+static void stats1_approx_percentile_emit(void* pvstate, char* value_field_name, char* stats1_acc_name, int copy_data, lrec_t* poutrec) {
+	stats1_approx_percentile_state_t* pstate = pvstate;
+	double p;
+
+	if (stats1_acc_name[0] == 'm') { // Pre-validated to be either p{number}~ or median~.
+		p = 50.0;
+	} else {
+		(void)sscanf(stats1_acc_name, "p%lf", &p); // Stops at the tilde.
+	}
+	mv_t v = (tdigest_count(pstate->pdigest) == 0.0)
+		? mv_absent()
+		: mv_from_float(pstate->pdigest_emitter(pstate->pdigest, p));
+	char* s = mv_alloc_format_val(&v);
+	char* output_field_name = lhmss_get(pstate->poutput_field_names, stats1_acc_name);
+	if (output_field_name == NULL) {
+		output_field_name = mlr_paste_3_strings(value_field_name, "_", stats1_acc_name);
+		lhmss_put(pstate->poutput_field_names, mlr_strdup_or_die(stats1_acc_name),
+			output_field_name, FREE_ENTRY_KEY|FREE_ENTRY_VALUE);
+	}
+	lrec_put(poutrec, mlr_strdup_or_die(output_field_name), s, FREE_ENTRY_KEY|FREE_ENTRY_VALUE);
+}
+
+static void stats1_approx_percentile_free(stats1_acc_t* pstats1_acc) {
+	stats1_approx_percentile_state_t* pstate = pstats1_acc->pvstate;
+	pstate->reference_count--;
+	if (pstate->reference_count == 0) {
+		tdigest_free(pstate->pdigest);
+		lhmss_free(pstate->poutput_field_names);
+		free(pstate);
+		free(pstats1_acc);
+	}
+}
+stats1_acc_t* stats1_approx_percentile_alloc(char* value_field_name, char* stats1_acc_name,
+	int do_interpolated_percentiles, double compression)
+{
+	stats1_acc_t* pstats1_acc   = mlr_malloc_or_die(sizeof(stats1_acc_t));
+	stats1_approx_percentile_state_t* pstate = mlr_malloc_or_die(sizeof(stats1_approx_percentile_state_t));
+	pstate->pdigest             = tdigest_alloc(compression);
+	pstate->poutput_field_names = lhmss_alloc();
+	pstate->reference_count     = 1;
+	pstate->pdigest_emitter = (do_interpolated_percentiles)
+		? tdigest_emit_linearly_interpolated
+		: tdigest_emit_non_interpolated;
+
+	pstats1_acc->pvstate        = (void*)pstate;
+	pstats1_acc->pdingest_func  = stats1_approx_percentile_dingest;
+	pstats1_acc->pningest_func  = NULL;
+	pstats1_acc->psingest_func  = NULL;
+	pstats1_acc->pemit_func     = stats1_approx_percentile_emit;
+	pstats1_acc->pfree_func     = stats1_approx_percentile_free;
+	return pstats1_acc;
+}
+void stats1_approx_percentile_reuse(stats1_acc_t* pstats1_acc) {
+	stats1_approx_percentile_state_t* pstate = pstats1_acc->pvstate;
+	pstate->reference_count++;
+}
+
+// ----------------------------------------------------------------
+typedef struct _stats1_approx_distinct_count_state_t {
+	hll_t* phll;
+	char*  output_field_name;
+} stats1_approx_distinct_count_state_t;
+// Like count and mode, on strings: "1" and "1.0" are distinct text.
+static void stats1_approx_distinct_count_singest(void* pvstate, char* val) {
+	stats1_approx_distinct_count_state_t* pstate = pvstate;
+	hll_ingest_string(pstate->phll, val);
+}
+static void stats1_approx_distinct_count_emit(void* pvstate, char* value_field_name, char* stats1_acc_name, int copy_data, lrec_t* poutrec) {
+	stats1_approx_distinct_count_state_t* pstate = pvstate;
+	if (copy_data)
+		lrec_put(poutrec, mlr_strdup_or_die(pstate->output_field_name),
+			mlr_alloc_string_from_ull(hll_count(pstate->phll)), FREE_ENTRY_KEY|FREE_ENTRY_VALUE);
+	else
+		lrec_put(poutrec, pstate->output_field_name,
+			mlr_alloc_string_from_ull(hll_count(pstate->phll)), FREE_ENTRY_VALUE);
+}
+static void stats1_approx_distinct_count_free(stats1_acc_t* pstats1_acc) {
+	stats1_approx_distinct_count_state_t* pstate = pstats1_acc->pvstate;
+	hll_free(pstate->phll);
+	free(pstate->output_field_name);
+	free(pstate);
+	free(pstats1_acc);
+}
+stats1_acc_t* stats1_approx_distinct_count_alloc(char* value_field_name, char* stats1_acc_name, int precision) {
+	stats1_acc_t* pstats1_acc = mlr_malloc_or_die(sizeof(stats1_acc_t));
+	stats1_approx_distinct_count_state_t* pstate = mlr_malloc_or_die(sizeof(stats1_approx_distinct_count_state_t));
+	pstate->phll              = hll_alloc(precision);
+	pstate->output_field_name = mlr_paste_3_strings(value_field_name, "_", stats1_acc_name);
+
+	pstats1_acc->pvstate        = (void*)pstate;
+	pstats1_acc->pdingest_func  = NULL;
+	pstats1_acc->pningest_func  = NULL;
+	pstats1_acc->psingest_func  = stats1_approx_distinct_count_singest;
+	pstats1_acc->pemit_func     = stats1_approx_distinct_count_emit;
+	pstats1_acc->pfree_func     = stats1_approx_distinct_count_free;
+	return pstats1_acc;
+}
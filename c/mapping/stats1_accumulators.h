@@ -61,6 +61,10 @@ stats1_acc_t* stats1_min_alloc               (char* value_field_name, char* stat
 stats1_acc_t* stats1_max_alloc               (char* value_field_name, char* stats1_acc_name, int aif, int dip);
 stats1_acc_t* stats1_percentile_alloc        (char* value_field_name, char* stats1_acc_name, int aif, int dip);
 void          stats1_percentile_reuse        (stats1_acc_t* pstats1_acc);
+stats1_acc_t* stats1_approx_percentile_alloc (char* value_field_name, char* stats1_acc_name, int dip,
+	double compression);
+void          stats1_approx_percentile_reuse (stats1_acc_t* pstats1_acc);
+stats1_acc_t* stats1_approx_distinct_count_alloc(char* value_field_name, char* stats1_acc_name, int precision);
 
 
 // For percentiles there is one unique accumulator given (for example) five distinct
@@ -72,6 +76,8 @@ void make_stats1_accs(
 	slls_t*  paccumulator_names,
 	int      allow_int_float,
 	int      do_interpolated_percentiles,
+	double   approx_compression,
+	int      approx_precision,
 	lhmsv_t* acc_field_to_acc_state_in,
 	lhmsv_t* acc_field_to_acc_state_out);
 
@@ -82,6 +88,7 @@ stats1_acc_t* make_stats1_acc(
 	int   do_interpolated_percentiles);
 
 int is_percentile_acc_name(char* stats1_acc_name);
+int is_approx_percentile_acc_name(char* stats1_acc_name);
 
 // ----------------------------------------------------------------
 // Lookups for all but percentiles, which are a special case.
@@ -7,6 +7,7 @@
 multi_lrec_writer_t* multi_lrec_writer_alloc(cli_writer_opts_t* pwriter_opts) {
 	multi_lrec_writer_t* pmlw = mlr_malloc_or_die(sizeof(multi_lrec_writer_t));
 	pmlw->pnames_to_lrec_writers_and_fps = lhmsv_alloc();
+	pmlw->pmulti_out = multi_out_alloc();
 	pmlw->pwriter_opts = pwriter_opts;
 	return pmlw;
 }
@@ -18,12 +19,14 @@ void multi_lrec_writer_free(multi_lrec_writer_t* pmlw, context_t* pctx) {
 
 	for (lhmsve_t* pe = pmlw->pnames_to_lrec_writers_and_fps->phead; pe != NULL; pe = pe->pnext) {
 		lrec_writer_and_fp_t* pstate = pe->pvvalue;
-		pstate->plrec_writer->pfree_func(pstate->plrec_writer, pctx);
+		if (pstate->plrec_writer != NULL)
+			pstate->plrec_writer->pfree_func(pstate->plrec_writer, pctx);
 		free(pstate->filename_or_command);
 		free(pstate);
 	}
 
 	lhmsv_free(pmlw->pnames_to_lrec_writers_and_fps);
+	multi_out_free(pmlw->pmulti_out);
 	free(pmlw);
 }
 
@@ -34,56 +37,27 @@ void multi_lrec_writer_output_srec(multi_lrec_writer_t* pmlw, lrec_t* poutrec, c
 	lrec_writer_and_fp_t* pstate = lhmsv_get(pmlw->pnames_to_lrec_writers_and_fps, filename_or_command);
 	if (pstate == NULL) {
 		pstate = mlr_malloc_or_die(sizeof(lrec_writer_and_fp_t));
-		pstate->plrec_writer = lrec_writer_alloc(pmlw->pwriter_opts);
-		MLR_INTERNAL_CODING_ERROR_IF(pstate->plrec_writer == NULL);
+		pstate->plrec_writer = NULL;
 		pstate->filename_or_command = mlr_strdup_or_die(filename_or_command);
-		char* mode_string = get_mode_string(file_output_mode);
-		char* mode_desc = get_mode_desc(file_output_mode);
-		if (file_output_mode == MODE_PIPE) {
-			pstate->is_popen = TRUE;
-			pstate->output_stream = popen(filename_or_command, mode_string);
-			if (pstate->output_stream == NULL) {
-				perror("popen");
-				fprintf(stderr, "%s: failed popen for %s on \"%s\".\n",
-					MLR_GLOBALS.bargv0, mode_desc, filename_or_command);
-				exit(1);
-			}
-		} else {
-			pstate->is_popen = FALSE;
-			pstate->output_stream = fopen(filename_or_command, mode_string);
-			if (pstate->output_stream == NULL) {
-				perror("fopen");
-				fprintf(stderr, "%s: failed fopen for %s on \"%s\".\n",
-					MLR_GLOBALS.bargv0, mode_desc, filename_or_command);
-				exit(1);
-			}
-		}
-
+		pstate->file_output_mode = file_output_mode;
 		lhmsv_put(pmlw->pnames_to_lrec_writers_and_fps, mlr_strdup_or_die(filename_or_command), pstate, FREE_ENTRY_KEY);
 	}
+	if (pstate->plrec_writer == NULL) {
+		pstate->plrec_writer = lrec_writer_alloc(pmlw->pwriter_opts);
+		MLR_INTERNAL_CODING_ERROR_IF(pstate->plrec_writer == NULL);
+	}
 
-	pstate->plrec_writer->pprocess_func(pstate->plrec_writer->pvstate, pstate->output_stream, poutrec, pctx);
+	FILE* output_stream = multi_out_get(pmlw->pmulti_out, filename_or_command, file_output_mode);
+	pstate->plrec_writer->pprocess_func(pstate->plrec_writer->pvstate, output_stream, poutrec, pctx);
 
 	if (poutrec != NULL) {
 		if (flush_every_record)
-			fflush(pstate->output_stream);
+			fflush(output_stream);
 	} else {
-		if (pstate->is_popen) {
-			// Sadly, pclose returns an error even on well-formed commands. For example, if the popened
-			// command was "grep nonesuch" and the string "nonesuch" was not encountered, grep returns
-			// non-zero and popen flags it as an error. We cannot differentiate these from genuine
-			// failure cases so the best choice is to simply call pclose and ignore error codes.
-			// If a piped-to command does fail then it should have some output to stderr which the
-			// user can take advantage of.
-			(void)pclose(pstate->output_stream);
-		} else {
-			if (fclose(pstate->output_stream) != 0) {
-				perror("fclose");
-				fprintf(stderr, "%s: fclose error on \"%s\".\n", MLR_GLOBALS.bargv0, filename_or_command);
-				exit(1);
-			}
-		}
-		pstate->output_stream = NULL;
+		// The output is finished: later records, if any, go to a new writer, appending.
+		multi_out_close_one(pmlw->pmulti_out, filename_or_command);
+		pstate->plrec_writer->pfree_func(pstate->plrec_writer, pctx);
+		pstate->plrec_writer = NULL;
 	}
 }
 
@@ -103,22 +77,11 @@ void multi_lrec_writer_output_list(multi_lrec_writer_t* pmlw, sllv_t* poutrecs,
 void multi_lrec_writer_drain(multi_lrec_writer_t* pmlw, context_t* pctx) {
 	for (lhmsve_t* pe = pmlw->pnames_to_lrec_writers_and_fps->phead; pe != NULL; pe = pe->pnext) {
 		lrec_writer_and_fp_t* pstate = pe->pvvalue;
-		pstate->plrec_writer->pprocess_func(pstate->plrec_writer->pvstate, pstate->output_stream, NULL, pctx);
-		fflush(pstate->output_stream);
-		if (pstate->is_popen) {
-			// Sadly, pclose returns an error even on well-formed commands. For example, if the popened
-			// command was "grep nonesuch" and the string "nonesuch" was not encountered, grep returns
-			// non-zero and popen flags it as an error. We cannot differentiate these from genuine
-			// failure cases so the best choice is to simply call pclose and ignore error codes.
-			// If a piped-to command does fail then it should have some output to stderr which the
-			// user can take advantage of.
-			(void)pclose(pstate->output_stream);
-		} else {
-			if (fclose(pstate->output_stream) != 0) {
-				perror("fclose");
-				fprintf(stderr, "%s: fclose error on \"%s\".\n", MLR_GLOBALS.bargv0, pstate->filename_or_command);
-				exit(1);
-			}
-		}
+		if (pstate->plrec_writer == NULL) // Already finished
+			continue;
+		FILE* output_stream = multi_out_get(pmlw->pmulti_out, pstate->filename_or_command,
+			pstate->file_output_mode);
+		pstate->plrec_writer->pprocess_func(pstate->plrec_writer->pvstate, output_stream, NULL, pctx);
 	}
+	multi_out_close(pmlw->pmulti_out);
 }
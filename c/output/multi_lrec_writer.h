@@ -7,19 +7,22 @@
 #include "containers/sllv.h"
 #include "output/lrec_writers.h"
 #include "output/file_output_mode.h"
+#include "output/multi_out.h"
 #include "lib/context.h"
 
 // ----------------------------------------------------------------
 // This is the value struct for the hashmap:
 typedef struct _lrec_writer_and_fp_t {
-	lrec_writer_t* plrec_writer;
+	lrec_writer_t* plrec_writer; // NULL once a null record has finished the output
 	char* filename_or_command;
-	FILE* output_stream;
-	int is_popen;
+	file_output_mode_t file_output_mode;
 } lrec_writer_and_fp_t;
 
+// The output streams are kept in a multi_out so that they share its pool of
+// open file handles. Each stream is fetched from it just before being written.
 typedef struct _multi_lrec_writer_t {
 	lhmsv_t* pnames_to_lrec_writers_and_fps;
+	multi_out_t* pmulti_out;
 	cli_writer_opts_t* pwriter_opts;
 } multi_lrec_writer_t;
 
@@ -28,6 +31,7 @@ multi_lrec_writer_t* multi_lrec_writer_alloc(cli_writer_opts_t* pwriter_opts);
 
 void multi_lrec_writer_free(multi_lrec_writer_t* pmlw, context_t* pctx);
 
+// A null record finishes the output for the filename or command, closing it.
 void multi_lrec_writer_output_srec(multi_lrec_writer_t* pmlw, lrec_t* poutrec, char* filename_or_command,
 	file_output_mode_t file_output_mode, int flush_every_record, context_t* pctx);
 
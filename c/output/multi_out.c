@@ -1,65 +1,218 @@
+#include <errno.h>
 #include "lib/mlrutil.h"
 #include "lib/mlr_globals.h"
+#include "lib/mlr_arch.h"
 #include "multi_out.h"
 
+// Open files for all instances, most recently used at the head.
+static int                 max_open_files = 0; // Until set or computed on first use
+static int                 num_open_files = 0;
+static multi_out_stream_t* popen_head = NULL;
+static multi_out_stream_t* popen_tail = NULL;
+
+static void multi_out_open_stream(multi_out_stream_t* pstream);
+static void multi_out_popen_stream(multi_out_stream_t* pstream, char* command, char* mode_desc);
+static void multi_out_close_stream(multi_out_stream_t* pstream);
+
+// ----------------------------------------------------------------
+void multi_out_set_max_open_files(int new_max_open_files) {
+	max_open_files = new_max_open_files;
+}
+
 // ----------------------------------------------------------------
 multi_out_t* multi_out_alloc() {
 	multi_out_t* pmo = mlr_malloc_or_die(sizeof(multi_out_t));
 	pmo->pnames_to_fps = lhmsv_alloc();
+	pmo->preopen_func = NULL;
 	return pmo;
 }
 
+void multi_out_set_reopener(multi_out_t* pmo, multi_out_reopen_func_t* preopen_func) {
+	pmo->preopen_func = preopen_func;
+}
+
 // ----------------------------------------------------------------
 void multi_out_close(multi_out_t* pmo) {
 	for (lhmsve_t* pe = pmo->pnames_to_fps->phead; pe != NULL; pe = pe->pnext) {
-		fp_and_flag_t* pstate = pe->pvvalue;
-		if (pstate->is_popen) {
-			pclose(pstate->output_stream);
-		} else {
-			fclose(pstate->output_stream);
-		}
+		multi_out_stream_t* pstream = pe->pvvalue;
+		if (pstream->output_stream != NULL)
+			multi_out_close_stream(pstream);
 	}
 }
 
+void multi_out_close_one(multi_out_t* pmo, char* filename_or_command) {
+	multi_out_stream_t* pstream = lhmsv_get(pmo->pnames_to_fps, filename_or_command);
+	if (pstream != NULL && pstream->output_stream != NULL)
+		multi_out_close_stream(pstream);
+}
+
 // ----------------------------------------------------------------
 void multi_out_free(multi_out_t* pmo) {
 	if (pmo == NULL)
 		return;
 	for (lhmsve_t* pe = pmo->pnames_to_fps->phead; pe != NULL; pe = pe->pnext) {
-		fp_and_flag_t* pstate = pe->pvvalue;
-		free(pstate);
+		multi_out_stream_t* pstream = pe->pvvalue;
+		// Don't leave it in the pool's list.
+		if (pstream->output_stream != NULL)
+			multi_out_close_stream(pstream);
+		free(pstream->filename_or_command);
+		free(pstream);
 	}
 	lhmsv_free(pmo->pnames_to_fps);
 	free(pmo);
 }
 
+// ----------------------------------------------------------------
+static void unlink_open(multi_out_stream_t* pstream) {
+	if (pstream->pprev_open == NULL)
+		popen_head = pstream->pnext_open;
+	else
+		pstream->pprev_open->pnext_open = pstream->pnext_open;
+	if (pstream->pnext_open == NULL)
+		popen_tail = pstream->pprev_open;
+	else
+		pstream->pnext_open->pprev_open = pstream->pprev_open;
+	pstream->pprev_open = NULL;
+	pstream->pnext_open = NULL;
+}
+
+static void link_open_at_head(multi_out_stream_t* pstream) {
+	pstream->pprev_open = NULL;
+	pstream->pnext_open = popen_head;
+	if (popen_head != NULL)
+		popen_head->pprev_open = pstream;
+	else
+		popen_tail = pstream;
+	popen_head = pstream;
+}
+
 // ----------------------------------------------------------------
 FILE* multi_out_get(multi_out_t* pmo, char* filename_or_command, file_output_mode_t file_output_mode) {
-	fp_and_flag_t* pstate = lhmsv_get(pmo->pnames_to_fps, filename_or_command);
-	if (pstate == NULL) {
-		pstate = mlr_malloc_or_die(sizeof(fp_and_flag_t));
-		char* mode_string = get_mode_string(file_output_mode);
-		char* mode_desc = get_mode_desc(file_output_mode);
-		if (file_output_mode == MODE_PIPE) {
-			pstate->is_popen = TRUE;
-			pstate->output_stream = popen(filename_or_command, mode_string);
-			if (pstate->output_stream == NULL) {
-				perror("popen");
-				fprintf(stderr, "%s: failed popen for %s of \"%s\".\n",
-					MLR_GLOBALS.bargv0, mode_desc, filename_or_command);
-				exit(1);
-			}
+	multi_out_stream_t* pstream = lhmsv_get(pmo->pnames_to_fps, filename_or_command);
+	if (pstream == NULL) {
+		pstream = mlr_malloc_or_die(sizeof(multi_out_stream_t));
+		pstream->output_stream       = NULL;
+		pstream->is_popen            = file_output_mode == MODE_PIPE;
+		pstream->was_opened          = FALSE;
+		pstream->filename_or_command = mlr_strdup_or_die(filename_or_command);
+		pstream->file_output_mode    = file_output_mode;
+		pstream->preopen_func        = pstream->is_popen ? pmo->preopen_func : NULL;
+		pstream->buffer              = NULL;
+		pstream->pprev_open          = NULL;
+		pstream->pnext_open          = NULL;
+		lhmsv_put(pmo->pnames_to_fps, pstream->filename_or_command, pstream, NO_FREE);
+	}
+
+	if (pstream->output_stream == NULL) {
+		multi_out_open_stream(pstream);
+	} else if ((!pstream->is_popen || pstream->preopen_func != NULL) && pstream != popen_head) {
+		unlink_open(pstream);
+		link_open_at_head(pstream);
+	}
+	return pstream->output_stream;
+}
+
+// ----------------------------------------------------------------
+static void multi_out_open_stream(multi_out_stream_t* pstream) {
+	char* mode_desc = get_mode_desc(pstream->file_output_mode);
+
+	if (pstream->is_popen && pstream->preopen_func == NULL) {
+		if (pstream->was_opened) {
+			fprintf(stderr, "%s: output pipe to \"%s\" was already closed.\n",
+				MLR_GLOBALS.bargv0, pstream->filename_or_command);
+			exit(1);
+		}
+		multi_out_popen_stream(pstream, pstream->filename_or_command, mode_desc);
+		pstream->was_opened = TRUE;
+		return;
+	}
+
+	if (max_open_files == 0) {
+		long process_limit = mlr_arch_get_max_open_files();
+		if (process_limit < 0)
+			max_open_files = MULTI_OUT_DEFAULT_MAX_OPEN_FILES;
+		else if (process_limit > 2 * MULTI_OUT_RESERVED_OPEN_FILES)
+			max_open_files = process_limit - MULTI_OUT_RESERVED_OPEN_FILES;
+		else
+			max_open_files = process_limit / 2;
+	}
+	while (num_open_files >= max_open_files && popen_tail != NULL)
+		multi_out_close_stream(popen_tail);
+
+	if (pstream->is_popen) {
+		if (pstream->was_opened) {
+			char* command = pstream->preopen_func(pstream->filename_or_command);
+			multi_out_popen_stream(pstream, command, mode_desc);
+			free(command);
 		} else {
-			pstate->is_popen = FALSE;
-			pstate->output_stream = fopen(filename_or_command, mode_string);
-			if (pstate->output_stream == NULL) {
-				perror("fopen");
-				fprintf(stderr, "%s: failed fopen for %s of \"%s\".\n",
-					MLR_GLOBALS.bargv0, mode_desc, filename_or_command);
-				exit(1);
+			multi_out_popen_stream(pstream, pstream->filename_or_command, mode_desc);
+		}
+	} else {
+		char* mode_string = pstream->was_opened ? "a" : get_mode_string(pstream->file_output_mode);
+		for (;;) {
+			pstream->output_stream = fopen(pstream->filename_or_command, mode_string);
+			if (pstream->output_stream != NULL)
+				break;
+			// Something other than us is also holding file handles: make room and retry.
+			if ((errno == EMFILE || errno == ENFILE) && popen_tail != NULL) {
+				multi_out_close_stream(popen_tail);
+				continue;
 			}
+			perror("fopen");
+			fprintf(stderr, "%s: failed fopen for %s of \"%s\".\n",
+				MLR_GLOBALS.bargv0, mode_desc, pstream->filename_or_command);
+			exit(1);
+		}
+	}
+	pstream->was_opened = TRUE;
+
+	pstream->buffer = mlr_malloc_or_die(MULTI_OUT_BUFFER_SIZE);
+	setvbuf(pstream->output_stream, pstream->buffer, _IOFBF, MULTI_OUT_BUFFER_SIZE);
+
+	link_open_at_head(pstream);
+	num_open_files++;
+}
+
+static void multi_out_popen_stream(multi_out_stream_t* pstream, char* command, char* mode_desc) {
+	for (;;) {
+		pstream->output_stream = popen(command, "w");
+		if (pstream->output_stream != NULL)
+			break;
+		if ((errno == EMFILE || errno == ENFILE) && popen_tail != NULL) {
+			multi_out_close_stream(popen_tail);
+			continue;
+		}
+		perror("popen");
+		fprintf(stderr, "%s: failed popen for %s of \"%s\".\n",
+			MLR_GLOBALS.bargv0, mode_desc, command);
+		exit(1);
+	}
+}
+
+// ----------------------------------------------------------------
+static void multi_out_close_stream(multi_out_stream_t* pstream) {
+	if (pstream->is_popen) {
+		// Sadly, pclose returns an error even on well-formed commands. For example, if the popened
+		// command was "grep nonesuch" and the string "nonesuch" was not encountered, grep returns
+		// non-zero and popen flags it as an error. We cannot differentiate these from genuine
+		// failure cases so the best choice is to simply call pclose and ignore error codes.
+		// If a piped-to command does fail then it should have some output to stderr which the
+		// user can take advantage of.
+		(void)pclose(pstream->output_stream);
+		if (pstream->preopen_func == NULL) {
+			pstream->output_stream = NULL;
+			return;
+		}
+	} else {
+		if (fclose(pstream->output_stream) != 0) {
+			perror("fclose");
+			fprintf(stderr, "%s: fclose error on \"%s\".\n", MLR_GLOBALS.bargv0, pstream->filename_or_command);
+			exit(1);
 		}
-		lhmsv_put(pmo->pnames_to_fps, mlr_strdup_or_die(filename_or_command), pstate, FREE_ENTRY_KEY);
 	}
-	return pstate->output_stream;
+	free(pstream->buffer);
+	pstream->buffer = NULL;
+	unlink_open(pstream);
+	num_open_files--;
+	pstream->output_stream = NULL;
 }
@@ -1,3 +1,17 @@
+// ================================================================
+// Output streams for redirected print/dump/tee/emit, keyed by filename or
+// command. Partitioning a stream by key can easily make for more files than
+// the process may have open at once, so open files are kept in a pool shared
+// by all multi_out instances: when it's full, the least recently used file is
+// closed, and reopened in append mode if it's written to again. Pipes are
+// closed only at the end, since reopening them would run the command again --
+// unless the multi_out has a reopener, for commands which can be rerun to carry
+// on where they left off, in which case they're in the pool too.
+//
+// Each open file gets a large stdio buffer so that many small records go out
+// in few writes.
+// ================================================================
+
 #ifndef MULTI_OUT_H
 #define MULTI_OUT_H
 
@@ -5,15 +19,34 @@
 #include "containers/lhmsv.h"
 #include "output/file_output_mode.h"
 
+// Unless set, the maximum is the process's open-file limit less the reserve,
+// for input files, pipes, etc. This is the fallback if the limit is unknown.
+#define MULTI_OUT_DEFAULT_MAX_OPEN_FILES 1000
+#define MULTI_OUT_RESERVED_OPEN_FILES    64
+#define MULTI_OUT_BUFFER_SIZE            32768
+
 // ----------------------------------------------------------------
+// Given a pipe command, returns a new string with the command to reopen it, e.g.
+// gzip >> 'x.gz' for gzip > 'x.gz'.
+typedef char* multi_out_reopen_func_t(char* command);
+
 // This is the value struct for the hashmap:
-typedef struct _fp_and_flag_t {
-	FILE* output_stream;
+typedef struct _multi_out_stream_t {
+	FILE* output_stream; // NULL when closed for reuse of its file handle
 	int is_popen;
-} fp_and_flag_t;
+	int was_opened;      // Once written, files are reopened for append, not truncated
+	char* filename_or_command;
+	file_output_mode_t file_output_mode;
+	multi_out_reopen_func_t* preopen_func; // Non-null for pipes in the pool
+	char* buffer;
+	// Most recently used first; open files only.
+	struct _multi_out_stream_t* pprev_open;
+	struct _multi_out_stream_t* pnext_open;
+} multi_out_stream_t;
 
 typedef struct _multi_out_t {
 	lhmsv_t* pnames_to_fps;
+	multi_out_reopen_func_t* preopen_func;
 } multi_out_t;
 
 // ----------------------------------------------------------------
@@ -25,4 +58,13 @@ void  multi_out_free(multi_out_t* pmo);
 
 FILE* multi_out_get(multi_out_t* pmo, char* filename_or_command, file_output_mode_t file_output_mode);
 
+// Closes the stream if it's open. A subsequent multi_out_get appends.
+void  multi_out_close_one(multi_out_t* pmo, char* filename_or_command);
+
+// For pipes opened after this call.
+void  multi_out_set_reopener(multi_out_t* pmo, multi_out_reopen_func_t* preopen_func);
+
+// Process-wide limit on the number of files open for all multi_out instances.
+void  multi_out_set_max_open_files(int max_open_files);
+
 #endif // MULTI_OUT_H
@@ -0,0 +1,731 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <regex.h>
+
+#include "stdio.h"  // for fileno() prototype
+#include "string.h" // for strdup() prototype
+#include "mlr_dsl_parse.h"
+#include "../dsl/mlr_dsl_ast.h"
+// http://flex.sourceforge.net/manual/Extra-Data.html
+
+// NOTE: any new keywords defined here should also be documented
+// in dsl/mlr_dsl_cst.c's mlr_dsl_keyword_usage() et al.
+
+typedef void* yyscan_t;
+typedef struct { char* s; } *YY_BUFFER_STATE;
+typedef struct { char* buf; size_t pos; char* text; struct _mlr_dsl_ast_node_t ** extra; regex_t* rx; } ffscanner_t;
+#define yytext (((ffscanner_t*)yyscanner)->text)
+#define yyextra (((ffscanner_t*)yyscanner)->extra)
+static const char* ffpats[] = {
+"^(;)",
+"^(\\{)",
+"^(\\})",
+"^(=)",
+"^(filter)",
+"^(unset)",
+"^(tee)",
+"^(emitf)",
+"^(emitp)",
+"^(emit)",
+"^(dump)",
+"^(edump)",
+"^(print)",
+"^(printn)",
+"^(eprint)",
+"^(eprintn)",
+"^(stdout)",
+"^(stderr)",
+"^(func)",
+"^(subr)",
+"^(call)",
+"^(return)",
+"^(begin)",
+"^(end)",
+"^(all)",
+"^(do)",
+"^(while)",
+"^(for)",
+"^(in)",
+"^(break)",
+"^(continue)",
+"^(if)",
+"^(elif)",
+"^(else)",
+"^(\\?)",
+"^(:)",
+"^(\\|\\|)",
+"^(\\|\\|=)",
+"^(\\^\\^)",
+"^(\\^\\^=)",
+"^(&&)",
+"^(&&=)",
+"^(=~)",
+"^(!=~)",
+"^(==)",
+"^(!=)",
+"^(>)",
+"^(>=)",
+"^(<)",
+"^(<=)",
+"^(\\|)",
+"^(\\|=)",
+"^(\\^)",
+"^(\\^=)",
+"^(&)",
+"^(&=)",
+"^(<<)",
+"^(<<=)",
+"^(>>)",
+"^(>>=)",
+"^(\\+)",
+"^(\\+=)",
+"^(-)",
+"^(-=)",
+"^(\\.)",
+"^(\\.=)",
+"^(\\*)",
+"^(\\*=)",
+"^(/)",
+"^(/=)",
+"^(//)",
+"^(//=)",
+"^(\\.\\+)",
+"^(\\.\\+=)",
+"^(\\.-)",
+"^(\\.-=)",
+"^(\\.\\*)",
+"^(\\.\\*=)",
+"^(\\./)",
+"^(\\./=)",
+"^(\\.//)",
+"^(\\.//=)",
+"^(%)",
+"^(%=)",
+"^(!)",
+"^(~)",
+"^(\\*\\*)",
+"^(\\*\\*=)",
+"^(\\$\\*)",
+"^(\\$)",
+"^(\\$[a-zA-Z_0-9]+)",
+"^(\\$\\{([^}]|\\\\.)*\\})",
+"^(@[a-zA-Z_0-9]+)",
+"^(@\\{([^}]|\\\\.)*\\})",
+"^(@)",
+"^(@\\*)",
+"^(\\[)",
+"^(\\])",
+"^([0-9]+|[0-9]+\\.[0-9]*|[0-9]*\\.[0-9]+|[0-9]+[eE][0-9]+|[0-9]+[eE]-[0-9]+|[0-9]+\\.[0-9]*[eE][0-9]+|[0-9]+\\.[0-9]*[eE]-[0-9]+|[0-9]*\\.[0-9]+[eE][0-9]+|[0-9]*\\.[0-9]+[eE]-[0-9]+)",
+"^(0x[0-9a-fA-F]+)",
+"^(\"([^\\\"]|\\\\.)*\")",
+"^(\"([^\\\"]|\\\\.)*\"i)",
+"^(map)",
+"^(var)",
+"^(num)",
+"^(int)",
+"^(float)",
+"^(bool)",
+"^(str)",
+"^(true)",
+"^(false)",
+"^(IPS)",
+"^(IFS)",
+"^(IRS)",
+"^(OPS)",
+"^(OFS)",
+"^(ORS)",
+"^(NF)",
+"^(NR)",
+"^(FNR)",
+"^(FILENAME)",
+"^(FILENUM)",
+"^(M_PI)",
+"^(M_E)",
+"^(ENV)",
+"^([a-zA-Z_][a-zA-Z_0-9]*)",
+"^(\\()",
+"^(\\))",
+"^(,)",
+"^(#.*\n)",
+"^([ \t\r\n])",
+"^(.)"
+};
+#define FFN 132
+
+int mlr_dsl_lexer_lex_init_extra(struct _mlr_dsl_ast_node_t ** extra, yyscan_t* pscanner) {
+	ffscanner_t* s = calloc(1, sizeof(ffscanner_t)); s->extra = extra;
+	s->rx = calloc(FFN, sizeof(regex_t));
+	for (int i = 0; i < FFN; i++) if (regcomp(&s->rx[i], ffpats[i], REG_EXTENDED|REG_NEWLINE)) { fprintf(stderr, "fakeflex bad re %s\n", ffpats[i]); exit(1); }
+	*pscanner = s; return 0;
+}
+void mlr_dsl_lexer_set_in(FILE* f, yyscan_t yyscanner) {
+	ffscanner_t* s = yyscanner; size_t n = 0, cap = 1024; char* b = malloc(cap); int c;
+	while ((c = fgetc(f)) != EOF) { if (n+1 >= cap) b = realloc(b, cap *= 2); b[n++] = c; }
+	b[n] = 0; s->buf = b; s->pos = 0;
+}
+YY_BUFFER_STATE mlr_dsl_lexer__scan_string(const char* str, yyscan_t yyscanner) {
+	ffscanner_t* s = yyscanner; s->buf = strdup(str); s->pos = 0; return calloc(1, sizeof(*(YY_BUFFER_STATE)0));
+}
+void mlr_dsl_lexer__switch_to_buffer(YY_BUFFER_STATE b, yyscan_t yyscanner) { }
+void mlr_dsl_lexer__delete_buffer(YY_BUFFER_STATE b, yyscan_t yyscanner) { free(b); }
+int mlr_dsl_lexer_lex_destroy(yyscan_t yyscanner) {
+	ffscanner_t* s = yyscanner; for (int i = 0; i < FFN; i++) regfree(&s->rx[i]); free(s->rx); free(s->buf); free(s->text); free(s); return 0;
+}
+int mlr_dsl_lexer_lex(yyscan_t yyscanner) {
+	ffscanner_t* s = yyscanner;
+	while (1) {
+		if (s->buf == NULL || s->buf[s->pos] == 0) return 0;
+		int best = -1; regoff_t bestlen = 0; regmatch_t m;
+		for (int i = 0; i < FFN; i++) {
+			if (regexec(&s->rx[i], &s->buf[s->pos], 1, &m, 0) == 0 && m.rm_so == 0 && m.rm_eo > bestlen) { best = i; bestlen = m.rm_eo; }
+		}
+		if (best < 0) return -1;
+		free(s->text); s->text = strndup(&s->buf[s->pos], bestlen); s->pos += bestlen;
+		switch (best) {
+		case 0: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRIPPED_AWAY);
+	return MD_TOKEN_SEMICOLON;
+		} break;
+		case 1: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRIPPED_AWAY);
+	return MD_TOKEN_LBRACE;
+		} break;
+		case 2: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRIPPED_AWAY);
+	return MD_TOKEN_RBRACE;
+		} break;
+		case 3: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_SREC_ASSIGNMENT);
+	return MD_TOKEN_ASSIGN;
+		} break;
+		case 4: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_FILTER);
+	return MD_TOKEN_FILTER;
+		} break;
+		case 5: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_UNSET);
+	return MD_TOKEN_UNSET;
+		} break;
+		case 6: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_TEE);
+	return MD_TOKEN_TEE;
+		} break;
+		case 7: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_EMITF);
+	return MD_TOKEN_EMITF;
+		} break;
+		case 8: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_EMITP);
+	return MD_TOKEN_EMITP;
+		} break;
+		case 9: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_EMIT);
+	return MD_TOKEN_EMIT;
+		} break;
+		case 10: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_DUMP);
+	return MD_TOKEN_DUMP;
+		} break;
+		case 11: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_EDUMP);
+	return MD_TOKEN_EDUMP;
+		} break;
+		case 12: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_PRINT);
+	return MD_TOKEN_PRINT;
+		} break;
+		case 13: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_PRINTN);
+	return MD_TOKEN_PRINTN;
+		} break;
+		case 14: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_EPRINT);
+	return MD_TOKEN_EPRINT;
+		} break;
+		case 15: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_EPRINTN);
+	return MD_TOKEN_EPRINTN;
+		} break;
+		case 16: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STDOUT);
+	return MD_TOKEN_STDOUT;
+		} break;
+		case 17: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STDERR);
+	return MD_TOKEN_STDERR;
+		} break;
+		case 18: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRIPPED_AWAY);
+	return MD_TOKEN_FUNC_DEF;
+		} break;
+		case 19: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRIPPED_AWAY);
+	return MD_TOKEN_SUBR_DEF;
+		} break;
+		case 20: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRIPPED_AWAY);
+	return MD_TOKEN_SUBR_CALL;
+		} break;
+		case 21: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRIPPED_AWAY);
+	return MD_TOKEN_RETURN;
+		} break;
+		case 22: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRIPPED_AWAY);
+	return MD_TOKEN_BEGIN;
+		} break;
+		case 23: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRIPPED_AWAY);
+	return MD_TOKEN_END;
+		} break;
+		case 24: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_ALL);
+	return MD_TOKEN_ALL;
+		} break;
+		case 25: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_DO_WHILE);
+	return MD_TOKEN_DO;
+		} break;
+		case 26: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_WHILE);
+	return MD_TOKEN_WHILE;
+		} break;
+		case 27: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRIPPED_AWAY);
+	return MD_TOKEN_FOR;
+		} break;
+		case 28: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_IN);
+	return MD_TOKEN_IN;
+		} break;
+		case 29: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_BREAK);
+	return MD_TOKEN_BREAK;
+		} break;
+		case 30: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_CONTINUE);
+	return MD_TOKEN_CONTINUE;
+		} break;
+		case 31: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_IF_ITEM);
+	return MD_TOKEN_IF;
+		} break;
+		case 32: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_IF_ITEM);
+	return MD_TOKEN_ELIF;
+		} break;
+		case 33: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_IF_ITEM);
+	return MD_TOKEN_ELSE;
+		} break;
+		case 34: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_QUESTION_MARK;
+		} break;
+		case 35: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_COLON;
+		} break;
+		case 36: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_LOGICAL_OR;
+		} break;
+		case 37: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_LOGICAL_OR_EQUALS;
+		} break;
+		case 38: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_LOGICAL_XOR;
+		} break;
+		case 39: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_LOGICAL_XOR_EQUALS;
+		} break;
+		case 40: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_LOGICAL_AND;
+		} break;
+		case 41: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_LOGICAL_AND_EQUALS;
+		} break;
+		case 42: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_MATCHES;
+		} break;
+		case 43: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_DOES_NOT_MATCH;
+		} break;
+		case 44: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_EQ;
+		} break;
+		case 45: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_NE;
+		} break;
+		case 46: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_GT;
+		} break;
+		case 47: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_GE;
+		} break;
+		case 48: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_LT;
+		} break;
+		case 49: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_LE;
+		} break;
+		case 50: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_BITWISE_OR;
+		} break;
+		case 51: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_BITWISE_OR_EQUALS;
+		} break;
+		case 52: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_BITWISE_XOR;
+		} break;
+		case 53: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_BITWISE_XOR_EQUALS;
+		} break;
+		case 54: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_BITWISE_AND;
+		} break;
+		case 55: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_BITWISE_AND_EQUALS;
+		} break;
+		case 56: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_BITWISE_LSH;
+		} break;
+		case 57: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_BITWISE_LSH_EQUALS;
+		} break;
+		case 58: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_BITWISE_RSH;
+		} break;
+		case 59: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_BITWISE_RSH_EQUALS;
+		} break;
+		case 60: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_PLUS;
+		} break;
+		case 61: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_PLUS_EQUALS;
+		} break;
+		case 62: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_MINUS;
+		} break;
+		case 63: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_MINUS_EQUALS;
+		} break;
+		case 64: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_DOT;
+		} break;
+		case 65: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_DOT_EQUALS;
+		} break;
+		case 66: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_TIMES;
+		} break;
+		case 67: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_TIMES_EQUALS;
+		} break;
+		case 68: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_DIVIDE;
+		} break;
+		case 69: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_DIVIDE_EQUALS;
+		} break;
+		case 70: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_INT_DIVIDE;
+		} break;
+		case 71: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_INT_DIVIDE_EQUALS;
+		} break;
+		case 72: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_OPLUS;
+		} break;
+		case 73: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_OPLUS_EQUALS;
+		} break;
+		case 74: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_OMINUS;
+		} break;
+		case 75: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_OMINUS_EQUALS;
+		} break;
+		case 76: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_OTIMES;
+		} break;
+		case 77: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_OTIMES_EQUALS;
+		} break;
+		case 78: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_ODIVIDE;
+		} break;
+		case 79: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_ODIVIDE_EQUALS;
+		} break;
+		case 80: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_INT_ODIVIDE;
+		} break;
+		case 81: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_INT_ODIVIDE_EQUALS;
+		} break;
+		case 82: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_MOD;
+		} break;
+		case 83: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_MOD_EQUALS;
+		} break;
+		case 84: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_LOGICAL_NOT;
+		} break;
+		case 85: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_BITWISE_NOT;
+		} break;
+		case 86: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_POW;
+		} break;
+		case 87: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_OPERATOR);
+	return MD_TOKEN_POW_EQUALS;
+		} break;
+		case 88: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_FULL_SREC);
+	return MD_TOKEN_FULL_SREC;
+		} break;
+		case 89: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRIPPED_AWAY);
+	return MD_TOKEN_DOLLAR_SIGN;
+		} break;
+		case 90: {
+	// Note: the parser depends on the dollar sign being here. If this is changed,
+	// that needs to be changed as well.
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_FIELD_NAME);
+	return MD_TOKEN_FIELD_NAME;
+		} break;
+		case 91: {
+	// Note: the parser depends on the dollar sign being here. If this is changed,
+	// that needs to be changed as well.
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_FIELD_NAME);
+	return MD_TOKEN_BRACED_FIELD_NAME;
+		} break;
+		case 92: {
+	// Note: the parser depends on the at-sign being here. If this is changed,
+	// that needs to be changed as well.
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRING_LITERAL);
+	return MD_TOKEN_UNBRACED_OOSVAR_NAME;
+		} break;
+		case 93: {
+	// Note: the parser depends on the percent-sign being here. If this is changed,
+	// that needs to be changed as well.
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRING_LITERAL);
+	return MD_TOKEN_BRACED_OOSVAR_NAME;
+		} break;
+		case 94: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRIPPED_AWAY);
+	return MD_TOKEN_AT_SIGN;
+		} break;
+		case 95: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_FULL_OOSVAR);
+	return MD_TOKEN_FULL_OOSVAR;
+		} break;
+		case 96: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRIPPED_AWAY);
+	return MD_TOKEN_LEFT_BRACKET;
+		} break;
+		case 97: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRIPPED_AWAY);
+	return MD_TOKEN_RIGHT_BRACKET;
+		} break;
+		case 98: {
+	// Leading minus sign is handled via the unary-minus operator, not here.
+	// 123
+	// 123. 123.4
+	// .234
+	// 1e2
+	// 1e-2
+	// 1.2e3 1.e3
+	// 1.2e-3 1.e-3
+	// .2e3
+	// .2e-3 1.e-3
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_NUMERIC_LITERAL);
+	return MD_TOKEN_NUMBER;
+		} break;
+		case 99: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_NUMERIC_LITERAL);
+	return MD_TOKEN_NUMBER;
+		} break;
+		case 100: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRING_LITERAL);
+	return MD_TOKEN_STRING;
+		} break;
+		case 101: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_REGEXI);
+	return MD_TOKEN_REGEXI;
+		} break;
+		case 102: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRIPPED_AWAY);
+	return MD_TOKEN_MAP;
+		} break;
+		case 103: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRIPPED_AWAY);
+	return MD_TOKEN_VAR;
+		} break;
+		case 104: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_NUMERIC_LOCAL_DEFINITION);
+	return MD_TOKEN_NUMERIC;
+		} break;
+		case 105: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_INT_LOCAL_DEFINITION);
+	return MD_TOKEN_INT;
+		} break;
+		case 106: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_FLOAT_LOCAL_DEFINITION);
+	return MD_TOKEN_FLOAT;
+		} break;
+		case 107: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_BOOLEAN_LOCAL_DEFINITION);
+	return MD_TOKEN_BOOLEAN;
+		} break;
+		case 108: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRING_LOCAL_DEFINITION);
+	return MD_TOKEN_STRING;
+		} break;
+		case 109: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_BOOLEAN_LITERAL);
+	return MD_TOKEN_TRUE;
+		} break;
+		case 110: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_BOOLEAN_LITERAL);
+	return MD_TOKEN_FALSE;
+		} break;
+		case 111: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_CONTEXT_VARIABLE);
+	return MD_TOKEN_CONTEXT_VARIABLE;
+		} break;
+		case 112: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_CONTEXT_VARIABLE);
+	return MD_TOKEN_CONTEXT_VARIABLE;
+		} break;
+		case 113: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_CONTEXT_VARIABLE);
+	return MD_TOKEN_CONTEXT_VARIABLE;
+		} break;
+		case 114: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_CONTEXT_VARIABLE);
+	return MD_TOKEN_CONTEXT_VARIABLE;
+		} break;
+		case 115: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_CONTEXT_VARIABLE);
+	return MD_TOKEN_CONTEXT_VARIABLE;
+		} break;
+		case 116: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_CONTEXT_VARIABLE);
+	return MD_TOKEN_CONTEXT_VARIABLE;
+		} break;
+		case 117: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_CONTEXT_VARIABLE);
+	return MD_TOKEN_CONTEXT_VARIABLE;
+		} break;
+		case 118: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_CONTEXT_VARIABLE);
+	return MD_TOKEN_CONTEXT_VARIABLE;
+		} break;
+		case 119: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_CONTEXT_VARIABLE);
+	return MD_TOKEN_CONTEXT_VARIABLE;
+		} break;
+		case 120: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_CONTEXT_VARIABLE);
+	return MD_TOKEN_CONTEXT_VARIABLE;
+		} break;
+		case 121: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_CONTEXT_VARIABLE);
+	return MD_TOKEN_CONTEXT_VARIABLE;
+		} break;
+		case 122: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_CONTEXT_VARIABLE);
+	return MD_TOKEN_CONTEXT_VARIABLE;
+		} break;
+		case 123: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_CONTEXT_VARIABLE);
+	return MD_TOKEN_CONTEXT_VARIABLE;
+		} break;
+		case 124: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_ENV);
+	return MD_TOKEN_ENV;
+		} break;
+		case 125: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_NON_SIGIL_NAME);
+	return MD_TOKEN_NON_SIGIL_NAME;
+		} break;
+		case 126: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRIPPED_AWAY);
+	return MD_TOKEN_LPAREN;
+		} break;
+		case 127: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRIPPED_AWAY);
+	return MD_TOKEN_RPAREN;
+		} break;
+		case 128: {
+	*yyextra = mlr_dsl_ast_node_alloc(yytext, MD_AST_NODE_TYPE_STRIPPED_AWAY);
+	return MD_TOKEN_COMMA;
+		} break;
+		case 129: {
+
+		} break;
+		case 130: {
+
+		} break;
+		case 131: {
+	return -1;
+		} break;
+		}
+	}
+}
@@ -0,0 +1,14 @@
+#ifndef FF_mlr_dsl_lexer_H
+#define FF_mlr_dsl_lexer_H
+#include <stdio.h>
+typedef void* yyscan_t;
+typedef struct { char* s; } *YY_BUFFER_STATE;
+struct _mlr_dsl_ast_node_t;
+int mlr_dsl_lexer_lex_init_extra(struct _mlr_dsl_ast_node_t ** extra, yyscan_t* pscanner);
+void mlr_dsl_lexer_set_in(FILE* f, yyscan_t yyscanner);
+YY_BUFFER_STATE mlr_dsl_lexer__scan_string(const char* str, yyscan_t yyscanner);
+void mlr_dsl_lexer__switch_to_buffer(YY_BUFFER_STATE b, yyscan_t yyscanner);
+void mlr_dsl_lexer__delete_buffer(YY_BUFFER_STATE b, yyscan_t yyscanner);
+int mlr_dsl_lexer_lex_destroy(yyscan_t yyscanner);
+int mlr_dsl_lexer_lex(yyscan_t yyscanner);
+#endif
@@ -0,0 +1,8924 @@
+/* Driver template for the LEMON parser generator.
+** The author disclaims copyright to this source code.
+*/
+/* First off, code is include which follows the "include" declaration
+** in the input file. */
+#include <stdio.h>
+#line 4 "mlr_dsl_parse.y"
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "../lib/mlrutil.h"
+#include "../dsl/mlr_dsl_ast.h"
+#include "../containers/sllv.h"
+
+// ================================================================
+// AST:
+// * parens, commas, semis, line endings, whitespace are all stripped away
+// * variable names and literal values remain as leaf nodes of the AST
+// * = + - * / ** {function names} remain as non-leaf nodes of the AST
+// CST: See mlr_dsl_cst.c
+//
+// Note: This parser accepts many things that are invalid, e.g.
+//
+// * begin{end{}} -- begin/end not at top level
+// * begin{$x=1} -- references to stream records at begin/end
+// * break/continue outside of for/while/do-while
+// * return outside of a function definition
+// * $x=x -- boundvars outside of for-loop variable bindings
+//
+// All of the above are enforced by the CST builder's semantic-analysis logic,
+// which takes this parser's output AST as input.  This is done (a) to keep this
+// grammar from being overly complex, and (b) so we can get much more
+// informative error messages in C than in Lemon ('syntax error').
+//
+// The parser hooks all build up an abstract syntax tree specifically for the CST builder.
+// For clearer visuals on what the ASTs look like:
+// * See mlr_dsl_cst.c
+// * See reg_test/run's filter -v and put -v outputs, e.g. in reg_test/expected/out
+// * Do "mlr -n put -v 'your expression goes here'"
+// ================================================================
+
+
+#line 45 "mlr_dsl_parse.c"
+/* Next is all token values, in a form suitable for use by makeheaders.
+** This section will be null unless lemon is run with the -m switch.
+*/
+/*
+** These constants (all generated automatically by the parser generator)
+** specify the various kinds of tokens (terminals) that the parser
+** understands.
+**
+** Each symbol here is a terminal symbol in the grammar.
+*/
+/* Make sure the INTERFACE macro is defined.
+*/
+#ifndef INTERFACE
+# define INTERFACE 1
+#endif
+/* The next thing included is series of defines which control
+** various aspects of the generated parser.
+**    YYCODETYPE         is the data type used for storing terminal
+**                       and nonterminal numbers.  "unsigned char" is
+**                       used if there are fewer than 250 terminals
+**                       and nonterminals.  "int" is used otherwise.
+**    YYNOCODE           is a number of type YYCODETYPE which corresponds
+**                       to no legal terminal or nonterminal number.  This
+**                       number is used to fill in empty slots of the hash
+**                       table.
+**    YYFALLBACK         If defined, this indicates that one or more tokens
+**                       have fall-back values which should be used if the
+**                       original value of the token will not parse.
+**    YYACTIONTYPE       is the data type used for storing terminal
+**                       and nonterminal numbers.  "unsigned char" is
+**                       used if there are fewer than 250 rules and
+**                       states combined.  "int" is used otherwise.
+**    ParseTOKENTYPE     is the data type used for minor tokens given
+**                       directly to the parser from the tokenizer.
+**    YYMINORTYPE        is the data type used for all minor tokens.
+**                       This is typically a union of many types, one of
+**                       which is ParseTOKENTYPE.  The entry in the union
+**                       for base tokens is called "yy0".
+**    YYSTACKDEPTH       is the maximum depth of the parser's stack.
+**    ParseARG_SDECL     A static variable declaration for the %extra_argument
+**    ParseARG_PDECL     A parameter declaration for the %extra_argument
+**    ParseARG_STORE     Code to store %extra_argument into pparser
+**    ParseARG_FETCH     Code to extract %extra_argument from pparser
+**    YYNSTATE           the combined number of states.
+**    YYNRULE            the number of rules in the grammar
+**    YYERRORSYMBOL      is the code number of the error symbol.  If not
+**                       defined, then do no error processing.
+*/
+#define YYCODETYPE unsigned short int
+#define YYNOCODE 262
+#define YYACTIONTYPE unsigned short int
+#define ParseTOKENTYPE mlr_dsl_ast_node_t*
+typedef union {
+  ParseTOKENTYPE yy0;
+  mlr_dsl_ast_node_t* yy247;
+  int yy523;
+} YYMINORTYPE;
+#define YYSTACKDEPTH 800
+#define ParseARG_SDECL mlr_dsl_ast_t* past;
+#define ParseARG_PDECL ,mlr_dsl_ast_t* past
+#define ParseARG_FETCH mlr_dsl_ast_t* past = pparser->past
+#define ParseARG_STORE pparser->past = past
+#define YYNSTATE 998
+#define YYNRULE 517
+#define YYERRORSYMBOL 119
+#define YYERRSYMDT yy523
+#define YY_NO_ACTION      (YYNSTATE+YYNRULE+2)
+#define YY_ACCEPT_ACTION  (YYNSTATE+YYNRULE+1)
+#define YY_ERROR_ACTION   (YYNSTATE+YYNRULE)
+
+/* Next are that tables used to determine what action to take based on the
+** current state and lookahead token.  These tables are used to implement
+** functions that take a state number and lookahead value and return an
+** action integer.
+**
+** Suppose the action integer is N.  Then the action is determined as
+** follows
+**
+**   0 <= N < YYNSTATE                  Shift N.  That is, push the lookahead
+**                                      token onto the stack and goto state N.
+**
+**   YYNSTATE <= N < YYNSTATE+YYNRULE   Reduce by rule N-YYNSTATE.
+**
+**   N == YYNSTATE+YYNRULE              A syntax error has occurred.
+**
+**   N == YYNSTATE+YYNRULE+1            The parser accepts its input.
+**
+**   N == YYNSTATE+YYNRULE+2            No such action.  Denotes unused
+**                                      slots in the yy_action[] table.
+**
+** The action table is constructed as a single large table named yy_action[].
+** Given state S and lookahead X, the action is computed as
+**
+**      yy_action[ yy_shift_ofst[S] + X ]
+**
+** If the index value yy_shift_ofst[S]+X is out of range or if the value
+** yy_lookahead[yy_shift_ofst[S]+X] is not equal to X or if yy_shift_ofst[S]
+** is equal to YY_SHIFT_USE_DFLT, it means that the action is not in the table
+** and that yy_default[S] should be used instead.
+**
+** The formula above is for computing the action when the lookahead is
+** a terminal symbol.  If the lookahead is a non-terminal (as occurs after
+** a reduce action) then the yy_reduce_ofst[] array is used in place of
+** the yy_shift_ofst[] array and YY_REDUCE_USE_DFLT is used in place of
+** YY_SHIFT_USE_DFLT.
+**
+** The following are the tables generated in this section:
+**
+**  yy_action[]        A single table containing all actions.
+**  yy_lookahead[]     A table containing the lookahead for each entry in
+**                     yy_action.  Used to detect hash collisions.
+**  yy_shift_ofst[]    For each state, the offset into yy_action for
+**                     shifting terminals.
+**  yy_reduce_ofst[]   For each state, the offset into yy_action for
+**                     shifting non-terminals after a reduce.
+**  yy_default[]       Default action for each state.
+*/
+static YYACTIONTYPE yy_action[] = {
+ /*     0 */  1516,    1,    2,    4,    6,    7,    8,    9,   10,   11,
+ /*    10 */    12,   13,   14,  286,  998,  188,  189,  190,  191,  192,
+ /*    20 */   193,  194,  195,  196,  197,  198,  199,  200,  201,  202,
+ /*    30 */   203,  204,  205,  206,  207,  126,  211,  212,  213,  214,
+ /*    40 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*    50 */   225,  226,  227,  228,  229,  230,  231,  232,  233,  234,
+ /*    60 */   235,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /*    70 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  254,
+ /*    80 */   255,  256,  257,  258,  259,   43,   80,   90,  172,  174,
+ /*    90 */     3,  516,   31,   71,  180,  182,  316,  267,  324,  992,
+ /*   100 */   369,  417,  465,  577,  210,   66,   45,   82,   92,  101,
+ /*   110 */   164,  166,  168,   24,  127,  131,   20,   21,   26,   69,
+ /*   120 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /*   130 */    60,   94,  106,  107,  997,    2,    4,    6,    7,    8,
+ /*   140 */     9,   10,   11,   12,   13,   14,  286,   27,  188,  189,
+ /*   150 */   190,  191,  192,  193,  194,  195,  196,  197,  198,  199,
+ /*   160 */   200,  201,  202,  203,  204,  205,  206,  207,  126,  211,
+ /*   170 */   212,  213,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*   180 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /*   190 */   232,  233,  234,  235,  236,  237,  238,  239,  240,  241,
+ /*   200 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /*   210 */   252,  253,  254,  255,  256,  257,  258,  259,   64,   65,
+ /*   220 */    95,   96,   97,   29,  516,  265,  983,  978,  979,  316,
+ /*   230 */    35,  324, 1497,  369,  417,  465,  577,  137,   66,  636,
+ /*   240 */   643,  647,  985,  986,  987,  988,  989,  990,  991,   20,
+ /*   250 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /*   260 */   100,  110,   47,   60,   94,  106,  107,    5,    2,    4,
+ /*   270 */     6,    7,    8,    9,   10,   11,   12,   13,   14,  286,
+ /*   280 */    37,  188,  189,  190,  191,  192,  193,  194,  195,  196,
+ /*   290 */   197,  198,  199,  200,  201,  202,  203,  204,  205,  206,
+ /*   300 */   207,  126,  211,  212,  213,  214,  215,  216,  217,  218,
+ /*   310 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /*   320 */   229,  230,  231,  232,  233,  234,  235,  236,  237,  238,
+ /*   330 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /*   340 */   249,  250,  251,  252,  253,  254,  255,  256,  257,  258,
+ /*   350 */   259,   33,  273,  983,  978,  979,   39,  516, 1506,  114,
+ /*   360 */  1119,  148,  316,   61,  324, 1119,  369,  417,  465,  577,
+ /*   370 */   317,   66,  318,   73,   87,  176,   22,  186, 1119,  983,
+ /*   380 */   981,  979,   20,   21,   26,   69,   70,   86,   99,   75,
+ /*   390 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /*   400 */   268,    2,    4,    6,    7,    8,    9,   10,   11,   12,
+ /*   410 */    13,   14,  286,   68,  188,  189,  190,  191,  192,  193,
+ /*   420 */   194,  195,  196,  197,  198,  199,  200,  201,  202,  203,
+ /*   430 */   204,  205,  206,  207,  126,  211,  212,  213,  214,  215,
+ /*   440 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*   450 */   226,  227,  228,  229,  230,  231,  232,  233,  234,  235,
+ /*   460 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /*   470 */   246,  247,  248,  249,  250,  251,  252,  253,  254,  255,
+ /*   480 */   256,  257,  258,  259,   78,  308,  319,  836,  341,  128,
+ /*   490 */   516,  341,  132,  873,  128,  316,  960,  324,  880,  369,
+ /*   500 */   417,  465,  577,  695,   66,  122,   85,  712,  701,  723,
+ /*   510 */    41,  975,  701,   98,  701,   20,   21,   26,   69,   70,
+ /*   520 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /*   530 */    94,  106,  107,  276,    2,    4,    6,    7,    8,    9,
+ /*   540 */    10,   11,   12,   13,   14,  286,  109,  188,  189,  190,
+ /*   550 */   191,  192,  193,  194,  195,  196,  197,  198,  199,  200,
+ /*   560 */   201,  202,  203,  204,  205,  206,  207,  126,  211,  212,
+ /*   570 */   213,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /*   580 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  232,
+ /*   590 */   233,  234,  235,  236,  237,  238,  239,  240,  241,  242,
+ /*   600 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /*   610 */   253,  254,  255,  256,  257,  258,  259,  728,  846,  746,
+ /*   620 */   763,  774,  701,  516,  752,  752,  752,  112,  316,  114,
+ /*   630 */   324,  779,  369,  417,  465,  577,  752,   66,  120,  125,
+ /*   640 */   913,  875,  132,   85,  128,  942,  952,  128,   20,   21,
+ /*   650 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /*   660 */   110,   47,   60,   94,  106,  107,  280,    2,    4,    6,
+ /*   670 */     7,    8,    9,   10,   11,   12,   13,   14,  286,  130,
+ /*   680 */   188,  189,  190,  191,  192,  193,  194,  195,  196,  197,
+ /*   690 */   198,  199,  200,  201,  202,  203,  204,  205,  206,  207,
+ /*   700 */   126,  211,  212,  213,  214,  215,  216,  217,  218,  219,
+ /*   710 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*   720 */   230,  231,  232,  233,  234,  235,  236,  237,  238,  239,
+ /*   730 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /*   740 */   250,  251,  252,  253,  254,  255,  256,  257,  258,  259,
+ /*   750 */   851,  892,  897,  923,  928,  964,  516,  954,  132,  962,
+ /*   760 */   968,  316,  132,  324, 1095,  369,  417,  465,  577,  980,
+ /*   770 */    66,  134, 1496, 1499,  972,  855,   85,  855,   85,  855,
+ /*   780 */   146,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /*   790 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  284,
+ /*   800 */     2,    4,    6,    7,    8,    9,   10,   11,   12,   13,
+ /*   810 */    14,  286, 1508,  188,  189,  190,  191,  192,  193,  194,
+ /*   820 */   195,  196,  197,  198,  199,  200,  201,  202,  203,  204,
+ /*   830 */   205,  206,  207,  126,  211,  212,  213,  214,  215,  216,
+ /*   840 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*   850 */   227,  228,  229,  230,  231,  232,  233,  234,  235,  236,
+ /*   860 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /*   870 */   247,  248,  249,  250,  251,  252,  253,  254,  255,  256,
+ /*   880 */   257,  258,  259,  151, 1510,  159,  161,  163,  171,  516,
+ /*   890 */   179,  185,  209,  263,  316,  264,  324,  266,  369,  417,
+ /*   900 */   465,  577,  269,   66,  271,  274,  272,  301,  309,  275,
+ /*   910 */   293,  277,  279,  283,   20,   21,   26,   69,   70,   86,
+ /*   920 */    99,   75,   76,   77,   89,  100,  110,   47,   60,   94,
+ /*   930 */   106,  107,  288,    2,    4,    6,    7,    8,    9,   10,
+ /*   940 */    11,   12,   13,   14,  286,  281,  188,  189,  190,  191,
+ /*   950 */   192,  193,  194,  195,  196,  197,  198,  199,  200,  201,
+ /*   960 */   202,  203,  204,  205,  206,  207,  126,  211,  212,  213,
+ /*   970 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*   980 */   224,  225,  226,  227,  228,  229,  230,  231,  232,  233,
+ /*   990 */   234,  235,  236,  237,  238,  239,  240,  241,  242,  243,
+ /*  1000 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /*  1010 */   254,  255,  256,  257,  258,  259,  285,  287,  291,  289,
+ /*  1020 */   296,  294,  516,  298,  302,  300,  304,  316,  306,  324,
+ /*  1030 */   310,  369,  417,  465,  577,  312,   66,  313,  320,  315,
+ /*  1040 */   322,  326,  323,  328,  341,  329,  335,   20,   21,   26,
+ /*  1050 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /*  1060 */    47,   60,   94,  106,  107,  295,    2,    4,    6,    7,
+ /*  1070 */     8,    9,   10,   11,   12,   13,   14,  286,  331,  188,
+ /*  1080 */   189,  190,  191,  192,  193,  194,  195,  196,  197,  198,
+ /*  1090 */   199,  200,  201,  202,  203,  204,  205,  206,  207,  126,
+ /*  1100 */   211,  212,  213,  214,  215,  216,  217,  218,  219,  220,
+ /*  1110 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /*  1120 */   231,  232,  233,  234,  235,  236,  237,  238,  239,  240,
+ /*  1130 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /*  1140 */   251,  252,  253,  254,  255,  256,  257,  258,  259,  336,
+ /*  1150 */   343,  344,  348,  347,  351,  516,  352,  355,  356,  359,
+ /*  1160 */   316,  360,  324,  363,  369,  417,  465,  577,  364,   66,
+ /*  1170 */   513,  511,  514,  565,  572,  626,  638,  639,  645,  646,
+ /*  1180 */    20,   21,   26,   69,   70,   86,   99,   75,   76,   77,
+ /*  1190 */    89,  100,  110,   47,   60,   94,  106,  107,  299,    2,
+ /*  1200 */     4,    6,    7,    8,    9,   10,   11,   12,   13,   14,
+ /*  1210 */   286,  649,  188,  189,  190,  191,  192,  193,  194,  195,
+ /*  1220 */   196,  197,  198,  199,  200,  201,  202,  203,  204,  205,
+ /*  1230 */   206,  207,  126,  211,  212,  213,  214,  215,  216,  217,
+ /*  1240 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  1250 */   228,  229,  230,  231,  232,  233,  234,  235,  236,  237,
+ /*  1260 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /*  1270 */   248,  249,  250,  251,  252,  253,  254,  255,  256,  257,
+ /*  1280 */   258,  259,  650,  653,  662,  666,  670,  674,  516,  676,
+ /*  1290 */   681,  683,  696,  316,  698,  324,  706,  369,  417,  465,
+ /*  1300 */   577,  708,   66,  713,  717,  719,  724,  729,  733,  735,
+ /*  1310 */   740,  742,  747,   20,   21,   26,   69,   70,   86,   99,
+ /*  1320 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /*  1330 */   107,  314,    2,    4,    6,    7,    8,    9,   10,   11,
+ /*  1340 */    12,   13,   14,  286,  749,  188,  189,  190,  191,  192,
+ /*  1350 */   193,  194,  195,  196,  197,  198,  199,  200,  201,  202,
+ /*  1360 */   203,  204,  205,  206,  207,  126,  211,  212,  213,  214,
+ /*  1370 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*  1380 */   225,  226,  227,  228,  229,  230,  231,  232,  233,  234,
+ /*  1390 */   235,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /*  1400 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  254,
+ /*  1410 */   255,  256,  257,  258,  259,  757,  759,  764,  768,  770,
+ /*  1420 */   775,  516,  780,  805,  809,  813,  316,  821,  324,  825,
+ /*  1430 */   369,  417,  465,  577,  829,   66,  835,  837,  841,  839,
+ /*  1440 */   842,  859,  844,  847,  864,  849,   20,   21,   26,   69,
+ /*  1450 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /*  1460 */    60,   94,  106,  107,  834,    2,    4,    6,    7,    8,
+ /*  1470 */     9,   10,   11,   12,   13,   14,  286,  852,  188,  189,
+ /*  1480 */   190,  191,  192,  193,  194,  195,  196,  197,  198,  199,
+ /*  1490 */   200,  201,  202,  203,  204,  205,  206,  207,  126,  211,
+ /*  1500 */   212,  213,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*  1510 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /*  1520 */   232,  233,  234,  235,  236,  237,  238,  239,  240,  241,
+ /*  1530 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /*  1540 */   252,  253,  254,  255,  256,  257,  258,  259,  854,  857,
+ /*  1550 */   860,  882,  862,  865,  516,  867,  871,  873,  875,  316,
+ /*  1560 */   877,  324,  879,  369,  417,  465,  577,  883,   66,  885,
+ /*  1570 */   887,  890,  888,  893,  902,  895,  898,  907,  900,   20,
+ /*  1580 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /*  1590 */   100,  110,   47,   60,   94,  106,  107,  330,    2,    4,
+ /*  1600 */     6,    7,    8,    9,   10,   11,   12,   13,   14,  286,
+ /*  1610 */   903,  188,  189,  190,  191,  192,  193,  194,  195,  196,
+ /*  1620 */   197,  198,  199,  200,  201,  202,  203,  204,  205,  206,
+ /*  1630 */   207,  126,  211,  212,  213,  214,  215,  216,  217,  218,
+ /*  1640 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /*  1650 */   229,  230,  231,  232,  233,  234,  235,  236,  237,  238,
+ /*  1660 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /*  1670 */   249,  250,  251,  252,  253,  254,  255,  256,  257,  258,
+ /*  1680 */   259,  905,  908,  914,  910,  916,  915,  516,  918,  921,
+ /*  1690 */   919,  924,  316,  926,  324,  929,  369,  417,  465,  577,
+ /*  1700 */   931,   66,  933,  936,  934,  938,  941,  939,  943,  950,
+ /*  1710 */   956,  958,   20,   21,   26,   69,   70,   86,   99,   75,
+ /*  1720 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /*  1730 */   838,    2,    4,    6,    7,    8,    9,   10,   11,   12,
+ /*  1740 */    13,   14,  286, 1482,  188,  189,  190,  191,  192,  193,
+ /*  1750 */   194,  195,  196,  197,  198,  199,  200,  201,  202,  203,
+ /*  1760 */   204,  205,  206,  207,  126,  211,  212,  213,  214,  215,
+ /*  1770 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*  1780 */   226,  227,  228,  229,  230,  231,  232,  233,  234,  235,
+ /*  1790 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /*  1800 */   246,  247,  248,  249,  250,  251,  252,  253,  254,  255,
+ /*  1810 */   256,  257,  258,  259,  965, 1094,  967, 1097,  984,  993,
+ /*  1820 */   516,  996,  994,  780,  780,  316,  780,  324,  780,  369,
+ /*  1830 */   417,  465,  577,  780,   66,  780,  780,  780,  780,  780,
+ /*  1840 */   780,  780,  780,  780,  780,   20,   21,   26,   69,   70,
+ /*  1850 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /*  1860 */    94,  106,  107,  843,    2,    4,    6,    7,    8,    9,
+ /*  1870 */    10,   11,   12,   13,   14,  286,  780,  188,  189,  190,
+ /*  1880 */   191,  192,  193,  194,  195,  196,  197,  198,  199,  200,
+ /*  1890 */   201,  202,  203,  204,  205,  206,  207,  126,  211,  212,
+ /*  1900 */   213,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /*  1910 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  232,
+ /*  1920 */   233,  234,  235,  236,  237,  238,  239,  240,  241,  242,
+ /*  1930 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /*  1940 */   253,  254,  255,  256,  257,  258,  259,  780,  780,  780,
+ /*  1950 */   780,  780,  780,  516,  780,  780,  780,  780,  316,  780,
+ /*  1960 */   324,  780,  369,  417,  465,  577,  780,   66,  780,  780,
+ /*  1970 */   780,  780,  780,  780,  780,  780,  780,  780,   20,   21,
+ /*  1980 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /*  1990 */   110,   47,   60,   94,  106,  107,  848,    2,    4,    6,
+ /*  2000 */     7,    8,    9,   10,   11,   12,   13,   14,  286,  780,
+ /*  2010 */   188,  189,  190,  191,  192,  193,  194,  195,  196,  197,
+ /*  2020 */   198,  199,  200,  201,  202,  203,  204,  205,  206,  207,
+ /*  2030 */   126,  211,  212,  213,  214,  215,  216,  217,  218,  219,
+ /*  2040 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  2050 */   230,  231,  232,  233,  234,  235,  236,  237,  238,  239,
+ /*  2060 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /*  2070 */   250,  251,  252,  253,  254,  255,  256,  257,  258,  259,
+ /*  2080 */   780,  780,  780,  780,  780,  780,  516,  780,  780,  780,
+ /*  2090 */   780,  316,  780,  324,  780,  369,  417,  465,  577,  780,
+ /*  2100 */    66,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  2110 */   780,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /*  2120 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  853,
+ /*  2130 */     2,    4,    6,    7,    8,    9,   10,   11,   12,   13,
+ /*  2140 */    14,  286,  780,  188,  189,  190,  191,  192,  193,  194,
+ /*  2150 */   195,  196,  197,  198,  199,  200,  201,  202,  203,  204,
+ /*  2160 */   205,  206,  207,  126,  211,  212,  213,  214,  215,  216,
+ /*  2170 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*  2180 */   227,  228,  229,  230,  231,  232,  233,  234,  235,  236,
+ /*  2190 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /*  2200 */   247,  248,  249,  250,  251,  252,  253,  254,  255,  256,
+ /*  2210 */   257,  258,  259,  780,  780,  780,  780,  780,  780,  516,
+ /*  2220 */   780,  780,  780,  780,  316,  780,  324,  780,  369,  417,
+ /*  2230 */   465,  577,  780,   66,  780,  780,  780,  780,  780,  780,
+ /*  2240 */   780,  780,  780,  780,   20,   21,   26,   69,   70,   86,
+ /*  2250 */    99,   75,   76,   77,   89,  100,  110,   47,   60,   94,
+ /*  2260 */   106,  107,  861,    2,    4,    6,    7,    8,    9,   10,
+ /*  2270 */    11,   12,   13,   14,  286,  780,  188,  189,  190,  191,
+ /*  2280 */   192,  193,  194,  195,  196,  197,  198,  199,  200,  201,
+ /*  2290 */   202,  203,  204,  205,  206,  207,  126,  211,  212,  213,
+ /*  2300 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*  2310 */   224,  225,  226,  227,  228,  229,  230,  231,  232,  233,
+ /*  2320 */   234,  235,  236,  237,  238,  239,  240,  241,  242,  243,
+ /*  2330 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /*  2340 */   254,  255,  256,  257,  258,  259,  780,  780,  780,  780,
+ /*  2350 */   780,  780,  516,  780,  780,  780,  780,  316,  780,  324,
+ /*  2360 */   780,  369,  417,  465,  577,  780,   66,  780,  780,  780,
+ /*  2370 */   780,  780,  780,  780,  780,  780,  780,   20,   21,   26,
+ /*  2380 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /*  2390 */    47,   60,   94,  106,  107,  866,    2,    4,    6,    7,
+ /*  2400 */     8,    9,   10,   11,   12,   13,   14,  286,  780,  188,
+ /*  2410 */   189,  190,  191,  192,  193,  194,  195,  196,  197,  198,
+ /*  2420 */   199,  200,  201,  202,  203,  204,  205,  206,  207,  126,
+ /*  2430 */   211,  212,  213,  214,  215,  216,  217,  218,  219,  220,
+ /*  2440 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /*  2450 */   231,  232,  233,  234,  235,  236,  237,  238,  239,  240,
+ /*  2460 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /*  2470 */   251,  252,  253,  254,  255,  256,  257,  258,  259,  780,
+ /*  2480 */   780,  780,  780,  780,  780,  516,  780,  780,  780,  780,
+ /*  2490 */   316,  780,  324,  780,  369,  417,  465,  577,  780,   66,
+ /*  2500 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  2510 */    20,   21,   26,   69,   70,   86,   99,   75,   76,   77,
+ /*  2520 */    89,  100,  110,   47,   60,   94,  106,  107,  884,    2,
+ /*  2530 */     4,    6,    7,    8,    9,   10,   11,   12,   13,   14,
+ /*  2540 */   286,  780,  188,  189,  190,  191,  192,  193,  194,  195,
+ /*  2550 */   196,  197,  198,  199,  200,  201,  202,  203,  204,  205,
+ /*  2560 */   206,  207,  126,  211,  212,  213,  214,  215,  216,  217,
+ /*  2570 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  2580 */   228,  229,  230,  231,  232,  233,  234,  235,  236,  237,
+ /*  2590 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /*  2600 */   248,  249,  250,  251,  252,  253,  254,  255,  256,  257,
+ /*  2610 */   258,  259,  780,  780,  780,  780,  780,  780,  516,  780,
+ /*  2620 */   780,  780,  780,  316,  780,  324,  780,  369,  417,  465,
+ /*  2630 */   577,  780,   66,  780,  780,  780,  780,  780,  780,  780,
+ /*  2640 */   780,  780,  780,   20,   21,   26,   69,   70,   86,   99,
+ /*  2650 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /*  2660 */   107,  889,    2,    4,    6,    7,    8,    9,   10,   11,
+ /*  2670 */    12,   13,   14,  286,  780,  188,  189,  190,  191,  192,
+ /*  2680 */   193,  194,  195,  196,  197,  198,  199,  200,  201,  202,
+ /*  2690 */   203,  204,  205,  206,  207,  126,  211,  212,  213,  214,
+ /*  2700 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*  2710 */   225,  226,  227,  228,  229,  230,  231,  232,  233,  234,
+ /*  2720 */   235,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /*  2730 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  254,
+ /*  2740 */   255,  256,  257,  258,  259,  780,  780,  780,  780,  780,
+ /*  2750 */   780,  516,  780,  780,  780,  780,  316,  780,  324,  780,
+ /*  2760 */   369,  417,  465,  577,  780,   66,  780,  780,  780,  780,
+ /*  2770 */   780,  780,  780,  780,  780,  780,   20,   21,   26,   69,
+ /*  2780 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /*  2790 */    60,   94,  106,  107,  894,    2,    4,    6,    7,    8,
+ /*  2800 */     9,   10,   11,   12,   13,   14,  286,  780,  188,  189,
+ /*  2810 */   190,  191,  192,  193,  194,  195,  196,  197,  198,  199,
+ /*  2820 */   200,  201,  202,  203,  204,  205,  206,  207,  126,  211,
+ /*  2830 */   212,  213,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*  2840 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /*  2850 */   232,  233,  234,  235,  236,  237,  238,  239,  240,  241,
+ /*  2860 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /*  2870 */   252,  253,  254,  255,  256,  257,  258,  259,  780,  780,
+ /*  2880 */   780,  780,  780,  780,  516,  780,  780,  780,  780,  316,
+ /*  2890 */   780,  324,  780,  369,  417,  465,  577,  780,   66,  780,
+ /*  2900 */   780,  780,  780,  780,  780,  780,  780,  780,  780,   20,
+ /*  2910 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /*  2920 */   100,  110,   47,   60,   94,  106,  107,  899,    2,    4,
+ /*  2930 */     6,    7,    8,    9,   10,   11,   12,   13,   14,  286,
+ /*  2940 */   780,  188,  189,  190,  191,  192,  193,  194,  195,  196,
+ /*  2950 */   197,  198,  199,  200,  201,  202,  203,  204,  205,  206,
+ /*  2960 */   207,  126,  211,  212,  213,  214,  215,  216,  217,  218,
+ /*  2970 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /*  2980 */   229,  230,  231,  232,  233,  234,  235,  236,  237,  238,
+ /*  2990 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /*  3000 */   249,  250,  251,  252,  253,  254,  255,  256,  257,  258,
+ /*  3010 */   259,  780,  780,  780,  780,  780,  780,  516,  780,  780,
+ /*  3020 */   780,  780,  316,  780,  324,  780,  369,  417,  465,  577,
+ /*  3030 */   780,   66,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  3040 */   780,  780,   20,   21,   26,   69,   70,   86,   99,   75,
+ /*  3050 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /*  3060 */   904,    2,    4,    6,    7,    8,    9,   10,   11,   12,
+ /*  3070 */    13,   14,  286,  780,  188,  189,  190,  191,  192,  193,
+ /*  3080 */   194,  195,  196,  197,  198,  199,  200,  201,  202,  203,
+ /*  3090 */   204,  205,  206,  207,  126,  211,  212,  213,  214,  215,
+ /*  3100 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*  3110 */   226,  227,  228,  229,  230,  231,  232,  233,  234,  235,
+ /*  3120 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /*  3130 */   246,  247,  248,  249,  250,  251,  252,  253,  254,  255,
+ /*  3140 */   256,  257,  258,  259,  780,  780,  780,  780,  780,  780,
+ /*  3150 */   516,  780,  780,  780,  780,  316,  780,  324,  780,  369,
+ /*  3160 */   417,  465,  577,  780,   66,  780,  780,  780,  780,  780,
+ /*  3170 */   780,  780,  780,  780,  780,   20,   21,   26,   69,   70,
+ /*  3180 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /*  3190 */    94,  106,  107,  909,    2,    4,    6,    7,    8,    9,
+ /*  3200 */    10,   11,   12,   13,   14,  286,  780,  188,  189,  190,
+ /*  3210 */   191,  192,  193,  194,  195,  196,  197,  198,  199,  200,
+ /*  3220 */   201,  202,  203,  204,  205,  206,  207,  126,  211,  212,
+ /*  3230 */   213,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /*  3240 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  232,
+ /*  3250 */   233,  234,  235,  236,  237,  238,  239,  240,  241,  242,
+ /*  3260 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /*  3270 */   253,  254,  255,  256,  257,  258,  259,  780,  780,  780,
+ /*  3280 */   780,  780,  780,  516,  780,  780,  780,  780,  316,  780,
+ /*  3290 */   324,  780,  369,  417,  465,  577,  780,   66,  780,  780,
+ /*  3300 */   780,  780,  780,  780,  780,  780,  780,  780,   20,   21,
+ /*  3310 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /*  3320 */   110,   47,   60,   94,  106,  107,  920,    2,    4,    6,
+ /*  3330 */     7,    8,    9,   10,   11,   12,   13,   14,  286,  780,
+ /*  3340 */   188,  189,  190,  191,  192,  193,  194,  195,  196,  197,
+ /*  3350 */   198,  199,  200,  201,  202,  203,  204,  205,  206,  207,
+ /*  3360 */   126,  211,  212,  213,  214,  215,  216,  217,  218,  219,
+ /*  3370 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  3380 */   230,  231,  232,  233,  234,  235,  236,  237,  238,  239,
+ /*  3390 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /*  3400 */   250,  251,  252,  253,  254,  255,  256,  257,  258,  259,
+ /*  3410 */   780,  780,  780,  780,  780,  780,  516,  780,  780,  780,
+ /*  3420 */   780,  316,  780,  324,  780,  369,  417,  465,  577,  780,
+ /*  3430 */    66,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  3440 */   780,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /*  3450 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  925,
+ /*  3460 */     2,    4,    6,    7,    8,    9,   10,   11,   12,   13,
+ /*  3470 */    14,  286,  780,  188,  189,  190,  191,  192,  193,  194,
+ /*  3480 */   195,  196,  197,  198,  199,  200,  201,  202,  203,  204,
+ /*  3490 */   205,  206,  207,  126,  211,  212,  213,  214,  215,  216,
+ /*  3500 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*  3510 */   227,  228,  229,  230,  231,  232,  233,  234,  235,  236,
+ /*  3520 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /*  3530 */   247,  248,  249,  250,  251,  252,  253,  254,  255,  256,
+ /*  3540 */   257,  258,  259,  780,  780,  780,  780,  780,  780,  516,
+ /*  3550 */   780,  780,  780,  780,  316,  780,  324,  780,  369,  417,
+ /*  3560 */   465,  577,  780,   66,  780,  780,  780,  780,  780,  780,
+ /*  3570 */   780,  780,  780,  780,   20,   21,   26,   69,   70,   86,
+ /*  3580 */    99,   75,   76,   77,   89,  100,  110,   47,   60,   94,
+ /*  3590 */   106,  107,  930,    2,    4,    6,    7,    8,    9,   10,
+ /*  3600 */    11,   12,   13,   14,  286,  780,  188,  189,  190,  191,
+ /*  3610 */   192,  193,  194,  195,  196,  197,  198,  199,  200,  201,
+ /*  3620 */   202,  203,  204,  205,  206,  207,  126,  211,  212,  213,
+ /*  3630 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*  3640 */   224,  225,  226,  227,  228,  229,  230,  231,  232,  233,
+ /*  3650 */   234,  235,  236,  237,  238,  239,  240,  241,  242,  243,
+ /*  3660 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /*  3670 */   254,  255,  256,  257,  258,  259,  780,  780,  780,  780,
+ /*  3680 */   780,  780,  516,  780,  780,  780,  780,  316,  780,  324,
+ /*  3690 */   780,  369,  417,  465,  577,  780,   66,  780,  780,  780,
+ /*  3700 */   780,  780,  780,  780,  780,  780,  780,   20,   21,   26,
+ /*  3710 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /*  3720 */    47,   60,   94,  106,  107,  935,    2,    4,    6,    7,
+ /*  3730 */     8,    9,   10,   11,   12,   13,   14,  286,  780,  188,
+ /*  3740 */   189,  190,  191,  192,  193,  194,  195,  196,  197,  198,
+ /*  3750 */   199,  200,  201,  202,  203,  204,  205,  206,  207,  126,
+ /*  3760 */   211,  212,  213,  214,  215,  216,  217,  218,  219,  220,
+ /*  3770 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /*  3780 */   231,  232,  233,  234,  235,  236,  237,  238,  239,  240,
+ /*  3790 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /*  3800 */   251,  252,  253,  254,  255,  256,  257,  258,  259,  780,
+ /*  3810 */   780,  780,  780,  780,  780,  516,  780,  780,  780,  780,
+ /*  3820 */   316,  780,  324,  780,  369,  417,  465,  577,  780,   66,
+ /*  3830 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  3840 */    20,   21,   26,   69,   70,   86,   99,   75,   76,   77,
+ /*  3850 */    89,  100,  110,   47,   60,   94,  106,  107,  940,    2,
+ /*  3860 */     4,    6,    7,    8,    9,   10,   11,   12,   13,   14,
+ /*  3870 */   286,  780,  188,  189,  190,  191,  192,  193,  194,  195,
+ /*  3880 */   196,  197,  198,  199,  200,  201,  202,  203,  204,  205,
+ /*  3890 */   206,  207,  126,  211,  212,  213,  214,  215,  216,  217,
+ /*  3900 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  3910 */   228,  229,  230,  231,  232,  233,  234,  235,  236,  237,
+ /*  3920 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /*  3930 */   248,  249,  250,  251,  252,  253,  254,  255,  256,  257,
+ /*  3940 */   258,  259,  780,  780,  780,  780,  780,  780,  516,  780,
+ /*  3950 */   780,  780,  780,  316,  780,  324,  780,  369,  417,  465,
+ /*  3960 */   577,  780,   66,  780,  780,  780,  780,  780,  780,  780,
+ /*  3970 */   780,  780,  780,   20,   21,   26,   69,   70,   86,   99,
+ /*  3980 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /*  3990 */   107,  966,    2,    4,    6,    7,    8,    9,   10,   11,
+ /*  4000 */    12,   13,   14,  286,  780,  188,  189,  190,  191,  192,
+ /*  4010 */   193,  194,  195,  196,  197,  198,  199,  200,  201,  202,
+ /*  4020 */   203,  204,  205,  206,  207,  126,  211,  212,  213,  214,
+ /*  4030 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*  4040 */   225,  226,  227,  228,  229,  230,  231,  232,  233,  234,
+ /*  4050 */   235,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /*  4060 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  254,
+ /*  4070 */   255,  256,  257,  258,  259,  780,  780,  780,  780,  780,
+ /*  4080 */   780,  516,  780,  780,  780,  780,  316,  780,  324,  780,
+ /*  4090 */   369,  417,  465,  577,  780,   66,  780,  780,  780,  780,
+ /*  4100 */   780,  780,  780,  780,  780,  780,   20,   21,   26,   69,
+ /*  4110 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /*  4120 */    60,   94,  106,  107,  995,    2,    4,    6,    7,    8,
+ /*  4130 */     9,   10,   11,   12,   13,   14,  286,  780,  188,  189,
+ /*  4140 */   190,  191,  192,  193,  194,  195,  196,  197,  198,  199,
+ /*  4150 */   200,  201,  202,  203,  204,  205,  206,  207,  126,  211,
+ /*  4160 */   212,  213,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*  4170 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /*  4180 */   232,  233,  234,  235,  236,  237,  238,  239,  240,  241,
+ /*  4190 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /*  4200 */   252,  253,  254,  255,  256,  257,  258,  259,  780,  780,
+ /*  4210 */   780,  780,  780,  780,  516,  780,  780,  780,  628,  316,
+ /*  4220 */   780,  324,  780,  369,  417,  465,  577,  780,   66,  627,
+ /*  4230 */   780,  780,  780,  780,  780,  780,  780,  780,  780,   20,
+ /*  4240 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /*  4250 */   100,  110,   47,   60,   94,  106,  107,  977,   94,    6,
+ /*  4260 */     7,    8,    9,   10,   11,   12,   13,   14,  970,  982,
+ /*  4270 */   780, 1093,  780,  780,  780,  869,  780,  985,  986,  987,
+ /*  4280 */   988,  989,  990,  991,  870,  872,  874,  876,  878,  780,
+ /*  4290 */   126,  211,  212,  213,  214,  215,  216,  217,  218,  219,
+ /*  4300 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  4310 */   230,  231,  232,  233,  234,  235,  236,  237,  238,  239,
+ /*  4320 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /*  4330 */   250,  251,  252,  253,  254,  255,  256,  257,  258,  259,
+ /*  4340 */   780,  780,  780,  780,  307,  780,  516,  780,  959,  780,
+ /*  4350 */   780,  780,  780,  780,  780,  369,  417,  465,  577,  780,
+ /*  4360 */    66,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  4370 */   780,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /*  4380 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  974,
+ /*  4390 */   780,    6,    7,    8,    9,   10,   11,   12,   13,   14,
+ /*  4400 */   970,  982,  780, 1096,  780,  780,  780,  780,  780,  985,
+ /*  4410 */   986,  987,  988,  989,  990,  991,  780,  780,  780,  780,
+ /*  4420 */   780,  780,  126,  211,  212,  213,  214,  215,  216,  217,
+ /*  4430 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  4440 */   228,  229,  230,  231,  232,  233,  234,  235,  236,  237,
+ /*  4450 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /*  4460 */   248,  249,  250,  251,  252,  253,  254,  255,  256,  257,
+ /*  4470 */   258,  259,  780,  780,  780,  780,  780,  780,  516,  780,
+ /*  4480 */   780,  961, 1183, 1183,  780,  780,  780,  369,  417,  465,
+ /*  4490 */   577,  780,   66, 1183,  780, 1183,  780,  780, 1183,  780,
+ /*  4500 */   780,  780,  780,   20,   21,   26,   69,   70,   86,   99,
+ /*  4510 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /*  4520 */   107,  971,  780,    6,    7,    8,    9,   10,   11,   12,
+ /*  4530 */    13,   14,  970, 1377, 1377,  780,  780,  780,  780,  780,
+ /*  4540 */   780,  780,  780,  780, 1377,  780, 1377,  780,  780, 1377,
+ /*  4550 */   780,  780,  780,  780,  126,  211,  212,  213,  214,  215,
+ /*  4560 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*  4570 */   226,  227,  228,  229,  230,  231,  232,  233,  234,  235,
+ /*  4580 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /*  4590 */   246,  247,  248,  249,  250,  251,  252,  253,  254,  255,
+ /*  4600 */   256,  257,  258,  259,  780,  780,  780,  780,  780,  780,
+ /*  4610 */   516,  780,  780,  780,  963,  780,  780,  780,  780,  369,
+ /*  4620 */   417,  465,  577,  780,   66,  780,  780,  780,  780,  780,
+ /*  4630 */   780,  780,  780,  780,  780,   20,   21,   26,   69,   70,
+ /*  4640 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /*  4650 */    94,  106,  107,  969,  780,    6,    7,    8,    9,   10,
+ /*  4660 */    11,   12,   13,   14,  970,  780,  780,  780,  780,  780,
+ /*  4670 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  4680 */   780,  780,  780,  780,  780,  780,  126,  211,  212,  213,
+ /*  4690 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*  4700 */   224,  225,  226,  227,  228,  229,  230,  231,  232,  233,
+ /*  4710 */   234,  235,  236,  237,  238,  239,  240,  241,  242,  243,
+ /*  4720 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /*  4730 */   254,  255,  256,  257,  258,  259,  780,  780,  780,  780,
+ /*  4740 */   780,  780,  516,  780,  780,  780,  780,  780,  780,  780,
+ /*  4750 */   780,  369,  417,  465,  577,  780,   66,  780,  780,  780,
+ /*  4760 */   780,  780,  780,  780,  780,  780,  780,   20,   21,   26,
+ /*  4770 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /*  4780 */    47,   60,   94,  106,  107,  973,  780,    6,    7,    8,
+ /*  4790 */     9,   10,   11,   12,   13,   14,  970,  780,  780,  780,
+ /*  4800 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  4810 */   780,  780,  780,  780,  780,  780,  780,  780,  126,  211,
+ /*  4820 */   212,  213,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*  4830 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /*  4840 */   232,  233,  234,  235,  236,  237,  238,  239,  240,  241,
+ /*  4850 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /*  4860 */   252,  253,  254,  255,  256,  257,  258,  259,  780,  780,
+ /*  4870 */   780,  780,  780,  780,  516,  780,  780,  780,  780,  780,
+ /*  4880 */   780,  780,  780,  369,  417,  465,  577,  780,   66,  780,
+ /*  4890 */   780,  780,  780,  780,  780,  780,  780,  780,  780,   20,
+ /*  4900 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /*  4910 */   100,  110,   47,   60,   94,  106,  107,  976,  780,    6,
+ /*  4920 */     7,    8,    9,   10,   11,   12,   13,   14,  970,  780,
+ /*  4930 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  4940 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  4950 */   126,  211,  212,  213,  214,  215,  216,  217,  218,  219,
+ /*  4960 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  4970 */   230,  231,  232,  233,  234,  235,  236,  237,  238,  239,
+ /*  4980 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /*  4990 */   250,  251,  252,  253,  254,  255,  256,  257,  258,  259,
+ /*  5000 */   944,  123,  780,  780,  780,  780,  516,  780,  780,  870,
+ /*  5010 */   945,  946,  947,  878,  780,  369,  417,  465,  577,  780,
+ /*  5020 */    66,  780,  780,  780,  780,  341,   67,  780,  780,  780,
+ /*  5030 */   780,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /*  5040 */    77,   89,  100,  110,   47,   60,   94,  106,  107, 1003,
+ /*  5050 */    15,  571,  564,  208,  260,  261,  262,  113,  123,  780,
+ /*  5060 */   780,  780,  780,  270,  780,  334,  342,  346,  350,  358,
+ /*  5070 */   354,  362,  278,  282,  290,  297,  305,  780,  325,  780,
+ /*  5080 */   780,  332,  780,  510,   48,   50,   52,   54,  780,  780,
+ /*  5090 */   780,  780,  780,  780,  780,  780,   56,   58,  780,   64,
+ /*  5100 */    65,   95,   96,   97,  103,  104,  105,  116,  117,  119,
+ /*  5110 */   622,  780,  635,  780,  780,  780,  651,  672,  731,  782,
+ /*  5120 */   799,  801,  815,  817,  832,  780,   95,   96,   97,  780,
+ /*  5130 */   780,  780,  780,  780,  780,  780,  632,  780,  780,  780,
+ /*  5140 */   780,   48,   50,   52,   54,  633,  634,  629,  780,  625,
+ /*  5150 */   630,  780,  780,   56,   58,  780,   64,   65,   95,   96,
+ /*  5160 */    97,  103,  104,  105,  116,  117,  119,   15,  571,  564,
+ /*  5170 */   208,  260,  261,  262,  113,  123,   94,  780,  780,  780,
+ /*  5180 */   270,  780,  334,  342,  346,  350,  358,  354,  362,  278,
+ /*  5190 */   282,  290,  297,  305,  341,  325,  780,  370,  332,  109,
+ /*  5200 */   510,  375,  377,  379,  381,  383,  385,  387,  389,  391,
+ /*  5210 */   393,  395,  397,  399,  401,  407,  409,  411,  413,  415,
+ /*  5220 */   403,  405,  780,  780,  780,  780,  780,  622,  780,  635,
+ /*  5230 */   780,  780,  780,  651,  672,  731,  782,  799,  801,  815,
+ /*  5240 */   817,  832,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  5250 */   660,  664,  668,  657,  780,  780,  780,  780,   48,   50,
+ /*  5260 */    52,   54,  658,  659,  780,  780,  780,  780,  780,  652,
+ /*  5270 */    56,   58,  780,   64,   65,   95,   96,   97,  103,  104,
+ /*  5280 */   105,  116,  117,  119,   15,  571,  564,  208,  260,  261,
+ /*  5290 */   780,  944,  911,   94,  780,   95,   96,   97,  780,  334,
+ /*  5300 */   949,  951,  953,  955,  957,  362,  780,  780,  780,  297,
+ /*  5310 */   780,  780,  780,  780,  418,  332,  112,  510,  423,  425,
+ /*  5320 */   427,  429,  431,  433,  435,  437,  439,  441,  443,  445,
+ /*  5330 */   447,  449,  455,  457,  459,  461,  463,  451,  453,  780,
+ /*  5340 */   780,  780,  780,  780,  622,  780,  635,  780,  780,  780,
+ /*  5350 */   651,  672,  731,  782,  799,  801,  815,  817,  832,  780,
+ /*  5360 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  5370 */   657,  780,  780,  654,  780,   48,   50,   52,   54,  658,
+ /*  5380 */   659,  780,  655,  656,  780,  780,  663,   56,   58,  126,
+ /*  5390 */    64,   65,   95,   96,   97,  103,  104,  105,  116,  117,
+ /*  5400 */   119,   15,  571,  564,  208,  260,  261,  780,  113,  123,
+ /*  5410 */    94,  780,  691,   94,  780,  780,  334,  342,  346,  350,
+ /*  5420 */   358,  354,  362,  780,  780,  780,  297,  780,  780,  780,
+ /*  5430 */   690,  686,  332,  692,  510,  780,  113,  693,  780,  143,
+ /*  5440 */   780,  780,  780,  139,  142,   84,  127,  131,  780,  780,
+ /*  5450 */   780,  780,  780,  780,  108,  111,   63,  118,  780,   66,
+ /*  5460 */   780,  622,  780,  635,  780,  126,  780,  651,  672,  731,
+ /*  5470 */   782,  799,  801,  815,  817,  832,   34,   75,   76,   77,
+ /*  5480 */    89,  100,  110,   47,   60,   94,  106,  107,  780,  687,
+ /*  5490 */   685,  780,   48,   50,   52,   54,  780,  780,  688,  689,
+ /*  5500 */   780,  780,  780,  780,   56,   58,  673,   64,   65,   95,
+ /*  5510 */    96,   97,  103,  104,  105,  116,  117,  119,  780,  780,
+ /*  5520 */   780,   84,  139,  142,  780,  780,  780,  780,  780,   94,
+ /*  5530 */   108,  111,   63,  118,  780,   66,  780,   95,   96,   97,
+ /*  5540 */   780,  780,  780,  780,  126,  780,   20,   21,   26,   69,
+ /*  5550 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /*  5560 */    60,   94,  106,  107,  158,  135,  136,  657,  139,  142,
+ /*  5570 */   780,  780,  780,  780,  780,  780,  658,  659,  780,  780,
+ /*  5580 */   780,  780,  657,  667,  780,  780,  780,  780,  780,  780,
+ /*  5590 */   126,  658,  659,  780,  780,  780,  780,  780,  671,  780,
+ /*  5600 */    84,  780,  780,  780,  780,  780,  780,   94,  780,  108,
+ /*  5610 */   111,   63,  118,  780,   66,  780,  780,  780,  780,  780,
+ /*  5620 */   780,  780,   94,  780,  780,   20,   21,   26,   69,   70,
+ /*  5630 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /*  5640 */    94,  106,  107,  129,  135,  136,   84,  780,  780,  780,
+ /*  5650 */   780,  780,  780,  780,  780,  108,  111,   63,  118,  780,
+ /*  5660 */    66,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  5670 */   780,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /*  5680 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  133,
+ /*  5690 */   135,  136,  788,  787,  780,  780,  780,  780,  113,  123,
+ /*  5700 */   780,  143,  780,  780,  780,  690,  686,  780,  127,  131,
+ /*  5710 */   115,  113,  726,  780,  143,  780,  780,  780,  780,  780,
+ /*  5720 */   780,  127,  131,  780,   67,  780,  780,  780,  788,  787,
+ /*  5730 */   780,  780,  780,  780,  113,  123,  780,  143,  780,  780,
+ /*  5740 */   780,  780,  780,  780,  127,  131,  115,  780,  780,  780,
+ /*  5750 */   780,  780,  786,  780,  783,  791,  794,  780,  780,  780,
+ /*  5760 */    67,  780,  780,  780,  780,  685,  780,  679,  704,  715,
+ /*  5770 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  5780 */   780,  780,   48,   50,   52,   54,  780,  780,  786,  780,
+ /*  5790 */   803,  807,  811,  780,   56,   58,  780,   64,   65,   95,
+ /*  5800 */    96,   97,  103,  104,  105,  116,  117,  119,  780,  780,
+ /*  5810 */   139,  142,   95,   96,   97,  780,  780,  780,   48,   50,
+ /*  5820 */    52,   54,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  5830 */    56,   58,  126,   64,   65,   95,   96,   97,  103,  104,
+ /*  5840 */   105,  116,  117,  119,  788,  787,  780,  780,  780,  780,
+ /*  5850 */   113,  123,  780,  143,  780,  780,  780,  311,  840,  780,
+ /*  5860 */   127,  131,  115,  113,  780,  780,  143,  780,  780,  780,
+ /*  5870 */   780,  780,  780,  127,  131,  780,   67,  881,  886,  780,
+ /*  5880 */   780,  780,  780,  113,  780,  780,  143,  780,   84,  157,
+ /*  5890 */   780,  780,  780,  127,  131,  780,  780,  108,  111,   63,
+ /*  5900 */   118,  780,   66,  780,  786,  780,  819,  823,  827,  780,
+ /*  5910 */   780,  126,  780,   20,   21,   26,   69,   70,   86,   99,
+ /*  5920 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /*  5930 */   107,  780,  138,  136,   48,   50,   52,   54,  157,  780,
+ /*  5940 */   780,  780,  780,  780,  780,  780,   56,   58,  780,   64,
+ /*  5950 */    65,   95,   96,   97,  103,  104,  105,  116,  117,  119,
+ /*  5960 */   126,  780,  780,  780,   95,   96,   97,   84,  780,  780,
+ /*  5970 */   780,  780,  780,  780,  780,  780,  108,  111,   63,  118,
+ /*  5980 */   780,   66,  780,  780,   95,   96,   97,  780,  780,  780,
+ /*  5990 */   780,  780,   20,   21,   26,   69,   70,   86,   99,   75,
+ /*  6000 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /*  6010 */   153,  154,  780,  145,  147,  150,   84,  780,  691,  780,
+ /*  6020 */   780,  780,  780,  780,  780,  108,  111,   63,  118,  780,
+ /*  6030 */    66,  780,  126,  780,  631,  624,  780,  780,  780,  692,
+ /*  6040 */   341,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /*  6050 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  780,
+ /*  6060 */   790,  789,  149,  147,  150,  780,   67,  780,  780,  780,
+ /*  6070 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  6080 */   780,  780,  126,  780,  780,  780,  780,  780,   84,  780,
+ /*  6090 */   780,  780,  780,  780,  623,  687,  780,  108,  111,   63,
+ /*  6100 */   118,  780,   66,  780,  688,  689,  780,  780,  780,  780,
+ /*  6110 */   790,  789,  682,   20,   21,   26,   69,   70,   86,   99,
+ /*  6120 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /*  6130 */   107,  780,  126,  780,  780,   94,  780,  152,   84,   64,
+ /*  6140 */    65,   95,   96,   97,  780,  780,  780,  108,  111,   63,
+ /*  6150 */   118,  780,   66,  780,  780,  780,  780,  780,  780,  790,
+ /*  6160 */   789,  780,  798,   20,   21,   26,   69,   70,   86,   99,
+ /*  6170 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /*  6180 */   107,  126,  780,  780,  113,  123,  780,  780,   84,  780,
+ /*  6190 */   780,  780,  780,  780,  127,  131,  115,  108,  111,   63,
+ /*  6200 */   118,  780,   66,  780,  780,  780,  780,  780,  780,  780,
+ /*  6210 */    67,  780,  785,   20,   21,   26,   69,   70,   86,   99,
+ /*  6220 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /*  6230 */   107,  795,  789,  780,  780,  780,  780,   84,  780,  780,
+ /*  6240 */   780,  780,  780,  780,  780,  780,  108,  111,   63,  118,
+ /*  6250 */   780,   66,  780,  126,  780,  780,  780,  780,  780,  780,
+ /*  6260 */   780,  793,   20,   21,   26,   69,   70,   86,   99,   75,
+ /*  6270 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /*  6280 */   780,  790,  789,   64,   65,   95,   96,   97,  103,  104,
+ /*  6290 */   105,  116,  117,  119,  780,  780,  690,  686,  780,  780,
+ /*  6300 */   780,  780,  113,  126,  780,  143,  780,  780,  780,   84,
+ /*  6310 */   780,  780,  127,  131,  780,  780,  780,  780,  108,  111,
+ /*  6320 */    63,  118,  780,   66,  780,  780,  780,  780,  780,  780,
+ /*  6330 */   780,  790,  789,  796,   20,   21,   26,   69,   70,   86,
+ /*  6340 */    99,   75,   76,   77,   89,  100,  110,   47,   60,   94,
+ /*  6350 */   106,  107,  780,  126,  780,  780,  685,  780,  780,   84,
+ /*  6360 */   780,  780,  780,  780,  780,  780,  780,  780,  108,  111,
+ /*  6370 */    63,  118,  780,   66,  780,  780,  780,  780,  780,  780,
+ /*  6380 */   790,  789,  780,  800,   20,   21,   26,   69,   70,   86,
+ /*  6390 */    99,   75,   76,   77,   89,  100,  110,   47,   60,   94,
+ /*  6400 */   106,  107,  126,   95,   96,   97,  780,  780,  780,   84,
+ /*  6410 */   780,  780,  780,  780,  780,  780,  780,  780,  108,  111,
+ /*  6420 */    63,  118,  780,   66,  780,  780,  780,  780,  780,  780,
+ /*  6430 */   780,  780,  780,  802,   20,   21,   26,   69,   70,   86,
+ /*  6440 */    99,   75,   76,   77,   89,  100,  110,   47,   60,   94,
+ /*  6450 */   106,  107,  790,  789,  780,  780,  780,  780,   84,  780,
+ /*  6460 */   780,  780,  780,  780,  780,  780,  780,  108,  111,   63,
+ /*  6470 */   118,  780,   66,  780,  126,  780,  780,  780,  780,  780,
+ /*  6480 */   780,  780,  806,   20,   21,   26,   69,   70,   86,   99,
+ /*  6490 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /*  6500 */   107,  780,  790,  789,  780,  780,  780,  780,  780,  780,
+ /*  6510 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  6520 */   780,  780,  780,  780,  126,  780,  780,  780,  780,  780,
+ /*  6530 */    84,  780,  780,  780,  780,  780,  780,  780,  780,  108,
+ /*  6540 */   111,   63,  118,  780,   66,  780,  780,  780,  780,  780,
+ /*  6550 */   780,  780,  790,  789,  810,   20,   21,   26,   69,   70,
+ /*  6560 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /*  6570 */    94,  106,  107,  780,  126,  780,  780,  780,  780,  780,
+ /*  6580 */    84,  780,  780,  780,  780,  780,  780,  780,  780,  108,
+ /*  6590 */   111,   63,  118,  780,   66,  780,  780,  780,  780,  780,
+ /*  6600 */   780,  790,  789,  780,  814,   20,   21,   26,   69,   70,
+ /*  6610 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /*  6620 */    94,  106,  107,  126,  780,  780,  780,  780,  780,  780,
+ /*  6630 */    84,  780,  780,  780,  780,  780,  780,  780,  780,  108,
+ /*  6640 */   111,   63,  118,  780,   66,  780,  780,  780,  780,  780,
+ /*  6650 */   780,  780,  780,  780,  816,   20,   21,   26,   69,   70,
+ /*  6660 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /*  6670 */    94,  106,  107,  790,  789,  780,  780,  780,  780,   84,
+ /*  6680 */   780,  780,  780,  780,  780,  780,  780,  780,  108,  111,
+ /*  6690 */    63,  118,  780,   66,  780,  126,  780,  780,  780,  780,
+ /*  6700 */   780,  780,  780,  818,   20,   21,   26,   69,   70,   86,
+ /*  6710 */    99,   75,   76,   77,   89,  100,  110,   47,   60,   94,
+ /*  6720 */   106,  107,  780,  790,  789,  780,  780,  780,  780,  780,
+ /*  6730 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  6740 */   780,  780,  780,  780,  780,  126,  780,  780,  780,  780,
+ /*  6750 */   780,   84,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  6760 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  780,
+ /*  6770 */   780,  780,  780,  828,  789,  822,   20,   21,   26,   69,
+ /*  6780 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /*  6790 */    60,   94,  106,  107,  780,  126,  780,  780,  780,  780,
+ /*  6800 */   780,   84,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  6810 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  780,
+ /*  6820 */   780,  780,  790,  789,  780,  826,   20,   21,   26,   69,
+ /*  6830 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /*  6840 */    60,   94,  106,  107,  126,  780,  780,  780,  780,  780,
+ /*  6850 */   780,   84,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  6860 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  780,
+ /*  6870 */   780,  780,  780,  780,  780,  831,   20,   21,   26,   69,
+ /*  6880 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /*  6890 */    60,   94,  106,  107,  790,  789,  780,  780,  780,  780,
+ /*  6900 */    84,  780,  780,  780,  780,  780,  780,  780,  780,  108,
+ /*  6910 */   111,   63,  118,  780,   66,  780,  126,  780,  780,  780,
+ /*  6920 */   780,  780,  780,  780,  830,   20,   21,   26,   69,   70,
+ /*  6930 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /*  6940 */    94,  106,  107,  780,  124,  780,  780,  780,  780,  780,
+ /*  6950 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  6960 */   780,  780,  780,  780,  780,  780,  126,  780,  780,  780,
+ /*  6970 */   780,  780,   84,  780,  780,  780,  780,  780,  780,  780,
+ /*  6980 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /*  6990 */   780,  780,  780,  780,   16,   17,  833,   20,   21,   26,
+ /*  7000 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /*  7010 */    47,   60,   94,  106,  107,  780,  126,  780,  780,  780,
+ /*  7020 */   948,  912,   84,  780,  780,  780,  780,  780,  780,  780,
+ /*  7030 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /*  7040 */   780,  780,  780,  780,  780,  780,  780,   20,   21,   26,
+ /*  7050 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /*  7060 */    47,   60,   94,  106,  107,  780,  780,  780,  780,  691,
+ /*  7070 */   780,  780,   84,  780,  780,  780,  780,  780,  780,  780,
+ /*  7080 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /*  7090 */   692,  780,  780,  780,  780,  780,  780,   20,   21,   26,
+ /*  7100 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /*  7110 */    47,   60,   94,  106,  107,  140,  141,  780,  780,  780,
+ /*  7120 */   780,  113,  123, 1495,  143,  780,  780,  780,  690,  686,
+ /*  7130 */   780,  127,  131,  115,  113,  710,  780,  143,  780,  780,
+ /*  7140 */   780,  780,  780,  780,  127,  131,  687,   67,  780,  780,
+ /*  7150 */   780,  140,  141,  780,  780,  688,  689,  113,  123, 1498,
+ /*  7160 */   143,  780,  780,  703,  780,  780,  694,  127,  131,  115,
+ /*  7170 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  7180 */   780,  780,  780,   67,  780,  780,   94,  780,  685,  337,
+ /*  7190 */   340,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  7200 */   780,  780,  780,  780,  780,   48,   50,   52,   54,  780,
+ /*  7210 */   780,  126,  780,  780,  780,  780,  780,   56,   58,  780,
+ /*  7220 */    64,   65,   95,   96,   97,  103,  104,  105,  116,  117,
+ /*  7230 */   119,  780,  780,  368,  365,   95,   96,   97,  780,  780,
+ /*  7240 */   780,   48,   50,   52,   54,  780,  780,  780,  780,  858,
+ /*  7250 */   780,  780,  780,   56,   58,  126,   64,   65,   95,   96,
+ /*  7260 */    97,  103,  104,  105,  116,  117,  119,   84,  780,  780,
+ /*  7270 */   863,  780,  780,  780,  780,  780,  108,  111,   63,  118,
+ /*  7280 */   780,   66,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  7290 */   780,  780,   20,   21,   26,   69,   70,   86,   99,   75,
+ /*  7300 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /*  7310 */   780,   84,  780,  780,  780,  780,  126,  780,  780,  780,
+ /*  7320 */   108,  111,   63,  118,  780,   66,  845,  850,  780,  780,
+ /*  7330 */   780,  780,  780,  780,  780,  868,   20,   21,   26,   69,
+ /*  7340 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /*  7350 */    60,   94,  106,  107,  371,  372,  780,  780,  780,  780,
+ /*  7360 */   780,  780,  780,  780,  780,  780,   94,  780,  780,  780,
+ /*  7370 */   780,  780,   84,  780,  780,  780,  126,  780,  780,  780,
+ /*  7380 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /*  7390 */   780,  780,  780,  780,  780,  780,  780,  419,  420,  187,
+ /*  7400 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /*  7410 */    47,   60,   94,  106,  107,  780,  780,  690,  686,  126,
+ /*  7420 */   780,  780,  780,  113,  777,  780,  143,  780,  780,  780,
+ /*  7430 */   780,  780,   84,  127,  131,  780,  780,  780,  780,  780,
+ /*  7440 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /*  7450 */   780,  780,  780,  780,  518,  519,  780,   20,   21,   26,
+ /*  7460 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /*  7470 */    47,   60,   94,  106,  107,   84,  126,  685,  780,  738,
+ /*  7480 */   755,  766,  780,  780,  108,  111,   63,  118,  780,   66,
+ /*  7490 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  7500 */    20,   21,   26,   69,   70,   86,   99,   75,   76,   77,
+ /*  7510 */    89,  100,  110,   47,   60,   94,  106,  107,  780,  780,
+ /*  7520 */   780,  690,  686,  780,   95,   96,   97,  113,  721,  780,
+ /*  7530 */   143,  780,   84,  780,  780,  780,  780,  127,  131,  780,
+ /*  7540 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /*  7550 */   780,  780,  780,  566,  567,  780,  126,   20,   21,   26,
+ /*  7560 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /*  7570 */    47,   60,   94,  106,  107,  570,  780,  780,  578,  780,
+ /*  7580 */   780,  685,  580,  582,  584,  586,  588,  590,  592,  594,
+ /*  7590 */   596,  598,  600,  602,  604,  606,  573,  574,  612,  614,
+ /*  7600 */   780,  608,  610,  616,  618,  620,  780,  780,  780,  780,
+ /*  7610 */   780,  780,   84,  780,  780,  780,  780,  780,  126,  780,
+ /*  7620 */   780,  108,  111,   63,  118,  126,   66,  780,   95,   96,
+ /*  7630 */    97,   84,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  7640 */   108,  111,   63,  118,  780,   66,   40,   89,  100,  110,
+ /*  7650 */    47,   60,   94,  106,  107,  780,   20,   21,   26,   69,
+ /*  7660 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /*  7670 */    60,   94,  106,  107,   84,  640,  780,  780,  780,  780,
+ /*  7680 */   780,   84,  780,  108,  111,   63,  118,  780,   66,  780,
+ /*  7690 */   108,  111,   63,  118,  780,   66,  780,  126,  780,   20,
+ /*  7700 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /*  7710 */   100,  110,   47,   60,   94,  106,  107,   44,  110,   47,
+ /*  7720 */    60,   94,  106,  107,  780,  780,  780,  780,  780,  780,
+ /*  7730 */   640,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  7740 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  7750 */   780,  780,  126,   84,  780,  780,  780,  780,  780,  780,
+ /*  7760 */   126,  780,  108,  111,   63,  118,  780,   66,  637,  780,
+ /*  7770 */   780,  780,  780,  780,  640,  780,  780,  780,   20,   21,
+ /*  7780 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /*  7790 */   110,   47,   60,   94,  106,  107,  126,  917,  780,  780,
+ /*  7800 */   780,  780,  113,  780,  126,  143,  780,  780,   84,  780,
+ /*  7810 */   780,  780,  127,  131,  780,  780,   84,  108,  111,   63,
+ /*  7820 */   118,  780,   66,  644,  780,  108,  111,   63,  118,  780,
+ /*  7830 */    66,  640,  780,   20,   21,   26,   69,   70,   86,   99,
+ /*  7840 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /*  7850 */   107,  780,   84,  126,   62,   60,   94,  106,  107,  780,
+ /*  7860 */    84,  108,  111,   63,  118,  780,   66,  661,  780,  108,
+ /*  7870 */   111,   63,  118,  780,   66,  780,  780,   20,   21,   26,
+ /*  7880 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /*  7890 */    47,   60,   94,  106,  107,   42,  100,  110,   47,   60,
+ /*  7900 */    94,  106,  107,   95,   96,   97,  780,  780,  678,   84,
+ /*  7910 */   780,  780,  780,  780,  780,  780,  780,  780,  108,  111,
+ /*  7920 */    63,  118,  780,   66,  665,  780,  780,  780,  780,  780,
+ /*  7930 */   126,  780,  780,  780,   20,   21,   26,   69,   70,   86,
+ /*  7940 */    99,   75,   76,   77,   89,  100,  110,   47,   60,   94,
+ /*  7950 */   106,  107,  640,  780,  780,  780,  780,  780,  780,  780,
+ /*  7960 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  7970 */   780,  780,  780,  780,  126,  780,  780,  780,  780,  780,
+ /*  7980 */   780,  780,  780,  780,  780,  780,   84,  780,  780,  780,
+ /*  7990 */   780,  780,  780,  780,  780,  108,  111,   63,  118,  780,
+ /*  8000 */    66,  780,  780,  780,  675,  780,  780,  780,  780,  780,
+ /*  8010 */   780,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /*  8020 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  780,
+ /*  8030 */    84,  780,  780,  780,  780,  780,  780,  780,  780,  108,
+ /*  8040 */   111,   63,  118,  780,   66,  680,  780,  780,  780,  780,
+ /*  8050 */   780,  780,  678,  780,  780,   20,   21,   26,   69,   70,
+ /*  8060 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /*  8070 */    94,  106,  107,  780,  126,  517,  780,   85,  780,  522,
+ /*  8080 */   524,  526,  528,  530,  532,  534,  536,  538,  540,  542,
+ /*  8090 */   544,  546,  548,  554,  556,  558,  560,  562,  550,  552,
+ /*  8100 */   466,  780,  780,  780,  468,  470,  472,  474,  476,  478,
+ /*  8110 */   480,  482,  484,  486,  488,  490,  492,  494,  496,  498,
+ /*  8120 */   500,  502,  504,  506,  508,  780,  780,  780,  780,  700,
+ /*  8130 */    84,  780,  780,  780,  780,  780,  780,  780,  780,  108,
+ /*  8140 */   111,   63,  118,  780,   66,  780,  780,  780,  684,  780,
+ /*  8150 */   780,  126,  780,  780,  780,   20,   21,   26,   69,   70,
+ /*  8160 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /*  8170 */    94,  106,  107,  640,  780,  780,  780,  780,  780,  780,
+ /*  8180 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  8190 */   780,  780,  780,  780,  780,  126,  780,  780,  780,  780,
+ /*  8200 */   780,  780,  780,  780,  780,  780,  780,   84,  780,  780,
+ /*  8210 */   780,  780,  780,  780,  780,  780,  108,  111,   63,  118,
+ /*  8220 */   780,   66,  780,  780,  780,  780,  780,  780,  697,  780,
+ /*  8230 */   780,  780,   20,   21,   26,   69,   70,   86,   99,   75,
+ /*  8240 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /*  8250 */   126,   84,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  8260 */   108,  111,   63,  118,  780,   66,  705,  780,  780,  780,
+ /*  8270 */   780,  780,  780,  678,  780,  780,   20,   21,   26,   69,
+ /*  8280 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /*  8290 */    60,   94,  106,  107,  780,  126,  690,  686,  780,  780,
+ /*  8300 */   780,  780,  113,  744,  780,  143,   84,  780,  780,  780,
+ /*  8310 */   780,  780,  127,  131,  780,  108,  111,   63,  118,  780,
+ /*  8320 */    66,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  8330 */   780,  780,  780,  780,   28,   70,   86,   99,   75,   76,
+ /*  8340 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  780,
+ /*  8350 */   700,   84,  780,  780,  780,  780,  685,  780,  780,  780,
+ /*  8360 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  709,
+ /*  8370 */   780,  780,  126,  780,  780,  780,   20,   21,   26,   69,
+ /*  8380 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /*  8390 */    60,   94,  106,  107,  678,  780,  780,  780,  780,  780,
+ /*  8400 */   780,  780,  780,   95,   96,   97,  780,  780,  780,  780,
+ /*  8410 */   780,  780,  780,  780,  780,  780,  126,  780,  780,  780,
+ /*  8420 */   780,  780,  780,  780,  780,  780,  780,  780,   84,  780,
+ /*  8430 */   780,  780,  780,  780,  780,  780,  780,  108,  111,   63,
+ /*  8440 */   118,  780,   66,  780,  780,  780,  780,  780,  780,  714,
+ /*  8450 */   780,  780,  780,   20,   21,   26,   69,   70,   86,   99,
+ /*  8460 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /*  8470 */   107,  126,   84,  780,  780,  780,  780,  780,  780,  780,
+ /*  8480 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /*  8490 */   720,  780,  780,  780,  700,  780,  780,   20,   21,   26,
+ /*  8500 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /*  8510 */    47,   60,   94,  106,  107,  780,  126,  690,  686,  780,
+ /*  8520 */   780,  780,  780,  113,  761,  780,  143,   84,  780,  780,
+ /*  8530 */   780,  780,  780,  127,  131,  780,  108,  111,   63,  118,
+ /*  8540 */   780,   66,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  8550 */   780,  780,  780,  780,  780,  780,   30,   86,   99,   75,
+ /*  8560 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /*  8570 */   780,  780,   84,  700,  780,  780,  780,  685,  780,  780,
+ /*  8580 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /*  8590 */   780,  780,  780,  725,  780,  126,  780,   20,   21,   26,
+ /*  8600 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /*  8610 */    47,   60,   94,  106,  107,  780,  737,  780,  780,  780,
+ /*  8620 */   780,  901,  780,  780,   95,   96,   97,  780,  780,  780,
+ /*  8630 */   780,  780,  932,  780,  780,  780,  780,  780,  126,  780,
+ /*  8640 */   780,  780,  906,  780,  780,  780,  780,  780,  780,  780,
+ /*  8650 */   780,   84,  780,  937,  780,  780,  780,  780,  780,  780,
+ /*  8660 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  780,
+ /*  8670 */   780,  780,  730,  780,  691,  780,   20,   21,   26,   69,
+ /*  8680 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /*  8690 */    60,   94,  106,  107,   84,  692,  691,  780,  891,  896,
+ /*  8700 */   780,  780,  780,  108,  111,   63,  118,  868,   66,  922,
+ /*  8710 */   927,  780,  780,  734,  780,  640,  780,  692,  868,   20,
+ /*  8720 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /*  8730 */   100,  110,   47,   60,   94,  106,  107,  126,   94,  690,
+ /*  8740 */   686,  780,  780,  780,  780,  113,  772,  780,  143,   94,
+ /*  8750 */   780,  687,  780,  780,  780,  127,  131,  780,  780,  780,
+ /*  8760 */   688,  689,  780,  780,  780,  780,  780,  780,  703,  780,
+ /*  8770 */   780,  711,  737,  687,  780,  780,  780,  780,  780,  780,
+ /*  8780 */   780,  780,  688,  689,  780,  780,  780,  780,  780,  780,
+ /*  8790 */   754,   94,  780,   84,  126,  745,  780,  780,  780,  685,
+ /*  8800 */   780,  780,  108,  111,   63,  118,  780,   66,  739,  780,
+ /*  8810 */   780,  780,  780,   94,  780,  751,  780,  780,   20,   21,
+ /*  8820 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /*  8830 */   110,   47,   60,   94,  106,  107,  780,  126,  780,  780,
+ /*  8840 */   780,  780,  780,  780,  780,  126,   95,   96,   97,  780,
+ /*  8850 */    84,  780,  780,  780,  780,  780,  780,  780,  780,  108,
+ /*  8860 */   111,   63,  118,  780,   66,  780,  780,  780,  780,  743,
+ /*  8870 */   780,  780,  780,  780,  691,   20,   21,   26,   69,   70,
+ /*  8880 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /*  8890 */    94,  106,  107,   84,  780,  692,  691,  780,  780,  780,
+ /*  8900 */   780,   84,  108,  111,   63,  118,  780,   66,  780,  780,
+ /*  8910 */   108,  111,   63,  118,  780,   66,  748,  692,   20,   21,
+ /*  8920 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /*  8930 */   110,   47,   60,   94,  106,  107,  640,   81,  110,   47,
+ /*  8940 */    60,   94,  106,  107,  780,  780,  780,  780,  780,  780,
+ /*  8950 */   780,  687,  780,  780,  780,  780,  780,  780,  126,  780,
+ /*  8960 */   688,  689,  780,  780,  780,  780,  780,  780,  703,  780,
+ /*  8970 */   780,  722,  780,  687,  780,  780,  780,  780,  780,  780,
+ /*  8980 */   780,  780,  688,  689,  737,  780,  780,  780,  780,  780,
+ /*  8990 */   703,   94,  780,  727,  780,  780,  780,  780,  780,  780,
+ /*  9000 */   780,  780,  780,  780,  780,  780,  126,  780,  780,  780,
+ /*  9010 */   780,  780,  780,   94,   84,  780,  780,  780,  780,  780,
+ /*  9020 */   780,  780,  780,  108,  111,   63,  118,  780,   66,  756,
+ /*  9030 */   780,  780,  780,  780,  780,  780,  751,  780,  780,   20,
+ /*  9040 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /*  9050 */   100,  110,   47,   60,   94,  106,  107,  780,  126,  780,
+ /*  9060 */   780,  780,   84,  780,  780,  780,  780,  780,  780,  780,
+ /*  9070 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /*  9080 */   780,  760,  780,  780,  780,  780,  780,   20,   21,   26,
+ /*  9090 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /*  9100 */    47,   60,   94,  106,  107,  780,  780,  113,  123,  780,
+ /*  9110 */   780,  780,  780,  780,   84,  780,  780,  127,  131,  115,
+ /*  9120 */   780,  780,  780,  108,  111,   63,  118,  780,   66,  780,
+ /*  9130 */   780,  780,  780,   67,  780,  780,  780,  765,  780,   20,
+ /*  9140 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /*  9150 */   100,  110,   47,   60,   94,  106,  107,  737,  780,  780,
+ /*  9160 */   780,  780,  780,  780,  691,  780,  780,  780,  780,  780,
+ /*  9170 */   780,  780,  780,  780,  780,  641,  642,  780,  780,  126,
+ /*  9180 */   780,  780,  780,  780,  780,  692,  780,  780,  780,  780,
+ /*  9190 */   780,   48,   50,   52,   54,  780,  780,  780,  780,  780,
+ /*  9200 */   780,  780,  780,   56,   58,  751,   64,   65,   95,   96,
+ /*  9210 */    97,  103,  104,  105,  116,  117,  119,  780,  780,  780,
+ /*  9220 */   780,  780,  780,  780,  780,  780,  780,  126,  780,  780,
+ /*  9230 */   780,  780,  780,  780,  780,   84,  780,  780,  780,  780,
+ /*  9240 */   780,  687,  780,  780,  108,  111,   63,  118,  780,   66,
+ /*  9250 */   688,  689,  780,  780,  771,  780,  780,  751,  702,  780,
+ /*  9260 */    20,   21,   26,   69,   70,   86,   99,   75,   76,   77,
+ /*  9270 */    89,  100,  110,   47,   60,   94,  106,  107,  780,  126,
+ /*  9280 */   780,   94,  780,   84,  780,  780,  780,  780,  780,  780,
+ /*  9290 */   780,  780,  108,  111,   63,  118,  780,   66,  780,  780,
+ /*  9300 */   780,  780,  780,  780,  780,  780,  776,  780,   20,   21,
+ /*  9310 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /*  9320 */   110,   47,   60,   94,  106,  107,  780,  780,  780,  780,
+ /*  9330 */   780,  126,  780,  780,  780,   84,  780,  780,  780,  780,
+ /*  9340 */   780,  780,  780,  780,  108,  111,   63,  118,  780,   66,
+ /*  9350 */   780,  780,  780,  780,  780,  780,  780,  780,  781,  780,
+ /*  9360 */    20,   21,   26,   69,   70,   86,   99,   75,   76,   77,
+ /*  9370 */    89,  100,  110,   47,   60,   94,  106,  107,  640,  780,
+ /*  9380 */   780,  780,  780,  780,  780,  780,  691,   84,  780,  780,
+ /*  9390 */   780,  780,  780,  780,  780,  780,  108,  111,   63,  118,
+ /*  9400 */   126,   66,  780,  780,  780,  780,  780,  692,  780,  780,
+ /*  9410 */   780,  780,  780,  780,  780,  780,  780,   32,   99,   75,
+ /*  9420 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /*  9430 */   780,  640,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  9440 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  9450 */   780,  780,  780,  126,  780,  780,   84,  780,  780,  780,
+ /*  9460 */   780,  780,  780,  687,  780,  108,  111,   63,  118,  780,
+ /*  9470 */    66,  784,  688,  689,  780,  780,  780,  780,  780,  780,
+ /*  9480 */   707,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /*  9490 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  788,
+ /*  9500 */   787,  780,  780,   94,  780,  113,  123,  780,  143,   84,
+ /*  9510 */   780,  780,  780,  780,  780,  127,  131,  115,  108,  111,
+ /*  9520 */    63,  118,  780,   66,  792,  780,  780,  780,  780,  780,
+ /*  9530 */   126,   67,  780,  780,   20,   21,   26,   69,   70,   86,
+ /*  9540 */    99,   75,   76,   77,   89,  100,  110,   47,   60,   94,
+ /*  9550 */   106,  107,  780,  780,  780,  780,  780,  780,  780,  786,
+ /*  9560 */   780,  780,  780,  780,  780,  640,  780,  780,  780,  780,
+ /*  9570 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /*  9580 */   780,  780,  780,  780,  780,  780,   84,  126,  780,   48,
+ /*  9590 */    50,   52,   54,  780,  780,  108,  111,   63,  118,  780,
+ /*  9600 */    66,   56,   58,  780,   64,   65,   95,   96,   97,  103,
+ /*  9610 */   104,  105,  116,  117,  119,  640,   72,   99,   75,   76,
+ /*  9620 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  780,
+ /*  9630 */   780,  780,  780,  780,  780,  780,  780,  126,  780,  780,
+ /*  9640 */   780,  780,  780,   84,  780,  780,  780,  780,  780,  780,
+ /*  9650 */   780,  780,  108,  111,   63,  118,  780,   66,  804,  780,
+ /*  9660 */   780,  780,  780,  780,  780,  640,  780,  780,   20,   21,
+ /*  9670 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /*  9680 */   110,   47,   60,   94,  106,  107,  780,  126,  780,  780,
+ /*  9690 */   780,  780,  780,   84,  780,  780,  780,  780,  780,  780,
+ /*  9700 */   780,  780,  108,  111,   63,  118,  780,   66,  808,  780,
+ /*  9710 */   780,  780,  780,  780,  780,  780,  780,  780,   20,   21,
+ /*  9720 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /*  9730 */   110,   47,   60,   94,  106,  107,  780,  780,  640,  780,
+ /*  9740 */   780,  780,  780,   84,  780,  780,  691,  780,  780,  780,
+ /*  9750 */   780,  780,  108,  111,   63,  118,  780,   66,  820,  780,
+ /*  9760 */   126,  780,  780,  780,  780,  780,  780,  692,   20,   21,
+ /*  9770 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /*  9780 */   110,   47,   60,   94,  106,  107,   18,   19,  691,  780,
+ /*  9790 */   780,  780,  113,  123,  780,  143,  780,  780,  780,  780,
+ /*  9800 */   780,  780,  127,  131,  115,  780,  780,  780,  780,  692,
+ /*  9810 */   780,  780,  780,  780,  780,  780,   84,  780,   67,  780,
+ /*  9820 */   780,  780,  780,  687,  780,  108,  111,   63,  118,  780,
+ /*  9830 */    66,  824,  688,  689,  780,  780,  780,  184,  780,  780,
+ /*  9840 */   718,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /*  9850 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  126,
+ /*  9860 */   780,  780,  780,   94,  780,  687,  780,  780,  780,  780,
+ /*  9870 */   780,  780,  780,  780,  688,  689,   48,   50,   52,   54,
+ /*  9880 */   780,  780,  754,  780,  780,  780,  178,  762,   56,   58,
+ /*  9890 */   780,   64,   65,   95,   96,   97,  103,  104,  105,  116,
+ /*  9900 */   117,  119,  780,  780,  780,   94,  780,  780,  126,  780,
+ /*  9910 */   780,  780,  780,  780,  780,   84,  780,  780,  780,  780,
+ /*  9920 */   780,  780,  780,  780,  108,  111,   63,  118,  780,   66,
+ /*  9930 */   780,  780,  780,  780,  780,  780,  170,  780,  780,  780,
+ /*  9940 */    20,   21,   26,   69,   70,   86,   99,   75,   76,   77,
+ /*  9950 */    89,  100,  110,   47,   60,   94,  106,  107,  126,  780,
+ /*  9960 */   780,  780,  780,  780,   84,  780,  780,  780,  780,  780,
+ /*  9970 */   780,  780,  780,  108,  111,   63,  118,  780,   66,  780,
+ /*  9980 */   780,  780,  780,  780,  780,  162,  780,  780,  780,   20,
+ /*  9990 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /* 10000 */   100,  110,   47,   60,   94,  106,  107,  126,  780,  780,
+ /* 10010 */   780,  780,  780,  780,   84,  780,  780,  780,  780,  780,
+ /* 10020 */   780,  780,  780,  108,  111,   63,  118,  780,   66,  780,
+ /* 10030 */   780,  780,  780,  780,  780,  160,  780,  780,  780,   20,
+ /* 10040 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /* 10050 */   100,  110,   47,   60,   94,  106,  107,  126,  780,  780,
+ /* 10060 */   780,  780,  780,   84,  780,  780,  780,  780,  780,  780,
+ /* 10070 */   780,  780,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 10080 */   780,  780,  780,  780,  121,  780,  780,  780,   20,   21,
+ /* 10090 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /* 10100 */   110,   47,   60,   94,  106,  107,  126,  780,  780,  780,
+ /* 10110 */   780,  780,  780,   84,  780,  780,  780,  780,  780,  780,
+ /* 10120 */   780,  780,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 10130 */   780,  780,  780,  780,  124,  780,  780,  780,   20,   21,
+ /* 10140 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /* 10150 */   110,   47,   60,   94,  106,  107,  126,  780,  780,  780,
+ /* 10160 */   780,  780,   84,  780,  780,  780,  780,  780,  780,  780,
+ /* 10170 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /* 10180 */   780,  780,  780,  780,  780,  780,  780,   20,   21,   26,
+ /* 10190 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /* 10200 */    47,   60,   94,  106,  107,  780,  292,  780,  780,  780,
+ /* 10210 */   780,  780,   84,  780,  780,  780,  780,  780,  780,  780,
+ /* 10220 */   780,  108,  111,   63,  118,  780,   66,  780,  126,  780,
+ /* 10230 */   780,  780,  780,  780,  780,  780,  780,   20,   21,   26,
+ /* 10240 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /* 10250 */    47,   60,   94,  106,  107,  155,  156,  691,  780,  780,
+ /* 10260 */   780,  113,  123,  780,  143,  780,  780,  780,  780,  780,
+ /* 10270 */   780,  127,  131,  115,  780,  780,  780,  780,  692,  780,
+ /* 10280 */   780,  780,  780,  780,   84,  780,  780,   67,  780,  780,
+ /* 10290 */   780,  780,  780,  108,  111,   63,  118,  780,   66,  780,
+ /* 10300 */   780,  780,  780,  780,  780,  303,  780,  780,  780,   20,
+ /* 10310 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /* 10320 */   100,  110,   47,   60,   94,  106,  107,  126,  780,  780,
+ /* 10330 */   780,  780,  780,  780,  687,  780,  780,  780,  780,  780,
+ /* 10340 */   780,  780,  780,  688,  689,   48,   50,   52,   54,  780,
+ /* 10350 */   780,  754,  780,  780,  780,  321,  773,   56,   58,  780,
+ /* 10360 */    64,   65,   95,   96,   97,  103,  104,  105,  116,  117,
+ /* 10370 */   119,  780,  780,  780,   94,  780,  780,  126,  780,  780,
+ /* 10380 */   780,  780,  780,   84,  780,  780,  780,  780,  780,  780,
+ /* 10390 */   780,  780,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 10400 */   780,  780,  780,  780,  780,  327,  780,  780,   20,   21,
+ /* 10410 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /* 10420 */   110,   47,   60,   94,  106,  107,  780,  126,  780,  780,
+ /* 10430 */   780,  780,  780,   84,  780,  780,  780,  780,  780,  780,
+ /* 10440 */   780,  780,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 10450 */   780,  780,  780,  780,  333,  780,  780,  780,   20,   21,
+ /* 10460 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /* 10470 */   110,   47,   60,   94,  106,  107,  126,  780,  780,  780,
+ /* 10480 */   780,  780,  780,   84,  780,  780,  780,  780,  780,  780,
+ /* 10490 */   780,  780,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 10500 */   780,  780,  780,  780,  780,  780,  780,  780,   20,   21,
+ /* 10510 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /* 10520 */   110,   47,   60,   94,  106,  107,  345,  780,  780,  780,
+ /* 10530 */   780,  780,   84,  780,  780,  780,  780,  780,  780,  780,
+ /* 10540 */   780,  108,  111,   63,  118,  780,   66,  780,  126,  780,
+ /* 10550 */   780,  780,  780,  780,  780,  780,  780,   20,   21,   26,
+ /* 10560 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /* 10570 */    47,   60,   94,  106,  107,  338,  339,  691,  780,  780,
+ /* 10580 */   780,  113,  123,  780,  143,  780,  780,  780,  780,  780,
+ /* 10590 */   780,  127,  131,  115,  780,  780,  780,  780,  692,  780,
+ /* 10600 */   780,  780,  780,  780,   84,  780,  780,   67,  780,  780,
+ /* 10610 */   780,  780,  780,  108,  111,   63,  118,  780,   66,  780,
+ /* 10620 */   780,  780,  780,  780,  780,  780,  349,  780,  780,   20,
+ /* 10630 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /* 10640 */   100,  110,   47,   60,   94,  106,  107,  780,  126,  780,
+ /* 10650 */   780,  780,  780,  780,  687,  780,  780,  780,  780,  780,
+ /* 10660 */   780,  780,  780,  688,  689,   48,   50,   52,   54,  780,
+ /* 10670 */   780,  754,  780,  780,  780,  353,  778,   56,   58,  780,
+ /* 10680 */    64,   65,   95,   96,   97,  103,  104,  105,  116,  117,
+ /* 10690 */   119,  780,  780,  780,   94,  780,  780,  126,  780,  780,
+ /* 10700 */   780,  780,  780,  780,   84,  780,  780,  780,  780,  780,
+ /* 10710 */   780,  780,  780,  108,  111,   63,  118,  780,   66,  780,
+ /* 10720 */   780,  780,  780,  780,  780,  357,  780,  780,  780,   20,
+ /* 10730 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /* 10740 */   100,  110,   47,   60,   94,  106,  107,  126,  780,  780,
+ /* 10750 */   780,  780,  780,   84,  780,  780,  780,  780,  780,  780,
+ /* 10760 */   780,  780,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 10770 */   780,  780,  780,  780,  361,  780,  780,  780,   20,   21,
+ /* 10780 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /* 10790 */   110,   47,   60,   94,  106,  107,  126,  780,  780,  780,
+ /* 10800 */   780,  780,  780,   84,  780,  780,  780,  780,  780,  780,
+ /* 10810 */   780,  780,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 10820 */   780,  780,  780,  780,  780,  780,  780,  780,   20,   21,
+ /* 10830 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /* 10840 */   110,   47,   60,   94,  106,  107,  780,  780,  691,  780,
+ /* 10850 */   780,  780,   84,  780,  780,  780,  780,  780,  780,  780,
+ /* 10860 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  692,
+ /* 10870 */   780,  780,  780,  780,  780,  780,  780,   20,   21,   26,
+ /* 10880 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /* 10890 */    47,   60,   94,  106,  107,  366,  367,  780,  780,  780,
+ /* 10900 */   780,  113,  123,  780,  143,  780,  780,  780,  780,  780,
+ /* 10910 */   780,  127,  131,  115,  780,  780,  780,  780,  780,  780,
+ /* 10920 */   780,  780,  780,  780,  780,  687,  780,   67,  780,  780,
+ /* 10930 */   780,  374,  373,  780,  688,  689,  780,  113,  123,  780,
+ /* 10940 */   143,  780,  732,  780,  780,  780,  780,  127,  131,  115,
+ /* 10950 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 10960 */   780,  780,  780,   67,  780,   94,  780,  780,  780,  376,
+ /* 10970 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 10980 */   780,  780,  780,  780,  780,   48,   50,   52,   54,  780,
+ /* 10990 */   780,  126,  780,  780,  780,  780,  780,   56,   58,  780,
+ /* 11000 */    64,   65,   95,   96,   97,  103,  104,  105,  116,  117,
+ /* 11010 */   119,  780,  780,  378,  780,  780,  780,  780,  780,  780,
+ /* 11020 */   780,   48,   50,   52,   54,  780,  780,  780,  780,  780,
+ /* 11030 */   780,  780,  780,   56,   58,  126,   64,   65,   95,   96,
+ /* 11040 */    97,  103,  104,  105,  116,  117,  119,   84,  780,  780,
+ /* 11050 */   780,  780,  780,  780,  780,  780,  108,  111,   63,  118,
+ /* 11060 */   780,   66,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 11070 */   780,  380,   20,   21,   26,   69,   70,   86,   99,   75,
+ /* 11080 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /* 11090 */   780,   84,  780,  126,  780,  780,  780,  780,  780,  780,
+ /* 11100 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  780,
+ /* 11110 */   780,  780,  780,  780,  780,  780,   20,   21,   26,   69,
+ /* 11120 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /* 11130 */    60,   94,  106,  107,  382,  780,  780,  780,  780,  780,
+ /* 11140 */   780,  780,  780,  780,  780,  780,  780,  780,  780,   84,
+ /* 11150 */   780,  780,  780,  780,  780,  780,  126,  780,  108,  111,
+ /* 11160 */    63,  118,  780,   66,  780,  780,  780,  780,  780,  780,
+ /* 11170 */   780,  780,  780,  780,   20,   21,   26,   69,   70,   86,
+ /* 11180 */    99,   75,   76,   77,   89,  100,  110,   47,   60,   94,
+ /* 11190 */   106,  107,  384,  780,  780,  780,  780,  780,  780,  780,
+ /* 11200 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 11210 */   780,  780,   84,  780,  126,  780,  780,  780,  780,  780,
+ /* 11220 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /* 11230 */   780,  780,  780,  780,  780,  386,  780,   20,   21,   26,
+ /* 11240 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /* 11250 */    47,   60,   94,  106,  107,  780,  780,  126,  780,  780,
+ /* 11260 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 11270 */    84,  780,  780,  780,  780,  780,  780,  780,  780,  108,
+ /* 11280 */   111,   63,  118,  780,   66,  780,  780,  780,  780,  780,
+ /* 11290 */   780,  780,  388,  780,  780,   20,   21,   26,   69,   70,
+ /* 11300 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /* 11310 */    94,  106,  107,   84,  126,  780,  780,  780,  780,  780,
+ /* 11320 */   780,  780,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 11330 */   780,  780,  780,  780,  780,  780,  780,  780,   20,   21,
+ /* 11340 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /* 11350 */   110,   47,   60,   94,  106,  107,  390,  780,  780,  780,
+ /* 11360 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 11370 */    84,  780,  780,  780,  780,  780,  780,  780,  126,  108,
+ /* 11380 */   111,   63,  118,  780,   66,  780,  780,  780,  780,  780,
+ /* 11390 */   780,  780,  780,  780,  780,   20,   21,   26,   69,   70,
+ /* 11400 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /* 11410 */    94,  106,  107,  392,  780,  780,  780,  780,  780,  780,
+ /* 11420 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 11430 */   780,  780,  780,  780,   84,  126,  780,  780,  780,  780,
+ /* 11440 */   780,  780,  780,  108,  111,   63,  118,  780,   66,  780,
+ /* 11450 */   780,  780,  780,  780,  780,  780,  394,  780,  780,   20,
+ /* 11460 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /* 11470 */   100,  110,   47,   60,   94,  106,  107,  780,  126,  780,
+ /* 11480 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 11490 */   780,   84,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 11500 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  780,
+ /* 11510 */   780,  780,  780,  396,  780,  780,   20,   21,   26,   69,
+ /* 11520 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /* 11530 */    60,   94,  106,  107,   84,  126,  780,  780,  780,  780,
+ /* 11540 */   780,  780,  780,  108,  111,   63,  118,  780,   66,  780,
+ /* 11550 */   780,  780,  780,  780,  780,  780,  780,  780,  780,   20,
+ /* 11560 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /* 11570 */   100,  110,   47,   60,   94,  106,  107,  398,  780,  780,
+ /* 11580 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 11590 */   780,   84,  780,  780,  780,  780,  780,  780,  780,  126,
+ /* 11600 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  780,
+ /* 11610 */   780,  780,  780,  780,  780,  780,   20,   21,   26,   69,
+ /* 11620 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /* 11630 */    60,   94,  106,  107,  400,  780,  780,  780,  780,  780,
+ /* 11640 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 11650 */   780,  780,  780,  780,  780,   84,  126,  780,  780,  780,
+ /* 11660 */   780,  780,  780,  780,  108,  111,   63,  118,  780,   66,
+ /* 11670 */   780,  780,  780,  780,  780,  780,  780,  402,  780,  780,
+ /* 11680 */    20,   21,   26,   69,   70,   86,   99,   75,   76,   77,
+ /* 11690 */    89,  100,  110,   47,   60,   94,  106,  107,  780,  126,
+ /* 11700 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 11710 */   780,  780,   84,  780,  780,  780,  780,  780,  780,  780,
+ /* 11720 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /* 11730 */   780,  780,  780,  780,  404,  780,  780,   20,   21,   26,
+ /* 11740 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /* 11750 */    47,   60,   94,  106,  107,   84,  126,  780,  780,  780,
+ /* 11760 */   780,  780,  780,  780,  108,  111,   63,  118,  780,   66,
+ /* 11770 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 11780 */    20,   21,   26,   69,   70,   86,   99,   75,   76,   77,
+ /* 11790 */    89,  100,  110,   47,   60,   94,  106,  107,  406,  780,
+ /* 11800 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 11810 */   780,  780,   84,  780,  780,  780,  780,  780,  780,  780,
+ /* 11820 */   126,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /* 11830 */   780,  780,  780,  780,  780,  780,  780,   20,   21,   26,
+ /* 11840 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /* 11850 */    47,   60,   94,  106,  107,  408,  780,  780,  780,  780,
+ /* 11860 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 11870 */   780,  780,  780,  780,  780,  780,   84,  126,  780,  780,
+ /* 11880 */   780,  780,  780,  780,  780,  108,  111,   63,  118,  780,
+ /* 11890 */    66,  780,  780,  780,  780,  780,  780,  780,  410,  780,
+ /* 11900 */   780,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /* 11910 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  780,
+ /* 11920 */   126,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 11930 */   780,  780,  780,   84,  780,  780,  780,  780,  780,  780,
+ /* 11940 */   780,  780,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 11950 */   780,  780,  780,  780,  780,  412,  780,  780,   20,   21,
+ /* 11960 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /* 11970 */   110,   47,   60,   94,  106,  107,   84,  126,  780,  780,
+ /* 11980 */   780,  780,  780,  780,  780,  108,  111,   63,  118,  780,
+ /* 11990 */    66,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 12000 */   780,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /* 12010 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  414,
+ /* 12020 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 12030 */   780,  780,  780,   84,  780,  780,  780,  780,  780,  780,
+ /* 12040 */   780,  126,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 12050 */   780,  780,  780,  780,  780,  780,  780,  780,   20,   21,
+ /* 12060 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /* 12070 */   110,   47,   60,   94,  106,  107,  416,  780,  780,  780,
+ /* 12080 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 12090 */   780,  780,  780,  780,  780,  780,  780,   84,  126,  780,
+ /* 12100 */   780,  780,  780,  780,  780,  780,  108,  111,   63,  118,
+ /* 12110 */   780,   66,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 12120 */   780,  691,   20,   21,   26,   69,   70,   86,   99,   75,
+ /* 12130 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /* 12140 */   422,  421,  692,  780,  780,  780,  113,  123,  780,  143,
+ /* 12150 */   780,  780,  780,  780,   84,  780,  127,  131,  115,  780,
+ /* 12160 */   780,  780,  780,  108,  111,   63,  118,  780,   66,  780,
+ /* 12170 */   780,  780,   67,  780,  780,  780,  780,  780,  424,   20,
+ /* 12180 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /* 12190 */   100,  110,   47,   60,   94,  106,  107,  780,  687,  780,
+ /* 12200 */   126,  780,  780,  780,  780,  780,  780,  688,  689,  780,
+ /* 12210 */   780,  780,  780,  780,  780,  741,  780,  780,  780,  780,
+ /* 12220 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 12230 */    48,   50,   52,   54,  780,  780,  780,  780,   94,  780,
+ /* 12240 */   426,  780,   56,   58,  780,   64,   65,   95,   96,   97,
+ /* 12250 */   103,  104,  105,  116,  117,  119,   84,  780,  780,  780,
+ /* 12260 */   780,  780,  126,  780,  780,  108,  111,   63,  118,  780,
+ /* 12270 */    66,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 12280 */   780,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /* 12290 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  428,
+ /* 12300 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 12310 */   780,  780,  780,  780,  780,  780,  780,  780,   84,  780,
+ /* 12320 */   780,  126,  780,  780,  780,  780,  780,  108,  111,   63,
+ /* 12330 */   118,  780,   66,  780,  780,  780,  780,  780,  780,  780,
+ /* 12340 */   780,  780,  780,   20,   21,   26,   69,   70,   86,   99,
+ /* 12350 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /* 12360 */   107,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 12370 */   780,  780,  780,  780,  430,  780,  780,   84,  780,  780,
+ /* 12380 */   780,  780,  780,  780,  780,  780,  108,  111,   63,  118,
+ /* 12390 */   780,   66,  780,  780,  780,  780,  126,  780,  780,  780,
+ /* 12400 */   780,  780,   20,   21,   26,   69,   70,   86,   99,   75,
+ /* 12410 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /* 12420 */   432,  780,  780,  780,  780,  780,  780,  691,  780,  780,
+ /* 12430 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 12440 */   780,  780,  126,  780,  780,  780,  780,  780,  692,  780,
+ /* 12450 */   780,  780,   84,  780,  780,  780,  780,  780,  780,  780,
+ /* 12460 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /* 12470 */   780,  780,  780,  780,  780,  780,  780,   20,   21,   26,
+ /* 12480 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /* 12490 */    47,   60,   94,  106,  107,  780,  780,  780,   84,  780,
+ /* 12500 */   780,  780,  780,  780,  687,  780,  126,  108,  111,   63,
+ /* 12510 */   118,  780,   66,  688,  689,  780,  780,  780,  780,  780,
+ /* 12520 */   434,  753,  780,   20,   21,   26,   69,   70,   86,   99,
+ /* 12530 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /* 12540 */   107,  780,  126,  780,   94,  780,  780,  780,  780,  780,
+ /* 12550 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 12560 */   780,  780,   84,  780,  780,  780,  780,  780,  780,  780,
+ /* 12570 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /* 12580 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 12590 */   780,  780,  780,  780,  780,  436,  780,  780,   84,   46,
+ /* 12600 */    47,   60,   94,  106,  107,  780,  780,  108,  111,   63,
+ /* 12610 */   118,  780,   66,  780,  780,  780,  780,  126,  780,  780,
+ /* 12620 */   780,  780,  780,   20,   21,   26,   69,   70,   86,   99,
+ /* 12630 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /* 12640 */   107,  438,  780,  780,  780,  780,  780,  780,  691,  780,
+ /* 12650 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 12660 */   780,  780,  780,  126,  780,  780,  780,  780,  780,  692,
+ /* 12670 */   780,  780,  780,   84,  780,  780,  780,  780,  780,  780,
+ /* 12680 */   780,  780,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 12690 */   780,  780,  780,  780,  780,  780,  780,  780,   20,   21,
+ /* 12700 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /* 12710 */   110,   47,   60,   94,  106,  107,  780,  780,  780,   84,
+ /* 12720 */   780,  780,  780,  780,  780,  687,  780,  126,  108,  111,
+ /* 12730 */    63,  118,  780,   66,  688,  689,  780,  780,  780,  780,
+ /* 12740 */   780,  440,  758,  780,   20,   21,   26,   69,   70,   86,
+ /* 12750 */    99,   75,   76,   77,   89,  100,  110,   47,   60,   94,
+ /* 12760 */   106,  107,  780,  126,  780,   94,  780,  780,  780,  780,
+ /* 12770 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 12780 */   780,  780,  780,   84,  780,  780,  780,  780,  780,  780,
+ /* 12790 */   780,  780,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 12800 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 12810 */   780,  780,  780,  780,  780,  780,  442,  780,  780,   84,
+ /* 12820 */    49,   47,   60,   94,  106,  107,  780,  780,  108,  111,
+ /* 12830 */    63,  118,  780,   66,  780,  780,  780,  780,  126,  780,
+ /* 12840 */   780,  780,  780,  780,   20,   21,   26,   69,   70,   86,
+ /* 12850 */    99,   75,   76,   77,   89,  100,  110,   47,   60,   94,
+ /* 12860 */   106,  107,  444,  780,  780,  780,  780,  780,  780,  691,
+ /* 12870 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 12880 */   780,  780,  780,  780,  126,  780,  780,  780,  780,  780,
+ /* 12890 */   692,  780,  780,  780,   84,  780,  780,  780,  780,  780,
+ /* 12900 */   780,  780,  780,  108,  111,   63,  118,  780,   66,  780,
+ /* 12910 */   780,  780,  780,  780,  780,  780,  780,  780,  780,   20,
+ /* 12920 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /* 12930 */   100,  110,   47,   60,   94,  106,  107,  780,  780,  780,
+ /* 12940 */    84,  780,  780,  780,  780,  780,  687,  780,  126,  108,
+ /* 12950 */   111,   63,  118,  780,   66,  688,  689,  780,  780,  780,
+ /* 12960 */   780,  780,  446,  769,  780,   20,   21,   26,   69,   70,
+ /* 12970 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /* 12980 */    94,  106,  107,  780,  126,  780,   94,  780,  780,  780,
+ /* 12990 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 13000 */   780,  780,  780,  780,   84,  780,  780,  780,  780,  780,
+ /* 13010 */   780,  780,  780,  108,  111,   63,  118,  780,   66,  780,
+ /* 13020 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 13030 */   780,  780,  780,  780,  780,  780,  780,  448,  780,  780,
+ /* 13040 */    84,   51,   47,   60,   94,  106,  107,  780,  780,  108,
+ /* 13050 */   111,   63,  118,  780,   66,  780,  780,  780,  780,  126,
+ /* 13060 */   780,  780,  780,  780,  780,   20,   21,   26,   69,   70,
+ /* 13070 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /* 13080 */    94,  106,  107,  450,  780,  780,  780,  780,  780,  780,
+ /* 13090 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 13100 */   780,  780,  780,  780,  780,  126,  780,  780,  780,  780,
+ /* 13110 */   780,  780,  780,  780,  780,   84,  780,  780,  780,  780,
+ /* 13120 */   780,  780,  780,  780,  108,  111,   63,  118,  780,   66,
+ /* 13130 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 13140 */    20,   21,   26,   69,   70,   86,   99,   75,   76,   77,
+ /* 13150 */    89,  100,  110,   47,   60,   94,  106,  107,  780,  780,
+ /* 13160 */   780,   84,  780,  780,  780,  780,  780,  780,  780,  126,
+ /* 13170 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  780,
+ /* 13180 */   780,  780,  780,  452,  780,  780,   20,   21,   26,   69,
+ /* 13190 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /* 13200 */    60,   94,  106,  107,  780,  126,  780,  780,  780,  780,
+ /* 13210 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 13220 */   780,  780,  780,  780,  780,   84,  780,  780,  780,  780,
+ /* 13230 */   780,  780,  780,  780,  108,  111,   63,  118,  780,   66,
+ /* 13240 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 13250 */   780,  780,  780,  780,  780,  780,  780,  780,  454,  780,
+ /* 13260 */   780,   84,   53,   47,   60,   94,  106,  107,  780,  780,
+ /* 13270 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  780,
+ /* 13280 */   126,  780,  780,  780,  780,  780,   20,   21,   26,   69,
+ /* 13290 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /* 13300 */    60,   94,  106,  107,  456,  780,  780,  780,  780,  780,
+ /* 13310 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 13320 */   780,  780,  780,  780,  780,  780,  126,  780,  780,  780,
+ /* 13330 */   780,  780,  780,  780,  780,  780,   84,  780,  780,  780,
+ /* 13340 */   780,  780,  780,  780,  780,  108,  111,   63,  118,  780,
+ /* 13350 */    66,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 13360 */   780,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /* 13370 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  780,
+ /* 13380 */   780,  780,   84,  780,  780,  780,  780,  780,  780,  780,
+ /* 13390 */   126,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /* 13400 */   780,  780,  780,  780,  458,  780,  780,   20,   21,   26,
+ /* 13410 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /* 13420 */    47,   60,   94,  106,  107,  780,  126,  780,  780,  780,
+ /* 13430 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 13440 */   780,  780,  780,  780,  780,  780,   84,  780,  780,  780,
+ /* 13450 */   780,  780,  780,  780,  780,  108,  111,   63,  118,  780,
+ /* 13460 */    66,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 13470 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  460,
+ /* 13480 */   780,  780,   84,   55,   47,   60,   94,  106,  107,  780,
+ /* 13490 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /* 13500 */   780,  126,  780,  780,  780,  780,  780,   20,   21,   26,
+ /* 13510 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /* 13520 */    47,   60,   94,  106,  107,  462,  780,  780,  780,  780,
+ /* 13530 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 13540 */   780,  780,  780,  780,  780,  780,  780,  126,  780,  780,
+ /* 13550 */   780,  780,  780,  780,  780,  780,  780,   84,  780,  780,
+ /* 13560 */   780,  780,  780,  780,  780,  780,  108,  111,   63,  118,
+ /* 13570 */   780,   66,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 13580 */   780,  780,   20,   21,   26,   69,   70,   86,   99,   75,
+ /* 13590 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /* 13600 */   780,  780,  780,   84,  780,  780,  780,  780,  780,  780,
+ /* 13610 */   780,  126,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 13620 */   780,  780,  780,  780,  780,  464,  780,  780,   20,   21,
+ /* 13630 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /* 13640 */   110,   47,   60,   94,  106,  107,  780,  126,  780,  780,
+ /* 13650 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 13660 */   780,  780,  780,  780,  780,  780,  780,   84,  780,  780,
+ /* 13670 */   780,  780,  780,  780,  780,  780,  108,  111,   63,  118,
+ /* 13680 */   780,   66,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 13690 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 13700 */   467,  780,  780,   84,   57,   47,   60,   94,  106,  107,
+ /* 13710 */   780,  780,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 13720 */   780,  780,  126,  780,  780,  780,  780,  780,   20,   21,
+ /* 13730 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /* 13740 */   110,   47,   60,   94,  106,  107,  469,  780,  780,  780,
+ /* 13750 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 13760 */   780,  780,  780,  780,  780,  780,  780,  780,  126,  780,
+ /* 13770 */   780,  780,  780,  780,  780,  780,  780,  780,   84,  780,
+ /* 13780 */   780,  780,  780,  780,  780,  780,  780,  108,  111,   63,
+ /* 13790 */   118,  780,   66,  780,  780,  780,  780,  780,  780,  780,
+ /* 13800 */   780,  780,  780,   20,   21,   26,   69,   70,   86,   99,
+ /* 13810 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /* 13820 */   107,  780,  780,  780,   84,  780,  780,  780,  780,  780,
+ /* 13830 */   780,  780,  126,  108,  111,   63,  118,  780,   66,  780,
+ /* 13840 */   780,  780,  780,  780,  780,  780,  471,  780,  780,   20,
+ /* 13850 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /* 13860 */   100,  110,   47,   60,   94,  106,  107,  780,  126,  780,
+ /* 13870 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 13880 */   780,  780,  780,  780,  780,  780,  780,  780,   84,  780,
+ /* 13890 */   780,  780,  780,  780,  780,  780,  780,  108,  111,   63,
+ /* 13900 */   118,  780,   66,  780,  780,  780,  780,  780,  780,  780,
+ /* 13910 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 13920 */   780,  473,  780,  780,   84,   59,   47,   60,   94,  106,
+ /* 13930 */   107,  780,  780,  108,  111,   63,  118,  780,   66,  780,
+ /* 13940 */   780,  780,  780,  126,  780,  780,  780,  780,  780,   20,
+ /* 13950 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /* 13960 */   100,  110,   47,   60,   94,  106,  107,  475,  780,  780,
+ /* 13970 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 13980 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  126,
+ /* 13990 */   780,  780,  780,  780,  780,  780,  780,  780,  780,   84,
+ /* 14000 */   780,  780,  780,  780,  780,  780,  780,  780,  108,  111,
+ /* 14010 */    63,  118,  780,   66,  780,  780,  780,  780,  780,  780,
+ /* 14020 */   780,  780,  780,  780,   20,   21,   26,   69,   70,   86,
+ /* 14030 */    99,   75,   76,   77,   89,  100,  110,   47,   60,   94,
+ /* 14040 */   106,  107,  780,  780,  780,   84,  780,  780,  780,  780,
+ /* 14050 */   780,  780,  780,  126,  108,  111,   63,  118,  780,   66,
+ /* 14060 */   780,  780,  780,  780,  780,  780,  780,  477,  780,  780,
+ /* 14070 */    20,   21,   26,   69,   70,   86,   99,   75,   76,   77,
+ /* 14080 */    89,  100,  110,   47,   60,   94,  106,  107,  780,  126,
+ /* 14090 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14100 */   780,  780,  780,  780,  780,  780,  780,  780,  780,   84,
+ /* 14110 */   780,  780,  780,  780,  780,  780,  780,  780,  108,  111,
+ /* 14120 */    63,  118,  780,   66,  780,  780,  780,  780,  780,  780,
+ /* 14130 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14140 */   780,  780,  479,  780,  780,   84,   83,   47,   60,   94,
+ /* 14150 */   106,  107,  780,  780,  108,  111,   63,  118,  780,   66,
+ /* 14160 */   780,  780,  780,  780,  126,  780,  780,  780,  780,  780,
+ /* 14170 */    20,   21,   26,   69,   70,   86,   99,   75,   76,   77,
+ /* 14180 */    89,  100,  110,   47,   60,   94,  106,  107,  481,  780,
+ /* 14190 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14200 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14210 */   126,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14220 */    84,  780,  780,  780,  780,  780,  780,  780,  780,  108,
+ /* 14230 */   111,   63,  118,  780,   66,  780,  780,  780,  780,  780,
+ /* 14240 */   780,  780,  780,  780,  780,   20,   21,   26,   69,   70,
+ /* 14250 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /* 14260 */    94,  106,  107,  780,  780,  780,   84,  780,  780,  780,
+ /* 14270 */   780,  780,  780,  780,  126,  108,  111,   63,  118,  780,
+ /* 14280 */    66,  780,  780,  780,  780,  780,  780,  780,  483,  780,
+ /* 14290 */   780,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /* 14300 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  780,
+ /* 14310 */   126,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14320 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14330 */    84,  780,  780,  780,  780,  780,  780,  780,  780,  108,
+ /* 14340 */   111,   63,  118,  780,   66,  780,  780,  780,  780,  780,
+ /* 14350 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14360 */   780,  780,  780,  485,  780,  780,   84,   93,   47,   60,
+ /* 14370 */    94,  106,  107,  780,  780,  108,  111,   63,  118,  780,
+ /* 14380 */    66,  780,  780,  780,  780,  126,  780,  780,  780,  780,
+ /* 14390 */   780,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /* 14400 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  487,
+ /* 14410 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14420 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14430 */   780,  126,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14440 */   780,   84,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14450 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  780,
+ /* 14460 */   780,  780,  780,  780,  780,  780,   20,   21,   26,   69,
+ /* 14470 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /* 14480 */    60,   94,  106,  107,  780,  780,  780,   84,  780,  780,
+ /* 14490 */   780,  780,  780,  780,  780,  126,  108,  111,   63,  118,
+ /* 14500 */   780,   66,  780,  780,  780,  780,  780,  780,  780,  489,
+ /* 14510 */   780,  780,   20,   21,   26,   69,   70,   86,   99,   75,
+ /* 14520 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /* 14530 */   780,  126,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14540 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14550 */   780,   84,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14560 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  780,
+ /* 14570 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14580 */   780,  780,  780,  780,  491,  780,  780,   84,  102,   47,
+ /* 14590 */    60,   94,  106,  107,  780,  780,  108,  111,   63,  118,
+ /* 14600 */   780,   66,  780,  780,  780,  780,  126,  780,  780,  780,
+ /* 14610 */   780,  780,   20,   21,   26,   69,   70,   86,   99,   75,
+ /* 14620 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /* 14630 */   493,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14640 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14650 */   780,  780,  126,  780,  780,  780,  780,  780,  780,  780,
+ /* 14660 */   780,  780,   84,  780,  780,  780,  780,  780,  780,  780,
+ /* 14670 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /* 14680 */   780,  780,  780,  780,  780,  780,  780,   20,   21,   26,
+ /* 14690 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /* 14700 */    47,   60,   94,  106,  107,  780,  780,  780,   84,  780,
+ /* 14710 */   780,  780,  780,  780,  780,  780,  126,  108,  111,   63,
+ /* 14720 */   118,  780,   66,  780,  780,  780,  780,  780,  780,  780,
+ /* 14730 */   495,  780,  780,   20,   21,   26,   69,   70,   86,   99,
+ /* 14740 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /* 14750 */   107,  780,  126,  780,  780,  780,  780,  780,  780,  780,
+ /* 14760 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14770 */   780,  780,   84,  780,  780,  780,  780,  780,  780,  780,
+ /* 14780 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /* 14790 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14800 */   780,  780,  780,  780,  780,  497,  780,  780,   84,  165,
+ /* 14810 */    47,   60,   94,  106,  107,  780,  780,  108,  111,   63,
+ /* 14820 */   118,  780,   66,  780,  780,  780,  780,  126,  780,  780,
+ /* 14830 */   780,  780,  780,   20,   21,   26,   69,   70,   86,   99,
+ /* 14840 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /* 14850 */   107,  499,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14860 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14870 */   780,  780,  780,  126,  780,  780,  780,  780,  780,  780,
+ /* 14880 */   780,  780,  780,   84,  780,  780,  780,  780,  780,  780,
+ /* 14890 */   780,  780,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 14900 */   780,  780,  780,  780,  780,  780,  780,  780,   20,   21,
+ /* 14910 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /* 14920 */   110,   47,   60,   94,  106,  107,  780,  780,  780,   84,
+ /* 14930 */   780,  780,  780,  780,  780,  780,  780,  126,  108,  111,
+ /* 14940 */    63,  118,  780,   66,  780,  780,  780,  780,  780,  780,
+ /* 14950 */   780,  501,  780,  780,   20,   21,   26,   69,   70,   86,
+ /* 14960 */    99,   75,   76,   77,   89,  100,  110,   47,   60,   94,
+ /* 14970 */   106,  107,  780,  126,  780,  780,  780,  780,  780,  780,
+ /* 14980 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 14990 */   780,  780,  780,   84,  780,  780,  780,  780,  780,  780,
+ /* 15000 */   780,  780,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 15010 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15020 */   780,  780,  780,  780,  780,  780,  503,  780,  780,   84,
+ /* 15030 */   167,   47,   60,   94,  106,  107,  780,  780,  108,  111,
+ /* 15040 */    63,  118,  780,   66,  780,  780,  780,  780,  126,  780,
+ /* 15050 */   780,  780,  780,  780,   20,   21,   26,   69,   70,   86,
+ /* 15060 */    99,   75,   76,   77,   89,  100,  110,   47,   60,   94,
+ /* 15070 */   106,  107,  505,  780,  780,  780,  780,  780,  780,  780,
+ /* 15080 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15090 */   780,  780,  780,  780,  126,  780,  780,  780,  780,  780,
+ /* 15100 */   780,  780,  780,  780,   84,  780,  780,  780,  780,  780,
+ /* 15110 */   780,  780,  780,  108,  111,   63,  118,  780,   66,  780,
+ /* 15120 */   780,  780,  780,  780,  780,  780,  780,  780,  780,   20,
+ /* 15130 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /* 15140 */   100,  110,   47,   60,   94,  106,  107,  780,  780,  780,
+ /* 15150 */    84,  780,  780,  780,  780,  780,  780,  780,  126,  108,
+ /* 15160 */   111,   63,  118,  780,   66,  780,  780,  780,  780,  780,
+ /* 15170 */   780,  780,  507,  780,  780,   20,   21,   26,   69,   70,
+ /* 15180 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /* 15190 */    94,  106,  107,  780,  126,  780,  780,  780,  780,  780,
+ /* 15200 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15210 */   780,  780,  780,  780,   84,  780,  780,  780,  780,  780,
+ /* 15220 */   780,  780,  780,  108,  111,   63,  118,  780,   66,  780,
+ /* 15230 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15240 */   780,  780,  780,  780,  780,  780,  780,  509,  780,  780,
+ /* 15250 */    84,  169,   47,   60,   94,  106,  107,  780,  780,  108,
+ /* 15260 */   111,   63,  118,  780,   66,  780,  780,  780,  780,  126,
+ /* 15270 */   780,  780,  780,  780,  780,   20,   21,   26,   69,   70,
+ /* 15280 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /* 15290 */    94,  106,  107,  512,  780,  780,  780,  780,  780,  780,
+ /* 15300 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15310 */   780,  780,  780,  780,  780,  126,  780,  780,  780,  780,
+ /* 15320 */   780,  780,  780,  780,  780,   84,  780,  780,  780,  780,
+ /* 15330 */   780,  780,  780,  780,  108,  111,   63,  118,  780,   66,
+ /* 15340 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15350 */    20,   21,   26,   69,   70,   86,   99,   75,   76,   77,
+ /* 15360 */    89,  100,  110,   47,   60,   94,  106,  107,  780,  780,
+ /* 15370 */   780,   84,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15380 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  780,
+ /* 15390 */   780,  780,  780,  515,  780,  780,   20,   21,   26,   69,
+ /* 15400 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /* 15410 */    60,   94,  106,  107,  780,  126,  780,  780,  780,  780,
+ /* 15420 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15430 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15440 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15450 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15460 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  523,
+ /* 15470 */   780,   84,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15480 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  780,
+ /* 15490 */   780,  126,  780,  780,  780,  780,   20,   21,   26,   69,
+ /* 15500 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /* 15510 */    60,   94,  106,  107,  521,  520,  780,  780,  780,  780,
+ /* 15520 */   113,  123,  780,  143,  780,  780,  780,  780,  780,  780,
+ /* 15530 */   127,  131,  115,  780,  780,  780,  780,  780,  780,  780,
+ /* 15540 */   780,  780,  780,  780,  780,  780,   67,   84,  780,  780,
+ /* 15550 */   780,  780,  780,  780,  780,  780,  108,  111,   63,  118,
+ /* 15560 */   780,   66,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15570 */   780,  780,   20,   21,   26,   69,   70,   86,   99,   75,
+ /* 15580 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /* 15590 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15600 */   780,  780,  780,  780,   48,   50,   52,   54,  780,  780,
+ /* 15610 */   780,  780,  780,  780,  525,  780,   56,   58,  780,   64,
+ /* 15620 */    65,   95,   96,   97,  103,  104,  105,  116,  117,  119,
+ /* 15630 */   780,  780,  780,  780,  780,  780,  126,  780,  780,  780,
+ /* 15640 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15650 */   780,  780,  780,  780,  780,  780,  780,  527,  780,  780,
+ /* 15660 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15670 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  126,
+ /* 15680 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15690 */   780,  780,   84,  780,  780,  780,  780,  780,  780,  780,
+ /* 15700 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /* 15710 */   780,  780,  780,  780,  529,  780,  780,   20,   21,   26,
+ /* 15720 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /* 15730 */    47,   60,   94,  106,  107,   84,  126,  780,  780,  780,
+ /* 15740 */   780,  780,  780,  780,  108,  111,   63,  118,  780,   66,
+ /* 15750 */   780,  780,  780,  780,  780,  780,  780,  531,  780,  780,
+ /* 15760 */    20,   21,   26,   69,   70,   86,   99,   75,   76,   77,
+ /* 15770 */    89,  100,  110,   47,   60,   94,  106,  107,  780,  126,
+ /* 15780 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15790 */   780,  780,   84,  780,  780,  780,  780,  780,  780,  780,
+ /* 15800 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /* 15810 */   780,  780,  780,  780,  780,  780,  780,   20,   21,   26,
+ /* 15820 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /* 15830 */    47,   60,   94,  106,  107,   84,  533,  780,  780,  780,
+ /* 15840 */   780,  780,  780,  780,  108,  111,   63,  118,  780,   66,
+ /* 15850 */   780,  780,  780,  780,  780,  780,  780,  780,  126,  780,
+ /* 15860 */    20,   21,   26,   69,   70,   86,   99,   75,   76,   77,
+ /* 15870 */    89,  100,  110,   47,   60,   94,  106,  107,  780,  535,
+ /* 15880 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15890 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15900 */   780,  126,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 15910 */   780,  780,  780,  780,   84,  780,  780,  780,  780,  780,
+ /* 15920 */   780,  780,  780,  108,  111,   63,  118,  780,   66,  780,
+ /* 15930 */   780,  780,  780,  780,  780,  780,  537,  780,  780,   20,
+ /* 15940 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /* 15950 */   100,  110,   47,   60,   94,  106,  107,   84,  126,  780,
+ /* 15960 */   780,  780,  780,  780,  780,  780,  108,  111,   63,  118,
+ /* 15970 */   780,   66,  780,  780,  780,  780,  780,  780,  780,  539,
+ /* 15980 */   780,  780,   20,   21,   26,   69,   70,   86,   99,   75,
+ /* 15990 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /* 16000 */   780,  126,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 16010 */   780,  780,  780,  780,   84,  780,  780,  780,  780,  780,
+ /* 16020 */   780,  780,  780,  108,  111,   63,  118,  780,   66,  780,
+ /* 16030 */   780,  780,  780,  780,  780,  780,  780,  780,  780,   20,
+ /* 16040 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /* 16050 */   100,  110,   47,   60,   94,  106,  107,   84,  541,  780,
+ /* 16060 */   780,  780,  780,  780,  780,  780,  108,  111,   63,  118,
+ /* 16070 */   780,   66,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 16080 */   126,  780,   20,   21,   26,   69,   70,   86,   99,   75,
+ /* 16090 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /* 16100 */   780,  543,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 16110 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 16120 */   780,  780,  780,  126,  780,  780,  780,  780,  780,  780,
+ /* 16130 */   780,  780,  780,  780,  780,  780,   84,  780,  780,  780,
+ /* 16140 */   780,  780,  780,  780,  780,  108,  111,   63,  118,  780,
+ /* 16150 */    66,  780,  780,  780,  780,  780,  780,  780,  545,  780,
+ /* 16160 */   780,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /* 16170 */    77,   89,  100,  110,   47,   60,   94,  106,  107,   84,
+ /* 16180 */   126,  780,  780,  780,  780,  780,  780,  780,  108,  111,
+ /* 16190 */    63,  118,  780,   66,  780,  780,  780,  780,  780,  780,
+ /* 16200 */   780,  547,  780,  780,   20,   21,   26,   69,   70,   86,
+ /* 16210 */    99,   75,   76,   77,   89,  100,  110,   47,   60,   94,
+ /* 16220 */   106,  107,  780,  126,  780,  780,  780,  780,  780,  780,
+ /* 16230 */   780,  780,  780,  780,  780,  780,   84,  780,  780,  780,
+ /* 16240 */   780,  780,  780,  780,  780,  108,  111,   63,  118,  780,
+ /* 16250 */    66,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 16260 */   780,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /* 16270 */    77,   89,  100,  110,   47,   60,   94,  106,  107,   84,
+ /* 16280 */   549,  780,  780,  780,  780,  780,  780,  780,  108,  111,
+ /* 16290 */    63,  118,  780,   66,  780,  780,  780,  780,  780,  780,
+ /* 16300 */   780,  780,  126,  780,   20,   21,   26,   69,   70,   86,
+ /* 16310 */    99,   75,   76,   77,   89,  100,  110,   47,   60,   94,
+ /* 16320 */   106,  107,  780,  551,  780,  780,  780,  780,  780,  780,
+ /* 16330 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 16340 */   780,  780,  780,  780,  780,  126,  780,  780,  780,  780,
+ /* 16350 */   780,  780,  780,  780,  780,  780,  780,  780,   84,  780,
+ /* 16360 */   780,  780,  780,  780,  780,  780,  780,  108,  111,   63,
+ /* 16370 */   118,  780,   66,  780,  780,  780,  780,  780,  780,  780,
+ /* 16380 */   553,  780,  780,   20,   21,   26,   69,   70,   86,   99,
+ /* 16390 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /* 16400 */   107,   84,  126,  780,  780,  780,  780,  780,  780,  780,
+ /* 16410 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  780,
+ /* 16420 */   780,  780,  780,  555,  780,  780,   20,   21,   26,   69,
+ /* 16430 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /* 16440 */    60,   94,  106,  107,  780,  126,  780,  780,  780,  780,
+ /* 16450 */   780,  780,  780,  780,  780,  780,  780,  780,   84,  780,
+ /* 16460 */   780,  780,  780,  780,  780,  780,  780,  108,  111,   63,
+ /* 16470 */   118,  780,   66,  780,  780,  780,  780,  780,  780,  780,
+ /* 16480 */   780,  780,  780,   20,   21,   26,   69,   70,   86,   99,
+ /* 16490 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /* 16500 */   107,   84,  557,  780,  780,  780,  780,  780,  780,  780,
+ /* 16510 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  780,
+ /* 16520 */   780,  780,  780,  780,  126,  780,   20,   21,   26,   69,
+ /* 16530 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /* 16540 */    60,   94,  106,  107,  780,  559,  780,  780,  780,  780,
+ /* 16550 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 16560 */   780,  780,  780,  780,  780,  780,  780,  126,  780,  780,
+ /* 16570 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 16580 */    84,  780,  780,  780,  780,  780,  780,  780,  780,  108,
+ /* 16590 */   111,   63,  118,  780,   66,  780,  780,  780,  780,  780,
+ /* 16600 */   780,  780,  561,  780,  780,   20,   21,   26,   69,   70,
+ /* 16610 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /* 16620 */    94,  106,  107,   84,  126,  780,  780,  780,  780,  780,
+ /* 16630 */   780,  780,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 16640 */   780,  780,  780,  780,  780,  563,  780,  780,   20,   21,
+ /* 16650 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /* 16660 */   110,   47,   60,   94,  106,  107,  780,  126,  780,  780,
+ /* 16670 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 16680 */    84,  780,  780,  780,  780,  780,  780,  780,  780,  108,
+ /* 16690 */   111,   63,  118,  780,   66,  780,  780,  780,  780,  780,
+ /* 16700 */   780,  780,  780,  780,  780,   20,   21,   26,   69,   70,
+ /* 16710 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /* 16720 */    94,  106,  107,   84,  780,  780,  780,  780,  780,  780,
+ /* 16730 */   780,  780,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 16740 */   780,  780,  780,  780,  780,  780,  780,  780,   20,   21,
+ /* 16750 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /* 16760 */   110,   47,   60,   94,  106,  107,  569,  568,  780,  780,
+ /* 16770 */   780,  780,  113,  123,  780,  143,  780,  780,  780,  780,
+ /* 16780 */   780,  780,  127,  131,  115,  780,  780,  780,  780,  780,
+ /* 16790 */   780,  780,  780,  780,  780,  780,  780,  780,   67,  780,
+ /* 16800 */   780,  780,  575,  576,  780,  780,  780,  780,  113,  123,
+ /* 16810 */   780,  143,  780,  780,  780,  780,  780,  780,  127,  131,
+ /* 16820 */   115,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 16830 */   780,  780,  780,  780,   67,  780,  780,  780,  780,  780,
+ /* 16840 */   579,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 16850 */   780,  780,  780,  780,  780,  780,   48,   50,   52,   54,
+ /* 16860 */   780,  780,  126,  780,  780,  780,  780,  780,   56,   58,
+ /* 16870 */   780,   64,   65,   95,   96,   97,  103,  104,  105,  116,
+ /* 16880 */   117,  119,  780,  780,  581,  780,  780,  780,  780,  780,
+ /* 16890 */   780,  780,   48,   50,   52,   54,  780,  780,  780,  780,
+ /* 16900 */   780,  780,  780,  780,   56,   58,  126,   64,   65,   95,
+ /* 16910 */    96,   97,  103,  104,  105,  116,  117,  119,   84,  780,
+ /* 16920 */   780,  780,  780,  780,  780,  780,  780,  108,  111,   63,
+ /* 16930 */   118,  780,   66,  780,  780,  780,  780,  780,  780,  780,
+ /* 16940 */   780,  780,  583,   20,   21,   26,   69,   70,   86,   99,
+ /* 16950 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /* 16960 */   107,  780,   84,  780,  126,  780,  780,  780,  780,  780,
+ /* 16970 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /* 16980 */   780,  780,  780,  780,  780,  780,  780,   20,   21,   26,
+ /* 16990 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /* 17000 */    47,   60,   94,  106,  107,  585,  780,  780,  780,  780,
+ /* 17010 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 17020 */    84,  780,  780,  780,  780,  780,  780,  126,  780,  108,
+ /* 17030 */   111,   63,  118,  780,   66,  780,  780,  780,  780,  780,
+ /* 17040 */   780,  780,  780,  780,  780,   20,   21,   26,   69,   70,
+ /* 17050 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /* 17060 */    94,  106,  107,  587,  780,  780,  780,  780,  780,  780,
+ /* 17070 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 17080 */   780,  780,  780,   84,  780,  126,  780,  780,  780,  780,
+ /* 17090 */   780,  780,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 17100 */   780,  780,  780,  780,  780,  780,  589,  780,   20,   21,
+ /* 17110 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /* 17120 */   110,   47,   60,   94,  106,  107,  780,  780,  126,  780,
+ /* 17130 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 17140 */   780,   84,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 17150 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  780,
+ /* 17160 */   780,  780,  780,  591,  780,  780,   20,   21,   26,   69,
+ /* 17170 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /* 17180 */    60,   94,  106,  107,   84,  126,  780,  780,  780,  780,
+ /* 17190 */   780,  780,  780,  108,  111,   63,  118,  780,   66,  780,
+ /* 17200 */   780,  780,  780,  780,  780,  780,  780,  780,  780,   20,
+ /* 17210 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /* 17220 */   100,  110,   47,   60,   94,  106,  107,  593,  780,  780,
+ /* 17230 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 17240 */   780,   84,  780,  780,  780,  780,  780,  780,  780,  126,
+ /* 17250 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  780,
+ /* 17260 */   780,  780,  780,  780,  780,  780,   20,   21,   26,   69,
+ /* 17270 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /* 17280 */    60,   94,  106,  107,  595,  780,  780,  780,  780,  780,
+ /* 17290 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 17300 */   780,  780,  780,  780,  780,   84,  126,  780,  780,  780,
+ /* 17310 */   780,  780,  780,  780,  108,  111,   63,  118,  780,   66,
+ /* 17320 */   780,  780,  780,  780,  780,  780,  780,  597,  780,  780,
+ /* 17330 */    20,   21,   26,   69,   70,   86,   99,   75,   76,   77,
+ /* 17340 */    89,  100,  110,   47,   60,   94,  106,  107,  780,  126,
+ /* 17350 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 17360 */   780,  780,   84,  780,  780,  780,  780,  780,  780,  780,
+ /* 17370 */   780,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /* 17380 */   780,  780,  780,  780,  599,  780,  780,   20,   21,   26,
+ /* 17390 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /* 17400 */    47,   60,   94,  106,  107,   84,  126,  780,  780,  780,
+ /* 17410 */   780,  780,  780,  780,  108,  111,   63,  118,  780,   66,
+ /* 17420 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 17430 */    20,   21,   26,   69,   70,   86,   99,   75,   76,   77,
+ /* 17440 */    89,  100,  110,   47,   60,   94,  106,  107,  601,  780,
+ /* 17450 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 17460 */   780,  780,   84,  780,  780,  780,  780,  780,  780,  780,
+ /* 17470 */   126,  108,  111,   63,  118,  780,   66,  780,  780,  780,
+ /* 17480 */   780,  780,  780,  780,  780,  780,  780,   20,   21,   26,
+ /* 17490 */    69,   70,   86,   99,   75,   76,   77,   89,  100,  110,
+ /* 17500 */    47,   60,   94,  106,  107,  603,  780,  780,  780,  780,
+ /* 17510 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 17520 */   780,  780,  780,  780,  780,  780,   84,  126,  780,  780,
+ /* 17530 */   780,  780,  780,  780,  780,  108,  111,   63,  118,  780,
+ /* 17540 */    66,  780,  780,  780,  780,  780,  780,  780,  605,  780,
+ /* 17550 */   780,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /* 17560 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  780,
+ /* 17570 */   126,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 17580 */   780,  780,  780,   84,  780,  780,  780,  780,  780,  780,
+ /* 17590 */   780,  780,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 17600 */   780,  780,  780,  780,  780,  607,  780,  780,   20,   21,
+ /* 17610 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /* 17620 */   110,   47,   60,   94,  106,  107,   84,  126,  780,  780,
+ /* 17630 */   780,  780,  780,  780,  780,  108,  111,   63,  118,  780,
+ /* 17640 */    66,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 17650 */   780,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /* 17660 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  609,
+ /* 17670 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 17680 */   780,  780,  780,   84,  780,  780,  780,  780,  780,  780,
+ /* 17690 */   780,  126,  108,  111,   63,  118,  780,   66,  780,  780,
+ /* 17700 */   780,  780,  780,  780,  780,  780,  780,  780,   20,   21,
+ /* 17710 */    26,   69,   70,   86,   99,   75,   76,   77,   89,  100,
+ /* 17720 */   110,   47,   60,   94,  106,  107,  611,  780,  780,  780,
+ /* 17730 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 17740 */   780,  780,  780,  780,  780,  780,  780,   84,  126,  780,
+ /* 17750 */   780,  780,  780,  780,  780,  780,  108,  111,   63,  118,
+ /* 17760 */   780,   66,  780,  780,  780,  780,  780,  780,  780,  613,
+ /* 17770 */   780,  780,   20,   21,   26,   69,   70,   86,   99,   75,
+ /* 17780 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /* 17790 */   780,  126,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 17800 */   780,  780,  780,  780,   84,  780,  780,  780,  780,  780,
+ /* 17810 */   780,  780,  780,  108,  111,   63,  118,  780,   66,  780,
+ /* 17820 */   780,  780,  780,  780,  780,  780,  615,  780,  780,   20,
+ /* 17830 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /* 17840 */   100,  110,   47,   60,   94,  106,  107,   84,  126,  780,
+ /* 17850 */   780,  780,  780,  780,  780,  780,  108,  111,   63,  118,
+ /* 17860 */   780,   66,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 17870 */   780,  780,   20,   21,   26,   69,   70,   86,   99,   75,
+ /* 17880 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /* 17890 */   617,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 17900 */   780,  780,  780,  780,   84,  780,  780,  780,  780,  780,
+ /* 17910 */   780,  780,  126,  108,  111,   63,  118,  780,   66,  780,
+ /* 17920 */   780,  780,  780,  780,  780,  780,  780,  780,  780,   20,
+ /* 17930 */    21,   26,   69,   70,   86,   99,   75,   76,   77,   89,
+ /* 17940 */   100,  110,   47,   60,   94,  106,  107,  619,  780,  780,
+ /* 17950 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 17960 */   780,  780,  780,  780,  780,  780,  780,  780,   84,  126,
+ /* 17970 */   780,  780,  780,  780,  780,  780,  780,  108,  111,   63,
+ /* 17980 */   118,  780,   66,  780,  780,  780,  780,  780,  780,  780,
+ /* 17990 */   621,  780,  780,   20,   21,   26,   69,   70,   86,   99,
+ /* 18000 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /* 18010 */   107,  780,  126,  780,  780,  780,  780,  780,  780,  780,
+ /* 18020 */   780,  780,  780,  780,  780,   84,  780,  780,  780,  780,
+ /* 18030 */   780,  780,  780,  780,  108,  111,   63,  118,  780,   66,
+ /* 18040 */   780,  780,  780,  780,  780,  780,  780,  648,  780,  780,
+ /* 18050 */    20,   21,   26,   69,   70,   86,   99,   75,   76,   77,
+ /* 18060 */    89,  100,  110,   47,   60,   94,  106,  107,   84,  126,
+ /* 18070 */   780,  780,  780,  780,  780,  780,  780,  108,  111,   63,
+ /* 18080 */   118,  780,   66,  780,  780,  780,  780,  780,  780,  780,
+ /* 18090 */   780,  780,  780,   20,   21,   26,   69,   70,   86,   99,
+ /* 18100 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /* 18110 */   107,  669,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 18120 */   780,  780,  780,  780,  780,   84,  780,  780,  780,  780,
+ /* 18130 */   780,  780,  780,  126,  108,  111,   63,  118,  780,   66,
+ /* 18140 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 18150 */    20,   21,   26,   69,   70,   86,   99,   75,   76,   77,
+ /* 18160 */    89,  100,  110,   47,   60,   94,  106,  107,  677,  780,
+ /* 18170 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 18180 */   780,  780,  780,  780,  780,  780,  780,  780,  780,   84,
+ /* 18190 */   126,  780,  780,  780,  780,  780,  780,  780,  108,  111,
+ /* 18200 */    63,  118,  780,   66,  780,  780,  780,  780,  780,  780,
+ /* 18210 */   780,  699,  780,  780,   20,   21,   26,   69,   70,   86,
+ /* 18220 */    99,   75,   76,   77,   89,  100,  110,   47,   60,   94,
+ /* 18230 */   106,  107,  780,  126,  780,  780,  780,  780,  780,  780,
+ /* 18240 */   780,  780,  780,  780,  780,  780,   84,  780,  780,  780,
+ /* 18250 */   780,  780,  780,  780,  780,  108,  111,   63,  118,  780,
+ /* 18260 */    66,  780,  780,  780,  780,  780,  780,  780,  716,  780,
+ /* 18270 */   780,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /* 18280 */    77,   89,  100,  110,   47,   60,   94,  106,  107,   84,
+ /* 18290 */   126,  780,  780,  780,  780,  780,  780,  780,  108,  111,
+ /* 18300 */    63,  118,  780,   66,  780,  780,  780,  780,  780,  780,
+ /* 18310 */   780,  780,  780,  780,   20,   21,   26,   69,   70,   86,
+ /* 18320 */    99,   75,   76,   77,   89,  100,  110,   47,   60,   94,
+ /* 18330 */   106,  107,  736,  780,  780,  780,  780,  780,  780,  780,
+ /* 18340 */   780,  780,  780,  780,  780,  780,   84,  780,  780,  780,
+ /* 18350 */   780,  780,  780,  780,  126,  108,  111,   63,  118,  780,
+ /* 18360 */    66,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 18370 */   780,   20,   21,   26,   69,   70,   86,   99,   75,   76,
+ /* 18380 */    77,   89,  100,  110,   47,   60,   94,  106,  107,  750,
+ /* 18390 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 18400 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 18410 */    84,  126,  780,  780,  780,  780,  780,  780,  780,  108,
+ /* 18420 */   111,   63,  118,  780,   66,  780,  780,  780,  780,  780,
+ /* 18430 */   780,  780,  767,  780,  780,   20,   21,   26,   69,   70,
+ /* 18440 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /* 18450 */    94,  106,  107,  780,  126,  780,  780,  780,  780,  780,
+ /* 18460 */   780,  780,  780,  780,  780,  780,  780,   84,  780,  780,
+ /* 18470 */   780,  780,  780,  780,  780,  780,  108,  111,   63,  118,
+ /* 18480 */   780,   66,  780,  780,  780,  780,  780,  780,  780,  797,
+ /* 18490 */   780,  780,   20,   21,   26,   69,   70,   86,   99,   75,
+ /* 18500 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /* 18510 */    84,  126,  780,  780,  780,  780,  780,  780,  780,  108,
+ /* 18520 */   111,   63,  118,  780,   66,  780,  780,  780,  780,  780,
+ /* 18530 */   780,  780,  780,  780,  780,   20,   21,   26,   69,   70,
+ /* 18540 */    86,   99,   75,   76,   77,   89,  100,  110,   47,   60,
+ /* 18550 */    94,  106,  107,  812,  780,  780,  780,  780,  780,  780,
+ /* 18560 */   780,  780,  780,  780,  780,  780,  780,   84,  780,  780,
+ /* 18570 */   780,  780,  780,  780,  780,  126,  108,  111,   63,  118,
+ /* 18580 */   780,   66,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 18590 */   780,  780,   20,   21,   26,   69,   70,   86,   99,   75,
+ /* 18600 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /* 18610 */   856,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 18620 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 18630 */   780,   84,  126,  780,  780,  780,  780,  780,  780,  780,
+ /* 18640 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  780,
+ /* 18650 */   780,  780,  780,  780,  780,  780,   20,   21,   26,   69,
+ /* 18660 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /* 18670 */    60,   94,  106,  107,  780,  126,  780,  780,  780,  780,
+ /* 18680 */   780,  780,  780,  780,  780,  780,  780,  780,   84,  780,
+ /* 18690 */   780,  780,  780,  780,  780,  780,  780,  108,  111,   63,
+ /* 18700 */   118,  780,   66,  780,  780,  780,  780,  780,  780,  780,
+ /* 18710 */   780,  780,  780,   20,   21,   26,   69,   70,   86,   99,
+ /* 18720 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /* 18730 */   107,   84,  126,  780,  780,  780,  780,  780,  780,  780,
+ /* 18740 */   108,  111,   63,  118,  780,   66,  780,  780,  780,  780,
+ /* 18750 */   780,  780,  780,  780,  780,  780,   23,   21,   26,   69,
+ /* 18760 */    70,   86,   99,   75,   76,   77,   89,  100,  110,   47,
+ /* 18770 */    60,   94,  106,  107,  780,  113,  123,  780,  780,  144,
+ /* 18780 */   780,  780,  780,  780,  780,  127,  131,  115,   84,  780,
+ /* 18790 */   780,  780,  780,  780,  780,  780,  780,  108,  111,   63,
+ /* 18800 */   118,   67,   66,  780,  780,  780,  780,  780,  780,  780,
+ /* 18810 */   780,  780,  780,   25,   21,   26,   69,   70,   86,   99,
+ /* 18820 */    75,   76,   77,   89,  100,  110,   47,   60,   94,  106,
+ /* 18830 */   107,  113,  123,  780,  780, 1507,  780,  780,  780,  780,
+ /* 18840 */   780,  127,  131,  115,  780,  780,  780,  780,  780,  780,
+ /* 18850 */   780,  780,  780,  780,  780,  780,  126,   67,  780,   48,
+ /* 18860 */    50,   52,   54,  780,  780,  780,  780,  780,  780,  780,
+ /* 18870 */   780,   56,   58,  780,   64,   65,   95,   96,   97,  103,
+ /* 18880 */   104,  105,  116,  117,  119,  113,  123,  780,  780,  780,
+ /* 18890 */   780,  780,  780,  780,  780,  127,  131,  115,  780,  780,
+ /* 18900 */   780,  780,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 18910 */   780,   67,   84,  780,  780,   48,   50,   52,   54,  780,
+ /* 18920 */   780,  108,  111,   63,  118,  780,   66,   56,   58,  780,
+ /* 18930 */    64,   65,   95,   96,   97,  103,  104,  105,  116,  117,
+ /* 18940 */   119,  126,  181,   99,   75,   76,   77,   89,  100,  110,
+ /* 18950 */    47,   60,   94,  106,  107,  780,  126,  780,  780,  780,
+ /* 18960 */   780,  780,  780,  780,  780,  780,  780,  780,  780,   48,
+ /* 18970 */    50,   52,   54,  780,  780,  780,  780,  780,  780,  780,
+ /* 18980 */   780,   56,   58,  780,   64,   65,   95,   96,   97,  103,
+ /* 18990 */   104,  105,  116,  117,  119,  780,  780,   84,  780,  126,
+ /* 19000 */   780,  780,  780,  780,  780,  780,  108,  111,   63,  118,
+ /* 19010 */   780,   66,   84,  780,  780,  126,  780,  780,  780,  780,
+ /* 19020 */   780,  108,  111,   63,  118,  780,   66,  183,   99,   75,
+ /* 19030 */    76,   77,   89,  100,  110,   47,   60,   94,  106,  107,
+ /* 19040 */   780,  780,  780,   74,   75,   76,   77,   89,  100,  110,
+ /* 19050 */    47,   60,   94,  106,  107,   84,  780,  780,  780,  780,
+ /* 19060 */   780,  780,  780,  780,  108,  111,   63,  118,  126,   66,
+ /* 19070 */   780,   84,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 19080 */   108,  111,   63,  118,  126,   66,   88,   75,   76,   77,
+ /* 19090 */    89,  100,  110,   47,   60,   94,  106,  107,  780,  780,
+ /* 19100 */   780,  780,  177,   75,   76,   77,   89,  100,  110,   47,
+ /* 19110 */    60,   94,  106,  107,  780,  780,  780,  780,  780,  780,
+ /* 19120 */   780,  780,  780,  780,   84,  780,  780,  126,  780,  780,
+ /* 19130 */   780,  780,  780,  108,  111,   63,  118,  780,   66,  780,
+ /* 19140 */    84,  780,  126,  780,  780,  780,  780,  780,  780,  108,
+ /* 19150 */   111,   63,  118,  780,   66,  780,   36,   76,   77,   89,
+ /* 19160 */   100,  110,   47,   60,   94,  106,  107,  780,  780,  780,
+ /* 19170 */   780,  780,  780,   38,   77,   89,  100,  110,   47,   60,
+ /* 19180 */    94,  106,  107,   84,  780,  126,  780,  780,  780,  780,
+ /* 19190 */   780,  780,  108,  111,   63,  118,  780,   66,   84,  780,
+ /* 19200 */   126,  780,  780,  780,  780,  780,  780,  108,  111,   63,
+ /* 19210 */   118,  780,   66,  780,  780,  780,  780,  780,   79,  100,
+ /* 19220 */   110,   47,   60,   94,  106,  107,  780,  780,  780,  780,
+ /* 19230 */   780,  780,  780,  780,   91,  110,   47,   60,   94,  106,
+ /* 19240 */   107,   84,  780,  780,  780,  780,  780,  780,  780,  780,
+ /* 19250 */   108,  111,   63,  118,  780,   66,   84,  780,  780,  780,
+ /* 19260 */   780,  780,  780,  780,  780,  108,  111,   63,  118,  780,
+ /* 19270 */    66,  780,  780,  780,  780,  780,  780,  173,  110,   47,
+ /* 19280 */    60,   94,  106,  107,  780,  780,  780,  780,  780,  780,
+ /* 19290 */   780,  780,  175,  110,   47,   60,   94,  106,  107,
+};
+static YYCODETYPE yy_lookahead[] = {
+ /*     0 */   120,  121,  122,  123,  124,  125,  126,  127,  128,  129,
+ /*    10 */   130,  131,  132,  133,    0,  135,  136,  137,  138,  139,
+ /*    20 */   140,  141,  142,  143,  144,  145,  146,  147,  148,  149,
+ /*    30 */   150,  151,  152,  153,  154,  155,  156,  157,  158,  159,
+ /*    40 */   160,  161,  162,  163,  164,  165,  166,  167,  168,  169,
+ /*    50 */   170,  171,  172,  173,  174,  175,  176,  177,  178,  179,
+ /*    60 */   180,  181,  182,  183,  184,  185,  186,  187,  188,  189,
+ /*    70 */   190,  191,  192,  193,  194,  195,  196,  197,  198,  199,
+ /*    80 */   200,  201,  202,  203,  204,   93,   94,   95,   96,   97,
+ /*    90 */     1,  211,   83,   84,   85,   86,  216,   12,  218,   14,
+ /*   100 */   220,  221,  222,  223,    9,  225,   98,   99,  100,  101,
+ /*   110 */   102,  103,  104,   14,   19,   20,  236,  237,  238,  239,
+ /*   120 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /*   130 */   250,  251,  252,  253,  121,  122,  123,  124,  125,  126,
+ /*   140 */   127,  128,  129,  130,  131,  132,  133,   81,  135,  136,
+ /*   150 */   137,  138,  139,  140,  141,  142,  143,  144,  145,  146,
+ /*   160 */   147,  148,  149,  150,  151,  152,  153,  154,  155,  156,
+ /*   170 */   157,  158,  159,  160,  161,  162,  163,  164,  165,  166,
+ /*   180 */   167,  168,  169,  170,  171,  172,  173,  174,  175,  176,
+ /*   190 */   177,  178,  179,  180,  181,  182,  183,  184,  185,  186,
+ /*   200 */   187,  188,  189,  190,  191,  192,  193,  194,  195,  196,
+ /*   210 */   197,  198,  199,  200,  201,  202,  203,  204,  108,  109,
+ /*   220 */   110,  111,  112,   82,  211,  205,  206,  207,  208,  216,
+ /*   230 */    67,  218,   11,  220,  221,  222,  223,   16,  225,   65,
+ /*   240 */    66,   67,   17,   18,   19,   20,   21,   22,   23,  236,
+ /*   250 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /*   260 */   247,  248,  249,  250,  251,  252,  253,  121,  122,  123,
+ /*   270 */   124,  125,  126,  127,  128,  129,  130,  131,  132,  133,
+ /*   280 */    90,  135,  136,  137,  138,  139,  140,  141,  142,  143,
+ /*   290 */   144,  145,  146,  147,  148,  149,  150,  151,  152,  153,
+ /*   300 */   154,  155,  156,  157,  158,  159,  160,  161,  162,  163,
+ /*   310 */   164,  165,  166,  167,  168,  169,  170,  171,  172,  173,
+ /*   320 */   174,  175,  176,  177,  178,  179,  180,  181,  182,  183,
+ /*   330 */   184,  185,  186,  187,  188,  189,  190,  191,  192,  193,
+ /*   340 */   194,  195,  196,  197,  198,  199,  200,  201,  202,  203,
+ /*   350 */   204,   65,  205,  206,  207,  208,   91,  211,   13,   10,
+ /*   360 */    11,   16,  216,  107,  218,   16,  220,  221,  222,  223,
+ /*   370 */   217,  225,  219,   87,   88,   89,   79,   80,   29,  206,
+ /*   380 */   207,  208,  236,  237,  238,  239,  240,  241,  242,  243,
+ /*   390 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /*   400 */   121,  122,  123,  124,  125,  126,  127,  128,  129,  130,
+ /*   410 */   131,  132,  133,   36,  135,  136,  137,  138,  139,  140,
+ /*   420 */   141,  142,  143,  144,  145,  146,  147,  148,  149,  150,
+ /*   430 */   151,  152,  153,  154,  155,  156,  157,  158,  159,  160,
+ /*   440 */   161,  162,  163,  164,  165,  166,  167,  168,  169,  170,
+ /*   450 */   171,  172,  173,  174,  175,  176,  177,  178,  179,  180,
+ /*   460 */   181,  182,  183,  184,  185,  186,  187,  188,  189,  190,
+ /*   470 */   191,  192,  193,  194,  195,  196,  197,  198,  199,  200,
+ /*   480 */   201,  202,  203,  204,   66,   16,   31,   32,    9,   10,
+ /*   490 */   211,    9,   10,    9,   10,  216,    1,  218,   29,  220,
+ /*   500 */   221,  222,  223,   11,  225,   37,   36,   11,   16,   11,
+ /*   510 */    92,   16,   16,   36,   16,  236,  237,  238,  239,  240,
+ /*   520 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /*   530 */   251,  252,  253,  121,  122,  123,  124,  125,  126,  127,
+ /*   540 */   128,  129,  130,  131,  132,  133,   36,  135,  136,  137,
+ /*   550 */   138,  139,  140,  141,  142,  143,  144,  145,  146,  147,
+ /*   560 */   148,  149,  150,  151,  152,  153,  154,  155,  156,  157,
+ /*   570 */   158,  159,  160,  161,  162,  163,  164,  165,  166,  167,
+ /*   580 */   168,  169,  170,  171,  172,  173,  174,  175,  176,  177,
+ /*   590 */   178,  179,  180,  181,  182,  183,  184,  185,  186,  187,
+ /*   600 */   188,  189,  190,  191,  192,  193,  194,  195,  196,  197,
+ /*   610 */   198,  199,  200,  201,  202,  203,  204,   11,   11,   11,
+ /*   620 */    11,   11,   16,  211,   16,   16,   16,   36,  216,   10,
+ /*   630 */   218,   11,  220,  221,  222,  223,   16,  225,   36,   11,
+ /*   640 */    11,    9,   10,   36,   10,   16,    9,   10,  236,  237,
+ /*   650 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /*   660 */   248,  249,  250,  251,  252,  253,  121,  122,  123,  124,
+ /*   670 */   125,  126,  127,  128,  129,  130,  131,  132,  133,   11,
+ /*   680 */   135,  136,  137,  138,  139,  140,  141,  142,  143,  144,
+ /*   690 */   145,  146,  147,  148,  149,  150,  151,  152,  153,  154,
+ /*   700 */   155,  156,  157,  158,  159,  160,  161,  162,  163,  164,
+ /*   710 */   165,  166,  167,  168,  169,  170,  171,  172,  173,  174,
+ /*   720 */   175,  176,  177,  178,  179,  180,  181,  182,  183,  184,
+ /*   730 */   185,  186,  187,  188,  189,  190,  191,  192,  193,  194,
+ /*   740 */   195,  196,  197,  198,  199,  200,  201,  202,  203,  204,
+ /*   750 */    11,   11,   11,   11,   11,   11,  211,    9,   10,    1,
+ /*   760 */    16,  216,   10,  218,   11,  220,  221,  222,  223,   16,
+ /*   770 */   225,   11,   11,   11,   16,   36,   36,   36,   36,   36,
+ /*   780 */    13,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /*   790 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  121,
+ /*   800 */   122,  123,  124,  125,  126,  127,  128,  129,  130,  131,
+ /*   810 */   132,  133,   13,  135,  136,  137,  138,  139,  140,  141,
+ /*   820 */   142,  143,  144,  145,  146,  147,  148,  149,  150,  151,
+ /*   830 */   152,  153,  154,  155,  156,  157,  158,  159,  160,  161,
+ /*   840 */   162,  163,  164,  165,  166,  167,  168,  169,  170,  171,
+ /*   850 */   172,  173,  174,  175,  176,  177,  178,  179,  180,  181,
+ /*   860 */   182,  183,  184,  185,  186,  187,  188,  189,  190,  191,
+ /*   870 */   192,  193,  194,  195,  196,  197,  198,  199,  200,  201,
+ /*   880 */   202,  203,  204,   14,   14,   11,   37,   37,   37,  211,
+ /*   890 */    37,   37,  155,    9,  216,   10,  218,   11,  220,  221,
+ /*   900 */   222,  223,   13,  225,    9,   11,   10,   26,  209,   12,
+ /*   910 */    11,   13,   12,   12,  236,  237,  238,  239,  240,  241,
+ /*   920 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /*   930 */   252,  253,  121,  122,  123,  124,  125,  126,  127,  128,
+ /*   940 */   129,  130,  131,  132,  133,   13,  135,  136,  137,  138,
+ /*   950 */   139,  140,  141,  142,  143,  144,  145,  146,  147,  148,
+ /*   960 */   149,  150,  151,  152,  153,  154,  155,  156,  157,  158,
+ /*   970 */   159,  160,  161,  162,  163,  164,  165,  166,  167,  168,
+ /*   980 */   169,  170,  171,  172,  173,  174,  175,  176,  177,  178,
+ /*   990 */   179,  180,  181,  182,  183,  184,  185,  186,  187,  188,
+ /*  1000 */   189,  190,  191,  192,  193,  194,  195,  196,  197,  198,
+ /*  1010 */   199,  200,  201,  202,  203,  204,   13,   12,   10,   13,
+ /*  1020 */    13,   12,  211,   12,   10,   13,   11,  216,   10,  218,
+ /*  1030 */    29,  220,  221,  222,  223,   11,  225,   12,   10,   13,
+ /*  1040 */    11,   10,   12,   11,    9,   12,  220,  236,  237,  238,
+ /*  1050 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /*  1060 */   249,  250,  251,  252,  253,  121,  122,  123,  124,  125,
+ /*  1070 */   126,  127,  128,  129,  130,  131,  132,  133,   13,  135,
+ /*  1080 */   136,  137,  138,  139,  140,  141,  142,  143,  144,  145,
+ /*  1090 */   146,  147,  148,  149,  150,  151,  152,  153,  154,  155,
+ /*  1100 */   156,  157,  158,  159,  160,  161,  162,  163,  164,  165,
+ /*  1110 */   166,  167,  168,  169,  170,  171,  172,  173,  174,  175,
+ /*  1120 */   176,  177,  178,  179,  180,  181,  182,  183,  184,  185,
+ /*  1130 */   186,  187,  188,  189,  190,  191,  192,  193,  194,  195,
+ /*  1140 */   196,  197,  198,  199,  200,  201,  202,  203,  204,   34,
+ /*  1150 */   220,   34,   34,  220,  220,  211,   34,  220,   34,  220,
+ /*  1160 */   216,   34,  218,  220,  220,  221,  222,  223,   34,  225,
+ /*  1170 */    37,   36,   34,   34,   34,   16,   16,    3,   16,    3,
+ /*  1180 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /*  1190 */   246,  247,  248,  249,  250,  251,  252,  253,  121,  122,
+ /*  1200 */   123,  124,  125,  126,  127,  128,  129,  130,  131,  132,
+ /*  1210 */   133,   16,  135,  136,  137,  138,  139,  140,  141,  142,
+ /*  1220 */   143,  144,  145,  146,  147,  148,  149,  150,  151,  152,
+ /*  1230 */   153,  154,  155,  156,  157,  158,  159,  160,  161,  162,
+ /*  1240 */   163,  164,  165,  166,  167,  168,  169,  170,  171,  172,
+ /*  1250 */   173,  174,  175,  176,  177,  178,  179,  180,  181,  182,
+ /*  1260 */   183,  184,  185,  186,  187,  188,  189,  190,  191,  192,
+ /*  1270 */   193,  194,  195,  196,  197,  198,  199,  200,  201,  202,
+ /*  1280 */   203,  204,    3,   16,   16,   16,   16,   16,  211,   16,
+ /*  1290 */    16,   16,   16,  216,   16,  218,   16,  220,  221,  222,
+ /*  1300 */   223,   16,  225,   16,   16,   16,   16,   16,   16,   16,
+ /*  1310 */    16,   16,   16,  236,  237,  238,  239,  240,  241,  242,
+ /*  1320 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /*  1330 */   253,  121,  122,  123,  124,  125,  126,  127,  128,  129,
+ /*  1340 */   130,  131,  132,  133,   16,  135,  136,  137,  138,  139,
+ /*  1350 */   140,  141,  142,  143,  144,  145,  146,  147,  148,  149,
+ /*  1360 */   150,  151,  152,  153,  154,  155,  156,  157,  158,  159,
+ /*  1370 */   160,  161,  162,  163,  164,  165,  166,  167,  168,  169,
+ /*  1380 */   170,  171,  172,  173,  174,  175,  176,  177,  178,  179,
+ /*  1390 */   180,  181,  182,  183,  184,  185,  186,  187,  188,  189,
+ /*  1400 */   190,  191,  192,  193,  194,  195,  196,  197,  198,  199,
+ /*  1410 */   200,  201,  202,  203,  204,   16,   16,   16,   16,   16,
+ /*  1420 */    16,  211,   16,   16,   16,   16,  216,   16,  218,   16,
+ /*  1430 */   220,  221,  222,  223,   16,  225,   13,   12,   11,   13,
+ /*  1440 */    12,   11,   13,   12,   11,   13,  236,  237,  238,  239,
+ /*  1450 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /*  1460 */   250,  251,  252,  253,  121,  122,  123,  124,  125,  126,
+ /*  1470 */   127,  128,  129,  130,  131,  132,  133,   12,  135,  136,
+ /*  1480 */   137,  138,  139,  140,  141,  142,  143,  144,  145,  146,
+ /*  1490 */   147,  148,  149,  150,  151,  152,  153,  154,  155,  156,
+ /*  1500 */   157,  158,  159,  160,  161,  162,  163,  164,  165,  166,
+ /*  1510 */   167,  168,  169,  170,  171,  172,  173,  174,  175,  176,
+ /*  1520 */   177,  178,  179,  180,  181,  182,  183,  184,  185,  186,
+ /*  1530 */   187,  188,  189,  190,  191,  192,  193,  194,  195,  196,
+ /*  1540 */   197,  198,  199,  200,  201,  202,  203,  204,   13,   37,
+ /*  1550 */    12,   11,   13,   12,  211,   13,    9,    9,    9,  216,
+ /*  1560 */     9,  218,    9,  220,  221,  222,  223,   12,  225,   13,
+ /*  1570 */    11,   13,   12,   12,   11,   13,   12,   11,   13,  236,
+ /*  1580 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /*  1590 */   247,  248,  249,  250,  251,  252,  253,  121,  122,  123,
+ /*  1600 */   124,  125,  126,  127,  128,  129,  130,  131,  132,  133,
+ /*  1610 */    12,  135,  136,  137,  138,  139,  140,  141,  142,  143,
+ /*  1620 */   144,  145,  146,  147,  148,  149,  150,  151,  152,  153,
+ /*  1630 */   154,  155,  156,  157,  158,  159,  160,  161,  162,  163,
+ /*  1640 */   164,  165,  166,  167,  168,  169,  170,  171,  172,  173,
+ /*  1650 */   174,  175,  176,  177,  178,  179,  180,  181,  182,  183,
+ /*  1660 */   184,  185,  186,  187,  188,  189,  190,  191,  192,  193,
+ /*  1670 */   194,  195,  196,  197,  198,  199,  200,  201,  202,  203,
+ /*  1680 */   204,   13,   12,   16,   13,   29,  209,  211,   11,   13,
+ /*  1690 */    12,   12,  216,   13,  218,   12,  220,  221,  222,  223,
+ /*  1700 */    13,  225,   11,   13,   12,   11,   13,   12,  209,    9,
+ /*  1710 */     9,    9,  236,  237,  238,  239,  240,  241,  242,  243,
+ /*  1720 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /*  1730 */   121,  122,  123,  124,  125,  126,  127,  128,  129,  130,
+ /*  1740 */   131,  132,  133,   34,  135,  136,  137,  138,  139,  140,
+ /*  1750 */   141,  142,  143,  144,  145,  146,  147,  148,  149,  150,
+ /*  1760 */   151,  152,  153,  154,  155,  156,  157,  158,  159,  160,
+ /*  1770 */   161,  162,  163,  164,  165,  166,  167,  168,  169,  170,
+ /*  1780 */   171,  172,  173,  174,  175,  176,  177,  178,  179,  180,
+ /*  1790 */   181,  182,  183,  184,  185,  186,  187,  188,  189,  190,
+ /*  1800 */   191,  192,  193,  194,  195,  196,  197,  198,  199,  200,
+ /*  1810 */   201,  202,  203,  204,   12,   11,   13,   11,    9,  206,
+ /*  1820 */   211,   13,   12,  261,  261,  216,  261,  218,  261,  220,
+ /*  1830 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  261,
+ /*  1840 */   261,  261,  261,  261,  261,  236,  237,  238,  239,  240,
+ /*  1850 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /*  1860 */   251,  252,  253,  121,  122,  123,  124,  125,  126,  127,
+ /*  1870 */   128,  129,  130,  131,  132,  133,  261,  135,  136,  137,
+ /*  1880 */   138,  139,  140,  141,  142,  143,  144,  145,  146,  147,
+ /*  1890 */   148,  149,  150,  151,  152,  153,  154,  155,  156,  157,
+ /*  1900 */   158,  159,  160,  161,  162,  163,  164,  165,  166,  167,
+ /*  1910 */   168,  169,  170,  171,  172,  173,  174,  175,  176,  177,
+ /*  1920 */   178,  179,  180,  181,  182,  183,  184,  185,  186,  187,
+ /*  1930 */   188,  189,  190,  191,  192,  193,  194,  195,  196,  197,
+ /*  1940 */   198,  199,  200,  201,  202,  203,  204,  261,  261,  261,
+ /*  1950 */   261,  261,  261,  211,  261,  261,  261,  261,  216,  261,
+ /*  1960 */   218,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /*  1970 */   261,  261,  261,  261,  261,  261,  261,  261,  236,  237,
+ /*  1980 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /*  1990 */   248,  249,  250,  251,  252,  253,  121,  122,  123,  124,
+ /*  2000 */   125,  126,  127,  128,  129,  130,  131,  132,  133,  261,
+ /*  2010 */   135,  136,  137,  138,  139,  140,  141,  142,  143,  144,
+ /*  2020 */   145,  146,  147,  148,  149,  150,  151,  152,  153,  154,
+ /*  2030 */   155,  156,  157,  158,  159,  160,  161,  162,  163,  164,
+ /*  2040 */   165,  166,  167,  168,  169,  170,  171,  172,  173,  174,
+ /*  2050 */   175,  176,  177,  178,  179,  180,  181,  182,  183,  184,
+ /*  2060 */   185,  186,  187,  188,  189,  190,  191,  192,  193,  194,
+ /*  2070 */   195,  196,  197,  198,  199,  200,  201,  202,  203,  204,
+ /*  2080 */   261,  261,  261,  261,  261,  261,  211,  261,  261,  261,
+ /*  2090 */   261,  216,  261,  218,  261,  220,  221,  222,  223,  261,
+ /*  2100 */   225,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  2110 */   261,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /*  2120 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  121,
+ /*  2130 */   122,  123,  124,  125,  126,  127,  128,  129,  130,  131,
+ /*  2140 */   132,  133,  261,  135,  136,  137,  138,  139,  140,  141,
+ /*  2150 */   142,  143,  144,  145,  146,  147,  148,  149,  150,  151,
+ /*  2160 */   152,  153,  154,  155,  156,  157,  158,  159,  160,  161,
+ /*  2170 */   162,  163,  164,  165,  166,  167,  168,  169,  170,  171,
+ /*  2180 */   172,  173,  174,  175,  176,  177,  178,  179,  180,  181,
+ /*  2190 */   182,  183,  184,  185,  186,  187,  188,  189,  190,  191,
+ /*  2200 */   192,  193,  194,  195,  196,  197,  198,  199,  200,  201,
+ /*  2210 */   202,  203,  204,  261,  261,  261,  261,  261,  261,  211,
+ /*  2220 */   261,  261,  261,  261,  216,  261,  218,  261,  220,  221,
+ /*  2230 */   222,  223,  261,  225,  261,  261,  261,  261,  261,  261,
+ /*  2240 */   261,  261,  261,  261,  236,  237,  238,  239,  240,  241,
+ /*  2250 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /*  2260 */   252,  253,  121,  122,  123,  124,  125,  126,  127,  128,
+ /*  2270 */   129,  130,  131,  132,  133,  261,  135,  136,  137,  138,
+ /*  2280 */   139,  140,  141,  142,  143,  144,  145,  146,  147,  148,
+ /*  2290 */   149,  150,  151,  152,  153,  154,  155,  156,  157,  158,
+ /*  2300 */   159,  160,  161,  162,  163,  164,  165,  166,  167,  168,
+ /*  2310 */   169,  170,  171,  172,  173,  174,  175,  176,  177,  178,
+ /*  2320 */   179,  180,  181,  182,  183,  184,  185,  186,  187,  188,
+ /*  2330 */   189,  190,  191,  192,  193,  194,  195,  196,  197,  198,
+ /*  2340 */   199,  200,  201,  202,  203,  204,  261,  261,  261,  261,
+ /*  2350 */   261,  261,  211,  261,  261,  261,  261,  216,  261,  218,
+ /*  2360 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /*  2370 */   261,  261,  261,  261,  261,  261,  261,  236,  237,  238,
+ /*  2380 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /*  2390 */   249,  250,  251,  252,  253,  121,  122,  123,  124,  125,
+ /*  2400 */   126,  127,  128,  129,  130,  131,  132,  133,  261,  135,
+ /*  2410 */   136,  137,  138,  139,  140,  141,  142,  143,  144,  145,
+ /*  2420 */   146,  147,  148,  149,  150,  151,  152,  153,  154,  155,
+ /*  2430 */   156,  157,  158,  159,  160,  161,  162,  163,  164,  165,
+ /*  2440 */   166,  167,  168,  169,  170,  171,  172,  173,  174,  175,
+ /*  2450 */   176,  177,  178,  179,  180,  181,  182,  183,  184,  185,
+ /*  2460 */   186,  187,  188,  189,  190,  191,  192,  193,  194,  195,
+ /*  2470 */   196,  197,  198,  199,  200,  201,  202,  203,  204,  261,
+ /*  2480 */   261,  261,  261,  261,  261,  211,  261,  261,  261,  261,
+ /*  2490 */   216,  261,  218,  261,  220,  221,  222,  223,  261,  225,
+ /*  2500 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  2510 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /*  2520 */   246,  247,  248,  249,  250,  251,  252,  253,  121,  122,
+ /*  2530 */   123,  124,  125,  126,  127,  128,  129,  130,  131,  132,
+ /*  2540 */   133,  261,  135,  136,  137,  138,  139,  140,  141,  142,
+ /*  2550 */   143,  144,  145,  146,  147,  148,  149,  150,  151,  152,
+ /*  2560 */   153,  154,  155,  156,  157,  158,  159,  160,  161,  162,
+ /*  2570 */   163,  164,  165,  166,  167,  168,  169,  170,  171,  172,
+ /*  2580 */   173,  174,  175,  176,  177,  178,  179,  180,  181,  182,
+ /*  2590 */   183,  184,  185,  186,  187,  188,  189,  190,  191,  192,
+ /*  2600 */   193,  194,  195,  196,  197,  198,  199,  200,  201,  202,
+ /*  2610 */   203,  204,  261,  261,  261,  261,  261,  261,  211,  261,
+ /*  2620 */   261,  261,  261,  216,  261,  218,  261,  220,  221,  222,
+ /*  2630 */   223,  261,  225,  261,  261,  261,  261,  261,  261,  261,
+ /*  2640 */   261,  261,  261,  236,  237,  238,  239,  240,  241,  242,
+ /*  2650 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /*  2660 */   253,  121,  122,  123,  124,  125,  126,  127,  128,  129,
+ /*  2670 */   130,  131,  132,  133,  261,  135,  136,  137,  138,  139,
+ /*  2680 */   140,  141,  142,  143,  144,  145,  146,  147,  148,  149,
+ /*  2690 */   150,  151,  152,  153,  154,  155,  156,  157,  158,  159,
+ /*  2700 */   160,  161,  162,  163,  164,  165,  166,  167,  168,  169,
+ /*  2710 */   170,  171,  172,  173,  174,  175,  176,  177,  178,  179,
+ /*  2720 */   180,  181,  182,  183,  184,  185,  186,  187,  188,  189,
+ /*  2730 */   190,  191,  192,  193,  194,  195,  196,  197,  198,  199,
+ /*  2740 */   200,  201,  202,  203,  204,  261,  261,  261,  261,  261,
+ /*  2750 */   261,  211,  261,  261,  261,  261,  216,  261,  218,  261,
+ /*  2760 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /*  2770 */   261,  261,  261,  261,  261,  261,  236,  237,  238,  239,
+ /*  2780 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /*  2790 */   250,  251,  252,  253,  121,  122,  123,  124,  125,  126,
+ /*  2800 */   127,  128,  129,  130,  131,  132,  133,  261,  135,  136,
+ /*  2810 */   137,  138,  139,  140,  141,  142,  143,  144,  145,  146,
+ /*  2820 */   147,  148,  149,  150,  151,  152,  153,  154,  155,  156,
+ /*  2830 */   157,  158,  159,  160,  161,  162,  163,  164,  165,  166,
+ /*  2840 */   167,  168,  169,  170,  171,  172,  173,  174,  175,  176,
+ /*  2850 */   177,  178,  179,  180,  181,  182,  183,  184,  185,  186,
+ /*  2860 */   187,  188,  189,  190,  191,  192,  193,  194,  195,  196,
+ /*  2870 */   197,  198,  199,  200,  201,  202,  203,  204,  261,  261,
+ /*  2880 */   261,  261,  261,  261,  211,  261,  261,  261,  261,  216,
+ /*  2890 */   261,  218,  261,  220,  221,  222,  223,  261,  225,  261,
+ /*  2900 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  236,
+ /*  2910 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /*  2920 */   247,  248,  249,  250,  251,  252,  253,  121,  122,  123,
+ /*  2930 */   124,  125,  126,  127,  128,  129,  130,  131,  132,  133,
+ /*  2940 */   261,  135,  136,  137,  138,  139,  140,  141,  142,  143,
+ /*  2950 */   144,  145,  146,  147,  148,  149,  150,  151,  152,  153,
+ /*  2960 */   154,  155,  156,  157,  158,  159,  160,  161,  162,  163,
+ /*  2970 */   164,  165,  166,  167,  168,  169,  170,  171,  172,  173,
+ /*  2980 */   174,  175,  176,  177,  178,  179,  180,  181,  182,  183,
+ /*  2990 */   184,  185,  186,  187,  188,  189,  190,  191,  192,  193,
+ /*  3000 */   194,  195,  196,  197,  198,  199,  200,  201,  202,  203,
+ /*  3010 */   204,  261,  261,  261,  261,  261,  261,  211,  261,  261,
+ /*  3020 */   261,  261,  216,  261,  218,  261,  220,  221,  222,  223,
+ /*  3030 */   261,  225,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  3040 */   261,  261,  236,  237,  238,  239,  240,  241,  242,  243,
+ /*  3050 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /*  3060 */   121,  122,  123,  124,  125,  126,  127,  128,  129,  130,
+ /*  3070 */   131,  132,  133,  261,  135,  136,  137,  138,  139,  140,
+ /*  3080 */   141,  142,  143,  144,  145,  146,  147,  148,  149,  150,
+ /*  3090 */   151,  152,  153,  154,  155,  156,  157,  158,  159,  160,
+ /*  3100 */   161,  162,  163,  164,  165,  166,  167,  168,  169,  170,
+ /*  3110 */   171,  172,  173,  174,  175,  176,  177,  178,  179,  180,
+ /*  3120 */   181,  182,  183,  184,  185,  186,  187,  188,  189,  190,
+ /*  3130 */   191,  192,  193,  194,  195,  196,  197,  198,  199,  200,
+ /*  3140 */   201,  202,  203,  204,  261,  261,  261,  261,  261,  261,
+ /*  3150 */   211,  261,  261,  261,  261,  216,  261,  218,  261,  220,
+ /*  3160 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  261,
+ /*  3170 */   261,  261,  261,  261,  261,  236,  237,  238,  239,  240,
+ /*  3180 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /*  3190 */   251,  252,  253,  121,  122,  123,  124,  125,  126,  127,
+ /*  3200 */   128,  129,  130,  131,  132,  133,  261,  135,  136,  137,
+ /*  3210 */   138,  139,  140,  141,  142,  143,  144,  145,  146,  147,
+ /*  3220 */   148,  149,  150,  151,  152,  153,  154,  155,  156,  157,
+ /*  3230 */   158,  159,  160,  161,  162,  163,  164,  165,  166,  167,
+ /*  3240 */   168,  169,  170,  171,  172,  173,  174,  175,  176,  177,
+ /*  3250 */   178,  179,  180,  181,  182,  183,  184,  185,  186,  187,
+ /*  3260 */   188,  189,  190,  191,  192,  193,  194,  195,  196,  197,
+ /*  3270 */   198,  199,  200,  201,  202,  203,  204,  261,  261,  261,
+ /*  3280 */   261,  261,  261,  211,  261,  261,  261,  261,  216,  261,
+ /*  3290 */   218,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /*  3300 */   261,  261,  261,  261,  261,  261,  261,  261,  236,  237,
+ /*  3310 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /*  3320 */   248,  249,  250,  251,  252,  253,  121,  122,  123,  124,
+ /*  3330 */   125,  126,  127,  128,  129,  130,  131,  132,  133,  261,
+ /*  3340 */   135,  136,  137,  138,  139,  140,  141,  142,  143,  144,
+ /*  3350 */   145,  146,  147,  148,  149,  150,  151,  152,  153,  154,
+ /*  3360 */   155,  156,  157,  158,  159,  160,  161,  162,  163,  164,
+ /*  3370 */   165,  166,  167,  168,  169,  170,  171,  172,  173,  174,
+ /*  3380 */   175,  176,  177,  178,  179,  180,  181,  182,  183,  184,
+ /*  3390 */   185,  186,  187,  188,  189,  190,  191,  192,  193,  194,
+ /*  3400 */   195,  196,  197,  198,  199,  200,  201,  202,  203,  204,
+ /*  3410 */   261,  261,  261,  261,  261,  261,  211,  261,  261,  261,
+ /*  3420 */   261,  216,  261,  218,  261,  220,  221,  222,  223,  261,
+ /*  3430 */   225,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  3440 */   261,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /*  3450 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  121,
+ /*  3460 */   122,  123,  124,  125,  126,  127,  128,  129,  130,  131,
+ /*  3470 */   132,  133,  261,  135,  136,  137,  138,  139,  140,  141,
+ /*  3480 */   142,  143,  144,  145,  146,  147,  148,  149,  150,  151,
+ /*  3490 */   152,  153,  154,  155,  156,  157,  158,  159,  160,  161,
+ /*  3500 */   162,  163,  164,  165,  166,  167,  168,  169,  170,  171,
+ /*  3510 */   172,  173,  174,  175,  176,  177,  178,  179,  180,  181,
+ /*  3520 */   182,  183,  184,  185,  186,  187,  188,  189,  190,  191,
+ /*  3530 */   192,  193,  194,  195,  196,  197,  198,  199,  200,  201,
+ /*  3540 */   202,  203,  204,  261,  261,  261,  261,  261,  261,  211,
+ /*  3550 */   261,  261,  261,  261,  216,  261,  218,  261,  220,  221,
+ /*  3560 */   222,  223,  261,  225,  261,  261,  261,  261,  261,  261,
+ /*  3570 */   261,  261,  261,  261,  236,  237,  238,  239,  240,  241,
+ /*  3580 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /*  3590 */   252,  253,  121,  122,  123,  124,  125,  126,  127,  128,
+ /*  3600 */   129,  130,  131,  132,  133,  261,  135,  136,  137,  138,
+ /*  3610 */   139,  140,  141,  142,  143,  144,  145,  146,  147,  148,
+ /*  3620 */   149,  150,  151,  152,  153,  154,  155,  156,  157,  158,
+ /*  3630 */   159,  160,  161,  162,  163,  164,  165,  166,  167,  168,
+ /*  3640 */   169,  170,  171,  172,  173,  174,  175,  176,  177,  178,
+ /*  3650 */   179,  180,  181,  182,  183,  184,  185,  186,  187,  188,
+ /*  3660 */   189,  190,  191,  192,  193,  194,  195,  196,  197,  198,
+ /*  3670 */   199,  200,  201,  202,  203,  204,  261,  261,  261,  261,
+ /*  3680 */   261,  261,  211,  261,  261,  261,  261,  216,  261,  218,
+ /*  3690 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /*  3700 */   261,  261,  261,  261,  261,  261,  261,  236,  237,  238,
+ /*  3710 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /*  3720 */   249,  250,  251,  252,  253,  121,  122,  123,  124,  125,
+ /*  3730 */   126,  127,  128,  129,  130,  131,  132,  133,  261,  135,
+ /*  3740 */   136,  137,  138,  139,  140,  141,  142,  143,  144,  145,
+ /*  3750 */   146,  147,  148,  149,  150,  151,  152,  153,  154,  155,
+ /*  3760 */   156,  157,  158,  159,  160,  161,  162,  163,  164,  165,
+ /*  3770 */   166,  167,  168,  169,  170,  171,  172,  173,  174,  175,
+ /*  3780 */   176,  177,  178,  179,  180,  181,  182,  183,  184,  185,
+ /*  3790 */   186,  187,  188,  189,  190,  191,  192,  193,  194,  195,
+ /*  3800 */   196,  197,  198,  199,  200,  201,  202,  203,  204,  261,
+ /*  3810 */   261,  261,  261,  261,  261,  211,  261,  261,  261,  261,
+ /*  3820 */   216,  261,  218,  261,  220,  221,  222,  223,  261,  225,
+ /*  3830 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  3840 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /*  3850 */   246,  247,  248,  249,  250,  251,  252,  253,  121,  122,
+ /*  3860 */   123,  124,  125,  126,  127,  128,  129,  130,  131,  132,
+ /*  3870 */   133,  261,  135,  136,  137,  138,  139,  140,  141,  142,
+ /*  3880 */   143,  144,  145,  146,  147,  148,  149,  150,  151,  152,
+ /*  3890 */   153,  154,  155,  156,  157,  158,  159,  160,  161,  162,
+ /*  3900 */   163,  164,  165,  166,  167,  168,  169,  170,  171,  172,
+ /*  3910 */   173,  174,  175,  176,  177,  178,  179,  180,  181,  182,
+ /*  3920 */   183,  184,  185,  186,  187,  188,  189,  190,  191,  192,
+ /*  3930 */   193,  194,  195,  196,  197,  198,  199,  200,  201,  202,
+ /*  3940 */   203,  204,  261,  261,  261,  261,  261,  261,  211,  261,
+ /*  3950 */   261,  261,  261,  216,  261,  218,  261,  220,  221,  222,
+ /*  3960 */   223,  261,  225,  261,  261,  261,  261,  261,  261,  261,
+ /*  3970 */   261,  261,  261,  236,  237,  238,  239,  240,  241,  242,
+ /*  3980 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /*  3990 */   253,  121,  122,  123,  124,  125,  126,  127,  128,  129,
+ /*  4000 */   130,  131,  132,  133,  261,  135,  136,  137,  138,  139,
+ /*  4010 */   140,  141,  142,  143,  144,  145,  146,  147,  148,  149,
+ /*  4020 */   150,  151,  152,  153,  154,  155,  156,  157,  158,  159,
+ /*  4030 */   160,  161,  162,  163,  164,  165,  166,  167,  168,  169,
+ /*  4040 */   170,  171,  172,  173,  174,  175,  176,  177,  178,  179,
+ /*  4050 */   180,  181,  182,  183,  184,  185,  186,  187,  188,  189,
+ /*  4060 */   190,  191,  192,  193,  194,  195,  196,  197,  198,  199,
+ /*  4070 */   200,  201,  202,  203,  204,  261,  261,  261,  261,  261,
+ /*  4080 */   261,  211,  261,  261,  261,  261,  216,  261,  218,  261,
+ /*  4090 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /*  4100 */   261,  261,  261,  261,  261,  261,  236,  237,  238,  239,
+ /*  4110 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /*  4120 */   250,  251,  252,  253,  121,  122,  123,  124,  125,  126,
+ /*  4130 */   127,  128,  129,  130,  131,  132,  133,  261,  135,  136,
+ /*  4140 */   137,  138,  139,  140,  141,  142,  143,  144,  145,  146,
+ /*  4150 */   147,  148,  149,  150,  151,  152,  153,  154,  155,  156,
+ /*  4160 */   157,  158,  159,  160,  161,  162,  163,  164,  165,  166,
+ /*  4170 */   167,  168,  169,  170,  171,  172,  173,  174,  175,  176,
+ /*  4180 */   177,  178,  179,  180,  181,  182,  183,  184,  185,  186,
+ /*  4190 */   187,  188,  189,  190,  191,  192,  193,  194,  195,  196,
+ /*  4200 */   197,  198,  199,  200,  201,  202,  203,  204,  261,  261,
+ /*  4210 */   261,  261,  261,  261,  211,  261,  261,  261,  211,  216,
+ /*  4220 */   261,  218,  261,  220,  221,  222,  223,  261,  225,  222,
+ /*  4230 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  236,
+ /*  4240 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /*  4250 */   247,  248,  249,  250,  251,  252,  253,  122,  251,  124,
+ /*  4260 */   125,  126,  127,  128,  129,  130,  131,  132,  133,    9,
+ /*  4270 */   261,   11,  261,  261,  261,    9,  261,   17,   18,   19,
+ /*  4280 */    20,   21,   22,   23,   18,   19,   20,   21,   22,  261,
+ /*  4290 */   155,  156,  157,  158,  159,  160,  161,  162,  163,  164,
+ /*  4300 */   165,  166,  167,  168,  169,  170,  171,  172,  173,  174,
+ /*  4310 */   175,  176,  177,  178,  179,  180,  181,  182,  183,  184,
+ /*  4320 */   185,  186,  187,  188,  189,  190,  191,  192,  193,  194,
+ /*  4330 */   195,  196,  197,  198,  199,  200,  201,  202,  203,  204,
+ /*  4340 */   261,  261,  261,  261,  209,  261,  211,  261,  213,  261,
+ /*  4350 */   261,  261,  261,  261,  261,  220,  221,  222,  223,  261,
+ /*  4360 */   225,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  4370 */   261,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /*  4380 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  122,
+ /*  4390 */   261,  124,  125,  126,  127,  128,  129,  130,  131,  132,
+ /*  4400 */   133,    9,  261,   11,  261,  261,  261,  261,  261,   17,
+ /*  4410 */    18,   19,   20,   21,   22,   23,  261,  261,  261,  261,
+ /*  4420 */   261,  261,  155,  156,  157,  158,  159,  160,  161,  162,
+ /*  4430 */   163,  164,  165,  166,  167,  168,  169,  170,  171,  172,
+ /*  4440 */   173,  174,  175,  176,  177,  178,  179,  180,  181,  182,
+ /*  4450 */   183,  184,  185,  186,  187,  188,  189,  190,  191,  192,
+ /*  4460 */   193,  194,  195,  196,  197,  198,  199,  200,  201,  202,
+ /*  4470 */   203,  204,  261,  261,  261,  261,  261,  261,  211,  261,
+ /*  4480 */   261,  214,    0,    1,  261,  261,  261,  220,  221,  222,
+ /*  4490 */   223,  261,  225,   11,  261,   13,  261,  261,   16,  261,
+ /*  4500 */   261,  261,  261,  236,  237,  238,  239,  240,  241,  242,
+ /*  4510 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /*  4520 */   253,  122,  261,  124,  125,  126,  127,  128,  129,  130,
+ /*  4530 */   131,  132,  133,    0,    1,  261,  261,  261,  261,  261,
+ /*  4540 */   261,  261,  261,  261,   11,  261,   13,  261,  261,   16,
+ /*  4550 */   261,  261,  261,  261,  155,  156,  157,  158,  159,  160,
+ /*  4560 */   161,  162,  163,  164,  165,  166,  167,  168,  169,  170,
+ /*  4570 */   171,  172,  173,  174,  175,  176,  177,  178,  179,  180,
+ /*  4580 */   181,  182,  183,  184,  185,  186,  187,  188,  189,  190,
+ /*  4590 */   191,  192,  193,  194,  195,  196,  197,  198,  199,  200,
+ /*  4600 */   201,  202,  203,  204,  261,  261,  261,  261,  261,  261,
+ /*  4610 */   211,  261,  261,  261,  215,  261,  261,  261,  261,  220,
+ /*  4620 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  261,
+ /*  4630 */   261,  261,  261,  261,  261,  236,  237,  238,  239,  240,
+ /*  4640 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /*  4650 */   251,  252,  253,  122,  261,  124,  125,  126,  127,  128,
+ /*  4660 */   129,  130,  131,  132,  133,  261,  261,  261,  261,  261,
+ /*  4670 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  4680 */   261,  261,  261,  261,  261,  261,  155,  156,  157,  158,
+ /*  4690 */   159,  160,  161,  162,  163,  164,  165,  166,  167,  168,
+ /*  4700 */   169,  170,  171,  172,  173,  174,  175,  176,  177,  178,
+ /*  4710 */   179,  180,  181,  182,  183,  184,  185,  186,  187,  188,
+ /*  4720 */   189,  190,  191,  192,  193,  194,  195,  196,  197,  198,
+ /*  4730 */   199,  200,  201,  202,  203,  204,  261,  261,  261,  261,
+ /*  4740 */   261,  261,  211,  261,  261,  261,  261,  261,  261,  261,
+ /*  4750 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /*  4760 */   261,  261,  261,  261,  261,  261,  261,  236,  237,  238,
+ /*  4770 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /*  4780 */   249,  250,  251,  252,  253,  122,  261,  124,  125,  126,
+ /*  4790 */   127,  128,  129,  130,  131,  132,  133,  261,  261,  261,
+ /*  4800 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  4810 */   261,  261,  261,  261,  261,  261,  261,  261,  155,  156,
+ /*  4820 */   157,  158,  159,  160,  161,  162,  163,  164,  165,  166,
+ /*  4830 */   167,  168,  169,  170,  171,  172,  173,  174,  175,  176,
+ /*  4840 */   177,  178,  179,  180,  181,  182,  183,  184,  185,  186,
+ /*  4850 */   187,  188,  189,  190,  191,  192,  193,  194,  195,  196,
+ /*  4860 */   197,  198,  199,  200,  201,  202,  203,  204,  261,  261,
+ /*  4870 */   261,  261,  261,  261,  211,  261,  261,  261,  261,  261,
+ /*  4880 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /*  4890 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  236,
+ /*  4900 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /*  4910 */   247,  248,  249,  250,  251,  252,  253,  122,  261,  124,
+ /*  4920 */   125,  126,  127,  128,  129,  130,  131,  132,  133,  261,
+ /*  4930 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  4940 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  4950 */   155,  156,  157,  158,  159,  160,  161,  162,  163,  164,
+ /*  4960 */   165,  166,  167,  168,  169,  170,  171,  172,  173,  174,
+ /*  4970 */   175,  176,  177,  178,  179,  180,  181,  182,  183,  184,
+ /*  4980 */   185,  186,  187,  188,  189,  190,  191,  192,  193,  194,
+ /*  4990 */   195,  196,  197,  198,  199,  200,  201,  202,  203,  204,
+ /*  5000 */     9,   10,  261,  261,  261,  261,  211,  261,  261,   18,
+ /*  5010 */    19,   20,   21,   22,  261,  220,  221,  222,  223,  261,
+ /*  5020 */   225,  261,  261,  261,  261,    9,   35,  261,  261,  261,
+ /*  5030 */   261,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /*  5040 */   245,  246,  247,  248,  249,  250,  251,  252,  253,    1,
+ /*  5050 */     2,    3,    4,    5,    6,    7,    8,    9,   10,  261,
+ /*  5060 */   261,  261,  261,   15,  261,   17,   18,   19,   20,   21,
+ /*  5070 */    22,   23,   24,   25,   26,   27,   28,  261,   30,  261,
+ /*  5080 */   261,   33,  261,   35,   93,   94,   95,   96,  261,  261,
+ /*  5090 */   261,  261,  261,  261,  261,  261,  105,  106,  261,  108,
+ /*  5100 */   109,  110,  111,  112,  113,  114,  115,  116,  117,  118,
+ /*  5110 */    62,  261,   64,  261,  261,  261,   68,   69,   70,   71,
+ /*  5120 */    72,   73,   74,   75,   76,  261,  110,  111,  112,  261,
+ /*  5130 */   261,  261,  261,  261,  261,  261,  211,  261,  261,  261,
+ /*  5140 */   261,   93,   94,   95,   96,  220,  221,  222,  261,  224,
+ /*  5150 */   225,  261,  261,  105,  106,  261,  108,  109,  110,  111,
+ /*  5160 */   112,  113,  114,  115,  116,  117,  118,    2,    3,    4,
+ /*  5170 */     5,    6,    7,    8,    9,   10,  251,  261,  261,  261,
+ /*  5180 */    15,  261,   17,   18,   19,   20,   21,   22,   23,   24,
+ /*  5190 */    25,   26,   27,   28,    9,   30,  261,   34,   33,   36,
+ /*  5200 */    35,   38,   39,   40,   41,   42,   43,   44,   45,   46,
+ /*  5210 */    47,   48,   49,   50,   51,   52,   53,   54,   55,   56,
+ /*  5220 */    57,   58,  261,  261,  261,  261,  261,   62,  261,   64,
+ /*  5230 */   261,  261,  261,   68,   69,   70,   71,   72,   73,   74,
+ /*  5240 */    75,   76,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  5250 */    65,   66,   67,  211,  261,  261,  261,  261,   93,   94,
+ /*  5260 */    95,   96,  220,  221,  261,  261,  261,  261,  261,  227,
+ /*  5270 */   105,  106,  261,  108,  109,  110,  111,  112,  113,  114,
+ /*  5280 */   115,  116,  117,  118,    2,    3,    4,    5,    6,    7,
+ /*  5290 */   261,    9,   10,  251,  261,  110,  111,  112,  261,   17,
+ /*  5300 */    18,   19,   20,   21,   22,   23,  261,  261,  261,   27,
+ /*  5310 */   261,  261,  261,  261,   34,   33,   36,   35,   38,   39,
+ /*  5320 */    40,   41,   42,   43,   44,   45,   46,   47,   48,   49,
+ /*  5330 */    50,   51,   52,   53,   54,   55,   56,   57,   58,  261,
+ /*  5340 */   261,  261,  261,  261,   62,  261,   64,  261,  261,  261,
+ /*  5350 */    68,   69,   70,   71,   72,   73,   74,   75,   76,  261,
+ /*  5360 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  5370 */   211,  261,  261,  211,  261,   93,   94,   95,   96,  220,
+ /*  5380 */   221,  261,  220,  221,  261,  261,  227,  105,  106,  155,
+ /*  5390 */   108,  109,  110,  111,  112,  113,  114,  115,  116,  117,
+ /*  5400 */   118,    2,    3,    4,    5,    6,    7,  261,    9,   10,
+ /*  5410 */   251,  261,  134,  251,  261,  261,   17,   18,   19,   20,
+ /*  5420 */    21,   22,   23,  261,  261,  261,   27,  261,  261,  261,
+ /*  5430 */     3,    4,   33,  155,   35,  261,    9,   10,  261,   12,
+ /*  5440 */   261,  261,  261,  133,  134,  211,   19,   20,  261,  261,
+ /*  5450 */   261,  261,  261,  261,  220,  221,  222,  223,  261,  225,
+ /*  5460 */   261,   62,  261,   64,  261,  155,  261,   68,   69,   70,
+ /*  5470 */    71,   72,   73,   74,   75,   76,  242,  243,  244,  245,
+ /*  5480 */   246,  247,  248,  249,  250,  251,  252,  253,  261,  211,
+ /*  5490 */    63,  261,   93,   94,   95,   96,  261,  261,  220,  221,
+ /*  5500 */   261,  261,  261,  261,  105,  106,  228,  108,  109,  110,
+ /*  5510 */   111,  112,  113,  114,  115,  116,  117,  118,  261,  261,
+ /*  5520 */   261,  211,  133,  134,  261,  261,  261,  261,  261,  251,
+ /*  5530 */   220,  221,  222,  223,  261,  225,  261,  110,  111,  112,
+ /*  5540 */   261,  261,  261,  261,  155,  261,  236,  237,  238,  239,
+ /*  5550 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /*  5560 */   250,  251,  252,  253,  254,  255,  256,  211,  133,  134,
+ /*  5570 */   261,  261,  261,  261,  261,  261,  220,  221,  261,  261,
+ /*  5580 */   261,  261,  211,  227,  261,  261,  261,  261,  261,  261,
+ /*  5590 */   155,  220,  221,  261,  261,  261,  261,  261,  227,  261,
+ /*  5600 */   211,  261,  261,  261,  261,  261,  261,  251,  261,  220,
+ /*  5610 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  261,
+ /*  5620 */   261,  261,  251,  261,  261,  236,  237,  238,  239,  240,
+ /*  5630 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /*  5640 */   251,  252,  253,  254,  255,  256,  211,  261,  261,  261,
+ /*  5650 */   261,  261,  261,  261,  261,  220,  221,  222,  223,  261,
+ /*  5660 */   225,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  5670 */   261,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /*  5680 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  254,
+ /*  5690 */   255,  256,    3,    4,  261,  261,  261,  261,    9,   10,
+ /*  5700 */   261,   12,  261,  261,  261,    3,    4,  261,   19,   20,
+ /*  5710 */    21,    9,   10,  261,   12,  261,  261,  261,  261,  261,
+ /*  5720 */   261,   19,   20,  261,   35,  261,  261,  261,    3,    4,
+ /*  5730 */   261,  261,  261,  261,    9,   10,  261,   12,  261,  261,
+ /*  5740 */   261,  261,  261,  261,   19,   20,   21,  261,  261,  261,
+ /*  5750 */   261,  261,   63,  261,   65,   66,   67,  261,  261,  261,
+ /*  5760 */    35,  261,  261,  261,  261,   63,  261,   65,   66,   67,
+ /*  5770 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  5780 */   261,  261,   93,   94,   95,   96,  261,  261,   63,  261,
+ /*  5790 */    65,   66,   67,  261,  105,  106,  261,  108,  109,  110,
+ /*  5800 */   111,  112,  113,  114,  115,  116,  117,  118,  261,  261,
+ /*  5810 */   133,  134,  110,  111,  112,  261,  261,  261,   93,   94,
+ /*  5820 */    95,   96,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  5830 */   105,  106,  155,  108,  109,  110,  111,  112,  113,  114,
+ /*  5840 */   115,  116,  117,  118,    3,    4,  261,  261,  261,  261,
+ /*  5850 */     9,   10,  261,   12,  261,  261,  261,    3,    4,  261,
+ /*  5860 */    19,   20,   21,    9,  261,  261,   12,  261,  261,  261,
+ /*  5870 */   261,  261,  261,   19,   20,  261,   35,    3,    4,  261,
+ /*  5880 */   261,  261,  261,    9,  261,  261,   12,  261,  211,  133,
+ /*  5890 */   261,  261,  261,   19,   20,  261,  261,  220,  221,  222,
+ /*  5900 */   223,  261,  225,  261,   63,  261,   65,   66,   67,  261,
+ /*  5910 */   261,  155,  261,  236,  237,  238,  239,  240,  241,  242,
+ /*  5920 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /*  5930 */   253,  261,  255,  256,   93,   94,   95,   96,  133,  261,
+ /*  5940 */   261,  261,  261,  261,  261,  261,  105,  106,  261,  108,
+ /*  5950 */   109,  110,  111,  112,  113,  114,  115,  116,  117,  118,
+ /*  5960 */   155,  261,  261,  261,  110,  111,  112,  211,  261,  261,
+ /*  5970 */   261,  261,  261,  261,  261,  261,  220,  221,  222,  223,
+ /*  5980 */   261,  225,  261,  261,  110,  111,  112,  261,  261,  261,
+ /*  5990 */   261,  261,  236,  237,  238,  239,  240,  241,  242,  243,
+ /*  6000 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /*  6010 */   133,  134,  261,  257,  258,  259,  211,  261,  134,  261,
+ /*  6020 */   261,  261,  261,  261,  261,  220,  221,  222,  223,  261,
+ /*  6030 */   225,  261,  155,  261,    3,    4,  261,  261,  261,  155,
+ /*  6040 */     9,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /*  6050 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  261,
+ /*  6060 */   133,  134,  257,  258,  259,  261,   35,  261,  261,  261,
+ /*  6070 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  6080 */   261,  261,  155,  261,  261,  261,  261,  261,  211,  261,
+ /*  6090 */   261,  261,  261,  261,   63,  211,  261,  220,  221,  222,
+ /*  6100 */   223,  261,  225,  261,  220,  221,  261,  261,  261,  261,
+ /*  6110 */   133,  134,  228,  236,  237,  238,  239,  240,  241,  242,
+ /*  6120 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /*  6130 */   253,  261,  155,  261,  261,  251,  261,  260,  211,  108,
+ /*  6140 */   109,  110,  111,  112,  261,  261,  261,  220,  221,  222,
+ /*  6150 */   223,  261,  225,  261,  261,  261,  261,  261,  261,  133,
+ /*  6160 */   134,  261,  235,  236,  237,  238,  239,  240,  241,  242,
+ /*  6170 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /*  6180 */   253,  155,  261,  261,    9,   10,  261,  261,  211,  261,
+ /*  6190 */   261,  261,  261,  261,   19,   20,   21,  220,  221,  222,
+ /*  6200 */   223,  261,  225,  261,  261,  261,  261,  261,  261,  261,
+ /*  6210 */    35,  261,  235,  236,  237,  238,  239,  240,  241,  242,
+ /*  6220 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /*  6230 */   253,  133,  134,  261,  261,  261,  261,  211,  261,  261,
+ /*  6240 */   261,  261,  261,  261,  261,  261,  220,  221,  222,  223,
+ /*  6250 */   261,  225,  261,  155,  261,  261,  261,  261,  261,  261,
+ /*  6260 */   261,  235,  236,  237,  238,  239,  240,  241,  242,  243,
+ /*  6270 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /*  6280 */   261,  133,  134,  108,  109,  110,  111,  112,  113,  114,
+ /*  6290 */   115,  116,  117,  118,  261,  261,    3,    4,  261,  261,
+ /*  6300 */   261,  261,    9,  155,  261,   12,  261,  261,  261,  211,
+ /*  6310 */   261,  261,   19,   20,  261,  261,  261,  261,  220,  221,
+ /*  6320 */   222,  223,  261,  225,  261,  261,  261,  261,  261,  261,
+ /*  6330 */   261,  133,  134,  235,  236,  237,  238,  239,  240,  241,
+ /*  6340 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /*  6350 */   252,  253,  261,  155,  261,  261,   63,  261,  261,  211,
+ /*  6360 */   261,  261,  261,  261,  261,  261,  261,  261,  220,  221,
+ /*  6370 */   222,  223,  261,  225,  261,  261,  261,  261,  261,  261,
+ /*  6380 */   133,  134,  261,  235,  236,  237,  238,  239,  240,  241,
+ /*  6390 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /*  6400 */   252,  253,  155,  110,  111,  112,  261,  261,  261,  211,
+ /*  6410 */   261,  261,  261,  261,  261,  261,  261,  261,  220,  221,
+ /*  6420 */   222,  223,  261,  225,  261,  261,  261,  261,  261,  261,
+ /*  6430 */   261,  261,  261,  235,  236,  237,  238,  239,  240,  241,
+ /*  6440 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /*  6450 */   252,  253,  133,  134,  261,  261,  261,  261,  211,  261,
+ /*  6460 */   261,  261,  261,  261,  261,  261,  261,  220,  221,  222,
+ /*  6470 */   223,  261,  225,  261,  155,  261,  261,  261,  261,  261,
+ /*  6480 */   261,  261,  235,  236,  237,  238,  239,  240,  241,  242,
+ /*  6490 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /*  6500 */   253,  261,  133,  134,  261,  261,  261,  261,  261,  261,
+ /*  6510 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  6520 */   261,  261,  261,  261,  155,  261,  261,  261,  261,  261,
+ /*  6530 */   211,  261,  261,  261,  261,  261,  261,  261,  261,  220,
+ /*  6540 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  261,
+ /*  6550 */   261,  261,  133,  134,  235,  236,  237,  238,  239,  240,
+ /*  6560 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /*  6570 */   251,  252,  253,  261,  155,  261,  261,  261,  261,  261,
+ /*  6580 */   211,  261,  261,  261,  261,  261,  261,  261,  261,  220,
+ /*  6590 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  261,
+ /*  6600 */   261,  133,  134,  261,  235,  236,  237,  238,  239,  240,
+ /*  6610 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /*  6620 */   251,  252,  253,  155,  261,  261,  261,  261,  261,  261,
+ /*  6630 */   211,  261,  261,  261,  261,  261,  261,  261,  261,  220,
+ /*  6640 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  261,
+ /*  6650 */   261,  261,  261,  261,  235,  236,  237,  238,  239,  240,
+ /*  6660 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /*  6670 */   251,  252,  253,  133,  134,  261,  261,  261,  261,  211,
+ /*  6680 */   261,  261,  261,  261,  261,  261,  261,  261,  220,  221,
+ /*  6690 */   222,  223,  261,  225,  261,  155,  261,  261,  261,  261,
+ /*  6700 */   261,  261,  261,  235,  236,  237,  238,  239,  240,  241,
+ /*  6710 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /*  6720 */   252,  253,  261,  133,  134,  261,  261,  261,  261,  261,
+ /*  6730 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  6740 */   261,  261,  261,  261,  261,  155,  261,  261,  261,  261,
+ /*  6750 */   261,  211,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  6760 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /*  6770 */   261,  261,  261,  133,  134,  235,  236,  237,  238,  239,
+ /*  6780 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /*  6790 */   250,  251,  252,  253,  261,  155,  261,  261,  261,  261,
+ /*  6800 */   261,  211,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  6810 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /*  6820 */   261,  261,  133,  134,  261,  235,  236,  237,  238,  239,
+ /*  6830 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /*  6840 */   250,  251,  252,  253,  155,  261,  261,  261,  261,  261,
+ /*  6850 */   261,  211,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  6860 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /*  6870 */   261,  261,  261,  261,  261,  235,  236,  237,  238,  239,
+ /*  6880 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /*  6890 */   250,  251,  252,  253,  133,  134,  261,  261,  261,  261,
+ /*  6900 */   211,  261,  261,  261,  261,  261,  261,  261,  261,  220,
+ /*  6910 */   221,  222,  223,  261,  225,  261,  155,  261,  261,  261,
+ /*  6920 */   261,  261,  261,  261,  235,  236,  237,  238,  239,  240,
+ /*  6930 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /*  6940 */   251,  252,  253,  261,  133,  261,  261,  261,  261,  261,
+ /*  6950 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  6960 */   261,  261,  261,  261,  261,  261,  155,  261,  261,  261,
+ /*  6970 */   261,  261,  211,  261,  261,  261,  261,  261,  261,  261,
+ /*  6980 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /*  6990 */   261,  261,  261,  261,  133,  134,  235,  236,  237,  238,
+ /*  7000 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /*  7010 */   249,  250,  251,  252,  253,  261,  155,  261,  261,  261,
+ /*  7020 */   209,  210,  211,  261,  261,  261,  261,  261,  261,  261,
+ /*  7030 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /*  7040 */   261,  261,  261,  261,  261,  261,  261,  236,  237,  238,
+ /*  7050 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /*  7060 */   249,  250,  251,  252,  253,  261,  261,  261,  261,  134,
+ /*  7070 */   261,  261,  211,  261,  261,  261,  261,  261,  261,  261,
+ /*  7080 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /*  7090 */   155,  261,  261,  261,  261,  261,  261,  236,  237,  238,
+ /*  7100 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /*  7110 */   249,  250,  251,  252,  253,    3,    4,  261,  261,  261,
+ /*  7120 */   261,    9,   10,   11,   12,  261,  261,  261,    3,    4,
+ /*  7130 */   261,   19,   20,   21,    9,   10,  261,   12,  261,  261,
+ /*  7140 */   261,  261,  261,  261,   19,   20,  211,   35,  261,  261,
+ /*  7150 */   261,    3,    4,  261,  261,  220,  221,    9,   10,   11,
+ /*  7160 */    12,  261,  261,  228,  261,  261,  231,   19,   20,   21,
+ /*  7170 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  7180 */   261,  261,  261,   35,  261,  261,  251,  261,   63,  133,
+ /*  7190 */   134,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  7200 */   261,  261,  261,  261,  261,   93,   94,   95,   96,  261,
+ /*  7210 */   261,  155,  261,  261,  261,  261,  261,  105,  106,  261,
+ /*  7220 */   108,  109,  110,  111,  112,  113,  114,  115,  116,  117,
+ /*  7230 */   118,  261,  261,  133,  134,  110,  111,  112,  261,  261,
+ /*  7240 */   261,   93,   94,   95,   96,  261,  261,  261,  261,  134,
+ /*  7250 */   261,  261,  261,  105,  106,  155,  108,  109,  110,  111,
+ /*  7260 */   112,  113,  114,  115,  116,  117,  118,  211,  261,  261,
+ /*  7270 */   155,  261,  261,  261,  261,  261,  220,  221,  222,  223,
+ /*  7280 */   261,  225,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  7290 */   261,  261,  236,  237,  238,  239,  240,  241,  242,  243,
+ /*  7300 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /*  7310 */   261,  211,  261,  261,  261,  261,  155,  261,  261,  261,
+ /*  7320 */   220,  221,  222,  223,  261,  225,  211,  212,  261,  261,
+ /*  7330 */   261,  261,  261,  261,  261,  220,  236,  237,  238,  239,
+ /*  7340 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /*  7350 */   250,  251,  252,  253,  133,  134,  261,  261,  261,  261,
+ /*  7360 */   261,  261,  261,  261,  261,  261,  251,  261,  261,  261,
+ /*  7370 */   261,  261,  211,  261,  261,  261,  155,  261,  261,  261,
+ /*  7380 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /*  7390 */   261,  261,  261,  261,  261,  261,  261,  133,  134,  238,
+ /*  7400 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /*  7410 */   249,  250,  251,  252,  253,  261,  261,    3,    4,  155,
+ /*  7420 */   261,  261,  261,    9,   10,  261,   12,  261,  261,  261,
+ /*  7430 */   261,  261,  211,   19,   20,  261,  261,  261,  261,  261,
+ /*  7440 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /*  7450 */   261,  261,  261,  261,  133,  134,  261,  236,  237,  238,
+ /*  7460 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /*  7470 */   249,  250,  251,  252,  253,  211,  155,   63,  261,   65,
+ /*  7480 */    66,   67,  261,  261,  220,  221,  222,  223,  261,  225,
+ /*  7490 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  7500 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /*  7510 */   246,  247,  248,  249,  250,  251,  252,  253,  261,  261,
+ /*  7520 */   261,    3,    4,  261,  110,  111,  112,    9,   10,  261,
+ /*  7530 */    12,  261,  211,  261,  261,  261,  261,   19,   20,  261,
+ /*  7540 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /*  7550 */   261,  261,  261,  133,  134,  261,  155,  236,  237,  238,
+ /*  7560 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /*  7570 */   249,  250,  251,  252,  253,  155,  261,  261,   34,  261,
+ /*  7580 */   261,   63,   38,   39,   40,   41,   42,   43,   44,   45,
+ /*  7590 */    46,   47,   48,   49,   50,   51,  133,  134,   54,   55,
+ /*  7600 */   261,   57,   58,   59,   60,   61,  261,  261,  261,  261,
+ /*  7610 */   261,  261,  211,  261,  261,  261,  261,  261,  155,  261,
+ /*  7620 */   261,  220,  221,  222,  223,  155,  225,  261,  110,  111,
+ /*  7630 */   112,  211,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  7640 */   220,  221,  222,  223,  261,  225,  245,  246,  247,  248,
+ /*  7650 */   249,  250,  251,  252,  253,  261,  236,  237,  238,  239,
+ /*  7660 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /*  7670 */   250,  251,  252,  253,  211,  133,  261,  261,  261,  261,
+ /*  7680 */   261,  211,  261,  220,  221,  222,  223,  261,  225,  261,
+ /*  7690 */   220,  221,  222,  223,  261,  225,  261,  155,  261,  236,
+ /*  7700 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /*  7710 */   247,  248,  249,  250,  251,  252,  253,  247,  248,  249,
+ /*  7720 */   250,  251,  252,  253,  261,  261,  261,  261,  261,  261,
+ /*  7730 */   133,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  7740 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  7750 */   261,  261,  155,  211,  261,  261,  261,  261,  261,  261,
+ /*  7760 */   155,  261,  220,  221,  222,  223,  261,  225,  226,  261,
+ /*  7770 */   261,  261,  261,  261,  133,  261,  261,  261,  236,  237,
+ /*  7780 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /*  7790 */   248,  249,  250,  251,  252,  253,  155,    4,  261,  261,
+ /*  7800 */   261,  261,    9,  261,  155,   12,  261,  261,  211,  261,
+ /*  7810 */   261,  261,   19,   20,  261,  261,  211,  220,  221,  222,
+ /*  7820 */   223,  261,  225,  226,  261,  220,  221,  222,  223,  261,
+ /*  7830 */   225,  133,  261,  236,  237,  238,  239,  240,  241,  242,
+ /*  7840 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /*  7850 */   253,  261,  211,  155,  249,  250,  251,  252,  253,  261,
+ /*  7860 */   211,  220,  221,  222,  223,  261,  225,  226,  261,  220,
+ /*  7870 */   221,  222,  223,  261,  225,  261,  261,  236,  237,  238,
+ /*  7880 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /*  7890 */   249,  250,  251,  252,  253,  246,  247,  248,  249,  250,
+ /*  7900 */   251,  252,  253,  110,  111,  112,  261,  261,  133,  211,
+ /*  7910 */   261,  261,  261,  261,  261,  261,  261,  261,  220,  221,
+ /*  7920 */   222,  223,  261,  225,  226,  261,  261,  261,  261,  261,
+ /*  7930 */   155,  261,  261,  261,  236,  237,  238,  239,  240,  241,
+ /*  7940 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /*  7950 */   252,  253,  133,  261,  261,  261,  261,  261,  261,  261,
+ /*  7960 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  7970 */   261,  261,  261,  261,  155,  261,  261,  261,  261,  261,
+ /*  7980 */   261,  261,  261,  261,  261,  261,  211,  261,  261,  261,
+ /*  7990 */   261,  261,  261,  261,  261,  220,  221,  222,  223,  261,
+ /*  8000 */   225,  261,  261,  261,  229,  261,  261,  261,  261,  261,
+ /*  8010 */   261,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /*  8020 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  261,
+ /*  8030 */   211,  261,  261,  261,  261,  261,  261,  261,  261,  220,
+ /*  8040 */   221,  222,  223,  261,  225,  226,  261,  261,  261,  261,
+ /*  8050 */   261,  261,  133,  261,  261,  236,  237,  238,  239,  240,
+ /*  8060 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /*  8070 */   251,  252,  253,  261,  155,   34,  261,   36,  261,   38,
+ /*  8080 */    39,   40,   41,   42,   43,   44,   45,   46,   47,   48,
+ /*  8090 */    49,   50,   51,   52,   53,   54,   55,   56,   57,   58,
+ /*  8100 */    34,  261,  261,  261,   38,   39,   40,   41,   42,   43,
+ /*  8110 */    44,   45,   46,   47,   48,   49,   50,   51,   52,   53,
+ /*  8120 */    54,   55,   56,   57,   58,  261,  261,  261,  261,  133,
+ /*  8130 */   211,  261,  261,  261,  261,  261,  261,  261,  261,  220,
+ /*  8140 */   221,  222,  223,  261,  225,  261,  261,  261,  229,  261,
+ /*  8150 */   261,  155,  261,  261,  261,  236,  237,  238,  239,  240,
+ /*  8160 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /*  8170 */   251,  252,  253,  133,  261,  261,  261,  261,  261,  261,
+ /*  8180 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  8190 */   261,  261,  261,  261,  261,  155,  261,  261,  261,  261,
+ /*  8200 */   261,  261,  261,  261,  261,  261,  261,  211,  261,  261,
+ /*  8210 */   261,  261,  261,  261,  261,  261,  220,  221,  222,  223,
+ /*  8220 */   261,  225,  261,  261,  261,  261,  261,  261,  232,  261,
+ /*  8230 */   261,  261,  236,  237,  238,  239,  240,  241,  242,  243,
+ /*  8240 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /*  8250 */   155,  211,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  8260 */   220,  221,  222,  223,  261,  225,  226,  261,  261,  261,
+ /*  8270 */   261,  261,  261,  133,  261,  261,  236,  237,  238,  239,
+ /*  8280 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /*  8290 */   250,  251,  252,  253,  261,  155,    3,    4,  261,  261,
+ /*  8300 */   261,  261,    9,   10,  261,   12,  211,  261,  261,  261,
+ /*  8310 */   261,  261,   19,   20,  261,  220,  221,  222,  223,  261,
+ /*  8320 */   225,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  8330 */   261,  261,  261,  261,  239,  240,  241,  242,  243,  244,
+ /*  8340 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  261,
+ /*  8350 */   133,  211,  261,  261,  261,  261,   63,  261,  261,  261,
+ /*  8360 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  229,
+ /*  8370 */   261,  261,  155,  261,  261,  261,  236,  237,  238,  239,
+ /*  8380 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /*  8390 */   250,  251,  252,  253,  133,  261,  261,  261,  261,  261,
+ /*  8400 */   261,  261,  261,  110,  111,  112,  261,  261,  261,  261,
+ /*  8410 */   261,  261,  261,  261,  261,  261,  155,  261,  261,  261,
+ /*  8420 */   261,  261,  261,  261,  261,  261,  261,  261,  211,  261,
+ /*  8430 */   261,  261,  261,  261,  261,  261,  261,  220,  221,  222,
+ /*  8440 */   223,  261,  225,  261,  261,  261,  261,  261,  261,  232,
+ /*  8450 */   261,  261,  261,  236,  237,  238,  239,  240,  241,  242,
+ /*  8460 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /*  8470 */   253,  155,  211,  261,  261,  261,  261,  261,  261,  261,
+ /*  8480 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /*  8490 */   229,  261,  261,  261,  133,  261,  261,  236,  237,  238,
+ /*  8500 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /*  8510 */   249,  250,  251,  252,  253,  261,  155,    3,    4,  261,
+ /*  8520 */   261,  261,  261,    9,   10,  261,   12,  211,  261,  261,
+ /*  8530 */   261,  261,  261,   19,   20,  261,  220,  221,  222,  223,
+ /*  8540 */   261,  225,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  8550 */   261,  261,  261,  261,  261,  261,  240,  241,  242,  243,
+ /*  8560 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /*  8570 */   261,  261,  211,  133,  261,  261,  261,   63,  261,  261,
+ /*  8580 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /*  8590 */   261,  261,  261,  232,  261,  155,  261,  236,  237,  238,
+ /*  8600 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /*  8610 */   249,  250,  251,  252,  253,  261,  133,  261,  261,  261,
+ /*  8620 */   261,  134,  261,  261,  110,  111,  112,  261,  261,  261,
+ /*  8630 */   261,  261,  134,  261,  261,  261,  261,  261,  155,  261,
+ /*  8640 */   261,  261,  155,  261,  261,  261,  261,  261,  261,  261,
+ /*  8650 */   261,  211,  261,  155,  261,  261,  261,  261,  261,  261,
+ /*  8660 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /*  8670 */   261,  261,  232,  261,  134,  261,  236,  237,  238,  239,
+ /*  8680 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /*  8690 */   250,  251,  252,  253,  211,  155,  134,  261,  211,  212,
+ /*  8700 */   261,  261,  261,  220,  221,  222,  223,  220,  225,  211,
+ /*  8710 */   212,  261,  261,  230,  261,  133,  261,  155,  220,  236,
+ /*  8720 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /*  8730 */   247,  248,  249,  250,  251,  252,  253,  155,  251,    3,
+ /*  8740 */     4,  261,  261,  261,  261,    9,   10,  261,   12,  251,
+ /*  8750 */   261,  211,  261,  261,  261,   19,   20,  261,  261,  261,
+ /*  8760 */   220,  221,  261,  261,  261,  261,  261,  261,  228,  261,
+ /*  8770 */   261,  231,  133,  211,  261,  261,  261,  261,  261,  261,
+ /*  8780 */   261,  261,  220,  221,  261,  261,  261,  261,  261,  261,
+ /*  8790 */   228,  251,  261,  211,  155,  233,  261,  261,  261,   63,
+ /*  8800 */   261,  261,  220,  221,  222,  223,  261,  225,  226,  261,
+ /*  8810 */   261,  261,  261,  251,  261,  133,  261,  261,  236,  237,
+ /*  8820 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /*  8830 */   248,  249,  250,  251,  252,  253,  261,  155,  261,  261,
+ /*  8840 */   261,  261,  261,  261,  261,  155,  110,  111,  112,  261,
+ /*  8850 */   211,  261,  261,  261,  261,  261,  261,  261,  261,  220,
+ /*  8860 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  230,
+ /*  8870 */   261,  261,  261,  261,  134,  236,  237,  238,  239,  240,
+ /*  8880 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /*  8890 */   251,  252,  253,  211,  261,  155,  134,  261,  261,  261,
+ /*  8900 */   261,  211,  220,  221,  222,  223,  261,  225,  261,  261,
+ /*  8910 */   220,  221,  222,  223,  261,  225,  234,  155,  236,  237,
+ /*  8920 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /*  8930 */   248,  249,  250,  251,  252,  253,  133,  247,  248,  249,
+ /*  8940 */   250,  251,  252,  253,  261,  261,  261,  261,  261,  261,
+ /*  8950 */   261,  211,  261,  261,  261,  261,  261,  261,  155,  261,
+ /*  8960 */   220,  221,  261,  261,  261,  261,  261,  261,  228,  261,
+ /*  8970 */   261,  231,  261,  211,  261,  261,  261,  261,  261,  261,
+ /*  8980 */   261,  261,  220,  221,  133,  261,  261,  261,  261,  261,
+ /*  8990 */   228,  251,  261,  231,  261,  261,  261,  261,  261,  261,
+ /*  9000 */   261,  261,  261,  261,  261,  261,  155,  261,  261,  261,
+ /*  9010 */   261,  261,  261,  251,  211,  261,  261,  261,  261,  261,
+ /*  9020 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  226,
+ /*  9030 */   261,  261,  261,  261,  261,  261,  133,  261,  261,  236,
+ /*  9040 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /*  9050 */   247,  248,  249,  250,  251,  252,  253,  261,  155,  261,
+ /*  9060 */   261,  261,  211,  261,  261,  261,  261,  261,  261,  261,
+ /*  9070 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /*  9080 */   261,  230,  261,  261,  261,  261,  261,  236,  237,  238,
+ /*  9090 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /*  9100 */   249,  250,  251,  252,  253,  261,  261,    9,   10,  261,
+ /*  9110 */   261,  261,  261,  261,  211,  261,  261,   19,   20,   21,
+ /*  9120 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /*  9130 */   261,  261,  261,   35,  261,  261,  261,  234,  261,  236,
+ /*  9140 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /*  9150 */   247,  248,  249,  250,  251,  252,  253,  133,  261,  261,
+ /*  9160 */   261,  261,  261,  261,  134,  261,  261,  261,  261,  261,
+ /*  9170 */   261,  261,  261,  261,  261,   77,   78,  261,  261,  155,
+ /*  9180 */   261,  261,  261,  261,  261,  155,  261,  261,  261,  261,
+ /*  9190 */   261,   93,   94,   95,   96,  261,  261,  261,  261,  261,
+ /*  9200 */   261,  261,  261,  105,  106,  133,  108,  109,  110,  111,
+ /*  9210 */   112,  113,  114,  115,  116,  117,  118,  261,  261,  261,
+ /*  9220 */   261,  261,  261,  261,  261,  261,  261,  155,  261,  261,
+ /*  9230 */   261,  261,  261,  261,  261,  211,  261,  261,  261,  261,
+ /*  9240 */   261,  211,  261,  261,  220,  221,  222,  223,  261,  225,
+ /*  9250 */   220,  221,  261,  261,  230,  261,  261,  133,  228,  261,
+ /*  9260 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /*  9270 */   246,  247,  248,  249,  250,  251,  252,  253,  261,  155,
+ /*  9280 */   261,  251,  261,  211,  261,  261,  261,  261,  261,  261,
+ /*  9290 */   261,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /*  9300 */   261,  261,  261,  261,  261,  261,  234,  261,  236,  237,
+ /*  9310 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /*  9320 */   248,  249,  250,  251,  252,  253,  261,  261,  261,  261,
+ /*  9330 */   261,  155,  261,  261,  261,  211,  261,  261,  261,  261,
+ /*  9340 */   261,  261,  261,  261,  220,  221,  222,  223,  261,  225,
+ /*  9350 */   261,  261,  261,  261,  261,  261,  261,  261,  234,  261,
+ /*  9360 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /*  9370 */   246,  247,  248,  249,  250,  251,  252,  253,  133,  261,
+ /*  9380 */   261,  261,  261,  261,  261,  261,  134,  211,  261,  261,
+ /*  9390 */   261,  261,  261,  261,  261,  261,  220,  221,  222,  223,
+ /*  9400 */   155,  225,  261,  261,  261,  261,  261,  155,  261,  261,
+ /*  9410 */   261,  261,  261,  261,  261,  261,  261,  241,  242,  243,
+ /*  9420 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /*  9430 */   261,  133,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  9440 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  9450 */   261,  261,  261,  155,  261,  261,  211,  261,  261,  261,
+ /*  9460 */   261,  261,  261,  211,  261,  220,  221,  222,  223,  261,
+ /*  9470 */   225,  226,  220,  221,  261,  261,  261,  261,  261,  261,
+ /*  9480 */   228,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /*  9490 */   245,  246,  247,  248,  249,  250,  251,  252,  253,    3,
+ /*  9500 */     4,  261,  261,  251,  261,    9,   10,  261,   12,  211,
+ /*  9510 */   261,  261,  261,  261,  261,   19,   20,   21,  220,  221,
+ /*  9520 */   222,  223,  261,  225,  226,  261,  261,  261,  261,  261,
+ /*  9530 */   155,   35,  261,  261,  236,  237,  238,  239,  240,  241,
+ /*  9540 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /*  9550 */   252,  253,  261,  261,  261,  261,  261,  261,  261,   63,
+ /*  9560 */   261,  261,  261,  261,  261,  133,  261,  261,  261,  261,
+ /*  9570 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /*  9580 */   261,  261,  261,  261,  261,  261,  211,  155,  261,   93,
+ /*  9590 */    94,   95,   96,  261,  261,  220,  221,  222,  223,  261,
+ /*  9600 */   225,  105,  106,  261,  108,  109,  110,  111,  112,  113,
+ /*  9610 */   114,  115,  116,  117,  118,  133,  241,  242,  243,  244,
+ /*  9620 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  261,
+ /*  9630 */   261,  261,  261,  261,  261,  261,  261,  155,  261,  261,
+ /*  9640 */   261,  261,  261,  211,  261,  261,  261,  261,  261,  261,
+ /*  9650 */   261,  261,  220,  221,  222,  223,  261,  225,  226,  261,
+ /*  9660 */   261,  261,  261,  261,  261,  133,  261,  261,  236,  237,
+ /*  9670 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /*  9680 */   248,  249,  250,  251,  252,  253,  261,  155,  261,  261,
+ /*  9690 */   261,  261,  261,  211,  261,  261,  261,  261,  261,  261,
+ /*  9700 */   261,  261,  220,  221,  222,  223,  261,  225,  226,  261,
+ /*  9710 */   261,  261,  261,  261,  261,  261,  261,  261,  236,  237,
+ /*  9720 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /*  9730 */   248,  249,  250,  251,  252,  253,  261,  261,  133,  261,
+ /*  9740 */   261,  261,  261,  211,  261,  261,  134,  261,  261,  261,
+ /*  9750 */   261,  261,  220,  221,  222,  223,  261,  225,  226,  261,
+ /*  9760 */   155,  261,  261,  261,  261,  261,  261,  155,  236,  237,
+ /*  9770 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /*  9780 */   248,  249,  250,  251,  252,  253,    3,    4,  134,  261,
+ /*  9790 */   261,  261,    9,   10,  261,   12,  261,  261,  261,  261,
+ /*  9800 */   261,  261,   19,   20,   21,  261,  261,  261,  261,  155,
+ /*  9810 */   261,  261,  261,  261,  261,  261,  211,  261,   35,  261,
+ /*  9820 */   261,  261,  261,  211,  261,  220,  221,  222,  223,  261,
+ /*  9830 */   225,  226,  220,  221,  261,  261,  261,  133,  261,  261,
+ /*  9840 */   228,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /*  9850 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  155,
+ /*  9860 */   261,  261,  261,  251,  261,  211,  261,  261,  261,  261,
+ /*  9870 */   261,  261,  261,  261,  220,  221,   93,   94,   95,   96,
+ /*  9880 */   261,  261,  228,  261,  261,  261,  133,  233,  105,  106,
+ /*  9890 */   261,  108,  109,  110,  111,  112,  113,  114,  115,  116,
+ /*  9900 */   117,  118,  261,  261,  261,  251,  261,  261,  155,  261,
+ /*  9910 */   261,  261,  261,  261,  261,  211,  261,  261,  261,  261,
+ /*  9920 */   261,  261,  261,  261,  220,  221,  222,  223,  261,  225,
+ /*  9930 */   261,  261,  261,  261,  261,  261,  133,  261,  261,  261,
+ /*  9940 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /*  9950 */   246,  247,  248,  249,  250,  251,  252,  253,  155,  261,
+ /*  9960 */   261,  261,  261,  261,  211,  261,  261,  261,  261,  261,
+ /*  9970 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /*  9980 */   261,  261,  261,  261,  261,  133,  261,  261,  261,  236,
+ /*  9990 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /* 10000 */   247,  248,  249,  250,  251,  252,  253,  155,  261,  261,
+ /* 10010 */   261,  261,  261,  261,  211,  261,  261,  261,  261,  261,
+ /* 10020 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /* 10030 */   261,  261,  261,  261,  261,  133,  261,  261,  261,  236,
+ /* 10040 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /* 10050 */   247,  248,  249,  250,  251,  252,  253,  155,  261,  261,
+ /* 10060 */   261,  261,  261,  211,  261,  261,  261,  261,  261,  261,
+ /* 10070 */   261,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 10080 */   261,  261,  261,  261,  133,  261,  261,  261,  236,  237,
+ /* 10090 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /* 10100 */   248,  249,  250,  251,  252,  253,  155,  261,  261,  261,
+ /* 10110 */   261,  261,  261,  211,  261,  261,  261,  261,  261,  261,
+ /* 10120 */   261,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 10130 */   261,  261,  261,  261,  133,  261,  261,  261,  236,  237,
+ /* 10140 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /* 10150 */   248,  249,  250,  251,  252,  253,  155,  261,  261,  261,
+ /* 10160 */   261,  261,  211,  261,  261,  261,  261,  261,  261,  261,
+ /* 10170 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /* 10180 */   261,  261,  261,  261,  261,  261,  261,  236,  237,  238,
+ /* 10190 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /* 10200 */   249,  250,  251,  252,  253,  261,  133,  261,  261,  261,
+ /* 10210 */   261,  261,  211,  261,  261,  261,  261,  261,  261,  261,
+ /* 10220 */   261,  220,  221,  222,  223,  261,  225,  261,  155,  261,
+ /* 10230 */   261,  261,  261,  261,  261,  261,  261,  236,  237,  238,
+ /* 10240 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /* 10250 */   249,  250,  251,  252,  253,    3,    4,  134,  261,  261,
+ /* 10260 */   261,    9,   10,  261,   12,  261,  261,  261,  261,  261,
+ /* 10270 */   261,   19,   20,   21,  261,  261,  261,  261,  155,  261,
+ /* 10280 */   261,  261,  261,  261,  211,  261,  261,   35,  261,  261,
+ /* 10290 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /* 10300 */   261,  261,  261,  261,  261,  133,  261,  261,  261,  236,
+ /* 10310 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /* 10320 */   247,  248,  249,  250,  251,  252,  253,  155,  261,  261,
+ /* 10330 */   261,  261,  261,  261,  211,  261,  261,  261,  261,  261,
+ /* 10340 */   261,  261,  261,  220,  221,   93,   94,   95,   96,  261,
+ /* 10350 */   261,  228,  261,  261,  261,  133,  233,  105,  106,  261,
+ /* 10360 */   108,  109,  110,  111,  112,  113,  114,  115,  116,  117,
+ /* 10370 */   118,  261,  261,  261,  251,  261,  261,  155,  261,  261,
+ /* 10380 */   261,  261,  261,  211,  261,  261,  261,  261,  261,  261,
+ /* 10390 */   261,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 10400 */   261,  261,  261,  261,  261,  133,  261,  261,  236,  237,
+ /* 10410 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /* 10420 */   248,  249,  250,  251,  252,  253,  261,  155,  261,  261,
+ /* 10430 */   261,  261,  261,  211,  261,  261,  261,  261,  261,  261,
+ /* 10440 */   261,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 10450 */   261,  261,  261,  261,  133,  261,  261,  261,  236,  237,
+ /* 10460 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /* 10470 */   248,  249,  250,  251,  252,  253,  155,  261,  261,  261,
+ /* 10480 */   261,  261,  261,  211,  261,  261,  261,  261,  261,  261,
+ /* 10490 */   261,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 10500 */   261,  261,  261,  261,  261,  261,  261,  261,  236,  237,
+ /* 10510 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /* 10520 */   248,  249,  250,  251,  252,  253,  133,  261,  261,  261,
+ /* 10530 */   261,  261,  211,  261,  261,  261,  261,  261,  261,  261,
+ /* 10540 */   261,  220,  221,  222,  223,  261,  225,  261,  155,  261,
+ /* 10550 */   261,  261,  261,  261,  261,  261,  261,  236,  237,  238,
+ /* 10560 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /* 10570 */   249,  250,  251,  252,  253,    3,    4,  134,  261,  261,
+ /* 10580 */   261,    9,   10,  261,   12,  261,  261,  261,  261,  261,
+ /* 10590 */   261,   19,   20,   21,  261,  261,  261,  261,  155,  261,
+ /* 10600 */   261,  261,  261,  261,  211,  261,  261,   35,  261,  261,
+ /* 10610 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /* 10620 */   261,  261,  261,  261,  261,  261,  133,  261,  261,  236,
+ /* 10630 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /* 10640 */   247,  248,  249,  250,  251,  252,  253,  261,  155,  261,
+ /* 10650 */   261,  261,  261,  261,  211,  261,  261,  261,  261,  261,
+ /* 10660 */   261,  261,  261,  220,  221,   93,   94,   95,   96,  261,
+ /* 10670 */   261,  228,  261,  261,  261,  133,  233,  105,  106,  261,
+ /* 10680 */   108,  109,  110,  111,  112,  113,  114,  115,  116,  117,
+ /* 10690 */   118,  261,  261,  261,  251,  261,  261,  155,  261,  261,
+ /* 10700 */   261,  261,  261,  261,  211,  261,  261,  261,  261,  261,
+ /* 10710 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /* 10720 */   261,  261,  261,  261,  261,  133,  261,  261,  261,  236,
+ /* 10730 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /* 10740 */   247,  248,  249,  250,  251,  252,  253,  155,  261,  261,
+ /* 10750 */   261,  261,  261,  211,  261,  261,  261,  261,  261,  261,
+ /* 10760 */   261,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 10770 */   261,  261,  261,  261,  133,  261,  261,  261,  236,  237,
+ /* 10780 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /* 10790 */   248,  249,  250,  251,  252,  253,  155,  261,  261,  261,
+ /* 10800 */   261,  261,  261,  211,  261,  261,  261,  261,  261,  261,
+ /* 10810 */   261,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 10820 */   261,  261,  261,  261,  261,  261,  261,  261,  236,  237,
+ /* 10830 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /* 10840 */   248,  249,  250,  251,  252,  253,  261,  261,  134,  261,
+ /* 10850 */   261,  261,  211,  261,  261,  261,  261,  261,  261,  261,
+ /* 10860 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  155,
+ /* 10870 */   261,  261,  261,  261,  261,  261,  261,  236,  237,  238,
+ /* 10880 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /* 10890 */   249,  250,  251,  252,  253,    3,    4,  261,  261,  261,
+ /* 10900 */   261,    9,   10,  261,   12,  261,  261,  261,  261,  261,
+ /* 10910 */   261,   19,   20,   21,  261,  261,  261,  261,  261,  261,
+ /* 10920 */   261,  261,  261,  261,  261,  211,  261,   35,  261,  261,
+ /* 10930 */   261,    3,    4,  261,  220,  221,  261,    9,   10,  261,
+ /* 10940 */    12,  261,  228,  261,  261,  261,  261,   19,   20,   21,
+ /* 10950 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 10960 */   261,  261,  261,   35,  261,  251,  261,  261,  261,  133,
+ /* 10970 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 10980 */   261,  261,  261,  261,  261,   93,   94,   95,   96,  261,
+ /* 10990 */   261,  155,  261,  261,  261,  261,  261,  105,  106,  261,
+ /* 11000 */   108,  109,  110,  111,  112,  113,  114,  115,  116,  117,
+ /* 11010 */   118,  261,  261,  133,  261,  261,  261,  261,  261,  261,
+ /* 11020 */   261,   93,   94,   95,   96,  261,  261,  261,  261,  261,
+ /* 11030 */   261,  261,  261,  105,  106,  155,  108,  109,  110,  111,
+ /* 11040 */   112,  113,  114,  115,  116,  117,  118,  211,  261,  261,
+ /* 11050 */   261,  261,  261,  261,  261,  261,  220,  221,  222,  223,
+ /* 11060 */   261,  225,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 11070 */   261,  133,  236,  237,  238,  239,  240,  241,  242,  243,
+ /* 11080 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /* 11090 */   261,  211,  261,  155,  261,  261,  261,  261,  261,  261,
+ /* 11100 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /* 11110 */   261,  261,  261,  261,  261,  261,  236,  237,  238,  239,
+ /* 11120 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /* 11130 */   250,  251,  252,  253,  133,  261,  261,  261,  261,  261,
+ /* 11140 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  211,
+ /* 11150 */   261,  261,  261,  261,  261,  261,  155,  261,  220,  221,
+ /* 11160 */   222,  223,  261,  225,  261,  261,  261,  261,  261,  261,
+ /* 11170 */   261,  261,  261,  261,  236,  237,  238,  239,  240,  241,
+ /* 11180 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /* 11190 */   252,  253,  133,  261,  261,  261,  261,  261,  261,  261,
+ /* 11200 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 11210 */   261,  261,  211,  261,  155,  261,  261,  261,  261,  261,
+ /* 11220 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /* 11230 */   261,  261,  261,  261,  261,  133,  261,  236,  237,  238,
+ /* 11240 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /* 11250 */   249,  250,  251,  252,  253,  261,  261,  155,  261,  261,
+ /* 11260 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 11270 */   211,  261,  261,  261,  261,  261,  261,  261,  261,  220,
+ /* 11280 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  261,
+ /* 11290 */   261,  261,  133,  261,  261,  236,  237,  238,  239,  240,
+ /* 11300 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /* 11310 */   251,  252,  253,  211,  155,  261,  261,  261,  261,  261,
+ /* 11320 */   261,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 11330 */   261,  261,  261,  261,  261,  261,  261,  261,  236,  237,
+ /* 11340 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /* 11350 */   248,  249,  250,  251,  252,  253,  133,  261,  261,  261,
+ /* 11360 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 11370 */   211,  261,  261,  261,  261,  261,  261,  261,  155,  220,
+ /* 11380 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  261,
+ /* 11390 */   261,  261,  261,  261,  261,  236,  237,  238,  239,  240,
+ /* 11400 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /* 11410 */   251,  252,  253,  133,  261,  261,  261,  261,  261,  261,
+ /* 11420 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 11430 */   261,  261,  261,  261,  211,  155,  261,  261,  261,  261,
+ /* 11440 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /* 11450 */   261,  261,  261,  261,  261,  261,  133,  261,  261,  236,
+ /* 11460 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /* 11470 */   247,  248,  249,  250,  251,  252,  253,  261,  155,  261,
+ /* 11480 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 11490 */   261,  211,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 11500 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /* 11510 */   261,  261,  261,  133,  261,  261,  236,  237,  238,  239,
+ /* 11520 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /* 11530 */   250,  251,  252,  253,  211,  155,  261,  261,  261,  261,
+ /* 11540 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /* 11550 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  236,
+ /* 11560 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /* 11570 */   247,  248,  249,  250,  251,  252,  253,  133,  261,  261,
+ /* 11580 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 11590 */   261,  211,  261,  261,  261,  261,  261,  261,  261,  155,
+ /* 11600 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /* 11610 */   261,  261,  261,  261,  261,  261,  236,  237,  238,  239,
+ /* 11620 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /* 11630 */   250,  251,  252,  253,  133,  261,  261,  261,  261,  261,
+ /* 11640 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 11650 */   261,  261,  261,  261,  261,  211,  155,  261,  261,  261,
+ /* 11660 */   261,  261,  261,  261,  220,  221,  222,  223,  261,  225,
+ /* 11670 */   261,  261,  261,  261,  261,  261,  261,  133,  261,  261,
+ /* 11680 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /* 11690 */   246,  247,  248,  249,  250,  251,  252,  253,  261,  155,
+ /* 11700 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 11710 */   261,  261,  211,  261,  261,  261,  261,  261,  261,  261,
+ /* 11720 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /* 11730 */   261,  261,  261,  261,  133,  261,  261,  236,  237,  238,
+ /* 11740 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /* 11750 */   249,  250,  251,  252,  253,  211,  155,  261,  261,  261,
+ /* 11760 */   261,  261,  261,  261,  220,  221,  222,  223,  261,  225,
+ /* 11770 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 11780 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /* 11790 */   246,  247,  248,  249,  250,  251,  252,  253,  133,  261,
+ /* 11800 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 11810 */   261,  261,  211,  261,  261,  261,  261,  261,  261,  261,
+ /* 11820 */   155,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /* 11830 */   261,  261,  261,  261,  261,  261,  261,  236,  237,  238,
+ /* 11840 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /* 11850 */   249,  250,  251,  252,  253,  133,  261,  261,  261,  261,
+ /* 11860 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 11870 */   261,  261,  261,  261,  261,  261,  211,  155,  261,  261,
+ /* 11880 */   261,  261,  261,  261,  261,  220,  221,  222,  223,  261,
+ /* 11890 */   225,  261,  261,  261,  261,  261,  261,  261,  133,  261,
+ /* 11900 */   261,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /* 11910 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  261,
+ /* 11920 */   155,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 11930 */   261,  261,  261,  211,  261,  261,  261,  261,  261,  261,
+ /* 11940 */   261,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 11950 */   261,  261,  261,  261,  261,  133,  261,  261,  236,  237,
+ /* 11960 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /* 11970 */   248,  249,  250,  251,  252,  253,  211,  155,  261,  261,
+ /* 11980 */   261,  261,  261,  261,  261,  220,  221,  222,  223,  261,
+ /* 11990 */   225,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 12000 */   261,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /* 12010 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  133,
+ /* 12020 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 12030 */   261,  261,  261,  211,  261,  261,  261,  261,  261,  261,
+ /* 12040 */   261,  155,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 12050 */   261,  261,  261,  261,  261,  261,  261,  261,  236,  237,
+ /* 12060 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /* 12070 */   248,  249,  250,  251,  252,  253,  133,  261,  261,  261,
+ /* 12080 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 12090 */   261,  261,  261,  261,  261,  261,  261,  211,  155,  261,
+ /* 12100 */   261,  261,  261,  261,  261,  261,  220,  221,  222,  223,
+ /* 12110 */   261,  225,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 12120 */   261,  134,  236,  237,  238,  239,  240,  241,  242,  243,
+ /* 12130 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /* 12140 */     3,    4,  155,  261,  261,  261,    9,   10,  261,   12,
+ /* 12150 */   261,  261,  261,  261,  211,  261,   19,   20,   21,  261,
+ /* 12160 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /* 12170 */   261,  261,   35,  261,  261,  261,  261,  261,  133,  236,
+ /* 12180 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /* 12190 */   247,  248,  249,  250,  251,  252,  253,  261,  211,  261,
+ /* 12200 */   155,  261,  261,  261,  261,  261,  261,  220,  221,  261,
+ /* 12210 */   261,  261,  261,  261,  261,  228,  261,  261,  261,  261,
+ /* 12220 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 12230 */    93,   94,   95,   96,  261,  261,  261,  261,  251,  261,
+ /* 12240 */   133,  261,  105,  106,  261,  108,  109,  110,  111,  112,
+ /* 12250 */   113,  114,  115,  116,  117,  118,  211,  261,  261,  261,
+ /* 12260 */   261,  261,  155,  261,  261,  220,  221,  222,  223,  261,
+ /* 12270 */   225,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 12280 */   261,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /* 12290 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  133,
+ /* 12300 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 12310 */   261,  261,  261,  261,  261,  261,  261,  261,  211,  261,
+ /* 12320 */   261,  155,  261,  261,  261,  261,  261,  220,  221,  222,
+ /* 12330 */   223,  261,  225,  261,  261,  261,  261,  261,  261,  261,
+ /* 12340 */   261,  261,  261,  236,  237,  238,  239,  240,  241,  242,
+ /* 12350 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /* 12360 */   253,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 12370 */   261,  261,  261,  261,  133,  261,  261,  211,  261,  261,
+ /* 12380 */   261,  261,  261,  261,  261,  261,  220,  221,  222,  223,
+ /* 12390 */   261,  225,  261,  261,  261,  261,  155,  261,  261,  261,
+ /* 12400 */   261,  261,  236,  237,  238,  239,  240,  241,  242,  243,
+ /* 12410 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /* 12420 */   133,  261,  261,  261,  261,  261,  261,  134,  261,  261,
+ /* 12430 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 12440 */   261,  261,  155,  261,  261,  261,  261,  261,  155,  261,
+ /* 12450 */   261,  261,  211,  261,  261,  261,  261,  261,  261,  261,
+ /* 12460 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /* 12470 */   261,  261,  261,  261,  261,  261,  261,  236,  237,  238,
+ /* 12480 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /* 12490 */   249,  250,  251,  252,  253,  261,  261,  261,  211,  261,
+ /* 12500 */   261,  261,  261,  261,  211,  261,  155,  220,  221,  222,
+ /* 12510 */   223,  261,  225,  220,  221,  261,  261,  261,  261,  261,
+ /* 12520 */   133,  228,  261,  236,  237,  238,  239,  240,  241,  242,
+ /* 12530 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /* 12540 */   253,  261,  155,  261,  251,  261,  261,  261,  261,  261,
+ /* 12550 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 12560 */   261,  261,  211,  261,  261,  261,  261,  261,  261,  261,
+ /* 12570 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /* 12580 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 12590 */   261,  261,  261,  261,  261,  133,  261,  261,  211,  248,
+ /* 12600 */   249,  250,  251,  252,  253,  261,  261,  220,  221,  222,
+ /* 12610 */   223,  261,  225,  261,  261,  261,  261,  155,  261,  261,
+ /* 12620 */   261,  261,  261,  236,  237,  238,  239,  240,  241,  242,
+ /* 12630 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /* 12640 */   253,  133,  261,  261,  261,  261,  261,  261,  134,  261,
+ /* 12650 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 12660 */   261,  261,  261,  155,  261,  261,  261,  261,  261,  155,
+ /* 12670 */   261,  261,  261,  211,  261,  261,  261,  261,  261,  261,
+ /* 12680 */   261,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 12690 */   261,  261,  261,  261,  261,  261,  261,  261,  236,  237,
+ /* 12700 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /* 12710 */   248,  249,  250,  251,  252,  253,  261,  261,  261,  211,
+ /* 12720 */   261,  261,  261,  261,  261,  211,  261,  155,  220,  221,
+ /* 12730 */   222,  223,  261,  225,  220,  221,  261,  261,  261,  261,
+ /* 12740 */   261,  133,  228,  261,  236,  237,  238,  239,  240,  241,
+ /* 12750 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /* 12760 */   252,  253,  261,  155,  261,  251,  261,  261,  261,  261,
+ /* 12770 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 12780 */   261,  261,  261,  211,  261,  261,  261,  261,  261,  261,
+ /* 12790 */   261,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 12800 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 12810 */   261,  261,  261,  261,  261,  261,  133,  261,  261,  211,
+ /* 12820 */   248,  249,  250,  251,  252,  253,  261,  261,  220,  221,
+ /* 12830 */   222,  223,  261,  225,  261,  261,  261,  261,  155,  261,
+ /* 12840 */   261,  261,  261,  261,  236,  237,  238,  239,  240,  241,
+ /* 12850 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /* 12860 */   252,  253,  133,  261,  261,  261,  261,  261,  261,  134,
+ /* 12870 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 12880 */   261,  261,  261,  261,  155,  261,  261,  261,  261,  261,
+ /* 12890 */   155,  261,  261,  261,  211,  261,  261,  261,  261,  261,
+ /* 12900 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /* 12910 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  236,
+ /* 12920 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /* 12930 */   247,  248,  249,  250,  251,  252,  253,  261,  261,  261,
+ /* 12940 */   211,  261,  261,  261,  261,  261,  211,  261,  155,  220,
+ /* 12950 */   221,  222,  223,  261,  225,  220,  221,  261,  261,  261,
+ /* 12960 */   261,  261,  133,  228,  261,  236,  237,  238,  239,  240,
+ /* 12970 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /* 12980 */   251,  252,  253,  261,  155,  261,  251,  261,  261,  261,
+ /* 12990 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 13000 */   261,  261,  261,  261,  211,  261,  261,  261,  261,  261,
+ /* 13010 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /* 13020 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 13030 */   261,  261,  261,  261,  261,  261,  261,  133,  261,  261,
+ /* 13040 */   211,  248,  249,  250,  251,  252,  253,  261,  261,  220,
+ /* 13050 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  155,
+ /* 13060 */   261,  261,  261,  261,  261,  236,  237,  238,  239,  240,
+ /* 13070 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /* 13080 */   251,  252,  253,  133,  261,  261,  261,  261,  261,  261,
+ /* 13090 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 13100 */   261,  261,  261,  261,  261,  155,  261,  261,  261,  261,
+ /* 13110 */   261,  261,  261,  261,  261,  211,  261,  261,  261,  261,
+ /* 13120 */   261,  261,  261,  261,  220,  221,  222,  223,  261,  225,
+ /* 13130 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 13140 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /* 13150 */   246,  247,  248,  249,  250,  251,  252,  253,  261,  261,
+ /* 13160 */   261,  211,  261,  261,  261,  261,  261,  261,  261,  155,
+ /* 13170 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /* 13180 */   261,  261,  261,  133,  261,  261,  236,  237,  238,  239,
+ /* 13190 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /* 13200 */   250,  251,  252,  253,  261,  155,  261,  261,  261,  261,
+ /* 13210 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 13220 */   261,  261,  261,  261,  261,  211,  261,  261,  261,  261,
+ /* 13230 */   261,  261,  261,  261,  220,  221,  222,  223,  261,  225,
+ /* 13240 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 13250 */   261,  261,  261,  261,  261,  261,  261,  261,  133,  261,
+ /* 13260 */   261,  211,  248,  249,  250,  251,  252,  253,  261,  261,
+ /* 13270 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /* 13280 */   155,  261,  261,  261,  261,  261,  236,  237,  238,  239,
+ /* 13290 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /* 13300 */   250,  251,  252,  253,  133,  261,  261,  261,  261,  261,
+ /* 13310 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 13320 */   261,  261,  261,  261,  261,  261,  155,  261,  261,  261,
+ /* 13330 */   261,  261,  261,  261,  261,  261,  211,  261,  261,  261,
+ /* 13340 */   261,  261,  261,  261,  261,  220,  221,  222,  223,  261,
+ /* 13350 */   225,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 13360 */   261,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /* 13370 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  261,
+ /* 13380 */   261,  261,  211,  261,  261,  261,  261,  261,  261,  261,
+ /* 13390 */   155,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /* 13400 */   261,  261,  261,  261,  133,  261,  261,  236,  237,  238,
+ /* 13410 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /* 13420 */   249,  250,  251,  252,  253,  261,  155,  261,  261,  261,
+ /* 13430 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 13440 */   261,  261,  261,  261,  261,  261,  211,  261,  261,  261,
+ /* 13450 */   261,  261,  261,  261,  261,  220,  221,  222,  223,  261,
+ /* 13460 */   225,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 13470 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  133,
+ /* 13480 */   261,  261,  211,  248,  249,  250,  251,  252,  253,  261,
+ /* 13490 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /* 13500 */   261,  155,  261,  261,  261,  261,  261,  236,  237,  238,
+ /* 13510 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /* 13520 */   249,  250,  251,  252,  253,  133,  261,  261,  261,  261,
+ /* 13530 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 13540 */   261,  261,  261,  261,  261,  261,  261,  155,  261,  261,
+ /* 13550 */   261,  261,  261,  261,  261,  261,  261,  211,  261,  261,
+ /* 13560 */   261,  261,  261,  261,  261,  261,  220,  221,  222,  223,
+ /* 13570 */   261,  225,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 13580 */   261,  261,  236,  237,  238,  239,  240,  241,  242,  243,
+ /* 13590 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /* 13600 */   261,  261,  261,  211,  261,  261,  261,  261,  261,  261,
+ /* 13610 */   261,  155,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 13620 */   261,  261,  261,  261,  261,  133,  261,  261,  236,  237,
+ /* 13630 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /* 13640 */   248,  249,  250,  251,  252,  253,  261,  155,  261,  261,
+ /* 13650 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 13660 */   261,  261,  261,  261,  261,  261,  261,  211,  261,  261,
+ /* 13670 */   261,  261,  261,  261,  261,  261,  220,  221,  222,  223,
+ /* 13680 */   261,  225,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 13690 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 13700 */   133,  261,  261,  211,  248,  249,  250,  251,  252,  253,
+ /* 13710 */   261,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 13720 */   261,  261,  155,  261,  261,  261,  261,  261,  236,  237,
+ /* 13730 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /* 13740 */   248,  249,  250,  251,  252,  253,  133,  261,  261,  261,
+ /* 13750 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 13760 */   261,  261,  261,  261,  261,  261,  261,  261,  155,  261,
+ /* 13770 */   261,  261,  261,  261,  261,  261,  261,  261,  211,  261,
+ /* 13780 */   261,  261,  261,  261,  261,  261,  261,  220,  221,  222,
+ /* 13790 */   223,  261,  225,  261,  261,  261,  261,  261,  261,  261,
+ /* 13800 */   261,  261,  261,  236,  237,  238,  239,  240,  241,  242,
+ /* 13810 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /* 13820 */   253,  261,  261,  261,  211,  261,  261,  261,  261,  261,
+ /* 13830 */   261,  261,  155,  220,  221,  222,  223,  261,  225,  261,
+ /* 13840 */   261,  261,  261,  261,  261,  261,  133,  261,  261,  236,
+ /* 13850 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /* 13860 */   247,  248,  249,  250,  251,  252,  253,  261,  155,  261,
+ /* 13870 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 13880 */   261,  261,  261,  261,  261,  261,  261,  261,  211,  261,
+ /* 13890 */   261,  261,  261,  261,  261,  261,  261,  220,  221,  222,
+ /* 13900 */   223,  261,  225,  261,  261,  261,  261,  261,  261,  261,
+ /* 13910 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 13920 */   261,  133,  261,  261,  211,  248,  249,  250,  251,  252,
+ /* 13930 */   253,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /* 13940 */   261,  261,  261,  155,  261,  261,  261,  261,  261,  236,
+ /* 13950 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /* 13960 */   247,  248,  249,  250,  251,  252,  253,  133,  261,  261,
+ /* 13970 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 13980 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  155,
+ /* 13990 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  211,
+ /* 14000 */   261,  261,  261,  261,  261,  261,  261,  261,  220,  221,
+ /* 14010 */   222,  223,  261,  225,  261,  261,  261,  261,  261,  261,
+ /* 14020 */   261,  261,  261,  261,  236,  237,  238,  239,  240,  241,
+ /* 14030 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /* 14040 */   252,  253,  261,  261,  261,  211,  261,  261,  261,  261,
+ /* 14050 */   261,  261,  261,  155,  220,  221,  222,  223,  261,  225,
+ /* 14060 */   261,  261,  261,  261,  261,  261,  261,  133,  261,  261,
+ /* 14070 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /* 14080 */   246,  247,  248,  249,  250,  251,  252,  253,  261,  155,
+ /* 14090 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14100 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  211,
+ /* 14110 */   261,  261,  261,  261,  261,  261,  261,  261,  220,  221,
+ /* 14120 */   222,  223,  261,  225,  261,  261,  261,  261,  261,  261,
+ /* 14130 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14140 */   261,  261,  133,  261,  261,  211,  248,  249,  250,  251,
+ /* 14150 */   252,  253,  261,  261,  220,  221,  222,  223,  261,  225,
+ /* 14160 */   261,  261,  261,  261,  155,  261,  261,  261,  261,  261,
+ /* 14170 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /* 14180 */   246,  247,  248,  249,  250,  251,  252,  253,  133,  261,
+ /* 14190 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14200 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14210 */   155,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14220 */   211,  261,  261,  261,  261,  261,  261,  261,  261,  220,
+ /* 14230 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  261,
+ /* 14240 */   261,  261,  261,  261,  261,  236,  237,  238,  239,  240,
+ /* 14250 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /* 14260 */   251,  252,  253,  261,  261,  261,  211,  261,  261,  261,
+ /* 14270 */   261,  261,  261,  261,  155,  220,  221,  222,  223,  261,
+ /* 14280 */   225,  261,  261,  261,  261,  261,  261,  261,  133,  261,
+ /* 14290 */   261,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /* 14300 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  261,
+ /* 14310 */   155,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14320 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14330 */   211,  261,  261,  261,  261,  261,  261,  261,  261,  220,
+ /* 14340 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  261,
+ /* 14350 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14360 */   261,  261,  261,  133,  261,  261,  211,  248,  249,  250,
+ /* 14370 */   251,  252,  253,  261,  261,  220,  221,  222,  223,  261,
+ /* 14380 */   225,  261,  261,  261,  261,  155,  261,  261,  261,  261,
+ /* 14390 */   261,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /* 14400 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  133,
+ /* 14410 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14420 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14430 */   261,  155,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14440 */   261,  211,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14450 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /* 14460 */   261,  261,  261,  261,  261,  261,  236,  237,  238,  239,
+ /* 14470 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /* 14480 */   250,  251,  252,  253,  261,  261,  261,  211,  261,  261,
+ /* 14490 */   261,  261,  261,  261,  261,  155,  220,  221,  222,  223,
+ /* 14500 */   261,  225,  261,  261,  261,  261,  261,  261,  261,  133,
+ /* 14510 */   261,  261,  236,  237,  238,  239,  240,  241,  242,  243,
+ /* 14520 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /* 14530 */   261,  155,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14540 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14550 */   261,  211,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14560 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /* 14570 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14580 */   261,  261,  261,  261,  133,  261,  261,  211,  248,  249,
+ /* 14590 */   250,  251,  252,  253,  261,  261,  220,  221,  222,  223,
+ /* 14600 */   261,  225,  261,  261,  261,  261,  155,  261,  261,  261,
+ /* 14610 */   261,  261,  236,  237,  238,  239,  240,  241,  242,  243,
+ /* 14620 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /* 14630 */   133,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14640 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14650 */   261,  261,  155,  261,  261,  261,  261,  261,  261,  261,
+ /* 14660 */   261,  261,  211,  261,  261,  261,  261,  261,  261,  261,
+ /* 14670 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /* 14680 */   261,  261,  261,  261,  261,  261,  261,  236,  237,  238,
+ /* 14690 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /* 14700 */   249,  250,  251,  252,  253,  261,  261,  261,  211,  261,
+ /* 14710 */   261,  261,  261,  261,  261,  261,  155,  220,  221,  222,
+ /* 14720 */   223,  261,  225,  261,  261,  261,  261,  261,  261,  261,
+ /* 14730 */   133,  261,  261,  236,  237,  238,  239,  240,  241,  242,
+ /* 14740 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /* 14750 */   253,  261,  155,  261,  261,  261,  261,  261,  261,  261,
+ /* 14760 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14770 */   261,  261,  211,  261,  261,  261,  261,  261,  261,  261,
+ /* 14780 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /* 14790 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14800 */   261,  261,  261,  261,  261,  133,  261,  261,  211,  248,
+ /* 14810 */   249,  250,  251,  252,  253,  261,  261,  220,  221,  222,
+ /* 14820 */   223,  261,  225,  261,  261,  261,  261,  155,  261,  261,
+ /* 14830 */   261,  261,  261,  236,  237,  238,  239,  240,  241,  242,
+ /* 14840 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /* 14850 */   253,  133,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14860 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14870 */   261,  261,  261,  155,  261,  261,  261,  261,  261,  261,
+ /* 14880 */   261,  261,  261,  211,  261,  261,  261,  261,  261,  261,
+ /* 14890 */   261,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 14900 */   261,  261,  261,  261,  261,  261,  261,  261,  236,  237,
+ /* 14910 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /* 14920 */   248,  249,  250,  251,  252,  253,  261,  261,  261,  211,
+ /* 14930 */   261,  261,  261,  261,  261,  261,  261,  155,  220,  221,
+ /* 14940 */   222,  223,  261,  225,  261,  261,  261,  261,  261,  261,
+ /* 14950 */   261,  133,  261,  261,  236,  237,  238,  239,  240,  241,
+ /* 14960 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /* 14970 */   252,  253,  261,  155,  261,  261,  261,  261,  261,  261,
+ /* 14980 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 14990 */   261,  261,  261,  211,  261,  261,  261,  261,  261,  261,
+ /* 15000 */   261,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 15010 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15020 */   261,  261,  261,  261,  261,  261,  133,  261,  261,  211,
+ /* 15030 */   248,  249,  250,  251,  252,  253,  261,  261,  220,  221,
+ /* 15040 */   222,  223,  261,  225,  261,  261,  261,  261,  155,  261,
+ /* 15050 */   261,  261,  261,  261,  236,  237,  238,  239,  240,  241,
+ /* 15060 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /* 15070 */   252,  253,  133,  261,  261,  261,  261,  261,  261,  261,
+ /* 15080 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15090 */   261,  261,  261,  261,  155,  261,  261,  261,  261,  261,
+ /* 15100 */   261,  261,  261,  261,  211,  261,  261,  261,  261,  261,
+ /* 15110 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /* 15120 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  236,
+ /* 15130 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /* 15140 */   247,  248,  249,  250,  251,  252,  253,  261,  261,  261,
+ /* 15150 */   211,  261,  261,  261,  261,  261,  261,  261,  155,  220,
+ /* 15160 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  261,
+ /* 15170 */   261,  261,  133,  261,  261,  236,  237,  238,  239,  240,
+ /* 15180 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /* 15190 */   251,  252,  253,  261,  155,  261,  261,  261,  261,  261,
+ /* 15200 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15210 */   261,  261,  261,  261,  211,  261,  261,  261,  261,  261,
+ /* 15220 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /* 15230 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15240 */   261,  261,  261,  261,  261,  261,  261,  133,  261,  261,
+ /* 15250 */   211,  248,  249,  250,  251,  252,  253,  261,  261,  220,
+ /* 15260 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  155,
+ /* 15270 */   261,  261,  261,  261,  261,  236,  237,  238,  239,  240,
+ /* 15280 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /* 15290 */   251,  252,  253,  133,  261,  261,  261,  261,  261,  261,
+ /* 15300 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15310 */   261,  261,  261,  261,  261,  155,  261,  261,  261,  261,
+ /* 15320 */   261,  261,  261,  261,  261,  211,  261,  261,  261,  261,
+ /* 15330 */   261,  261,  261,  261,  220,  221,  222,  223,  261,  225,
+ /* 15340 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15350 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /* 15360 */   246,  247,  248,  249,  250,  251,  252,  253,  261,  261,
+ /* 15370 */   261,  211,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15380 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /* 15390 */   261,  261,  261,  133,  261,  261,  236,  237,  238,  239,
+ /* 15400 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /* 15410 */   250,  251,  252,  253,  261,  155,  261,  261,  261,  261,
+ /* 15420 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15430 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15440 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15450 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15460 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  133,
+ /* 15470 */   261,  211,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15480 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /* 15490 */   261,  155,  261,  261,  261,  261,  236,  237,  238,  239,
+ /* 15500 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /* 15510 */   250,  251,  252,  253,    3,    4,  261,  261,  261,  261,
+ /* 15520 */     9,   10,  261,   12,  261,  261,  261,  261,  261,  261,
+ /* 15530 */    19,   20,   21,  261,  261,  261,  261,  261,  261,  261,
+ /* 15540 */   261,  261,  261,  261,  261,  261,   35,  211,  261,  261,
+ /* 15550 */   261,  261,  261,  261,  261,  261,  220,  221,  222,  223,
+ /* 15560 */   261,  225,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15570 */   261,  261,  236,  237,  238,  239,  240,  241,  242,  243,
+ /* 15580 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /* 15590 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15600 */   261,  261,  261,  261,   93,   94,   95,   96,  261,  261,
+ /* 15610 */   261,  261,  261,  261,  133,  261,  105,  106,  261,  108,
+ /* 15620 */   109,  110,  111,  112,  113,  114,  115,  116,  117,  118,
+ /* 15630 */   261,  261,  261,  261,  261,  261,  155,  261,  261,  261,
+ /* 15640 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15650 */   261,  261,  261,  261,  261,  261,  261,  133,  261,  261,
+ /* 15660 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15670 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  155,
+ /* 15680 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15690 */   261,  261,  211,  261,  261,  261,  261,  261,  261,  261,
+ /* 15700 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /* 15710 */   261,  261,  261,  261,  133,  261,  261,  236,  237,  238,
+ /* 15720 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /* 15730 */   249,  250,  251,  252,  253,  211,  155,  261,  261,  261,
+ /* 15740 */   261,  261,  261,  261,  220,  221,  222,  223,  261,  225,
+ /* 15750 */   261,  261,  261,  261,  261,  261,  261,  133,  261,  261,
+ /* 15760 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /* 15770 */   246,  247,  248,  249,  250,  251,  252,  253,  261,  155,
+ /* 15780 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15790 */   261,  261,  211,  261,  261,  261,  261,  261,  261,  261,
+ /* 15800 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /* 15810 */   261,  261,  261,  261,  261,  261,  261,  236,  237,  238,
+ /* 15820 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /* 15830 */   249,  250,  251,  252,  253,  211,  133,  261,  261,  261,
+ /* 15840 */   261,  261,  261,  261,  220,  221,  222,  223,  261,  225,
+ /* 15850 */   261,  261,  261,  261,  261,  261,  261,  261,  155,  261,
+ /* 15860 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /* 15870 */   246,  247,  248,  249,  250,  251,  252,  253,  261,  133,
+ /* 15880 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15890 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15900 */   261,  155,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 15910 */   261,  261,  261,  261,  211,  261,  261,  261,  261,  261,
+ /* 15920 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /* 15930 */   261,  261,  261,  261,  261,  261,  133,  261,  261,  236,
+ /* 15940 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /* 15950 */   247,  248,  249,  250,  251,  252,  253,  211,  155,  261,
+ /* 15960 */   261,  261,  261,  261,  261,  261,  220,  221,  222,  223,
+ /* 15970 */   261,  225,  261,  261,  261,  261,  261,  261,  261,  133,
+ /* 15980 */   261,  261,  236,  237,  238,  239,  240,  241,  242,  243,
+ /* 15990 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /* 16000 */   261,  155,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 16010 */   261,  261,  261,  261,  211,  261,  261,  261,  261,  261,
+ /* 16020 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /* 16030 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  236,
+ /* 16040 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /* 16050 */   247,  248,  249,  250,  251,  252,  253,  211,  133,  261,
+ /* 16060 */   261,  261,  261,  261,  261,  261,  220,  221,  222,  223,
+ /* 16070 */   261,  225,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 16080 */   155,  261,  236,  237,  238,  239,  240,  241,  242,  243,
+ /* 16090 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /* 16100 */   261,  133,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 16110 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 16120 */   261,  261,  261,  155,  261,  261,  261,  261,  261,  261,
+ /* 16130 */   261,  261,  261,  261,  261,  261,  211,  261,  261,  261,
+ /* 16140 */   261,  261,  261,  261,  261,  220,  221,  222,  223,  261,
+ /* 16150 */   225,  261,  261,  261,  261,  261,  261,  261,  133,  261,
+ /* 16160 */   261,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /* 16170 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  211,
+ /* 16180 */   155,  261,  261,  261,  261,  261,  261,  261,  220,  221,
+ /* 16190 */   222,  223,  261,  225,  261,  261,  261,  261,  261,  261,
+ /* 16200 */   261,  133,  261,  261,  236,  237,  238,  239,  240,  241,
+ /* 16210 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /* 16220 */   252,  253,  261,  155,  261,  261,  261,  261,  261,  261,
+ /* 16230 */   261,  261,  261,  261,  261,  261,  211,  261,  261,  261,
+ /* 16240 */   261,  261,  261,  261,  261,  220,  221,  222,  223,  261,
+ /* 16250 */   225,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 16260 */   261,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /* 16270 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  211,
+ /* 16280 */   133,  261,  261,  261,  261,  261,  261,  261,  220,  221,
+ /* 16290 */   222,  223,  261,  225,  261,  261,  261,  261,  261,  261,
+ /* 16300 */   261,  261,  155,  261,  236,  237,  238,  239,  240,  241,
+ /* 16310 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /* 16320 */   252,  253,  261,  133,  261,  261,  261,  261,  261,  261,
+ /* 16330 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 16340 */   261,  261,  261,  261,  261,  155,  261,  261,  261,  261,
+ /* 16350 */   261,  261,  261,  261,  261,  261,  261,  261,  211,  261,
+ /* 16360 */   261,  261,  261,  261,  261,  261,  261,  220,  221,  222,
+ /* 16370 */   223,  261,  225,  261,  261,  261,  261,  261,  261,  261,
+ /* 16380 */   133,  261,  261,  236,  237,  238,  239,  240,  241,  242,
+ /* 16390 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /* 16400 */   253,  211,  155,  261,  261,  261,  261,  261,  261,  261,
+ /* 16410 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /* 16420 */   261,  261,  261,  133,  261,  261,  236,  237,  238,  239,
+ /* 16430 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /* 16440 */   250,  251,  252,  253,  261,  155,  261,  261,  261,  261,
+ /* 16450 */   261,  261,  261,  261,  261,  261,  261,  261,  211,  261,
+ /* 16460 */   261,  261,  261,  261,  261,  261,  261,  220,  221,  222,
+ /* 16470 */   223,  261,  225,  261,  261,  261,  261,  261,  261,  261,
+ /* 16480 */   261,  261,  261,  236,  237,  238,  239,  240,  241,  242,
+ /* 16490 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /* 16500 */   253,  211,  133,  261,  261,  261,  261,  261,  261,  261,
+ /* 16510 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /* 16520 */   261,  261,  261,  261,  155,  261,  236,  237,  238,  239,
+ /* 16530 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /* 16540 */   250,  251,  252,  253,  261,  133,  261,  261,  261,  261,
+ /* 16550 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 16560 */   261,  261,  261,  261,  261,  261,  261,  155,  261,  261,
+ /* 16570 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 16580 */   211,  261,  261,  261,  261,  261,  261,  261,  261,  220,
+ /* 16590 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  261,
+ /* 16600 */   261,  261,  133,  261,  261,  236,  237,  238,  239,  240,
+ /* 16610 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /* 16620 */   251,  252,  253,  211,  155,  261,  261,  261,  261,  261,
+ /* 16630 */   261,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 16640 */   261,  261,  261,  261,  261,  133,  261,  261,  236,  237,
+ /* 16650 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /* 16660 */   248,  249,  250,  251,  252,  253,  261,  155,  261,  261,
+ /* 16670 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 16680 */   211,  261,  261,  261,  261,  261,  261,  261,  261,  220,
+ /* 16690 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  261,
+ /* 16700 */   261,  261,  261,  261,  261,  236,  237,  238,  239,  240,
+ /* 16710 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /* 16720 */   251,  252,  253,  211,  261,  261,  261,  261,  261,  261,
+ /* 16730 */   261,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 16740 */   261,  261,  261,  261,  261,  261,  261,  261,  236,  237,
+ /* 16750 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /* 16760 */   248,  249,  250,  251,  252,  253,    3,    4,  261,  261,
+ /* 16770 */   261,  261,    9,   10,  261,   12,  261,  261,  261,  261,
+ /* 16780 */   261,  261,   19,   20,   21,  261,  261,  261,  261,  261,
+ /* 16790 */   261,  261,  261,  261,  261,  261,  261,  261,   35,  261,
+ /* 16800 */   261,  261,    3,    4,  261,  261,  261,  261,    9,   10,
+ /* 16810 */   261,   12,  261,  261,  261,  261,  261,  261,   19,   20,
+ /* 16820 */    21,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 16830 */   261,  261,  261,  261,   35,  261,  261,  261,  261,  261,
+ /* 16840 */   133,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 16850 */   261,  261,  261,  261,  261,  261,   93,   94,   95,   96,
+ /* 16860 */   261,  261,  155,  261,  261,  261,  261,  261,  105,  106,
+ /* 16870 */   261,  108,  109,  110,  111,  112,  113,  114,  115,  116,
+ /* 16880 */   117,  118,  261,  261,  133,  261,  261,  261,  261,  261,
+ /* 16890 */   261,  261,   93,   94,   95,   96,  261,  261,  261,  261,
+ /* 16900 */   261,  261,  261,  261,  105,  106,  155,  108,  109,  110,
+ /* 16910 */   111,  112,  113,  114,  115,  116,  117,  118,  211,  261,
+ /* 16920 */   261,  261,  261,  261,  261,  261,  261,  220,  221,  222,
+ /* 16930 */   223,  261,  225,  261,  261,  261,  261,  261,  261,  261,
+ /* 16940 */   261,  261,  133,  236,  237,  238,  239,  240,  241,  242,
+ /* 16950 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /* 16960 */   253,  261,  211,  261,  155,  261,  261,  261,  261,  261,
+ /* 16970 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /* 16980 */   261,  261,  261,  261,  261,  261,  261,  236,  237,  238,
+ /* 16990 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /* 17000 */   249,  250,  251,  252,  253,  133,  261,  261,  261,  261,
+ /* 17010 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 17020 */   211,  261,  261,  261,  261,  261,  261,  155,  261,  220,
+ /* 17030 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  261,
+ /* 17040 */   261,  261,  261,  261,  261,  236,  237,  238,  239,  240,
+ /* 17050 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /* 17060 */   251,  252,  253,  133,  261,  261,  261,  261,  261,  261,
+ /* 17070 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 17080 */   261,  261,  261,  211,  261,  155,  261,  261,  261,  261,
+ /* 17090 */   261,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 17100 */   261,  261,  261,  261,  261,  261,  133,  261,  236,  237,
+ /* 17110 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /* 17120 */   248,  249,  250,  251,  252,  253,  261,  261,  155,  261,
+ /* 17130 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 17140 */   261,  211,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 17150 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /* 17160 */   261,  261,  261,  133,  261,  261,  236,  237,  238,  239,
+ /* 17170 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /* 17180 */   250,  251,  252,  253,  211,  155,  261,  261,  261,  261,
+ /* 17190 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /* 17200 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  236,
+ /* 17210 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /* 17220 */   247,  248,  249,  250,  251,  252,  253,  133,  261,  261,
+ /* 17230 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 17240 */   261,  211,  261,  261,  261,  261,  261,  261,  261,  155,
+ /* 17250 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /* 17260 */   261,  261,  261,  261,  261,  261,  236,  237,  238,  239,
+ /* 17270 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /* 17280 */   250,  251,  252,  253,  133,  261,  261,  261,  261,  261,
+ /* 17290 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 17300 */   261,  261,  261,  261,  261,  211,  155,  261,  261,  261,
+ /* 17310 */   261,  261,  261,  261,  220,  221,  222,  223,  261,  225,
+ /* 17320 */   261,  261,  261,  261,  261,  261,  261,  133,  261,  261,
+ /* 17330 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /* 17340 */   246,  247,  248,  249,  250,  251,  252,  253,  261,  155,
+ /* 17350 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 17360 */   261,  261,  211,  261,  261,  261,  261,  261,  261,  261,
+ /* 17370 */   261,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /* 17380 */   261,  261,  261,  261,  133,  261,  261,  236,  237,  238,
+ /* 17390 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /* 17400 */   249,  250,  251,  252,  253,  211,  155,  261,  261,  261,
+ /* 17410 */   261,  261,  261,  261,  220,  221,  222,  223,  261,  225,
+ /* 17420 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 17430 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /* 17440 */   246,  247,  248,  249,  250,  251,  252,  253,  133,  261,
+ /* 17450 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 17460 */   261,  261,  211,  261,  261,  261,  261,  261,  261,  261,
+ /* 17470 */   155,  220,  221,  222,  223,  261,  225,  261,  261,  261,
+ /* 17480 */   261,  261,  261,  261,  261,  261,  261,  236,  237,  238,
+ /* 17490 */   239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+ /* 17500 */   249,  250,  251,  252,  253,  133,  261,  261,  261,  261,
+ /* 17510 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 17520 */   261,  261,  261,  261,  261,  261,  211,  155,  261,  261,
+ /* 17530 */   261,  261,  261,  261,  261,  220,  221,  222,  223,  261,
+ /* 17540 */   225,  261,  261,  261,  261,  261,  261,  261,  133,  261,
+ /* 17550 */   261,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /* 17560 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  261,
+ /* 17570 */   155,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 17580 */   261,  261,  261,  211,  261,  261,  261,  261,  261,  261,
+ /* 17590 */   261,  261,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 17600 */   261,  261,  261,  261,  261,  133,  261,  261,  236,  237,
+ /* 17610 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /* 17620 */   248,  249,  250,  251,  252,  253,  211,  155,  261,  261,
+ /* 17630 */   261,  261,  261,  261,  261,  220,  221,  222,  223,  261,
+ /* 17640 */   225,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 17650 */   261,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /* 17660 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  133,
+ /* 17670 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 17680 */   261,  261,  261,  211,  261,  261,  261,  261,  261,  261,
+ /* 17690 */   261,  155,  220,  221,  222,  223,  261,  225,  261,  261,
+ /* 17700 */   261,  261,  261,  261,  261,  261,  261,  261,  236,  237,
+ /* 17710 */   238,  239,  240,  241,  242,  243,  244,  245,  246,  247,
+ /* 17720 */   248,  249,  250,  251,  252,  253,  133,  261,  261,  261,
+ /* 17730 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 17740 */   261,  261,  261,  261,  261,  261,  261,  211,  155,  261,
+ /* 17750 */   261,  261,  261,  261,  261,  261,  220,  221,  222,  223,
+ /* 17760 */   261,  225,  261,  261,  261,  261,  261,  261,  261,  133,
+ /* 17770 */   261,  261,  236,  237,  238,  239,  240,  241,  242,  243,
+ /* 17780 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /* 17790 */   261,  155,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 17800 */   261,  261,  261,  261,  211,  261,  261,  261,  261,  261,
+ /* 17810 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /* 17820 */   261,  261,  261,  261,  261,  261,  133,  261,  261,  236,
+ /* 17830 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /* 17840 */   247,  248,  249,  250,  251,  252,  253,  211,  155,  261,
+ /* 17850 */   261,  261,  261,  261,  261,  261,  220,  221,  222,  223,
+ /* 17860 */   261,  225,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 17870 */   261,  261,  236,  237,  238,  239,  240,  241,  242,  243,
+ /* 17880 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /* 17890 */   133,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 17900 */   261,  261,  261,  261,  211,  261,  261,  261,  261,  261,
+ /* 17910 */   261,  261,  155,  220,  221,  222,  223,  261,  225,  261,
+ /* 17920 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  236,
+ /* 17930 */   237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+ /* 17940 */   247,  248,  249,  250,  251,  252,  253,  133,  261,  261,
+ /* 17950 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 17960 */   261,  261,  261,  261,  261,  261,  261,  261,  211,  155,
+ /* 17970 */   261,  261,  261,  261,  261,  261,  261,  220,  221,  222,
+ /* 17980 */   223,  261,  225,  261,  261,  261,  261,  261,  261,  261,
+ /* 17990 */   133,  261,  261,  236,  237,  238,  239,  240,  241,  242,
+ /* 18000 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /* 18010 */   253,  261,  155,  261,  261,  261,  261,  261,  261,  261,
+ /* 18020 */   261,  261,  261,  261,  261,  211,  261,  261,  261,  261,
+ /* 18030 */   261,  261,  261,  261,  220,  221,  222,  223,  261,  225,
+ /* 18040 */   261,  261,  261,  261,  261,  261,  261,  133,  261,  261,
+ /* 18050 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /* 18060 */   246,  247,  248,  249,  250,  251,  252,  253,  211,  155,
+ /* 18070 */   261,  261,  261,  261,  261,  261,  261,  220,  221,  222,
+ /* 18080 */   223,  261,  225,  261,  261,  261,  261,  261,  261,  261,
+ /* 18090 */   261,  261,  261,  236,  237,  238,  239,  240,  241,  242,
+ /* 18100 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /* 18110 */   253,  133,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 18120 */   261,  261,  261,  261,  261,  211,  261,  261,  261,  261,
+ /* 18130 */   261,  261,  261,  155,  220,  221,  222,  223,  261,  225,
+ /* 18140 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 18150 */   236,  237,  238,  239,  240,  241,  242,  243,  244,  245,
+ /* 18160 */   246,  247,  248,  249,  250,  251,  252,  253,  133,  261,
+ /* 18170 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 18180 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  211,
+ /* 18190 */   155,  261,  261,  261,  261,  261,  261,  261,  220,  221,
+ /* 18200 */   222,  223,  261,  225,  261,  261,  261,  261,  261,  261,
+ /* 18210 */   261,  133,  261,  261,  236,  237,  238,  239,  240,  241,
+ /* 18220 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /* 18230 */   252,  253,  261,  155,  261,  261,  261,  261,  261,  261,
+ /* 18240 */   261,  261,  261,  261,  261,  261,  211,  261,  261,  261,
+ /* 18250 */   261,  261,  261,  261,  261,  220,  221,  222,  223,  261,
+ /* 18260 */   225,  261,  261,  261,  261,  261,  261,  261,  133,  261,
+ /* 18270 */   261,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /* 18280 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  211,
+ /* 18290 */   155,  261,  261,  261,  261,  261,  261,  261,  220,  221,
+ /* 18300 */   222,  223,  261,  225,  261,  261,  261,  261,  261,  261,
+ /* 18310 */   261,  261,  261,  261,  236,  237,  238,  239,  240,  241,
+ /* 18320 */   242,  243,  244,  245,  246,  247,  248,  249,  250,  251,
+ /* 18330 */   252,  253,  133,  261,  261,  261,  261,  261,  261,  261,
+ /* 18340 */   261,  261,  261,  261,  261,  261,  211,  261,  261,  261,
+ /* 18350 */   261,  261,  261,  261,  155,  220,  221,  222,  223,  261,
+ /* 18360 */   225,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 18370 */   261,  236,  237,  238,  239,  240,  241,  242,  243,  244,
+ /* 18380 */   245,  246,  247,  248,  249,  250,  251,  252,  253,  133,
+ /* 18390 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 18400 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 18410 */   211,  155,  261,  261,  261,  261,  261,  261,  261,  220,
+ /* 18420 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  261,
+ /* 18430 */   261,  261,  133,  261,  261,  236,  237,  238,  239,  240,
+ /* 18440 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /* 18450 */   251,  252,  253,  261,  155,  261,  261,  261,  261,  261,
+ /* 18460 */   261,  261,  261,  261,  261,  261,  261,  211,  261,  261,
+ /* 18470 */   261,  261,  261,  261,  261,  261,  220,  221,  222,  223,
+ /* 18480 */   261,  225,  261,  261,  261,  261,  261,  261,  261,  133,
+ /* 18490 */   261,  261,  236,  237,  238,  239,  240,  241,  242,  243,
+ /* 18500 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /* 18510 */   211,  155,  261,  261,  261,  261,  261,  261,  261,  220,
+ /* 18520 */   221,  222,  223,  261,  225,  261,  261,  261,  261,  261,
+ /* 18530 */   261,  261,  261,  261,  261,  236,  237,  238,  239,  240,
+ /* 18540 */   241,  242,  243,  244,  245,  246,  247,  248,  249,  250,
+ /* 18550 */   251,  252,  253,  133,  261,  261,  261,  261,  261,  261,
+ /* 18560 */   261,  261,  261,  261,  261,  261,  261,  211,  261,  261,
+ /* 18570 */   261,  261,  261,  261,  261,  155,  220,  221,  222,  223,
+ /* 18580 */   261,  225,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 18590 */   261,  261,  236,  237,  238,  239,  240,  241,  242,  243,
+ /* 18600 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /* 18610 */   133,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 18620 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 18630 */   261,  211,  155,  261,  261,  261,  261,  261,  261,  261,
+ /* 18640 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /* 18650 */   261,  261,  261,  261,  261,  261,  236,  237,  238,  239,
+ /* 18660 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /* 18670 */   250,  251,  252,  253,  261,  155,  261,  261,  261,  261,
+ /* 18680 */   261,  261,  261,  261,  261,  261,  261,  261,  211,  261,
+ /* 18690 */   261,  261,  261,  261,  261,  261,  261,  220,  221,  222,
+ /* 18700 */   223,  261,  225,  261,  261,  261,  261,  261,  261,  261,
+ /* 18710 */   261,  261,  261,  236,  237,  238,  239,  240,  241,  242,
+ /* 18720 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /* 18730 */   253,  211,  155,  261,  261,  261,  261,  261,  261,  261,
+ /* 18740 */   220,  221,  222,  223,  261,  225,  261,  261,  261,  261,
+ /* 18750 */   261,  261,  261,  261,  261,  261,  236,  237,  238,  239,
+ /* 18760 */   240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+ /* 18770 */   250,  251,  252,  253,  261,    9,   10,  261,  261,   13,
+ /* 18780 */   261,  261,  261,  261,  261,   19,   20,   21,  211,  261,
+ /* 18790 */   261,  261,  261,  261,  261,  261,  261,  220,  221,  222,
+ /* 18800 */   223,   35,  225,  261,  261,  261,  261,  261,  261,  261,
+ /* 18810 */   261,  261,  261,  236,  237,  238,  239,  240,  241,  242,
+ /* 18820 */   243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+ /* 18830 */   253,    9,   10,  261,  261,   13,  261,  261,  261,  261,
+ /* 18840 */   261,   19,   20,   21,  261,  261,  261,  261,  261,  261,
+ /* 18850 */   261,  261,  261,  261,  261,  261,  155,   35,  261,   93,
+ /* 18860 */    94,   95,   96,  261,  261,  261,  261,  261,  261,  261,
+ /* 18870 */   261,  105,  106,  261,  108,  109,  110,  111,  112,  113,
+ /* 18880 */   114,  115,  116,  117,  118,    9,   10,  261,  261,  261,
+ /* 18890 */   261,  261,  261,  261,  261,   19,   20,   21,  261,  261,
+ /* 18900 */   261,  261,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 18910 */   261,   35,  211,  261,  261,   93,   94,   95,   96,  261,
+ /* 18920 */   261,  220,  221,  222,  223,  261,  225,  105,  106,  261,
+ /* 18930 */   108,  109,  110,  111,  112,  113,  114,  115,  116,  117,
+ /* 18940 */   118,  155,  241,  242,  243,  244,  245,  246,  247,  248,
+ /* 18950 */   249,  250,  251,  252,  253,  261,  155,  261,  261,  261,
+ /* 18960 */   261,  261,  261,  261,  261,  261,  261,  261,  261,   93,
+ /* 18970 */    94,   95,   96,  261,  261,  261,  261,  261,  261,  261,
+ /* 18980 */   261,  105,  106,  261,  108,  109,  110,  111,  112,  113,
+ /* 18990 */   114,  115,  116,  117,  118,  261,  261,  211,  261,  155,
+ /* 19000 */   261,  261,  261,  261,  261,  261,  220,  221,  222,  223,
+ /* 19010 */   261,  225,  211,  261,  261,  155,  261,  261,  261,  261,
+ /* 19020 */   261,  220,  221,  222,  223,  261,  225,  241,  242,  243,
+ /* 19030 */   244,  245,  246,  247,  248,  249,  250,  251,  252,  253,
+ /* 19040 */   261,  261,  261,  242,  243,  244,  245,  246,  247,  248,
+ /* 19050 */   249,  250,  251,  252,  253,  211,  261,  261,  261,  261,
+ /* 19060 */   261,  261,  261,  261,  220,  221,  222,  223,  155,  225,
+ /* 19070 */   261,  211,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 19080 */   220,  221,  222,  223,  155,  225,  242,  243,  244,  245,
+ /* 19090 */   246,  247,  248,  249,  250,  251,  252,  253,  261,  261,
+ /* 19100 */   261,  261,  242,  243,  244,  245,  246,  247,  248,  249,
+ /* 19110 */   250,  251,  252,  253,  261,  261,  261,  261,  261,  261,
+ /* 19120 */   261,  261,  261,  261,  211,  261,  261,  155,  261,  261,
+ /* 19130 */   261,  261,  261,  220,  221,  222,  223,  261,  225,  261,
+ /* 19140 */   211,  261,  155,  261,  261,  261,  261,  261,  261,  220,
+ /* 19150 */   221,  222,  223,  261,  225,  261,  243,  244,  245,  246,
+ /* 19160 */   247,  248,  249,  250,  251,  252,  253,  261,  261,  261,
+ /* 19170 */   261,  261,  261,  244,  245,  246,  247,  248,  249,  250,
+ /* 19180 */   251,  252,  253,  211,  261,  155,  261,  261,  261,  261,
+ /* 19190 */   261,  261,  220,  221,  222,  223,  261,  225,  211,  261,
+ /* 19200 */   155,  261,  261,  261,  261,  261,  261,  220,  221,  222,
+ /* 19210 */   223,  261,  225,  261,  261,  261,  261,  261,  246,  247,
+ /* 19220 */   248,  249,  250,  251,  252,  253,  261,  261,  261,  261,
+ /* 19230 */   261,  261,  261,  261,  247,  248,  249,  250,  251,  252,
+ /* 19240 */   253,  211,  261,  261,  261,  261,  261,  261,  261,  261,
+ /* 19250 */   220,  221,  222,  223,  261,  225,  211,  261,  261,  261,
+ /* 19260 */   261,  261,  261,  261,  261,  220,  221,  222,  223,  261,
+ /* 19270 */   225,  261,  261,  261,  261,  261,  261,  247,  248,  249,
+ /* 19280 */   250,  251,  252,  253,  261,  261,  261,  261,  261,  261,
+ /* 19290 */   261,  261,  247,  248,  249,  250,  251,  252,  253,
+};
+#define YY_SHIFT_USE_DFLT (-9)
+static short yy_shift_ofst[] = {
+ /*     0 */  5165,   14,   89, 5165, 5048,   -9,   -9,   -9,   -9,   -9,
+ /*    10 */    -9,   -9,   -9,   -9,   -9, 9783,   -9,   -9,   -9,   -9,
+ /*    20 */    -9,  297, 18876,   99, 18876,   -9,   66, 18876,  141, 18876,
+ /*    30 */     9, 18876,  286, 18876,  163, 18876,  190, 18876,  265, 18876,
+ /*    40 */   418, 18876,   -8, 18876,    8, 18876,   -9,   -9, 18876,   -9,
+ /*    50 */  18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9,
+ /*    60 */   256, 6175,   -9,   -9,   -9,   -9,   -9,  377, 18876,  141,
+ /*    70 */     9, 18876,  286, 18876,  163,  190,  265,  418, 18876,   -8,
+ /*    80 */  18876,    8, 18876,   -9,  470, 18876,  286, 18876,  163,   -8,
+ /*    90 */  18876,    8, 18876,   -9,   -9,   -9,   -9,  477, 18876,  163,
+ /*   100 */     8, 18876,   -9,   -9,   -9,   -9,   -9,   -9,  510, 18876,
+ /*   110 */    -9,  591, 18876,  619, 7112,   -9,   -9,   -9,   -9,  602,
+ /*   120 */  18876,  468,   -9, 18876,  628,   -9,   -9,  634, 7112,  668,
+ /*   130 */    -9,  752, 7112,  760,   -9,  761,  221, 7148,  762,   -9,
+ /*   140 */    -9,   -9,   -9, 18766,   -9,  767,   -9,  345, 18822,  799,
+ /*   150 */   869, 10252,   -9,   -9,   -9,   -9,   -9,  870,  874,   -9,
+ /*   160 */   849,   -9,  850,   -9, 18876,   -9, 18876,   -9, 18876,   -9,
+ /*   170 */   851,   -9, 18876,    8, 18876,    8, 18876,  163,  853,   -9,
+ /*   180 */  18876,  286, 18876,  286,  854,   -9, 18876,   66,   -9,   -9,
+ /*   190 */    -9,   -9,   -9,   -9,   -9,   -9,   -9,   -9,   -9,   -9,
+ /*   200 */    -9,   -9,   -9,   -9,   -9,   -9,   -9,   -9,   95,   -9,
+ /*   210 */   619,   -9,   -9,   -9,   -9,   -9,   -9,   -9,   -9,   -9,
+ /*   220 */    -9,   -9,   -9,   -9,   -9,   -9,   -9,   -9,   -9,   -9,
+ /*   230 */    -9,   -9,   -9,   -9,   -9,   -9,   -9,   -9,   -9,   -9,
+ /*   240 */    -9,   -9,   -9,   -9,   -9,   -9,   -9,   -9,   -9,   -9,
+ /*   250 */    -9,   -9,   -9,   -9,   -9,   -9,   -9,   -9,   -9,   -9,
+ /*   260 */    -9,   -9,  884,  885, 4260,  886,   85, 5165,  889,   -9,
+ /*   270 */   895,  896, 4260,  894,  897, 5165,  898,   -9,  900, 5165,
+ /*   280 */   932,   -9,  901, 5165, 1003,   -9, 1005, 5165, 1006,   -9,
+ /*   290 */  1008, 18876,  899, 1009, 5165, 1007,   -9, 1011, 5165, 1012,
+ /*   300 */   881, 1014, 18876, 1015,   -9, 1018, 5282,  469, 4266, 1001,
+ /*   310 */  5854, 1024, 1025, 5165, 1026,   -9,  455,   -9,   -9, 1028,
+ /*   320 */  18876, 1029, 1030, 5165,   -9, 1031, 18876, 1032, 1033, 5165,
+ /*   330 */  1065,   -9, 18876,   -9, 1035, 1115, 10572,   -9,   -9,   -9,
+ /*   340 */    -9,   -9, 1035, 1117, 18876,   -9,  479, 1118, 18876,   -9,
+ /*   350 */   482, 1122, 18876,   -9, 1035, 1124, 18876,   -9, 1035, 1127,
+ /*   360 */  18876,   -9, 1035, 1134, 10892,   -9,   -9,   -9,   -9, 5163,
+ /*   370 */  10928,   -9,   -9,   -9,   -9, 18876,   -9, 18876,   -9, 18876,
+ /*   380 */    -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,
+ /*   390 */    -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,
+ /*   400 */    -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,
+ /*   410 */    -9, 18876,   -9, 18876,   -9, 18876,   -9, 5280, 12137,   -9,
+ /*   420 */    -9,   -9,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,
+ /*   430 */    -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,
+ /*   440 */    -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,
+ /*   450 */    -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,
+ /*   460 */    -9, 18876,   -9, 18876,   -9, 8066, 18876,   -9, 18876,   -9,
+ /*   470 */  18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9,
+ /*   480 */  18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9,
+ /*   490 */  18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9,
+ /*   500 */  18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9,
+ /*   510 */  1135, 18876, 1133, 1138, 18876,   -9, 8041, 15511,   -9,   -9,
+ /*   520 */    -9,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9,
+ /*   530 */  18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9,
+ /*   540 */  18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9,
+ /*   550 */  18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9,
+ /*   560 */  18876,   -9, 18876,   -9, 1139, 16763,   -9,   -9,   -9,   -9,
+ /*   570 */  4482, 1140, 16799,   -9,   -9,   -9,   -9, 7544, 18876,   -9,
+ /*   580 */  18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9,
+ /*   590 */  18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9,
+ /*   600 */  18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9,
+ /*   610 */  18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9, 18876,   -9,
+ /*   620 */  18876,   -9, 6031,   -9,   -9, 1159,  110,   -9,  470,   -9,
+ /*   630 */    -9,   -9,  470,  510,  591,  174, 9098, 1160, 1174,   -9,
+ /*   640 */    -9,   -9,   -9, 9098, 1162, 1176,   -9, 18876, 1195, 1279,
+ /*   650 */    -9, 5185, 1267, 5016,  470,  510,  591,  470,  510,  591,
+ /*   660 */  9098, 1268, 5016, 1267, 9098, 1269, 5016, 1267, 18876, 1270,
+ /*   670 */  5016, 1267, 5702, 1271, 18876, 1273, 18876,   -9,   -9, 9098,
+ /*   680 */  1274, 5427, 1275, 18876, 1273,   -9,   -9,  470,  510,  591,
+ /*   690 */    -9,   -9,   -9, 6293,  492, 1276, 18876, 1278, 18876,   -9,
+ /*   700 */    -9, 6293,   -9,   -9, 9098, 1280, 7125, 1285, 18876, 1273,
+ /*   710 */  6293,  496, 1287, 18876, 1278, 18876, 1288, 7518, 1289, 18876,
+ /*   720 */  1273, 6293,  498, 1290, 18876, 1278, 6293,  606, 1291, 18876,
+ /*   730 */  1278, 7414, 1292, 18876, 1293, 18876,   -9,   -9, 9098, 1294,
+ /*   740 */  8293, 1295, 18876, 1293, 6293,  608, 1296, 18876, 1328, 18876,
+ /*   750 */    -9,   -9, 6293,   -9,   -9, 9098, 1399, 8514, 1400, 18876,
+ /*   760 */  1293, 6293,  609, 1401, 18876, 1328, 18876, 1402, 8736, 1403,
+ /*   770 */  18876, 1293, 6293,  610, 1404, 18876, 1328, 6293,  620, 1406,
+ /*   780 */  18876, 1328, 5689, 9098, 9496,   -9,   -9,   -9,   -9,   -9,
+ /*   790 */    -9, 9098, 9496,   -9, 9496, 4533, 18876,   -9,   -9, 9496,
+ /*   800 */    -9, 5725,   -9, 9098, 1407, 9496,   -9, 9098, 1408, 9496,
+ /*   810 */    -9, 18876, 1409, 9496,   -9, 9496,   -9, 5841,   -9, 9098,
+ /*   820 */  1411, 9496,   -9, 9098, 1413, 9496,   -9, 9496, 1418, 9496,
+ /*   830 */    -9,   -9, 9496,   -9, 1423,   -9, 1425, 5165, 1426,   -9,
+ /*   840 */  1427, 1428, 5165, 1429,   -9,  607, 1431, 5165, 1432,   -9,
+ /*   850 */   739, 1465, 5165, 1535,   -9, 18876, 1512,   -9, 1430, 1538,
+ /*   860 */  5165, 1539,   -9, 1433, 1541, 5165, 1542,   -9,   -9,   -9,
+ /*   870 */  1547,   -9, 1548,   -9, 1549,   -9, 1551,   -9, 1553,   -9,
+ /*   880 */  5874, 1540, 1555, 5165, 1556,   -9, 1559, 1560, 5165, 1558,
+ /*   890 */    -9,  740, 1561, 5165, 1562,   -9,  741, 1564, 5165, 1565,
+ /*   900 */    -9, 1563, 1598, 5165, 1668,   -9, 1566, 1670, 5165, 1671,
+ /*   910 */    -9, 4991,  629, 1667, 4266, 1656, 7793, 1677, 1678, 5165,
+ /*   920 */  1676,   -9,  742, 1679, 5165, 1680,   -9,  743, 1683, 5165,
+ /*   930 */  1687,   -9, 1691, 1692, 5165, 1690,   -9, 1694, 1695, 5165,
+ /*   940 */  1693,   -9, 4266,   -9,  349,  484,  632, 1551,   -9, 1700,
+ /*   950 */  1709,  637, 1709,  748, 1709, 1701, 1709, 1702, 1709,  495,
+ /*   960 */  5399,  758, 5399,  744, 1802, 5165, 1803,   -9, 5399,   -9,
+ /*   970 */    -9,   -9, 5399,   -9,   -9, 5399,   -9,   -9, 1804,  753,
+ /*   980 */  4392, 1806,   -9, 1809,   -9,   -9,   -9,   -9,   -9,   -9,
+ /*   990 */    -9,   -9,  225, 1810, 5165, 1808,   -9,   -9,
+};
+#define YY_REDUCE_USE_DFLT (-121)
+static short yy_reduce_ofst[] = {
+ /*     0 */  -120, -121, -121,   13,  146, -121, -121, -121, -121, -121,
+ /*    10 */  -121, -121, -121, -121, -121, 6861, -121, -121, -121, -121,
+ /*    20 */  -121, -121, 18520, -121, 18577, -121, -121, 8095, -121, 8316,
+ /*    30 */  -121, 9176, -121, 5234, -121, 18913, -121, 18929, -121, 7401,
+ /*    40 */  -121, 7649, -121, 7470, -121, 12351, -121, -121, 12572, -121,
+ /*    50 */  12793, -121, 13014, -121, 13235, -121, 13456, -121, 13677, -121,
+ /*    60 */  -121, 7605, -121, -121, -121, -121, -121, -121, 9704, -121,
+ /*    70 */  -121, 9375, -121, 18801, -121, -121, -121, -121, 18972, -121,
+ /*    80 */  8690, -121, 13898, -121, -121, 9753, -121, 18844, -121, -121,
+ /*    90 */  18987, -121, 14119, -121, -121, -121, -121, -121, 9803, -121,
+ /*   100 */  -121, 14340, -121, -121, -121, -121, -121, -121, -121, 9852,
+ /*   110 */  -121, -121, 9902, -121, 5310, -121, -121, -121, -121, -121,
+ /*   120 */  9951, -121, -121, 10001, -121, -121, -121, -121, 5389, -121,
+ /*   130 */  -121, -121, 5435, -121, -121, -121, -121, 5677, -121, -121,
+ /*   140 */  -121, -121, -121, 5756, -121, -121, -121, -121, 5805, -121,
+ /*   150 */  -121, 5877, -121, -121, -121, -121, -121, -121, -121, -121,
+ /*   160 */  -121, -121, -121, -121, 14561, -121, 14782, -121, 15003, -121,
+ /*   170 */  -121, -121, 19030, -121, 19045, -121, 18860, -121, -121, -121,
+ /*   180 */  18701, -121, 18786, -121, -121, -121, 7161, -121, -121, -121,
+ /*   190 */  -121, -121, -121, -121, -121, -121, -121, -121, -121, -121,
+ /*   200 */  -121, -121, -121, -121, -121, -121, -121, -121,  737, -121,
+ /*   210 */  -121, -121, -121, -121, -121, -121, -121, -121, -121, -121,
+ /*   220 */  -121, -121, -121, -121, -121, -121, -121, -121, -121, -121,
+ /*   230 */  -121, -121, -121, -121, -121, -121, -121, -121, -121, -121,
+ /*   240 */  -121, -121, -121, -121, -121, -121, -121, -121, -121, -121,
+ /*   250 */  -121, -121, -121, -121, -121, -121, -121, -121, -121, -121,
+ /*   260 */  -121, -121, -121, -121,   20, -121, -121,  279, -121, -121,
+ /*   270 */  -121, -121,  147, -121, -121,  412, -121, -121, -121,  545,
+ /*   280 */  -121, -121, -121,  678, -121, -121, -121,  811, -121, -121,
+ /*   290 */  -121, 10073, -121, -121,  944, -121, -121, -121, 1077, -121,
+ /*   300 */  -121, -121, 10172, -121, -121, -121, 4135, -121,  699, -121,
+ /*   310 */  7115, -121, -121, 1210, -121, -121,  153, -121, -121, -121,
+ /*   320 */  10222, -121, -121, 1343, -121, -121, 10272, -121, -121, 1476,
+ /*   330 */  -121, -121, 10321, -121,  826, -121, 7056, -121, -121, -121,
+ /*   340 */  -121, -121,  930, -121, 10393, -121,  933, -121, 10493, -121,
+ /*   350 */   934, -121, 10542, -121,  937, -121, 10592, -121,  939, -121,
+ /*   360 */  10641, -121,  943, -121, 7100, -121, -121, -121, -121, -121,
+ /*   370 */  7221, -121, -121, -121, -121, 10836, -121, 10880, -121, 10938,
+ /*   380 */  -121, 11001, -121, 11059, -121, 11102, -121, 11159, -121, 11223,
+ /*   390 */  -121, 11280, -121, 11323, -121, 11380, -121, 11444, -121, 11501,
+ /*   400 */  -121, 11544, -121, 11601, -121, 11665, -121, 11722, -121, 11765,
+ /*   410 */  -121, 11822, -121, 11886, -121, 11943, -121, -121, 7264, -121,
+ /*   420 */  -121, -121, -121, 12045, -121, 12107, -121, 12166, -121, 12241,
+ /*   430 */  -121, 12287, -121, 12387, -121, 12462, -121, 12508, -121, 12608,
+ /*   440 */  -121, 12683, -121, 12729, -121, 12829, -121, 12904, -121, 12950,
+ /*   450 */  -121, 13050, -121, 13125, -121, 13171, -121, 13271, -121, 13346,
+ /*   460 */  -121, 13392, -121, 13492, -121, -121, 13567, -121, 13613, -121,
+ /*   470 */  13713, -121, 13788, -121, 13834, -121, 13934, -121, 14009, -121,
+ /*   480 */  14055, -121, 14155, -121, 14230, -121, 14276, -121, 14376, -121,
+ /*   490 */  14451, -121, 14497, -121, 14597, -121, 14672, -121, 14718, -121,
+ /*   500 */  14818, -121, 14893, -121, 14939, -121, 15039, -121, 15114, -121,
+ /*   510 */  -121, 15160, -121, -121, 15260, -121, -121, 7321, -121, -121,
+ /*   520 */  -121, -121, 15336, -121, 15481, -121, 15524, -121, 15581, -121,
+ /*   530 */  15624, -121, 15703, -121, 15746, -121, 15803, -121, 15846, -121,
+ /*   540 */  15925, -121, 15968, -121, 16025, -121, 16068, -121, 16147, -121,
+ /*   550 */  16190, -121, 16247, -121, 16290, -121, 16369, -121, 16412, -121,
+ /*   560 */  16469, -121, 16512, -121, -121, 7420, -121, -121, -121, -121,
+ /*   570 */  -121, -121, 7463, -121, -121, -121, -121, -121, 16707, -121,
+ /*   580 */  16751, -121, 16809, -121, 16872, -121, 16930, -121, 16973, -121,
+ /*   590 */  17030, -121, 17094, -121, 17151, -121, 17194, -121, 17251, -121,
+ /*   600 */  17315, -121, 17372, -121, 17415, -121, 17472, -121, 17536, -121,
+ /*   610 */  17593, -121, 17636, -121, 17693, -121, 17757, -121, 17814, -121,
+ /*   620 */  17857, -121, 4925, -121, -121, -121, 4007, -121, -121, -121,
+ /*   630 */  -121, -121, -121, -121, -121, -121, 7542, -121, -121, -121,
+ /*   640 */  -121, -121, -121, 7597, -121, -121, -121, 17914, -121, -121,
+ /*   650 */  -121, 5042, -121, 5162, -121, -121, -121, -121, -121, -121,
+ /*   660 */  7641, -121, 5159, -121, 7698, -121, 5356, -121, 17978, -121,
+ /*   670 */  5371, -121, 5278, -121, 7775, -121, 18035, -121, -121, 7819,
+ /*   680 */  -121, 5884, -121, 7919, -121, -121, -121, -121, -121, -121,
+ /*   690 */  -121, -121, -121, 6935, -121, -121, 7996, -121, 18078, -121,
+ /*   700 */  -121, 9030, -121, -121, 8040, -121, 9252, -121, 8140, -121,
+ /*   710 */  8540, -121, -121, 8217, -121, 18135, -121, 9612, -121, 8261,
+ /*   720 */  -121, 8740, -121, -121, 8361, -121, 8762, -121, -121, 8440,
+ /*   730 */  -121, 10714, -121, 8483, -121, 18199, -121, -121, 8582, -121,
+ /*   740 */  11987, -121, 8639, -121, 8562, -121, -121, 8682, -121, 18256,
+ /*   750 */  -121, -121, 12293, -121, -121, 8803, -121, 12514, -121, 8851,
+ /*   760 */  -121, 9654, -121, -121, 8903, -121, 18299, -121, 12735, -121,
+ /*   770 */  9024, -121, 10123, -121, -121, 9072, -121, 10443, -121, -121,
+ /*   780 */  9124, -121, 5927, 9245, 5977, -121, -121, -121, -121, -121,
+ /*   790 */  -121, 9298, 6026, -121, 6098, -121, 18356, -121, -121, 6148,
+ /*   800 */  -121, 6198, -121, 9432, -121, 6247, -121, 9482, -121, 6319,
+ /*   810 */  -121, 18420, -121, 6369, -121, 6419, -121, 6468, -121, 9532,
+ /*   820 */  -121, 6540, -121, 9605, -121, 6590, -121, 6640, -121, 6689,
+ /*   830 */  -121, -121, 6761, -121, -121, -121, -121, 1609, -121, -121,
+ /*   840 */  -121, -121, 1742, -121, -121, -121, -121, 1875, -121, -121,
+ /*   850 */  -121, -121, 2008, -121, -121, 18477, -121, -121, -121, -121,
+ /*   860 */  2141, -121, -121, -121, -121, 2274, -121, -121, -121, -121,
+ /*   870 */  -121, -121, -121, -121, -121, -121, -121, -121, -121, -121,
+ /*   880 */  8487, -121, -121, 2407, -121, -121, -121, -121, 2540, -121,
+ /*   890 */  -121, -121, -121, 2673, -121, -121, -121, -121, 2806, -121,
+ /*   900 */  -121, -121, -121, 2939, -121, -121, -121, -121, 3072, -121,
+ /*   910 */  -121, 6811, -121, -121, 1477, -121, 8498, -121, -121, 3205,
+ /*   920 */  -121, -121, -121, -121, 3338, -121, -121, -121, -121, 3471,
+ /*   930 */  -121, -121, -121, -121, 3604, -121, -121, -121, -121, 3737,
+ /*   940 */  -121, -121, 1499, -121, -121, -121, -121, -121, -121,  930,
+ /*   950 */  -121,  933, -121,  934, -121,  939, -121,  937, -121, -121,
+ /*   960 */  4267, -121, 4399, -121, -121, 3870, -121, -121, 4531, -121,
+ /*   970 */  -121, -121, 4663, -121, -121, 4795, -121, -121, -121, -121,
+ /*   980 */   173, -121, -121, -121, -121, -121, -121, -121, -121, -121,
+ /*   990 */  -121, -121, 1613, -121, 4003, -121, -121, -121,
+};
+static YYACTIONTYPE yy_default[] = {
+ /*     0 */  1003, 1515,  999, 1003, 1000, 1002, 1004, 1005, 1006, 1007,
+ /*    10 */  1008, 1009, 1010, 1011, 1012, 1017, 1013, 1014, 1015, 1016,
+ /*    20 */  1411, 1413, 1515, 1515, 1515, 1412, 1414, 1515, 1417, 1515,
+ /*    30 */  1419, 1515, 1421, 1515, 1426, 1515, 1431, 1515, 1433, 1515,
+ /*    40 */  1435, 1515, 1437, 1515, 1440, 1515, 1446, 1453, 1515, 1454,
+ /*    50 */  1515, 1455, 1515, 1456, 1515, 1457, 1515, 1458, 1515, 1459,
+ /*    60 */  1460, 1515, 1461, 1462, 1463, 1464, 1465, 1515, 1515, 1416,
+ /*    70 */  1418, 1515, 1422, 1515, 1427, 1430, 1432, 1434, 1515, 1438,
+ /*    80 */  1515, 1441, 1515, 1447, 1467, 1515, 1420, 1515, 1428, 1436,
+ /*    90 */  1515, 1442, 1515, 1448, 1468, 1470, 1471, 1515, 1515, 1425,
+ /*   100 */  1439, 1515, 1449, 1475, 1476, 1477, 1478, 1479, 1480, 1515,
+ /*   110 */  1445, 1481, 1515, 1482, 1515, 1485, 1486, 1487, 1488, 1515,
+ /*   120 */  1515, 1515, 1489, 1515, 1515, 1490, 1491, 1515, 1515, 1515,
+ /*   130 */  1493, 1515, 1515, 1515, 1494, 1515, 1515, 1515, 1515, 1500,
+ /*   140 */  1501, 1502, 1503, 1515, 1504, 1515, 1505, 1515, 1515, 1515,
+ /*   150 */  1515, 1515, 1509, 1511, 1512, 1513, 1514, 1515, 1515, 1492,
+ /*   160 */  1515, 1484, 1515, 1483, 1515, 1450, 1515, 1451, 1515, 1452,
+ /*   170 */  1515, 1472, 1515, 1443, 1515, 1444, 1515, 1429, 1515, 1469,
+ /*   180 */  1515, 1423, 1515, 1424, 1515, 1466, 1515, 1415, 1018, 1019,
+ /*   190 */  1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029,
+ /*   200 */  1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1515, 1038,
+ /*   210 */  1515, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047,
+ /*   220 */  1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057,
+ /*   230 */  1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067,
+ /*   240 */  1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077,
+ /*   250 */  1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+ /*   260 */  1088, 1089, 1515, 1515, 1515, 1515, 1515, 1003, 1515, 1090,
+ /*   270 */  1515, 1515, 1515, 1515, 1515, 1003, 1515, 1092, 1515, 1003,
+ /*   280 */  1515, 1107, 1515, 1003, 1515, 1108, 1151, 1003, 1515, 1109,
+ /*   290 */  1515, 1515, 1515, 1515, 1003, 1515, 1110, 1515, 1003, 1515,
+ /*   300 */  1515, 1515, 1515, 1515, 1111, 1515, 1003, 1515, 1515, 1515,
+ /*   310 */  1515, 1515, 1515, 1003, 1515, 1112, 1144, 1145, 1147, 1515,
+ /*   320 */  1515, 1515, 1515, 1003, 1146, 1515, 1515, 1515, 1515, 1003,
+ /*   330 */  1515, 1148, 1515, 1152, 1515, 1515, 1515, 1153, 1154, 1155,
+ /*   340 */  1156, 1482, 1515, 1515, 1515, 1157, 1515, 1515, 1515, 1158,
+ /*   350 */  1515, 1515, 1515, 1159, 1515, 1515, 1515, 1160, 1485, 1515,
+ /*   360 */  1515, 1161, 1515, 1515, 1515, 1162, 1163, 1164, 1165, 1480,
+ /*   370 */  1515, 1166, 1168, 1170, 1172, 1515, 1232, 1515, 1233, 1515,
+ /*   380 */  1234, 1515, 1235, 1515, 1236, 1515, 1237, 1515, 1238, 1515,
+ /*   390 */  1239, 1515, 1240, 1515, 1241, 1515, 1242, 1515, 1243, 1515,
+ /*   400 */  1244, 1515, 1245, 1515, 1246, 1515, 1247, 1515, 1248, 1515,
+ /*   410 */  1249, 1515, 1250, 1515, 1251, 1515, 1252, 1481, 1515, 1167,
+ /*   420 */  1169, 1171, 1173, 1515, 1253, 1515, 1254, 1515, 1255, 1515,
+ /*   430 */  1256, 1515, 1257, 1515, 1258, 1515, 1259, 1515, 1260, 1515,
+ /*   440 */  1261, 1515, 1262, 1515, 1263, 1515, 1264, 1515, 1265, 1515,
+ /*   450 */  1266, 1515, 1267, 1515, 1268, 1515, 1269, 1515, 1270, 1515,
+ /*   460 */  1271, 1515, 1272, 1515, 1273, 1462, 1515, 1174, 1515, 1190,
+ /*   470 */  1515, 1191, 1515, 1192, 1515, 1193, 1515, 1194, 1515, 1195,
+ /*   480 */  1515, 1196, 1515, 1197, 1515, 1198, 1515, 1199, 1515, 1200,
+ /*   490 */  1515, 1201, 1515, 1202, 1515, 1203, 1515, 1204, 1515, 1205,
+ /*   500 */  1515, 1206, 1515, 1207, 1515, 1208, 1515, 1209, 1515, 1210,
+ /*   510 */  1515, 1515, 1515, 1466, 1515, 1175, 1467, 1515, 1176, 1177,
+ /*   520 */  1178, 1184, 1515, 1211, 1515, 1212, 1515, 1213, 1515, 1214,
+ /*   530 */  1515, 1215, 1515, 1216, 1515, 1217, 1515, 1218, 1515, 1219,
+ /*   540 */  1515, 1220, 1515, 1221, 1515, 1222, 1515, 1223, 1515, 1224,
+ /*   550 */  1515, 1225, 1515, 1226, 1515, 1227, 1515, 1228, 1515, 1229,
+ /*   560 */  1515, 1230, 1515, 1231, 1515, 1515, 1179, 1180, 1181, 1182,
+ /*   570 */  1491, 1515, 1515, 1185, 1186, 1187, 1188, 1488, 1515, 1189,
+ /*   580 */  1515, 1274, 1515, 1275, 1515, 1276, 1515, 1277, 1515, 1278,
+ /*   590 */  1515, 1279, 1515, 1280, 1515, 1281, 1515, 1282, 1515, 1283,
+ /*   600 */  1515, 1284, 1515, 1285, 1515, 1286, 1515, 1287, 1515, 1288,
+ /*   610 */  1515, 1289, 1515, 1290, 1515, 1291, 1515, 1292, 1515, 1293,
+ /*   620 */  1515, 1294, 1298, 1295, 1296, 1297, 1515, 1305, 1306, 1299,
+ /*   630 */  1300, 1301, 1302, 1303, 1304, 1515, 1515, 1515, 1515, 1307,
+ /*   640 */  1408, 1409, 1410, 1515, 1515, 1515, 1308, 1515, 1515, 1515,
+ /*   650 */  1309, 1311, 1310, 1515, 1315, 1316, 1317, 1312, 1313, 1314,
+ /*   660 */  1515, 1515, 1311, 1318, 1515, 1515, 1311, 1319, 1515, 1515,
+ /*   670 */  1311, 1320, 1515, 1321, 1515, 1322, 1515, 1330, 1329, 1515,
+ /*   680 */  1515, 1515, 1323, 1515, 1324, 1339, 1340, 1341, 1342, 1343,
+ /*   690 */  1344, 1345, 1346, 1515, 1515, 1351, 1515, 1352, 1515, 1360,
+ /*   700 */  1359, 1515, 1358, 1357, 1515, 1515, 1515, 1325, 1515, 1326,
+ /*   710 */  1515, 1515, 1353, 1515, 1354, 1515, 1515, 1515, 1327, 1515,
+ /*   720 */  1328, 1515, 1515, 1355, 1515, 1356, 1515, 1515, 1349, 1515,
+ /*   730 */  1350, 1515, 1331, 1515, 1332, 1515, 1348, 1347, 1515, 1515,
+ /*   740 */  1515, 1333, 1515, 1334, 1515, 1515, 1363, 1515, 1364, 1515,
+ /*   750 */  1372, 1371, 1515, 1370, 1369, 1515, 1515, 1515, 1335, 1515,
+ /*   760 */  1336, 1515, 1515, 1365, 1515, 1366, 1515, 1515, 1515, 1337,
+ /*   770 */  1515, 1338, 1515, 1515, 1367, 1515, 1368, 1515, 1515, 1361,
+ /*   780 */  1515, 1362, 1373, 1515, 1375, 1380, 1383, 1384, 1385, 1386,
+ /*   790 */  1387, 1515, 1376, 1381, 1515, 1387, 1515, 1382, 1378, 1374,
+ /*   800 */  1379, 1393, 1388, 1515, 1395, 1515, 1390, 1515, 1396, 1515,
+ /*   810 */  1391, 1515, 1397, 1515, 1392, 1394, 1389, 1403, 1398, 1515,
+ /*   820 */  1405, 1515, 1400, 1515, 1406, 1515, 1401, 1515, 1387, 1515,
+ /*   830 */  1402, 1407, 1404, 1399, 1515, 1149, 1515, 1003, 1515, 1150,
+ /*   840 */  1515, 1515, 1003, 1515, 1114, 1515, 1515, 1003, 1515, 1117,
+ /*   850 */  1515, 1515, 1003, 1515, 1128, 1515, 1515, 1474, 1515, 1515,
+ /*   860 */  1003, 1515, 1131, 1515, 1515, 1003, 1515, 1134, 1473, 1119,
+ /*   870 */  1515, 1120, 1515, 1121, 1515, 1122, 1515, 1123, 1515, 1124,
+ /*   880 */  1515, 1515, 1515, 1003, 1515, 1113, 1515, 1515, 1003, 1515,
+ /*   890 */  1116, 1515, 1515, 1003, 1515, 1127, 1515, 1515, 1003, 1515,
+ /*   900 */  1130, 1515, 1515, 1003, 1515, 1133, 1515, 1515, 1003, 1515,
+ /*   910 */  1136, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1003,
+ /*   920 */  1515, 1115, 1515, 1515, 1003, 1515, 1118, 1515, 1515, 1003,
+ /*   930 */  1515, 1129, 1515, 1515, 1003, 1515, 1132, 1515, 1515, 1003,
+ /*   940 */  1515, 1135, 1515, 1126, 1482, 1515, 1515, 1485, 1125, 1515,
+ /*   950 */  1120, 1515, 1121, 1515, 1122, 1485, 1123, 1515, 1124, 1515,
+ /*   960 */  1003, 1515, 1003, 1515, 1515, 1003, 1515, 1137, 1003, 1143,
+ /*   970 */  1151, 1142, 1003, 1141, 1140, 1003, 1139, 1138, 1515, 1515,
+ /*   980 */  1515, 1515, 1098, 1515, 1099, 1100, 1101, 1102, 1103, 1104,
+ /*   990 */  1105, 1106, 1515, 1515, 1003, 1515, 1091, 1001,
+};
+#define YY_SZ_ACTTAB (sizeof(yy_action)/sizeof(yy_action[0]))
+
+/* The next table maps tokens into fallback tokens.  If a construct
+** like the following:
+**
+**      %fallback ID X Y Z.
+**
+** appears in the grammar, then ID becomes a fallback token for X, Y,
+** and Z.  Whenever one of the tokens X, Y, or Z is input to the parser
+** but it does not parse, the type of the token is changed to ID and
+** the parse is retried before an error is thrown.
+*/
+#ifdef YYFALLBACK
+static const YYCODETYPE yyFallback[] = {
+};
+#endif /* YYFALLBACK */
+
+/* The following structure represents a single element of the
+** parser's stack.  Information stored includes:
+**
+**   +  The state number for the parser at this level of the stack.
+**
+**   +  The value of the token stored at this level of the stack.
+**      (In other words, the "major" token.)
+**
+**   +  The semantic value stored at this level of the stack.  This is
+**      the information used by the action routines in the grammar.
+**      It is sometimes called the "minor" token.
+*/
+struct yyStackEntry {
+	int stateno;       /* The state-number */
+	int major;         /* The major token value.  This is the code
+										 ** number for the token at this stack level */
+	YYMINORTYPE minor; /* The user-supplied minor token value.  This
+										 ** is the value of the token  */
+};
+typedef struct yyStackEntry yyStackEntry;
+
+/* The state of the parser is completely contained in an instance of
+** the following structure. */
+struct _lemon_parser_t {
+	int yyidx;                    /* Index of top element in stack */
+	int yyerrcnt;                 /* Shifts left before out of the error */
+	ParseARG_SDECL                /* A place to hold %extra_argument */
+	yyStackEntry yystack[YYSTACKDEPTH];  /* The parser's stack */
+};
+typedef struct _lemon_parser_t lemon_parser_t;
+
+#ifndef NDEBUG
+#include <stdio.h>
+static FILE *yyTraceFILE   = 0;
+static char *yyTracePrompt = 0;
+#endif /* NDEBUG */
+
+#ifndef NDEBUG
+/*
+** Turn parser tracing on by giving a stream to which to write the trace
+** and a prompt to preface each trace message.  Tracing is turned off
+** by making either argument NULL
+**
+** Inputs:
+** <ul>
+** <li> A FILE* to which trace output should be written.
+**      If NULL, then tracing is turned off.
+** <li> A prefix string written at the beginning of every
+**      line of trace output.  If NULL, then tracing is
+**      turned off.
+** </ul>
+**
+** Outputs:
+** None.
+*/
+void mlr_dsl_ParseTrace(FILE *TraceFILE, char *zTracePrompt) {
+	yyTraceFILE = TraceFILE;
+	yyTracePrompt = zTracePrompt;
+	if (yyTraceFILE==0)
+		yyTracePrompt = 0;
+	else if (yyTracePrompt==0)
+		yyTraceFILE = 0;
+}
+#endif /* NDEBUG */
+
+#ifndef NDEBUG
+/* For tracing shifts, the names of all terminals and nonterminals
+** are required.  The following table supplies these names */
+static const char *yyTokenName[] = {
+  "$",             "MD_TOKEN_SEMICOLON",  "MD_TOKEN_RETURN",  "MD_TOKEN_FULL_SREC",
+  "MD_TOKEN_FULL_OOSVAR",  "MD_TOKEN_SUBR_CALL",  "MD_TOKEN_BREAK",  "MD_TOKEN_CONTINUE",
+  "MD_TOKEN_FUNC_DEF",  "MD_TOKEN_NON_SIGIL_NAME",  "MD_TOKEN_LPAREN",  "MD_TOKEN_RPAREN",
+  "MD_TOKEN_LBRACE",  "MD_TOKEN_RBRACE",  "MD_TOKEN_COLON",  "MD_TOKEN_SUBR_DEF",
+  "MD_TOKEN_COMMA",  "MD_TOKEN_VAR",  "MD_TOKEN_NUMERIC",  "MD_TOKEN_INT",
+  "MD_TOKEN_FLOAT",  "MD_TOKEN_STRING",  "MD_TOKEN_BOOLEAN",  "MD_TOKEN_MAP",
+  "MD_TOKEN_BEGIN",  "MD_TOKEN_END",  "MD_TOKEN_WHILE",  "MD_TOKEN_DO", 
+  "MD_TOKEN_FOR",  "MD_TOKEN_IN",   "MD_TOKEN_IF",   "MD_TOKEN_ELIF",
+  "MD_TOKEN_ELSE",  "MD_TOKEN_FILTER",  "MD_TOKEN_ASSIGN",  "MD_TOKEN_DOLLAR_SIGN",
+  "MD_TOKEN_LEFT_BRACKET",  "MD_TOKEN_RIGHT_BRACKET",  "MD_TOKEN_LOGICAL_OR_EQUALS",  "MD_TOKEN_LOGICAL_XOR_EQUALS",
+  "MD_TOKEN_LOGICAL_AND_EQUALS",  "MD_TOKEN_BITWISE_OR_EQUALS",  "MD_TOKEN_BITWISE_XOR_EQUALS",  "MD_TOKEN_BITWISE_AND_EQUALS",
+  "MD_TOKEN_BITWISE_LSH_EQUALS",  "MD_TOKEN_BITWISE_RSH_EQUALS",  "MD_TOKEN_PLUS_EQUALS",  "MD_TOKEN_MINUS_EQUALS",
+  "MD_TOKEN_DOT_EQUALS",  "MD_TOKEN_TIMES_EQUALS",  "MD_TOKEN_DIVIDE_EQUALS",  "MD_TOKEN_INT_DIVIDE_EQUALS",
+  "MD_TOKEN_OPLUS_EQUALS",  "MD_TOKEN_OMINUS_EQUALS",  "MD_TOKEN_OTIMES_EQUALS",  "MD_TOKEN_ODIVIDE_EQUALS",
+  "MD_TOKEN_INT_ODIVIDE_EQUALS",  "MD_TOKEN_MOD_EQUALS",  "MD_TOKEN_POW_EQUALS",  "MD_TOKEN_OINT_DIVIDE_EQUALS",
+  "MD_TOKEN_OMOD_EQUALS",  "MD_TOKEN_OPOW_EQUALS",  "MD_TOKEN_UNSET",  "MD_TOKEN_ALL",
+  "MD_TOKEN_TEE",  "MD_TOKEN_GT",   "MD_TOKEN_BITWISE_RSH",  "MD_TOKEN_BITWISE_OR",
+  "MD_TOKEN_EMITF",  "MD_TOKEN_EMITP",  "MD_TOKEN_EMIT",  "MD_TOKEN_DUMP",
+  "MD_TOKEN_EDUMP",  "MD_TOKEN_PRINT",  "MD_TOKEN_EPRINT",  "MD_TOKEN_PRINTN",
+  "MD_TOKEN_EPRINTN",  "MD_TOKEN_STDOUT",  "MD_TOKEN_STDERR",  "MD_TOKEN_QUESTION_MARK",
+  "MD_TOKEN_LOGICAL_OR",  "MD_TOKEN_LOGICAL_XOR",  "MD_TOKEN_LOGICAL_AND",  "MD_TOKEN_MATCHES",
+  "MD_TOKEN_DOES_NOT_MATCH",  "MD_TOKEN_EQ",   "MD_TOKEN_NE",   "MD_TOKEN_GE", 
+  "MD_TOKEN_LT",   "MD_TOKEN_LE",   "MD_TOKEN_BITWISE_XOR",  "MD_TOKEN_BITWISE_AND",
+  "MD_TOKEN_BITWISE_LSH",  "MD_TOKEN_PLUS",  "MD_TOKEN_MINUS",  "MD_TOKEN_OPLUS",
+  "MD_TOKEN_OMINUS",  "MD_TOKEN_DOT",  "MD_TOKEN_TIMES",  "MD_TOKEN_DIVIDE",
+  "MD_TOKEN_INT_DIVIDE",  "MD_TOKEN_MOD",  "MD_TOKEN_OTIMES",  "MD_TOKEN_ODIVIDE",
+  "MD_TOKEN_INT_ODIVIDE",  "MD_TOKEN_LOGICAL_NOT",  "MD_TOKEN_BITWISE_NOT",  "MD_TOKEN_POW",
+  "MD_TOKEN_FIELD_NAME",  "MD_TOKEN_BRACED_FIELD_NAME",  "MD_TOKEN_UNBRACED_OOSVAR_NAME",  "MD_TOKEN_BRACED_OOSVAR_NAME",
+  "MD_TOKEN_AT_SIGN",  "MD_TOKEN_NUMBER",  "MD_TOKEN_TRUE",  "MD_TOKEN_FALSE",
+  "MD_TOKEN_REGEXI",  "MD_TOKEN_CONTEXT_VARIABLE",  "MD_TOKEN_ENV",  "error",       
+  "md_body",       "md_statement_block",  "md_statement_not_braced_end",  "md_statement_braced_end",
+  "md_untyped_local_definition",  "md_numeric_local_definition",  "md_int_local_definition",  "md_float_local_definition",
+  "md_boolean_local_definition",  "md_string_local_definition",  "md_map_local_definition",  "md_nonindexed_local_assignment",
+  "md_indexed_local_assignment",  "md_rhs",        "md_map_literal",  "md_func_block",
+  "md_subr_block",  "md_begin_block",  "md_end_block",  "md_cond_block",
+  "md_while_block",  "md_for_loop_full_srec",  "md_for_loop_full_srec_key_only",  "md_for_loop_full_oosvar",
+  "md_for_loop_full_oosvar_key_only",  "md_for_loop_oosvar",  "md_for_loop_oosvar_key_only",  "md_for_loop_local_map",
+  "md_for_loop_local_map_key_only",  "md_for_loop_map_literal",  "md_for_loop_map_literal_key_only",  "md_for_loop_func_retval",
+  "md_for_loop_func_retval_key_only",  "md_triple_for",  "md_if_chain",   "md_fcn_or_subr_call",
+  "md_srec_assignment",  "md_srec_indirect_assignment",  "md_oosvar_from_full_srec_assignment",  "md_full_srec_assignment",
+  "md_env_assignment",  "md_do_while_block",  "md_bare_boolean",  "md_oosvar_assignment",
+  "md_full_oosvar_assignment",  "md_filter",     "md_unset",      "md_tee_write",
+  "md_tee_append",  "md_tee_pipe",   "md_emitf",      "md_emitf_write",
+  "md_emitf_append",  "md_emitf_pipe",  "md_emitp",      "md_emitp_write",
+  "md_emitp_append",  "md_emitp_pipe",  "md_emit",       "md_emit_write",
+  "md_emit_append",  "md_emit_pipe",  "md_emitp_lashed",  "md_emitp_lashed_write",
+  "md_emitp_lashed_append",  "md_emitp_lashed_pipe",  "md_emit_lashed",  "md_emit_lashed_write",
+  "md_emit_lashed_append",  "md_emit_lashed_pipe",  "md_dump",       "md_dump_write",
+  "md_dump_append",  "md_dump_pipe",  "md_edump",      "md_print",    
+  "md_eprint",     "md_print_write",  "md_print_append",  "md_print_pipe",
+  "md_printn",     "md_eprintn",    "md_printn_write",  "md_printn_append",
+  "md_printn_pipe",  "md_func_or_subr_parameter_list",  "md_typedecl",   "md_func_or_subr_non_empty_parameter_list",
+  "md_func_or_subr_parameter",  "md_for_loop_index",  "md_for_map_keylist",  "md_oosvar_keylist",
+  "md_local_map_keylist",  "md_triple_for_start",  "md_triple_for_continuation",  "md_triple_for_update",
+  "md_if_elif_star",  "md_else_block",  "md_if_block",   "md_elif_block",
+  "md_nonindexed_local_variable",  "md_indexed_local_variable",  "md_field_name",  "md_env_index",
+  "md_unset_args",  "md_indirect_field_name",  "md_output_file",  "md_emitf_args",
+  "md_emittable",  "md_emitp_namelist",  "md_emit_namelist",  "md_emitp_lashed_keylists",
+  "md_emitp_lashed_namelist",  "md_emit_lashed_keylists",  "md_emit_lashed_namelist",  "md_dumpable", 
+  "md_ternary",    "md_logical_or_term",  "md_logical_xor_term",  "md_logical_and_term",
+  "md_eqne_term",  "md_cmp_term",   "md_bitwise_or_term",  "md_bitwise_xor_term",
+  "md_bitwise_and_term",  "md_bitwise_shift_term",  "md_addsubdot_term",  "md_muldiv_term",
+  "md_unary_bitwise_op_term",  "md_pow_term",   "md_atom_or_fcn",  "md_oosvar_basename",
+  "md_string",     "md_regexi",     "md_fcn_arg_list",  "md_fcn_non_empty_arg_list",
+  "md_fcn_arg",    "md_map_literal_kv_pairs",  "md_map_literal_kv_pair",  "md_map_literal_key",
+  "md_map_literal_value",
+};
+#endif /* NDEBUG */
+
+#ifndef NDEBUG
+/* For tracing reduce actions, the names of all rules are required.
+*/
+static const char *yyRuleName[] = {
+ /*   0 */ "md_body ::= md_statement_block",
+ /*   1 */ "md_statement_block ::= md_statement_not_braced_end",
+ /*   2 */ "md_statement_block ::= md_statement_braced_end",
+ /*   3 */ "md_statement_block ::= md_statement_not_braced_end MD_TOKEN_SEMICOLON md_statement_block",
+ /*   4 */ "md_statement_block ::= md_statement_braced_end md_statement_block",
+ /*   5 */ "md_statement_not_braced_end ::=",
+ /*   6 */ "md_statement_not_braced_end ::= md_untyped_local_definition",
+ /*   7 */ "md_statement_not_braced_end ::= md_numeric_local_definition",
+ /*   8 */ "md_statement_not_braced_end ::= md_int_local_definition",
+ /*   9 */ "md_statement_not_braced_end ::= md_float_local_definition",
+ /*  10 */ "md_statement_not_braced_end ::= md_boolean_local_definition",
+ /*  11 */ "md_statement_not_braced_end ::= md_string_local_definition",
+ /*  12 */ "md_statement_not_braced_end ::= md_map_local_definition",
+ /*  13 */ "md_statement_not_braced_end ::= md_nonindexed_local_assignment",
+ /*  14 */ "md_statement_not_braced_end ::= md_indexed_local_assignment",
+ /*  15 */ "md_statement_not_braced_end ::= MD_TOKEN_RETURN md_rhs",
+ /*  16 */ "md_statement_not_braced_end ::= MD_TOKEN_RETURN md_map_literal",
+ /*  17 */ "md_statement_not_braced_end ::= MD_TOKEN_RETURN MD_TOKEN_FULL_SREC",
+ /*  18 */ "md_statement_not_braced_end ::= MD_TOKEN_RETURN MD_TOKEN_FULL_OOSVAR",
+ /*  19 */ "md_statement_not_braced_end ::= MD_TOKEN_RETURN",
+ /*  20 */ "md_statement_braced_end ::= md_func_block",
+ /*  21 */ "md_statement_braced_end ::= md_subr_block",
+ /*  22 */ "md_statement_braced_end ::= md_begin_block",
+ /*  23 */ "md_statement_braced_end ::= md_end_block",
+ /*  24 */ "md_statement_braced_end ::= md_cond_block",
+ /*  25 */ "md_statement_braced_end ::= md_while_block",
+ /*  26 */ "md_statement_braced_end ::= md_for_loop_full_srec",
+ /*  27 */ "md_statement_braced_end ::= md_for_loop_full_srec_key_only",
+ /*  28 */ "md_statement_braced_end ::= md_for_loop_full_oosvar",
+ /*  29 */ "md_statement_braced_end ::= md_for_loop_full_oosvar_key_only",
+ /*  30 */ "md_statement_braced_end ::= md_for_loop_oosvar",
+ /*  31 */ "md_statement_braced_end ::= md_for_loop_oosvar_key_only",
+ /*  32 */ "md_statement_braced_end ::= md_for_loop_local_map",
+ /*  33 */ "md_statement_braced_end ::= md_for_loop_local_map_key_only",
+ /*  34 */ "md_statement_braced_end ::= md_for_loop_map_literal",
+ /*  35 */ "md_statement_braced_end ::= md_for_loop_map_literal_key_only",
+ /*  36 */ "md_statement_braced_end ::= md_for_loop_func_retval",
+ /*  37 */ "md_statement_braced_end ::= md_for_loop_func_retval_key_only",
+ /*  38 */ "md_statement_braced_end ::= md_triple_for",
+ /*  39 */ "md_statement_braced_end ::= md_if_chain",
+ /*  40 */ "md_statement_not_braced_end ::= MD_TOKEN_SUBR_CALL md_fcn_or_subr_call",
+ /*  41 */ "md_statement_not_braced_end ::= md_srec_assignment",
+ /*  42 */ "md_statement_not_braced_end ::= md_srec_indirect_assignment",
+ /*  43 */ "md_statement_not_braced_end ::= md_oosvar_from_full_srec_assignment",
+ /*  44 */ "md_statement_not_braced_end ::= md_full_srec_assignment",
+ /*  45 */ "md_statement_not_braced_end ::= md_env_assignment",
+ /*  46 */ "md_statement_not_braced_end ::= md_do_while_block",
+ /*  47 */ "md_statement_not_braced_end ::= md_bare_boolean",
+ /*  48 */ "md_statement_not_braced_end ::= md_oosvar_assignment",
+ /*  49 */ "md_statement_not_braced_end ::= md_full_oosvar_assignment",
+ /*  50 */ "md_statement_not_braced_end ::= md_filter",
+ /*  51 */ "md_statement_not_braced_end ::= md_unset",
+ /*  52 */ "md_statement_not_braced_end ::= md_tee_write",
+ /*  53 */ "md_statement_not_braced_end ::= md_tee_append",
+ /*  54 */ "md_statement_not_braced_end ::= md_tee_pipe",
+ /*  55 */ "md_statement_not_braced_end ::= md_emitf",
+ /*  56 */ "md_statement_not_braced_end ::= md_emitf_write",
+ /*  57 */ "md_statement_not_braced_end ::= md_emitf_append",
+ /*  58 */ "md_statement_not_braced_end ::= md_emitf_pipe",
+ /*  59 */ "md_statement_not_braced_end ::= md_emitp",
+ /*  60 */ "md_statement_not_braced_end ::= md_emitp_write",
+ /*  61 */ "md_statement_not_braced_end ::= md_emitp_append",
+ /*  62 */ "md_statement_not_braced_end ::= md_emitp_pipe",
+ /*  63 */ "md_statement_not_braced_end ::= md_emit",
+ /*  64 */ "md_statement_not_braced_end ::= md_emit_write",
+ /*  65 */ "md_statement_not_braced_end ::= md_emit_append",
+ /*  66 */ "md_statement_not_braced_end ::= md_emit_pipe",
+ /*  67 */ "md_statement_not_braced_end ::= md_emitp_lashed",
+ /*  68 */ "md_statement_not_braced_end ::= md_emitp_lashed_write",
+ /*  69 */ "md_statement_not_braced_end ::= md_emitp_lashed_append",
+ /*  70 */ "md_statement_not_braced_end ::= md_emitp_lashed_pipe",
+ /*  71 */ "md_statement_not_braced_end ::= md_emit_lashed",
+ /*  72 */ "md_statement_not_braced_end ::= md_emit_lashed_write",
+ /*  73 */ "md_statement_not_braced_end ::= md_emit_lashed_append",
+ /*  74 */ "md_statement_not_braced_end ::= md_emit_lashed_pipe",
+ /*  75 */ "md_statement_not_braced_end ::= md_dump",
+ /*  76 */ "md_statement_not_braced_end ::= md_dump_write",
+ /*  77 */ "md_statement_not_braced_end ::= md_dump_append",
+ /*  78 */ "md_statement_not_braced_end ::= md_dump_pipe",
+ /*  79 */ "md_statement_not_braced_end ::= md_edump",
+ /*  80 */ "md_statement_not_braced_end ::= md_print",
+ /*  81 */ "md_statement_not_braced_end ::= md_eprint",
+ /*  82 */ "md_statement_not_braced_end ::= md_print_write",
+ /*  83 */ "md_statement_not_braced_end ::= md_print_append",
+ /*  84 */ "md_statement_not_braced_end ::= md_print_pipe",
+ /*  85 */ "md_statement_not_braced_end ::= md_printn",
+ /*  86 */ "md_statement_not_braced_end ::= md_eprintn",
+ /*  87 */ "md_statement_not_braced_end ::= md_printn_write",
+ /*  88 */ "md_statement_not_braced_end ::= md_printn_append",
+ /*  89 */ "md_statement_not_braced_end ::= md_printn_pipe",
+ /*  90 */ "md_statement_not_braced_end ::= MD_TOKEN_BREAK",
+ /*  91 */ "md_statement_not_braced_end ::= MD_TOKEN_CONTINUE",
+ /*  92 */ "md_func_block ::= MD_TOKEN_FUNC_DEF MD_TOKEN_NON_SIGIL_NAME MD_TOKEN_LPAREN md_func_or_subr_parameter_list MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /*  93 */ "md_func_block ::= MD_TOKEN_FUNC_DEF MD_TOKEN_NON_SIGIL_NAME MD_TOKEN_LPAREN md_func_or_subr_parameter_list MD_TOKEN_RPAREN MD_TOKEN_COLON md_typedecl MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /*  94 */ "md_subr_block ::= MD_TOKEN_SUBR_DEF MD_TOKEN_NON_SIGIL_NAME MD_TOKEN_LPAREN md_func_or_subr_parameter_list MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /*  95 */ "md_func_or_subr_parameter_list ::=",
+ /*  96 */ "md_func_or_subr_parameter_list ::= md_func_or_subr_non_empty_parameter_list",
+ /*  97 */ "md_func_or_subr_non_empty_parameter_list ::= md_func_or_subr_parameter",
+ /*  98 */ "md_func_or_subr_non_empty_parameter_list ::= md_func_or_subr_parameter MD_TOKEN_COMMA",
+ /*  99 */ "md_func_or_subr_non_empty_parameter_list ::= md_func_or_subr_parameter MD_TOKEN_COMMA md_func_or_subr_non_empty_parameter_list",
+ /* 100 */ "md_func_or_subr_parameter ::= MD_TOKEN_NON_SIGIL_NAME",
+ /* 101 */ "md_func_or_subr_parameter ::= md_typedecl MD_TOKEN_NON_SIGIL_NAME",
+ /* 102 */ "md_typedecl ::= MD_TOKEN_VAR",
+ /* 103 */ "md_typedecl ::= MD_TOKEN_NUMERIC",
+ /* 104 */ "md_typedecl ::= MD_TOKEN_INT",
+ /* 105 */ "md_typedecl ::= MD_TOKEN_FLOAT",
+ /* 106 */ "md_typedecl ::= MD_TOKEN_STRING",
+ /* 107 */ "md_typedecl ::= MD_TOKEN_BOOLEAN",
+ /* 108 */ "md_typedecl ::= MD_TOKEN_MAP",
+ /* 109 */ "md_begin_block ::= MD_TOKEN_BEGIN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 110 */ "md_end_block ::= MD_TOKEN_END MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 111 */ "md_cond_block ::= md_rhs MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 112 */ "md_while_block ::= MD_TOKEN_WHILE MD_TOKEN_LPAREN md_rhs MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 113 */ "md_do_while_block ::= MD_TOKEN_DO MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE MD_TOKEN_WHILE MD_TOKEN_LPAREN md_rhs MD_TOKEN_RPAREN",
+ /* 114 */ "md_for_loop_full_srec ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_for_loop_index MD_TOKEN_COMMA md_for_loop_index MD_TOKEN_IN MD_TOKEN_FULL_SREC MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 115 */ "md_for_loop_full_srec_key_only ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_for_loop_index MD_TOKEN_IN MD_TOKEN_FULL_SREC MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 116 */ "md_for_loop_full_oosvar ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_for_loop_index MD_TOKEN_COMMA md_for_loop_index MD_TOKEN_IN MD_TOKEN_FULL_OOSVAR MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 117 */ "md_for_loop_full_oosvar ::= MD_TOKEN_FOR MD_TOKEN_LPAREN MD_TOKEN_LPAREN md_for_map_keylist MD_TOKEN_RPAREN MD_TOKEN_COMMA md_for_loop_index MD_TOKEN_IN MD_TOKEN_FULL_OOSVAR MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 118 */ "md_for_loop_full_oosvar_key_only ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_for_loop_index MD_TOKEN_IN MD_TOKEN_FULL_OOSVAR MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 119 */ "md_for_loop_oosvar ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_for_loop_index MD_TOKEN_COMMA md_for_loop_index MD_TOKEN_IN md_oosvar_keylist MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 120 */ "md_for_loop_oosvar ::= MD_TOKEN_FOR MD_TOKEN_LPAREN MD_TOKEN_LPAREN md_for_map_keylist MD_TOKEN_RPAREN MD_TOKEN_COMMA md_for_loop_index MD_TOKEN_IN md_oosvar_keylist MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 121 */ "md_for_loop_index ::= MD_TOKEN_NON_SIGIL_NAME",
+ /* 122 */ "md_for_loop_index ::= MD_TOKEN_NUMERIC MD_TOKEN_NON_SIGIL_NAME",
+ /* 123 */ "md_for_loop_index ::= MD_TOKEN_INT MD_TOKEN_NON_SIGIL_NAME",
+ /* 124 */ "md_for_loop_index ::= MD_TOKEN_FLOAT MD_TOKEN_NON_SIGIL_NAME",
+ /* 125 */ "md_for_loop_index ::= MD_TOKEN_STRING MD_TOKEN_NON_SIGIL_NAME",
+ /* 126 */ "md_for_loop_index ::= MD_TOKEN_BOOLEAN MD_TOKEN_NON_SIGIL_NAME",
+ /* 127 */ "md_for_map_keylist ::= md_for_loop_index",
+ /* 128 */ "md_for_map_keylist ::= md_for_map_keylist MD_TOKEN_COMMA md_for_loop_index",
+ /* 129 */ "md_for_loop_oosvar_key_only ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_for_loop_index MD_TOKEN_IN md_oosvar_keylist MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 130 */ "md_for_loop_local_map ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_for_loop_index MD_TOKEN_COMMA md_for_loop_index MD_TOKEN_IN md_local_map_keylist MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 131 */ "md_for_loop_local_map ::= MD_TOKEN_FOR MD_TOKEN_LPAREN MD_TOKEN_LPAREN md_for_map_keylist MD_TOKEN_RPAREN MD_TOKEN_COMMA md_for_loop_index MD_TOKEN_IN md_local_map_keylist MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 132 */ "md_for_loop_local_map_key_only ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_for_loop_index MD_TOKEN_IN md_local_map_keylist MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 133 */ "md_for_loop_map_literal ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_for_loop_index MD_TOKEN_COMMA md_for_loop_index MD_TOKEN_IN md_map_literal MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 134 */ "md_for_loop_map_literal ::= MD_TOKEN_FOR MD_TOKEN_LPAREN MD_TOKEN_LPAREN md_for_map_keylist MD_TOKEN_RPAREN MD_TOKEN_COMMA md_for_loop_index MD_TOKEN_IN md_map_literal MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 135 */ "md_for_loop_map_literal_key_only ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_for_loop_index MD_TOKEN_IN md_map_literal MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 136 */ "md_for_loop_func_retval ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_for_loop_index MD_TOKEN_COMMA md_for_loop_index MD_TOKEN_IN md_fcn_or_subr_call MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 137 */ "md_for_loop_func_retval ::= MD_TOKEN_FOR MD_TOKEN_LPAREN MD_TOKEN_LPAREN md_for_map_keylist MD_TOKEN_RPAREN MD_TOKEN_COMMA md_for_loop_index MD_TOKEN_IN md_fcn_or_subr_call MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 138 */ "md_for_loop_func_retval_key_only ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_for_loop_index MD_TOKEN_IN md_fcn_or_subr_call MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 139 */ "md_triple_for ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_triple_for_start MD_TOKEN_SEMICOLON md_triple_for_continuation MD_TOKEN_SEMICOLON md_triple_for_update MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 140 */ "md_triple_for_start ::= md_statement_not_braced_end",
+ /* 141 */ "md_triple_for_start ::= md_triple_for_start MD_TOKEN_COMMA md_statement_not_braced_end",
+ /* 142 */ "md_triple_for_continuation ::= md_statement_not_braced_end",
+ /* 143 */ "md_triple_for_continuation ::= md_triple_for_continuation MD_TOKEN_COMMA md_statement_not_braced_end",
+ /* 144 */ "md_triple_for_update ::= md_statement_not_braced_end",
+ /* 145 */ "md_triple_for_update ::= md_triple_for_update MD_TOKEN_COMMA md_statement_not_braced_end",
+ /* 146 */ "md_if_chain ::= md_if_elif_star",
+ /* 147 */ "md_if_chain ::= md_if_elif_star md_else_block",
+ /* 148 */ "md_if_elif_star ::= md_if_block",
+ /* 149 */ "md_if_elif_star ::= md_if_elif_star md_elif_block",
+ /* 150 */ "md_if_block ::= MD_TOKEN_IF MD_TOKEN_LPAREN md_rhs MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 151 */ "md_elif_block ::= MD_TOKEN_ELIF MD_TOKEN_LPAREN md_rhs MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 152 */ "md_else_block ::= MD_TOKEN_ELSE MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 153 */ "md_bare_boolean ::= md_rhs",
+ /* 154 */ "md_filter ::= MD_TOKEN_FILTER md_rhs",
+ /* 155 */ "md_untyped_local_definition ::= MD_TOKEN_VAR md_nonindexed_local_variable MD_TOKEN_ASSIGN md_rhs",
+ /* 156 */ "md_untyped_local_definition ::= MD_TOKEN_VAR md_nonindexed_local_variable MD_TOKEN_ASSIGN MD_TOKEN_FULL_SREC",
+ /* 157 */ "md_untyped_local_definition ::= MD_TOKEN_VAR md_nonindexed_local_variable MD_TOKEN_ASSIGN MD_TOKEN_FULL_OOSVAR",
+ /* 158 */ "md_untyped_local_definition ::= MD_TOKEN_VAR md_nonindexed_local_variable MD_TOKEN_ASSIGN md_map_literal",
+ /* 159 */ "md_numeric_local_definition ::= MD_TOKEN_NUMERIC md_nonindexed_local_variable MD_TOKEN_ASSIGN md_rhs",
+ /* 160 */ "md_int_local_definition ::= MD_TOKEN_INT md_nonindexed_local_variable MD_TOKEN_ASSIGN md_rhs",
+ /* 161 */ "md_float_local_definition ::= MD_TOKEN_FLOAT md_nonindexed_local_variable MD_TOKEN_ASSIGN md_rhs",
+ /* 162 */ "md_boolean_local_definition ::= MD_TOKEN_BOOLEAN md_nonindexed_local_variable MD_TOKEN_ASSIGN md_rhs",
+ /* 163 */ "md_string_local_definition ::= MD_TOKEN_STRING md_nonindexed_local_variable MD_TOKEN_ASSIGN md_rhs",
+ /* 164 */ "md_map_local_definition ::= MD_TOKEN_MAP md_nonindexed_local_variable MD_TOKEN_ASSIGN md_map_literal",
+ /* 165 */ "md_map_local_definition ::= MD_TOKEN_MAP md_nonindexed_local_variable MD_TOKEN_ASSIGN MD_TOKEN_FULL_SREC",
+ /* 166 */ "md_map_local_definition ::= MD_TOKEN_MAP md_nonindexed_local_variable MD_TOKEN_ASSIGN MD_TOKEN_FULL_OOSVAR",
+ /* 167 */ "md_map_local_definition ::= MD_TOKEN_MAP md_nonindexed_local_variable MD_TOKEN_ASSIGN md_rhs",
+ /* 168 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_ASSIGN md_rhs",
+ /* 169 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_ASSIGN md_rhs",
+ /* 170 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_ASSIGN md_map_literal",
+ /* 171 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_ASSIGN md_map_literal",
+ /* 172 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_ASSIGN MD_TOKEN_FULL_OOSVAR",
+ /* 173 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_ASSIGN MD_TOKEN_FULL_OOSVAR",
+ /* 174 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_ASSIGN MD_TOKEN_FULL_SREC",
+ /* 175 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_ASSIGN MD_TOKEN_FULL_SREC",
+ /* 176 */ "md_srec_assignment ::= md_field_name MD_TOKEN_ASSIGN md_rhs",
+ /* 177 */ "md_srec_indirect_assignment ::= MD_TOKEN_DOLLAR_SIGN MD_TOKEN_LEFT_BRACKET md_rhs MD_TOKEN_RIGHT_BRACKET MD_TOKEN_ASSIGN md_rhs",
+ /* 178 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_ASSIGN md_rhs",
+ /* 179 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_ASSIGN md_map_literal",
+ /* 180 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_ASSIGN MD_TOKEN_FULL_OOSVAR",
+ /* 181 */ "md_full_oosvar_assignment ::= MD_TOKEN_FULL_OOSVAR MD_TOKEN_ASSIGN md_rhs",
+ /* 182 */ "md_full_oosvar_assignment ::= MD_TOKEN_FULL_OOSVAR MD_TOKEN_ASSIGN md_map_literal",
+ /* 183 */ "md_full_oosvar_assignment ::= MD_TOKEN_FULL_OOSVAR MD_TOKEN_ASSIGN MD_TOKEN_FULL_OOSVAR",
+ /* 184 */ "md_full_oosvar_assignment ::= MD_TOKEN_FULL_OOSVAR MD_TOKEN_ASSIGN MD_TOKEN_FULL_SREC",
+ /* 185 */ "md_full_oosvar_assignment ::= MD_TOKEN_FULL_OOSVAR MD_TOKEN_ASSIGN md_fcn_or_subr_call",
+ /* 186 */ "md_oosvar_from_full_srec_assignment ::= md_oosvar_keylist MD_TOKEN_ASSIGN MD_TOKEN_FULL_SREC",
+ /* 187 */ "md_full_srec_assignment ::= MD_TOKEN_FULL_SREC MD_TOKEN_ASSIGN md_rhs",
+ /* 188 */ "md_full_srec_assignment ::= MD_TOKEN_FULL_SREC MD_TOKEN_ASSIGN md_map_literal",
+ /* 189 */ "md_full_srec_assignment ::= MD_TOKEN_FULL_SREC MD_TOKEN_ASSIGN MD_TOKEN_FULL_SREC",
+ /* 190 */ "md_full_srec_assignment ::= MD_TOKEN_FULL_SREC MD_TOKEN_ASSIGN MD_TOKEN_FULL_OOSVAR",
+ /* 191 */ "md_env_assignment ::= md_env_index MD_TOKEN_ASSIGN md_rhs",
+ /* 192 */ "md_srec_assignment ::= md_field_name MD_TOKEN_LOGICAL_OR_EQUALS md_rhs",
+ /* 193 */ "md_srec_assignment ::= md_field_name MD_TOKEN_LOGICAL_XOR_EQUALS md_rhs",
+ /* 194 */ "md_srec_assignment ::= md_field_name MD_TOKEN_LOGICAL_AND_EQUALS md_rhs",
+ /* 195 */ "md_srec_assignment ::= md_field_name MD_TOKEN_BITWISE_OR_EQUALS md_rhs",
+ /* 196 */ "md_srec_assignment ::= md_field_name MD_TOKEN_BITWISE_XOR_EQUALS md_rhs",
+ /* 197 */ "md_srec_assignment ::= md_field_name MD_TOKEN_BITWISE_AND_EQUALS md_rhs",
+ /* 198 */ "md_srec_assignment ::= md_field_name MD_TOKEN_BITWISE_LSH_EQUALS md_rhs",
+ /* 199 */ "md_srec_assignment ::= md_field_name MD_TOKEN_BITWISE_RSH_EQUALS md_rhs",
+ /* 200 */ "md_srec_assignment ::= md_field_name MD_TOKEN_PLUS_EQUALS md_rhs",
+ /* 201 */ "md_srec_assignment ::= md_field_name MD_TOKEN_MINUS_EQUALS md_rhs",
+ /* 202 */ "md_srec_assignment ::= md_field_name MD_TOKEN_DOT_EQUALS md_rhs",
+ /* 203 */ "md_srec_assignment ::= md_field_name MD_TOKEN_TIMES_EQUALS md_rhs",
+ /* 204 */ "md_srec_assignment ::= md_field_name MD_TOKEN_DIVIDE_EQUALS md_rhs",
+ /* 205 */ "md_srec_assignment ::= md_field_name MD_TOKEN_INT_DIVIDE_EQUALS md_rhs",
+ /* 206 */ "md_srec_assignment ::= md_field_name MD_TOKEN_OPLUS_EQUALS md_rhs",
+ /* 207 */ "md_srec_assignment ::= md_field_name MD_TOKEN_OMINUS_EQUALS md_rhs",
+ /* 208 */ "md_srec_assignment ::= md_field_name MD_TOKEN_OTIMES_EQUALS md_rhs",
+ /* 209 */ "md_srec_assignment ::= md_field_name MD_TOKEN_ODIVIDE_EQUALS md_rhs",
+ /* 210 */ "md_srec_assignment ::= md_field_name MD_TOKEN_INT_ODIVIDE_EQUALS md_rhs",
+ /* 211 */ "md_srec_assignment ::= md_field_name MD_TOKEN_MOD_EQUALS md_rhs",
+ /* 212 */ "md_srec_assignment ::= md_field_name MD_TOKEN_POW_EQUALS md_rhs",
+ /* 213 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_LOGICAL_OR_EQUALS md_rhs",
+ /* 214 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_LOGICAL_XOR_EQUALS md_rhs",
+ /* 215 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_LOGICAL_AND_EQUALS md_rhs",
+ /* 216 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_BITWISE_OR_EQUALS md_rhs",
+ /* 217 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_BITWISE_XOR_EQUALS md_rhs",
+ /* 218 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_BITWISE_AND_EQUALS md_rhs",
+ /* 219 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_BITWISE_LSH_EQUALS md_rhs",
+ /* 220 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_BITWISE_RSH_EQUALS md_rhs",
+ /* 221 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_PLUS_EQUALS md_rhs",
+ /* 222 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_MINUS_EQUALS md_rhs",
+ /* 223 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_DOT_EQUALS md_rhs",
+ /* 224 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_TIMES_EQUALS md_rhs",
+ /* 225 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_DIVIDE_EQUALS md_rhs",
+ /* 226 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_INT_DIVIDE_EQUALS md_rhs",
+ /* 227 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_MOD_EQUALS md_rhs",
+ /* 228 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_POW_EQUALS md_rhs",
+ /* 229 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_OPLUS_EQUALS md_rhs",
+ /* 230 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_OMINUS_EQUALS md_rhs",
+ /* 231 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_OTIMES_EQUALS md_rhs",
+ /* 232 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_ODIVIDE_EQUALS md_rhs",
+ /* 233 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_INT_ODIVIDE_EQUALS md_rhs",
+ /* 234 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_LOGICAL_OR_EQUALS md_rhs",
+ /* 235 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_LOGICAL_XOR_EQUALS md_rhs",
+ /* 236 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_LOGICAL_AND_EQUALS md_rhs",
+ /* 237 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_BITWISE_OR_EQUALS md_rhs",
+ /* 238 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_BITWISE_XOR_EQUALS md_rhs",
+ /* 239 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_BITWISE_AND_EQUALS md_rhs",
+ /* 240 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_BITWISE_LSH_EQUALS md_rhs",
+ /* 241 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_BITWISE_RSH_EQUALS md_rhs",
+ /* 242 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_PLUS_EQUALS md_rhs",
+ /* 243 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_MINUS_EQUALS md_rhs",
+ /* 244 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_DOT_EQUALS md_rhs",
+ /* 245 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_TIMES_EQUALS md_rhs",
+ /* 246 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_DIVIDE_EQUALS md_rhs",
+ /* 247 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_INT_DIVIDE_EQUALS md_rhs",
+ /* 248 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_MOD_EQUALS md_rhs",
+ /* 249 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_POW_EQUALS md_rhs",
+ /* 250 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_OPLUS_EQUALS md_rhs",
+ /* 251 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_OMINUS_EQUALS md_rhs",
+ /* 252 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_OTIMES_EQUALS md_rhs",
+ /* 253 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_ODIVIDE_EQUALS md_rhs",
+ /* 254 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_INT_ODIVIDE_EQUALS md_rhs",
+ /* 255 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_LOGICAL_OR_EQUALS md_rhs",
+ /* 256 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_LOGICAL_XOR_EQUALS md_rhs",
+ /* 257 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_LOGICAL_AND_EQUALS md_rhs",
+ /* 258 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_BITWISE_OR_EQUALS md_rhs",
+ /* 259 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_BITWISE_XOR_EQUALS md_rhs",
+ /* 260 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_BITWISE_AND_EQUALS md_rhs",
+ /* 261 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_BITWISE_LSH_EQUALS md_rhs",
+ /* 262 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_BITWISE_RSH_EQUALS md_rhs",
+ /* 263 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_PLUS_EQUALS md_rhs",
+ /* 264 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_MINUS_EQUALS md_rhs",
+ /* 265 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_DOT_EQUALS md_rhs",
+ /* 266 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_TIMES_EQUALS md_rhs",
+ /* 267 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_DIVIDE_EQUALS md_rhs",
+ /* 268 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_INT_DIVIDE_EQUALS md_rhs",
+ /* 269 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_MOD_EQUALS md_rhs",
+ /* 270 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_POW_EQUALS md_rhs",
+ /* 271 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_OPLUS_EQUALS md_rhs",
+ /* 272 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_OMINUS_EQUALS md_rhs",
+ /* 273 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_OTIMES_EQUALS md_rhs",
+ /* 274 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_ODIVIDE_EQUALS md_rhs",
+ /* 275 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_INT_ODIVIDE_EQUALS md_rhs",
+ /* 276 */ "md_env_assignment ::= md_env_index MD_TOKEN_LOGICAL_OR_EQUALS md_rhs",
+ /* 277 */ "md_env_assignment ::= md_env_index MD_TOKEN_LOGICAL_XOR_EQUALS md_rhs",
+ /* 278 */ "md_env_assignment ::= md_env_index MD_TOKEN_LOGICAL_AND_EQUALS md_rhs",
+ /* 279 */ "md_env_assignment ::= md_env_index MD_TOKEN_BITWISE_OR_EQUALS md_rhs",
+ /* 280 */ "md_env_assignment ::= md_env_index MD_TOKEN_BITWISE_XOR_EQUALS md_rhs",
+ /* 281 */ "md_env_assignment ::= md_env_index MD_TOKEN_BITWISE_AND_EQUALS md_rhs",
+ /* 282 */ "md_env_assignment ::= md_env_index MD_TOKEN_BITWISE_LSH_EQUALS md_rhs",
+ /* 283 */ "md_env_assignment ::= md_env_index MD_TOKEN_BITWISE_RSH_EQUALS md_rhs",
+ /* 284 */ "md_env_assignment ::= md_env_index MD_TOKEN_PLUS_EQUALS md_rhs",
+ /* 285 */ "md_env_assignment ::= md_env_index MD_TOKEN_MINUS_EQUALS md_rhs",
+ /* 286 */ "md_env_assignment ::= md_env_index MD_TOKEN_DOT_EQUALS md_rhs",
+ /* 287 */ "md_env_assignment ::= md_env_index MD_TOKEN_TIMES_EQUALS md_rhs",
+ /* 288 */ "md_env_assignment ::= md_env_index MD_TOKEN_DIVIDE_EQUALS md_rhs",
+ /* 289 */ "md_env_assignment ::= md_env_index MD_TOKEN_INT_DIVIDE_EQUALS md_rhs",
+ /* 290 */ "md_env_assignment ::= md_env_index MD_TOKEN_MOD_EQUALS md_rhs",
+ /* 291 */ "md_env_assignment ::= md_env_index MD_TOKEN_POW_EQUALS md_rhs",
+ /* 292 */ "md_env_assignment ::= md_env_index MD_TOKEN_OTIMES_EQUALS md_rhs",
+ /* 293 */ "md_env_assignment ::= md_env_index MD_TOKEN_ODIVIDE_EQUALS md_rhs",
+ /* 294 */ "md_env_assignment ::= md_env_index MD_TOKEN_OINT_DIVIDE_EQUALS md_rhs",
+ /* 295 */ "md_env_assignment ::= md_env_index MD_TOKEN_OMOD_EQUALS md_rhs",
+ /* 296 */ "md_env_assignment ::= md_env_index MD_TOKEN_OPOW_EQUALS md_rhs",
+ /* 297 */ "md_unset ::= MD_TOKEN_UNSET MD_TOKEN_ALL",
+ /* 298 */ "md_unset ::= MD_TOKEN_UNSET MD_TOKEN_FULL_OOSVAR",
+ /* 299 */ "md_unset ::= MD_TOKEN_UNSET md_unset_args",
+ /* 300 */ "md_unset_args ::=",
+ /* 301 */ "md_unset_args ::= md_field_name",
+ /* 302 */ "md_unset_args ::= md_indirect_field_name",
+ /* 303 */ "md_unset_args ::= MD_TOKEN_FULL_SREC",
+ /* 304 */ "md_unset_args ::= md_oosvar_keylist",
+ /* 305 */ "md_unset_args ::= md_nonindexed_local_variable",
+ /* 306 */ "md_unset_args ::= md_indexed_local_variable",
+ /* 307 */ "md_unset_args ::= md_unset_args MD_TOKEN_COMMA md_field_name",
+ /* 308 */ "md_unset_args ::= md_unset_args MD_TOKEN_COMMA md_oosvar_keylist",
+ /* 309 */ "md_tee_write ::= MD_TOKEN_TEE MD_TOKEN_GT md_output_file MD_TOKEN_COMMA MD_TOKEN_FULL_SREC",
+ /* 310 */ "md_tee_append ::= MD_TOKEN_TEE MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA MD_TOKEN_FULL_SREC",
+ /* 311 */ "md_tee_pipe ::= MD_TOKEN_TEE MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA MD_TOKEN_FULL_SREC",
+ /* 312 */ "md_emitf ::= MD_TOKEN_EMITF md_emitf_args",
+ /* 313 */ "md_emitf_args ::=",
+ /* 314 */ "md_emitf_args ::= md_oosvar_keylist",
+ /* 315 */ "md_emitf_args ::= md_nonindexed_local_variable",
+ /* 316 */ "md_emitf_args ::= md_indexed_local_variable",
+ /* 317 */ "md_emitf_args ::= md_emitf_args MD_TOKEN_COMMA md_oosvar_keylist",
+ /* 318 */ "md_emitf_args ::= md_emitf_args MD_TOKEN_COMMA md_nonindexed_local_variable",
+ /* 319 */ "md_emitf_args ::= md_emitf_args MD_TOKEN_COMMA md_indexed_local_variable",
+ /* 320 */ "md_emitf_write ::= MD_TOKEN_EMITF MD_TOKEN_GT md_output_file MD_TOKEN_COMMA md_emitf_args",
+ /* 321 */ "md_emitf_append ::= MD_TOKEN_EMITF MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA md_emitf_args",
+ /* 322 */ "md_emitf_pipe ::= MD_TOKEN_EMITF MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA md_emitf_args",
+ /* 323 */ "md_emitp ::= MD_TOKEN_EMITP md_emittable",
+ /* 324 */ "md_emitp ::= MD_TOKEN_EMITP md_emittable MD_TOKEN_COMMA md_emitp_namelist",
+ /* 325 */ "md_emitp_write ::= MD_TOKEN_EMITP MD_TOKEN_GT md_output_file MD_TOKEN_COMMA md_emittable",
+ /* 326 */ "md_emitp_write ::= MD_TOKEN_EMITP MD_TOKEN_GT md_output_file MD_TOKEN_COMMA md_emittable MD_TOKEN_COMMA md_emitp_namelist",
+ /* 327 */ "md_emitp_append ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA md_emittable",
+ /* 328 */ "md_emitp_append ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA md_emittable MD_TOKEN_COMMA md_emitp_namelist",
+ /* 329 */ "md_emitp_pipe ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA md_emittable",
+ /* 330 */ "md_emitp_pipe ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA md_emittable MD_TOKEN_COMMA md_emitp_namelist",
+ /* 331 */ "md_emitp_namelist ::= md_rhs",
+ /* 332 */ "md_emitp_namelist ::= md_emitp_namelist MD_TOKEN_COMMA md_rhs",
+ /* 333 */ "md_emit ::= MD_TOKEN_EMIT md_emittable",
+ /* 334 */ "md_emit ::= MD_TOKEN_EMIT md_emittable MD_TOKEN_COMMA md_emit_namelist",
+ /* 335 */ "md_emit_write ::= MD_TOKEN_EMIT MD_TOKEN_GT md_output_file MD_TOKEN_COMMA md_emittable",
+ /* 336 */ "md_emit_write ::= MD_TOKEN_EMIT MD_TOKEN_GT md_output_file MD_TOKEN_COMMA md_emittable MD_TOKEN_COMMA md_emit_namelist",
+ /* 337 */ "md_emit_append ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA md_emittable",
+ /* 338 */ "md_emit_append ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA md_emittable MD_TOKEN_COMMA md_emit_namelist",
+ /* 339 */ "md_emit_pipe ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA md_emittable",
+ /* 340 */ "md_emit_pipe ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA md_emittable MD_TOKEN_COMMA md_emit_namelist",
+ /* 341 */ "md_emittable ::= MD_TOKEN_ALL",
+ /* 342 */ "md_emittable ::= MD_TOKEN_FULL_OOSVAR",
+ /* 343 */ "md_emittable ::= md_oosvar_keylist",
+ /* 344 */ "md_emittable ::= md_nonindexed_local_variable",
+ /* 345 */ "md_emittable ::= md_indexed_local_variable",
+ /* 346 */ "md_emittable ::= MD_TOKEN_FULL_SREC",
+ /* 347 */ "md_emittable ::= md_map_literal",
+ /* 348 */ "md_emittable ::= md_fcn_or_subr_call",
+ /* 349 */ "md_emit_namelist ::= md_rhs",
+ /* 350 */ "md_emit_namelist ::= md_emit_namelist MD_TOKEN_COMMA md_rhs",
+ /* 351 */ "md_emitp_lashed ::= MD_TOKEN_EMITP MD_TOKEN_LPAREN md_emitp_lashed_keylists MD_TOKEN_RPAREN",
+ /* 352 */ "md_emitp_lashed ::= MD_TOKEN_EMITP MD_TOKEN_LPAREN md_emitp_lashed_keylists MD_TOKEN_RPAREN MD_TOKEN_COMMA md_emitp_lashed_namelist",
+ /* 353 */ "md_emitp_lashed_write ::= MD_TOKEN_EMITP MD_TOKEN_GT md_output_file MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emitp_lashed_keylists MD_TOKEN_RPAREN",
+ /* 354 */ "md_emitp_lashed_write ::= MD_TOKEN_EMITP MD_TOKEN_GT md_output_file MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emitp_lashed_keylists MD_TOKEN_RPAREN MD_TOKEN_COMMA md_emitp_lashed_namelist",
+ /* 355 */ "md_emitp_lashed_append ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emitp_lashed_keylists MD_TOKEN_RPAREN",
+ /* 356 */ "md_emitp_lashed_append ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emitp_lashed_keylists MD_TOKEN_RPAREN MD_TOKEN_COMMA md_emitp_lashed_namelist",
+ /* 357 */ "md_emitp_lashed_pipe ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emitp_lashed_keylists MD_TOKEN_RPAREN",
+ /* 358 */ "md_emitp_lashed_pipe ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emitp_lashed_keylists MD_TOKEN_RPAREN MD_TOKEN_COMMA md_emitp_lashed_namelist",
+ /* 359 */ "md_emitp_lashed_keylists ::= md_emittable",
+ /* 360 */ "md_emitp_lashed_keylists ::= md_emitp_lashed_keylists MD_TOKEN_COMMA md_emittable",
+ /* 361 */ "md_emitp_lashed_namelist ::= md_rhs",
+ /* 362 */ "md_emitp_lashed_namelist ::= md_emitp_lashed_namelist MD_TOKEN_COMMA md_rhs",
+ /* 363 */ "md_emit_lashed ::= MD_TOKEN_EMIT MD_TOKEN_LPAREN md_emit_lashed_keylists MD_TOKEN_RPAREN",
+ /* 364 */ "md_emit_lashed ::= MD_TOKEN_EMIT MD_TOKEN_LPAREN md_emit_lashed_keylists MD_TOKEN_RPAREN MD_TOKEN_COMMA md_emit_lashed_namelist",
+ /* 365 */ "md_emit_lashed_write ::= MD_TOKEN_EMIT MD_TOKEN_GT md_output_file MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emit_lashed_keylists MD_TOKEN_RPAREN",
+ /* 366 */ "md_emit_lashed_write ::= MD_TOKEN_EMIT MD_TOKEN_GT md_output_file MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emit_lashed_keylists MD_TOKEN_RPAREN MD_TOKEN_COMMA md_emit_lashed_namelist",
+ /* 367 */ "md_emit_lashed_append ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emit_lashed_keylists MD_TOKEN_RPAREN",
+ /* 368 */ "md_emit_lashed_append ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emit_lashed_keylists MD_TOKEN_RPAREN MD_TOKEN_COMMA md_emit_lashed_namelist",
+ /* 369 */ "md_emit_lashed_pipe ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emit_lashed_keylists MD_TOKEN_RPAREN",
+ /* 370 */ "md_emit_lashed_pipe ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emit_lashed_keylists MD_TOKEN_RPAREN MD_TOKEN_COMMA md_emit_lashed_namelist",
+ /* 371 */ "md_emit_lashed_keylists ::= md_emittable",
+ /* 372 */ "md_emit_lashed_keylists ::= md_emit_lashed_keylists MD_TOKEN_COMMA md_emittable",
+ /* 373 */ "md_emit_lashed_namelist ::= md_rhs",
+ /* 374 */ "md_emit_lashed_namelist ::= md_emit_lashed_namelist MD_TOKEN_COMMA md_rhs",
+ /* 375 */ "md_dump ::= MD_TOKEN_DUMP",
+ /* 376 */ "md_edump ::= MD_TOKEN_EDUMP",
+ /* 377 */ "md_dump_write ::= MD_TOKEN_DUMP MD_TOKEN_GT md_output_file",
+ /* 378 */ "md_dump_append ::= MD_TOKEN_DUMP MD_TOKEN_BITWISE_RSH md_output_file",
+ /* 379 */ "md_dump_pipe ::= MD_TOKEN_DUMP MD_TOKEN_BITWISE_OR md_rhs",
+ /* 380 */ "md_dump ::= MD_TOKEN_DUMP md_dumpable",
+ /* 381 */ "md_edump ::= MD_TOKEN_EDUMP md_dumpable",
+ /* 382 */ "md_dump_write ::= MD_TOKEN_DUMP MD_TOKEN_GT md_output_file md_dumpable",
+ /* 383 */ "md_dump_append ::= MD_TOKEN_DUMP MD_TOKEN_BITWISE_RSH md_output_file md_dumpable",
+ /* 384 */ "md_dump_pipe ::= MD_TOKEN_DUMP MD_TOKEN_BITWISE_OR md_dumpable md_rhs",
+ /* 385 */ "md_dumpable ::= MD_TOKEN_ALL",
+ /* 386 */ "md_dumpable ::= MD_TOKEN_FULL_OOSVAR",
+ /* 387 */ "md_dumpable ::= MD_TOKEN_FULL_SREC",
+ /* 388 */ "md_dumpable ::= md_map_literal",
+ /* 389 */ "md_dumpable ::= md_rhs",
+ /* 390 */ "md_print ::= MD_TOKEN_PRINT md_dumpable",
+ /* 391 */ "md_eprint ::= MD_TOKEN_EPRINT md_dumpable",
+ /* 392 */ "md_print_write ::= MD_TOKEN_PRINT MD_TOKEN_GT md_output_file MD_TOKEN_COMMA md_dumpable",
+ /* 393 */ "md_print_append ::= MD_TOKEN_PRINT MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA md_dumpable",
+ /* 394 */ "md_print_pipe ::= MD_TOKEN_PRINT MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA md_dumpable",
+ /* 395 */ "md_print ::= MD_TOKEN_PRINT",
+ /* 396 */ "md_eprint ::= MD_TOKEN_EPRINT",
+ /* 397 */ "md_print_write ::= MD_TOKEN_PRINT MD_TOKEN_GT md_output_file",
+ /* 398 */ "md_print_append ::= MD_TOKEN_PRINT MD_TOKEN_BITWISE_RSH md_output_file",
+ /* 399 */ "md_print_pipe ::= MD_TOKEN_PRINT MD_TOKEN_BITWISE_OR md_rhs",
+ /* 400 */ "md_printn ::= MD_TOKEN_PRINTN md_dumpable",
+ /* 401 */ "md_eprintn ::= MD_TOKEN_EPRINTN md_dumpable",
+ /* 402 */ "md_printn_write ::= MD_TOKEN_PRINTN MD_TOKEN_GT md_output_file MD_TOKEN_COMMA md_dumpable",
+ /* 403 */ "md_printn_append ::= MD_TOKEN_PRINTN MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA md_dumpable",
+ /* 404 */ "md_printn_pipe ::= MD_TOKEN_PRINTN MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA md_dumpable",
+ /* 405 */ "md_printn ::= MD_TOKEN_PRINTN",
+ /* 406 */ "md_eprintn ::= MD_TOKEN_EPRINTN",
+ /* 407 */ "md_printn_write ::= MD_TOKEN_PRINTN MD_TOKEN_GT md_output_file",
+ /* 408 */ "md_printn_append ::= MD_TOKEN_PRINTN MD_TOKEN_BITWISE_RSH md_output_file",
+ /* 409 */ "md_printn_pipe ::= MD_TOKEN_PRINTN MD_TOKEN_BITWISE_OR md_dumpable",
+ /* 410 */ "md_output_file ::= md_rhs",
+ /* 411 */ "md_output_file ::= MD_TOKEN_STDOUT",
+ /* 412 */ "md_output_file ::= MD_TOKEN_STDERR",
+ /* 413 */ "md_rhs ::= md_ternary",
+ /* 414 */ "md_ternary ::= md_logical_or_term MD_TOKEN_QUESTION_MARK md_ternary MD_TOKEN_COLON md_ternary",
+ /* 415 */ "md_ternary ::= md_logical_or_term",
+ /* 416 */ "md_logical_or_term ::= md_logical_xor_term",
+ /* 417 */ "md_logical_or_term ::= md_logical_or_term MD_TOKEN_LOGICAL_OR md_logical_xor_term",
+ /* 418 */ "md_logical_xor_term ::= md_logical_and_term",
+ /* 419 */ "md_logical_xor_term ::= md_logical_xor_term MD_TOKEN_LOGICAL_XOR md_logical_and_term",
+ /* 420 */ "md_logical_and_term ::= md_eqne_term",
+ /* 421 */ "md_logical_and_term ::= md_logical_and_term MD_TOKEN_LOGICAL_AND md_eqne_term",
+ /* 422 */ "md_eqne_term ::= md_cmp_term",
+ /* 423 */ "md_eqne_term ::= md_eqne_term MD_TOKEN_MATCHES md_cmp_term",
+ /* 424 */ "md_eqne_term ::= md_eqne_term MD_TOKEN_DOES_NOT_MATCH md_cmp_term",
+ /* 425 */ "md_eqne_term ::= md_eqne_term MD_TOKEN_EQ md_cmp_term",
+ /* 426 */ "md_eqne_term ::= md_eqne_term MD_TOKEN_NE md_cmp_term",
+ /* 427 */ "md_cmp_term ::= md_bitwise_or_term",
+ /* 428 */ "md_cmp_term ::= md_cmp_term MD_TOKEN_GT md_bitwise_or_term",
+ /* 429 */ "md_cmp_term ::= md_cmp_term MD_TOKEN_GE md_bitwise_or_term",
+ /* 430 */ "md_cmp_term ::= md_cmp_term MD_TOKEN_LT md_bitwise_or_term",
+ /* 431 */ "md_cmp_term ::= md_cmp_term MD_TOKEN_LE md_bitwise_or_term",
+ /* 432 */ "md_bitwise_or_term ::= md_bitwise_xor_term",
+ /* 433 */ "md_bitwise_or_term ::= md_bitwise_or_term MD_TOKEN_BITWISE_OR md_bitwise_xor_term",
+ /* 434 */ "md_bitwise_xor_term ::= md_bitwise_and_term",
+ /* 435 */ "md_bitwise_xor_term ::= md_bitwise_xor_term MD_TOKEN_BITWISE_XOR md_bitwise_and_term",
+ /* 436 */ "md_bitwise_and_term ::= md_bitwise_shift_term",
+ /* 437 */ "md_bitwise_and_term ::= md_bitwise_and_term MD_TOKEN_BITWISE_AND md_bitwise_shift_term",
+ /* 438 */ "md_bitwise_shift_term ::= md_addsubdot_term",
+ /* 439 */ "md_bitwise_shift_term ::= md_bitwise_shift_term MD_TOKEN_BITWISE_LSH md_addsubdot_term",
+ /* 440 */ "md_bitwise_shift_term ::= md_bitwise_shift_term MD_TOKEN_BITWISE_RSH md_addsubdot_term",
+ /* 441 */ "md_addsubdot_term ::= md_muldiv_term",
+ /* 442 */ "md_addsubdot_term ::= md_addsubdot_term MD_TOKEN_PLUS md_muldiv_term",
+ /* 443 */ "md_addsubdot_term ::= md_addsubdot_term MD_TOKEN_MINUS md_muldiv_term",
+ /* 444 */ "md_addsubdot_term ::= md_addsubdot_term MD_TOKEN_OPLUS md_muldiv_term",
+ /* 445 */ "md_addsubdot_term ::= md_addsubdot_term MD_TOKEN_OMINUS md_muldiv_term",
+ /* 446 */ "md_addsubdot_term ::= md_addsubdot_term MD_TOKEN_DOT md_muldiv_term",
+ /* 447 */ "md_muldiv_term ::= md_unary_bitwise_op_term",
+ /* 448 */ "md_muldiv_term ::= md_muldiv_term MD_TOKEN_TIMES md_unary_bitwise_op_term",
+ /* 449 */ "md_muldiv_term ::= md_muldiv_term MD_TOKEN_DIVIDE md_unary_bitwise_op_term",
+ /* 450 */ "md_muldiv_term ::= md_muldiv_term MD_TOKEN_INT_DIVIDE md_unary_bitwise_op_term",
+ /* 451 */ "md_muldiv_term ::= md_muldiv_term MD_TOKEN_MOD md_unary_bitwise_op_term",
+ /* 452 */ "md_muldiv_term ::= md_muldiv_term MD_TOKEN_OTIMES md_unary_bitwise_op_term",
+ /* 453 */ "md_muldiv_term ::= md_muldiv_term MD_TOKEN_ODIVIDE md_unary_bitwise_op_term",
+ /* 454 */ "md_muldiv_term ::= md_muldiv_term MD_TOKEN_INT_ODIVIDE md_unary_bitwise_op_term",
+ /* 455 */ "md_unary_bitwise_op_term ::= md_pow_term",
+ /* 456 */ "md_unary_bitwise_op_term ::= MD_TOKEN_PLUS md_unary_bitwise_op_term",
+ /* 457 */ "md_unary_bitwise_op_term ::= MD_TOKEN_MINUS md_unary_bitwise_op_term",
+ /* 458 */ "md_unary_bitwise_op_term ::= MD_TOKEN_OPLUS md_unary_bitwise_op_term",
+ /* 459 */ "md_unary_bitwise_op_term ::= MD_TOKEN_OMINUS md_unary_bitwise_op_term",
+ /* 460 */ "md_unary_bitwise_op_term ::= MD_TOKEN_LOGICAL_NOT md_unary_bitwise_op_term",
+ /* 461 */ "md_unary_bitwise_op_term ::= MD_TOKEN_BITWISE_NOT md_unary_bitwise_op_term",
+ /* 462 */ "md_pow_term ::= md_atom_or_fcn",
+ /* 463 */ "md_pow_term ::= md_atom_or_fcn MD_TOKEN_POW md_pow_term",
+ /* 464 */ "md_atom_or_fcn ::= md_field_name",
+ /* 465 */ "md_field_name ::= MD_TOKEN_FIELD_NAME",
+ /* 466 */ "md_field_name ::= MD_TOKEN_BRACED_FIELD_NAME",
+ /* 467 */ "md_atom_or_fcn ::= md_indirect_field_name",
+ /* 468 */ "md_indirect_field_name ::= MD_TOKEN_DOLLAR_SIGN MD_TOKEN_LEFT_BRACKET md_rhs MD_TOKEN_RIGHT_BRACKET",
+ /* 469 */ "md_atom_or_fcn ::= md_oosvar_keylist",
+ /* 470 */ "md_oosvar_keylist ::= md_oosvar_basename",
+ /* 471 */ "md_oosvar_keylist ::= md_oosvar_keylist MD_TOKEN_LEFT_BRACKET md_rhs MD_TOKEN_RIGHT_BRACKET",
+ /* 472 */ "md_oosvar_basename ::= MD_TOKEN_UNBRACED_OOSVAR_NAME",
+ /* 473 */ "md_oosvar_basename ::= MD_TOKEN_BRACED_OOSVAR_NAME",
+ /* 474 */ "md_oosvar_basename ::= MD_TOKEN_AT_SIGN MD_TOKEN_LEFT_BRACKET md_rhs MD_TOKEN_RIGHT_BRACKET",
+ /* 475 */ "md_local_map_keylist ::= md_nonindexed_local_variable",
+ /* 476 */ "md_local_map_keylist ::= md_local_map_keylist MD_TOKEN_LEFT_BRACKET md_rhs MD_TOKEN_RIGHT_BRACKET",
+ /* 477 */ "md_atom_or_fcn ::= MD_TOKEN_NUMBER",
+ /* 478 */ "md_atom_or_fcn ::= MD_TOKEN_TRUE",
+ /* 479 */ "md_atom_or_fcn ::= MD_TOKEN_FALSE",
+ /* 480 */ "md_atom_or_fcn ::= md_string",
+ /* 481 */ "md_atom_or_fcn ::= md_regexi",
+ /* 482 */ "md_atom_or_fcn ::= md_nonindexed_local_variable",
+ /* 483 */ "md_atom_or_fcn ::= md_indexed_local_variable",
+ /* 484 */ "md_nonindexed_local_variable ::= MD_TOKEN_NON_SIGIL_NAME",
+ /* 485 */ "md_indexed_local_variable ::= md_nonindexed_local_variable MD_TOKEN_LEFT_BRACKET md_rhs MD_TOKEN_RIGHT_BRACKET",
+ /* 486 */ "md_indexed_local_variable ::= md_indexed_local_variable MD_TOKEN_LEFT_BRACKET md_rhs MD_TOKEN_RIGHT_BRACKET",
+ /* 487 */ "md_string ::= MD_TOKEN_STRING",
+ /* 488 */ "md_regexi ::= MD_TOKEN_REGEXI",
+ /* 489 */ "md_atom_or_fcn ::= MD_TOKEN_CONTEXT_VARIABLE",
+ /* 490 */ "md_atom_or_fcn ::= md_env_index",
+ /* 491 */ "md_env_index ::= MD_TOKEN_ENV MD_TOKEN_LEFT_BRACKET md_rhs MD_TOKEN_RIGHT_BRACKET",
+ /* 492 */ "md_atom_or_fcn ::= MD_TOKEN_LPAREN md_rhs MD_TOKEN_RPAREN",
+ /* 493 */ "md_atom_or_fcn ::= md_fcn_or_subr_call",
+ /* 494 */ "md_fcn_or_subr_call ::= MD_TOKEN_NON_SIGIL_NAME MD_TOKEN_LPAREN md_fcn_arg_list MD_TOKEN_RPAREN",
+ /* 495 */ "md_fcn_or_subr_call ::= MD_TOKEN_INT MD_TOKEN_LPAREN md_fcn_arg_list MD_TOKEN_RPAREN",
+ /* 496 */ "md_fcn_or_subr_call ::= MD_TOKEN_FLOAT MD_TOKEN_LPAREN md_fcn_arg_list MD_TOKEN_RPAREN",
+ /* 497 */ "md_fcn_arg_list ::=",
+ /* 498 */ "md_fcn_arg_list ::= md_fcn_non_empty_arg_list",
+ /* 499 */ "md_fcn_non_empty_arg_list ::= md_fcn_arg",
+ /* 500 */ "md_fcn_non_empty_arg_list ::= md_fcn_arg MD_TOKEN_COMMA",
+ /* 501 */ "md_fcn_non_empty_arg_list ::= md_fcn_arg MD_TOKEN_COMMA md_fcn_non_empty_arg_list",
+ /* 502 */ "md_fcn_arg ::= md_rhs",
+ /* 503 */ "md_fcn_arg ::= MD_TOKEN_FULL_SREC",
+ /* 504 */ "md_fcn_arg ::= MD_TOKEN_FULL_OOSVAR",
+ /* 505 */ "md_fcn_arg ::= md_map_literal",
+ /* 506 */ "md_map_literal ::= MD_TOKEN_LBRACE MD_TOKEN_RBRACE",
+ /* 507 */ "md_map_literal ::= MD_TOKEN_LBRACE md_map_literal_kv_pairs MD_TOKEN_RBRACE",
+ /* 508 */ "md_map_literal_kv_pairs ::= md_map_literal_kv_pair",
+ /* 509 */ "md_map_literal_kv_pairs ::= md_map_literal_kv_pair MD_TOKEN_COMMA",
+ /* 510 */ "md_map_literal_kv_pairs ::= md_map_literal_kv_pair MD_TOKEN_COMMA md_map_literal_kv_pairs",
+ /* 511 */ "md_map_literal_kv_pair ::= md_map_literal_key MD_TOKEN_COLON md_map_literal_value",
+ /* 512 */ "md_map_literal_key ::= md_rhs",
+ /* 513 */ "md_map_literal_value ::= md_rhs",
+ /* 514 */ "md_map_literal_value ::= md_map_literal",
+ /* 515 */ "md_map_literal_value ::= MD_TOKEN_FULL_SREC",
+ /* 516 */ "md_map_literal_value ::= MD_TOKEN_FULL_OOSVAR",
+};
+#endif /* NDEBUG */
+
+/*
+** This function returns the symbolic name associated with a token
+** value.
+*/
+const char *mlr_dsl_ParseTokenName(int tokenType) {
+#ifndef NDEBUG
+	if (tokenType>0 && tokenType<(sizeof(yyTokenName)/sizeof(yyTokenName[0]))) {
+		return yyTokenName[tokenType];
+	} else {
+		return "Unknown";
+	}
+#else
+	return "";
+#endif
+}
+
+/*
+** This function allocates a new parser.
+** The only argument is a pointer to a function which works like
+** malloc.
+**
+** Inputs:
+** A pointer to the function used to allocate memory.
+**
+** Outputs:
+** A pointer to a parser.  This pointer is used in subsequent calls
+** to Parse and mlr_dsl_lemon_parser_free.
+*/
+void *mlr_dsl_lemon_parser_alloc(void *(*mallocProc)(size_t)){
+	lemon_parser_t *pParser;
+	pParser = (lemon_parser_t*)(*mallocProc) ((size_t)sizeof(lemon_parser_t)) ;
+	if (pParser) {
+		pParser->yyidx = -1;
+	}
+	return pParser;
+}
+
+/* The following function deletes the value associated with a
+** symbol.  The symbol can be either a terminal or nonterminal.
+** "yymajor" is the symbol code, and "yypminor" is a pointer to
+** the value.
+*/
+void mlr_dsl_yy_destructor(YYCODETYPE yymajor, YYMINORTYPE *yypminor){
+	switch (yymajor) {
+		/* Here is inserted the actions which take place when a
+		** terminal or non-terminal is destroyed.  This can happen
+		** when the symbol is popped from the stack during a
+		** reduce or during error processing or when a parser is
+		** being destroyed before it is finished parsing.
+		**
+		** Note: during a reduce, the only symbols destroyed are those
+		** which appear on the RHS of the rule, but which are not used
+		** inside the C code.
+		*/
+		default:  break;   /* If no destructor action specified: do nothing */
+	}
+}
+
+/*
+** Pop the parser's stack once.
+**
+** If there is a destructor routine associated with the token which
+** is popped from the stack, then call it.
+**
+** Return the major token number for the symbol popped.
+*/
+static int yy_pop_parser_stack(lemon_parser_t *pParser){
+	YYCODETYPE yymajor;
+	yyStackEntry *yytos = &pParser->yystack[pParser->yyidx];
+
+	if (pParser->yyidx<0)  return 0;
+#ifndef NDEBUG
+	if (yyTraceFILE && pParser->yyidx>=0) {
+		fprintf(yyTraceFILE,"%sPopping %s\n", yyTracePrompt, yyTokenName[yytos->major]);
+	}
+#endif
+	yymajor = yytos->major;
+	mlr_dsl_yy_destructor (yymajor, &yytos->minor);
+	pParser->yyidx--;
+	return yymajor;
+}
+
+/*
+** Deallocate and destroy a parser.  Destructors are all called for
+** all stack elements before shutting the parser down.
+**
+** Inputs:
+** <ul>
+** <li>  A pointer to the parser.  This should be a pointer
+**       obtained from mlr_dsl_lemon_parser_alloc.
+** <li>  A pointer to a function used to reclaim memory obtained
+**       from malloc.
+** </ul>
+*/
+void mlr_dsl_lemon_parser_free(
+	void *pvparser,             /* The parser to be deleted */
+	void (*freeProc)(void*))    /* Function used to reclaim memory */
+{
+	lemon_parser_t *pparser = (lemon_parser_t*)pvparser;
+	if (pparser==0)  return;
+	while (pparser->yyidx>=0)  yy_pop_parser_stack(pparser);
+	(*freeProc)((void*)pparser);
+}
+
+/*
+** Find the appropriate action for a parser given the terminal
+** look-ahead token iLookAhead.
+**
+** If the look-ahead token is YYNOCODE, then check to see if the action is
+** independent of the look-ahead.  If it is, return the action, otherwise
+** return YY_NO_ACTION.
+*/
+static int yy_find_shift_action(
+	lemon_parser_t *pparser,        /* The parser */
+	int iLookAhead)           /* The look-ahead token */
+{
+	int i;
+	int stateno = pparser->yystack[pparser->yyidx].stateno;
+
+	/* if (pparser->yyidx<0)  return YY_NO_ACTION;  */
+	i = yy_shift_ofst[stateno];
+	if (i==YY_SHIFT_USE_DFLT) {
+		return yy_default[stateno];
+	}
+	if (iLookAhead==YYNOCODE) {
+		return YY_NO_ACTION;
+	}
+	i += iLookAhead;
+	if (i<0 || i>=YY_SZ_ACTTAB || yy_lookahead[i]!=iLookAhead) {
+#ifdef YYFALLBACK
+		int iFallback;            /* Fallback token */
+		if (iLookAhead<sizeof(yyFallback)/sizeof(yyFallback[0])
+					 && (iFallback = yyFallback[iLookAhead])!=0) {
+#ifndef NDEBUG
+			if (yyTraceFILE) {
+				fprintf(yyTraceFILE, "%sFALLBACK %s => %s\n",
+					 yyTracePrompt, yyTokenName[iLookAhead], yyTokenName[iFallback]);
+			}
+#endif
+			return yy_find_shift_action(pparser, iFallback);
+		}
+#endif
+		return yy_default[stateno];
+	} else {
+		return yy_action[i];
+	}
+}
+
+/*
+** Find the appropriate action for a parser given the non-terminal
+** look-ahead token iLookAhead.
+**
+** If the look-ahead token is YYNOCODE, then check to see if the action is
+** independent of the look-ahead.  If it is, return the action, otherwise
+** return YY_NO_ACTION.
+*/
+static int yy_find_reduce_action(
+	lemon_parser_t *pparser,        /* The parser */
+	int iLookAhead)           /* The look-ahead token */
+{
+	int i;
+	int stateno = pparser->yystack[pparser->yyidx].stateno;
+
+	i = yy_reduce_ofst[stateno];
+	if (i==YY_REDUCE_USE_DFLT) {
+		return yy_default[stateno];
+	}
+	if (iLookAhead==YYNOCODE) {
+		return YY_NO_ACTION;
+	}
+	i += iLookAhead;
+	if (i<0 || i>=YY_SZ_ACTTAB || yy_lookahead[i]!=iLookAhead) {
+		return yy_default[stateno];
+	} else {
+		return yy_action[i];
+	}
+}
+
+/*
+** Perform a shift action.
+*/
+static void yy_shift(
+	lemon_parser_t *pparser,          /* The parser to be shifted */
+	int yyNewState,               /* The new state to shift in */
+	int yyMajor,                  /* The major token to shift in */
+	YYMINORTYPE *yypMinor)        /* Pointer ot the minor token to shift in */
+{
+	yyStackEntry *yytos;
+	pparser->yyidx++;
+	if (pparser->yyidx>=YYSTACKDEPTH) {
+		 ParseARG_FETCH;
+		 pparser->yyidx--;
+#ifndef NDEBUG
+		 if (yyTraceFILE) {
+			 fprintf(yyTraceFILE,"%sStack Overflow!\n",yyTracePrompt);
+		 }
+#endif
+		 while (pparser->yyidx>=0)  yy_pop_parser_stack(pparser);
+		 /* Here code is inserted which will execute if the parser
+		 ** stack every overflows */
+		 ParseARG_STORE; /* Suppress warning about unused %extra_argument var */
+		 return;
+	}
+	yytos = &pparser->yystack[pparser->yyidx];
+	yytos->stateno = yyNewState;
+	yytos->major = yyMajor;
+	yytos->minor = *yypMinor;
+#ifndef NDEBUG
+	if (yyTraceFILE && pparser->yyidx>0) {
+		int i;
+		fprintf(yyTraceFILE,"%sShift %d\n",yyTracePrompt,yyNewState);
+		fprintf(yyTraceFILE,"%sStack:",yyTracePrompt);
+		for(i=1; i<=pparser->yyidx; i++)
+			fprintf(yyTraceFILE," %s", yyTokenName[pparser->yystack[i].major]);
+		fprintf(yyTraceFILE,"\n");
+	}
+#endif
+}
+
+/* The following table contains information about every rule that
+** is used during the reduce.
+*/
+static struct {
+	YYCODETYPE lhs;         /* Symbol on the left-hand side of the rule */
+	unsigned char nrhs;     /* Number of right-hand side symbols in the rule */
+} yyRuleInfo[] = {
+  { 120, 1 },
+  { 121, 1 },
+  { 121, 1 },
+  { 121, 3 },
+  { 121, 2 },
+  { 122, 0 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 2 },
+  { 122, 2 },
+  { 122, 2 },
+  { 122, 2 },
+  { 122, 1 },
+  { 123, 1 },
+  { 123, 1 },
+  { 123, 1 },
+  { 123, 1 },
+  { 123, 1 },
+  { 123, 1 },
+  { 123, 1 },
+  { 123, 1 },
+  { 123, 1 },
+  { 123, 1 },
+  { 123, 1 },
+  { 123, 1 },
+  { 123, 1 },
+  { 123, 1 },
+  { 123, 1 },
+  { 123, 1 },
+  { 123, 1 },
+  { 123, 1 },
+  { 123, 1 },
+  { 123, 1 },
+  { 122, 2 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 122, 1 },
+  { 135, 8 },
+  { 135, 10 },
+  { 136, 8 },
+  { 205, 0 },
+  { 205, 1 },
+  { 207, 1 },
+  { 207, 2 },
+  { 207, 3 },
+  { 208, 1 },
+  { 208, 2 },
+  { 206, 1 },
+  { 206, 1 },
+  { 206, 1 },
+  { 206, 1 },
+  { 206, 1 },
+  { 206, 1 },
+  { 206, 1 },
+  { 137, 4 },
+  { 138, 4 },
+  { 139, 4 },
+  { 140, 7 },
+  { 161, 8 },
+  { 141, 11 },
+  { 142, 9 },
+  { 143, 11 },
+  { 143, 13 },
+  { 144, 9 },
+  { 145, 11 },
+  { 145, 13 },
+  { 209, 1 },
+  { 209, 2 },
+  { 209, 2 },
+  { 209, 2 },
+  { 209, 2 },
+  { 209, 2 },
+  { 210, 1 },
+  { 210, 3 },
+  { 146, 9 },
+  { 147, 11 },
+  { 147, 13 },
+  { 148, 9 },
+  { 149, 11 },
+  { 149, 13 },
+  { 150, 9 },
+  { 151, 11 },
+  { 151, 13 },
+  { 152, 9 },
+  { 153, 11 },
+  { 213, 1 },
+  { 213, 3 },
+  { 214, 1 },
+  { 214, 3 },
+  { 215, 1 },
+  { 215, 3 },
+  { 154, 1 },
+  { 154, 2 },
+  { 216, 1 },
+  { 216, 2 },
+  { 218, 7 },
+  { 219, 7 },
+  { 217, 4 },
+  { 162, 1 },
+  { 165, 2 },
+  { 124, 4 },
+  { 124, 4 },
+  { 124, 4 },
+  { 124, 4 },
+  { 125, 4 },
+  { 126, 4 },
+  { 127, 4 },
+  { 128, 4 },
+  { 129, 4 },
+  { 130, 4 },
+  { 130, 4 },
+  { 130, 4 },
+  { 130, 4 },
+  { 131, 3 },
+  { 132, 3 },
+  { 131, 3 },
+  { 132, 3 },
+  { 131, 3 },
+  { 132, 3 },
+  { 131, 3 },
+  { 132, 3 },
+  { 156, 3 },
+  { 157, 6 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 164, 3 },
+  { 164, 3 },
+  { 164, 3 },
+  { 164, 3 },
+  { 164, 3 },
+  { 158, 3 },
+  { 159, 3 },
+  { 159, 3 },
+  { 159, 3 },
+  { 159, 3 },
+  { 160, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 156, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 163, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 131, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 132, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 160, 3 },
+  { 166, 2 },
+  { 166, 2 },
+  { 166, 2 },
+  { 224, 0 },
+  { 224, 1 },
+  { 224, 1 },
+  { 224, 1 },
+  { 224, 1 },
+  { 224, 1 },
+  { 224, 1 },
+  { 224, 3 },
+  { 224, 3 },
+  { 167, 5 },
+  { 168, 5 },
+  { 169, 5 },
+  { 170, 2 },
+  { 227, 0 },
+  { 227, 1 },
+  { 227, 1 },
+  { 227, 1 },
+  { 227, 3 },
+  { 227, 3 },
+  { 227, 3 },
+  { 171, 5 },
+  { 172, 5 },
+  { 173, 5 },
+  { 174, 2 },
+  { 174, 4 },
+  { 175, 5 },
+  { 175, 7 },
+  { 176, 5 },
+  { 176, 7 },
+  { 177, 5 },
+  { 177, 7 },
+  { 229, 1 },
+  { 229, 3 },
+  { 178, 2 },
+  { 178, 4 },
+  { 179, 5 },
+  { 179, 7 },
+  { 180, 5 },
+  { 180, 7 },
+  { 181, 5 },
+  { 181, 7 },
+  { 228, 1 },
+  { 228, 1 },
+  { 228, 1 },
+  { 228, 1 },
+  { 228, 1 },
+  { 228, 1 },
+  { 228, 1 },
+  { 228, 1 },
+  { 230, 1 },
+  { 230, 3 },
+  { 182, 4 },
+  { 182, 6 },
+  { 183, 7 },
+  { 183, 9 },
+  { 184, 7 },
+  { 184, 9 },
+  { 185, 7 },
+  { 185, 9 },
+  { 231, 1 },
+  { 231, 3 },
+  { 232, 1 },
+  { 232, 3 },
+  { 186, 4 },
+  { 186, 6 },
+  { 187, 7 },
+  { 187, 9 },
+  { 188, 7 },
+  { 188, 9 },
+  { 189, 7 },
+  { 189, 9 },
+  { 233, 1 },
+  { 233, 3 },
+  { 234, 1 },
+  { 234, 3 },
+  { 190, 1 },
+  { 194, 1 },
+  { 191, 3 },
+  { 192, 3 },
+  { 193, 3 },
+  { 190, 2 },
+  { 194, 2 },
+  { 191, 4 },
+  { 192, 4 },
+  { 193, 4 },
+  { 235, 1 },
+  { 235, 1 },
+  { 235, 1 },
+  { 235, 1 },
+  { 235, 1 },
+  { 195, 2 },
+  { 196, 2 },
+  { 197, 5 },
+  { 198, 5 },
+  { 199, 5 },
+  { 195, 1 },
+  { 196, 1 },
+  { 197, 3 },
+  { 198, 3 },
+  { 199, 3 },
+  { 200, 2 },
+  { 201, 2 },
+  { 202, 5 },
+  { 203, 5 },
+  { 204, 5 },
+  { 200, 1 },
+  { 201, 1 },
+  { 202, 3 },
+  { 203, 3 },
+  { 204, 3 },
+  { 226, 1 },
+  { 226, 1 },
+  { 226, 1 },
+  { 133, 1 },
+  { 236, 5 },
+  { 236, 1 },
+  { 237, 1 },
+  { 237, 3 },
+  { 238, 1 },
+  { 238, 3 },
+  { 239, 1 },
+  { 239, 3 },
+  { 240, 1 },
+  { 240, 3 },
+  { 240, 3 },
+  { 240, 3 },
+  { 240, 3 },
+  { 241, 1 },
+  { 241, 3 },
+  { 241, 3 },
+  { 241, 3 },
+  { 241, 3 },
+  { 242, 1 },
+  { 242, 3 },
+  { 243, 1 },
+  { 243, 3 },
+  { 244, 1 },
+  { 244, 3 },
+  { 245, 1 },
+  { 245, 3 },
+  { 245, 3 },
+  { 246, 1 },
+  { 246, 3 },
+  { 246, 3 },
+  { 246, 3 },
+  { 246, 3 },
+  { 246, 3 },
+  { 247, 1 },
+  { 247, 3 },
+  { 247, 3 },
+  { 247, 3 },
+  { 247, 3 },
+  { 247, 3 },
+  { 247, 3 },
+  { 247, 3 },
+  { 248, 1 },
+  { 248, 2 },
+  { 248, 2 },
+  { 248, 2 },
+  { 248, 2 },
+  { 248, 2 },
+  { 248, 2 },
+  { 249, 1 },
+  { 249, 3 },
+  { 250, 1 },
+  { 222, 1 },
+  { 222, 1 },
+  { 250, 1 },
+  { 225, 4 },
+  { 250, 1 },
+  { 211, 1 },
+  { 211, 4 },
+  { 251, 1 },
+  { 251, 1 },
+  { 251, 4 },
+  { 212, 1 },
+  { 212, 4 },
+  { 250, 1 },
+  { 250, 1 },
+  { 250, 1 },
+  { 250, 1 },
+  { 250, 1 },
+  { 250, 1 },
+  { 250, 1 },
+  { 220, 1 },
+  { 221, 4 },
+  { 221, 4 },
+  { 252, 1 },
+  { 253, 1 },
+  { 250, 1 },
+  { 250, 1 },
+  { 223, 4 },
+  { 250, 3 },
+  { 250, 1 },
+  { 155, 4 },
+  { 155, 4 },
+  { 155, 4 },
+  { 254, 0 },
+  { 254, 1 },
+  { 255, 1 },
+  { 255, 2 },
+  { 255, 3 },
+  { 256, 1 },
+  { 256, 1 },
+  { 256, 1 },
+  { 256, 1 },
+  { 134, 2 },
+  { 134, 3 },
+  { 257, 1 },
+  { 257, 2 },
+  { 257, 3 },
+  { 258, 3 },
+  { 259, 1 },
+  { 260, 1 },
+  { 260, 1 },
+  { 260, 1 },
+  { 260, 1 },
+};
+
+static void yy_accept(lemon_parser_t*);  /* Forward Declaration */
+
+/*
+** Perform a reduce action and the shift that must immediately
+** follow the reduce.
+*/
+static void yy_reduce(
+	lemon_parser_t *pparser,         /* The parser */
+	int yyruleno)                /* Number of the rule by which to reduce */
+{
+	int yygoto = -999 ;                     /* The next state */
+	int yyact = -999;                      /* The next action */
+	YYMINORTYPE yygotominor;        /* The LHS of the rule reduced */
+	yyStackEntry *yymsp;            /* The top of the parser's stack */
+	int yysize;                     /* Amount to pop the stack */
+	ParseARG_FETCH;
+	yymsp = &pparser->yystack[pparser->yyidx];
+#ifndef NDEBUG
+	if (yyTraceFILE && yyruleno>=0
+				&& yyruleno<sizeof(yyRuleName)/sizeof(yyRuleName[0])) {
+		fprintf(yyTraceFILE, "%sReduce [%s].\n", yyTracePrompt,
+			yyRuleName[yyruleno]);
+	}
+#endif /* NDEBUG */
+
+	switch (yyruleno) {
+	/* Beginning here are the reduction cases.  A typical example
+	** follows:
+	**   case 0:
+	**  #line <lineno> <grammarfile>
+	**     { ... }           // User supplied code
+	**  #line <lineno> <thisfile>
+	**     break;
+	*/
+      case 0:
+#line 71 "mlr_dsl_parse.y"
+{
+	past->proot = yymsp[0].minor.yy247;
+}
+#line 5798 "mlr_dsl_parse.c"
+        break;
+      case 1:
+      case 2:
+#line 87 "mlr_dsl_parse.y"
+{
+	if (yymsp[0].minor.yy247->type == MD_AST_NODE_TYPE_NOP) {
+		mlr_dsl_ast_node_free(yymsp[0].minor.yy247);
+		yygotominor.yy247 = mlr_dsl_ast_node_alloc_zary("block", MD_AST_NODE_TYPE_STATEMENT_BLOCK);
+	} else {
+		yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("block", MD_AST_NODE_TYPE_STATEMENT_BLOCK, yymsp[0].minor.yy247);
+	}
+}
+#line 5811 "mlr_dsl_parse.c"
+        break;
+      case 3:
+#line 108 "mlr_dsl_parse.y"
+{
+	if (yymsp[-2].minor.yy247->type == MD_AST_NODE_TYPE_NOP) {
+		mlr_dsl_ast_node_free(yymsp[-2].minor.yy247);
+		yygotominor.yy247 = yymsp[0].minor.yy247;
+	} else {
+		yygotominor.yy247 = mlr_dsl_ast_node_prepend_arg(yymsp[0].minor.yy247, yymsp[-2].minor.yy247);
+	}
+}
+#line 5823 "mlr_dsl_parse.c"
+        break;
+      case 4:
+#line 117 "mlr_dsl_parse.y"
+{
+	if (yymsp[-1].minor.yy247->type == MD_AST_NODE_TYPE_NOP) {
+		mlr_dsl_ast_node_free(yymsp[-1].minor.yy247);
+		yygotominor.yy247 = yymsp[0].minor.yy247;
+	} else {
+		yygotominor.yy247 = mlr_dsl_ast_node_prepend_arg(yymsp[0].minor.yy247, yymsp[-1].minor.yy247);
+	}
+}
+#line 5835 "mlr_dsl_parse.c"
+        break;
+      case 5:
+#line 127 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_zary("nop", MD_AST_NODE_TYPE_NOP);
+}
+#line 5842 "mlr_dsl_parse.c"
+        break;
+      case 6:
+      case 7:
+      case 8:
+      case 9:
+      case 10:
+      case 11:
+      case 12:
+      case 13:
+      case 14:
+      case 20:
+      case 21:
+      case 22:
+      case 23:
+      case 24:
+      case 25:
+      case 26:
+      case 27:
+      case 28:
+      case 29:
+      case 30:
+      case 31:
+      case 32:
+      case 33:
+      case 34:
+      case 35:
+      case 36:
+      case 37:
+      case 38:
+      case 39:
+      case 41:
+      case 42:
+      case 43:
+      case 44:
+      case 45:
+      case 46:
+      case 47:
+      case 48:
+      case 49:
+      case 50:
+      case 51:
+      case 52:
+      case 53:
+      case 54:
+      case 55:
+      case 56:
+      case 57:
+      case 58:
+      case 59:
+      case 60:
+      case 61:
+      case 62:
+      case 63:
+      case 64:
+      case 65:
+      case 66:
+      case 67:
+      case 68:
+      case 69:
+      case 70:
+      case 71:
+      case 72:
+      case 73:
+      case 74:
+      case 75:
+      case 76:
+      case 77:
+      case 78:
+      case 79:
+      case 80:
+      case 81:
+      case 82:
+      case 83:
+      case 84:
+      case 85:
+      case 86:
+      case 87:
+      case 88:
+      case 89:
+      case 410:
+#line 132 "mlr_dsl_parse.y"
+{ yygotominor.yy247 = yymsp[0].minor.yy247; }
+#line 5925 "mlr_dsl_parse.c"
+        break;
+      case 15:
+      case 16:
+#line 143 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("return_value", MD_AST_NODE_TYPE_RETURN_VALUE, yymsp[0].minor.yy247);
+}
+#line 5933 "mlr_dsl_parse.c"
+        break;
+      case 17:
+      case 18:
+#line 149 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("return_value", MD_AST_NODE_TYPE_RETURN_VALUE, yymsp[0].minor.yy0);
+}
+#line 5941 "mlr_dsl_parse.c"
+        break;
+      case 19:
+#line 156 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_zary("return_void", MD_AST_NODE_TYPE_RETURN_VOID);
+}
+#line 5948 "mlr_dsl_parse.c"
+        break;
+      case 40:
+#line 184 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("subr_call", MD_AST_NODE_TYPE_SUBR_CALLSITE, yymsp[0].minor.yy247);
+}
+#line 5955 "mlr_dsl_parse.c"
+        break;
+      case 90:
+#line 245 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_BREAK);
+}
+#line 5962 "mlr_dsl_parse.c"
+        break;
+      case 91:
+#line 248 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_CONTINUE);
+}
+#line 5969 "mlr_dsl_parse.c"
+        break;
+      case 92:
+#line 263 "mlr_dsl_parse.y"
+{
+	yymsp[-4].minor.yy247 = mlr_dsl_ast_node_set_function_name(yymsp[-4].minor.yy247, yymsp[-6].minor.yy0->text);
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "func_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_FUNC_DEF, yymsp[-4].minor.yy247, yymsp[-1].minor.yy247);
+}
+#line 5978 "mlr_dsl_parse.c"
+        break;
+      case 93:
+#line 273 "mlr_dsl_parse.y"
+{
+	yymsp[-6].minor.yy247 = mlr_dsl_ast_node_set_function_name(yymsp[-6].minor.yy247, yymsp[-8].minor.yy0->text);
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "func_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_ternary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_FUNC_DEF, yymsp[-6].minor.yy247, yymsp[-1].minor.yy247, yymsp[-3].minor.yy247);
+}
+#line 5987 "mlr_dsl_parse.c"
+        break;
+      case 94:
+#line 282 "mlr_dsl_parse.y"
+{
+	yymsp[-4].minor.yy247 = mlr_dsl_ast_node_set_function_name(yymsp[-4].minor.yy247, yymsp[-6].minor.yy0->text);
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "subr_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_SUBR_DEF, yymsp[-4].minor.yy247, yymsp[-1].minor.yy247);
+}
+#line 5996 "mlr_dsl_parse.c"
+        break;
+      case 95:
+      case 497:
+#line 288 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_zary("anon", MD_AST_NODE_TYPE_NON_SIGIL_NAME);
+}
+#line 6004 "mlr_dsl_parse.c"
+        break;
+      case 96:
+      case 146:
+      case 153:
+      case 343:
+      case 344:
+      case 345:
+      case 347:
+      case 348:
+      case 388:
+      case 389:
+      case 413:
+      case 415:
+      case 416:
+      case 418:
+      case 420:
+      case 422:
+      case 427:
+      case 432:
+      case 434:
+      case 436:
+      case 438:
+      case 441:
+      case 447:
+      case 455:
+      case 462:
+      case 464:
+      case 467:
+      case 469:
+      case 470:
+      case 475:
+      case 480:
+      case 481:
+      case 482:
+      case 483:
+      case 490:
+      case 493:
+      case 498:
+      case 502:
+      case 505:
+#line 291 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = yymsp[0].minor.yy247;
+}
+#line 6049 "mlr_dsl_parse.c"
+        break;
+      case 97:
+      case 499:
+#line 294 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("anon", MD_AST_NODE_TYPE_NON_SIGIL_NAME, yymsp[0].minor.yy247);
+}
+#line 6057 "mlr_dsl_parse.c"
+        break;
+      case 98:
+      case 500:
+#line 297 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("anon", MD_AST_NODE_TYPE_NON_SIGIL_NAME, yymsp[-1].minor.yy247);
+}
+#line 6065 "mlr_dsl_parse.c"
+        break;
+      case 99:
+      case 501:
+      case 510:
+#line 302 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_prepend_arg(yymsp[0].minor.yy247, yymsp[-2].minor.yy247);
+}
+#line 6074 "mlr_dsl_parse.c"
+        break;
+      case 100:
+#line 306 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_UNTYPED_PARAMETER_DEFINITION);
+}
+#line 6081 "mlr_dsl_parse.c"
+        break;
+      case 101:
+#line 309 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, yymsp[-1].minor.yy247->type);
+}
+#line 6088 "mlr_dsl_parse.c"
+        break;
+      case 102:
+#line 313 "mlr_dsl_parse.y"
+{ yygotominor.yy247 = yymsp[0].minor.yy0; yygotominor.yy247->type = MD_AST_NODE_TYPE_UNTYPED_PARAMETER_DEFINITION; }
+#line 6093 "mlr_dsl_parse.c"
+        break;
+      case 103:
+#line 314 "mlr_dsl_parse.y"
+{ yygotominor.yy247 = yymsp[0].minor.yy0; yygotominor.yy247->type = MD_AST_NODE_TYPE_NUMERIC_PARAMETER_DEFINITION; }
+#line 6098 "mlr_dsl_parse.c"
+        break;
+      case 104:
+#line 315 "mlr_dsl_parse.y"
+{ yygotominor.yy247 = yymsp[0].minor.yy0; yygotominor.yy247->type = MD_AST_NODE_TYPE_INT_PARAMETER_DEFINITION;     }
+#line 6103 "mlr_dsl_parse.c"
+        break;
+      case 105:
+#line 316 "mlr_dsl_parse.y"
+{ yygotominor.yy247 = yymsp[0].minor.yy0; yygotominor.yy247->type = MD_AST_NODE_TYPE_FLOAT_PARAMETER_DEFINITION;   }
+#line 6108 "mlr_dsl_parse.c"
+        break;
+      case 106:
+#line 317 "mlr_dsl_parse.y"
+{ yygotominor.yy247 = yymsp[0].minor.yy0; yygotominor.yy247->type = MD_AST_NODE_TYPE_STRING_PARAMETER_DEFINITION;  }
+#line 6113 "mlr_dsl_parse.c"
+        break;
+      case 107:
+#line 318 "mlr_dsl_parse.y"
+{ yygotominor.yy247 = yymsp[0].minor.yy0; yygotominor.yy247->type = MD_AST_NODE_TYPE_BOOLEAN_PARAMETER_DEFINITION; }
+#line 6118 "mlr_dsl_parse.c"
+        break;
+      case 108:
+#line 319 "mlr_dsl_parse.y"
+{ yygotominor.yy247 = yymsp[0].minor.yy0; yygotominor.yy247->type = MD_AST_NODE_TYPE_MAP_PARAMETER_DEFINITION;     }
+#line 6123 "mlr_dsl_parse.c"
+        break;
+      case 109:
+#line 322 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "begin_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_BEGIN, yymsp[-1].minor.yy247);
+}
+#line 6131 "mlr_dsl_parse.c"
+        break;
+      case 110:
+#line 326 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "end_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_END, yymsp[-1].minor.yy247);
+}
+#line 6139 "mlr_dsl_parse.c"
+        break;
+      case 111:
+#line 332 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "cond_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("cond", MD_AST_NODE_TYPE_CONDITIONAL_BLOCK, yymsp[-3].minor.yy247, yymsp[-1].minor.yy247);
+}
+#line 6147 "mlr_dsl_parse.c"
+        break;
+      case 112:
+#line 342 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "while_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_WHILE, yymsp[-4].minor.yy247, yymsp[-1].minor.yy247);
+}
+#line 6155 "mlr_dsl_parse.c"
+        break;
+      case 113:
+#line 353 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-5].minor.yy247, "do_while_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-7].minor.yy0->text, MD_AST_NODE_TYPE_DO_WHILE, yymsp[-5].minor.yy247, yymsp[-1].minor.yy247);
+}
+#line 6163 "mlr_dsl_parse.c"
+        break;
+      case 114:
+#line 368 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "for_full_srec_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(
+		yymsp[-10].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_SREC,
+		mlr_dsl_ast_node_alloc_binary(
+			"variables",
+			MD_AST_NODE_TYPE_FOR_VARIABLES,
+			yymsp[-8].minor.yy247,
+			yymsp[-6].minor.yy247
+		),
+		yymsp[-1].minor.yy247
+	);
+}
+#line 6181 "mlr_dsl_parse.c"
+        break;
+      case 115:
+#line 391 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "for_full_srec_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(
+		yymsp[-8].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_SREC_KEY_ONLY,
+		mlr_dsl_ast_node_alloc_unary(
+			"variables",
+			MD_AST_NODE_TYPE_FOR_VARIABLES,
+			yymsp[-6].minor.yy247
+		),
+		yymsp[-1].minor.yy247
+	);
+}
+#line 6198 "mlr_dsl_parse.c"
+        break;
+      case 116:
+#line 414 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "for_full_oosvar_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-10].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_OOSVAR,
+		mlr_dsl_ast_node_alloc_binary(
+			"key_and_value_variables",
+			MD_AST_NODE_TYPE_FOR_VARIABLES,
+			mlr_dsl_ast_node_alloc_unary(
+				"key_variables",
+				MD_AST_NODE_TYPE_FOR_VARIABLES,
+				yymsp[-8].minor.yy247
+			),
+			yymsp[-6].minor.yy247
+		),
+		mlr_dsl_ast_node_alloc_zary("empty_keylist", MD_AST_NODE_TYPE_OOSVAR_KEYLIST),
+		yymsp[-1].minor.yy247
+	);
+}
+#line 6221 "mlr_dsl_parse.c"
+        break;
+      case 117:
+#line 444 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "for_full_oosvar_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-12].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_OOSVAR,
+		mlr_dsl_ast_node_alloc_binary(
+			"key_and_value_variables",
+			MD_AST_NODE_TYPE_FOR_VARIABLES,
+			yymsp[-9].minor.yy247,
+			yymsp[-6].minor.yy247
+		),
+		mlr_dsl_ast_node_alloc_zary("empty_keylist", MD_AST_NODE_TYPE_OOSVAR_KEYLIST),
+		yymsp[-1].minor.yy247
+	);
+}
+#line 6240 "mlr_dsl_parse.c"
+        break;
+      case 118:
+#line 470 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "for_full_oosvar_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-8].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_OOSVAR_KEY_ONLY,
+		yymsp[-6].minor.yy247,
+		mlr_dsl_ast_node_alloc_zary("empty_keylist", MD_AST_NODE_TYPE_OOSVAR_KEYLIST),
+		yymsp[-1].minor.yy247
+	);
+}
+#line 6254 "mlr_dsl_parse.c"
+        break;
+      case 119:
+#line 490 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "for_loop_oosvar_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-10].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_OOSVAR,
+		mlr_dsl_ast_node_alloc_binary(
+			"key_and_value_variables",
+			MD_AST_NODE_TYPE_FOR_VARIABLES,
+			mlr_dsl_ast_node_alloc_unary(
+				"key_variables",
+				MD_AST_NODE_TYPE_FOR_VARIABLES,
+				yymsp[-8].minor.yy247
+			),
+			yymsp[-6].minor.yy247
+		),
+		yymsp[-4].minor.yy247,
+		yymsp[-1].minor.yy247
+	);
+}
+#line 6277 "mlr_dsl_parse.c"
+        break;
+      case 120:
+#line 520 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "for_loop_oosvar_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-12].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_OOSVAR,
+		mlr_dsl_ast_node_alloc_binary(
+			"key_and_value_variables",
+			MD_AST_NODE_TYPE_FOR_VARIABLES,
+			yymsp[-9].minor.yy247,
+			yymsp[-6].minor.yy247
+		),
+		yymsp[-4].minor.yy247,
+		yymsp[-1].minor.yy247
+	);
+}
+#line 6296 "mlr_dsl_parse.c"
+        break;
+      case 121:
+#line 536 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_UNTYPED_LOCAL_DEFINITION);
+}
+#line 6303 "mlr_dsl_parse.c"
+        break;
+      case 122:
+#line 539 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_NUMERIC_LOCAL_DEFINITION);
+}
+#line 6310 "mlr_dsl_parse.c"
+        break;
+      case 123:
+#line 542 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_INT_LOCAL_DEFINITION);
+}
+#line 6317 "mlr_dsl_parse.c"
+        break;
+      case 124:
+#line 545 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_FLOAT_LOCAL_DEFINITION);
+}
+#line 6324 "mlr_dsl_parse.c"
+        break;
+      case 125:
+#line 548 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_STRING_LOCAL_DEFINITION);
+}
+#line 6331 "mlr_dsl_parse.c"
+        break;
+      case 126:
+#line 551 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_BOOLEAN_LOCAL_DEFINITION);
+}
+#line 6338 "mlr_dsl_parse.c"
+        break;
+      case 127:
+#line 555 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("key_variables", MD_AST_NODE_TYPE_FOR_VARIABLES, yymsp[0].minor.yy247);
+}
+#line 6345 "mlr_dsl_parse.c"
+        break;
+      case 128:
+      case 307:
+      case 308:
+      case 317:
+      case 318:
+      case 319:
+      case 332:
+      case 350:
+      case 360:
+      case 362:
+      case 372:
+      case 374:
+#line 558 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_append_arg(yymsp[-2].minor.yy247, yymsp[0].minor.yy247);
+}
+#line 6363 "mlr_dsl_parse.c"
+        break;
+      case 129:
+#line 571 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "for_loop_oosvar_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-8].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_OOSVAR_KEY_ONLY,
+		yymsp[-6].minor.yy247,
+		yymsp[-4].minor.yy247,
+		yymsp[-1].minor.yy247
+	);
+}
+#line 6377 "mlr_dsl_parse.c"
+        break;
+      case 130:
+#line 592 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "for_loop_local_map_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-10].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_LOCAL_MAP,
+		mlr_dsl_ast_node_alloc_binary(
+			"key_and_value_variables",
+			MD_AST_NODE_TYPE_FOR_VARIABLES,
+			mlr_dsl_ast_node_alloc_unary(
+				"key_variables",
+				MD_AST_NODE_TYPE_FOR_VARIABLES,
+				yymsp[-8].minor.yy247
+			),
+			yymsp[-6].minor.yy247
+		),
+		yymsp[-4].minor.yy247,
+		yymsp[-1].minor.yy247
+	);
+}
+#line 6400 "mlr_dsl_parse.c"
+        break;
+      case 131:
+#line 622 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "for_loop_local_map_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-12].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_LOCAL_MAP,
+		mlr_dsl_ast_node_alloc_binary(
+			"key_and_value_variables",
+			MD_AST_NODE_TYPE_FOR_VARIABLES,
+			yymsp[-9].minor.yy247,
+			yymsp[-6].minor.yy247
+		),
+		yymsp[-4].minor.yy247,
+		yymsp[-1].minor.yy247
+	);
+}
+#line 6419 "mlr_dsl_parse.c"
+        break;
+      case 132:
+#line 647 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "for_loop_local_map_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-8].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_LOCAL_MAP_KEY_ONLY,
+		yymsp[-6].minor.yy247,
+		yymsp[-4].minor.yy247,
+		yymsp[-1].minor.yy247
+	);
+}
+#line 6433 "mlr_dsl_parse.c"
+        break;
+      case 133:
+#line 668 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "for_loop_map_literal_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-10].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_MAP_LITERAL,
+		mlr_dsl_ast_node_alloc_binary(
+			"key_and_value_variables",
+			MD_AST_NODE_TYPE_FOR_VARIABLES,
+			mlr_dsl_ast_node_alloc_unary(
+				"key_variables",
+				MD_AST_NODE_TYPE_FOR_VARIABLES,
+				yymsp[-8].minor.yy247
+			),
+			yymsp[-6].minor.yy247
+		),
+		yymsp[-4].minor.yy247,
+		yymsp[-1].minor.yy247
+	);
+}
+#line 6456 "mlr_dsl_parse.c"
+        break;
+      case 134:
+#line 698 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "for_loop_map_literal_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-12].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_MAP_LITERAL,
+		mlr_dsl_ast_node_alloc_binary(
+			"key_and_value_variables",
+			MD_AST_NODE_TYPE_FOR_VARIABLES,
+			yymsp[-9].minor.yy247,
+			yymsp[-6].minor.yy247
+		),
+		yymsp[-4].minor.yy247,
+		yymsp[-1].minor.yy247
+	);
+}
+#line 6475 "mlr_dsl_parse.c"
+        break;
+      case 135:
+#line 723 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "for_loop_map_literal_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-8].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_MAP_LITERAL_KEY_ONLY,
+		yymsp[-6].minor.yy247,
+		yymsp[-4].minor.yy247,
+		yymsp[-1].minor.yy247
+	);
+}
+#line 6489 "mlr_dsl_parse.c"
+        break;
+      case 136:
+#line 744 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "for_loop_func_retval_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-10].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_FUNC_RETVAL,
+		mlr_dsl_ast_node_alloc_binary(
+			"key_and_value_variables",
+			MD_AST_NODE_TYPE_FOR_VARIABLES,
+			mlr_dsl_ast_node_alloc_unary(
+				"key_variables",
+				MD_AST_NODE_TYPE_FOR_VARIABLES,
+				yymsp[-8].minor.yy247
+			),
+			yymsp[-6].minor.yy247
+		),
+		yymsp[-4].minor.yy247,
+		yymsp[-1].minor.yy247
+	);
+}
+#line 6512 "mlr_dsl_parse.c"
+        break;
+      case 137:
+#line 774 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "for_loop_func_retval_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-12].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_FUNC_RETVAL,
+		mlr_dsl_ast_node_alloc_binary(
+			"key_and_value_variables",
+			MD_AST_NODE_TYPE_FOR_VARIABLES,
+			yymsp[-9].minor.yy247,
+			yymsp[-6].minor.yy247
+		),
+		yymsp[-4].minor.yy247,
+		yymsp[-1].minor.yy247
+	);
+}
+#line 6531 "mlr_dsl_parse.c"
+        break;
+      case 138:
+#line 799 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "for_loop_func_retval_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-8].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_FUNC_RETVAL_KEY_ONLY,
+		yymsp[-6].minor.yy247,
+		yymsp[-4].minor.yy247,
+		yymsp[-1].minor.yy247
+	);
+}
+#line 6545 "mlr_dsl_parse.c"
+        break;
+      case 139:
+#line 822 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "triple_for_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_quaternary(yymsp[-10].minor.yy0->text, MD_AST_NODE_TYPE_TRIPLE_FOR, yymsp[-8].minor.yy247, yymsp[-6].minor.yy247, yymsp[-4].minor.yy247, yymsp[-1].minor.yy247);
+}
+#line 6553 "mlr_dsl_parse.c"
+        break;
+      case 140:
+#line 827 "mlr_dsl_parse.y"
+{
+	if (yymsp[0].minor.yy247->type == MD_AST_NODE_TYPE_NOP) {
+		mlr_dsl_ast_node_free(yymsp[0].minor.yy247);
+		yygotominor.yy247 = mlr_dsl_ast_node_alloc_zary("triple_for_start_statements", MD_AST_NODE_TYPE_STATEMENT_LIST);
+	} else {
+		yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("triple_for_start_statements", MD_AST_NODE_TYPE_STATEMENT_LIST, yymsp[0].minor.yy247);
+	}
+}
+#line 6565 "mlr_dsl_parse.c"
+        break;
+      case 141:
+      case 143:
+      case 145:
+#line 835 "mlr_dsl_parse.y"
+{
+	if (yymsp[-2].minor.yy247->type == MD_AST_NODE_TYPE_NOP) {
+		mlr_dsl_ast_node_free(yymsp[-2].minor.yy247);
+		yygotominor.yy247 = yymsp[0].minor.yy247;
+	} else {
+		yygotominor.yy247 = mlr_dsl_ast_node_append_arg(yymsp[-2].minor.yy247, yymsp[0].minor.yy247);
+	}
+}
+#line 6579 "mlr_dsl_parse.c"
+        break;
+      case 142:
+#line 844 "mlr_dsl_parse.y"
+{
+	if (yymsp[0].minor.yy247->type == MD_AST_NODE_TYPE_NOP) {
+		mlr_dsl_ast_node_free(yymsp[0].minor.yy247);
+		yygotominor.yy247 = mlr_dsl_ast_node_alloc_zary("triple_for_continuation_statements", MD_AST_NODE_TYPE_STATEMENT_LIST);
+	} else {
+		yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("triple_for_continuation_statements", MD_AST_NODE_TYPE_STATEMENT_LIST, yymsp[0].minor.yy247);
+	}
+}
+#line 6591 "mlr_dsl_parse.c"
+        break;
+      case 144:
+#line 861 "mlr_dsl_parse.y"
+{
+	if (yymsp[0].minor.yy247->type == MD_AST_NODE_TYPE_NOP) {
+		mlr_dsl_ast_node_free(yymsp[0].minor.yy247);
+		yygotominor.yy247 = mlr_dsl_ast_node_alloc_zary("triple_for_update_statements", MD_AST_NODE_TYPE_STATEMENT_LIST);
+	} else {
+		yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("triple_for_update_statements", MD_AST_NODE_TYPE_STATEMENT_LIST, yymsp[0].minor.yy247);
+	}
+}
+#line 6603 "mlr_dsl_parse.c"
+        break;
+      case 147:
+      case 149:
+#line 886 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_append_arg(yymsp[-1].minor.yy247, yymsp[0].minor.yy247);
+}
+#line 6611 "mlr_dsl_parse.c"
+        break;
+      case 148:
+#line 889 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("if_head", MD_AST_NODE_TYPE_IF_HEAD, yymsp[0].minor.yy247);
+}
+#line 6618 "mlr_dsl_parse.c"
+        break;
+      case 150:
+#line 900 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "if_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_IF_ITEM, yymsp[-4].minor.yy247, yymsp[-1].minor.yy247);
+}
+#line 6626 "mlr_dsl_parse.c"
+        break;
+      case 151:
+#line 909 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "elif_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_IF_ITEM, yymsp[-4].minor.yy247, yymsp[-1].minor.yy247);
+}
+#line 6634 "mlr_dsl_parse.c"
+        break;
+      case 152:
+#line 917 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy247, "else_block");
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_IF_ITEM, yymsp[-1].minor.yy247);
+}
+#line 6642 "mlr_dsl_parse.c"
+        break;
+      case 154:
+#line 928 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_FILTER, yymsp[0].minor.yy247);
+}
+#line 6649 "mlr_dsl_parse.c"
+        break;
+      case 155:
+#line 933 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_UNTYPED_LOCAL_DEFINITION, yymsp[-2].minor.yy247, yymsp[0].minor.yy247);
+}
+#line 6656 "mlr_dsl_parse.c"
+        break;
+      case 156:
+      case 157:
+#line 936 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_UNTYPED_LOCAL_DEFINITION, yymsp[-2].minor.yy247, yymsp[0].minor.yy0);
+}
+#line 6664 "mlr_dsl_parse.c"
+        break;
+      case 158:
+      case 164:
+      case 167:
+#line 942 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_MAP_LOCAL_DEFINITION, yymsp[-2].minor.yy247, yymsp[0].minor.yy247);
+}
+#line 6673 "mlr_dsl_parse.c"
+        break;
+      case 159:
+#line 946 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_NUMERIC_LOCAL_DEFINITION, yymsp[-2].minor.yy247, yymsp[0].minor.yy247);
+}
+#line 6680 "mlr_dsl_parse.c"
+        break;
+      case 160:
+#line 949 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_INT_LOCAL_DEFINITION, yymsp[-2].minor.yy247, yymsp[0].minor.yy247);
+}
+#line 6687 "mlr_dsl_parse.c"
+        break;
+      case 161:
+#line 952 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_FLOAT_LOCAL_DEFINITION, yymsp[-2].minor.yy247, yymsp[0].minor.yy247);
+}
+#line 6694 "mlr_dsl_parse.c"
+        break;
+      case 162:
+#line 955 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_BOOLEAN_LOCAL_DEFINITION, yymsp[-2].minor.yy247, yymsp[0].minor.yy247);
+}
+#line 6701 "mlr_dsl_parse.c"
+        break;
+      case 163:
+#line 958 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_STRING_LOCAL_DEFINITION, yymsp[-2].minor.yy247, yymsp[0].minor.yy247);
+}
+#line 6708 "mlr_dsl_parse.c"
+        break;
+      case 165:
+      case 166:
+#line 965 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_MAP_LOCAL_DEFINITION, yymsp[-2].minor.yy247, yymsp[0].minor.yy0);
+}
+#line 6716 "mlr_dsl_parse.c"
+        break;
+      case 168:
+      case 170:
+#line 975 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247, yymsp[0].minor.yy247);
+}
+#line 6724 "mlr_dsl_parse.c"
+        break;
+      case 169:
+      case 171:
+#line 978 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247, yymsp[0].minor.yy247);
+}
+#line 6732 "mlr_dsl_parse.c"
+        break;
+      case 172:
+      case 174:
+#line 989 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247, yymsp[0].minor.yy0);
+}
+#line 6740 "mlr_dsl_parse.c"
+        break;
+      case 173:
+      case 175:
+#line 992 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247, yymsp[0].minor.yy0);
+}
+#line 6748 "mlr_dsl_parse.c"
+        break;
+      case 176:
+#line 1004 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247, yymsp[0].minor.yy247);
+}
+#line 6755 "mlr_dsl_parse.c"
+        break;
+      case 177:
+#line 1010 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_INDIRECT_SREC_ASSIGNMENT, yymsp[-3].minor.yy247, yymsp[0].minor.yy247);
+}
+#line 6762 "mlr_dsl_parse.c"
+        break;
+      case 178:
+      case 179:
+#line 1014 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247, yymsp[0].minor.yy247);
+}
+#line 6770 "mlr_dsl_parse.c"
+        break;
+      case 180:
+#line 1022 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247, yymsp[0].minor.yy0);
+}
+#line 6777 "mlr_dsl_parse.c"
+        break;
+      case 181:
+      case 182:
+#line 1026 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_FULL_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy0, yymsp[0].minor.yy247);
+}
+#line 6785 "mlr_dsl_parse.c"
+        break;
+      case 183:
+#line 1034 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_FULL_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy0, yymsp[0].minor.yy0);
+}
+#line 6792 "mlr_dsl_parse.c"
+        break;
+      case 184:
+#line 1038 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_FULL_OOSVAR_FROM_FULL_SREC_ASSIGNMENT, yymsp[-2].minor.yy0, yymsp[0].minor.yy0);
+}
+#line 6799 "mlr_dsl_parse.c"
+        break;
+      case 185:
+#line 1042 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_FULL_OOSVAR_FROM_FULL_SREC_ASSIGNMENT, yymsp[-2].minor.yy0, yymsp[0].minor.yy247);
+}
+#line 6806 "mlr_dsl_parse.c"
+        break;
+      case 186:
+#line 1046 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_OOSVAR_FROM_FULL_SREC_ASSIGNMENT, yymsp[-2].minor.yy247, yymsp[0].minor.yy0);
+}
+#line 6813 "mlr_dsl_parse.c"
+        break;
+      case 187:
+#line 1050 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text,
+		MD_AST_NODE_TYPE_FULL_SREC_ASSIGNMENT, yymsp[-2].minor.yy0, yymsp[0].minor.yy247);
+}
+#line 6821 "mlr_dsl_parse.c"
+        break;
+      case 188:
+#line 1054 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_FULL_SREC_ASSIGNMENT, yymsp[-2].minor.yy0, yymsp[0].minor.yy247);
+}
+#line 6828 "mlr_dsl_parse.c"
+        break;
+      case 189:
+      case 190:
+#line 1057 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_FULL_SREC_ASSIGNMENT, yymsp[-2].minor.yy0, yymsp[0].minor.yy0);
+}
+#line 6836 "mlr_dsl_parse.c"
+        break;
+      case 191:
+#line 1064 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247, yymsp[0].minor.yy247);
+}
+#line 6843 "mlr_dsl_parse.c"
+        break;
+      case 192:
+#line 1069 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("||", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 6851 "mlr_dsl_parse.c"
+        break;
+      case 193:
+#line 1073 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("^^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 6859 "mlr_dsl_parse.c"
+        break;
+      case 194:
+#line 1077 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("&&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 6867 "mlr_dsl_parse.c"
+        break;
+      case 195:
+#line 1081 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("|", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 6875 "mlr_dsl_parse.c"
+        break;
+      case 196:
+#line 1085 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 6883 "mlr_dsl_parse.c"
+        break;
+      case 197:
+#line 1089 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 6891 "mlr_dsl_parse.c"
+        break;
+      case 198:
+#line 1093 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("<<", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 6899 "mlr_dsl_parse.c"
+        break;
+      case 199:
+#line 1097 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(">>", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 6907 "mlr_dsl_parse.c"
+        break;
+      case 200:
+#line 1102 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("+", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 6915 "mlr_dsl_parse.c"
+        break;
+      case 201:
+#line 1106 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("-", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 6923 "mlr_dsl_parse.c"
+        break;
+      case 202:
+#line 1110 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 6931 "mlr_dsl_parse.c"
+        break;
+      case 203:
+#line 1114 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("*", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 6939 "mlr_dsl_parse.c"
+        break;
+      case 204:
+#line 1118 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("/", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 6947 "mlr_dsl_parse.c"
+        break;
+      case 205:
+#line 1122 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("//", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 6955 "mlr_dsl_parse.c"
+        break;
+      case 206:
+#line 1127 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".+", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 6963 "mlr_dsl_parse.c"
+        break;
+      case 207:
+#line 1131 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".-", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 6971 "mlr_dsl_parse.c"
+        break;
+      case 208:
+#line 1135 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".*", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 6979 "mlr_dsl_parse.c"
+        break;
+      case 209:
+#line 1139 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("./", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 6987 "mlr_dsl_parse.c"
+        break;
+      case 210:
+#line 1143 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".//", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 6995 "mlr_dsl_parse.c"
+        break;
+      case 211:
+#line 1148 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("%", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7003 "mlr_dsl_parse.c"
+        break;
+      case 212:
+#line 1152 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("**", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7011 "mlr_dsl_parse.c"
+        break;
+      case 213:
+#line 1158 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("||", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7019 "mlr_dsl_parse.c"
+        break;
+      case 214:
+#line 1162 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("^^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7027 "mlr_dsl_parse.c"
+        break;
+      case 215:
+#line 1166 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("&&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7035 "mlr_dsl_parse.c"
+        break;
+      case 216:
+#line 1170 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("|", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7043 "mlr_dsl_parse.c"
+        break;
+      case 217:
+#line 1174 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7051 "mlr_dsl_parse.c"
+        break;
+      case 218:
+#line 1178 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7059 "mlr_dsl_parse.c"
+        break;
+      case 219:
+#line 1182 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("<<", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7067 "mlr_dsl_parse.c"
+        break;
+      case 220:
+#line 1186 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(">>", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7075 "mlr_dsl_parse.c"
+        break;
+      case 221:
+#line 1191 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("+", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7083 "mlr_dsl_parse.c"
+        break;
+      case 222:
+#line 1195 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("-", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7091 "mlr_dsl_parse.c"
+        break;
+      case 223:
+#line 1199 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7099 "mlr_dsl_parse.c"
+        break;
+      case 224:
+#line 1203 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("*", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7107 "mlr_dsl_parse.c"
+        break;
+      case 225:
+#line 1207 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("/", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7115 "mlr_dsl_parse.c"
+        break;
+      case 226:
+#line 1211 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("//", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7123 "mlr_dsl_parse.c"
+        break;
+      case 227:
+#line 1215 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("%", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7131 "mlr_dsl_parse.c"
+        break;
+      case 228:
+#line 1219 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("**", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7139 "mlr_dsl_parse.c"
+        break;
+      case 229:
+#line 1224 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".+", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7147 "mlr_dsl_parse.c"
+        break;
+      case 230:
+#line 1228 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".-", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7155 "mlr_dsl_parse.c"
+        break;
+      case 231:
+#line 1232 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".*", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7163 "mlr_dsl_parse.c"
+        break;
+      case 232:
+#line 1236 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("./", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7171 "mlr_dsl_parse.c"
+        break;
+      case 233:
+#line 1240 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".//", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7179 "mlr_dsl_parse.c"
+        break;
+      case 234:
+#line 1245 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("||", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7187 "mlr_dsl_parse.c"
+        break;
+      case 235:
+#line 1249 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("^^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7195 "mlr_dsl_parse.c"
+        break;
+      case 236:
+#line 1253 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("&&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7203 "mlr_dsl_parse.c"
+        break;
+      case 237:
+#line 1257 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("|", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7211 "mlr_dsl_parse.c"
+        break;
+      case 238:
+#line 1261 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7219 "mlr_dsl_parse.c"
+        break;
+      case 239:
+#line 1265 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7227 "mlr_dsl_parse.c"
+        break;
+      case 240:
+#line 1269 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("<<", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7235 "mlr_dsl_parse.c"
+        break;
+      case 241:
+#line 1273 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(">>", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7243 "mlr_dsl_parse.c"
+        break;
+      case 242:
+#line 1278 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("+", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7251 "mlr_dsl_parse.c"
+        break;
+      case 243:
+#line 1282 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("-", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7259 "mlr_dsl_parse.c"
+        break;
+      case 244:
+#line 1286 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7267 "mlr_dsl_parse.c"
+        break;
+      case 245:
+#line 1290 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("*", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7275 "mlr_dsl_parse.c"
+        break;
+      case 246:
+#line 1294 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("/", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7283 "mlr_dsl_parse.c"
+        break;
+      case 247:
+#line 1298 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("//", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7291 "mlr_dsl_parse.c"
+        break;
+      case 248:
+#line 1302 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("%", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7299 "mlr_dsl_parse.c"
+        break;
+      case 249:
+#line 1306 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("**", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7307 "mlr_dsl_parse.c"
+        break;
+      case 250:
+#line 1311 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".+", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7315 "mlr_dsl_parse.c"
+        break;
+      case 251:
+#line 1315 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".-", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7323 "mlr_dsl_parse.c"
+        break;
+      case 252:
+#line 1319 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".*", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7331 "mlr_dsl_parse.c"
+        break;
+      case 253:
+#line 1323 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("./", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7339 "mlr_dsl_parse.c"
+        break;
+      case 254:
+#line 1327 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".//", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7347 "mlr_dsl_parse.c"
+        break;
+      case 255:
+#line 1332 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("||", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7355 "mlr_dsl_parse.c"
+        break;
+      case 256:
+#line 1336 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("^^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7363 "mlr_dsl_parse.c"
+        break;
+      case 257:
+#line 1340 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("&&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7371 "mlr_dsl_parse.c"
+        break;
+      case 258:
+#line 1344 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("|", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7379 "mlr_dsl_parse.c"
+        break;
+      case 259:
+#line 1348 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7387 "mlr_dsl_parse.c"
+        break;
+      case 260:
+#line 1352 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7395 "mlr_dsl_parse.c"
+        break;
+      case 261:
+#line 1356 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("<<", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7403 "mlr_dsl_parse.c"
+        break;
+      case 262:
+#line 1360 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(">>", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7411 "mlr_dsl_parse.c"
+        break;
+      case 263:
+#line 1365 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("+", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7419 "mlr_dsl_parse.c"
+        break;
+      case 264:
+#line 1369 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("-", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7427 "mlr_dsl_parse.c"
+        break;
+      case 265:
+#line 1373 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7435 "mlr_dsl_parse.c"
+        break;
+      case 266:
+#line 1377 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("*", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7443 "mlr_dsl_parse.c"
+        break;
+      case 267:
+#line 1381 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("/", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7451 "mlr_dsl_parse.c"
+        break;
+      case 268:
+#line 1385 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("//", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7459 "mlr_dsl_parse.c"
+        break;
+      case 269:
+#line 1389 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("%", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7467 "mlr_dsl_parse.c"
+        break;
+      case 270:
+#line 1393 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("**", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7475 "mlr_dsl_parse.c"
+        break;
+      case 271:
+#line 1398 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".+", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7483 "mlr_dsl_parse.c"
+        break;
+      case 272:
+#line 1402 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".-", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7491 "mlr_dsl_parse.c"
+        break;
+      case 273:
+#line 1406 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".*", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7499 "mlr_dsl_parse.c"
+        break;
+      case 274:
+#line 1410 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("./", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7507 "mlr_dsl_parse.c"
+        break;
+      case 275:
+#line 1414 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".//", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7515 "mlr_dsl_parse.c"
+        break;
+      case 276:
+#line 1420 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("||", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7523 "mlr_dsl_parse.c"
+        break;
+      case 277:
+#line 1424 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("^^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7531 "mlr_dsl_parse.c"
+        break;
+      case 278:
+#line 1428 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("&&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7539 "mlr_dsl_parse.c"
+        break;
+      case 279:
+#line 1432 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("|", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7547 "mlr_dsl_parse.c"
+        break;
+      case 280:
+#line 1436 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7555 "mlr_dsl_parse.c"
+        break;
+      case 281:
+#line 1440 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7563 "mlr_dsl_parse.c"
+        break;
+      case 282:
+#line 1444 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("<<", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7571 "mlr_dsl_parse.c"
+        break;
+      case 283:
+#line 1448 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(">>", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7579 "mlr_dsl_parse.c"
+        break;
+      case 284:
+#line 1452 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("+", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7587 "mlr_dsl_parse.c"
+        break;
+      case 285:
+#line 1456 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("-", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7595 "mlr_dsl_parse.c"
+        break;
+      case 286:
+#line 1460 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7603 "mlr_dsl_parse.c"
+        break;
+      case 287:
+#line 1465 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("*", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7611 "mlr_dsl_parse.c"
+        break;
+      case 288:
+#line 1469 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("/", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7619 "mlr_dsl_parse.c"
+        break;
+      case 289:
+#line 1473 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("//", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7627 "mlr_dsl_parse.c"
+        break;
+      case 290:
+#line 1477 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("%", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7635 "mlr_dsl_parse.c"
+        break;
+      case 291:
+#line 1481 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("**", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7643 "mlr_dsl_parse.c"
+        break;
+      case 292:
+#line 1486 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".*", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7651 "mlr_dsl_parse.c"
+        break;
+      case 293:
+#line 1490 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary("./", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7659 "mlr_dsl_parse.c"
+        break;
+      case 294:
+#line 1494 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".//", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7667 "mlr_dsl_parse.c"
+        break;
+      case 295:
+#line 1498 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".%", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7675 "mlr_dsl_parse.c"
+        break;
+      case 296:
+#line 1502 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy247,
+		mlr_dsl_ast_node_alloc_binary(".**", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy247) , yymsp[0].minor.yy247));
+}
+#line 7683 "mlr_dsl_parse.c"
+        break;
+      case 297:
+      case 298:
+#line 1508 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_UNSET, yymsp[0].minor.yy0);
+}
+#line 7691 "mlr_dsl_parse.c"
+        break;
+      case 299:
+#line 1514 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_set_function_name(yymsp[0].minor.yy247, yymsp[-1].minor.yy0->text);
+}
+#line 7698 "mlr_dsl_parse.c"
+        break;
+      case 300:
+#line 1518 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_zary("temp", MD_AST_NODE_TYPE_UNSET);
+}
+#line 7705 "mlr_dsl_parse.c"
+        break;
+      case 301:
+      case 302:
+      case 304:
+      case 305:
+      case 306:
+#line 1522 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("temp", MD_AST_NODE_TYPE_UNSET, yymsp[0].minor.yy247);
+}
+#line 7716 "mlr_dsl_parse.c"
+        break;
+      case 303:
+#line 1528 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("temp", MD_AST_NODE_TYPE_UNSET, yymsp[0].minor.yy0);
+}
+#line 7723 "mlr_dsl_parse.c"
+        break;
+      case 309:
+#line 1549 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_TEE,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE, yymsp[-2].minor.yy247),
+		yymsp[0].minor.yy0);
+}
+#line 7732 "mlr_dsl_parse.c"
+        break;
+      case 310:
+#line 1555 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_TEE,
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND, yymsp[-2].minor.yy247),
+		yymsp[0].minor.yy0);
+}
+#line 7741 "mlr_dsl_parse.c"
+        break;
+      case 311:
+#line 1561 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_TEE,
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE, yymsp[-2].minor.yy247),
+		yymsp[0].minor.yy0);
+}
+#line 7750 "mlr_dsl_parse.c"
+        break;
+      case 312:
+#line 1575 "mlr_dsl_parse.y"
+{
+	yymsp[0].minor.yy247 = mlr_dsl_ast_node_set_function_name(yymsp[0].minor.yy247, yymsp[-1].minor.yy0->text);
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_EMITF, yymsp[0].minor.yy247,
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 7759 "mlr_dsl_parse.c"
+        break;
+      case 313:
+#line 1581 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_zary("temp", MD_AST_NODE_TYPE_EMITF);
+}
+#line 7766 "mlr_dsl_parse.c"
+        break;
+      case 314:
+      case 315:
+      case 316:
+#line 1584 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("temp", MD_AST_NODE_TYPE_EMITF, yymsp[0].minor.yy247);
+}
+#line 7775 "mlr_dsl_parse.c"
+        break;
+      case 320:
+#line 1603 "mlr_dsl_parse.y"
+{
+	yymsp[0].minor.yy247 = mlr_dsl_ast_node_set_function_name(yymsp[0].minor.yy247, yymsp[-4].minor.yy0->text);
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITF, yymsp[0].minor.yy247,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE, yymsp[-2].minor.yy247));
+}
+#line 7784 "mlr_dsl_parse.c"
+        break;
+      case 321:
+#line 1609 "mlr_dsl_parse.y"
+{
+	yymsp[0].minor.yy247 = mlr_dsl_ast_node_set_function_name(yymsp[0].minor.yy247, yymsp[-4].minor.yy0->text);
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITF, yymsp[0].minor.yy247,
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND, yymsp[-2].minor.yy247));
+}
+#line 7793 "mlr_dsl_parse.c"
+        break;
+      case 322:
+#line 1615 "mlr_dsl_parse.y"
+{
+	yymsp[0].minor.yy247 = mlr_dsl_ast_node_set_function_name(yymsp[0].minor.yy247, yymsp[-4].minor.yy0->text);
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITF, yymsp[0].minor.yy247,
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE, yymsp[-2].minor.yy247));
+}
+#line 7802 "mlr_dsl_parse.c"
+        break;
+      case 323:
+#line 1623 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 7811 "mlr_dsl_parse.c"
+        break;
+      case 324:
+#line 1629 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[-2].minor.yy247, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 7820 "mlr_dsl_parse.c"
+        break;
+      case 325:
+#line 1637 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+		yymsp[-2].minor.yy247));
+}
+#line 7830 "mlr_dsl_parse.c"
+        break;
+      case 326:
+#line 1645 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[-2].minor.yy247, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+		yymsp[-4].minor.yy247));
+}
+#line 7840 "mlr_dsl_parse.c"
+        break;
+      case 327:
+#line 1654 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+		yymsp[-2].minor.yy247));
+}
+#line 7850 "mlr_dsl_parse.c"
+        break;
+      case 328:
+#line 1662 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[-2].minor.yy247, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+		yymsp[-4].minor.yy247));
+}
+#line 7860 "mlr_dsl_parse.c"
+        break;
+      case 329:
+#line 1671 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+		yymsp[-2].minor.yy247));
+}
+#line 7870 "mlr_dsl_parse.c"
+        break;
+      case 330:
+#line 1679 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[-2].minor.yy247, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+		yymsp[-4].minor.yy247));
+}
+#line 7880 "mlr_dsl_parse.c"
+        break;
+      case 331:
+#line 1687 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("emitp_namelist", MD_AST_NODE_TYPE_EMITP, yymsp[0].minor.yy247);
+}
+#line 7887 "mlr_dsl_parse.c"
+        break;
+      case 333:
+#line 1695 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 7896 "mlr_dsl_parse.c"
+        break;
+      case 334:
+#line 1701 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[-2].minor.yy247, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 7905 "mlr_dsl_parse.c"
+        break;
+      case 335:
+#line 1710 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+		yymsp[-2].minor.yy247));
+}
+#line 7915 "mlr_dsl_parse.c"
+        break;
+      case 336:
+#line 1718 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[-2].minor.yy247, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+		yymsp[-4].minor.yy247));
+}
+#line 7925 "mlr_dsl_parse.c"
+        break;
+      case 337:
+#line 1727 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+		yymsp[-2].minor.yy247));
+}
+#line 7935 "mlr_dsl_parse.c"
+        break;
+      case 338:
+#line 1735 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[-2].minor.yy247, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+		yymsp[-4].minor.yy247));
+}
+#line 7945 "mlr_dsl_parse.c"
+        break;
+      case 339:
+#line 1744 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+		yymsp[-2].minor.yy247));
+}
+#line 7955 "mlr_dsl_parse.c"
+        break;
+      case 340:
+#line 1752 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[-2].minor.yy247, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+		yymsp[-4].minor.yy247));
+}
+#line 7965 "mlr_dsl_parse.c"
+        break;
+      case 341:
+      case 342:
+      case 346:
+      case 385:
+      case 386:
+      case 387:
+      case 477:
+      case 478:
+      case 479:
+      case 489:
+      case 503:
+      case 504:
+#line 1760 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = yymsp[0].minor.yy0;
+}
+#line 7983 "mlr_dsl_parse.c"
+        break;
+      case 349:
+#line 1786 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("emit_namelist", MD_AST_NODE_TYPE_EMIT, yymsp[0].minor.yy247);
+}
+#line 7990 "mlr_dsl_parse.c"
+        break;
+      case 351:
+#line 1796 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[-1].minor.yy247),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 7999 "mlr_dsl_parse.c"
+        break;
+      case 352:
+#line 1804 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-5].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-5].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[-3].minor.yy247, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 8008 "mlr_dsl_parse.c"
+        break;
+      case 353:
+#line 1812 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[-1].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE, yymsp[-4].minor.yy247));
+}
+#line 8017 "mlr_dsl_parse.c"
+        break;
+      case 354:
+#line 1820 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[-3].minor.yy247, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE, yymsp[-6].minor.yy247));
+}
+#line 8026 "mlr_dsl_parse.c"
+        break;
+      case 355:
+#line 1828 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[-1].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND, yymsp[-4].minor.yy247));
+}
+#line 8035 "mlr_dsl_parse.c"
+        break;
+      case 356:
+#line 1836 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[-3].minor.yy247, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND, yymsp[-6].minor.yy247));
+}
+#line 8044 "mlr_dsl_parse.c"
+        break;
+      case 357:
+#line 1844 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[-1].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE, yymsp[-4].minor.yy247));
+}
+#line 8053 "mlr_dsl_parse.c"
+        break;
+      case 358:
+#line 1852 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[-3].minor.yy247, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE, yymsp[-6].minor.yy247));
+}
+#line 8062 "mlr_dsl_parse.c"
+        break;
+      case 359:
+#line 1859 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("lashed_keylists", MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[0].minor.yy247);
+}
+#line 8069 "mlr_dsl_parse.c"
+        break;
+      case 361:
+#line 1867 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("lashed_namelist", MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[0].minor.yy247);
+}
+#line 8076 "mlr_dsl_parse.c"
+        break;
+      case 363:
+#line 1877 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[-1].minor.yy247),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 8085 "mlr_dsl_parse.c"
+        break;
+      case 364:
+#line 1885 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-5].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-5].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[-3].minor.yy247, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 8094 "mlr_dsl_parse.c"
+        break;
+      case 365:
+#line 1893 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[-1].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE, yymsp[-4].minor.yy247));
+}
+#line 8103 "mlr_dsl_parse.c"
+        break;
+      case 366:
+#line 1901 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[-3].minor.yy247, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE, yymsp[-6].minor.yy247));
+}
+#line 8112 "mlr_dsl_parse.c"
+        break;
+      case 367:
+#line 1909 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[-1].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND, yymsp[-4].minor.yy247));
+}
+#line 8121 "mlr_dsl_parse.c"
+        break;
+      case 368:
+#line 1917 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[-3].minor.yy247, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND, yymsp[-6].minor.yy247));
+}
+#line 8130 "mlr_dsl_parse.c"
+        break;
+      case 369:
+#line 1925 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[-1].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE, yymsp[-4].minor.yy247));
+}
+#line 8139 "mlr_dsl_parse.c"
+        break;
+      case 370:
+#line 1933 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[-3].minor.yy247, yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE, yymsp[-6].minor.yy247));
+}
+#line 8148 "mlr_dsl_parse.c"
+        break;
+      case 371:
+#line 1940 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("lashed_keylists", MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[0].minor.yy247);
+}
+#line 8155 "mlr_dsl_parse.c"
+        break;
+      case 373:
+#line 1948 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("lashed_namelist", MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[0].minor.yy247);
+}
+#line 8162 "mlr_dsl_parse.c"
+        break;
+      case 375:
+#line 1956 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDOUT)),
+		mlr_dsl_ast_node_alloc("all", MD_AST_NODE_TYPE_FULL_OOSVAR));
+}
+#line 8172 "mlr_dsl_parse.c"
+        break;
+      case 376:
+#line 1962 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDERR)),
+		mlr_dsl_ast_node_alloc("all", MD_AST_NODE_TYPE_FULL_OOSVAR));
+}
+#line 8182 "mlr_dsl_parse.c"
+        break;
+      case 377:
+#line 1968 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-2].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc("all", MD_AST_NODE_TYPE_FULL_OOSVAR));
+}
+#line 8192 "mlr_dsl_parse.c"
+        break;
+      case 378:
+#line 1974 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-2].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+			yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc("all", MD_AST_NODE_TYPE_FULL_OOSVAR));
+}
+#line 8202 "mlr_dsl_parse.c"
+        break;
+      case 379:
+#line 1980 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-2].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+			yymsp[0].minor.yy247),
+		mlr_dsl_ast_node_alloc("all", MD_AST_NODE_TYPE_FULL_OOSVAR));
+}
+#line 8212 "mlr_dsl_parse.c"
+        break;
+      case 380:
+#line 1987 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDOUT)),
+		yymsp[0].minor.yy247);
+}
+#line 8222 "mlr_dsl_parse.c"
+        break;
+      case 381:
+#line 1993 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDERR)),
+		yymsp[0].minor.yy247);
+}
+#line 8232 "mlr_dsl_parse.c"
+        break;
+      case 382:
+#line 1999 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			yymsp[-1].minor.yy247),
+		yymsp[0].minor.yy247);
+}
+#line 8242 "mlr_dsl_parse.c"
+        break;
+      case 383:
+#line 2005 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+			yymsp[-1].minor.yy247),
+		yymsp[0].minor.yy247);
+}
+#line 8252 "mlr_dsl_parse.c"
+        break;
+      case 384:
+#line 2011 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+			yymsp[-1].minor.yy247),
+		yymsp[0].minor.yy247);
+}
+#line 8262 "mlr_dsl_parse.c"
+        break;
+      case 390:
+#line 2037 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_PRINT, yymsp[0].minor.yy247,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDOUT)));
+}
+#line 8271 "mlr_dsl_parse.c"
+        break;
+      case 391:
+#line 2042 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_PRINT, yymsp[0].minor.yy247,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDERR)));
+}
+#line 8280 "mlr_dsl_parse.c"
+        break;
+      case 392:
+#line 2047 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_PRINT, yymsp[0].minor.yy247,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			yymsp[-2].minor.yy247));
+}
+#line 8289 "mlr_dsl_parse.c"
+        break;
+      case 393:
+#line 2052 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_PRINT, yymsp[0].minor.yy247,
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+			yymsp[-2].minor.yy247));
+}
+#line 8298 "mlr_dsl_parse.c"
+        break;
+      case 394:
+#line 2057 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_PRINT, yymsp[0].minor.yy247,
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+			yymsp[-2].minor.yy247));
+}
+#line 8307 "mlr_dsl_parse.c"
+        break;
+      case 395:
+#line 2064 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_PRINT,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDOUT)));
+}
+#line 8317 "mlr_dsl_parse.c"
+        break;
+      case 396:
+#line 2070 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_PRINT,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDERR)));
+}
+#line 8327 "mlr_dsl_parse.c"
+        break;
+      case 397:
+#line 2076 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-2].minor.yy0->text, MD_AST_NODE_TYPE_PRINT,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE, yymsp[0].minor.yy247));
+}
+#line 8336 "mlr_dsl_parse.c"
+        break;
+      case 398:
+#line 2081 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-2].minor.yy0->text, MD_AST_NODE_TYPE_PRINT,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND, yymsp[0].minor.yy247));
+}
+#line 8345 "mlr_dsl_parse.c"
+        break;
+      case 399:
+#line 2086 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-2].minor.yy0->text, MD_AST_NODE_TYPE_PRINT,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE, yymsp[0].minor.yy247));
+}
+#line 8354 "mlr_dsl_parse.c"
+        break;
+      case 400:
+#line 2093 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN, yymsp[0].minor.yy247,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDOUT)));
+}
+#line 8363 "mlr_dsl_parse.c"
+        break;
+      case 401:
+#line 2098 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN, yymsp[0].minor.yy247,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDERR)));
+}
+#line 8372 "mlr_dsl_parse.c"
+        break;
+      case 402:
+#line 2103 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN, yymsp[0].minor.yy247,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			yymsp[-2].minor.yy247));
+}
+#line 8381 "mlr_dsl_parse.c"
+        break;
+      case 403:
+#line 2108 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN, yymsp[0].minor.yy247,
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+			yymsp[-2].minor.yy247));
+}
+#line 8390 "mlr_dsl_parse.c"
+        break;
+      case 404:
+#line 2113 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN, yymsp[0].minor.yy247,
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+			yymsp[-2].minor.yy247));
+}
+#line 8399 "mlr_dsl_parse.c"
+        break;
+      case 405:
+#line 2121 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDOUT)));
+}
+#line 8409 "mlr_dsl_parse.c"
+        break;
+      case 406:
+#line 2127 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDERR)));
+}
+#line 8419 "mlr_dsl_parse.c"
+        break;
+      case 407:
+#line 2133 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-2].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE, yymsp[0].minor.yy247));
+}
+#line 8428 "mlr_dsl_parse.c"
+        break;
+      case 408:
+#line 2138 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-2].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND, yymsp[0].minor.yy247));
+}
+#line 8437 "mlr_dsl_parse.c"
+        break;
+      case 409:
+#line 2143 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-2].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE, yymsp[0].minor.yy247));
+}
+#line 8446 "mlr_dsl_parse.c"
+        break;
+      case 411:
+      case 412:
+#line 2151 "mlr_dsl_parse.y"
+{ yygotominor.yy247 = yymsp[0].minor.yy0; }
+#line 8452 "mlr_dsl_parse.c"
+        break;
+      case 414:
+#line 2161 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_ternary("? :", MD_AST_NODE_TYPE_OPERATOR, yymsp[-4].minor.yy247, yymsp[-2].minor.yy247, yymsp[0].minor.yy247);
+}
+#line 8459 "mlr_dsl_parse.c"
+        break;
+      case 417:
+      case 419:
+      case 421:
+      case 423:
+      case 424:
+      case 425:
+      case 426:
+      case 428:
+      case 429:
+      case 430:
+      case 431:
+      case 433:
+      case 435:
+      case 437:
+      case 439:
+      case 440:
+      case 442:
+      case 443:
+      case 444:
+      case 445:
+      case 446:
+      case 448:
+      case 449:
+      case 450:
+      case 451:
+      case 452:
+      case 453:
+      case 454:
+      case 463:
+#line 2173 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_OPERATOR, yymsp[-2].minor.yy247, yymsp[0].minor.yy247);
+}
+#line 8494 "mlr_dsl_parse.c"
+        break;
+      case 456:
+      case 457:
+      case 458:
+      case 459:
+      case 460:
+      case 461:
+#line 2314 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_OPERATOR, yymsp[0].minor.yy247);
+}
+#line 8506 "mlr_dsl_parse.c"
+        break;
+      case 465:
+#line 2351 "mlr_dsl_parse.y"
+{
+	char* dollar_name = yymsp[0].minor.yy0->text;
+	char* no_dollar_name = &dollar_name[1];
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc(no_dollar_name, yymsp[0].minor.yy0->type);
+}
+#line 8515 "mlr_dsl_parse.c"
+        break;
+      case 466:
+#line 2356 "mlr_dsl_parse.y"
+{
+	// Replace "${field.name}" with just "field.name"
+	char* dollar_name = yymsp[0].minor.yy0->text;
+	char* no_dollar_name = &dollar_name[2];
+	int len = strlen(no_dollar_name);
+	if (len > 0)
+		no_dollar_name[len-1] = 0;
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc(no_dollar_name, yymsp[0].minor.yy0->type);
+}
+#line 8528 "mlr_dsl_parse.c"
+        break;
+      case 468:
+#line 2369 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("indirect_field_name", MD_AST_NODE_TYPE_INDIRECT_FIELD_NAME, yymsp[-1].minor.yy247);
+}
+#line 8535 "mlr_dsl_parse.c"
+        break;
+      case 471:
+      case 476:
+      case 486:
+#line 2381 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_append_arg(yymsp[-3].minor.yy247, yymsp[-1].minor.yy247);
+}
+#line 8544 "mlr_dsl_parse.c"
+        break;
+      case 472:
+#line 2386 "mlr_dsl_parse.y"
+{
+	char* at_name = yymsp[0].minor.yy0->text;
+	char* no_at_name = &at_name[1];
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("oosvar_keylist", MD_AST_NODE_TYPE_OOSVAR_KEYLIST,
+		mlr_dsl_ast_node_alloc(no_at_name, yymsp[0].minor.yy0->type));
+}
+#line 8554 "mlr_dsl_parse.c"
+        break;
+      case 473:
+#line 2394 "mlr_dsl_parse.y"
+{
+	// Replace "@%{field.name}" with just "field.name"
+	char* at_name = yymsp[0].minor.yy0->text;
+	char* no_at_name = &at_name[2];
+	int len = strlen(no_at_name);
+	if (len > 0)
+		no_at_name[len-1] = 0;
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("oosvar_keylist", MD_AST_NODE_TYPE_OOSVAR_KEYLIST,
+		mlr_dsl_ast_node_alloc(no_at_name, yymsp[0].minor.yy0->type));
+}
+#line 8568 "mlr_dsl_parse.c"
+        break;
+      case 474:
+#line 2406 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("oosvar_keylist", MD_AST_NODE_TYPE_OOSVAR_KEYLIST, yymsp[-1].minor.yy247);
+}
+#line 8575 "mlr_dsl_parse.c"
+        break;
+      case 484:
+#line 2442 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_NONINDEXED_LOCAL_VARIABLE);
+}
+#line 8582 "mlr_dsl_parse.c"
+        break;
+      case 485:
+#line 2445 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary(yymsp[-3].minor.yy247->text, MD_AST_NODE_TYPE_INDEXED_LOCAL_VARIABLE, yymsp[-1].minor.yy247);
+	mlr_dsl_ast_node_free(yymsp[-3].minor.yy247);
+}
+#line 8590 "mlr_dsl_parse.c"
+        break;
+      case 487:
+#line 2453 "mlr_dsl_parse.y"
+{
+	char* input = yymsp[0].minor.yy0->text;
+	char* stripped = &input[1];
+	int len = strlen(input);
+	stripped[len-2] = 0;
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc(mlr_alloc_unbackslash(stripped), yymsp[0].minor.yy0->type);
+}
+#line 8601 "mlr_dsl_parse.c"
+        break;
+      case 488:
+#line 2460 "mlr_dsl_parse.y"
+{
+	char* input = yymsp[0].minor.yy0->text;
+	char* stripped = &input[1];
+	int len = strlen(input);
+	stripped[len-3] = 0;
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc(mlr_alloc_unbackslash(stripped), yymsp[0].minor.yy0->type);
+}
+#line 8612 "mlr_dsl_parse.c"
+        break;
+      case 491:
+#line 2475 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("env", MD_AST_NODE_TYPE_ENV, yymsp[-3].minor.yy0, yymsp[-1].minor.yy247);
+}
+#line 8619 "mlr_dsl_parse.c"
+        break;
+      case 492:
+      case 507:
+#line 2479 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = yymsp[-1].minor.yy247;
+}
+#line 8627 "mlr_dsl_parse.c"
+        break;
+      case 494:
+      case 495:
+      case 496:
+#line 2494 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_set_function_name(yymsp[-1].minor.yy247, yymsp[-3].minor.yy0->text);
+	yygotominor.yy247->type = MD_AST_NODE_TYPE_FUNCTION_CALLSITE;
+}
+#line 8637 "mlr_dsl_parse.c"
+        break;
+      case 506:
+#line 2543 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_zary("map_literal", MD_AST_NODE_TYPE_MAP_LITERAL);
+}
+#line 8644 "mlr_dsl_parse.c"
+        break;
+      case 508:
+#line 2549 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("map_literal", MD_AST_NODE_TYPE_MAP_LITERAL, yymsp[0].minor.yy247);
+}
+#line 8651 "mlr_dsl_parse.c"
+        break;
+      case 509:
+#line 2553 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("map_literal", MD_AST_NODE_TYPE_MAP_LITERAL, yymsp[-1].minor.yy247);
+}
+#line 8658 "mlr_dsl_parse.c"
+        break;
+      case 511:
+#line 2560 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_binary("mappair", MD_AST_NODE_TYPE_MAP_LITERAL_PAIR, yymsp[-2].minor.yy247, yymsp[0].minor.yy247);
+}
+#line 8665 "mlr_dsl_parse.c"
+        break;
+      case 512:
+#line 2563 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("mapkey", MD_AST_NODE_TYPE_MAP_LITERAL_KEY, yymsp[0].minor.yy247);
+}
+#line 8672 "mlr_dsl_parse.c"
+        break;
+      case 513:
+      case 514:
+#line 2566 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("mapval", MD_AST_NODE_TYPE_MAP_LITERAL_VALUE, yymsp[0].minor.yy247);
+}
+#line 8680 "mlr_dsl_parse.c"
+        break;
+      case 515:
+      case 516:
+#line 2572 "mlr_dsl_parse.y"
+{
+	yygotominor.yy247 = mlr_dsl_ast_node_alloc_unary("mapval", MD_AST_NODE_TYPE_MAP_LITERAL_VALUE, yymsp[0].minor.yy0);
+}
+#line 8688 "mlr_dsl_parse.c"
+        break;
+	};
+	yygoto = yyRuleInfo[yyruleno].lhs;
+	yysize = yyRuleInfo[yyruleno].nrhs;
+	pparser->yyidx -= yysize;
+	yyact = yy_find_reduce_action(pparser,yygoto);
+	if (yyact < YYNSTATE) {
+		yy_shift(pparser,yyact,yygoto,&yygotominor);
+	} else if (yyact == YYNSTATE + YYNRULE + 1) {
+		yy_accept(pparser);
+	}
+}
+
+/*
+** The following code executes when the parse fails
+*/
+static void yy_parse_failed(lemon_parser_t *pparser) {
+	ParseARG_FETCH;
+#ifndef NDEBUG
+	if (yyTraceFILE) {
+		fprintf(yyTraceFILE,"%sFail!\n",yyTracePrompt);
+	}
+#endif
+	while (pparser->yyidx >= 0)
+		yy_pop_parser_stack(pparser);
+	/* Here code is inserted which will be executed whenever the
+	** parser fails */
+	ParseARG_STORE; /* Suppress warning about unused %extra_argument variable */
+}
+
+/*
+** The following code executes when a syntax error first occurs.
+*/
+static void yy_syntax_error(
+	lemon_parser_t *pparser,           /* The parser */
+	int yymajor,                   /* The major type of the error token */
+	YYMINORTYPE yyminor            /* The minor type of the error token */
+){
+	ParseARG_FETCH;
+#define TOKEN (yyminor.yy0)
+#line 54 "mlr_dsl_parse.y"
+
+	fprintf(stderr, "mlr DSL: syntax error at \"%s\"\n", TOKEN->text);
+
+//	This is confusing and (as is) worse than nothing.
+//	Ideally we want to show the position within the input of the syntax error.
+//
+//	int n = sizeof(yyTokenName) / sizeof(yyTokenName[0]);
+//	for (int i = 0; i < n; ++i) {
+//			int a = yy_find_shift_action(pparser, (YYCODETYPE)i);
+//			if (a < YYNSTATE + YYNRULE) {
+//				fprintf(stderr, "Possible token \"%s\"\n", yyTokenName[i]);
+//			}
+//	}
+
+
+#line 8745 "mlr_dsl_parse.c"
+	ParseARG_STORE; /* Suppress warning about unused %extra_argument variable */
+}
+
+/*
+** The following is executed when the parser accepts
+*/
+static void yy_accept(lemon_parser_t *pparser) {
+	ParseARG_FETCH;
+#ifndef NDEBUG
+	if (yyTraceFILE) {
+		fprintf(yyTraceFILE,"%sAccept!\n", yyTracePrompt);
+	}
+#endif
+	while (pparser->yyidx>=0)
+		yy_pop_parser_stack(pparser);
+	/* Here code is inserted which will be executed whenever the
+	** parser accepts */
+#line 50 "mlr_dsl_parse.y"
+
+
+#line 8766 "mlr_dsl_parse.c"
+	ParseARG_STORE; /* Suppress warning about unused %extra_argument variable */
+}
+
+/* The main parser program.
+** The first argument is a pointer to a structure obtained from
+** "mlr_dsl_lemon_parser_alloc" which describes the current state of the parser.
+** The second argument is the major token number.  The third is
+** the minor token.  The fourth optional argument is whatever the
+** user wants (and specified in the grammar) and is available for
+** use by the action routines.
+**
+** Inputs:
+** <ul>
+** <li> A pointer to the parser (an opaque structure).
+** <li> The major token number.
+** <li> The minor token number.
+** <li> An option argument of a grammar-specified type.
+** </ul>
+**
+** Outputs:
+** None.
+*/
+
+int mlr_dsl_lemon_parser_parse_token(
+	void *pvparser,              /* The parser */
+	int yymajor,                 /* The major token code number */
+	ParseTOKENTYPE yyminor       /* The value for the token */
+	ParseARG_PDECL)              /* Optional %extra_argument parameter */
+{
+	YYMINORTYPE yyminorunion;
+	int yyact;            /* The parser action. */
+	int yyendofinput;     /* True if we are at the end of input */
+	int yyerrorhit = 0;   /* True if yymajor has invoked an error */
+	lemon_parser_t *pparser;  /* The parser */
+
+	int parse_code = 1;
+
+	/* (re)initialize the parser, if necessary */
+	pparser = (lemon_parser_t*)pvparser;
+	if (pparser->yyidx<0) {
+		if (yymajor==0)  return 1;
+		pparser->yyidx = 0;
+		pparser->yyerrcnt = -1;
+		pparser->yystack[0].stateno = 0;
+		pparser->yystack[0].major = 0;
+	}
+	yyminorunion.yy0 = yyminor;
+	yyendofinput = (yymajor==0);
+	ParseARG_STORE;
+
+#ifndef NDEBUG
+	if (yyTraceFILE) {
+		fprintf(yyTraceFILE,"%sInput %s\n", yyTracePrompt, yyTokenName[yymajor]);
+	}
+#endif
+
+	do {
+		yyact = yy_find_shift_action(pparser,yymajor);
+		if (yyact<YYNSTATE) {
+			yy_shift(pparser,yyact,yymajor,&yyminorunion);
+			pparser->yyerrcnt--;
+			if (yyendofinput && pparser->yyidx>=0) {
+				yymajor = 0;
+			} else {
+				yymajor = YYNOCODE;
+			}
+		} else if (yyact < YYNSTATE + YYNRULE) {
+			yy_reduce(pparser,yyact-YYNSTATE);
+		} else if (yyact == YY_ERROR_ACTION) {
+			int yymx;
+#ifndef NDEBUG
+			if (yyTraceFILE) {
+				fprintf(yyTraceFILE,"%sSyntax Error!\n",yyTracePrompt);
+			}
+#endif
+#ifdef YYERRORSYMBOL
+			/* A syntax error has occurred.
+			** The response to an error depends upon whether or not the
+			** grammar defines an error token "ERROR".
+			**
+			** This is what we do if the grammar does define ERROR:
+			**
+			**  * Call the %syntax_error function.
+			**
+			**  * Begin popping the stack until we enter a state where
+			**    it is legal to shift the error symbol, then shift
+			**    the error symbol.
+			**
+			**  * Set the error count to three.
+			**
+			**  * Begin accepting and shifting new tokens.  No new error
+			**    processing will occur until three tokens have been
+			**    shifted successfully.
+			**
+			*/
+			if (pparser->yyerrcnt<0) {
+				yy_syntax_error(pparser, yymajor, yyminorunion);
+				return 0;
+			}
+			yymx = pparser->yystack[pparser->yyidx].major;
+			if (yymx==YYERRORSYMBOL || yyerrorhit) {
+#ifndef NDEBUG
+				if (yyTraceFILE) {
+					fprintf(yyTraceFILE,"%sDiscard input token %s\n",
+						 yyTracePrompt, yyTokenName[yymajor]);
+				}
+#endif
+				mlr_dsl_yy_destructor(yymajor,&yyminorunion);
+				yymajor = YYNOCODE;
+			} else {
+				 while(
+					pparser->yyidx >= 0 &&
+					yymx != YYERRORSYMBOL &&
+					(yyact = yy_find_shift_action(pparser,YYERRORSYMBOL)) >= YYNSTATE
+				){
+					yy_pop_parser_stack(pparser);
+				}
+				if (pparser->yyidx < 0 || yymajor==0) {
+					mlr_dsl_yy_destructor(yymajor,&yyminorunion);
+					yy_parse_failed(pparser);
+					parse_code = 0;
+					yymajor = YYNOCODE;
+				} else if (yymx!=YYERRORSYMBOL) {
+					YYMINORTYPE u2;
+					u2.YYERRSYMDT = 0;
+					yy_shift(pparser,yyact,YYERRORSYMBOL,&u2);
+				}
+			}
+			pparser->yyerrcnt = 3;
+			yyerrorhit = 1;
+#else  /* YYERRORSYMBOL is not defined */
+			/* This is what we do if the grammar does not define ERROR:
+			**
+			**  * Report an error message, and throw away the input token.
+			**
+			**  * If the input token is $, then fail the parse.
+			**
+			** As before, subsequent error messages are suppressed until
+			** three input tokens have been successfully shifted.
+			*/
+			if (pparser->yyerrcnt<=0) {
+				yy_syntax_error(pparser, yymajor, yyminorunion);
+				return 0;
+			}
+			pparser->yyerrcnt = 3;
+			mlr_dsl_yy_destructor(yymajor,&yyminorunion);
+			if (yyendofinput) {
+				yy_parse_failed(pparser);
+				parse_code = 0;
+			}
+			yymajor = YYNOCODE;
+#endif
+		} else {
+			yy_accept(pparser);
+			yymajor = YYNOCODE;
+		}
+	} while (yymajor!=YYNOCODE && pparser->yyidx>=0) ;
+	return parse_code;
+}
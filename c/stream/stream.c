@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
 
 #include "lib/mlrutil.h"
 #include "lib/mlr_globals.h"
@@ -13,14 +14,44 @@
 static int do_stream_chained_in_place(context_t* pctx, cli_opts_t* popts);
 static int do_stream_chained_to_stdout(context_t* pctx, sllv_t* pmapper_list, cli_opts_t* popts);
 
-static int do_file_chained(char* filename, context_t* pctx,
-	lrec_reader_t* plrec_reader, sllv_t* pmapper_list, lrec_writer_t* plrec_writer, FILE* output_stream,
+// The mapper chain as driven record by record: each stage's emitter pushes
+// into the next stage, and the last stage's into the record-writer.
+typedef struct _chain_stage_t {
+	mapper_t*        pmapper;
+	mapper_emitter_t downstream;
+} chain_stage_t;
+
+typedef struct _chain_t {
+	chain_stage_t* stages;
+	int            num_stages;
+	lrec_writer_t* plrec_writer;
+	FILE*          output_stream;
+	hss_t*         pinput_fields; // Null if the mappers can read any field
+} chain_t;
+
+static chain_t* chain_alloc(sllv_t* pmapper_list, lrec_writer_t* plrec_writer, FILE* output_stream);
+static void     chain_free(chain_t* pchain);
+static void     chain_set_reader_projection(chain_t* pchain, lrec_reader_t* plrec_reader);
+static void     chain_set_reader_prefilter(chain_t* pchain, lrec_reader_t* plrec_reader);
+static void     chain_set_reader_retainer(chain_t* pchain, lrec_reader_t* plrec_reader);
+static int      chain_can_read_reversed(chain_t* pchain, lrec_reader_t* plrec_reader, slls_t* pfilenames,
 	cli_opts_t* popts);
+static int      chain_can_read_twice(chain_t* pchain, slls_t* pfilenames, cli_opts_t* popts);
+static int      can_reread_files(slls_t* pfilenames, cli_opts_t* popts);
+static lrec_reader_t* chain_realloc_reader_for_two_passes(chain_t* pchain, lrec_reader_t* plrec_reader,
+	cli_opts_t* popts);
+static void     chain_push(lrec_t* pinrec, context_t* pctx, chain_stage_t* pstage);
+static void     chain_emit_to_stage(lrec_t* poutrec, context_t* pctx, mapper_emitter_t* pemitter);
+static void     chain_emit_to_writer(lrec_t* poutrec, context_t* pctx, mapper_emitter_t* pemitter);
 
-static sllv_t* chain_map(lrec_t* pinrec, context_t* pctx, sllve_t* pmapper_list_head);
+static int do_file_chained(char* filename, context_t* pctx, lrec_reader_t* plrec_reader, chain_t* pchain,
+	cli_opts_t* popts);
+static int do_file_reversed(char* filename, context_t* pctx, lrec_reader_t* plrec_reader, chain_t* pchain,
+	cli_opts_t* popts);
+static int do_files_twice(slls_t* pfilenames, context_t* pctx, lrec_reader_t* plrec_reader, chain_t* pchain,
+	cli_opts_t* popts);
 
-static void drive_lrec(lrec_t* pinrec, context_t* pctx, sllve_t* pmapper_list_head, lrec_writer_t* plrec_writer,
-	FILE* output_stream);
+static void drive_lrec(lrec_t* pinrec, context_t* pctx, chain_t* pchain);
 
 typedef void progress_indicator_t(context_t* pctx, long long nr_progress_mod);
 static void null_progress_indicator(context_t* pctx, long long nr_progress_mod);
@@ -77,12 +108,23 @@ static int do_stream_chained_in_place(context_t* pctx, cli_opts_t* popts) {
 			exit(1);
 		}
 
-		pctx->filenum++;
-		pctx->filename = filename;
-		pctx->fnr = 0;
-
-		ok = do_file_chained(filename, pctx, plrec_reader, pmapper_list, plrec_writer,
-			output_stream, popts) && ok;
+		chain_t* pchain = chain_alloc(pmapper_list, plrec_writer, output_stream);
+		chain_set_reader_projection(pchain, plrec_reader);
+		chain_set_reader_prefilter(pchain, plrec_reader);
+		slls_t* pfilenames = slls_single_no_free(filename);
+		if (chain_can_read_reversed(pchain, plrec_reader, pfilenames, popts)) {
+			ok = do_file_reversed(filename, pctx, plrec_reader, pchain, popts) && ok;
+		} else if (chain_can_read_twice(pchain, pfilenames, popts)) {
+			plrec_reader = chain_realloc_reader_for_two_passes(pchain, plrec_reader, popts);
+			ok = do_files_twice(pfilenames, pctx, plrec_reader, pchain, popts) && ok;
+		} else {
+			chain_set_reader_retainer(pchain, plrec_reader);
+			pctx->filenum++;
+			pctx->filename = filename;
+			pctx->fnr = 0;
+			ok = do_file_chained(filename, pctx, plrec_reader, pchain, popts) && ok;
+		}
+		slls_free(pfilenames);
 
 		// For in-place mode, there's no breaking from the loop over input files. Just an early
 		// return from the mapper chain, which has already just happened.
@@ -91,9 +133,10 @@ static int do_stream_chained_in_place(context_t* pctx, cli_opts_t* popts) {
 
 		// Mappers and writers receive end-of-stream notifications via null input record.
 		// Do that, now that data from the input file have been exhausted.
-		drive_lrec(NULL, pctx, pmapper_list->phead, plrec_writer, output_stream);
+		drive_lrec(NULL, pctx, pchain);
 		// Drain the pretty-printer.
 		plrec_writer->pprocess_func(plrec_writer->pvstate, output_stream, NULL, pctx);
+		chain_free(pchain);
 
 		fclose(output_stream);
 		int rc = rename(tempname, filename);
@@ -122,17 +165,30 @@ static int do_stream_chained_to_stdout(context_t* pctx, sllv_t* pmapper_list, cl
 	lrec_writer_t* plrec_writer = lrec_writer_alloc_or_die(&popts->writer_opts);
 
 	MLR_INTERNAL_CODING_ERROR_IF(pmapper_list->length < 1); // Should not have been allowed by the CLI parser.
+	chain_t* pchain = chain_alloc(pmapper_list, plrec_writer, output_stream);
+	chain_set_reader_projection(pchain, plrec_reader);
+	chain_set_reader_prefilter(pchain, plrec_reader);
+	int has_files = popts->filenames != NULL && popts->filenames->length > 0;
+	int is_reversed = has_files && chain_can_read_reversed(pchain, plrec_reader, popts->filenames, popts);
+	int is_two_pass = has_files && !is_reversed && chain_can_read_twice(pchain, popts->filenames, popts);
+	if (is_two_pass)
+		plrec_reader = chain_realloc_reader_for_two_passes(pchain, plrec_reader, popts);
+	else if (!is_reversed)
+		chain_set_reader_retainer(pchain, plrec_reader);
 
 	int ok = 1;
 	if (popts->filenames == NULL) {
 		// No input at all
+	} else if (is_reversed) {
+		ok = do_file_reversed(popts->filenames->phead->value, pctx, plrec_reader, pchain, popts);
+	} else if (is_two_pass) {
+		ok = do_files_twice(popts->filenames, pctx, plrec_reader, pchain, popts);
 	} else if (popts->filenames->length == 0) {
 		// Zero file names means read from standard input
 		pctx->filenum++;
 		pctx->filename = "(stdin)";
 		pctx->fnr = 0;
-		ok = do_file_chained("-", pctx, plrec_reader, pmapper_list, plrec_writer,
-			output_stream, popts) && ok;
+		ok = do_file_chained("-", pctx, plrec_reader, pchain, popts) && ok;
 	} else {
 		// Read from each file name in turn
 		for (sllse_t* pe = popts->filenames->phead; pe != NULL; pe = pe->pnext) {
@@ -140,8 +196,7 @@ static int do_stream_chained_to_stdout(context_t* pctx, sllv_t* pmapper_list, cl
 			pctx->filenum++;
 			pctx->filename = filename;
 			pctx->fnr = 0;
-			ok = do_file_chained(filename, pctx, plrec_reader, pmapper_list, plrec_writer,
-				output_stream, popts) && ok;
+			ok = do_file_chained(filename, pctx, plrec_reader, pchain, popts) && ok;
 			if (pctx->force_eof == TRUE) // e.g. mlr head
 				break;
 		}
@@ -149,11 +204,12 @@ static int do_stream_chained_to_stdout(context_t* pctx, sllv_t* pmapper_list, cl
 
 	// Mappers and writers receive end-of-stream notifications via null input record.
 	// Do that, now that data from all input file(s) have been exhausted.
-	drive_lrec(NULL, pctx, pmapper_list->phead, plrec_writer, output_stream);
+	drive_lrec(NULL, pctx, pchain);
 
 	// Drain the pretty-printer.
 	plrec_writer->pprocess_func(plrec_writer->pvstate, output_stream, NULL, pctx);
 
+	chain_free(pchain);
 	plrec_reader->pfree_func(plrec_reader);
 	plrec_writer->pfree_func(plrec_writer, pctx);
 
@@ -161,8 +217,7 @@ static int do_stream_chained_to_stdout(context_t* pctx, sllv_t* pmapper_list, cl
 }
 
 // ----------------------------------------------------------------
-static int do_file_chained(char* filename, context_t* pctx,
-	lrec_reader_t* plrec_reader, sllv_t* pmapper_list, lrec_writer_t* plrec_writer, FILE* output_stream,
+static int do_file_chained(char* filename, context_t* pctx, lrec_reader_t* plrec_reader, chain_t* pchain,
 	cli_opts_t* popts)
 {
 	void* pvhandle = plrec_reader->popen_func(plrec_reader->pvstate, popts->reader_opts.prepipe, filename);
@@ -186,7 +241,7 @@ static int do_file_chained(char* filename, context_t* pctx,
 
 		pindicator(pctx, popts->nr_progress_mod);
 
-		drive_lrec(pinrec, pctx, pmapper_list->phead, plrec_writer, output_stream);
+		drive_lrec(pinrec, pctx, pchain);
 	}
 
 	plrec_reader->pclose_func(plrec_reader->pvstate, pvhandle, popts->reader_opts.prepipe);
@@ -194,46 +249,248 @@ static int do_file_chained(char* filename, context_t* pctx,
 }
 
 // ----------------------------------------------------------------
-static void drive_lrec(lrec_t* pinrec, context_t* pctx, sllve_t* pmapper_list_head, lrec_writer_t* plrec_writer,
-	FILE* output_stream)
+// Reads the file last record first, until the first mapper has as many records as it asked for. Records are
+// read with the file's context, but the chain sees the context as at end of stream, since that's when a first
+// mapper such as tac or tail would have emitted them when reading forward. Later mappers may use NR and FNR so
+// in that case the records are counted first.
+static int do_file_reversed(char* filename, context_t* pctx, lrec_reader_t* plrec_reader, chain_t* pchain,
+	cli_opts_t* popts)
+{
+	mapper_t* pmapper = pchain->stages[0].pmapper;
+	long long num_needed = pmapper->pset_reverse_input_func(pmapper->pvstate);
+
+	context_t read_ctx = *pctx;
+	read_ctx.filenum++;
+	read_ctx.filename = filename;
+	pctx->filenum++;
+	pctx->filename = filename;
+	pctx->fnr      = 0LL;
+	if (pchain->num_stages > 1) {
+		void* pvhandle = plrec_reader->popen_func(plrec_reader->pvstate, NULL, filename);
+		plrec_reader->psof_func(plrec_reader->pvstate, pvhandle);
+		pctx->fnr = plrec_reader->pcount_func(plrec_reader->pvstate, pvhandle, &read_ctx);
+		pctx->nr += pctx->fnr;
+		plrec_reader->pclose_func(plrec_reader->pvstate, pvhandle, NULL);
+	}
+
+	void* pvhandle = plrec_reader->popen_func(plrec_reader->pvstate, NULL, filename);
+	plrec_reader->psof_func(plrec_reader->pvstate, pvhandle);
+	long long num_read = 0LL;
+	while (num_needed < 0LL || num_read < num_needed) {
+		lrec_t* pinrec = plrec_reader->pprocess_backward_func(plrec_reader->pvstate, pvhandle, &read_ctx);
+		if (pinrec == NULL)
+			break;
+		pctx->auto_line_term          = read_ctx.auto_line_term;
+		pctx->auto_line_term_detected = read_ctx.auto_line_term_detected;
+		if (pctx->force_eof == TRUE) { // e.g. mlr tac then head
+			lrec_free(pinrec);
+			break;
+		}
+		num_read++;
+		drive_lrec(pinrec, pctx, pchain);
+	}
+	plrec_reader->pclose_func(plrec_reader->pvstate, pvhandle, NULL);
+
+	return 1;
+}
+
+// ----------------------------------------------------------------
+// Reads the files twice: the first pass goes to the first mapper only, the second through the chain. As with
+// reverse reading, the chain sees the context as at end of stream, since that's when the first mapper would have
+// emitted its records when reading once.
+static int do_files_twice(slls_t* pfilenames, context_t* pctx, lrec_reader_t* plrec_reader, chain_t* pchain,
+	cli_opts_t* popts)
 {
-	sllv_t* outrecs = chain_map(pinrec, pctx, pmapper_list_head);
-	if (outrecs != NULL) {
-		for (sllve_t* pe = outrecs->phead; pe != NULL; pe = pe->pnext) {
-			lrec_t* poutrec = pe->pvvalue;
-			if (poutrec != NULL) // writer frees records (sllv void-star payload)
-				plrec_writer->pprocess_func(plrec_writer->pvstate, output_stream, poutrec, pctx);
+	mapper_t* pmapper = pchain->stages[0].pmapper;
+	context_t start_ctx = *pctx;
+	context_t read_ctx  = *pctx;
+
+	for (sllse_t* pe = pfilenames->phead; pe != NULL; pe = pe->pnext) {
+		read_ctx.filenum++;
+		read_ctx.filename = pe->value;
+		read_ctx.fnr = 0LL;
+		void* pvhandle = plrec_reader->popen_func(plrec_reader->pvstate, NULL, pe->value);
+		plrec_reader->psof_func(plrec_reader->pvstate, pvhandle);
+		while (TRUE) {
+			lrec_t* pinrec = plrec_reader->pprocess_func(plrec_reader->pvstate, pvhandle, &read_ctx);
+			if (pinrec == NULL)
+				break;
+			read_ctx.nr++;
+			read_ctx.fnr++;
+			pmapper->pfirst_pass_func(pinrec, &read_ctx, pmapper->pvstate);
+		}
+		plrec_reader->pclose_func(plrec_reader->pvstate, pvhandle, NULL);
+	}
+	pmapper->pfirst_pass_func(NULL, &read_ctx, pmapper->pvstate);
+	*pctx = read_ctx;
+
+	read_ctx = start_ctx;
+	for (sllse_t* pe = pfilenames->phead; pe != NULL; pe = pe->pnext) {
+		read_ctx.filenum++;
+		read_ctx.filename = pe->value;
+		void* pvhandle = plrec_reader->popen_func(plrec_reader->pvstate, NULL, pe->value);
+		plrec_reader->psof_func(plrec_reader->pvstate, pvhandle);
+		while (TRUE) {
+			lrec_t* pinrec = plrec_reader->pprocess_func(plrec_reader->pvstate, pvhandle, &read_ctx);
+			if (pinrec == NULL)
+				break;
+			if (pctx->force_eof == TRUE) { // e.g. mlr fraction then head
+				lrec_free(pinrec);
+				break;
+			}
+			drive_lrec(pinrec, pctx, pchain);
+		}
+		plrec_reader->pclose_func(plrec_reader->pvstate, pvhandle, NULL);
+		if (pctx->force_eof == TRUE)
+			break;
+	}
+
+	return 1;
+}
+
+// ----------------------------------------------------------------
+static void drive_lrec(lrec_t* pinrec, context_t* pctx, chain_t* pchain) {
+	chain_push(pinrec, pctx, &pchain->stages[0]);
+}
+
+// ----------------------------------------------------------------
+static chain_t* chain_alloc(sllv_t* pmapper_list, lrec_writer_t* plrec_writer, FILE* output_stream) {
+	chain_t* pchain = mlr_malloc_or_die(sizeof(chain_t));
+	pchain->stages        = mlr_malloc_or_die(pmapper_list->length * sizeof(chain_stage_t));
+	pchain->num_stages    = pmapper_list->length;
+	pchain->plrec_writer  = plrec_writer;
+	pchain->output_stream = output_stream;
+	pchain->pinput_fields = mapper_chain_get_input_fields(pmapper_list);
+
+	int i = 0;
+	for (sllve_t* pe = pmapper_list->phead; pe != NULL; pe = pe->pnext, i++) {
+		chain_stage_t* pstage = &pchain->stages[i];
+		pstage->pmapper = pe->pvvalue;
+		if (pe->pnext != NULL) {
+			pstage->downstream.pemit_func = chain_emit_to_stage;
+			pstage->downstream.pvstate    = &pchain->stages[i+1];
+		} else {
+			pstage->downstream.pemit_func = chain_emit_to_writer;
+			pstage->downstream.pvstate    = pchain;
 		}
-		sllv_free(outrecs); // we free the list
 	}
+	return pchain;
+}
+
+static void chain_free(chain_t* pchain) {
+	hss_free(pchain->pinput_fields);
+	free(pchain->stages);
+	free(pchain);
+}
+
+// Projection pushdown: readers which can, skip fields the mappers can't read.
+static void chain_set_reader_projection(chain_t* pchain, lrec_reader_t* plrec_reader) {
+	if (plrec_reader->pset_projection_func != NULL)
+		plrec_reader->pset_projection_func(plrec_reader->pvstate, pchain->pinput_fields);
+}
+
+// Predicate pushdown: readers which can, drop records the first mapper would drop.
+static void chain_set_reader_prefilter(chain_t* pchain, lrec_reader_t* plrec_reader) {
+	mapper_t* pmapper = pchain->stages[0].pmapper;
+	if (plrec_reader->pset_prefilter_func != NULL && pmapper->pprefilter_func != NULL)
+		plrec_reader->pset_prefilter_func(plrec_reader->pvstate, pmapper->pprefilter_func(pmapper->pvstate));
+}
+
+// Offset-based retention: readers which can, let the first mapper keep where records are in the
+// input rather than the records themselves.
+static void chain_set_reader_retainer(chain_t* pchain, lrec_reader_t* plrec_reader) {
+	mapper_t* pmapper = pchain->stages[0].pmapper;
+	if (plrec_reader->palloc_retainer_func != NULL && pmapper->pset_retainer_func != NULL)
+		pmapper->pset_retainer_func(pmapper->pvstate, plrec_reader->palloc_retainer_func(plrec_reader));
+}
+
+// Reverse reading: if the first mapper wants the input last record first, or only its last n records, readers
+// which can read a regular file backward from the end. Reading through a prepipe, and with progress indication,
+// stays as is. So does reading several files: the line terminator is detected from the first of them, and a
+// header-data mismatch in any of them is an error before any output, neither of which reading the last file
+// first would give.
+static int chain_can_read_reversed(chain_t* pchain, lrec_reader_t* plrec_reader, slls_t* pfilenames,
+	cli_opts_t* popts)
+{
+	mapper_t* pmapper = pchain->stages[0].pmapper;
+	if (plrec_reader->pprocess_backward_func == NULL || pmapper->pset_reverse_input_func == NULL)
+		return FALSE;
+	if (pfilenames->length != 1)
+		return FALSE;
+	return can_reread_files(pfilenames, popts);
+}
+
+// Two-pass reading: if the first mapper would otherwise retain all its input before producing any output, e.g.
+// for totals, regular files are read twice instead. Not with comments passed through, which would be printed
+// by both passes.
+static int chain_can_read_twice(chain_t* pchain, slls_t* pfilenames, cli_opts_t* popts) {
+	mapper_t* pmapper = pchain->stages[0].pmapper;
+	if (pmapper->pfirst_pass_func == NULL)
+		return FALSE;
+	if (popts->reader_opts.comment_string != NULL && popts->reader_opts.comment_handling == PASS_COMMENTS)
+		return FALSE;
+	return can_reread_files(pfilenames, popts);
+}
+
+// Mmapped input stays mapped while records point into it, and parsing writes into the pages, so a second pass
+// over an mmapped file would hold the input twice over. Two-pass reading goes through stdio instead.
+static lrec_reader_t* chain_realloc_reader_for_two_passes(chain_t* pchain, lrec_reader_t* plrec_reader,
+	cli_opts_t* popts)
+{
+	if (!popts->reader_opts.use_mmap_for_read)
+		return plrec_reader;
+	plrec_reader->pfree_func(plrec_reader);
+	popts->reader_opts.use_mmap_for_read = FALSE;
+	plrec_reader = lrec_reader_alloc_or_die(&popts->reader_opts);
+	popts->reader_opts.use_mmap_for_read = TRUE;
+	chain_set_reader_projection(pchain, plrec_reader);
+	return plrec_reader;
+}
+
+static int can_reread_files(slls_t* pfilenames, cli_opts_t* popts) {
+	if (popts->reader_opts.prepipe != NULL || popts->nr_progress_mod != 0LL)
+		return FALSE;
+	for (sllse_t* pe = pfilenames->phead; pe != NULL; pe = pe->pnext) {
+		struct stat statbuf;
+		if (stat(pe->value, &statbuf) != 0 || !S_ISREG(statbuf.st_mode))
+			return FALSE;
+	}
+	return TRUE;
 }
 
 // ----------------------------------------------------------------
 // Map a single input record (maybe null at end of input stream) to zero or
-// more output records.
+// more output records, each of which goes on through the rest of the chain,
+// up to the writer, as soon as it is produced. See mapper.h for the effect on
+// output ordering.
 //
-// Return: list of lrec_t*. Input: lrec_t* and list of mapper_t*.
+// Mappers with a process function rather than a push function are adapted
+// here: their output lists are walked and freed. As before, a mapper which
+// returns a null list at end of stream ends the stream there.
+
+static void chain_push(lrec_t* pinrec, context_t* pctx, chain_stage_t* pstage) {
+	mapper_t* pmapper = pstage->pmapper;
+	if (pmapper->pprocess_func == NULL) {
+		pmapper->ppush_func(pinrec, pctx, pmapper->pvstate, &pstage->downstream);
+		return;
+	}
 
-static sllv_t* chain_map(lrec_t* pinrec, context_t* pctx, sllve_t* pmapper_list_head) {
-	mapper_t* pmapper = pmapper_list_head->pvvalue;
 	sllv_t* outrecs = pmapper->pprocess_func(pinrec, pctx, pmapper->pvstate);
-	if (pmapper_list_head->pnext == NULL) {
-		return outrecs;
-	} else if (outrecs == NULL) { // end of input stream
-		return NULL;
-	} else {
-		sllv_t* nextrecs = sllv_alloc();
+	if (outrecs == NULL)
+		return;
+	for (sllve_t* pe = outrecs->phead; pe != NULL; pe = pe->pnext)
+		mapper_emit(&pstage->downstream, pe->pvvalue, pctx);
+	sllv_free(outrecs);
+}
 
-		for (sllve_t* pe = outrecs->phead; pe != NULL; pe = pe->pnext) {
-			lrec_t* poutrec = pe->pvvalue;
-			sllv_t* nextrecsi = chain_map(poutrec, pctx, pmapper_list_head->pnext);
-			sllv_transfer(nextrecs, nextrecsi);
-			sllv_free(nextrecsi);
-		}
-		sllv_free(outrecs);
+static void chain_emit_to_stage(lrec_t* poutrec, context_t* pctx, mapper_emitter_t* pemitter) {
+	chain_push(poutrec, pctx, pemitter->pvstate);
+}
 
-		return nextrecs;
-	}
+static void chain_emit_to_writer(lrec_t* poutrec, context_t* pctx, mapper_emitter_t* pemitter) {
+	chain_t* pchain = pemitter->pvstate;
+	if (poutrec != NULL) // writer frees records (sllv void-star payload)
+		pchain->plrec_writer->pprocess_func(pchain->plrec_writer->pvstate, pchain->output_stream, poutrec, pctx);
 }
 
 // ----------------------------------------------------------------
@@ -5,6 +5,7 @@
 #include "lib/mlrutil.h"
 #include "containers/lrec.h"
 #include "containers/sllv.h"
+#include "containers/hss.h"
 #include "input/lrec_readers.h"
 
 int tests_run         = 0;
@@ -72,7 +73,7 @@ static char* test_lrec_unbacked_api() {
 static char* test_lrec_dkvp_api() {
 	char* line = mlr_strdup_or_die("w=2,x=3,y=4,z=5");
 
-	lrec_t* prec = lrec_parse_stdio_dkvp_single_sep(line, ',', '=', FALSE);
+	lrec_t* prec = lrec_parse_stdio_dkvp_single_sep(line, ',', '=', FALSE, NULL);
 	mu_assert_lf(prec->field_count == 4);
 
 	mu_assert_lf(streq(lrec_get(prec, "w"), "2"));
@@ -110,7 +111,7 @@ static char* test_lrec_dkvp_api() {
 // ----------------------------------------------------------------
 static char* test_lrec_nidx_api() {
 	char* line = mlr_strdup_or_die("a,b,c,d");
-	lrec_t* prec = lrec_parse_stdio_nidx_single_sep(line, ',', FALSE);
+	lrec_t* prec = lrec_parse_stdio_nidx_single_sep(line, ',', FALSE, NULL);
 	mu_assert_lf(prec->field_count == 4);
 
 	mu_assert_lf(streq(lrec_get(prec, "1"), "a"));
@@ -145,6 +146,97 @@ static char* test_lrec_nidx_api() {
 	return NULL;
 }
 
+// ----------------------------------------------------------------
+static char* test_lrec_projected_parse() {
+	hss_t* pprojection = hss_alloc();
+	hss_add(pprojection, "x");
+	hss_add(pprojection, "z");
+	hss_add(pprojection, "3");
+
+	char* line = mlr_strdup_or_die("w=2,x=3,y=4,z=5");
+	lrec_t* prec = lrec_parse_stdio_dkvp_single_sep(line, ',', '=', FALSE, pprojection);
+	mu_assert_lf(prec->field_count == 2);
+	mu_assert_lf(lrec_get(prec, "w") == NULL);
+	mu_assert_lf(streq(lrec_get(prec, "x"), "3"));
+	mu_assert_lf(lrec_get(prec, "y") == NULL);
+	mu_assert_lf(streq(lrec_get(prec, "z"), "5"));
+	lrec_free(prec);
+
+	line = mlr_strdup_or_die("a,b,c,d");
+	prec = lrec_parse_stdio_nidx_single_sep(line, ',', FALSE, pprojection);
+	mu_assert_lf(prec->field_count == 1);
+	mu_assert_lf(streq(lrec_get(prec, "3"), "c"));
+	lrec_free(prec);
+
+	hss_free(pprojection);
+	return NULL;
+}
+
+// ----------------------------------------------------------------
+static char* test_lrec_prefilter_terms() {
+	lrec_prefilter_t* pprefilter = lrec_prefilter_alloc(mv_ref_type_infer_string_or_float_or_int);
+	lrec_prefilter_add_term(pprefilter, "s", mv_from_string_no_free("abc"), FALSE);
+	lrec_prefilter_add_term(pprefilter, "n", mv_from_string_no_free("500"), TRUE);
+	lrec_prefilter_add_term(pprefilter, "x", mv_from_int(500LL), FALSE);
+	lrec_prefilter_term_t* ps = &pprefilter->pterms[0];
+	lrec_prefilter_term_t* pn = &pprefilter->pterms[1];
+	lrec_prefilter_term_t* px = &pprefilter->pterms[2];
+
+	// Only literals no number can be formatted to are needles.
+	mu_assert_lf(ps->needle != NULL && streq(ps->needle, "abc"));
+	mu_assert_lf(pn->needle == NULL);
+	mu_assert_lf(px->needle == NULL);
+
+	mu_assert_lf(lrec_prefilter_evaluate_term(pprefilter, ps, "abcdef", 3) == PREFILTER_TERM_TRUE);
+	mu_assert_lf(lrec_prefilter_evaluate_term(pprefilter, ps, "abcdef", 4) == PREFILTER_TERM_FALSE);
+	mu_assert_lf(lrec_prefilter_evaluate_term(pprefilter, ps, NULL, 0) == PREFILTER_TERM_ABSENT);
+	mu_assert_lf(lrec_prefilter_evaluate_term(pprefilter, pn, "0x1F4", 5) == PREFILTER_TERM_TRUE);
+	mu_assert_lf(lrec_prefilter_evaluate_term(pprefilter, pn, "501", 3) == PREFILTER_TERM_FALSE);
+	mu_assert_lf(lrec_prefilter_evaluate_term(pprefilter, px, "500.0", 5) == PREFILTER_TERM_TRUE);
+	mu_assert_lf(lrec_prefilter_evaluate_term(pprefilter, px, "abc", 3) == PREFILTER_TERM_FALSE);
+	// Repeated evaluation mustn't disturb the literal.
+	mu_assert_lf(lrec_prefilter_evaluate_term(pprefilter, pn, "500", 3) == PREFILTER_TERM_TRUE);
+
+	lrec_prefilter_free(pprefilter);
+	return NULL;
+}
+
+// ----------------------------------------------------------------
+static lrec_t* test_reparse(void* pvstate, char* line) {
+	return lrec_parse_stdio_dkvp_single_sep(line, ',', '=', FALSE, NULL);
+}
+
+static char* test_lrec_retainer() {
+	// As with mmapped input, the extents point into the unterminated input.
+	char input[] = "a=1,b=2\nc=3\n";
+	lrec_retainer_t* pretainer = lrec_retainer_alloc(test_reparse, NULL);
+	lrec_extents_t* pextents = lrec_extents_alloc();
+	// Enough to make the extents grow.
+	for (int i = 0; i < 2000; i++) {
+		lrec_extent_t extent = { .line = &input[(i % 2) ? 8 : 0], .length = (i % 2) ? 3 : 7 };
+		lrec_extents_append(pextents, extent);
+	}
+	mu_assert_lf(pextents->length == 2000);
+
+	lrec_t* prec = lrec_retainer_reparse(pretainer, &pextents->pextents[1998]);
+	mu_assert_lf(prec->field_count == 2);
+	mu_assert_lf(streq(lrec_get(prec, "a"), "1"));
+	mu_assert_lf(streq(lrec_get(prec, "b"), "2"));
+	lrec_free(prec);
+
+	prec = lrec_retainer_reparse(pretainer, &pextents->pextents[1999]);
+	mu_assert_lf(prec->field_count == 1);
+	mu_assert_lf(streq(lrec_get(prec, "c"), "3"));
+	lrec_free(prec);
+
+	// The input is left as it was.
+	mu_assert_lf(streq(input, "a=1,b=2\nc=3\n"));
+
+	lrec_extents_free(pextents);
+	lrec_retainer_free(pretainer);
+	return NULL;
+}
+
 // ----------------------------------------------------------------
 static char* test_lrec_csv_api() {
 	char* hdr_line = mlr_strdup_or_die("w,x,y,z");
@@ -406,6 +498,9 @@ static char * run_all_tests() {
 	mu_run_test(test_lrec_unbacked_api);
 	mu_run_test(test_lrec_dkvp_api);
 	mu_run_test(test_lrec_nidx_api);
+	mu_run_test(test_lrec_projected_parse);
+	mu_run_test(test_lrec_prefilter_terms);
+	mu_run_test(test_lrec_retainer);
 	mu_run_test(test_lrec_csv_api);
 	mu_run_test(test_lrec_csv_api_disjoint_allocs);
 	mu_run_test(test_lrec_xtab_api);
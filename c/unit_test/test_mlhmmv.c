@@ -119,17 +119,17 @@ static char* test_resize() {
 	int error;
 
 	printf("================================================================\n");
-	for (int i = 0; i < 2*MLHMMV_INITIAL_ARRAY_LENGTH; i++)
+	for (int i = 0; i < 4*MLHMMV_SMALL_LEVEL_MAX; i++)
 		mlhmmv_root_put_terminal(pmap, sllmv_single_with_free(imv(i)), imv(-i));
 	mlhmmv_root_print_json_stacked(pmap, TRUE, FALSE, "", "\n", stdout);
 	printf("\n");
 
-	for (int i = 0; i < 2*MLHMMV_INITIAL_ARRAY_LENGTH; i++)
+	for (int i = 0; i < 4*MLHMMV_SMALL_LEVEL_MAX; i++)
 		mlhmmv_root_put_terminal(pmap, sllmv_double_with_free(smv("a"), imv(i)), imv(-i));
 	mlhmmv_root_print_json_stacked(pmap, TRUE, FALSE, "", "\n", stdout);
 	printf("\n");
 
-	for (int i = 0; i < 2*MLHMMV_INITIAL_ARRAY_LENGTH; i++)
+	for (int i = 0; i < 4*MLHMMV_SMALL_LEVEL_MAX; i++)
 		mlhmmv_root_put_terminal(pmap, sllmv_triple_with_free(imv(i*100), imv(i % 4), smv("b")), smv("term"));
 	mlhmmv_root_print_json_stacked(pmap, TRUE, FALSE, "", "\n", stdout);
 
@@ -161,6 +161,49 @@ static char* test_resize() {
 	return NULL;
 }
 
+// ----------------------------------------------------------------
+// Removed entries are squeezed out when a level grows; lookups, and insertion
+// order, must survive that both below and above the small-level size.
+static char* test_remove_and_regrow() {
+	mlhmmv_root_t* pmap = mlhmmv_root_alloc();
+	int error;
+	int n = 4*MLHMMV_SMALL_LEVEL_MAX;
+	char buf[32];
+
+	for (int i = 0; i < n; i++) {
+		sprintf(buf, "k%d", i);
+		mlhmmv_root_put_terminal(pmap, sllmv_double_with_free(smv("s"), smv(mlr_strdup_or_die(buf))), imv(i));
+		mlhmmv_root_put_terminal(pmap, sllmv_double_with_free(smv("i"), imv(i)), imv(-i));
+	}
+	for (int i = 0; i < n; i += 2) {
+		sprintf(buf, "k%d", i);
+		mlhmmv_root_remove(pmap, sllmv_double_with_free(smv("s"), smv(buf)));
+		mlhmmv_root_remove(pmap, sllmv_double_with_free(smv("i"), imv(i)));
+	}
+	for (int i = 0; i < n; i++) {
+		sprintf(buf, "k%d", i);
+		mv_t* pval = mlhmmv_root_look_up_and_ref_terminal(pmap, sllmv_double_with_free(smv("s"), smv(buf)), &error);
+		mu_assert_lf((i % 2 == 0) ? pval == NULL : (pval != NULL && pval->u.intv == i));
+		pval = mlhmmv_root_look_up_and_ref_terminal(pmap, sllmv_double_with_free(smv("i"), imv(i)), &error);
+		mu_assert_lf((i % 2 == 0) ? pval == NULL : (pval != NULL && pval->u.intv == -i));
+	}
+
+	// Put the removed keys back, forcing growth.
+	for (int i = 0; i < n; i += 2)
+		mlhmmv_root_put_terminal(pmap, sllmv_double_with_free(smv("i"), imv(i)), imv(-i));
+	for (int i = 0; i < n; i++) {
+		mv_t* pval = mlhmmv_root_look_up_and_ref_terminal(pmap, sllmv_double_with_free(smv("i"), imv(i)), &error);
+		mu_assert_lf(pval != NULL && pval->u.intv == -i);
+	}
+	sllv_t* pkeys = mlhmmv_root_copy_keys_from_submap(pmap, sllmv_single_with_free(smv("i")));
+	mu_assert_lf(pkeys->length == n);
+	mu_assert_lf(((mv_t*)pkeys->phead->pvvalue)->u.intv == 1);
+	mu_assert_lf(((mv_t*)pkeys->ptail->pvvalue)->u.intv == n - 2);
+
+	mlhmmv_root_free(pmap);
+	return NULL;
+}
+
 // ----------------------------------------------------------------
 static char* test_depth_errors() {
 	mlhmmv_root_t* pmap = mlhmmv_root_alloc();
@@ -329,6 +372,7 @@ static char * run_all_tests() {
 	mu_run_test(test_no_overlap);
 	mu_run_test(test_overlap);
 	mu_run_test(test_resize);
+	mu_run_test(test_remove_and_regrow);
 	mu_run_test(test_depth_errors);
 	mu_run_test(test_mlhmmv_to_lrecs);
 	return 0;
@@ -134,10 +134,86 @@ static char * test_interpolate_regex_captures() {
 }
 
 
+// ----------------------------------------------------------------
+static char * test_literal_regexes() {
+	const size_t nmatchmax = 10;
+	regmatch_t matches[nmatchmax];
+	mlr_regex_t regex;
+
+	mlr_regcomp_or_die(&regex, "bcd", 0);
+	mu_assert_lf(streq(regex.literal, "bcd"));
+	mu_assert_lf(mlr_regmatch_or_die(&regex, "abcdebcd", nmatchmax, matches));
+	mu_assert_lf(matches[0].rm_so == 1 && matches[0].rm_eo == 4);
+	mu_assert_lf(matches[1].rm_so == -1);
+	mu_assert_lf(!mlr_regmatch_or_die(&regex, "abCde", nmatchmax, matches));
+	mlr_regfree(&regex);
+
+	mlr_regcomp_or_die(&regex, "bCd", REG_ICASE);
+	mu_assert_lf(regex.literal != NULL);
+	mu_assert_lf(mlr_regmatch_or_die(&regex, "ABCDE", nmatchmax, matches));
+	mu_assert_lf(matches[0].rm_so == 1 && matches[0].rm_eo == 4);
+	mlr_regfree(&regex);
+
+	mlr_regcomp_or_die(&regex, "^ab", 0);
+	mu_assert_lf(mlr_regmatch_or_die(&regex, "abc", 0, NULL));
+	mu_assert_lf(!mlr_regmatch_or_die(&regex, "cab", 0, NULL));
+	mlr_regfree(&regex);
+
+	mlr_regcomp_or_die(&regex, "ab$", 0);
+	mu_assert_lf(mlr_regmatch_or_die(&regex, "abab", nmatchmax, matches));
+	mu_assert_lf(matches[0].rm_so == 2 && matches[0].rm_eo == 4);
+	mu_assert_lf(!mlr_regmatch_or_die(&regex, "aba", 0, NULL));
+	mlr_regfree(&regex);
+
+	mlr_regcomp_or_die(&regex, "^ab$", 0);
+	mu_assert_lf(mlr_regmatch_or_die(&regex, "ab", 0, NULL));
+	mu_assert_lf(!mlr_regmatch_or_die(&regex, "abab", 0, NULL));
+	mlr_regfree(&regex);
+
+	mlr_regcomp_or_die(&regex, "a\\.b", 0);
+	mu_assert_lf(streq(regex.literal, "a.b"));
+	mu_assert_lf(mlr_regmatch_or_die(&regex, "xa.b", 0, NULL));
+	mu_assert_lf(!mlr_regmatch_or_die(&regex, "xaxb", 0, NULL));
+	mlr_regfree(&regex);
+
+	mlr_regcomp_or_die(&regex, "a.b", 0);
+	mu_assert_lf(regex.literal == NULL);
+	mu_assert_lf(mlr_regmatch_or_die(&regex, "xaxb", 0, NULL));
+	mlr_regfree(&regex);
+
+	mlr_regcomp_or_die(&regex, "^", 0);
+	mu_assert_lf(regex.literal == NULL);
+	mlr_regfree(&regex);
+
+	return 0;
+}
+
+// ----------------------------------------------------------------
+static char * test_regex_cache() {
+	mlr_regex_t* pregex = mlr_regex_cache_get("abc", 0);
+	mu_assert_lf(pregex == mlr_regex_cache_get("abc", 0));
+	mu_assert_lf(pregex != mlr_regex_cache_get("abc", REG_ICASE));
+	mu_assert_lf(mlr_regmatch_or_die(mlr_regex_cache_get("abc", REG_ICASE), "xABCx", 0, NULL));
+
+	// Fill the cache past capacity: the most recently used entries are kept.
+	char buf[32];
+	for (int i = 0; i < 1000; i++) {
+		sprintf(buf, "x%dy", i);
+		pregex = mlr_regex_cache_get(buf, 0);
+		mu_assert_lf(mlr_regmatch_or_die(pregex, buf, 0, NULL));
+	}
+	mu_assert_lf(pregex == mlr_regex_cache_get("x999y", 0));
+	mu_assert_lf(mlr_regmatch_or_die(mlr_regex_cache_get("a.c", 0), "abc", 0, NULL));
+
+	return 0;
+}
+
 // ================================================================
 static char * all_tests() {
 	mu_run_test(test_save_regex_captures);
 	mu_run_test(test_interpolate_regex_captures);
+	mu_run_test(test_literal_regexes);
+	mu_run_test(test_regex_cache);
 	return 0;
 }
 
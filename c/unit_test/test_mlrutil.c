@@ -151,6 +151,31 @@ static char * test_scanners() {
 	return 0;
 }
 
+// ----------------------------------------------------------------
+static char * test_memmem() {
+	char* s = "abcabd";
+	mu_assert_lf(mlr_memmem(s, 6, "abd", 3) == s + 3);
+	mu_assert_lf(mlr_memmem(s, 6, "abc", 3) == s);
+	mu_assert_lf(mlr_memmem(s, 6, "d", 1) == s + 5);
+	mu_assert_lf(mlr_memmem(s, 5, "abd", 3) == NULL);
+	mu_assert_lf(mlr_memmem(s, 6, "abcabdx", 7) == NULL);
+	mu_assert_lf(mlr_memmem(s, 6, "", 0) == s);
+	mu_assert_lf(mlr_memmem(s, 0, "a", 1) == NULL);
+	return 0;
+}
+
+// ----------------------------------------------------------------
+static char * test_count_lines() {
+	mu_assert_lf(mlr_count_lines("", 0, "\n", 1) == 0);
+	mu_assert_lf(mlr_count_lines("a", 1, "\n", 1) == 1);
+	mu_assert_lf(mlr_count_lines("a\n", 2, "\n", 1) == 1);
+	mu_assert_lf(mlr_count_lines("a\nb", 3, "\n", 1) == 2);
+	mu_assert_lf(mlr_count_lines("\n\n", 2, "\n", 1) == 2);
+	mu_assert_lf(mlr_count_lines("a;;b;;", 6, ";;", 2) == 2);
+	mu_assert_lf(mlr_count_lines("a;;b;", 5, ";;", 2) == 2);
+	return 0;
+}
+
 // ----------------------------------------------------------------
 static char * test_paste() {
 	mu_assert("error: paste 2", streq(mlr_paste_2_strings("ab", "cd"), "abcd"));
@@ -180,6 +205,8 @@ static char * all_tests() {
 	mu_run_test(test_strdup_quoted);
 	mu_run_test(test_starts_or_ends_with);
 	mu_run_test(test_scanners);
+	mu_run_test(test_memmem);
+	mu_run_test(test_count_lines);
 	mu_run_test(test_paste);
 	mu_run_test(test_unbackslash);
 	return 0;
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
 #include "lib/minunit.h"
 #include "lib/mlr_globals.h"
 #include "lib/mlrutil.h"
@@ -16,7 +17,12 @@
 #include "containers/lhmslv.h"
 #include "containers/lhmsmv.h"
 #include "containers/percentile_keeper.h"
+#include "containers/tdigest.h"
+#include "containers/hll.h"
 #include "containers/top_keeper.h"
+#include "containers/space_saving.h"
+#include "containers/spill_file.h"
+#include "containers/schema_cache.h"
 #include "containers/dheap.h"
 #include "lib/mvfuncs.h"
 
@@ -292,6 +298,49 @@ static char* test_hss() {
 	return NULL;
 }
 
+// ----------------------------------------------------------------
+// Enough adds and removes to go through several enlargements and compactions.
+static char* test_hss_many() {
+	char keys[1000][8];
+	hss_t *pset = hss_alloc();
+	for (int i = 0; i < 1000; i++) {
+		sprintf(keys[i], "k%d", i);
+		hss_add(pset, keys[i]);
+		if (i % 3 == 0)
+			hss_remove(pset, keys[i / 2]);
+	}
+	mu_assert_lf(hss_check_counts(pset));
+
+	int count = 0;
+	for (int i = 0; i < 1000; i++)
+		if (hss_has(pset, keys[i]))
+			count++;
+	mu_assert_lf(count == hss_size(pset));
+	mu_assert_lf(!hss_has(pset, keys[0]));
+	mu_assert_lf( hss_has(pset, keys[999]));
+
+	// Insertion order survives removals and enlargements.
+	int prev = -1;
+	for (hsse_t* pe = pset->phead; pe != NULL; pe = pe->pnext) {
+		int i = atoi(&pe->key[1]);
+		mu_assert_lf(i > prev);
+		prev = i;
+	}
+	hss_t* pcopy = hss_copy(pset);
+	mu_assert_lf(hss_check_counts(pcopy));
+	mu_assert_lf(hss_size(pcopy) == hss_size(pset));
+	hss_free(pcopy);
+
+	hss_clear(pset);
+	mu_assert_lf(hss_size(pset) == 0);
+	mu_assert_lf(!hss_has(pset, keys[999]));
+	mu_assert_lf(hss_check_counts(pset));
+
+	hss_free(pset);
+
+	return NULL;
+}
+
 // ----------------------------------------------------------------
 static char* test_lhmsi() {
 
@@ -526,6 +575,41 @@ static char* test_lhmsv() {
 	return NULL;
 }
 
+// ----------------------------------------------------------------
+// Insertion order, and the entry links, must survive enlargement.
+static char* test_lhmsv_many() {
+	char keys[1000][8];
+	lhmsv_t *pmap = lhmsv_alloc();
+	for (int i = 0; i < 1000; i++) {
+		sprintf(keys[i], "k%d", i);
+		lhmsv_put(pmap, keys[i], keys[i], NO_FREE);
+	}
+	lhmsv_put(pmap, "k10", "ten", NO_FREE);
+	mu_assert_lf(pmap->num_occupied == 1000);
+	mu_assert_lf(lhmsv_check_counts(pmap));
+	mu_assert_lf(streq(lhmsv_get(pmap, "k10"), "ten"));
+	mu_assert_lf(streq(lhmsv_get(pmap, "k999"), "k999"));
+	mu_assert_lf(lhmsv_get(pmap, "k1000") == NULL);
+
+	int i = 0;
+	for (lhmsve_t* pe = pmap->phead; pe != NULL; pe = pe->pnext, i++) {
+		mu_assert_lf(streq(pe->key, keys[i]));
+		mu_assert_lf(pe->pprev == ((i == 0) ? NULL : pe - 1));
+	}
+	mu_assert_lf(i == 1000);
+	mu_assert_lf(pmap->ptail == &pmap->entries[999]);
+
+	lhmsv_clear(pmap);
+	mu_assert_lf(pmap->num_occupied == 0);
+	mu_assert_lf(pmap->phead == NULL);
+	mu_assert_lf(!lhmsv_has_key(pmap, "k10"));
+	mu_assert_lf(lhmsv_check_counts(pmap));
+
+	lhmsv_free(pmap);
+
+	return NULL;
+}
+
 // ----------------------------------------------------------------
 static char* test_lhms2v() {
 
@@ -622,6 +706,21 @@ static char* test_lhmslv() {
 	mu_assert_lf( lhmslv_has_key(pmap, bz)); mu_assert_lf(streq(lhmslv_get(pmap, bz), "7"));
 	mu_assert_lf(lhmslv_check_counts(pmap));
 
+	// Array-keyed access finds the same entries as list-keyed access.
+	string_array_t* pvalues = string_array_alloc(2);
+	pvalues->strings[0] = "a"; pvalues->strings[1] = "y";
+	mu_assert_lf(string_array_hash_func(pvalues) == slls_hash_func(ay));
+	mu_assert_lf(streq(lhmslv_get_from_string_array(pmap, pvalues), "5"));
+	pvalues->strings[1] = "v";
+	mu_assert_lf(lhmslv_get_from_string_array(pmap, pvalues) == NULL);
+	slls_t* pkey = lhmslv_put_copy_of_string_array(pmap, pvalues, "9");
+	mu_assert_lf(pmap->num_occupied == 4);
+	mu_assert_lf(pkey->length == 2 && streq(pkey->phead->pnext->value, "v"));
+	mu_assert_lf(pkey->phead->pnext->value != pvalues->strings[1]);
+	mu_assert_lf(streq(lhmslv_get_from_string_array(pmap, pvalues), "9"));
+	mu_assert_lf(lhmslv_check_counts(pmap));
+	string_array_free(pvalues);
+
 	lhmslv_free(pmap);
 
 	return NULL;
@@ -736,6 +835,222 @@ static char* test_percentile_keeper() {
 	return NULL;
 }
 
+// ----------------------------------------------------------------
+static double fmv(mv_t* pval) {
+	return (pval->type == MT_INT) ? (double)pval->u.intv : pval->u.fltv;
+}
+
+// All-int and all-float inputs are kept as keys and selected rather than
+// sorted: check them against sorting the mv_t's.
+static char* test_percentile_keeper_typed() {
+	int n = 5000;
+	mv_t* expected = mlr_malloc_or_die(n * sizeof(mv_t));
+	for (int which = 0; which < 3; which++) {
+		percentile_keeper_t* ppercentile_keeper = percentile_keeper_alloc();
+		unsigned long long state = 777;
+		for (int i = 0; i < n; i++) {
+			state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+			long long r = (long long)(state >> 20) % 2001 - 1000; // Lots of duplicates
+			mv_t value = (which == 0) ? mv_from_int(r)
+				: (which == 1) ? mv_from_float(r / 7.0)
+				: (i == n/2) ? mv_from_float(0.5) : mv_from_int(r);
+			// Big, but not so big that mv_xx_comparator's int subtraction overflows.
+			if (which == 0 && i == 0)
+				value = mv_from_int(-4000000000000000000LL);
+			if (which == 0 && i == 1)
+				value = mv_from_int(4000000000000000000LL);
+			if (which == 1 && i == 0)
+				value = mv_from_float(-1e300);
+			expected[i] = value;
+			percentile_keeper_ingest(ppercentile_keeper, value);
+		}
+		mu_assert_lf(ppercentile_keeper->mode == ((which == 0) ? PK_INTS : (which == 1) ? PK_FLOATS : PK_MVS));
+		qsort(expected, n, sizeof(mv_t), mv_xx_comparator);
+
+		// More percentiles than the keeper tracks selections for, so it ends up sorting.
+		for (int j = 0; j <= 40; j++) {
+			double p = (j * 37) % 41 * 2.5;
+			long long index = p * n / 100.0;
+			if (index >= n)
+				index = n - 1;
+			mv_t q = percentile_keeper_emit_non_interpolated(ppercentile_keeper, p);
+			mu_assert_lf(q.type == expected[index].type);
+			mu_assert_lf(mv_xx_comparator(&q, &expected[index]) == 0);
+
+			q = percentile_keeper_emit_linearly_interpolated(ppercentile_keeper, p);
+			double findex = (p/100.0)*(n-1);
+			long long iindex = (long long)findex;
+			double e = (iindex >= n-1)
+				? fmv(&expected[n-1])
+				: fmv(&expected[iindex]) + (findex - iindex) *
+					(fmv(&expected[iindex+1]) - fmv(&expected[iindex]));
+			mu_assert_lf(fabs(fmv(&q) - e) <= 1e-9 * fmax(1.0, fabs(e)));
+		}
+		percentile_keeper_free(ppercentile_keeper);
+	}
+	free(expected);
+
+	// Values which mv_xx_comparator doesn't order consistently are kept as mv_t's.
+	mv_t unkeyables[] = {
+		mv_from_float(NAN), mv_from_float(-0.0), mv_from_int(-4000000000000000000LL)
+	};
+	for (int which = 0; which < 3; which++) {
+		percentile_keeper_t* ppercentile_keeper = percentile_keeper_alloc();
+		percentile_keeper_ingest(ppercentile_keeper, (which == 2)
+			? mv_from_int(6000000000000000000LL) : mv_from_float(1.5));
+		mu_assert_lf(ppercentile_keeper->mode == ((which == 2) ? PK_INTS : PK_FLOATS));
+		percentile_keeper_ingest(ppercentile_keeper, unkeyables[which]);
+		mu_assert_lf(ppercentile_keeper->mode == PK_MVS);
+		percentile_keeper_free(ppercentile_keeper);
+	}
+	return NULL;
+}
+
+// ----------------------------------------------------------------
+static int double_comparator(const void* pva, const void* pvb) {
+	double a = *(const double*)pva;
+	double b = *(const double*)pvb;
+	return (a < b) ? -1 : (a > b) ? 1 : 0;
+}
+
+// Fraction of the sorted values which are less than x.
+static double rank_fraction(double* sorted, int n, double x) {
+	int lo = 0, hi = n;
+	while (lo < hi) {
+		int mid = lo + (hi - lo) / 2;
+		if (sorted[mid] < x)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return (double)lo / n;
+}
+
+static char* test_tdigest() {
+	double ps[] = { 0.0, 0.1, 1.0, 5.0, 25.0, 50.0, 75.0, 95.0, 99.0, 99.9, 100.0 };
+	int nps = sizeof(ps) / sizeof(ps[0]);
+
+	// Small inputs: same results as the exact keeper.
+	tdigest_t* pdigest = tdigest_alloc(TDIGEST_DEFAULT_COMPRESSION);
+	percentile_keeper_t* ppercentile_keeper = percentile_keeper_alloc();
+	for (int i = 0; i < 200; i++) {
+		double x = (i * 37) % 200 / 8.0;
+		tdigest_ingest(pdigest, x);
+		percentile_keeper_ingest(ppercentile_keeper, mv_from_float(x));
+	}
+	mu_assert_lf(tdigest_is_exact(pdigest));
+	for (int i = 0; i < nps; i++) {
+		mv_t q = percentile_keeper_emit_non_interpolated(ppercentile_keeper, ps[i]);
+		mu_assert_lf(tdigest_emit_non_interpolated(pdigest, ps[i]) == q.u.fltv);
+		q = percentile_keeper_emit_linearly_interpolated(ppercentile_keeper, ps[i]);
+		mu_assert_lf(tdigest_emit_linearly_interpolated(pdigest, ps[i]) == q.u.fltv);
+	}
+	mu_assert_lf(tdigest_cdf(pdigest, 12.5) == 0.5);
+	tdigest_free(pdigest);
+	percentile_keeper_free(ppercentile_keeper);
+
+	// Large inputs: bounded size, with rank error within a fraction of a percent,
+	// smaller at the tails. Squaring skews the distribution. The second half goes
+	// into a separate digest which is then merged in.
+	int n = 100000;
+	pdigest = tdigest_alloc(TDIGEST_DEFAULT_COMPRESSION);
+	tdigest_t* pother = tdigest_alloc(TDIGEST_DEFAULT_COMPRESSION);
+	ppercentile_keeper = percentile_keeper_alloc();
+	double* sorted = mlr_malloc_or_die(n * sizeof(double));
+	unsigned long long state = 12345;
+	for (int i = 0; i < n; i++) {
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+		double u = (state >> 11) * (1.0 / 9007199254740992.0);
+		tdigest_ingest((i < n/2) ? pdigest : pother, u * u);
+		percentile_keeper_ingest(ppercentile_keeper, mv_from_float(u * u));
+		sorted[i] = u * u;
+	}
+	qsort(sorted, n, sizeof(double), double_comparator);
+	mu_assert_lf(!tdigest_is_exact(pdigest));
+	mu_assert_lf(pdigest->capacity <= pdigest->max_capacity);
+	tdigest_merge(pdigest, pother);
+	tdigest_free(pother);
+	mu_assert_lf(tdigest_count(pdigest) == n);
+
+	mu_assert_lf(tdigest_emit_non_interpolated(pdigest, 0.0) == sorted[0]);
+	mu_assert_lf(tdigest_emit_non_interpolated(pdigest, 100.0) == sorted[n-1]);
+	for (int i = 0; i < nps; i++) {
+		double q = tdigest_emit_non_interpolated(pdigest, ps[i]);
+		double error = fabs(rank_fraction(sorted, n, q) - ps[i] / 100.0);
+		double tolerance = (ps[i] <= 1.0 || ps[i] >= 99.0) ? 0.0005 : 0.002;
+		printf("p%-5.1lf exact %8.6lf approx %8.6lf rank error %8.6lf\n", ps[i],
+			percentile_keeper_emit_non_interpolated(ppercentile_keeper, ps[i]).u.fltv, q, error);
+		mu_assert_lf(error <= tolerance);
+
+		double x = percentile_keeper_emit_non_interpolated(ppercentile_keeper, ps[i]).u.fltv;
+		mu_assert_lf(fabs(tdigest_cdf(pdigest, x) - rank_fraction(sorted, n, x)) <= tolerance);
+	}
+	printf("centroids %d\n", pdigest->num_centroids);
+	mu_assert_lf(pdigest->num_centroids <= 2 * TDIGEST_DEFAULT_COMPRESSION);
+
+	tdigest_free(pdigest);
+	percentile_keeper_free(ppercentile_keeper);
+	free(sorted);
+	return NULL;
+}
+
+// ----------------------------------------------------------------
+static char* test_hll() {
+	char buf[32];
+
+	// Exact while sparse, including repeats.
+	hll_t* phll = hll_alloc(HLL_DEFAULT_PRECISION);
+	mu_assert_lf(hll_count(phll) == 0);
+	for (int i = 0; i < 3000; i++) {
+		sprintf(buf, "v%d", i % 300);
+		hll_ingest_string(phll, buf);
+	}
+	hll_print(phll);
+	mu_assert_lf(hll_is_sparse(phll));
+	mu_assert_lf(hll_count(phll) == 300);
+
+	// Within four standard errors once dense.
+	for (int i = 300; i < 100000; i++) {
+		sprintf(buf, "v%d", i);
+		hll_ingest_string(phll, buf);
+	}
+	hll_print(phll);
+	mu_assert_lf(!hll_is_sparse(phll));
+	double error = 4 * 1.04 / sqrt(1 << HLL_DEFAULT_PRECISION);
+	mu_assert_lf(fabs(hll_count(phll) / 100000.0 - 1.0) < error);
+
+	// Merging overlapping sketches estimates the union: dense into dense ...
+	hll_t* pother = hll_alloc(HLL_DEFAULT_PRECISION);
+	for (int i = 50000; i < 150000; i++) {
+		sprintf(buf, "v%d", i);
+		hll_ingest_string(pother, buf);
+	}
+	hll_merge(phll, pother);
+	hll_print(phll);
+	mu_assert_lf(fabs(hll_count(phll) / 150000.0 - 1.0) < error);
+
+	// ... sparse into dense ...
+	hll_t* psmall = hll_alloc(HLL_DEFAULT_PRECISION);
+	for (int i = 0; i < 100; i++) {
+		sprintf(buf, "w%d", i);
+		hll_ingest_string(psmall, buf);
+	}
+	unsigned long long before = hll_count(phll);
+	hll_merge(phll, psmall);
+	mu_assert_lf(hll_count(phll) >= before);
+	mu_assert_lf(hll_count(phll) <= before + 200);
+
+	// ... and dense into sparse.
+	hll_merge(psmall, pother);
+	mu_assert_lf(!hll_is_sparse(psmall));
+	mu_assert_lf(fabs(hll_count(psmall) / 100100.0 - 1.0) < error);
+
+	hll_free(phll);
+	hll_free(pother);
+	hll_free(psmall);
+	return NULL;
+}
+
 // ----------------------------------------------------------------
 static char* test_top_keeper() {
 	int capacity = 3;
@@ -744,12 +1059,14 @@ static char* test_top_keeper() {
 	mu_assert_lf(ptop_keeper->size == 0);
 
 	top_keeper_add(ptop_keeper, mv_from_float(5.0), NULL);
+	top_keeper_sort(ptop_keeper);
 	top_keeper_print(ptop_keeper);
 	mu_assert_lf(ptop_keeper->size == 1);
 	mu_assert_lf(ptop_keeper->top_values[0].type == MT_FLOAT);
 	mu_assert_lf(ptop_keeper->top_values[0].u.fltv == 5.0);
 
 	top_keeper_add(ptop_keeper, mv_from_float(6.0), NULL);
+	top_keeper_sort(ptop_keeper);
 	top_keeper_print(ptop_keeper);
 	mu_assert_lf(ptop_keeper->size == 2);
 	mu_assert_lf(ptop_keeper->top_values[0].type == MT_FLOAT);
@@ -758,6 +1075,7 @@ static char* test_top_keeper() {
 	mu_assert_lf(ptop_keeper->top_values[1].u.fltv == 5.0);
 
 	top_keeper_add(ptop_keeper, mv_from_int(4), NULL);
+	top_keeper_sort(ptop_keeper);
 	top_keeper_print(ptop_keeper);
 	mu_assert_lf(ptop_keeper->size == 3);
 	mu_assert_lf(ptop_keeper->top_values[0].type == MT_FLOAT);
@@ -768,6 +1086,7 @@ static char* test_top_keeper() {
 	mu_assert_lf(ptop_keeper->top_values[2].u.intv == 4.0);
 
 	top_keeper_add(ptop_keeper, mv_from_int(2), NULL);
+	top_keeper_sort(ptop_keeper);
 	top_keeper_print(ptop_keeper);
 	mu_assert_lf(ptop_keeper->size == 3);
 	mu_assert_lf(ptop_keeper->top_values[0].type == MT_FLOAT);
@@ -778,6 +1097,7 @@ static char* test_top_keeper() {
 	mu_assert_lf(ptop_keeper->top_values[2].u.intv == 4.0);
 
 	top_keeper_add(ptop_keeper, mv_from_int(7), NULL);
+	top_keeper_sort(ptop_keeper);
 	top_keeper_print(ptop_keeper);
 	mu_assert_lf(ptop_keeper->size == 3);
 	mu_assert_lf(ptop_keeper->top_values[0].type == MT_INT);
@@ -791,6 +1111,219 @@ static char* test_top_keeper() {
 	return NULL;
 }
 
+// ----------------------------------------------------------------
+static char* test_top_keeper_ties() {
+	// Against binary search and insertion into a sorted array, with many ties. Each record
+	// holds its input index, to check the order of equal values.
+	int n = 2000, capacity = 100;
+	mv_t* sorted_values = mlr_malloc_or_die(capacity * sizeof(mv_t));
+	int* sorted_indices = mlr_malloc_or_die(capacity * sizeof(int));
+	int size = 0;
+	top_keeper_t* ptop_keeper = top_keeper_alloc(capacity);
+	unsigned seed = 1;
+	for (int i = 0; i < n; i++) {
+		seed = seed * 1103515245 + 12345;
+		mv_t value = mv_from_int((seed >> 16) % 50);
+
+		int destidx = mlr_bsearch_mv_n_for_insert(sorted_values, size, &value);
+		if (destidx < capacity) {
+			if (size < capacity)
+				size++;
+			for (int j = size-2; j >= destidx; j--) {
+				sorted_values[j+1]  = sorted_values[j];
+				sorted_indices[j+1] = sorted_indices[j];
+			}
+			sorted_values[destidx]  = value;
+			sorted_indices[destidx] = i;
+		}
+
+		lrec_t* prec = lrec_unbacked_alloc();
+		lrec_put(prec, "i", mlr_alloc_string_from_int(i), FREE_ENTRY_VALUE);
+		top_keeper_add(ptop_keeper, value, prec);
+	}
+	top_keeper_sort(ptop_keeper);
+	mu_assert_lf(ptop_keeper->size == capacity);
+	for (int k = 0; k < capacity; k++) {
+		mu_assert_lf(ptop_keeper->top_values[k].u.intv == sorted_values[k].u.intv);
+		mu_assert_lf(atoi(lrec_get(ptop_keeper->top_precords[k], "i")) == sorted_indices[k]);
+	}
+
+	// Adding after sorting is allowed.
+	top_keeper_add(ptop_keeper, mv_from_int(100), NULL);
+	top_keeper_sort(ptop_keeper);
+	mu_assert_lf(ptop_keeper->top_values[0].u.intv == 100);
+	mu_assert_lf(ptop_keeper->top_values[1].u.intv == sorted_values[0].u.intv);
+
+	for (int k = 0; k < ptop_keeper->size; k++)
+		lrec_free(ptop_keeper->top_precords[k]);
+	top_keeper_free(ptop_keeper);
+	free(sorted_values);
+	free(sorted_indices);
+	return NULL;
+}
+
+// ----------------------------------------------------------------
+static char* test_space_saving() {
+	// Value i occurs about 1/(i+1) as often as value 0, over a long tail.
+	int num_values = 2000, n = 50000, capacity = 50;
+	long long* true_counts = mlr_malloc_or_die(num_values * sizeof(long long));
+	memset(true_counts, 0, num_values * sizeof(long long));
+	string_array_t* pvalues = string_array_alloc(1);
+	char buf[32];
+	pvalues->strings[0] = buf;
+
+	space_saving_t* pss = space_saving_alloc(capacity);
+	unsigned seed = 1;
+	for (int k = 0; k < n; k++) {
+		seed = seed * 1103515245 + 12345;
+		double u = ((seed >> 8) & 0xffff) / 65536.0;
+		int i = (int)(pow(num_values + 1.0, u)) - 1;
+		true_counts[i]++;
+		sprintf(buf, "%d", i);
+		space_saving_ingest(pss, pvalues);
+	}
+	pvalues->strings[0] = NULL;
+	string_array_free(pvalues);
+	space_saving_print(pss);
+	mu_assert_lf(pss->size == capacity);
+	mu_assert_lf(pss->num_ingested == n);
+
+	space_saving_entry_t** pentries = space_saving_sorted_entries(pss);
+	long long sum = 0;
+	for (int j = 0; j < pss->size; j++) {
+		space_saving_entry_t* pe = pentries[j];
+		int i = atoi(pe->key->phead->value);
+		sum += pe->count;
+		mu_assert_lf(pe->count >= true_counts[i]);
+		mu_assert_lf(pe->count - pe->error <= true_counts[i]);
+		mu_assert_lf(pe->error <= n / capacity);
+		if (j > 0)
+			mu_assert_lf(pentries[j-1]->count >= pe->count);
+	}
+	mu_assert_lf(sum == n);
+
+	// Anything occurring more than n/capacity times is tracked.
+	for (int i = 0; i < num_values; i++) {
+		if (true_counts[i] <= n / capacity)
+			continue;
+		int found = FALSE;
+		for (int j = 0; j < pss->size; j++)
+			if (atoi(pentries[j]->key->phead->value) == i)
+				found = TRUE;
+		mu_assert_lf(found);
+	}
+	mu_assert_lf(streq(pentries[0]->key->phead->value, "0"));
+
+	free(pentries);
+	space_saving_free(pss);
+	free(true_counts);
+	return NULL;
+}
+
+// ----------------------------------------------------------------
+static char* test_spill_file() {
+	spill_file_t* psf = spill_file_alloc();
+	mu_assert_lf(spill_file_read(psf) == NULL);
+
+	lrec_t* prec = lrec_unbacked_alloc();
+	lrec_put(prec, "a", "1", NO_FREE);
+	lrec_put(prec, "", "", NO_FREE);
+	lrec_put(prec, "c=d", "x,y\nz", NO_FREE);
+	lrec_t* pempty = lrec_unbacked_alloc();
+
+	for (int i = 0; i < 1000; i++) {
+		spill_file_write(psf, prec);
+		spill_file_write(psf, pempty);
+	}
+	mu_assert_lf(psf->num_records == 2000);
+	mu_assert_lf(psf->num_fields == 3000);
+
+	spill_file_rewind(psf);
+	for (int i = 0; i < 1000; i++) {
+		lrec_t* pread = spill_file_read(psf);
+		mu_assert_lf(pread != NULL);
+		mu_assert_lf(pread->field_count == 3);
+		mu_assert_lf(streq(pread->phead->key, "a"));
+		mu_assert_lf(streq(pread->phead->value, "1"));
+		mu_assert_lf(streq(pread->phead->pnext->key, ""));
+		mu_assert_lf(streq(pread->phead->pnext->value, ""));
+		mu_assert_lf(streq(pread->ptail->key, "c=d"));
+		mu_assert_lf(streq(pread->ptail->value, "x,y\nz"));
+		lrec_free(pread);
+		pread = spill_file_read(psf);
+		mu_assert_lf(pread != NULL);
+		mu_assert_lf(pread->field_count == 0);
+		lrec_free(pread);
+	}
+	mu_assert_lf(spill_file_read(psf) == NULL);
+
+	lrec_free(prec);
+	lrec_free(pempty);
+	spill_file_free(psf);
+	return NULL;
+}
+
+// ----------------------------------------------------------------
+static char* test_schema_cache() {
+	schema_cache_t* pcache = schema_cache_alloc(free);
+
+	lrec_t* pab = lrec_unbacked_alloc();
+	lrec_put(pab, "a", "1", NO_FREE);
+	lrec_put(pab, "b", "2", NO_FREE);
+	mu_assert_lf(schema_cache_get(pcache, pab) == NULL);
+	// The schema is as at the miss, even if the record is then changed.
+	lrec_remove(pab, "b");
+	schema_cache_put(pcache, mlr_strdup_or_die("ab"));
+	lrec_put(pab, "b", "3", NO_FREE);
+
+	lrec_t* pba = lrec_unbacked_alloc();
+	lrec_put(pba, "b", "4", NO_FREE);
+	lrec_put(pba, "a", "5", NO_FREE);
+	mu_assert_lf(schema_cache_get(pcache, pba) == NULL);
+	schema_cache_put(pcache, mlr_strdup_or_die("ba"));
+
+	lrec_t* pempty = lrec_unbacked_alloc();
+	mu_assert_lf(schema_cache_get(pcache, pempty) == NULL);
+	schema_cache_put(pcache, mlr_strdup_or_die("empty"));
+
+	for (int i = 0; i < 3; i++) {
+		mu_assert_lf(streq(schema_cache_get(pcache, pab), "ab"));
+		mu_assert_lf(streq(schema_cache_get(pcache, pab), "ab"));
+		mu_assert_lf(streq(schema_cache_get(pcache, pba), "ba"));
+		mu_assert_lf(streq(schema_cache_get(pcache, pempty), "empty"));
+	}
+	mu_assert_lf(schema_cache_size(pcache) == 3);
+
+	lrec_t* pa = lrec_unbacked_alloc();
+	lrec_put(pa, "a", "6", NO_FREE);
+	mu_assert_lf(schema_cache_get(pcache, pa) == NULL);
+
+	// Distinct schemas beyond the maximum clear the cache rather than growing it.
+	char buf[32];
+	for (int i = 0; i < 2 * SCHEMA_CACHE_MAX_ENTRIES; i++) {
+		lrec_t* prec = lrec_unbacked_alloc();
+		sprintf(buf, "k%d", i);
+		lrec_put(prec, mlr_strdup_or_die(buf), "v", FREE_ENTRY_KEY);
+		mu_assert_lf(schema_cache_get(pcache, prec) == NULL);
+		schema_cache_put(pcache, mlr_strdup_or_die(buf));
+		mu_assert_lf(streq(schema_cache_get(pcache, prec), buf));
+		mu_assert_lf(schema_cache_size(pcache) <= SCHEMA_CACHE_MAX_ENTRIES);
+		lrec_free(prec);
+	}
+	lrec_t* prec = lrec_unbacked_alloc();
+	sprintf(buf, "k%d", 2 * SCHEMA_CACHE_MAX_ENTRIES - 2);
+	lrec_put(prec, buf, "v", NO_FREE);
+	mu_assert_lf(streq(schema_cache_get(pcache, prec), buf));
+
+	lrec_free(prec);
+	lrec_free(pa);
+	lrec_free(pab);
+	lrec_free(pba);
+	lrec_free(pempty);
+	schema_cache_free(pcache);
+	return NULL;
+}
+
 // ----------------------------------------------------------------
 static char* test_dheap() {
 
@@ -868,15 +1401,24 @@ static char * run_all_tests() {
 	mu_run_test(test_sllv);
 	mu_run_test(test_string_array);
 	mu_run_test(test_hss);
+	mu_run_test(test_hss_many);
 	mu_run_test(test_lhmsi);
 	mu_run_test(test_lhmsll);
 	mu_run_test(test_lhmss);
 	mu_run_test(test_lhmsv);
+	mu_run_test(test_lhmsv_many);
 	mu_run_test(test_lhms2v);
 	mu_run_test(test_lhmslv);
 	mu_run_test(test_lhmsmv);
 	mu_run_test(test_percentile_keeper);
+	mu_run_test(test_percentile_keeper_typed);
+	mu_run_test(test_tdigest);
+	mu_run_test(test_hll);
 	mu_run_test(test_top_keeper);
+	mu_run_test(test_top_keeper_ties);
+	mu_run_test(test_space_saving);
+	mu_run_test(test_spill_file);
+	mu_run_test(test_schema_cache);
 	mu_run_test(test_dheap);
 	return 0;
 }
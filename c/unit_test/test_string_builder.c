@@ -4,6 +4,7 @@
 #include "lib/mlr_globals.h"
 #include "lib/mlrutil.h"
 #include "lib/string_builder.h"
+#include "lib/string_arena.h"
 
 int tests_run         = 0;
 int tests_failed      = 0;
@@ -70,9 +71,42 @@ static char * test_simple() {
 	return 0;
 }
 
+// ----------------------------------------------------------------
+static char * test_string_arena() {
+	string_arena_t* parena = string_arena_alloc(16);
+
+	char* a = string_arena_strdup(parena, "abc");
+	char* b = string_arena_strdup(parena, "defg");
+	mu_assert("error: arena case 0", streq(a, "abc"));
+	mu_assert("error: arena case 1", streq(b, "defg"));
+	mu_assert("error: arena case 2", b == a + 4);
+
+	// Doesn't fit in the first chunk; bigger than the chunk size.
+	string_arena_mark_t mark = string_arena_mark(parena);
+	char* c = string_arena_strdup(parena, "hello, world, hello!");
+	mu_assert("error: arena case 3", streq(c, "hello, world, hello!"));
+	mu_assert("error: arena case 4", streq(a, "abc"));
+	mu_assert("error: arena case 5", streq(b, "defg"));
+
+	// Released chunks are reused.
+	string_arena_release(parena, mark);
+	char* d = string_arena_strdup(parena, "hello, there");
+	mu_assert("error: arena case 6", d == c);
+	mu_assert("error: arena case 7", streq(a, "abc"));
+
+	string_arena_reset(parena);
+	char* e = string_arena_strdup(parena, "");
+	mu_assert("error: arena case 8", e == a);
+	mu_assert("error: arena case 9", streq(e, ""));
+
+	string_arena_free(parena);
+	return 0;
+}
+
 // ================================================================
 static char * all_tests() {
 	mu_run_test(test_simple);
+	mu_run_test(test_string_arena);
 	return 0;
 }
 
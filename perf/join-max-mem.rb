@@ -0,0 +1,76 @@
+#!/usr/bin/ruby
+
+require 'time'
+
+# ================================================================
+# Checks that unsorted mlr join with --max-mem keeps its peak memory near the
+# budget, as the left file grows past it. Linux-only, since peak memory is read
+# from /proc. Usage:
+#
+#   ruby join-max-mem.rb [mlr executable, default mlr]
+#
+# Output is e.g.
+#
+# experiment=join,nrecs=200000,max_mem=none,seconds=2.5,peak_mb=134
+# experiment=join,nrecs=200000,max_mem=1,seconds=3.31,peak_mb=15
+# experiment=join,nrecs=200000,max_mem=5,seconds=1.61,peak_mb=19
+# experiment=join,nrecs=200000,max_mem=20,seconds=1.95,peak_mb=33
+# ...
+#
+# Without a budget peak_mb grows with nrecs, at about 130MB per 200000 records
+# each side. With one it should stay within about 15MB of the budget, plus the
+# input files themselves, since pages of mmapped input count as resident; use
+# mlr --no-mmap to leave those out.
+# ================================================================
+
+# Returns seconds and peak resident megabytes, or 'error'.
+def run_cmd(cmd)
+  t1 = Time.new
+  pid = Process.spawn(*cmd, :out => '/dev/null')
+  peak_kb = 0
+  loop do
+    begin
+      hwm = File.read("/proc/#{pid}/status")[/^VmHWM:\s*(\d+)/, 1]
+      peak_kb = [peak_kb, hwm.to_i].max if hwm
+    rescue Errno::ENOENT, Errno::ESRCH
+    end
+    break if Process.wait(pid, Process::WNOHANG)
+    sleep 0.01
+  end
+  status = $?
+  t2 = Time.new
+  if status.to_i == 0
+    [(t2.to_f - t1.to_f).round(2), peak_kb / 1024]
+  else
+    ['error', 'error']
+  end
+end
+
+# ----------------------------------------------------------------
+mlr = ARGV[0] || "mlr"
+
+dir = "/tmp/join-max-mem.#{Process.pid}"
+Dir.mkdir(dir)
+
+nrecss = [50000, 100000, 200000, 400000]
+max_mems = ['none', 1, 5, 20]
+
+begin
+  nrecss.each do |nrecs|
+    left  = "#{dir}/left.dkvp"
+    right = "#{dir}/right.dkvp"
+    system("#{mlr} seqgen --stop #{nrecs} then put '$k = urandint(1, #{nrecs}); $l = \"left-#{nrecs}\"' > #{left}")
+    system("#{mlr} seqgen --stop #{nrecs} then put '$k = urandint(1, #{nrecs}); $r = \"right-#{nrecs}\"' > #{right}")
+
+    max_mems.each do |max_mem|
+      cmd = [mlr, 'join']
+      cmd += ['--max-mem', max_mem.to_s] unless max_mem == 'none'
+      cmd += ['-j', 'k', '-f', left, right]
+      seconds, peak_mb = run_cmd(cmd)
+      puts "experiment=join,nrecs=#{nrecs},max_mem=#{max_mem},seconds=#{seconds},peak_mb=#{peak_mb}"
+    end
+  end
+ensure
+  Dir.glob("#{dir}/*").each { |f| File.delete(f) }
+  Dir.rmdir(dir)
+end
@@ -0,0 +1,44 @@
+#!/usr/bin/ruby
+
+require 'time'
+
+# ================================================================
+# Times mlr top as -n grows, for a fixed input file. Usage:
+#
+#   ruby top-n.rb {input file} [mlr executable, default mlr]
+#
+# Output is e.g.
+#
+# experiment=top,n=1,top_seconds=0.51,top_a_seconds=0.55
+# experiment=top,n=10,top_seconds=0.52,top_a_seconds=0.55
+# ...
+#
+# which can be plotted via
+#
+#   mlr --onidx --ofs ' ' cut -x -f experiment top-n.out | pgr -nc -title top -xlabel n -ylabel seconds -legend 'top top_a' -lop
+# ================================================================
+
+def run_cmd(cmd)
+	t1 = Time.new
+	system(cmd)
+  status = $?
+	t2 = Time.new
+	secs = t2.to_f - t1.to_f
+  if status.to_i == 0
+    secs
+  else
+	  'error'
+  end
+end
+
+# ----------------------------------------------------------------
+filename = ARGV[0] or abort("Usage: #{$0} {input file} [mlr executable]")
+mlr = ARGV[1] || "mlr"
+
+ns = [1, 10, 100, 1000, 10000, 100000]
+
+ns.each do |n|
+  top_seconds   = run_cmd("#{mlr} top -n #{n} -f x #{filename} > /dev/null")
+  top_a_seconds = run_cmd("#{mlr} top -n #{n} -f x -a #{filename} > /dev/null")
+  puts "experiment=top,n=#{n},top_seconds=#{top_seconds},top_a_seconds=#{top_a_seconds}"
+end